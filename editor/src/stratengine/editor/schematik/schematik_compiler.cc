@@ -0,0 +1,100 @@
+#include "stratengine/editor/schematik/schematik_compiler.h"
+
+#include <cstdio>
+
+STRATE_INNER_NAMESPACE(editor)
+STRATE_MAKE_NAMESPACE(schematik)
+
+namespace gs = navary::graph::shader;
+
+SchematikCompiler::SchematikCompiler() : compile_count_(0) {}
+
+SchematikCompiler::~SchematikCompiler() {}
+
+void SchematikCompiler::Build(const SchematikGraph& graph, Result* out) {
+  out->revision = graph.revision();
+  out->bytes.clear();
+  out->stats = gs::NavGraphWriteStats{};
+
+  gs::NavGraphWriter writer(graph.surface_model());
+  for (const SchematikNode& node : graph.nodes()) {
+    if (node.inputs.size() > gs::kNavGraphMaxInputs ||
+        node.outputs.size() > gs::kNavGraphMaxOutputs ||
+        node.params.size() > 0xFFFF) {
+      out->status = navary::NavaryRC(navary::NavaryStatus::kInvalidArgument,
+                                     "Schematik: node has too many pins");
+      return;
+    }
+    gs::NavGraphNodeDesc desc{};
+    desc.id           = node.id;
+    desc.kind         = node.kind;
+    desc.input_count  = uint8_t(node.inputs.size());
+    desc.output_count = uint8_t(node.outputs.size());
+    for (size_t i = 0; i < node.inputs.size(); i++) {
+      desc.input_types[i] = node.inputs[i];
+    }
+    for (size_t i = 0; i < node.outputs.size(); i++) {
+      desc.output_types[i] = node.outputs[i];
+    }
+    desc.params      = node.params.data();
+    desc.param_count = uint16_t(node.params.size());
+    out->status      = writer.AddNode(desc);
+    if (!out->status.ok()) {
+      return;
+    }
+  }
+  for (const SchematikLink& link : graph.links()) {
+    out->status = writer.AddLink(gs::NavGraphLinkDesc{
+        link.from_node, link.from_output, link.to_node, link.to_input});
+    if (!out->status.ok()) {
+      return;
+    }
+  }
+  out->status = writer.Build(&out->bytes, &out->stats);
+  if (!out->status.ok()) {
+    out->bytes.clear();
+  }
+}
+
+const SchematikCompiler::Result& SchematikCompiler::Compile(
+    const SchematikGraph& graph) {
+  Result& entry = cache_[graph.graph_id()];
+  if (entry.revision != graph.revision()) {
+    Build(graph, &entry);
+    compile_count_++;
+  }
+  return entry;
+}
+
+bool SchematikCompiler::IsCached(const SchematikGraph& graph) const {
+  const auto it = cache_.find(graph.graph_id());
+  return it != cache_.end() && it->second.revision == graph.revision();
+}
+
+navary::NavaryRC SchematikCompiler::Save(const SchematikGraph& graph,
+                                         const std::string& path) {
+  const Result& result = Compile(graph);
+  if (!result.status.ok()) {
+    return result.status;
+  }
+  std::FILE* f = std::fopen(path.c_str(), "wb");
+  if (f == nullptr) {
+    return navary::NavaryRC(navary::NavaryStatus::kIoError,
+                            "Schematik: cannot open output file");
+  }
+  const size_t written = std::fwrite(result.bytes.data(), 1,
+                                     result.bytes.size(), f);
+  const bool closed    = std::fclose(f) == 0;
+  if (written != result.bytes.size() || !closed) {
+    return navary::NavaryRC(navary::NavaryStatus::kIoError,
+                            "Schematik: write failed");
+  }
+  return navary::NavaryRC::OK();
+}
+
+void SchematikCompiler::Evict(uint64_t graph_id) {
+  cache_.erase(graph_id);
+}
+
+STRATE_END_NAMESPACE
+STRATE_INNER_END_NAMESPACE
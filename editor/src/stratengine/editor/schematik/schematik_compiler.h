@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "navary/graph/shader/navgraph_writer.h"
+#include "navary/navary_status.h"
+#include "stratengine/editor/schematik/schematik_editor.h"
+#include "stratengine/macro.h"
+
+STRATE_INNER_NAMESPACE(editor)
+STRATE_MAKE_NAMESPACE(schematik)
+
+// Compiles Schematik graphs to navgraph v1 binaries through
+// NavGraphWriter (validation, pruning, merging, sorting, param packing)
+// and keeps the last result per graph keyed by revision. Calling
+// Compile() after edits (e.g. on an idle frame) means Save() only writes
+// bytes that already exist.
+class SchematikCompiler {
+public:
+  struct Result {
+    uint64_t revision = 0;
+    navary::NavaryRC status;
+    std::vector<uint8_t> bytes;  // empty when status is not ok
+    navary::graph::shader::NavGraphWriteStats stats{};
+  };
+
+  SchematikCompiler();
+  ~SchematikCompiler();
+
+  SchematikCompiler(const SchematikCompiler&)            = delete;
+  SchematikCompiler& operator=(const SchematikCompiler&) = delete;
+
+  // Cached result for the graph's current revision, compiling first when
+  // the cache is stale. Failures are cached too, so a broken graph is not
+  // recompiled every frame.
+  const Result& Compile(const SchematikGraph& graph);
+
+  // Writes the compiled binary to |path|.
+  navary::NavaryRC Save(const SchematikGraph& graph, const std::string& path);
+
+  // True when Compile() would not have to run the writer.
+  bool IsCached(const SchematikGraph& graph) const;
+
+  void Evict(uint64_t graph_id);
+
+  uint64_t compile_count() const {
+    return compile_count_;
+  }
+
+private:
+  static void Build(const SchematikGraph& graph, Result* out);
+
+  std::unordered_map<uint64_t, Result> cache_;
+  uint64_t compile_count_;
+};
+
+STRATE_END_NAMESPACE
+STRATE_INNER_END_NAMESPACE
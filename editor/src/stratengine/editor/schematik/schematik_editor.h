@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "navary/core/handles.h"
+#include "navary/graph/shader/navgraph_binary.h"
+#include "stratengine/macro.h"
+
+STRATE_INNER_NAMESPACE(editor)
+STRATE_MAKE_NAMESPACE(schematik)
+
+using navary::graph::shader::NodeKind;
+using navary::graph::shader::ValueTypeBinary;
+
+struct SchematikNode {
+  uint32_t id   = 0;
+  NodeKind kind = NodeKind::kConstFloat;
+  std::vector<ValueTypeBinary> inputs;
+  std::vector<ValueTypeBinary> outputs;
+  std::vector<float> params;
+
+  // Editor-only state; never part of the compiled graph.
+  std::string label;
+  float x = 0.0f;
+  float y = 0.0f;
+};
+
+struct SchematikLink {
+  uint32_t from_node;
+  uint8_t from_output;
+  uint32_t to_node;
+  uint8_t to_input;
+};
+
+// The node graph document edited in Schematik. Every edit that changes
+// what compiles bumps revision(); layout-only edits (moving nodes,
+// labels) do not, so they never invalidate a compiled binary.
+class SchematikGraph {
+public:
+  explicit SchematikGraph(uint64_t graph_id,
+                          navary::core::SurfaceModel surface_model =
+                              navary::core::SurfaceModel::kLitePbr)
+      : graph_id_(graph_id),
+        surface_model_(surface_model),
+        next_node_id_(1),
+        revision_(1) {}
+
+  // Assigns and returns the node id.
+  uint32_t AddNode(SchematikNode node) {
+    node.id = next_node_id_++;
+    nodes_.push_back(std::move(node));
+    revision_++;
+    return nodes_.back().id;
+  }
+
+  // Removes the node and every link touching it.
+  void RemoveNode(uint32_t id) {
+    for (size_t i = 0; i < links_.size();) {
+      if (links_[i].from_node == id || links_[i].to_node == id) {
+        links_.erase(links_.begin() + i);
+      } else {
+        i++;
+      }
+    }
+    for (size_t i = 0; i < nodes_.size(); i++) {
+      if (nodes_[i].id == id) {
+        nodes_.erase(nodes_.begin() + i);
+        break;
+      }
+    }
+    revision_++;
+  }
+
+  // Replaces any link already feeding the same input.
+  void Connect(const SchematikLink& link) {
+    Disconnect(link.to_node, link.to_input);
+    links_.push_back(link);
+    revision_++;
+  }
+
+  void Disconnect(uint32_t to_node, uint8_t to_input) {
+    for (size_t i = 0; i < links_.size(); i++) {
+      if (links_[i].to_node == to_node && links_[i].to_input == to_input) {
+        links_.erase(links_.begin() + i);
+        revision_++;
+        return;
+      }
+    }
+  }
+
+  void SetParam(uint32_t id, uint32_t index, float value) {
+    SchematikNode* node = Find(id);
+    if (node != nullptr && index < node->params.size() &&
+        node->params[index] != value) {
+      node->params[index] = value;
+      revision_++;
+    }
+  }
+
+  void SetSurfaceModel(navary::core::SurfaceModel model) {
+    if (model != surface_model_) {
+      surface_model_ = model;
+      revision_++;
+    }
+  }
+
+  void Move(uint32_t id, float x, float y) {
+    if (SchematikNode* node = Find(id)) {
+      node->x = x;
+      node->y = y;
+    }
+  }
+
+  SchematikNode* Find(uint32_t id) {
+    for (SchematikNode& node : nodes_) {
+      if (node.id == id) {
+        return &node;
+      }
+    }
+    return nullptr;
+  }
+
+  uint64_t graph_id() const {
+    return graph_id_;
+  }
+  uint64_t revision() const {
+    return revision_;
+  }
+  navary::core::SurfaceModel surface_model() const {
+    return surface_model_;
+  }
+  const std::vector<SchematikNode>& nodes() const {
+    return nodes_;
+  }
+  const std::vector<SchematikLink>& links() const {
+    return links_;
+  }
+
+private:
+  uint64_t graph_id_;
+  navary::core::SurfaceModel surface_model_;
+  uint32_t next_node_id_;
+  uint64_t revision_;
+  std::vector<SchematikNode> nodes_;
+  std::vector<SchematikLink> links_;
+};
+
+STRATE_END_NAMESPACE
+STRATE_INNER_END_NAMESPACE
@@ -0,0 +1,277 @@
+#include "stratengine/editor/ui/ext/image_histogram.h"
+
+#include <imgui_internal.h>
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+STRATE_INNER_NAMESPACE(editor)
+STRATE_MAKE_NAMESPACE(ui)
+STRATE_MAKE_NAMESPACE(ext)
+
+namespace {
+
+// Below this many texels per band a worker thread costs more than it saves.
+constexpr size_t kMinTexelsPerBand = 256 * 1024;
+constexpr uint32_t kMaxBands       = 16;
+constexpr uint32_t kGridColor      = 0x80808080;
+
+using ChannelCounts = uint32_t[4][256];
+
+struct PartialCounts {
+  ChannelCounts counts;
+};
+
+// Four texels per step, each into its own sub-table: runs of equal bytes
+// (flat areas, alpha) would otherwise serialize on the same counter.
+void CountTexels(const unsigned char* p, size_t texels, ChannelCounts out) {
+  uint32_t sub[4][4][256];
+  std::memset(sub, 0, sizeof(sub));
+
+  size_t i = 0;
+  for (; i + 4 <= texels; i += 4, p += 16) {
+    for (int t = 0; t < 4; t++) {
+      sub[t][0][p[t * 4 + 0]]++;
+      sub[t][1][p[t * 4 + 1]]++;
+      sub[t][2][p[t * 4 + 2]]++;
+      sub[t][3][p[t * 4 + 3]]++;
+    }
+  }
+  for (; i < texels; i++, p += 4) {
+    sub[0][0][p[0]]++;
+    sub[0][1][p[1]]++;
+    sub[0][2][p[2]]++;
+    sub[0][3][p[3]]++;
+  }
+
+  for (int c = 0; c < 4; c++) {
+    for (int v = 0; v < 256; v++) {
+      out[c][v] = sub[0][c][v] + sub[1][c][v] + sub[2][c][v] + sub[3][c][v];
+    }
+  }
+}
+
+}  // namespace
+
+void ComputeImageHistogram(const unsigned char* bits, int width, int height,
+                           ImageHistogram* out) {
+  std::memset(out, 0, sizeof(*out));
+  if (bits == nullptr || width <= 0 || height <= 0) {
+    return;
+  }
+
+  const size_t texels = size_t(width) * size_t(height);
+  uint32_t bands      = uint32_t(std::min<size_t>(
+      texels / kMinTexelsPerBand, std::thread::hardware_concurrency()));
+  bands               = std::clamp<uint32_t>(bands, 1, kMaxBands);
+
+  if (bands == 1) {
+    CountTexels(bits, texels, out->counts);
+  } else {
+    // Whole rows per band; the calling thread counts band 0.
+    std::vector<PartialCounts> partial(bands);
+    std::vector<std::thread> workers;
+    workers.reserve(bands - 1);
+    const size_t rows  = size_t(height);
+    const size_t pitch = size_t(width);
+    const size_t step  = (rows + bands - 1) / bands;
+    for (uint32_t b = 1; b < bands; b++) {
+      const size_t begin = std::min(rows, b * step);
+      const size_t end   = std::min(rows, begin + step);
+      workers.emplace_back(CountTexels, bits + begin * pitch * 4,
+                           (end - begin) * pitch, partial[b].counts);
+    }
+    CountTexels(bits, std::min(rows, step) * pitch, partial[0].counts);
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+    for (const PartialCounts& p : partial) {
+      for (int c = 0; c < 4; c++) {
+        for (int v = 0; v < 256; v++) {
+          out->counts[c][v] += p.counts[c][v];
+        }
+      }
+    }
+  }
+
+  for (int c = 0; c < 3; c++) {
+    for (int v = 0; v < 256; v++) {
+      out->max_rgb = std::max(out->max_rgb, out->counts[c][v]);
+    }
+  }
+}
+
+ImageHistogramCache::ImageHistogramCache(uint32_t max_entries)
+    : max_entries_(std::max<uint32_t>(max_entries, 1)),
+      tick_(0),
+      recounts_(0) {
+  entries_.reserve(max_entries_);
+}
+
+ImageHistogramCache::~ImageHistogramCache() {}
+
+ImageHistogramCache::Entry* ImageHistogramCache::Acquire(
+    uint64_t texture_id, uint64_t version, int width, int height,
+    const unsigned char* bits) {
+  tick_++;
+  Entry* entry = nullptr;
+  for (Entry& e : entries_) {
+    if (e.texture_id == texture_id) {
+      entry = &e;
+      break;
+    }
+  }
+  if (entry != nullptr && entry->version == version) {
+    entry->last_used = tick_;
+    return entry;
+  }
+
+  if (entry == nullptr) {
+    if (entries_.size() < max_entries_) {
+      entries_.emplace_back();
+      entry = &entries_.back();
+    } else {
+      entry = &*std::min_element(entries_.begin(), entries_.end(),
+                                 [](const Entry& a, const Entry& b) {
+                                   return a.last_used < b.last_used;
+                                 });
+    }
+  }
+  entry->texture_id = texture_id;
+  entry->version    = version;
+  entry->last_used  = tick_;
+  entry->mesh_valid = false;
+  ComputeImageHistogram(bits, width, height, &entry->histogram);
+  recounts_++;
+  return entry;
+}
+
+const ImageHistogram& ImageHistogramCache::Get(uint64_t texture_id,
+                                               uint64_t version, int width,
+                                               int height,
+                                               const unsigned char* bits) {
+  return Acquire(texture_id, version, width, height, bits)->histogram;
+}
+
+// Same layering as the original imgInspect histogram: per value the three
+// channel bars are sorted by height and drawn back to front, each colored
+// by the channels still covering it.
+void ImageHistogramCache::BuildMesh(Entry* entry, ImVec2 size,
+                                    ImVec2 white_uv) {
+  entry->vertices.clear();
+  entry->mesh_size  = size;
+  entry->mesh_valid = true;
+
+  const ImageHistogram& h = entry->histogram;
+  if (h.max_rgb == 0) {
+    return;
+  }
+  const float h_factor  = size.y / float(h.max_rgb);
+  const float bar_width = size.x / 256.f;
+
+  auto quad = [&](float x0, float y0, float x1, float y1, uint32_t color) {
+    entry->vertices.push_back({ImVec2(x0, y0), white_uv, color});
+    entry->vertices.push_back({ImVec2(x1, y0), white_uv, color});
+    entry->vertices.push_back({ImVec2(x1, y1), white_uv, color});
+    entry->vertices.push_back({ImVec2(x0, y1), white_uv, color});
+  };
+
+  for (int j = 0; j < 256; j++) {
+    // pixel count << 2 + color index(on 2 bits)
+    uint32_t cols[3] = {(h.counts[0][j] << 2), (h.counts[1][j] << 2) + 1,
+                        (h.counts[2][j] << 2) + 2};
+    if (cols[0] > cols[1])
+      ImSwap(cols[0], cols[1]);
+    if (cols[1] > cols[2])
+      ImSwap(cols[1], cols[2]);
+    if (cols[0] > cols[1])
+      ImSwap(cols[0], cols[1]);
+
+    float current_height   = size.y;
+    uint32_t current_color = 0xFFFFFFFF;
+    const float left       = bar_width * float(j);
+    const float right      = left + bar_width;
+    for (int i = 0; i < 3; i++) {
+      const float height   = size.y - (cols[i] >> 2) * h_factor;
+      const uint32_t color = current_color;
+      current_color -= 0xFF << ((cols[i] & 3) * 8);
+      if (height >= current_height) {
+        continue;
+      }
+      quad(left, height, right, current_height, color);
+      current_height = height;
+    }
+  }
+}
+
+void ImageHistogramCache::Draw(uint64_t texture_id, uint64_t version,
+                               int width, int height,
+                               const unsigned char* bits, ImVec2 size) {
+  Entry* entry = Acquire(texture_id, version, width, height, bits);
+
+  ImGui::InvisibleButton("histogram", size);
+  ImDrawList* draw_list = ImGui::GetWindowDrawList();
+  const ImVec2 rmin     = ImGui::GetItemRectMin();
+  const ImVec2 rmax     = ImGui::GetItemRectMax();
+  const ImVec2 white_uv = draw_list->_Data->TexUvWhitePixel;
+
+  for (int i = 0; i <= 10; i++) {
+    float ax = rmin.x + (size.x / 10.f) * float(i);
+    float ay = rmin.y + (size.y / 10.f) * float(i);
+    draw_list->AddLine(ImVec2(rmin.x, ay), ImVec2(rmax.x, ay), kGridColor);
+    draw_list->AddLine(ImVec2(ax, rmin.y), ImVec2(ax, rmax.y), kGridColor);
+  }
+
+  // The white texel moves when the font atlas is rebuilt.
+  if (!entry->mesh_valid || entry->mesh_size.x != size.x ||
+      entry->mesh_size.y != size.y ||
+      (!entry->vertices.empty() &&
+       (entry->vertices[0].uv.x != white_uv.x ||
+        entry->vertices[0].uv.y != white_uv.y))) {
+    BuildMesh(entry, size, white_uv);
+  }
+
+  const int vtx_count = int(entry->vertices.size());
+  if (vtx_count == 0) {
+    return;
+  }
+  const int quad_count = vtx_count / 4;
+  draw_list->PrimReserve(quad_count * 6, vtx_count);
+  ImDrawVert* vtx = draw_list->_VtxWritePtr;
+  ImDrawIdx* idx  = draw_list->_IdxWritePtr;
+  ImDrawIdx base  = ImDrawIdx(draw_list->_VtxCurrentIdx);
+  for (const ImDrawVert& v : entry->vertices) {
+    *vtx++ = {ImVec2(v.pos.x + rmin.x, v.pos.y + rmin.y), v.uv, v.col};
+  }
+  for (int q = 0; q < quad_count; q++, base += 4) {
+    idx[0] = base;
+    idx[1] = ImDrawIdx(base + 1);
+    idx[2] = ImDrawIdx(base + 2);
+    idx[3] = base;
+    idx[4] = ImDrawIdx(base + 2);
+    idx[5] = ImDrawIdx(base + 3);
+    idx += 6;
+  }
+  draw_list->_VtxWritePtr = vtx;
+  draw_list->_IdxWritePtr = idx;
+  draw_list->_VtxCurrentIdx += unsigned(vtx_count);
+}
+
+void ImageHistogramCache::Invalidate(uint64_t texture_id) {
+  for (size_t i = 0; i < entries_.size(); i++) {
+    if (entries_[i].texture_id == texture_id) {
+      entries_[i] = std::move(entries_.back());
+      entries_.pop_back();
+      return;
+    }
+  }
+}
+
+void ImageHistogramCache::Clear() {
+  entries_.clear();
+}
+
+STRATE_END_NAMESPACE
+STRATE_END_NAMESPACE
+STRATE_INNER_END_NAMESPACE
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <imgui.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "stratengine/macro.h"
+
+STRATE_INNER_NAMESPACE(editor)
+STRATE_MAKE_NAMESPACE(ui)
+STRATE_MAKE_NAMESPACE(ext)
+
+// Per-channel RGBA byte counts of one image.
+struct ImageHistogram {
+  uint32_t counts[4][256];
+  uint32_t max_rgb;  // largest R/G/B bucket, used to scale the bars
+};
+
+// Counts every RGBA8 texel of |bits| (width * height * 4 bytes). Large images
+// are split into row bands counted on worker threads into partial tables
+// and merged; small ones are counted on the calling thread.
+void ComputeImageHistogram(const unsigned char* bits, int width, int height,
+                           ImageHistogram* out);
+
+// Histograms and their bar geometry cached per texture. Counting runs only
+// when a texture's version changes and the vertex list is rebuilt only when
+// the histogram or the widget size changes; a frame just copies the cached
+// vertices into the draw list.
+class ImageHistogramCache {
+public:
+  explicit ImageHistogramCache(uint32_t max_entries = 16);
+  ~ImageHistogramCache();
+
+  ImageHistogramCache(const ImageHistogramCache&)            = delete;
+  ImageHistogramCache& operator=(const ImageHistogramCache&) = delete;
+
+  // Histogram of |texture_id| at |version|; recounted when the cached
+  // version differs. Evicts the least recently used entry when full.
+  const ImageHistogram& Get(uint64_t texture_id, uint64_t version, int width,
+                            int height, const unsigned char* bits);
+
+  // Draws the cached histogram as an ImGui item of |size|.
+  void Draw(uint64_t texture_id, uint64_t version, int width, int height,
+            const unsigned char* bits, ImVec2 size = ImVec2(512, 256));
+
+  // Forgets |texture_id|, e.g. when the texture is destroyed.
+  void Invalidate(uint64_t texture_id);
+  void Clear();
+
+  uint64_t recount_count() const {
+    return recounts_;
+  }
+
+private:
+  struct Entry {
+    uint64_t texture_id;
+    uint64_t version;
+    uint64_t last_used;
+    ImageHistogram histogram;
+    // Bar quads relative to the item origin, valid for |mesh_size|.
+    std::vector<ImDrawVert> vertices;
+    ImVec2 mesh_size;
+    bool mesh_valid;
+  };
+
+  Entry* Acquire(uint64_t texture_id, uint64_t version, int width, int height,
+                 const unsigned char* bits);
+  static void BuildMesh(Entry* entry, ImVec2 size, ImVec2 white_uv);
+
+  std::vector<Entry> entries_;
+  uint32_t max_entries_;
+  uint64_t tick_;
+  uint64_t recounts_;
+};
+
+STRATE_END_NAMESPACE
+STRATE_END_NAMESPACE
+STRATE_INNER_END_NAMESPACE
@@ -41,83 +41,26 @@ if (io.KeyShift && io.MouseDown[0] && mouseUVCoord.x >= 0.f && mouseUVCoord.y >=
         int width = pickerImage.mWidth;
         int height = pickerImage.mHeight;
 
-        imageInspect(width, height, pickerImage.GetBits(), mouseUVCoord,
-displayedTextureSize);
+        // histogramCache outlives the frame; bump pickerImage.version
+        // whenever its pixels change.
+        inspect(&histogramCache, pickerImage.id, pickerImage.version, width,
+height, pickerImage.GetBits(), mouseUVCoord, displayedTextureSize);
 }
 */
 #pragma once
 
+#include "stratengine/editor/ui/ext/image_histogram.h"
 #include "stratengine/macro.h"
 
 STRATE_INNER_NAMESPACE(editor)
 STRATE_MAKE_NAMESPACE(ui)
 STRATE_MAKE_NAMESPACE(ext)
 namespace ImageInspect {
-inline void histogram(const int width, const int height,
+// Counts are cached per texture version; see ImageHistogramCache.
+inline void histogram(ImageHistogramCache* cache, uint64_t textureId,
+                      uint64_t version, const int width, const int height,
                       const unsigned char* const bits) {
-  unsigned int count[4][256] = {0};
-
-  const unsigned char* ptrCols = bits;
-
-  ImGui::InvisibleButton("histogram", ImVec2(512, 256));
-  for (int l = 0; l < height * width; l++) {
-    count[0][*ptrCols++]++;
-    count[1][*ptrCols++]++;
-    count[2][*ptrCols++]++;
-    count[3][*ptrCols++]++;
-  }
-
-  unsigned int maxv = count[0][0];
-  unsigned int* pCount = &count[0][0];
-  for (int i = 0; i < 3 * 256; i++, pCount++) {
-    maxv = (maxv > *pCount) ? maxv : *pCount;
-  }
-
-  ImDrawList* drawList = ImGui::GetWindowDrawList();
-  const ImVec2 rmin = ImGui::GetItemRectMin();
-  const ImVec2 rmax = ImGui::GetItemRectMax();
-  const ImVec2 size = ImGui::GetItemRectSize();
-  const float hFactor = size.y / float(maxv);
-
-  for (int i = 0; i <= 10; i++) {
-    float ax = rmin.x + (size.x / 10.f) * float(i);
-    float ay = rmin.y + (size.y / 10.f) * float(i);
-    drawList->AddLine(ImVec2(rmin.x, ay), ImVec2(rmax.x, ay), 0x80808080);
-    drawList->AddLine(ImVec2(ax, rmin.y), ImVec2(ax, rmax.y), 0x80808080);
-  }
-
-  const float barWidth = (size.x / 256.f);
-  for (int j = 0; j < 256; j++) {
-    // pixel count << 2 + color index(on 2 bits)
-    uint32_t cols[3] = {(count[0][j] << 2), (count[1][j] << 2) + 1,
-                        (count[2][j] << 2) + 2};
-    if (cols[0] > cols[1])
-      ImSwap(cols[0], cols[1]);
-    if (cols[1] > cols[2])
-      ImSwap(cols[1], cols[2]);
-    if (cols[0] > cols[1])
-      ImSwap(cols[0], cols[1]);
-    float heights[3];
-    uint32_t colors[3];
-    uint32_t currentColor = 0xFFFFFFFF;
-    for (int i = 0; i < 3; i++) {
-      heights[i] = rmax.y - (cols[i] >> 2) * hFactor;
-      colors[i] = currentColor;
-      currentColor -= 0xFF << ((cols[i] & 3) * 8);
-    }
-
-    float currentHeight = rmax.y;
-    const float left = rmin.x + barWidth * float(j);
-    const float right = left + barWidth;
-    for (int i = 0; i < 3; i++) {
-      if (heights[i] >= currentHeight) {
-        continue;
-      }
-      drawList->AddRectFilled(ImVec2(left, currentHeight),
-                              ImVec2(right, heights[i]), colors[i]);
-      currentHeight = heights[i];
-    }
-  }
+  cache->Draw(textureId, version, width, height, bits, ImVec2(512, 256));
 }
 inline void drawNormal(ImDrawList* draw_list, const ImRect& rc, float x,
                        float y) {
@@ -130,7 +73,8 @@ inline void drawNormal(ImDrawList* draw_list, const ImRect& rc, float x,
                      0xFF0000FF, 2.f);
 }
 
-inline void inspect(const int width, const int height,
+inline void inspect(ImageHistogramCache* cache, uint64_t textureId,
+                    uint64_t version, const int width, const int height,
                     const unsigned char* const bits, ImVec2 mouseUVCoord,
                     ImVec2 displayedTextureSize) {
   ImGui::BeginTooltip();
@@ -210,7 +154,7 @@ inline void inspect(const int width, const int height,
   ImGui::Text("Size %d, %d", int(displayedTextureSize.x),
               int(displayedTextureSize.y));
   ImGui::EndGroup();
-  histogram(width, height, bits);
+  histogram(cache, textureId, version, width, height, bits);
   ImGui::EndTooltip();
 }
 }  // namespace ImageInspect
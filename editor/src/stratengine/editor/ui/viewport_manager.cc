@@ -0,0 +1,222 @@
+#include "stratengine/editor/ui/viewport_manager.h"
+
+#include <algorithm>
+#include <cmath>
+
+STRATE_INNER_NAMESPACE(editor)
+STRATE_MAKE_NAMESPACE(ui)
+
+namespace {
+
+constexpr float kMinRenderScale = 0.25f;
+constexpr float kMaxRenderScale = 2.0f;
+
+uint32_t ScaledExtent(uint32_t extent, float scale) {
+  const float scaled = std::floor(float(extent) * scale + 0.5f);
+  return scaled < 1.0f ? 1u : uint32_t(scaled);
+}
+
+}  // namespace
+
+ViewportManager::ViewportManager()
+    : focused_(kInvalidViewport), live_count_(0) {}
+
+ViewportManager::~ViewportManager() {}
+
+ViewportId ViewportManager::Create(const ViewportDesc& desc) {
+  ViewportId id;
+  if (!free_ids_.empty()) {
+    id = free_ids_.back();
+    free_ids_.pop_back();
+    viewports_[id] = Viewport();
+  } else {
+    id = ViewportId(viewports_.size());
+    viewports_.emplace_back();
+  }
+
+  Viewport& v     = viewports_[id];
+  v.id_           = id;
+  v.name_         = desc.name;
+  v.alive_        = true;
+  v.continuous_   = desc.continuous;
+  v.width_        = std::max<uint32_t>(desc.width, 1);
+  v.height_       = std::max<uint32_t>(desc.height, 1);
+  v.render_scale_ = std::clamp(desc.render_scale, kMinRenderScale,
+                               kMaxRenderScale);
+  v.focused_hz_   = desc.focused_hz;
+  v.unfocused_hz_ = desc.unfocused_hz;
+  // Pacer timestamps are never consumed; it only carries the target period.
+  v.pacer_.SetMode(navary::core::time::FramePacer::PacerMode::kVsyncExternal);
+  SetState(&v, ViewportState::kVisible);
+  UpdateProjection(&v);
+  live_count_++;
+  return id;
+}
+
+void ViewportManager::Destroy(ViewportId id) {
+  Viewport* v = Find(id);
+  if (v == nullptr) {
+    return;
+  }
+  if (focused_ == id) {
+    focused_ = kInvalidViewport;
+  }
+  v->alive_ = false;
+  v->name_.clear();
+  free_ids_.push_back(id);
+  live_count_--;
+}
+
+Viewport* ViewportManager::Find(ViewportId id) {
+  if (id >= viewports_.size() || !viewports_[id].alive_) {
+    return nullptr;
+  }
+  return &viewports_[id];
+}
+
+const Viewport* ViewportManager::Get(ViewportId id) const {
+  if (id >= viewports_.size() || !viewports_[id].alive_) {
+    return nullptr;
+  }
+  return &viewports_[id];
+}
+
+void ViewportManager::UpdateProjection(Viewport* v) {
+  v->render_width_  = ScaledExtent(v->width_, v->render_scale_);
+  v->render_height_ = ScaledExtent(v->height_, v->render_scale_);
+
+  const ViewportCamera& cam = v->camera_;
+  const float aspect        = float(v->width_) / float(v->height_);
+  v->projection_            = navary::math::Mat4::PerspectiveRH(
+      cam.fovy, aspect, cam.z_near, cam.z_far);
+  v->frustum_ = navary::math::Frustum::FromViewProj(v->projection_, cam.view);
+  v->input_version_++;
+}
+
+void ViewportManager::SetState(Viewport* v, ViewportState state) {
+  v->state_ = state;
+  v->pacer_.SetTargetHz(state == ViewportState::kFocused ? v->focused_hz_
+                                                         : v->unfocused_hz_);
+}
+
+void ViewportManager::SetCamera(ViewportId id, const ViewportCamera& camera) {
+  Viewport* v = Find(id);
+  if (v == nullptr) {
+    return;
+  }
+  v->camera_ = camera;
+  UpdateProjection(v);
+}
+
+void ViewportManager::Resize(ViewportId id, uint32_t width, uint32_t height) {
+  Viewport* v = Find(id);
+  if (v == nullptr || width == 0 || height == 0 ||
+      (v->width_ == width && v->height_ == height)) {
+    return;
+  }
+  v->width_  = width;
+  v->height_ = height;
+  UpdateProjection(v);
+}
+
+void ViewportManager::SetRenderScale(ViewportId id, float scale) {
+  Viewport* v = Find(id);
+  if (v == nullptr) {
+    return;
+  }
+  scale = std::clamp(scale, kMinRenderScale, kMaxRenderScale);
+  if (scale == v->render_scale_) {
+    return;
+  }
+  v->render_scale_ = scale;
+  UpdateProjection(v);
+}
+
+void ViewportManager::MarkDirty(ViewportId id) {
+  Viewport* v = Find(id);
+  if (v != nullptr) {
+    v->input_version_++;
+  }
+}
+
+void ViewportManager::SetFocus(ViewportId id) {
+  if (id == focused_) {
+    return;
+  }
+  if (Viewport* old = Find(focused_)) {
+    SetState(old, ViewportState::kVisible);
+  }
+  focused_    = kInvalidViewport;
+  Viewport* v = Find(id);
+  if (v != nullptr) {
+    SetState(v, ViewportState::kFocused);
+    focused_ = id;
+  }
+}
+
+void ViewportManager::SetVisible(ViewportId id, bool visible) {
+  Viewport* v = Find(id);
+  if (v == nullptr) {
+    return;
+  }
+  if (!visible) {
+    if (focused_ == id) {
+      focused_ = kInvalidViewport;
+    }
+    SetState(v, ViewportState::kHidden);
+  } else if (v->state_ == ViewportState::kHidden) {
+    SetState(v, ViewportState::kVisible);
+  }
+}
+
+bool ViewportManager::IsDue(const Viewport& v, uint64_t scene_version,
+                            uint64_t now_ns) const {
+  if (!v.alive_ || v.state_ == ViewportState::kHidden) {
+    return false;
+  }
+  if (!v.rendered_once_) {
+    return true;
+  }
+  const bool changed = v.continuous_ || v.input_version_ != v.rendered_input_ ||
+                       scene_version != v.rendered_scene_;
+  if (!changed) {
+    return false;
+  }
+  const uint64_t period = v.pacer_.target_period_ns();
+  return period == 0 || now_ns - v.last_render_ns_ >= period;
+}
+
+uint32_t ViewportManager::CollectDue(uint64_t scene_version, uint64_t now_ns,
+                                     ViewportId* out_ids,
+                                     uint32_t max_out) const {
+  uint32_t count = 0;
+  if (focused_ != kInvalidViewport && count < max_out &&
+      IsDue(viewports_[focused_], scene_version, now_ns)) {
+    out_ids[count++] = focused_;
+  }
+  for (const Viewport& v : viewports_) {
+    if (count >= max_out) {
+      break;
+    }
+    if (v.id_ != focused_ && IsDue(v, scene_version, now_ns)) {
+      out_ids[count++] = v.id_;
+    }
+  }
+  return count;
+}
+
+void ViewportManager::MarkRendered(ViewportId id, uint64_t scene_version,
+                                   uint64_t now_ns) {
+  Viewport* v = Find(id);
+  if (v == nullptr) {
+    return;
+  }
+  v->rendered_input_ = v->input_version_;
+  v->rendered_scene_ = scene_version;
+  v->last_render_ns_ = now_ns;
+  v->rendered_once_  = true;
+  v->render_count_++;
+}
+
+STRATE_END_NAMESPACE
+STRATE_INNER_END_NAMESPACE
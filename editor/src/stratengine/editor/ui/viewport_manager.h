@@ -1,18 +1,174 @@
 #pragma once
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "navary/core/time/frame_pacer.h"
+#include "navary/math/frustum.h"
+#include "navary/math/mat4.h"
 #include "stratengine/macro.h"
 
 STRATE_INNER_NAMESPACE(editor)
 STRATE_MAKE_NAMESPACE(ui)
 
-class ViewportManager
-{
+using ViewportId = uint32_t;
+inline constexpr ViewportId kInvalidViewport = 0xFFFFFFFFu;
+
+enum class ViewportState : uint8_t {
+  kFocused = 0,  // has input focus: paced at focused_hz
+  kVisible,      // on screen, not focused: paced at unfocused_hz
+  kHidden        // collapsed / docked away: never rendered
+};
+
+struct ViewportCamera {
+  navary::math::Mat4 view = navary::math::Mat4::Identity();
+  float fovy              = 1.0471976f;  // 60 degrees
+  float z_near            = 0.1f;
+  float z_far             = 1000.0f;
+};
+
+struct ViewportDesc {
+  std::string name;
+  uint32_t width      = 1280;
+  uint32_t height     = 720;
+  float render_scale  = 1.0f;   // render target size = window size * scale
+  double focused_hz   = 0.0;    // <= 0: as fast as the editor loop runs
+  double unfocused_hz = 10.0;   // <= 0: unfocused views are not paced
+  bool continuous     = false;  // re-render even when nothing changed
+};
+
+// One scene view. Rendering is driven by ViewportManager; the fields here
+// are read by the renderer for the views returned by CollectDue().
+class Viewport {
+public:
+  ViewportId id() const {
+    return id_;
+  }
+  const std::string& name() const {
+    return name_;
+  }
+  ViewportState state() const {
+    return state_;
+  }
+  const ViewportCamera& camera() const {
+    return camera_;
+  }
+  const navary::math::Mat4& projection() const {
+    return projection_;
+  }
+  const navary::math::Frustum& frustum() const {
+    return frustum_;
+  }
+  uint32_t width() const {
+    return width_;
+  }
+  uint32_t height() const {
+    return height_;
+  }
+  float render_scale() const {
+    return render_scale_;
+  }
+  // Render target extent after render_scale, at least 1x1.
+  uint32_t render_width() const {
+    return render_width_;
+  }
+  uint32_t render_height() const {
+    return render_height_;
+  }
+  uint64_t render_count() const {
+    return render_count_;
+  }
+
 private:
-    
+  friend class ViewportManager;
+
+  ViewportId id_ = kInvalidViewport;
+  std::string name_;
+  ViewportState state_ = ViewportState::kVisible;
+  bool continuous_     = false;
+  bool alive_          = false;
+
+  ViewportCamera camera_;
+  navary::math::Mat4 projection_ = navary::math::Mat4::Identity();
+  navary::math::Frustum frustum_;
+
+  uint32_t width_         = 0;
+  uint32_t height_        = 0;
+  float render_scale_     = 1.0f;
+  uint32_t render_width_  = 0;
+  uint32_t render_height_ = 0;
+
+  // Target rate follows the state. Only the pacer's period gates
+  // rendering: the editor loop is never slept on behalf of one view.
+  navary::core::time::FramePacer pacer_;
+  double focused_hz_   = 0.0;
+  double unfocused_hz_ = 0.0;
+
+  uint64_t input_version_  = 1;
+  uint64_t rendered_input_ = 0;
+  uint64_t rendered_scene_ = 0;
+  uint64_t last_render_ns_ = 0;
+  bool rendered_once_      = false;
+  uint64_t render_count_   = 0;
+};
+
+// Owns the editor's scene views and decides, each editor frame, which of
+// them need to re-render: a view is due when its camera, size or scale
+// changed (or it is continuous) or the scene version moved, and its
+// state's pacer period has elapsed since its last render.
+class ViewportManager {
 public:
-    ViewportManager(){};
-    ~ViewportManager(){};
+  ViewportManager();
+  ~ViewportManager();
+
+  ViewportManager(const ViewportManager&)            = delete;
+  ViewportManager& operator=(const ViewportManager&) = delete;
+
+  ViewportId Create(const ViewportDesc& desc);
+  void Destroy(ViewportId id);
+
+  // nullptr for unknown or destroyed ids.
+  const Viewport* Get(ViewportId id) const;
+
+  // Input changes; each marks the view dirty.
+  void SetCamera(ViewportId id, const ViewportCamera& camera);
+  void Resize(ViewportId id, uint32_t width, uint32_t height);
+  void SetRenderScale(ViewportId id, float scale);
+  void MarkDirty(ViewportId id);
+
+  // Gives |id| focus; the previously focused view drops to kVisible.
+  // kInvalidViewport clears focus.
+  void SetFocus(ViewportId id);
+  void SetVisible(ViewportId id, bool visible);
+
+  // Writes up to |max_out| views due for rendering at |now_ns| given the
+  // current |scene_version|, focused view first. Returns the count.
+  uint32_t CollectDue(uint64_t scene_version, uint64_t now_ns,
+                      ViewportId* out_ids, uint32_t max_out) const;
+
+  // Records that |id| was rendered at |now_ns| with |scene_version|.
+  void MarkRendered(ViewportId id, uint64_t scene_version, uint64_t now_ns);
+
+  ViewportId focused() const {
+    return focused_;
+  }
+  uint32_t size() const {
+    return live_count_;
+  }
+
+private:
+  Viewport* Find(ViewportId id);
+  void UpdateProjection(Viewport* viewport);
+  void SetState(Viewport* viewport, ViewportState state);
+  bool IsDue(const Viewport& viewport, uint64_t scene_version,
+             uint64_t now_ns) const;
+
+  std::vector<Viewport> viewports_;
+  std::vector<ViewportId> free_ids_;
+  ViewportId focused_;
+  uint32_t live_count_;
 };
 
 STRATE_END_NAMESPACE
-STRATE_INNER_END_NAMESPACE
\ No newline at end of file
+STRATE_INNER_END_NAMESPACE
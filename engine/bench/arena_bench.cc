@@ -0,0 +1,110 @@
+// Navary Engine - Benchmark Suite
+// File: bench/arena_bench.cc
+// Purpose: memory::Arena allocation cost, uncontended and with several
+//          threads allocating from one arena at once; StateSnapshotRing
+//          save (copy + hash) and restore of a 4 MB rollback state.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "bench.h"
+#include "navary/memory/arena.h"
+#include "navary/memory/state_arena.h"
+
+namespace {
+
+using navary::bench::DoNotOptimize;
+using navary::bench::State;
+using navary::memory::Arena;
+using navary::memory::ArenaOptions;
+using navary::memory::StateArena;
+using navary::memory::StateSnapshotRing;
+
+constexpr std::size_t kStateBytes = 4 << 20;
+
+ArenaOptions BenchArenaOptions() {
+  ArenaOptions opts;
+  opts.initial_block_bytes = 256 * 1024;
+  opts.max_block_bytes     = 1024 * 1024;
+  return opts;
+}
+
+// One arena per benchmark, shared by all its threads. Thread 0 resets it
+// before the start gate; the other threads cannot allocate until thread 0
+// arrives there, and the previous sample's threads have all joined.
+void AllocateLoop(State& state, Arena* arena, std::size_t size) {
+  if (state.thread_index() == 0) {
+    arena->Reset();
+  }
+  state.SetItemsPerIteration(1);
+  while (state.KeepRunning()) {
+    DoNotOptimize(arena->Allocate(size, 16));
+  }
+}
+
+void BM_ArenaAllocate64(State& state) {
+  static Arena arena(BenchArenaOptions());
+  AllocateLoop(state, &arena, 64);
+}
+
+void BM_ArenaAllocate64Contended(State& state) {
+  static Arena arena(BenchArenaOptions());
+  AllocateLoop(state, &arena, 64);
+}
+
+void BM_ArenaAllocate4K(State& state) {
+  static Arena arena(BenchArenaOptions());
+  AllocateLoop(state, &arena, 4096);
+}
+
+// A full 4 MB state with non-zero contents, so the hash and copies touch
+// every byte.
+StateArena* FullState() {
+  static StateArena* state = [] {
+    auto* s   = new StateArena(kStateBytes);
+    auto* mem = static_cast<std::uint8_t*>(s->Allocate(kStateBytes, 16));
+    if (mem == nullptr) {
+      std::fprintf(stderr, "navary-bench: StateArena::Allocate failed\n");
+      std::abort();
+    }
+    for (std::size_t i = 0; i < kStateBytes; ++i) {
+      mem[i] = static_cast<std::uint8_t>(i * 131u);
+    }
+    return s;
+  }();
+  return state;
+}
+
+void BM_StateRingSave(State& state) {
+  StateArena* arena = FullState();
+  StateSnapshotRing ring(8, arena->capacity());
+  std::uint32_t tick = 0;
+  state.SetItemsPerIteration(arena->used());
+  while (state.KeepRunning()) {
+    DoNotOptimize(ring.Save(tick++, *arena));
+  }
+}
+
+void BM_StateRingRestore(State& state) {
+  StateArena* arena = FullState();
+  StateSnapshotRing ring(8, arena->capacity());
+  ring.Save(0, *arena);
+  state.SetItemsPerIteration(arena->used());
+  while (state.KeepRunning()) {
+    DoNotOptimize(ring.Restore(0, arena));
+  }
+}
+
+}  // namespace
+
+NAVARY_BENCH("memory/Arena::Allocate/64B", BM_ArenaAllocate64);
+NAVARY_BENCH("memory/Arena::Allocate/4KB", BM_ArenaAllocate4K);
+NAVARY_BENCH_THREADS("memory/Arena::Allocate/64B/threads:4",
+                     BM_ArenaAllocate64Contended, 4);
+NAVARY_BENCH("memory/StateSnapshotRing::Save/4MB", BM_StateRingSave);
+NAVARY_BENCH("memory/StateSnapshotRing::Restore/4MB", BM_StateRingRestore);
@@ -0,0 +1,594 @@
+// Navary Engine - Benchmark Suite
+// File: bench/bench.cc
+// Purpose: Runner, statistics, CPU pinning / info and JSON output for the
+//          navary-bench framework.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include "navary/core/scheduler/job_system.h"
+#include "navary/core/time/monotonic_clock.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+namespace navary::bench {
+
+namespace {
+
+using core::time::MonotonicNowNs;
+
+// CPU PinThreadToCpu() last pinned this thread to; -1 when unpinned.
+thread_local int tls_pinned_cpu = -1;
+
+#if defined(__linux__)
+// Affinity of the main thread before any pinning, captured during static
+// initialization; UnpinnedScope restores it.
+cpu_set_t StartupMask() {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+    for (unsigned c = 0; c < std::thread::hardware_concurrency(); ++c) {
+      CPU_SET(c, &set);
+    }
+  }
+  return set;
+}
+const cpu_set_t g_startup_mask = StartupMask();
+#endif
+
+// Applies the startup mask to the calling thread.
+void WidenAffinity() {
+#if defined(__linux__)
+  pthread_setaffinity_np(pthread_self(), sizeof(g_startup_mask),
+                         &g_startup_mask);
+#elif defined(_WIN32)
+  DWORD_PTR process = 0;
+  DWORD_PTR system  = 0;
+  if (GetProcessAffinityMask(GetCurrentProcess(), &process, &system)) {
+    SetThreadAffinityMask(GetCurrentThread(), process);
+  }
+#endif
+}
+
+std::vector<Benchmark>& Registry() {
+  static std::vector<Benchmark> registry;
+  return registry;
+}
+
+// Reads the first line of a small text file; empty on failure.
+std::string ReadLine(const char* path) {
+  std::string line;
+  std::FILE* f = std::fopen(path, "r");
+  if (f == nullptr) {
+    return line;
+  }
+  char buf[256];
+  if (std::fgets(buf, sizeof(buf), f) != nullptr) {
+    line = buf;
+    while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) {
+      line.pop_back();
+    }
+  }
+  std::fclose(f);
+  return line;
+}
+
+double ReadCpuMhz(int cpu) {
+  char path[128];
+  std::snprintf(path, sizeof(path),
+                "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_cur_freq", cpu);
+  const std::string khz = ReadLine(path);
+  return khz.empty() ? 0.0 : std::atof(khz.c_str()) / 1000.0;
+}
+
+std::string CpuModel() {
+  std::string model;
+  std::FILE* f = std::fopen("/proc/cpuinfo", "r");
+  if (f == nullptr) {
+    return model;
+  }
+  char buf[512];
+  while (std::fgets(buf, sizeof(buf), f) != nullptr) {
+    if (std::strncmp(buf, "model name", 10) == 0) {
+      const char* colon = std::strchr(buf, ':');
+      if (colon != nullptr) {
+        model = colon + 1;
+        while (!model.empty() && model.front() == ' ') {
+          model.erase(model.begin());
+        }
+        while (!model.empty() && model.back() == '\n') {
+          model.pop_back();
+        }
+      }
+      break;
+    }
+  }
+  std::fclose(f);
+  return model;
+}
+
+struct SampleResult {
+  std::uint64_t slowest_ns;
+  std::uint64_t items_per_iteration;
+  const char* skip_reason;      // first thread that skipped, or nullptr
+  std::vector<Metric> metrics;  // thread 0's
+};
+
+// Runs |bench| once with |iterations| per thread and reports the slowest
+// thread's timed nanoseconds. |counters| (opened on this thread) measures
+// thread 0 and is added to |counter_sum|; both may be null.
+SampleResult RunSample(const Benchmark& bench, std::uint64_t iterations,
+                       int first_cpu,
+                       const instrument::PerfCounterGroup* counters = nullptr,
+                       instrument::PerfCounterSample* counter_sum = nullptr) {
+  std::atomic<std::uint32_t> gate{0};
+  std::vector<State> states;
+  states.reserve(bench.threads);
+  for (std::uint32_t t = 0; t < bench.threads; ++t) {
+    states.emplace_back(iterations, t, bench.threads, &gate,
+                        t == 0 ? counters : nullptr);
+  }
+
+  std::vector<std::thread> workers;
+  workers.reserve(bench.threads - 1);
+  for (std::uint32_t t = 1; t < bench.threads; ++t) {
+    workers.emplace_back([&bench, &states, t, first_cpu] {
+      if (first_cpu >= 0) {
+        PinThreadToCpu(first_cpu + static_cast<int>(t));
+      }
+      bench.fn(states[t]);
+    });
+  }
+  bench.fn(states[0]);
+  for (std::thread& w : workers) {
+    w.join();
+  }
+
+  SampleResult out{};
+  for (const State& s : states) {
+    out.slowest_ns = std::max(out.slowest_ns, s.elapsed_ns());
+    if (out.skip_reason == nullptr) {
+      out.skip_reason = s.skip_reason();
+    }
+  }
+  out.items_per_iteration = states[0].items_per_iteration();
+  out.metrics             = states[0].metrics();
+  if (counter_sum != nullptr) {
+    counter_sum->Accumulate(states[0].counter_sample());
+  }
+  return out;
+}
+
+// Median of each metric over |samples|, in first-reported order.
+std::vector<Metric> MedianMetrics(
+    const std::vector<std::vector<Metric>>& samples) {
+  std::vector<Metric> out;
+  if (samples.empty()) {
+    return out;
+  }
+  for (const Metric& m : samples.front()) {
+    std::vector<double> values;
+    values.reserve(samples.size());
+    for (const std::vector<Metric>& sample : samples) {
+      for (const Metric& v : sample) {
+        if (v.name == m.name) {
+          values.push_back(v.value);
+          break;
+        }
+      }
+    }
+    out.push_back(Metric{m.name, ComputeStats(std::move(values)).median});
+  }
+  return out;
+}
+
+void AppendJsonString(std::string* out, const std::string& s) {
+  out->push_back('"');
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out->push_back('\\');
+      out->push_back(c);
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char esc[8];
+      std::snprintf(esc, sizeof(esc), "\\u%04x", c);
+      out->append(esc);
+    } else {
+      out->push_back(c);
+    }
+  }
+  out->push_back('"');
+}
+
+void AppendNumber(std::string* out, double v) {
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%.3f", v);
+  out->append(buf);
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// State
+// -----------------------------------------------------------------------------
+
+State::State(std::uint64_t iterations, std::uint32_t thread_index,
+             std::uint32_t threads, std::atomic<std::uint32_t>* start_gate,
+             const instrument::PerfCounterGroup* counters)
+    : iterations_(iterations),
+      done_(0),
+      thread_index_(thread_index),
+      threads_(threads),
+      start_gate_(start_gate),
+      start_ns_(0),
+      elapsed_ns_(0),
+      items_per_iteration_(0),
+      counters_(counters),
+      counter_begin_{},
+      counter_sample_{},
+      skip_reason_(nullptr),
+      running_(false) {}
+
+void State::Skip(const char* reason) {
+  skip_reason_ = reason;
+  iterations_  = 0;  // KeepRunning() returns false from the first call
+  // Counts as arrived, so threads that do run are not held at the gate.
+  if (threads_ > 1) {
+    start_gate_->fetch_add(1, std::memory_order_acq_rel);
+  }
+}
+
+void State::SetMetric(const char* name, double value) {
+  for (Metric& m : metrics_) {
+    if (m.name == name) {
+      m.value = value;
+      return;
+    }
+  }
+  metrics_.push_back(Metric{name, value});
+}
+
+void State::Start() {
+  if (threads_ > 1) {
+    start_gate_->fetch_add(1, std::memory_order_acq_rel);
+    while (start_gate_->load(std::memory_order_acquire) < threads_) {
+      std::this_thread::yield();
+    }
+  }
+  ResumeTiming();
+}
+
+void State::Stop() {
+  PauseTiming();
+}
+
+void State::PauseTiming() {
+  if (running_) {
+    elapsed_ns_ += MonotonicNowNs() - start_ns_;
+    running_ = false;
+    if (counters_ != nullptr) {
+      counter_sample_.Accumulate(
+          instrument::PerfCounterDelta(counter_begin_, counters_->Read()));
+    }
+  }
+}
+
+void State::ResumeTiming() {
+  if (!running_) {
+    if (counters_ != nullptr) {
+      counter_begin_ = counters_->Read();
+    }
+    start_ns_ = MonotonicNowNs();
+    running_  = true;
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Registry / statistics / platform
+// -----------------------------------------------------------------------------
+
+bool RegisterBenchmark(const char* name, BenchFn fn, std::uint32_t threads) {
+  Registry().push_back(Benchmark{name, fn, threads == 0 ? 1u : threads});
+  return true;
+}
+
+const std::vector<Benchmark>& RegisteredBenchmarks() {
+  return Registry();
+}
+
+Stats ComputeStats(std::vector<double> samples) {
+  Stats s{};
+  if (samples.empty()) {
+    return s;
+  }
+  std::sort(samples.begin(), samples.end());
+  const std::size_t n = samples.size();
+  double sum          = 0.0;
+  for (double v : samples) {
+    sum += v;
+  }
+  s.min    = samples.front();
+  s.max    = samples.back();
+  s.mean   = sum / static_cast<double>(n);
+  s.median = (n % 2 == 1) ? samples[n / 2]
+                          : 0.5 * (samples[n / 2 - 1] + samples[n / 2]);
+  // Nearest-rank percentile.
+  const std::size_t rank =
+      static_cast<std::size_t>(std::ceil(0.9 * static_cast<double>(n)));
+  s.p90 = samples[rank == 0 ? 0 : rank - 1];
+  if (n > 1) {
+    double var = 0.0;
+    for (double v : samples) {
+      var += (v - s.mean) * (v - s.mean);
+    }
+    s.stddev = std::sqrt(var / static_cast<double>(n - 1));
+  }
+  return s;
+}
+
+CpuInfo QueryCpuInfo(int cpu) {
+  if (cpu < 0) {
+    cpu = 0;
+  }
+  CpuInfo info{};
+  info.model        = CpuModel();
+  info.logical_cpus = std::thread::hardware_concurrency();
+  char path[128];
+  std::snprintf(path, sizeof(path),
+                "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_governor", cpu);
+  info.governor   = ReadLine(path);
+  info.mhz_before = ReadCpuMhz(cpu);
+  info.mhz_after  = info.mhz_before;
+  return info;
+}
+
+bool PinThreadToCpu(int cpu) {
+  if (cpu < 0) {
+    return false;
+  }
+  const unsigned count = std::max(1u, std::thread::hardware_concurrency());
+  cpu %= static_cast<int>(count);
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  const bool pinned =
+      pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#elif defined(_WIN32)
+  const bool pinned =
+      SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR{1} << cpu) != 0;
+#else
+  // macOS has no hard affinity; results are unpinned.
+  const bool pinned = false;
+#endif
+  if (pinned) {
+    tls_pinned_cpu = cpu;
+  }
+  return pinned;
+}
+
+UnpinnedScope::UnpinnedScope() : pinned_cpu_(tls_pinned_cpu) {
+  if (pinned_cpu_ >= 0) {
+    WidenAffinity();
+    tls_pinned_cpu = -1;
+  }
+}
+
+UnpinnedScope::~UnpinnedScope() {
+  if (pinned_cpu_ >= 0) {
+    PinThreadToCpu(pinned_cpu_);
+  }
+}
+
+core::scheduler::JobSystem& SharedJobSystem() {
+  static core::scheduler::JobSystem jobs;
+  static const bool ready = [] {
+    UnpinnedScope unpinned;
+    Check(jobs.Init(0), "JobSystem::Init");
+    return true;
+  }();
+  (void)ready;
+  return jobs;
+}
+
+// -----------------------------------------------------------------------------
+// Runner
+// -----------------------------------------------------------------------------
+
+std::vector<BenchResult> RunBenchmarks(const RunOptions& options) {
+  std::vector<const Benchmark*> selected;
+  for (const Benchmark& b : Registry()) {
+    if (options.filter.empty() ||
+        b.name.find(options.filter) != std::string::npos) {
+      selected.push_back(&b);
+    }
+  }
+  std::sort(selected.begin(), selected.end(),
+            [](const Benchmark* a, const Benchmark* b) {
+              return a->name < b->name;
+            });
+
+  const double min_ns      = options.min_sample_ms * 1e6;
+  const double warmup_ns   = options.warmup_ms * 1e6;
+  const std::uint32_t reps = std::max(1u, options.repetitions);
+
+  // Counters follow the opening thread, which runs thread 0 of every
+  // sample.
+  instrument::PerfCounterGroup counters;
+  if (options.counters && !counters.Open().ok()) {
+    std::fprintf(stderr,
+                 "navary-bench: hardware counters unavailable "
+                 "(no PMU access or kernel.perf_event_paranoid)\n");
+  }
+  const instrument::PerfCounterGroup* group =
+      counters.is_open() ? &counters : nullptr;
+
+  std::vector<BenchResult> results;
+  results.reserve(selected.size());
+  for (const Benchmark* bench : selected) {
+    SampleResult sample{};
+
+    // Calibrate: grow the iteration count until a sample is long enough
+    // for clock resolution and loop overhead to vanish.
+    std::uint64_t iterations = 1;
+    for (;;) {
+      sample = RunSample(*bench, iterations, options.cpu);
+      if (sample.skip_reason != nullptr) {
+        break;
+      }
+      const double ns = static_cast<double>(sample.slowest_ns);
+      if (ns >= min_ns || iterations >= (std::uint64_t{1} << 40)) {
+        break;
+      }
+      double scale = ns > 0.0 ? 1.4 * min_ns / ns : 10.0;
+      scale        = std::clamp(scale, 2.0, 10.0);
+      iterations   = static_cast<std::uint64_t>(
+          std::ceil(static_cast<double>(iterations) * scale));
+    }
+    if (sample.skip_reason != nullptr) {
+      std::fprintf(stderr, "navary-bench: skipped %s: %s\n",
+                   bench->name.c_str(), sample.skip_reason);
+      continue;
+    }
+
+    // Warm caches, branch predictors and the frequency governor.
+    const std::uint64_t warm_begin = MonotonicNowNs();
+    while (static_cast<double>(MonotonicNowNs() - warm_begin) < warmup_ns) {
+      RunSample(*bench, iterations, options.cpu);
+    }
+
+    BenchResult r{};
+    r.name       = bench->name;
+    r.threads    = bench->threads;
+    r.iterations = iterations;
+    r.samples_ns_per_op.reserve(reps);
+    std::vector<std::vector<Metric>> metrics;
+    metrics.reserve(reps);
+    for (std::uint32_t i = 0; i < reps; ++i) {
+      sample = RunSample(*bench, iterations, options.cpu, group, &r.counters);
+      r.samples_ns_per_op.push_back(static_cast<double>(sample.slowest_ns) /
+                                    static_cast<double>(iterations));
+      metrics.push_back(std::move(sample.metrics));
+    }
+    const std::uint64_t items = sample.items_per_iteration;
+    r.counter_iterations      = iterations * reps;
+    r.ns_per_op               = ComputeStats(r.samples_ns_per_op);
+    r.metrics                 = MedianMetrics(metrics);
+    if (items > 0 && r.ns_per_op.median > 0.0) {
+      r.items_per_second = 1e9 * static_cast<double>(items) *
+                           static_cast<double>(bench->threads) /
+                           r.ns_per_op.median;
+    }
+    results.push_back(std::move(r));
+  }
+  return results;
+}
+
+// -----------------------------------------------------------------------------
+// JSON
+// -----------------------------------------------------------------------------
+
+std::string ToJson(const std::vector<BenchResult>& results,
+                   const CpuInfo& cpu, const RunOptions& options,
+                   const std::string& label) {
+  std::string out;
+  out.reserve(256 + results.size() * 512);
+  out += "{\n  \"schema\": \"navary-bench/1\",\n  \"context\": {\n";
+  out += "    \"label\": ";
+  AppendJsonString(&out, label);
+  out += ",\n    \"cpu_model\": ";
+  AppendJsonString(&out, cpu.model);
+  out += ",\n    \"logical_cpus\": " + std::to_string(cpu.logical_cpus);
+  out += ",\n    \"pinned_cpu\": " + std::to_string(options.cpu);
+  out += ",\n    \"governor\": ";
+  AppendJsonString(&out, cpu.governor);
+  out += ",\n    \"mhz_before\": ";
+  AppendNumber(&out, cpu.mhz_before);
+  out += ",\n    \"mhz_after\": ";
+  AppendNumber(&out, cpu.mhz_after);
+  out += ",\n    \"repetitions\": " + std::to_string(options.repetitions);
+  out += ",\n    \"min_sample_ms\": ";
+  AppendNumber(&out, options.min_sample_ms);
+#if defined(NDEBUG)
+  out += ",\n    \"build\": \"release\"\n  },\n";
+#else
+  out += ",\n    \"build\": \"debug\"\n  },\n";
+#endif
+  out += "  \"benchmarks\": [";
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const BenchResult& r = results[i];
+    out += i == 0 ? "\n    {" : ",\n    {";
+    out += "\"name\": ";
+    AppendJsonString(&out, r.name);
+    out += ", \"threads\": " + std::to_string(r.threads);
+    out += ", \"iterations\": " + std::to_string(r.iterations);
+    out += ",\n     \"ns_per_op\": {\"min\": ";
+    AppendNumber(&out, r.ns_per_op.min);
+    out += ", \"median\": ";
+    AppendNumber(&out, r.ns_per_op.median);
+    out += ", \"mean\": ";
+    AppendNumber(&out, r.ns_per_op.mean);
+    out += ", \"stddev\": ";
+    AppendNumber(&out, r.ns_per_op.stddev);
+    out += ", \"p90\": ";
+    AppendNumber(&out, r.ns_per_op.p90);
+    out += ", \"max\": ";
+    AppendNumber(&out, r.ns_per_op.max);
+    out += "},\n     \"items_per_second\": ";
+    AppendNumber(&out, r.items_per_second);
+    if (!r.metrics.empty()) {
+      out += ",\n     \"metrics\": {";
+      for (std::size_t m = 0; m < r.metrics.size(); ++m) {
+        out += m == 0 ? "" : ", ";
+        AppendJsonString(&out, r.metrics[m].name);
+        out += ": ";
+        AppendNumber(&out, r.metrics[m].value);
+      }
+      out += "}";
+    }
+    if (r.counters.valid_mask != 0 && r.counter_iterations > 0) {
+      const double per_op = 1.0 / static_cast<double>(r.counter_iterations);
+      out += ",\n     \"counters_per_op\": {";
+      bool first = true;
+      for (std::uint32_t c = 0; c < instrument::kPerfCounterCount; ++c) {
+        const auto counter = static_cast<instrument::PerfCounter>(c);
+        if (!r.counters.Has(counter)) {
+          continue;
+        }
+        out += first ? "\"" : ", \"";
+        out += instrument::PerfCounterName(counter);
+        out += "\": ";
+        AppendNumber(&out, static_cast<double>(r.counters.Get(counter)) *
+                               per_op);
+        first = false;
+      }
+      out += "}";
+    }
+    out += ",\n     \"samples_ns_per_op\": [";
+    for (std::size_t s = 0; s < r.samples_ns_per_op.size(); ++s) {
+      if (s != 0) {
+        out += ", ";
+      }
+      AppendNumber(&out, r.samples_ns_per_op[s]);
+    }
+    out += "]}";
+  }
+  out += results.empty() ? "]\n}\n" : "\n  ]\n}\n";
+  return out;
+}
+
+}  // namespace navary::bench
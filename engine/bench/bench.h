@@ -0,0 +1,286 @@
+#pragma once
+// Navary Engine - Benchmark Suite
+// File: bench/bench.h
+// Purpose: Minimal microbenchmark framework behind the navary-bench target:
+//          registration, calibration, warmup, repetitions, statistics and
+//          JSON output that can be diffed across commits.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - A benchmark is a function taking State&. The timed region is the
+//     `while (state.KeepRunning())` loop; code before and after it is
+//     setup / teardown and is not measured.
+//   - Each benchmark is calibrated so one sample runs for at least
+//     min_sample_ms, warmed up for warmup_ms, then sampled `repetitions`
+//     times. Statistics are taken over per-sample ns/op.
+//   - Multi-threaded benchmarks (threads > 1) run the function on that many
+//     threads released together; a sample is the slowest thread's time.
+//   - A benchmark that cannot run here (e.g. a backend the kernel refuses)
+//     calls State::Skip() and returns; it is reported on stderr and left
+//     out of the results, so no 0 ns/op reaches the JSON.
+//   - Benchmarks may report their own measurements (e.g. per-request
+//     latency percentiles) with State::SetMetric(); the result keeps the
+//     median over samples.
+//   - With counters enabled, thread 0's timed regions are also measured
+//     with instrument::PerfCounterGroup (cycles, instructions, cache and
+//     branch misses) and reported per op; unavailable counters are left
+//     out of the output.
+//   - Benchmark threads can be pinned to CPUs (--cpu). Thread pools are
+//     created inside an UnpinnedScope so their workers are not confined to
+//     the pinned CPU; /jobs variants share SharedJobSystem(). CPU model,
+//     frequency governor and current frequency are recorded in the output;
+//     changing the governor needs root and is left to the caller.
+//
+// Example:
+// ```cpp
+//   void BM_Mat4Multiply(navary::bench::State& state) {
+//     Mat4 a = ..., b = ...;
+//     while (state.KeepRunning()) {
+//       navary::bench::DoNotOptimize(a * b);
+//     }
+//   }
+//   NAVARY_BENCH("math/Mat4::operator*", BM_Mat4Multiply);
+// ```
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "navary/instrument/perf_counters.h"
+#include "navary/navary_status.h"
+
+namespace navary::core::scheduler {
+class JobSystem;
+}  // namespace navary::core::scheduler
+
+namespace navary::bench {
+
+class State;
+using BenchFn = void (*)(State& state);
+
+// Keeps |value| (and the computation producing it) alive.
+template <class T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+// Forces pending memory writes to be considered observable.
+inline void ClobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#else
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+// Aborts the run: a benchmark on a failed setup measures nothing useful.
+inline void Check(const NavaryRC& rc, const char* what) {
+  if (!rc.ok()) {
+    std::fprintf(stderr, "navary-bench: %s failed\n", what);
+    std::abort();
+  }
+}
+
+// Value reported by a benchmark itself, e.g. "latency_p99_us".
+struct Metric {
+  std::string name;
+  double value;
+};
+
+// Per-thread run state handed to a benchmark function.
+class State {
+ public:
+  State(std::uint64_t iterations, std::uint32_t thread_index,
+        std::uint32_t threads, std::atomic<std::uint32_t>* start_gate,
+        const instrument::PerfCounterGroup* counters = nullptr);
+
+  // True while iterations remain. The first call starts the timer (after
+  // all threads of the sample arrived), the last one stops it.
+  bool KeepRunning() {
+    if (done_ < iterations_) [[likely]] {
+      if (done_++ == 0) {
+        Start();
+      }
+      return true;
+    }
+    Stop();
+    return false;
+  }
+
+  // Excludes the enclosed work (e.g. a Reset()) from the sample.
+  void PauseTiming();
+  void ResumeTiming();
+
+  // Work items per iteration, reported as items_per_second.
+  void SetItemsPerIteration(std::uint64_t items) {
+    items_per_iteration_ = items;
+  }
+
+  // Marks the benchmark as unable to run here; call instead of the
+  // KeepRunning() loop. |reason| must outlive the run (a literal).
+  void Skip(const char* reason);
+
+  // Reports |value| under |name| for this sample; thread 0 only.
+  void SetMetric(const char* name, double value);
+
+  std::uint64_t iterations() const {
+    return iterations_;
+  }
+  std::uint32_t thread_index() const {
+    return thread_index_;
+  }
+  std::uint32_t threads() const {
+    return threads_;
+  }
+  std::uint64_t elapsed_ns() const {
+    return elapsed_ns_;
+  }
+  std::uint64_t items_per_iteration() const {
+    return items_per_iteration_;
+  }
+  // Counter deltas over the timed region (valid_mask 0 without counters).
+  const instrument::PerfCounterSample& counter_sample() const {
+    return counter_sample_;
+  }
+  // nullptr unless Skip() was called.
+  const char* skip_reason() const {
+    return skip_reason_;
+  }
+  const std::vector<Metric>& metrics() const {
+    return metrics_;
+  }
+
+ private:
+  void Start();
+  void Stop();
+
+  std::uint64_t iterations_;
+  std::uint64_t done_;
+  std::uint32_t thread_index_;
+  std::uint32_t threads_;
+  std::atomic<std::uint32_t>* start_gate_;
+  std::uint64_t start_ns_;
+  std::uint64_t elapsed_ns_;
+  std::uint64_t items_per_iteration_;
+  const instrument::PerfCounterGroup* counters_;
+  instrument::PerfCounterSample counter_begin_;
+  instrument::PerfCounterSample counter_sample_;
+  const char* skip_reason_;
+  std::vector<Metric> metrics_;
+  bool running_;
+};
+
+struct Benchmark {
+  std::string name;  // "<subsystem>/<kernel>[/<variant>]"
+  BenchFn fn;
+  std::uint32_t threads;
+};
+
+// Registers a benchmark; used through NAVARY_BENCH. Returns true so it can
+// initialize a namespace-scope variable.
+bool RegisterBenchmark(const char* name, BenchFn fn, std::uint32_t threads);
+const std::vector<Benchmark>& RegisteredBenchmarks();
+
+struct Stats {
+  double min;
+  double median;
+  double mean;
+  double stddev;
+  double p90;
+  double max;
+};
+
+// Summary of |samples| (unsorted). Zero-filled when empty.
+Stats ComputeStats(std::vector<double> samples);
+
+struct RunOptions {
+  std::string filter;             // substring match on name; empty = all
+  std::uint32_t repetitions = 10;
+  double min_sample_ms      = 2.0;
+  double warmup_ms          = 50.0;
+  int cpu                   = -1;     // first CPU to pin; -1 = no pinning
+  bool counters             = false;  // hardware counters on thread 0
+};
+
+struct BenchResult {
+  std::string name;
+  std::uint32_t threads;
+  std::uint64_t iterations;  // per sample, per thread
+  std::vector<double> samples_ns_per_op;
+  Stats ns_per_op;
+  double items_per_second;  // from the median sample
+  // Summed over the measured samples (thread 0); divide by
+  // counter_iterations for per-op values.
+  instrument::PerfCounterSample counters;
+  std::uint64_t counter_iterations;
+  std::vector<Metric> metrics;  // median over the measured samples
+};
+
+struct CpuInfo {
+  std::string model;
+  std::uint32_t logical_cpus;
+  std::string governor;  // empty when unknown
+  double mhz_before;     // 0 when unknown
+  double mhz_after;
+};
+
+// Reads CPU model / governor / frequency for |cpu| (0 when negative).
+CpuInfo QueryCpuInfo(int cpu);
+
+// Pins the calling thread to |cpu|. False when unsupported or refused.
+bool PinThreadToCpu(int cpu);
+
+// Widens a pinned calling thread back to the process's startup CPU mask
+// for the scope's lifetime and re-pins it afterwards. Threads started
+// inside inherit the wide mask. No-op on threads that are not pinned.
+class UnpinnedScope {
+ public:
+  UnpinnedScope();
+  ~UnpinnedScope();
+
+  UnpinnedScope(const UnpinnedScope&)            = delete;
+  UnpinnedScope& operator=(const UnpinnedScope&) = delete;
+
+ private:
+  int pinned_cpu_;  // -1 when the thread was not pinned
+};
+
+// One JobSystem (a worker per hardware thread) shared by every benchmark,
+// created on first use inside an UnpinnedScope and alive until exit.
+core::scheduler::JobSystem& SharedJobSystem();
+
+// Runs every registered benchmark matching options.filter, in name order.
+// Skipped benchmarks are reported on stderr and have no result.
+std::vector<BenchResult> RunBenchmarks(const RunOptions& options);
+
+// Serializes results as "navary-bench/1" JSON. |label| identifies the run
+// (e.g. a commit hash).
+std::string ToJson(const std::vector<BenchResult>& results,
+                   const CpuInfo& cpu, const RunOptions& options,
+                   const std::string& label);
+
+}  // namespace navary::bench
+
+#define NAVARY_BENCH_CONCAT_INNER(a, b) a##b
+#define NAVARY_BENCH_CONCAT(a, b) NAVARY_BENCH_CONCAT_INNER(a, b)
+
+#define NAVARY_BENCH(name, fn)                                   \
+  [[maybe_unused]] static const bool NAVARY_BENCH_CONCAT(        \
+      navary_bench_registered_, __LINE__) =                      \
+      ::navary::bench::RegisterBenchmark(name, fn, 1)
+
+#define NAVARY_BENCH_THREADS(name, fn, threads)                  \
+  [[maybe_unused]] static const bool NAVARY_BENCH_CONCAT(        \
+      navary_bench_registered_, __LINE__) =                      \
+      ::navary::bench::RegisterBenchmark(name, fn, threads)
@@ -0,0 +1,605 @@
+// Navary Engine - Benchmark Suite
+// File: bench/bench_compare.cc
+// Purpose: JSON reader, Mann-Whitney U, bootstrap CI, verdicts and report
+//          for navary-bench-compare.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "bench_compare.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+
+namespace navary::bench {
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// JSON reader: just enough for navary-bench output (objects, arrays,
+// strings, numbers, literals). Unknown keys are skipped, so newer writers
+// can add fields without breaking older baselines.
+// -----------------------------------------------------------------------------
+
+class JsonReader {
+ public:
+  explicit JsonReader(const std::string& text)
+      : s_(text), pos_(0), failed_(false) {}
+
+  bool failed() const {
+    return failed_;
+  }
+  const std::string& error() const {
+    return error_;
+  }
+
+  void SkipSpace() {
+    while (pos_ < s_.size() &&
+           (s_[pos_] == ' ' || s_[pos_] == '\n' || s_[pos_] == '\r' ||
+            s_[pos_] == '\t')) {
+      ++pos_;
+    }
+  }
+
+  bool Consume(char c) {
+    SkipSpace();
+    if (pos_ < s_.size() && s_[pos_] == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  void Expect(char c) {
+    if (!Consume(c)) {
+      Fail(std::string("expected '") + c + "'");
+    }
+  }
+
+  char Peek() {
+    SkipSpace();
+    return pos_ < s_.size() ? s_[pos_] : '\0';
+  }
+
+  std::string ReadString() {
+    std::string out;
+    Expect('"');
+    while (!failed_ && pos_ < s_.size() && s_[pos_] != '"') {
+      char c = s_[pos_++];
+      if (c == '\\' && pos_ < s_.size()) {
+        const char e = s_[pos_++];
+        switch (e) {
+          case 'n':
+            c = '\n';
+            break;
+          case 't':
+            c = '\t';
+            break;
+          case 'r':
+            c = '\r';
+            break;
+          case 'b':
+            c = '\b';
+            break;
+          case 'f':
+            c = '\f';
+            break;
+          case 'u':
+            // Only the control characters the writer escapes; anything
+            // wider is replaced.
+            if (pos_ + 4 <= s_.size()) {
+              const long code = std::strtol(s_.substr(pos_, 4).c_str(),
+                                            nullptr, 16);
+              c    = code < 0x80 ? static_cast<char>(code) : '?';
+              pos_ += 4;
+            }
+            break;
+          default:
+            c = e;
+            break;
+        }
+      }
+      out.push_back(c);
+    }
+    if (pos_ >= s_.size()) {
+      Fail("unterminated string");
+      return out;
+    }
+    ++pos_;
+    return out;
+  }
+
+  double ReadNumber() {
+    SkipSpace();
+    const char* begin = s_.c_str() + pos_;
+    char* end         = nullptr;
+    const double v    = std::strtod(begin, &end);
+    if (end == begin) {
+      Fail("expected number");
+      return 0.0;
+    }
+    pos_ += static_cast<std::size_t>(end - begin);
+    return v;
+  }
+
+  // Skips any value.
+  void SkipValue() {
+    const char c = Peek();
+    if (c == '"') {
+      ReadString();
+    } else if (c == '{') {
+      Expect('{');
+      if (Consume('}')) {
+        return;
+      }
+      do {
+        ReadString();
+        Expect(':');
+        SkipValue();
+      } while (!failed_ && Consume(','));
+      Expect('}');
+    } else if (c == '[') {
+      Expect('[');
+      if (Consume(']')) {
+        return;
+      }
+      do {
+        SkipValue();
+      } while (!failed_ && Consume(','));
+      Expect(']');
+    } else if (c == 't' || c == 'f' || c == 'n') {
+      while (pos_ < s_.size() && std::isalpha(
+                                     static_cast<unsigned char>(s_[pos_]))) {
+        ++pos_;
+      }
+    } else {
+      ReadNumber();
+    }
+  }
+
+  // Calls |on_key(key)| for each member; the callback must consume the
+  // value (or call SkipValue()).
+  template <class F>
+  void ReadObject(F&& on_key) {
+    Expect('{');
+    if (failed_ || Consume('}')) {
+      return;
+    }
+    do {
+      const std::string key = ReadString();
+      Expect(':');
+      if (failed_) {
+        return;
+      }
+      on_key(key);
+    } while (!failed_ && Consume(','));
+    Expect('}');
+  }
+
+  template <class F>
+  void ReadArray(F&& on_element) {
+    Expect('[');
+    if (failed_ || Consume(']')) {
+      return;
+    }
+    do {
+      on_element();
+    } while (!failed_ && Consume(','));
+    Expect(']');
+  }
+
+  void Fail(const std::string& what) {
+    if (!failed_) {
+      failed_ = true;
+      error_  = what + " at offset " + std::to_string(pos_);
+    }
+  }
+
+ private:
+  const std::string& s_;
+  std::size_t pos_;
+  bool failed_;
+  std::string error_;
+};
+
+// -----------------------------------------------------------------------------
+// Statistics helpers
+// -----------------------------------------------------------------------------
+
+// splitmix64: small, seedable and identical on every platform.
+std::uint64_t NextRandom(std::uint64_t* state) {
+  std::uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+  z               = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z               = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+void Resample(const std::vector<double>& in, std::uint64_t* rng,
+              std::vector<double>* out) {
+  out->resize(in.size());
+  for (double& v : *out) {
+    v = in[NextRandom(rng) % in.size()];
+  }
+}
+
+std::string SubsystemOf(const std::string& name) {
+  const std::size_t slash = name.find('/');
+  return slash == std::string::npos ? std::string("other")
+                                    : name.substr(0, slash);
+}
+
+int SubsystemRank(const std::string& subsystem) {
+  static const char* const kOrder[] = {"memory", "math", "time", "graph",
+                                       "render"};
+  for (int i = 0; i < 5; ++i) {
+    if (subsystem == kOrder[i]) {
+      return i;
+    }
+  }
+  return 5;
+}
+
+double ThresholdFor(const std::string& name, const CompareOptions& options) {
+  for (const auto& [key, value] : options.thresholds) {
+    if (name.find(key) != std::string::npos) {
+      return value;
+    }
+  }
+  return options.threshold;
+}
+
+// FNV-1a of the name: a per-benchmark bootstrap seed that does not depend
+// on run order.
+std::uint64_t NameSeed(const std::string& name) {
+  std::uint64_t h = 0xCBF29CE484222325ull;
+  for (char c : name) {
+    h ^= static_cast<unsigned char>(c);
+    h *= 0x100000001B3ull;
+  }
+  return h;
+}
+
+void AppendF(std::string* out, const char* fmt, ...)
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((format(printf, 2, 3)))
+#endif
+    ;
+
+void AppendF(std::string* out, const char* fmt, ...) {
+  char buf[512];
+  va_list args;
+  va_start(args, fmt);
+  std::vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+  out->append(buf);
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// Parsing
+// -----------------------------------------------------------------------------
+
+bool ParseBenchRun(const std::string& json, BenchRun* out,
+                   std::string* error) {
+  *out = BenchRun{};
+  JsonReader r(json);
+  std::string schema;
+  r.ReadObject([&](const std::string& key) {
+    if (key == "schema") {
+      schema = r.ReadString();
+    } else if (key == "context") {
+      r.ReadObject([&](const std::string& ckey) {
+        if (ckey == "label") {
+          out->label = r.ReadString();
+        } else if (ckey == "cpu_model") {
+          out->cpu_model = r.ReadString();
+        } else if (ckey == "governor") {
+          out->governor = r.ReadString();
+        } else if (ckey == "build") {
+          out->build = r.ReadString();
+        } else {
+          r.SkipValue();
+        }
+      });
+    } else if (key == "benchmarks") {
+      r.ReadArray([&] {
+        RunSeries series{};
+        series.threads = 1;
+        r.ReadObject([&](const std::string& bkey) {
+          if (bkey == "name") {
+            series.name = r.ReadString();
+          } else if (bkey == "threads") {
+            series.threads = static_cast<std::uint32_t>(r.ReadNumber());
+          } else if (bkey == "samples_ns_per_op") {
+            r.ReadArray([&] {
+              series.samples_ns_per_op.push_back(r.ReadNumber());
+            });
+          } else {
+            r.SkipValue();
+          }
+        });
+        out->benchmarks.push_back(std::move(series));
+      });
+    } else {
+      r.SkipValue();
+    }
+  });
+  if (r.failed()) {
+    *error = r.error();
+    return false;
+  }
+  if (schema != "navary-bench/1") {
+    *error = "unsupported schema '" + schema + "'";
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// Statistics
+// -----------------------------------------------------------------------------
+
+double Median(std::vector<double> values) {
+  if (values.empty()) {
+    return 0.0;
+  }
+  const std::size_t n = values.size();
+  std::nth_element(values.begin(), values.begin() + n / 2, values.end());
+  const double upper = values[n / 2];
+  if (n % 2 == 1) {
+    return upper;
+  }
+  const double lower =
+      *std::max_element(values.begin(), values.begin() + n / 2);
+  return 0.5 * (lower + upper);
+}
+
+double MannWhitneyPValue(const std::vector<double>& a,
+                         const std::vector<double>& b) {
+  const std::size_t n1 = a.size();
+  const std::size_t n2 = b.size();
+  if (n1 == 0 || n2 == 0) {
+    return 1.0;
+  }
+  // Pool, sort, assign average ranks to ties.
+  std::vector<std::pair<double, bool>> pooled;  // (value, from_a)
+  pooled.reserve(n1 + n2);
+  for (double v : a) {
+    pooled.emplace_back(v, true);
+  }
+  for (double v : b) {
+    pooled.emplace_back(v, false);
+  }
+  std::sort(pooled.begin(), pooled.end(),
+            [](const auto& x, const auto& y) { return x.first < y.first; });
+
+  const std::size_t n = pooled.size();
+  double rank_sum_a   = 0.0;
+  double tie_term     = 0.0;  // sum(t^3 - t) over tie groups
+  for (std::size_t i = 0; i < n;) {
+    std::size_t j = i + 1;
+    while (j < n && pooled[j].first == pooled[i].first) {
+      ++j;
+    }
+    const double avg_rank = 0.5 * static_cast<double>(i + 1 + j);
+    for (std::size_t k = i; k < j; ++k) {
+      if (pooled[k].second) {
+        rank_sum_a += avg_rank;
+      }
+    }
+    const double t = static_cast<double>(j - i);
+    tie_term += t * t * t - t;
+    i = j;
+  }
+
+  const double dn1 = static_cast<double>(n1);
+  const double dn2 = static_cast<double>(n2);
+  const double dn  = static_cast<double>(n);
+  const double u1  = rank_sum_a - dn1 * (dn1 + 1.0) / 2.0;
+  const double mu  = dn1 * dn2 / 2.0;
+  const double var =
+      dn1 * dn2 / 12.0 * ((dn + 1.0) - tie_term / (dn * (dn - 1.0)));
+  if (var <= 0.0) {
+    return 1.0;
+  }
+  const double z = std::max(0.0, std::fabs(u1 - mu) - 0.5) / std::sqrt(var);
+  return std::min(1.0, std::erfc(z / std::sqrt(2.0)));
+}
+
+void BootstrapMedianRatioCi(const std::vector<double>& baseline,
+                            const std::vector<double>& current,
+                            std::uint32_t resamples, std::uint64_t seed,
+                            double* lo, double* hi) {
+  *lo = 0.0;
+  *hi = 0.0;
+  if (baseline.empty() || current.empty() || resamples == 0) {
+    return;
+  }
+  std::uint64_t rng = seed;
+  std::vector<double> ratios;
+  ratios.reserve(resamples);
+  std::vector<double> base_sample;
+  std::vector<double> cur_sample;
+  for (std::uint32_t i = 0; i < resamples; ++i) {
+    Resample(baseline, &rng, &base_sample);
+    Resample(current, &rng, &cur_sample);
+    const double base_median = Median(base_sample);
+    if (base_median > 0.0) {
+      ratios.push_back(Median(cur_sample) / base_median);
+    }
+  }
+  if (ratios.empty()) {
+    return;
+  }
+  std::sort(ratios.begin(), ratios.end());
+  const std::size_t last = ratios.size() - 1;
+  *lo = ratios[static_cast<std::size_t>(0.025 * static_cast<double>(last))];
+  *hi = ratios[static_cast<std::size_t>(0.975 * static_cast<double>(last))];
+}
+
+const char* VerdictName(Verdict verdict) {
+  switch (verdict) {
+    case Verdict::kUnchanged:
+      return "ok";
+    case Verdict::kImproved:
+      return "FASTER";
+    case Verdict::kRegressed:
+      return "SLOWER";
+    case Verdict::kNew:
+      return "new";
+    case Verdict::kMissing:
+      return "missing";
+  }
+  return "?";
+}
+
+// -----------------------------------------------------------------------------
+// Comparison
+// -----------------------------------------------------------------------------
+
+std::vector<Comparison> CompareRuns(const BenchRun& baseline,
+                                    const BenchRun& current,
+                                    const CompareOptions& options) {
+  std::map<std::string, const RunSeries*> base_by_name;
+  for (const RunSeries& s : baseline.benchmarks) {
+    base_by_name[s.name] = &s;
+  }
+
+  std::vector<Comparison> out;
+  out.reserve(current.benchmarks.size() + baseline.benchmarks.size());
+  for (const RunSeries& cur : current.benchmarks) {
+    Comparison c{};
+    c.name           = cur.name;
+    c.subsystem      = SubsystemOf(cur.name);
+    c.threshold      = ThresholdFor(cur.name, options);
+    c.current_median = Median(cur.samples_ns_per_op);
+
+    const auto it = base_by_name.find(cur.name);
+    if (it == base_by_name.end()) {
+      c.verdict = Verdict::kNew;
+      out.push_back(std::move(c));
+      continue;
+    }
+    const RunSeries& base = *it->second;
+    base_by_name.erase(it);
+
+    c.baseline_median = Median(base.samples_ns_per_op);
+    c.ratio           = c.baseline_median > 0.0
+                            ? c.current_median / c.baseline_median
+                            : 1.0;
+    c.p_value = MannWhitneyPValue(base.samples_ns_per_op,
+                                  cur.samples_ns_per_op);
+    BootstrapMedianRatioCi(base.samples_ns_per_op, cur.samples_ns_per_op,
+                           options.bootstrap_resamples, NameSeed(cur.name),
+                           &c.ratio_lo, &c.ratio_hi);
+
+    c.verdict = Verdict::kUnchanged;
+    if (c.p_value < options.alpha) {
+      if (c.ratio_lo > 1.0 && c.ratio > 1.0 + c.threshold) {
+        c.verdict = Verdict::kRegressed;
+      } else if (c.ratio_hi < 1.0 && c.ratio < 1.0 - c.threshold) {
+        c.verdict = Verdict::kImproved;
+      }
+    }
+    out.push_back(std::move(c));
+  }
+  for (const auto& [name, series] : base_by_name) {
+    Comparison c{};
+    c.name            = name;
+    c.subsystem       = SubsystemOf(name);
+    c.threshold       = ThresholdFor(name, options);
+    c.verdict         = Verdict::kMissing;
+    c.baseline_median = Median(series->samples_ns_per_op);
+    out.push_back(std::move(c));
+  }
+
+  std::sort(out.begin(), out.end(),
+            [](const Comparison& a, const Comparison& b) {
+              const int ra = SubsystemRank(a.subsystem);
+              const int rb = SubsystemRank(b.subsystem);
+              if (ra != rb) {
+                return ra < rb;
+              }
+              if (a.subsystem != b.subsystem) {
+                return a.subsystem < b.subsystem;
+              }
+              return a.name < b.name;
+            });
+  return out;
+}
+
+std::uint32_t CountVerdict(const std::vector<Comparison>& comparisons,
+                           Verdict verdict) {
+  std::uint32_t n = 0;
+  for (const Comparison& c : comparisons) {
+    n += c.verdict == verdict ? 1u : 0u;
+  }
+  return n;
+}
+
+// -----------------------------------------------------------------------------
+// Report
+// -----------------------------------------------------------------------------
+
+std::string FormatReport(const BenchRun& baseline, const BenchRun& current,
+                         const std::vector<Comparison>& comparisons,
+                         const CompareOptions& options) {
+  std::string out;
+  AppendF(&out, "baseline: %s\ncurrent:  %s\n",
+          baseline.label.empty() ? "(unlabeled)" : baseline.label.c_str(),
+          current.label.empty() ? "(unlabeled)" : current.label.c_str());
+  AppendF(&out, "rule: p < %.3g (Mann-Whitney) and 95%% CI of the median "
+                "ratio past 1 and |change| > threshold (default %.1f%%)\n",
+          options.alpha, 100.0 * options.threshold);
+  if (baseline.cpu_model != current.cpu_model) {
+    AppendF(&out, "warning: cpu differs ('%s' vs '%s')\n",
+            baseline.cpu_model.c_str(), current.cpu_model.c_str());
+  }
+  if (baseline.governor != current.governor) {
+    AppendF(&out, "warning: governor differs ('%s' vs '%s')\n",
+            baseline.governor.c_str(), current.governor.c_str());
+  }
+  if (baseline.build != current.build) {
+    AppendF(&out, "warning: build type differs ('%s' vs '%s')\n",
+            baseline.build.c_str(), current.build.c_str());
+  }
+
+  std::string group;
+  for (const Comparison& c : comparisons) {
+    if (c.subsystem != group) {
+      group = c.subsystem;
+      AppendF(&out, "\n[%s]\n", group.c_str());
+      AppendF(&out, "  %-44s %12s %12s %8s %17s %9s  %s\n", "benchmark",
+              "base ns", "cur ns", "change", "95% CI", "p", "verdict");
+    }
+    if (c.verdict == Verdict::kNew || c.verdict == Verdict::kMissing) {
+      AppendF(&out, "  %-44s %12.2f %12.2f %8s %17s %9s  %s\n",
+              c.name.c_str(), c.baseline_median, c.current_median, "-", "-",
+              "-", VerdictName(c.verdict));
+      continue;
+    }
+    char ci[32];
+    std::snprintf(ci, sizeof(ci), "[%+.1f%%, %+.1f%%]",
+                  100.0 * (c.ratio_lo - 1.0), 100.0 * (c.ratio_hi - 1.0));
+    AppendF(&out, "  %-44s %12.2f %12.2f %+7.1f%% %17s %9.2g  %s\n",
+            c.name.c_str(), c.baseline_median, c.current_median,
+            100.0 * (c.ratio - 1.0), ci, c.p_value, VerdictName(c.verdict));
+  }
+
+  AppendF(&out, "\n%u slower, %u faster, %u unchanged, %u new, %u missing\n",
+          CountVerdict(comparisons, Verdict::kRegressed),
+          CountVerdict(comparisons, Verdict::kImproved),
+          CountVerdict(comparisons, Verdict::kUnchanged),
+          CountVerdict(comparisons, Verdict::kNew),
+          CountVerdict(comparisons, Verdict::kMissing));
+  return out;
+}
+
+}  // namespace navary::bench
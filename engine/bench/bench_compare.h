@@ -0,0 +1,119 @@
+#pragma once
+// Navary Engine - Benchmark Suite
+// File: bench/bench_compare.h
+// Purpose: Baseline comparison for navary-bench JSON: per-benchmark
+//          statistical tests, regression verdicts and a report grouped by
+//          subsystem.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - A run is read back from the "navary-bench/1" JSON written by
+//     navary-bench; only the raw per-sample ns/op are used for the tests.
+//   - Each benchmark present in both runs gets:
+//       * ratio      = median(current) / median(baseline)
+//       * p_value    = two-sided Mann-Whitney U (normal approximation with
+//                      tie and continuity correction)
+//       * ratio CI   = 95% percentile bootstrap of the median ratio
+//                      (fixed seed, so a report is reproducible)
+//   - Verdict: a regression needs all three to agree — p below alpha, the
+//     CI entirely above 1 and the ratio beyond the benchmark's noise
+//     threshold. Improvements mirror that. Anything else is unchanged.
+//   - Names are "<subsystem>/<kernel>..."; the report groups by the part
+//     before the first '/', in the order memory, math, time, graph,
+//     render, then any other subsystem alphabetically.
+//
+// Notes:
+//   - Ten samples per side give a minimum two-sided p of about 2e-4, so
+//     the default alpha (0.01) is reachable with --repetitions 10.
+//   - Compare runs from the same machine, governor and build type; the
+//     report warns when the recorded contexts differ.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace navary::bench {
+
+struct RunSeries {
+  std::string name;
+  std::uint32_t threads;
+  std::vector<double> samples_ns_per_op;
+};
+
+struct BenchRun {
+  std::string label;
+  std::string cpu_model;
+  std::string governor;
+  std::string build;
+  std::vector<RunSeries> benchmarks;
+};
+
+// Parses navary-bench JSON. On failure returns false and sets |error|.
+bool ParseBenchRun(const std::string& json, BenchRun* out,
+                   std::string* error);
+
+// Two-sided Mann-Whitney U p-value for "a and b come from the same
+// distribution". 1 when either side is empty or every value ties.
+double MannWhitneyPValue(const std::vector<double>& a,
+                         const std::vector<double>& b);
+
+// 95% percentile-bootstrap interval of median(current) / median(baseline).
+void BootstrapMedianRatioCi(const std::vector<double>& baseline,
+                            const std::vector<double>& current,
+                            std::uint32_t resamples, std::uint64_t seed,
+                            double* lo, double* hi);
+
+double Median(std::vector<double> values);
+
+enum class Verdict : std::uint8_t {
+  kUnchanged = 0,
+  kImproved,
+  kRegressed,
+  kNew,      // only in the current run
+  kMissing,  // only in the baseline
+};
+
+const char* VerdictName(Verdict verdict);
+
+struct CompareOptions {
+  double threshold                  = 0.03;  // relative; 0.03 = 3%
+  double alpha                      = 0.01;
+  std::uint32_t bootstrap_resamples = 2000;
+  // Per-benchmark threshold overrides: first entry whose key is a
+  // substring of the name wins.
+  std::vector<std::pair<std::string, double>> thresholds;
+};
+
+struct Comparison {
+  std::string name;
+  std::string subsystem;
+  Verdict verdict;
+  double baseline_median;  // ns/op; 0 for kNew
+  double current_median;   // ns/op; 0 for kMissing
+  double ratio;            // current / baseline
+  double ratio_lo;
+  double ratio_hi;
+  double p_value;
+  double threshold;  // the one applied
+};
+
+// Matches benchmarks by name. Output is grouped by subsystem in report
+// order, names sorted inside a group.
+std::vector<Comparison> CompareRuns(const BenchRun& baseline,
+                                    const BenchRun& current,
+                                    const CompareOptions& options);
+
+// Human-readable report (plain text tables, one per subsystem) including
+// context mismatch warnings and a final summary line.
+std::string FormatReport(const BenchRun& baseline, const BenchRun& current,
+                         const std::vector<Comparison>& comparisons,
+                         const CompareOptions& options);
+
+std::uint32_t CountVerdict(const std::vector<Comparison>& comparisons,
+                           Verdict verdict);
+
+}  // namespace navary::bench
@@ -0,0 +1,203 @@
+// Navary Engine - Benchmark Suite
+// File: bench/bench_compare_main.cc
+// Purpose: navary-bench-compare command line: stores baselines and gates
+//          new runs against them.
+//
+// Usage:
+//   navary-bench-compare save <run.json> <baseline-dir> [<name>]
+//       Validates the run and stores it as <baseline-dir>/<name>.json
+//       (name defaults to the run's label, else "baseline"), creating
+//       <baseline-dir> if needed.
+//
+//   navary-bench-compare compare <baseline.json> <current.json>
+//       [--threshold <pct>]              default noise threshold (3)
+//       [--threshold-for <substr>=<pct>] per-benchmark override, repeatable
+//       [--alpha <p>]                    Mann-Whitney significance (0.01)
+//       [--report <path>]                also write the report to a file
+//       [--warn-only]                    exit 0 even with regressions
+//
+// Exit codes: 0 = no regression, 1 = regression found, 2 = usage or I/O
+// error. CI runs `compare` after navary-bench and fails the job on 1.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+#include "bench_compare.h"
+
+namespace {
+
+using namespace navary::bench;
+
+void PrintUsage() {
+  std::fprintf(stderr,
+               "usage: navary-bench-compare save <run.json> <baseline-dir> "
+               "[<name>]\n"
+               "       navary-bench-compare compare <baseline.json> "
+               "<current.json>\n"
+               "           [--threshold pct] [--threshold-for substr=pct] "
+               "[--alpha p]\n"
+               "           [--report path] [--warn-only]\n");
+}
+
+bool ReadFile(const std::string& path, std::string* out) {
+  std::FILE* f = std::fopen(path.c_str(), "rb");
+  if (f == nullptr) {
+    return false;
+  }
+  out->clear();
+  char buf[4096];
+  std::size_t n = 0;
+  while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0) {
+    out->append(buf, n);
+  }
+  const bool ok = std::ferror(f) == 0;
+  std::fclose(f);
+  return ok;
+}
+
+bool WriteFile(const std::string& path, const std::string& data) {
+  std::FILE* f = std::fopen(path.c_str(), "wb");
+  if (f == nullptr) {
+    return false;
+  }
+  const bool ok = std::fwrite(data.data(), 1, data.size(), f) == data.size();
+  return std::fclose(f) == 0 && ok;
+}
+
+bool LoadRun(const std::string& path, std::string* text, BenchRun* run) {
+  if (!ReadFile(path, text)) {
+    std::fprintf(stderr, "navary-bench-compare: cannot read %s\n",
+                 path.c_str());
+    return false;
+  }
+  std::string error;
+  if (!ParseBenchRun(*text, run, &error)) {
+    std::fprintf(stderr, "navary-bench-compare: %s: %s\n", path.c_str(),
+                 error.c_str());
+    return false;
+  }
+  return true;
+}
+
+// Keeps baseline file names portable.
+std::string SanitizeName(const std::string& name) {
+  std::string out;
+  for (char c : name) {
+    const bool keep = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                      (c >= '0' && c <= '9') || c == '-' || c == '_' ||
+                      c == '.';
+    out.push_back(keep ? c : '_');
+  }
+  return out.empty() ? std::string("baseline") : out;
+}
+
+int Save(int argc, char** argv) {
+  if (argc < 4 || argc > 5) {
+    PrintUsage();
+    return 2;
+  }
+  std::string text;
+  BenchRun run;
+  if (!LoadRun(argv[2], &text, &run)) {
+    return 2;
+  }
+  const std::string name = SanitizeName(argc == 5 ? argv[4] : run.label);
+  const std::string path = std::string(argv[3]) + "/" + name + ".json";
+  std::error_code ec;
+  std::filesystem::create_directories(argv[3], ec);
+  if (ec) {
+    std::fprintf(stderr, "navary-bench-compare: cannot create %s: %s\n",
+                 argv[3], ec.message().c_str());
+    return 2;
+  }
+  if (!WriteFile(path, text)) {
+    std::fprintf(stderr, "navary-bench-compare: cannot write %s\n",
+                 path.c_str());
+    return 2;
+  }
+  std::printf("stored %zu benchmarks as %s\n", run.benchmarks.size(),
+              path.c_str());
+  return 0;
+}
+
+int Compare(int argc, char** argv) {
+  if (argc < 4) {
+    PrintUsage();
+    return 2;
+  }
+  CompareOptions options;
+  std::string report_path;
+  bool warn_only = false;
+  for (int i = 4; i < argc; ++i) {
+    const char* arg   = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (std::strcmp(arg, "--warn-only") == 0) {
+      warn_only = true;
+      continue;
+    }
+    if (value == nullptr) {
+      PrintUsage();
+      return 2;
+    }
+    if (std::strcmp(arg, "--threshold") == 0) {
+      options.threshold = std::atof(value) / 100.0;
+    } else if (std::strcmp(arg, "--threshold-for") == 0) {
+      const char* eq = std::strrchr(value, '=');
+      if (eq == nullptr || eq == value) {
+        PrintUsage();
+        return 2;
+      }
+      options.thresholds.emplace_back(std::string(value, eq),
+                                      std::atof(eq + 1) / 100.0);
+    } else if (std::strcmp(arg, "--alpha") == 0) {
+      options.alpha = std::atof(value);
+    } else if (std::strcmp(arg, "--report") == 0) {
+      report_path = value;
+    } else {
+      PrintUsage();
+      return 2;
+    }
+    ++i;
+  }
+
+  std::string text;
+  BenchRun baseline;
+  BenchRun current;
+  if (!LoadRun(argv[2], &text, &baseline) ||
+      !LoadRun(argv[3], &text, &current)) {
+    return 2;
+  }
+
+  const std::vector<Comparison> comparisons =
+      CompareRuns(baseline, current, options);
+  const std::string report =
+      FormatReport(baseline, current, comparisons, options);
+  std::fputs(report.c_str(), stdout);
+  if (!report_path.empty() && !WriteFile(report_path, report)) {
+    std::fprintf(stderr, "navary-bench-compare: cannot write %s\n",
+                 report_path.c_str());
+    return 2;
+  }
+  const bool regressed = CountVerdict(comparisons, Verdict::kRegressed) > 0;
+  return regressed && !warn_only ? 1 : 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc >= 2 && std::strcmp(argv[1], "save") == 0) {
+    return Save(argc, argv);
+  }
+  if (argc >= 2 && std::strcmp(argv[1], "compare") == 0) {
+    return Compare(argc, argv);
+  }
+  PrintUsage();
+  return 2;
+}
@@ -0,0 +1,150 @@
+// Navary Engine - Benchmark Suite
+// File: bench/bench_main.cc
+// Purpose: navary-bench command line.
+//
+// Usage:
+//   navary-bench [--filter <substr>] [--repetitions <n>] [--min-ms <ms>]
+//                [--warmup-ms <ms>] [--cpu <index>] [--json <path>]
+//                [--label <text>] [--counters] [--list]
+//
+//   --cpu pins the benchmark threads (thread t to cpu + t). Thread pools
+//   such as the shared JobSystem keep the startup CPU mask.
+//
+//   --counters adds per-op hardware counters (cycles, instructions, cache
+//   and branch misses) via perf_event_open where the kernel allows it.
+//
+//   Compare runs only when they share cpu_model, governor and build; the
+//   JSON context records all three. Benchmark names are stable
+//   ("<subsystem>/<kernel>[/<variant>]") so results diff by name.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "bench.h"
+
+namespace {
+
+void PrintUsage() {
+  std::fprintf(stderr,
+               "usage: navary-bench [--filter s] [--repetitions n] "
+               "[--min-ms ms] [--warmup-ms ms]\n"
+               "                    [--cpu i] [--json path] [--label s] "
+               "[--counters] [--list]\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  using namespace navary::bench;
+  using navary::instrument::PerfCounter;
+
+  RunOptions options;
+  std::string json_path;
+  std::string label;
+  bool list = false;
+  for (int i = 1; i < argc; ++i) {
+    const char* arg   = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (std::strcmp(arg, "--list") == 0) {
+      list = true;
+      continue;
+    }
+    if (std::strcmp(arg, "--counters") == 0) {
+      options.counters = true;
+      continue;
+    }
+    if (value == nullptr) {
+      PrintUsage();
+      return 2;
+    }
+    if (std::strcmp(arg, "--filter") == 0) {
+      options.filter = value;
+    } else if (std::strcmp(arg, "--repetitions") == 0) {
+      options.repetitions = static_cast<std::uint32_t>(std::atoi(value));
+    } else if (std::strcmp(arg, "--min-ms") == 0) {
+      options.min_sample_ms = std::atof(value);
+    } else if (std::strcmp(arg, "--warmup-ms") == 0) {
+      options.warmup_ms = std::atof(value);
+    } else if (std::strcmp(arg, "--cpu") == 0) {
+      options.cpu = std::atoi(value);
+    } else if (std::strcmp(arg, "--json") == 0) {
+      json_path = value;
+    } else if (std::strcmp(arg, "--label") == 0) {
+      label = value;
+    } else {
+      PrintUsage();
+      return 2;
+    }
+    ++i;
+  }
+
+  if (list) {
+    for (const Benchmark& b : RegisteredBenchmarks()) {
+      std::printf("%s\n", b.name.c_str());
+    }
+    return 0;
+  }
+
+  if (options.cpu >= 0 && !PinThreadToCpu(options.cpu)) {
+    std::fprintf(stderr, "navary-bench: could not pin to cpu %d\n",
+                 options.cpu);
+  }
+  CpuInfo cpu = QueryCpuInfo(options.cpu);
+  if (!cpu.governor.empty() && cpu.governor != "performance") {
+    std::fprintf(stderr,
+                 "navary-bench: cpu governor is '%s'; set 'performance' for "
+                 "stable numbers\n",
+                 cpu.governor.c_str());
+  }
+#if !defined(NDEBUG)
+  std::fprintf(stderr, "navary-bench: debug build; numbers are not "
+                       "representative\n");
+#endif
+
+  const std::vector<BenchResult> results = RunBenchmarks(options);
+  cpu.mhz_after = QueryCpuInfo(options.cpu).mhz_before;
+
+  std::printf("%-44s %8s %12s %12s %10s\n", "benchmark", "threads",
+              "median ns", "p90 ns", "stddev%");
+  for (const BenchResult& r : results) {
+    const double rel = r.ns_per_op.median > 0.0
+                           ? 100.0 * r.ns_per_op.stddev / r.ns_per_op.median
+                           : 0.0;
+    std::printf("%-44s %8u %12.2f %12.2f %9.1f%%", r.name.c_str(),
+                r.threads, r.ns_per_op.median, r.ns_per_op.p90, rel);
+    const navary::instrument::PerfCounterSample& c = r.counters;
+    if (c.Has(PerfCounter::kCycles) && c.Has(PerfCounter::kInstructions) &&
+        c.Get(PerfCounter::kCycles) > 0) {
+      std::printf("  ipc %.2f",
+                  static_cast<double>(c.Get(PerfCounter::kInstructions)) /
+                      static_cast<double>(c.Get(PerfCounter::kCycles)));
+    }
+    for (const Metric& m : r.metrics) {
+      std::printf("  %s %.2f", m.name.c_str(), m.value);
+    }
+    std::printf("\n");
+  }
+
+  if (!json_path.empty()) {
+    const std::string json = ToJson(results, cpu, options, label);
+    std::FILE* f = std::fopen(json_path.c_str(), "wb");
+    if (f == nullptr) {
+      std::fprintf(stderr, "navary-bench: cannot write %s\n",
+                   json_path.c_str());
+      return 1;
+    }
+    const bool ok = std::fwrite(json.data(), 1, json.size(), f) ==
+                    json.size();
+    if (std::fclose(f) != 0 || !ok) {
+      std::fprintf(stderr, "navary-bench: write failed for %s\n",
+                   json_path.c_str());
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,80 @@
+// Navary Engine - Benchmark Suite
+// File: bench/effects_bench.cc
+// Purpose: ParticleEmitter update and ring upload at the 100k-particle
+//          budget (one core, 60 Hz).
+//
+// Notes:
+//   - The emitter is pre-warmed to its steady state (spawns balancing
+//     expiries around 100k live particles) before timing, so every
+//     iteration pays spawn, simulate and compaction like a real frame.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+#include <vector>
+
+#include "bench.h"
+#include "navary/effects/particle_emitter.h"
+#include "navary/render/v1/gpu_ring_buffer.h"
+
+namespace {
+
+using navary::bench::ClobberMemory;
+using navary::bench::DoNotOptimize;
+using navary::bench::State;
+using navary::effects::ParticleCurve;
+using navary::effects::ParticleEmitter;
+using navary::effects::ParticleInstance;
+
+constexpr float kDt = 1.0f / 60.0f;
+
+// ~100k alive: 66.7k spawns / s at a mean lifetime of 1.5 s.
+void InitSteadyEmitter(ParticleEmitter* e) {
+  ParticleEmitter::Desc d;
+  d.max_particles = 131072;
+  d.spawn_rate    = 66667.0f;
+  d.lifetime_min  = 1.0f;
+  d.lifetime_max  = 2.0f;
+  d.spawn_radius  = 0.5f;
+  d.drag          = 0.2f;
+  d.size          = ParticleCurve::Bezier(0.05f, 0.3f, 0.2f, 0.0f);
+  d.color_g       = ParticleCurve::Linear(1.0f, 0.2f);
+  d.color_a       = ParticleCurve::Bezier(0.0f, 1.0f, 1.0f, 0.0f);
+  e->Init(d);
+  for (int i = 0; i < 180; ++i) {
+    e->Update(kDt);
+  }
+}
+
+void BM_ParticleUpdate(State& state) {
+  ParticleEmitter emitter;
+  InitSteadyEmitter(&emitter);
+  state.SetItemsPerIteration(emitter.count());
+  while (state.KeepRunning()) {
+    emitter.Update(kDt);
+    ClobberMemory();
+  }
+  DoNotOptimize(emitter.count());
+}
+
+void BM_ParticleWriteInstances(State& state) {
+  ParticleEmitter emitter;
+  InitSteadyEmitter(&emitter);
+  const std::size_t bytes = sizeof(ParticleInstance) * emitter.capacity();
+  std::vector<std::uint8_t> memory(bytes);
+  navary::render::v1::GpuRingBuffer ring;
+  ring.Init(navary::core::BufferHandle{1}, bytes, memory.data());
+  state.SetItemsPerIteration(emitter.count());
+  while (state.KeepRunning()) {
+    ring.ResetFrame();
+    DoNotOptimize(emitter.WriteInstances(&ring).value());
+    ClobberMemory();
+  }
+}
+
+}  // namespace
+
+NAVARY_BENCH("effects/ParticleEmitter::Update/100k", BM_ParticleUpdate);
+NAVARY_BENCH("effects/ParticleEmitter::WriteInstances/100k",
+             BM_ParticleWriteInstances);
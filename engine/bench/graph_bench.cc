@@ -0,0 +1,200 @@
+// Navary Engine - Benchmark Suite
+// File: bench/graph_bench.cc
+// Purpose: Shader graph pipeline (NavGraphWriter -> NavGraphLoader ->
+//          GraphCompiler) and MaterialRegistry operations.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+#include <vector>
+
+#include "bench.h"
+#include "navary/graph/shader/graph_compiler.h"
+#include "navary/graph/shader/navgraph_loader.h"
+#include "navary/graph/shader/navgraph_writer.h"
+#include "navary/materials/v1/material_registry.h"
+
+namespace {
+
+using navary::bench::Check;
+using navary::bench::DoNotOptimize;
+using navary::bench::State;
+using namespace navary::graph::shader;
+using namespace navary::materials::v1;
+using navary::core::SurfaceModel;
+
+constexpr ValueTypeBinary kF1 = ValueTypeBinary::kFloat1;
+constexpr ValueTypeBinary kF3 = ValueTypeBinary::kFloat3;
+constexpr ValueTypeBinary kF4 = ValueTypeBinary::kFloat4;
+
+constexpr std::uint32_t kChainLength = 24;
+
+NavGraphNodeDesc Node(std::uint32_t id, NodeKind kind, std::uint8_t inputs,
+                      ValueTypeBinary type, const float* params,
+                      std::uint16_t param_count) {
+  NavGraphNodeDesc d{};
+  d.id           = id;
+  d.kind         = kind;
+  d.input_count  = inputs;
+  d.output_count = 1;
+  for (std::uint8_t i = 0; i < inputs; ++i) {
+    d.input_types[i] = type;
+  }
+  d.output_types[0] = type;
+  d.params          = params;
+  d.param_count     = param_count;
+  return d;
+}
+
+// A material-sized graph: base color constant plus two chains of
+// alternating multiply / add over distinct constants feeding roughness and
+// metallic.
+void AddBenchGraph(NavGraphWriter* w) {
+  static float constants[2 * kChainLength];
+  for (std::uint32_t i = 0; i < 2 * kChainLength; ++i) {
+    constants[i] = 0.5f + 0.01f * static_cast<float>(i);
+  }
+  static const float kColor[4] = {0.8f, 0.6f, 0.4f, 1.0f};
+
+  std::uint32_t id = 1;
+  Check(w->AddNode(Node(id++, NodeKind::kConstFloat4, 0, kF4, kColor, 4)),
+        "AddNode");
+  NavGraphNodeDesc surface{};
+  surface.id             = 1000;
+  surface.kind           = NodeKind::kMakeSurface;
+  surface.input_count    = 4;
+  surface.input_types[0] = kF4;
+  surface.input_types[1] = kF3;
+  surface.input_types[2] = kF1;
+  surface.input_types[3] = kF1;
+  Check(w->AddNode(surface), "AddNode");
+  Check(w->AddLink(NavGraphLinkDesc{1, 0, 1000, 0}), "AddLink");
+
+  for (std::uint8_t chain = 0; chain < 2; ++chain) {
+    std::uint32_t prev = 0;
+    for (std::uint32_t i = 0; i < kChainLength; ++i) {
+      const std::uint32_t c = id++;
+      Check(w->AddNode(Node(c, NodeKind::kConstFloat, 0, kF1,
+                            &constants[chain * kChainLength + i], 1)),
+            "AddNode");
+      if (prev == 0) {
+        prev = c;
+        continue;
+      }
+      const std::uint32_t op = id++;
+      Check(w->AddNode(Node(op,
+                            (i & 1) ? NodeKind::kAdd : NodeKind::kMultiply,
+                            2, kF1, nullptr, 0)),
+            "AddNode");
+      Check(w->AddLink(NavGraphLinkDesc{prev, 0, op, 0}), "AddLink");
+      Check(w->AddLink(NavGraphLinkDesc{c, 0, op, 1}), "AddLink");
+      prev = op;
+    }
+    Check(w->AddLink(NavGraphLinkDesc{prev, 0, 1000,
+                                      static_cast<std::uint8_t>(2 + chain)}),
+          "AddLink");
+  }
+}
+
+std::vector<std::uint8_t> BenchGraphBytes() {
+  NavGraphWriter writer(SurfaceModel::kLitePbr);
+  AddBenchGraph(&writer);
+  std::vector<std::uint8_t> bytes;
+  Check(writer.Build(&bytes), "NavGraphWriter::Build");
+  return bytes;
+}
+
+// -----------------------------------------------------------------------------
+// Shader graph
+// -----------------------------------------------------------------------------
+
+void BM_NavGraphWriterBuild(State& state) {
+  NavGraphWriter writer(SurfaceModel::kLitePbr);
+  AddBenchGraph(&writer);
+  std::vector<std::uint8_t> bytes;
+  while (state.KeepRunning()) {
+    writer.Build(&bytes);
+    DoNotOptimize(bytes.data());
+  }
+}
+
+void BM_NavGraphLoaderLoad(State& state) {
+  const std::vector<std::uint8_t> bytes = BenchGraphBytes();
+  NavGraphLoader loader;
+  while (state.KeepRunning()) {
+    GraphIr ir{};
+    loader.LoadFromMemory(bytes.data(),
+                          static_cast<std::uint32_t>(bytes.size()), &ir);
+    DoNotOptimize(ir);
+    NavGraphLoader::Release(&ir);
+  }
+}
+
+void BM_GraphCompilerGenerate(State& state) {
+  const std::vector<std::uint8_t> bytes = BenchGraphBytes();
+  NavGraphLoader loader;
+  GraphIr ir{};
+  Check(loader.LoadFromMemory(bytes.data(),
+                              static_cast<std::uint32_t>(bytes.size()), &ir),
+        "NavGraphLoader::LoadFromMemory");
+  const GraphCompiler compiler;
+  while (state.KeepRunning()) {
+    navary::NavaryResult<std::string> glsl =
+        compiler.GenerateUserSurfaceGlSl(ir);
+    DoNotOptimize(glsl);
+  }
+  NavGraphLoader::Release(&ir);
+}
+
+// -----------------------------------------------------------------------------
+// MaterialRegistry
+// -----------------------------------------------------------------------------
+
+constexpr std::uint32_t kMaterials = 4096;
+
+MaterialDesc BenchMaterialDesc(std::uint32_t graph) {
+  MaterialDesc desc = {};
+  desc.graph_id     = GraphId{graph};
+  desc.graph_hash   = ShaderHash{graph};
+  return desc;
+}
+
+void BM_MaterialRegistryCreateDestroy(State& state) {
+  MaterialRegistry registry;
+  Check(registry.Init(kMaterials), "MaterialRegistry::Init");
+  const MaterialDesc desc = BenchMaterialDesc(1);
+  while (state.KeepRunning()) {
+    navary::NavaryResult<MaterialHandle> h = registry.CreateMaterial(desc);
+    registry.DestroyMaterial(h.value());
+  }
+}
+
+void BM_MaterialRegistryGet(State& state) {
+  MaterialRegistry registry;
+  Check(registry.Init(kMaterials), "MaterialRegistry::Init");
+  std::vector<MaterialHandle> handles;
+  handles.reserve(kMaterials);
+  for (std::uint32_t i = 0; i < kMaterials; ++i) {
+    navary::NavaryResult<MaterialHandle> h =
+        registry.CreateMaterial(BenchMaterialDesc(i));
+    Check(h.status(), "MaterialRegistry::CreateMaterial");
+    handles.push_back(h.value());
+  }
+  // Stride through the table like draw submission over sorted batches.
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(registry.GetMaterial(handles[i]));
+    i = (i + 97) & (kMaterials - 1);
+  }
+}
+
+}  // namespace
+
+NAVARY_BENCH("graph/NavGraphWriter::Build", BM_NavGraphWriterBuild);
+NAVARY_BENCH("graph/NavGraphLoader::LoadFromMemory", BM_NavGraphLoaderLoad);
+NAVARY_BENCH("graph/GraphCompiler::GenerateUserSurfaceGlSl",
+             BM_GraphCompilerGenerate);
+NAVARY_BENCH("render/MaterialRegistry::CreateDestroy",
+             BM_MaterialRegistryCreateDestroy);
+NAVARY_BENCH("render/MaterialRegistry::GetMaterial", BM_MaterialRegistryGet);
@@ -0,0 +1,252 @@
+// Navary Engine - Benchmark Suite
+// File: bench/io_bench.cc
+// Purpose: AsyncIo small random reads (4 KB, queue depth 1024) on the
+//          thread-pool and io_uring backends, and LZ pack entry decode
+//          per block size, serial and over the JobSystem.
+//
+// Notes:
+//   - The 32 MB source file is written to the temp directory once per
+//     process and is usually page-cache resident, so the numbers are the
+//     submission / completion overhead, not the device.
+//   - Items are reads; items/s is IOPS. latency_p50_us / latency_p99_us
+//     are Enqueue()-to-reap times of one batch's reads, so at this depth
+//     they are mostly queueing.
+//   - Where io_uring is refused (old kernel, seccomp) its benchmark is
+//     skipped.
+//   - Decode items are output bytes; items/s is decoded bytes per second.
+//     Each block size's pack is built once per process.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "navary/core/scheduler/job_system.h"
+#include "navary/core/time/profiler_time.h"
+#include "navary/io/async_io.h"
+#include "navary/io/pack_archive.h"
+#include "navary/io/pack_compression.h"
+#include "navary/io/pack_writer.h"
+
+namespace {
+
+using navary::bench::Check;
+using navary::bench::ClobberMemory;
+using navary::bench::SharedJobSystem;
+using navary::bench::State;
+using navary::bench::UnpinnedScope;
+using navary::core::scheduler::JobSystem;
+using navary::io::AsyncIo;
+using navary::io::AsyncIoBackendKind;
+using navary::io::AsyncReadRequest;
+using navary::io::AsyncReadResult;
+using navary::io::PackArchive;
+using ByteSpan = navary::memory::Span<const std::uint8_t>;
+
+constexpr std::uint32_t kFileSize = 32u << 20;
+constexpr std::uint32_t kReads    = 4096;
+constexpr std::uint32_t kReadSize = 4096;
+constexpr std::uint32_t kDepth    = 1024;
+
+const std::string& ReadFilePath() {
+  static std::string path;
+  if (path.empty()) {
+    const std::filesystem::path p =
+        std::filesystem::temp_directory_path() / "navary_bench_reads.bin";
+    std::vector<std::uint8_t> bytes(kFileSize);
+    for (std::uint32_t i = 0; i < kFileSize; ++i) {
+      bytes[i] = static_cast<std::uint8_t>(i * 131u);
+    }
+    std::FILE* f = std::fopen(p.string().c_str(), "wb");
+    if (f == nullptr) {
+      std::fprintf(stderr, "navary-bench: cannot write %s\n",
+                   p.string().c_str());
+      std::abort();
+    }
+    std::fwrite(bytes.data(), 1, bytes.size(), f);
+    std::fclose(f);
+    path = p.string();
+  }
+  return path;
+}
+
+struct ReadBatch {
+  std::atomic<std::uint32_t> done{0};
+  std::vector<std::uint64_t> latency_ticks;  // by read index in the batch
+};
+
+// Runs on job workers when a Drain() spreads callbacks; each read owns its
+// latency slot.
+void CountRead(const AsyncReadResult& r) {
+  auto* batch = static_cast<ReadBatch*>(r.user_data);
+  batch->latency_ticks[r.user_tag] = r.latency_ticks;
+  batch->done.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Nearest-rank percentile of sorted |ticks|, in microseconds.
+double PercentileUs(const std::vector<std::uint64_t>& ticks, double p) {
+  const std::size_t rank = static_cast<std::size_t>(
+      std::ceil(p * static_cast<double>(ticks.size())));
+  const std::uint64_t t = ticks[rank == 0 ? 0 : rank - 1];
+  return 1e6 * static_cast<double>(t) /
+         static_cast<double>(navary::core::time::ProfilerTicksPerSecond());
+}
+
+void SmallReads(State& state, AsyncIoBackendKind kind) {
+  const std::string& path = ReadFilePath();
+  AsyncIo io;
+  navary::io::AsyncIoDesc desc;
+  desc.backend      = kind;
+  desc.max_requests = kDepth;
+  bool ready = false;
+  {
+    // The thread-pool backend starts its reader threads in Init().
+    UnpinnedScope unpinned;
+    ready = io.Init(desc).ok();
+  }
+  if (!ready) {
+    state.Skip("backend unavailable");
+    return;
+  }
+  JobSystem& jobs = SharedJobSystem();
+  auto file = io.OpenFile(path.c_str());
+  Check(file.status(), "AsyncIo::OpenFile");
+
+  std::vector<std::uint8_t> staging(std::size_t{kReads} * kReadSize);
+  ReadBatch batch;
+  batch.latency_ticks.resize(kReads);
+  state.SetItemsPerIteration(kReads);
+  while (state.KeepRunning()) {
+    batch.done.store(0, std::memory_order_relaxed);
+    std::uint32_t queued = 0;
+    while (batch.done.load(std::memory_order_relaxed) < kReads) {
+      while (queued < kReads) {
+        AsyncReadRequest rq{};
+        rq.file = file.value();
+        rq.offset =
+            ((queued * 2654435761ull) % (kFileSize / kReadSize)) * kReadSize;
+        rq.size      = kReadSize;
+        rq.dst       = staging.data() + std::size_t{queued} * kReadSize;
+        rq.callback  = &CountRead;
+        rq.user_data = &batch;
+        rq.user_tag  = queued;
+        if (!io.Enqueue(rq).ok()) {
+          break;
+        }
+        ++queued;
+      }
+      io.Submit();
+      io.Drain(&jobs, true);
+    }
+    ClobberMemory();
+  }
+
+  // Latencies of the last batch; the runner keeps the median over samples.
+  std::sort(batch.latency_ticks.begin(), batch.latency_ticks.end());
+  state.SetMetric("latency_p50_us", PercentileUs(batch.latency_ticks, 0.50));
+  state.SetMetric("latency_p99_us", PercentileUs(batch.latency_ticks, 0.99));
+
+  io.CloseFile(file.value());
+  io.Shutdown();
+}
+
+// -----------------------------------------------------------------------------
+// Pack decode
+// -----------------------------------------------------------------------------
+
+constexpr std::size_t kPackEntrySize = 16u << 20;
+
+// Asset-like data: repeated records with a slowly changing payload plus
+// some noise, so it compresses but not trivially.
+std::vector<std::uint8_t> MakeAssetBytes(std::size_t size) {
+  std::mt19937 rng(99);
+  std::vector<std::uint8_t> out(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    const std::uint32_t record = static_cast<std::uint32_t>(i / 32);
+    out[i] = (i % 32) < 24 ? static_cast<std::uint8_t>(record * 7 + i % 8)
+                           : static_cast<std::uint8_t>(rng());
+  }
+  return out;
+}
+
+const std::vector<std::uint8_t>& LzPack(std::uint8_t block_shift) {
+  static std::vector<std::uint8_t> packs[navary::io::kPackMaxBlockShift + 1];
+  std::vector<std::uint8_t>& bytes = packs[block_shift];
+  if (bytes.empty()) {
+    const std::vector<std::uint8_t> asset = MakeAssetBytes(kPackEntrySize);
+    navary::io::PackFileOptions lz;
+    lz.codec       = navary::io::PackCodec::kLz;
+    lz.block_shift = block_shift;
+    navary::io::PackWriter writer;
+    Check(writer.AddFile("big.bin", ByteSpan(asset.data(), asset.size()), lz),
+          "PackWriter::AddFile");
+    Check(writer.Build(&bytes), "PackWriter::Build");
+  }
+  return bytes;
+}
+
+void DecodeLz(State& state, std::uint8_t block_shift, bool parallel) {
+  const std::vector<std::uint8_t>& bytes = LzPack(block_shift);
+  PackArchive pack;
+  Check(pack.OpenFromMemory(ByteSpan(bytes.data(), bytes.size())),
+        "PackArchive::OpenFromMemory");
+  JobSystem* jobs = parallel ? &SharedJobSystem() : nullptr;
+
+  std::vector<std::uint8_t> out(kPackEntrySize);
+  state.SetItemsPerIteration(kPackEntrySize);
+  while (state.KeepRunning()) {
+    Check(pack.ReadInto(
+              "big.bin",
+              navary::memory::Span<std::uint8_t>(out.data(), out.size()), jobs),
+          "PackArchive::ReadInto");
+    ClobberMemory();
+  }
+}
+
+void BM_DecodeLz64K(State& state) {
+  DecodeLz(state, 16, false);
+}
+void BM_DecodeLz64KJobs(State& state) {
+  DecodeLz(state, 16, true);
+}
+void BM_DecodeLz128K(State& state) {
+  DecodeLz(state, 17, false);
+}
+void BM_DecodeLz128KJobs(State& state) {
+  DecodeLz(state, 17, true);
+}
+void BM_DecodeLz256K(State& state) {
+  DecodeLz(state, 18, false);
+}
+void BM_DecodeLz256KJobs(State& state) {
+  DecodeLz(state, 18, true);
+}
+
+void BM_AsyncReadsThreadPool(State& state) {
+  SmallReads(state, AsyncIoBackendKind::kThreadPool);
+}
+
+void BM_AsyncReadsIoUring(State& state) {
+  SmallReads(state, AsyncIoBackendKind::kIoUring);
+}
+
+}  // namespace
+
+NAVARY_BENCH("io/AsyncIo::Read/4KB/thread-pool", BM_AsyncReadsThreadPool);
+NAVARY_BENCH("io/AsyncIo::Read/4KB/io_uring", BM_AsyncReadsIoUring);
+NAVARY_BENCH("io/PackArchive::ReadInto/lz/64KB", BM_DecodeLz64K);
+NAVARY_BENCH("io/PackArchive::ReadInto/lz/64KB/jobs", BM_DecodeLz64KJobs);
+NAVARY_BENCH("io/PackArchive::ReadInto/lz/128KB", BM_DecodeLz128K);
+NAVARY_BENCH("io/PackArchive::ReadInto/lz/128KB/jobs", BM_DecodeLz128KJobs);
+NAVARY_BENCH("io/PackArchive::ReadInto/lz/256KB", BM_DecodeLz256K);
+NAVARY_BENCH("io/PackArchive::ReadInto/lz/256KB/jobs", BM_DecodeLz256KJobs);
@@ -0,0 +1,283 @@
+// Navary Engine - Benchmark Suite
+// File: bench/math_bench.cc
+// Purpose: Mat4 / Quat kernels, Frustum culling tests and Fixed math.
+//
+// Notes:
+//   - Inputs live in small arrays walked with a rotating index so the
+//     compiler cannot hoist the kernel out of the loop, and results go
+//     through DoNotOptimize.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "bench.h"
+#include "navary/math/aabb.h"
+#include "navary/math/fixed.h"
+#include "navary/math/fixed_mat4.h"
+#include "navary/math/fixed_trigonometry.h"
+#include "navary/math/fixed_vec3.h"
+#include "navary/math/frustum.h"
+#include "navary/math/mat4.h"
+#include "navary/math/quat.h"
+#include "navary/math/vec3.h"
+
+namespace {
+
+using navary::bench::DoNotOptimize;
+using navary::bench::State;
+using namespace navary::math;
+
+constexpr std::uint32_t kInputs = 64;  // power of two
+
+Mat4 InputMatrix(std::uint32_t i) {
+  const float f = static_cast<float>(i);
+  return Mat4::TRS(Vec3(f, -f * 0.5f, 2.0f),
+                   Vec3(0.1f * f, 0.05f * f, -0.02f * f),
+                   Vec3(1.0f + 0.01f * f, 1.0f, 1.0f));
+}
+
+Quat InputQuat(std::uint32_t i) {
+  return Quat::FromAxisAngle(Vec3(0.3f, 1.0f, 0.2f).normalized(),
+                             0.05f * static_cast<float>(i));
+}
+
+Frustum BenchFrustum() {
+  const Mat4 view = Mat4::Translation(Vec3(0.0f, -2.0f, -10.0f));
+  return Frustum::FromViewProj(Mat4::PerspectiveRH(1.0f, 16.0f / 9.0f,
+                                                   0.1f, 500.0f),
+                               view);
+}
+
+// Boxes spread over the view volume: roughly half visible.
+Aabb InputBox(std::uint32_t i) {
+  const float x = static_cast<float>(static_cast<int>(i % 8) - 4) * 12.0f;
+  const float z = -static_cast<float>(i / 8) * 30.0f;
+  return Aabb(Vec3(x, -1.0f, z), Vec3(x + 2.0f, 1.0f, z + 2.0f));
+}
+
+// -----------------------------------------------------------------------------
+// Mat4 / Quat
+// -----------------------------------------------------------------------------
+
+void BM_Mat4Multiply(State& state) {
+  Mat4 m[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    m[i] = InputMatrix(i);
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(m[i] * m[(i + 1) & (kInputs - 1)]);
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+void BM_Mat4Inverse(State& state) {
+  Mat4 m[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    m[i] = InputMatrix(i);
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(Mat4::Inverse(m[i]));
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+void BM_Mat4TransformPoint(State& state) {
+  const Mat4 m = InputMatrix(7);
+  Vec3 p[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    p[i] = Vec3(static_cast<float>(i), 1.0f, -static_cast<float>(i));
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(m.TransformPoint(p[i]));
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+void BM_QuatMultiply(State& state) {
+  Quat q[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    q[i] = InputQuat(i);
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(q[i] * q[(i + 1) & (kInputs - 1)]);
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+void BM_QuatSlerp(State& state) {
+  Quat q[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    q[i] = InputQuat(i);
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(Quat::Slerp(q[i], q[(i + 7) & (kInputs - 1)], 0.3f));
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+void BM_QuatToMat4(State& state) {
+  Quat q[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    q[i] = InputQuat(i);
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(q[i].ToMat4());
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Frustum / Aabb
+// -----------------------------------------------------------------------------
+
+void BM_FrustumIsAabbVisible(State& state) {
+  const Frustum frustum = BenchFrustum();
+  Aabb boxes[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    boxes[i] = InputBox(i);
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(frustum.IsAabbVisible(boxes[i].min(), boxes[i].max()));
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+void BM_FrustumIsSphereVisible(State& state) {
+  const Frustum frustum = BenchFrustum();
+  Vec3 centers[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    centers[i] = InputBox(i).Center();
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(frustum.IsSphereVisible(centers[i], 1.5f));
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+void BM_FrustumFromViewProj(State& state) {
+  const Mat4 proj = Mat4::PerspectiveRH(1.0f, 16.0f / 9.0f, 0.1f, 500.0f);
+  Mat4 views[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    views[i] = InputMatrix(i);
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(Frustum::FromViewProj(proj, views[i]));
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+void BM_AabbTransformed(State& state) {
+  Mat4 m[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    m[i] = InputMatrix(i);
+  }
+  const Aabb box(Vec3(-1.0f, -2.0f, -3.0f), Vec3(1.0f, 2.0f, 3.0f));
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(box.Transformed(m[i]));
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Fixed
+// -----------------------------------------------------------------------------
+
+void BM_FixedMultiply(State& state) {
+  Fixed15p16 v[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    v[i] = Fixed15p16::FromFloat(0.5f + 0.37f * static_cast<float>(i));
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(v[i] * v[(i + 1) & (kInputs - 1)]);
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+void BM_FixedDivide(State& state) {
+  Fixed15p16 v[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    v[i] = Fixed15p16::FromFloat(0.5f + 0.37f * static_cast<float>(i));
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(v[i] / v[(i + 1) & (kInputs - 1)]);
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+void BM_FixedSqrt(State& state) {
+  Fixed15p16 v[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    v[i] = Fixed15p16::FromFloat(0.5f + 13.0f * static_cast<float>(i));
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(Sqrt(v[i]));
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+void BM_FixedSinCos(State& state) {
+  Fixed15p16 v[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    v[i] = Fixed15p16::FromFloat(0.1f * static_cast<float>(i));
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    Fixed15p16 s;
+    Fixed15p16 c;
+    FixedTrig::SinCos(v[i], s, c);
+    DoNotOptimize(s);
+    DoNotOptimize(c);
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+void BM_FixedMat4TransformPoint(State& state) {
+  using F = Fixed15p16;
+  FixedMat4 m = FixedMat4::Identity();
+  m(3, 0)     = F::FromInt(3);
+  m(3, 1)     = F::FromInt(-2);
+  m(0, 0)     = F::FromFloat(0.5f);
+  FixedVec3 p[kInputs];
+  for (std::uint32_t i = 0; i < kInputs; ++i) {
+    const int k = static_cast<int>(i);
+    p[i]        = FixedVec3(F::FromInt(k), F::FromInt(1), F::FromInt(-k));
+  }
+  std::uint32_t i = 0;
+  while (state.KeepRunning()) {
+    DoNotOptimize(m.TransformPoint(p[i]));
+    i = (i + 1) & (kInputs - 1);
+  }
+}
+
+}  // namespace
+
+NAVARY_BENCH("math/Mat4::operator*", BM_Mat4Multiply);
+NAVARY_BENCH("math/Mat4::Inverse", BM_Mat4Inverse);
+NAVARY_BENCH("math/Mat4::TransformPoint", BM_Mat4TransformPoint);
+NAVARY_BENCH("math/Quat::operator*", BM_QuatMultiply);
+NAVARY_BENCH("math/Quat::Slerp", BM_QuatSlerp);
+NAVARY_BENCH("math/Quat::ToMat4", BM_QuatToMat4);
+NAVARY_BENCH("math/Frustum::IsAabbVisible", BM_FrustumIsAabbVisible);
+NAVARY_BENCH("math/Frustum::IsSphereVisible", BM_FrustumIsSphereVisible);
+NAVARY_BENCH("math/Frustum::FromViewProj", BM_FrustumFromViewProj);
+NAVARY_BENCH("math/Aabb::Transformed", BM_AabbTransformed);
+NAVARY_BENCH("math/Fixed::operator*", BM_FixedMultiply);
+NAVARY_BENCH("math/Fixed::operator/", BM_FixedDivide);
+NAVARY_BENCH("math/Fixed::Sqrt", BM_FixedSqrt);
+NAVARY_BENCH("math/FixedTrig::SinCos", BM_FixedSinCos);
+NAVARY_BENCH("math/FixedMat4::TransformPoint", BM_FixedMat4TransformPoint);
@@ -0,0 +1,108 @@
+// Navary Engine - Benchmark Suite
+// File: bench/messaging_bench.cc
+// Purpose: MessageBus end-to-end throughput: batched publish from one or
+//          four producers, delivered by a Dispatch() on thread 0.
+//
+// Notes:
+//   - Items are messages pushed by one thread per iteration. Thread 0 also
+//     plays the frame thread, and after its timed loop keeps dispatching
+//     until the other producers finish, so a full bus never stalls them.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "bench.h"
+#include "navary/messaging/message_bus.h"
+
+namespace {
+
+using navary::bench::Check;
+using navary::bench::DoNotOptimize;
+using navary::bench::State;
+using navary::messaging::MessageBatch;
+using navary::messaging::MessageBus;
+using navary::messaging::MessageBusDesc;
+using navary::messaging::MessageChannel;
+using navary::messaging::MessagePhase;
+
+constexpr std::uint32_t kBatchMessages = 4096;
+
+void CountMessage(const std::uint64_t&, void* user) {
+  ++*static_cast<std::uint64_t*>(user);
+}
+
+struct SharedBus {
+  MessageBus bus;
+  MessageChannel<std::uint64_t> channel;
+  std::uint64_t received = 0;
+  std::atomic<std::uint32_t> producers_done{0};
+
+  SharedBus() {
+    MessageBusDesc d;
+    d.block_bytes = 64 * 1024;
+    d.block_count = 512;
+    Check(bus.Init(d), "MessageBus::Init");
+    auto ch = bus.CreateChannel<std::uint64_t>(MessagePhase::kFrameBegin);
+    Check(ch.status(), "MessageBus::CreateChannel");
+    channel = ch.value();
+    Check(bus.Subscribe(channel, &CountMessage, &received),
+          "MessageBus::Subscribe");
+  }
+};
+
+// Shared by every thread of a sample; the previous sample has fully
+// drained and joined before thread 0 resets the counter.
+void PublishDispatch(State& state, SharedBus* shared) {
+  const bool frame_thread = state.thread_index() == 0;
+  if (frame_thread) {
+    shared->producers_done.store(0);
+  }
+  MessageBatch batch(&shared->bus);
+  state.SetItemsPerIteration(kBatchMessages);
+  while (state.KeepRunning()) {
+    for (std::uint64_t i = 0; i < kBatchMessages; ++i) {
+      while (!batch.Push(shared->channel, i)) {
+        if (frame_thread) {
+          shared->bus.Dispatch(MessagePhase::kFrameBegin);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    }
+    batch.Flush();
+    if (frame_thread) {
+      shared->bus.Dispatch(MessagePhase::kFrameBegin);
+    }
+  }
+
+  if (frame_thread) {
+    while (shared->producers_done.load() + 1 < state.threads()) {
+      shared->bus.Dispatch(MessagePhase::kFrameBegin);
+    }
+    shared->bus.Dispatch(MessagePhase::kFrameBegin);
+    DoNotOptimize(shared->received);
+  } else {
+    shared->producers_done.fetch_add(1);
+  }
+}
+
+void BM_MessageBusPublishDispatch(State& state) {
+  static SharedBus shared;
+  PublishDispatch(state, &shared);
+}
+
+void BM_MessageBusPublishDispatchContended(State& state) {
+  static SharedBus shared;
+  PublishDispatch(state, &shared);
+}
+
+}  // namespace
+
+NAVARY_BENCH("messaging/MessageBus::Publish+Dispatch/batch",
+             BM_MessageBusPublishDispatch);
+NAVARY_BENCH_THREADS("messaging/MessageBus::Publish+Dispatch/batch/threads:4",
+                     BM_MessageBusPublishDispatchContended, 4);
@@ -0,0 +1,123 @@
+// Navary Engine - Benchmark Suite
+// File: bench/nav_bench.cc
+// Purpose: NavService solving a batch of 1024 long paths across a 64x64
+//          comb mesh in one Update(), serial and over the JobSystem.
+//
+// Notes:
+//   - The cache is off, so every request runs a full search and spline.
+//   - Items are paths; requests are issued and released inside the timed
+//     loop, as a game would each frame.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+#include <vector>
+
+#include "bench.h"
+#include "navary/core/scheduler/job_system.h"
+#include "navary/nav/nav_service.h"
+
+namespace {
+
+using navary::bench::Check;
+using navary::bench::DoNotOptimize;
+using navary::bench::SharedJobSystem;
+using navary::bench::State;
+using navary::core::scheduler::JobSystem;
+using navary::math::Vec3;
+using navary::nav::kInvalidNavPoly;
+using navary::nav::NavMesh;
+using navary::nav::NavMeshDesc;
+using navary::nav::NavPathId;
+using navary::nav::NavPathRequest;
+using navary::nav::NavService;
+using navary::nav::NavServiceDesc;
+
+constexpr std::uint32_t kGrid  = 64;
+constexpr std::uint32_t kPaths = 1024;
+
+// kGrid x kGrid unit quads; every fourth row is a wall with one gap that
+// alternates sides, so crossing the mesh means a long zig-zag.
+struct CombMesh {
+  std::vector<Vec3> vertices;
+  std::vector<std::uint32_t> polys;
+  NavMesh mesh;
+
+  CombMesh() {
+    for (std::uint32_t z = 0; z <= kGrid; ++z) {
+      for (std::uint32_t x = 0; x <= kGrid; ++x) {
+        vertices.emplace_back(static_cast<float>(x), 0.0f,
+                              static_cast<float>(z));
+      }
+    }
+    std::uint32_t count = 0;
+    for (std::uint32_t z = 0; z < kGrid; ++z) {
+      const bool wall   = z % 4 == 3;
+      const bool gap_hi = (z / 4) % 2 == 0;
+      for (std::uint32_t x = 0; x < kGrid; ++x) {
+        if (wall && (gap_hi ? x != kGrid - 1 : x != 0)) {
+          continue;
+        }
+        const std::uint32_t v0 = z * (kGrid + 1) + x;
+        polys.insert(polys.end(), {v0, v0 + 1, v0 + kGrid + 2, v0 + kGrid + 1,
+                                   kInvalidNavPoly, kInvalidNavPoly});
+        ++count;
+      }
+    }
+    NavMeshDesc desc;
+    desc.vertices     = vertices.data();
+    desc.vertex_count = static_cast<std::uint32_t>(vertices.size());
+    desc.polys        = polys.data();
+    desc.poly_count   = count;
+    Check(mesh.Init(desc), "NavMesh::Init");
+  }
+};
+
+void SolveBatch(State& state, JobSystem* jobs) {
+  static CombMesh comb;
+  NavServiceDesc desc;
+  desc.max_requests            = kPaths;
+  desc.max_requests_per_update = kPaths;
+  desc.max_path_polys          = 2048;
+  desc.iterations_per_request  = 1 << 20;
+  desc.cache_capacity          = 0;
+  NavService service;
+  Check(service.Init(desc, &comb.mesh, jobs), "NavService::Init");
+
+  std::vector<NavPathRequest> requests(kPaths);
+  for (std::uint32_t i = 0; i < kPaths; ++i) {
+    NavPathRequest& r = requests[i];
+    r.start = Vec3(0.5f + static_cast<float>(i % kGrid), 0.0f,
+                   0.5f + static_cast<float>(i % 3));
+    r.end   = Vec3(0.5f + static_cast<float>((i * 29) % kGrid), 0.0f,
+                   kGrid - 3.5f + static_cast<float>(i % 3));
+  }
+  std::vector<NavPathId> ids(kPaths);
+
+  state.SetItemsPerIteration(kPaths);
+  while (state.KeepRunning()) {
+    for (std::uint32_t i = 0; i < kPaths; ++i) {
+      ids[i] = service.RequestPath(requests[i]).value();
+    }
+    service.Update();
+    for (const NavPathId id : ids) {
+      service.Release(id);
+    }
+  }
+  DoNotOptimize(service.stats().completed);
+  service.Shutdown();
+}
+
+void BM_NavSolveSerial(State& state) {
+  SolveBatch(state, nullptr);
+}
+
+void BM_NavSolveJobs(State& state) {
+  SolveBatch(state, &SharedJobSystem());
+}
+
+}  // namespace
+
+NAVARY_BENCH("nav/NavService::Update/1024-paths/serial", BM_NavSolveSerial);
+NAVARY_BENCH("nav/NavService::Update/1024-paths/jobs", BM_NavSolveJobs);
@@ -0,0 +1,133 @@
+// Navary Engine - Benchmark Suite
+// File: bench/net_bench.cc
+// Purpose: SnapshotCodec encode / decode of a 1000-entity world, full and
+//          delta against the previous tick with a quarter of the entities
+//          moving.
+//
+// Notes:
+//   - Items are entities. Packet sizes are covered by the unit tests; this
+//     file only times the codec.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+#include <vector>
+
+#include "bench.h"
+#include "navary/net/snapshot_codec.h"
+
+namespace {
+
+using navary::bench::Check;
+using navary::bench::ClobberMemory;
+using navary::bench::DoNotOptimize;
+using navary::bench::State;
+using navary::net::BitReader;
+using navary::net::BitWriter;
+using navary::net::NetEntityState;
+using navary::net::QuantizedEntityState;
+using navary::net::QuantizedSnapshot;
+using navary::net::SnapshotCodec;
+using F = navary::math::Fixed15p16;
+
+constexpr std::uint32_t kEntities = 1000;
+
+navary::net::SnapshotSchema Schema() {
+  navary::net::SnapshotSchema s;
+  s.position = navary::net::FixedRange{F::FromInt(-4096), F::FromInt(4096),
+                                       20};
+  s.velocity = navary::net::FixedRange{F::FromInt(-64), F::FromInt(64), 14};
+  return s;
+}
+
+// Tick 1 is the baseline, tick 2 moves every fourth entity a little.
+struct World {
+  SnapshotCodec codec{Schema()};
+  std::vector<QuantizedEntityState> base_entities;
+  std::vector<QuantizedEntityState> cur_entities;
+  std::vector<QuantizedEntityState> out_entities;
+  QuantizedSnapshot base;
+  QuantizedSnapshot current;
+  QuantizedSnapshot decoded;
+  std::vector<std::uint8_t> packet;
+
+  World()
+      : base_entities(kEntities),
+        cur_entities(kEntities),
+        out_entities(kEntities),
+        base{1, base_entities.data(), kEntities, kEntities},
+        current{2, cur_entities.data(), kEntities, kEntities},
+        decoded{0, out_entities.data(), 0, kEntities},
+        packet(64 * 1024) {
+    for (std::uint32_t i = 0; i < kEntities; ++i) {
+      NetEntityState e;
+      e.id       = i * 2 + 10;
+      e.position = navary::math::FixedVec3(
+          F::FromInt(static_cast<int>(e.id) * 3), F::FromInt(0),
+          F::FromInt(-static_cast<int>(e.id)));
+      e.rotation = navary::math::FixedQuat(F::FromInt(0), F::FromInt(0),
+                                           F::FromInt(0), F::FromInt(1));
+      e.velocity = navary::math::FixedVec3(F::FromInt(1), F::FromInt(0),
+                                           F::FromInt(0));
+      e.flags    = e.id & 0xF;
+      codec.Quantize(e, &base_entities[i]);
+      if (i % 4 == 0) {
+        e.position.x = e.position.x + F::FromFloat(0.05f);
+        e.position.z = e.position.z - F::FromFloat(0.05f);
+      }
+      codec.Quantize(e, &cur_entities[i]);
+    }
+  }
+
+  std::size_t Encode(const QuantizedSnapshot* baseline) {
+    BitWriter w(navary::memory::Span<std::uint8_t>(packet.data(),
+                                                   packet.size()));
+    Check(codec.Write(current, baseline, &w), "SnapshotCodec::Write");
+    return w.Finish();
+  }
+};
+
+void Write(State& state, bool delta) {
+  World world;
+  const QuantizedSnapshot* baseline = delta ? &world.base : nullptr;
+  state.SetItemsPerIteration(kEntities);
+  while (state.KeepRunning()) {
+    DoNotOptimize(world.Encode(baseline));
+    ClobberMemory();
+  }
+}
+
+void Read(State& state, bool delta) {
+  World world;
+  const QuantizedSnapshot* baseline = delta ? &world.base : nullptr;
+  const std::size_t bytes           = world.Encode(baseline);
+  state.SetItemsPerIteration(kEntities);
+  while (state.KeepRunning()) {
+    BitReader r(navary::memory::Span<const std::uint8_t>(world.packet.data(),
+                                                         bytes));
+    Check(world.codec.Read(&r, baseline, &world.decoded),
+          "SnapshotCodec::Read");
+    ClobberMemory();
+  }
+}
+
+void BM_SnapshotWriteFull(State& state) {
+  Write(state, false);
+}
+void BM_SnapshotWriteDelta(State& state) {
+  Write(state, true);
+}
+void BM_SnapshotReadFull(State& state) {
+  Read(state, false);
+}
+void BM_SnapshotReadDelta(State& state) {
+  Read(state, true);
+}
+
+}  // namespace
+
+NAVARY_BENCH("net/SnapshotCodec::Write/full/1000", BM_SnapshotWriteFull);
+NAVARY_BENCH("net/SnapshotCodec::Write/delta/1000", BM_SnapshotWriteDelta);
+NAVARY_BENCH("net/SnapshotCodec::Read/full/1000", BM_SnapshotReadFull);
+NAVARY_BENCH("net/SnapshotCodec::Read/delta/1000", BM_SnapshotReadDelta);
@@ -0,0 +1,89 @@
+// Navary Engine - Benchmark Suite
+// File: bench/spatial_bench.cc
+// Purpose: SpatialHashGrid crowd tick: rebuild plus 8-nearest neighbor
+//          update for 10k agents on a plane, serial and over the JobSystem.
+//
+// Notes:
+//   - Agents sit in a 200 m square (about one per 2 m cell) and shuffle
+//     back and forth by 1 cm each iteration, so every tick re-sorts.
+//   - Items are agents.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+#include <vector>
+
+#include "bench.h"
+#include "navary/core/scheduler/job_system.h"
+#include "navary/spatial/spatial_hash_grid.h"
+
+namespace {
+
+using navary::bench::Check;
+using navary::bench::ClobberMemory;
+using navary::bench::SharedJobSystem;
+using navary::bench::State;
+using navary::core::scheduler::JobSystem;
+using navary::math::Vec3;
+using navary::spatial::FloatSpatialHashGrid;
+
+constexpr std::uint32_t kAgents    = 10000;
+constexpr std::uint32_t kNeighbors = 8;
+
+std::vector<Vec3> Crowd() {
+  std::uint32_t s = 1;
+  auto next       = [&s] {
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return -100.0f + 200.0f * static_cast<float>(s & 0xFFFFFF) / 16777216.0f;
+  };
+  std::vector<Vec3> points(kAgents);
+  for (Vec3& p : points) {
+    p.x = next();
+    p.y = 0.0f;
+    p.z = next();
+  }
+  return points;
+}
+
+void CrowdTick(State& state, JobSystem* jobs) {
+  std::vector<Vec3> points = Crowd();
+  FloatSpatialHashGrid grid;
+  FloatSpatialHashGrid::Desc desc;
+  desc.max_points = kAgents;
+  desc.cell_size  = 2.0f;
+  desc.planar     = true;
+  Check(grid.Init(desc), "SpatialHashGrid::Init");
+  std::vector<std::uint32_t> ids(kAgents * kNeighbors);
+  std::vector<std::uint32_t> counts(kAgents);
+
+  float step = 0.01f;
+  state.SetItemsPerIteration(kAgents);
+  while (state.KeepRunning()) {
+    for (Vec3& p : points) {
+      p.x += step;
+    }
+    step = -step;
+    Check(grid.Rebuild(points.data(), kAgents, jobs),
+          "SpatialHashGrid::Rebuild");
+    grid.UpdateNeighbors(2.0f, kNeighbors, ids.data(), counts.data(), jobs);
+    ClobberMemory();
+  }
+}
+
+void BM_CrowdTickSerial(State& state) {
+  CrowdTick(state, nullptr);
+}
+
+void BM_CrowdTickJobs(State& state) {
+  CrowdTick(state, &SharedJobSystem());
+}
+
+}  // namespace
+
+NAVARY_BENCH("spatial/SpatialHashGrid::Rebuild+UpdateNeighbors/10k/serial",
+             BM_CrowdTickSerial);
+NAVARY_BENCH("spatial/SpatialHashGrid::Rebuild+UpdateNeighbors/10k/jobs",
+             BM_CrowdTickJobs);
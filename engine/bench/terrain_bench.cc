@@ -0,0 +1,173 @@
+// Navary Engine - Benchmark Suite
+// File: bench/terrain_bench.cc
+// Purpose: HeightfieldTerrain per-frame LOD selection on a 2 km and a
+//          4 km map, and the batched height / ray queries gameplay uses.
+//
+// Notes:
+//   - Maps are written to the temp directory once per process (the 4 km
+//     one is ~46 MB) and the camera is settled until no tile is loading,
+//     so iterations time selection and stitching only, not IO.
+//   - Update items are visited nodes. Both maps reach past the 1.5 km
+//     far plane, so they should report about the same ns/op: the cut
+//     follows the view, not the map area.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench.h"
+#include "navary/io/async_io.h"
+#include "navary/math/frustum.h"
+#include "navary/math/mat4.h"
+#include "navary/terrain/heightfield_terrain.h"
+#include "navary/terrain/terrain_writer.h"
+
+namespace {
+
+using navary::bench::ClobberMemory;
+using navary::bench::DoNotOptimize;
+using navary::bench::State;
+using navary::math::Frustum;
+using navary::math::Mat4;
+using navary::math::Vec3;
+using navary::terrain::HeightfieldTerrain;
+using navary::terrain::TerrainRayHit;
+using navary::terrain::TerrainView;
+
+constexpr std::uint32_t kTileQuads = 64;
+
+float Hills(float x, float z) {
+  return 40.0f * std::sin(x * 0.011f) * std::cos(z * 0.013f) +
+         6.0f * std::sin(x * 0.07f + z * 0.05f) +
+         1.5f * std::sin(x * 0.31f - z * 0.23f);
+}
+
+const std::string& MapPath(std::uint32_t depth) {
+  static std::string paths[navary::terrain::kTerrainMaxDepth + 1];
+  if (paths[depth].empty()) {
+    const std::uint32_t n = (kTileQuads << depth) + 1;
+    std::vector<float> h(std::size_t{n} * n);
+    for (std::uint32_t z = 0; z < n; ++z) {
+      for (std::uint32_t x = 0; x < n; ++x) {
+        h[std::size_t{z} * n + x] =
+            Hills(static_cast<float>(x), static_cast<float>(z));
+      }
+    }
+    const std::string path =
+        (std::filesystem::temp_directory_path() /
+         ("navary_bench_" + std::to_string(depth) + ".nvtr"))
+            .string();
+    navary::terrain::TerrainBuildOptions options;
+    options.tile_quads = kTileQuads;
+    navary::terrain::WriteTerrainFile(path.c_str(), h.data(), n, options);
+    paths[depth] = path;
+  }
+  return paths[depth];
+}
+
+struct Scene {
+  navary::io::AsyncIo io;
+  HeightfieldTerrain terrain;
+  Frustum frustum;
+  TerrainView view;
+
+  explicit Scene(std::uint32_t depth) {
+    navary::io::AsyncIoDesc io_desc;
+    io_desc.backend = navary::io::AsyncIoBackendKind::kThreadPool;
+    io.Init(io_desc);
+    HeightfieldTerrain::Desc desc;
+    desc.path               = MapPath(depth).c_str();
+    desc.async_io           = &io;
+    desc.max_resident_tiles = 512;
+    terrain.Init(desc);
+
+    // Standing 300 m into the map, looking diagonally across it.
+    const Vec3 eye(300.0f, Hills(300.0f, 300.0f) + 2.0f, 300.0f);
+    const Mat4 view_m = Mat4::RotationY(-2.356f) *
+                        Mat4::Translation(Vec3(-eye.x, -eye.y, -eye.z));
+    frustum = Frustum::FromCameraPerspectiveRH(1.0472f, 16.0f / 9.0f, 0.1f,
+                                               1500.0f, view_m);
+    view.eye     = eye;
+    view.frustum = &frustum;
+    for (int quiet = 0, i = 0; quiet < 2 && i < 5000; ++i) {
+      const std::uint64_t started = terrain.cache().stats().loads_started;
+      terrain.Update(view);
+      const bool idle = terrain.cache().loads_in_flight() == 0 &&
+                        terrain.cache().stats().loads_started == started;
+      quiet = idle ? quiet + 1 : 0;
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+  }
+};
+
+void SelectLod(State& state, std::uint32_t depth) {
+  Scene scene(depth);
+  scene.terrain.Update(scene.view);
+  state.SetItemsPerIteration(scene.terrain.nodes_visited());
+  while (state.KeepRunning()) {
+    DoNotOptimize(scene.terrain.Update(scene.view));
+    ClobberMemory();
+  }
+}
+
+void BM_TerrainUpdateSmall(State& state) {
+  SelectLod(state, 5);  // 2048 m, 1365 nodes
+}
+
+void BM_TerrainUpdateLarge(State& state) {
+  SelectLod(state, 6);  // 4096 m, 5461 nodes
+}
+
+void BM_TerrainHeightsAt(State& state) {
+  Scene scene(6);
+  // 4096 agents' feet within 64 m of the camera.
+  constexpr std::uint32_t kPoints = 4096;
+  std::vector<float> xs(kPoints);
+  std::vector<float> zs(kPoints);
+  std::vector<float> out(kPoints);
+  for (std::uint32_t i = 0; i < kPoints; ++i) {
+    xs[i] = 268.0f + static_cast<float>(i % 64);
+    zs[i] = 268.0f + static_cast<float>(i / 64) + 0.37f;
+  }
+  state.SetItemsPerIteration(kPoints);
+  while (state.KeepRunning()) {
+    scene.terrain.HeightsAt(xs.data(), zs.data(), kPoints, out.data());
+    ClobberMemory();
+  }
+  DoNotOptimize(out[kPoints / 2]);
+}
+
+void BM_TerrainRaycast(State& state) {
+  Scene scene(6);
+  // Shots from head height fanning out 10..25 degrees below the horizon.
+  constexpr std::uint32_t kRays = 256;
+  std::vector<Vec3> dirs(kRays);
+  for (std::uint32_t i = 0; i < kRays; ++i) {
+    const float yaw   = 0.0245f * static_cast<float>(i);
+    const float pitch = -0.17f - 0.26f * static_cast<float>(i % 16) / 15.0f;
+    dirs[i] = Vec3(std::cos(yaw) * std::cos(pitch), std::sin(pitch),
+                   std::sin(yaw) * std::cos(pitch));
+  }
+  TerrainRayHit hit{};
+  state.SetItemsPerIteration(kRays);
+  while (state.KeepRunning()) {
+    for (const Vec3& d : dirs) {
+      DoNotOptimize(scene.terrain.Raycast(scene.view.eye, d, 500.0f, &hit));
+    }
+    ClobberMemory();
+  }
+}
+
+}  // namespace
+
+NAVARY_BENCH("terrain/HeightfieldTerrain::Update/2048m", BM_TerrainUpdateSmall);
+NAVARY_BENCH("terrain/HeightfieldTerrain::Update/4096m", BM_TerrainUpdateLarge);
+NAVARY_BENCH("terrain/HeightfieldTerrain::HeightsAt/4096", BM_TerrainHeightsAt);
+NAVARY_BENCH("terrain/HeightfieldTerrain::Raycast/256", BM_TerrainRaycast);
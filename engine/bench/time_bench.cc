@@ -0,0 +1,51 @@
+// Navary Engine - Benchmark Suite
+// File: bench/time_bench.cc
+// Purpose: Clock reads (the cost every profiler zone pays twice) and the
+//          fixed-step tick clock.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <chrono>
+#include <cstdint>
+
+#include "bench.h"
+#include "navary/core/time/monotonic_clock.h"
+#include "navary/core/time/tick_clock.h"
+
+namespace {
+
+using navary::bench::DoNotOptimize;
+using navary::bench::State;
+namespace nt = navary::core::time;
+
+void BM_MonotonicNowNs(State& state) {
+  while (state.KeepRunning()) {
+    DoNotOptimize(nt::MonotonicNowNs());
+  }
+}
+
+// Reference point for MonotonicNowNs overhead.
+void BM_SteadyClockNow(State& state) {
+  while (state.KeepRunning()) {
+    DoNotOptimize(std::chrono::steady_clock::now());
+  }
+}
+
+// Synthetic 144 Hz frames against a 60 Hz simulation.
+void BM_FixedTickClockFrame(State& state) {
+  nt::FixedTickClock clock(60.0);
+  clock.Reset(0);
+  std::uint64_t now = 0;
+  while (state.KeepRunning()) {
+    now += 6'944'444;
+    DoNotOptimize(clock.BeginFrame(now));
+    clock.EndFrame();
+  }
+}
+
+}  // namespace
+
+NAVARY_BENCH("time/MonotonicNowNs", BM_MonotonicNowNs);
+NAVARY_BENCH("time/std::chrono::steady_clock::now", BM_SteadyClockNow);
+NAVARY_BENCH("time/FixedTickClock::BeginFrame", BM_FixedTickClockFrame);
@@ -0,0 +1,599 @@
+// Navary Engine - Audio Subsystem
+// File: navary/audio/audio_mixer.cc
+// Purpose: AudioMixer command handling, virtualization and block mixing.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/audio/audio_mixer.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <new>  // std::nothrow
+
+#include "navary/audio/mix_kernels.h"
+
+namespace navary::audio {
+
+namespace {
+
+constexpr float kMinPitch         = 1.0f / 16.0f;
+constexpr float kMaxStep          = 4.0f;  // source frames per output frame
+constexpr std::uint32_t kMaxCarry = 4;
+constexpr float kQuarterPi        = 0.78539816f;
+
+// Source frames a block of |frames| at |step| reads past the window start.
+std::uint32_t WindowFrames(float pos, float step, std::uint32_t frames) {
+  return static_cast<std::uint32_t>(
+             pos + static_cast<float>(frames - 1) * step) +
+         2;
+}
+
+float Clamp(float v, float lo, float hi) {
+  return v < lo ? lo : (v > hi ? hi : v);
+}
+
+}  // namespace
+
+struct AudioMixer::Voice {
+  const AudioClip* clip;
+  AudioStream* stream;
+  VoiceParams params;
+  // Clips: source frame position. Streams: position inside the window,
+  // whose first carry_count frames are left over from the last block.
+  double pos;
+  float carry[2][kMaxCarry];
+  std::uint32_t carry_count;
+  float gain[2];    // reached at the end of the last mixed block
+  float target[2];  // for this block
+  float audibility;
+  bool active;
+  bool fresh;     // first block: start at the target, no fade in
+  bool stopping;  // fade out over one block, then finish
+  bool was_real;
+};
+
+AudioMixer::AudioMixer()
+    : sample_rate_(0),
+      max_voices_(0),
+      max_real_(0),
+      block_frames_(0),
+      free_slots_(nullptr),
+      free_count_(0),
+      generation_(nullptr),
+      slot_busy_(nullptr),
+      voices_(nullptr),
+      active_(nullptr),
+      active_count_(0),
+      rank_(nullptr),
+      window_{nullptr, nullptr},
+      resampled_{nullptr, nullptr},
+      bus_{nullptr, nullptr},
+      interleaved_(nullptr),
+      listener_pos_(0.0f, 0.0f, 0.0f),
+      listener_right_(1.0f, 0.0f, 0.0f),
+      last_real_(0),
+      last_virtual_(0) {}
+
+AudioMixer::~AudioMixer() {
+  Shutdown();
+}
+
+NavaryRC AudioMixer::Init(const Desc& desc) {
+  if (voices_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "AudioMixer: already initialized");
+  }
+  if (desc.sample_rate == 0 || desc.max_voices == 0 ||
+      desc.max_voices > 0xFFFFu || desc.max_block_frames == 0 ||
+      desc.command_capacity == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "AudioMixer: invalid descriptor");
+  }
+
+  const std::uint32_t n     = desc.max_voices;
+  const std::uint32_t block = desc.max_block_frames;
+  // Window: the stream carry, then up to block * kMaxStep + 2 frames.
+  const std::size_t window =
+      static_cast<std::size_t>(block) * static_cast<std::size_t>(kMaxStep) +
+      kMaxCarry + 4;
+  const std::size_t interleaved = std::max<std::size_t>(2 * window, 2 * block);
+
+  voices_      = new (std::nothrow) Voice[n];
+  free_slots_  = static_cast<std::uint16_t*>(
+      std::malloc(sizeof(std::uint16_t) * n));
+  generation_  = static_cast<std::uint16_t*>(
+      std::malloc(sizeof(std::uint16_t) * n));
+  slot_busy_   = static_cast<bool*>(std::malloc(sizeof(bool) * n));
+  active_      = static_cast<std::uint16_t*>(
+      std::malloc(sizeof(std::uint16_t) * n));
+  rank_        = static_cast<std::uint64_t*>(
+      std::malloc(sizeof(std::uint64_t) * n));
+  interleaved_ = static_cast<float*>(std::malloc(sizeof(float) * interleaved));
+  bool ok = voices_ != nullptr && free_slots_ != nullptr &&
+            generation_ != nullptr && slot_busy_ != nullptr &&
+            active_ != nullptr && rank_ != nullptr && interleaved_ != nullptr;
+  for (int c = 0; c < 2; ++c) {
+    window_[c]    = static_cast<float*>(std::malloc(sizeof(float) * window));
+    resampled_[c] = static_cast<float*>(std::malloc(sizeof(float) * block));
+    bus_[c]       = static_cast<float*>(std::malloc(sizeof(float) * block));
+    ok = ok && window_[c] != nullptr && resampled_[c] != nullptr &&
+         bus_[c] != nullptr;
+  }
+  if (!ok) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kOutOfMemory, "AudioMixer: alloc failed");
+  }
+  NavaryRC rc = commands_.Init(desc.command_capacity);
+  if (rc.ok()) {
+    rc = done_.Init(n);
+  }
+  if (!rc.ok()) {
+    Shutdown();
+    return rc;
+  }
+
+  for (std::uint32_t i = 0; i < n; ++i) {
+    free_slots_[i] = static_cast<std::uint16_t>(n - 1 - i);  // pop 0 first
+    generation_[i] = 1;
+    slot_busy_[i]  = false;
+    voices_[i]     = Voice{};
+  }
+  sample_rate_    = desc.sample_rate;
+  max_voices_     = n;
+  max_real_       = std::min(desc.max_real_voices, n);
+  block_frames_   = block;
+  free_count_     = n;
+  active_count_   = 0;
+  listener_pos_   = math::Vec3(0.0f, 0.0f, 0.0f);
+  listener_right_ = math::Vec3(1.0f, 0.0f, 0.0f);
+  last_real_      = 0;
+  last_virtual_   = 0;
+  return NavaryRC::OK();
+}
+
+void AudioMixer::Shutdown() {
+  commands_.Shutdown();
+  done_.Shutdown();
+  delete[] voices_;
+  std::free(free_slots_);
+  std::free(generation_);
+  std::free(slot_busy_);
+  std::free(active_);
+  std::free(rank_);
+  std::free(interleaved_);
+  for (int c = 0; c < 2; ++c) {
+    std::free(window_[c]);
+    std::free(resampled_[c]);
+    std::free(bus_[c]);
+    window_[c]    = nullptr;
+    resampled_[c] = nullptr;
+    bus_[c]       = nullptr;
+  }
+  voices_       = nullptr;
+  free_slots_   = nullptr;
+  generation_   = nullptr;
+  slot_busy_    = nullptr;
+  active_       = nullptr;
+  rank_         = nullptr;
+  interleaved_  = nullptr;
+  max_voices_   = 0;
+  free_count_   = 0;
+  active_count_ = 0;
+}
+
+// ---------------------------------------------------------------------------
+// Game thread
+// ---------------------------------------------------------------------------
+
+int AudioMixer::SlotOf(VoiceHandle voice) const {
+  const std::uint32_t slot = voice.id & 0xFFFFu;
+  const std::uint32_t gen  = voice.id >> 16;
+  if (slot >= max_voices_ || generation_[slot] != gen || !slot_busy_[slot]) {
+    return -1;
+  }
+  return static_cast<int>(slot);
+}
+
+VoiceHandle AudioMixer::Start(const AudioClip* clip, AudioStream* stream,
+                              const VoiceParams& params) {
+  if (free_count_ == 0) {
+    return kInvalidVoice;
+  }
+  const std::uint16_t slot = free_slots_[free_count_ - 1];
+  Command cmd{};
+  cmd.type   = clip != nullptr ? CommandType::kPlayClip
+                               : CommandType::kPlayStream;
+  cmd.slot   = slot;
+  cmd.clip   = clip;
+  cmd.stream = stream;
+  cmd.params = params;
+  if (!commands_.TryPush(cmd)) {
+    return kInvalidVoice;
+  }
+  --free_count_;
+  slot_busy_[slot] = true;
+  return VoiceHandle{(static_cast<std::uint32_t>(generation_[slot]) << 16) |
+                     slot};
+}
+
+VoiceHandle AudioMixer::Play(const AudioClip* clip,
+                             const VoiceParams& params) {
+  if (clip == nullptr || clip->samples() == nullptr) {
+    return kInvalidVoice;
+  }
+  return Start(clip, nullptr, params);
+}
+
+VoiceHandle AudioMixer::PlayStream(AudioStream* stream,
+                                   const VoiceParams& params) {
+  if (stream == nullptr || stream->channels() == 0) {
+    return kInvalidVoice;
+  }
+  return Start(nullptr, stream, params);
+}
+
+bool AudioMixer::Send(VoiceHandle voice, Command cmd) {
+  const int slot = SlotOf(voice);
+  if (slot < 0) {
+    return false;
+  }
+  cmd.slot = static_cast<std::uint16_t>(slot);
+  return commands_.TryPush(cmd);
+}
+
+bool AudioMixer::Stop(VoiceHandle voice) {
+  Command cmd{};
+  cmd.type = CommandType::kStop;
+  return Send(voice, cmd);
+}
+
+bool AudioMixer::SetPosition(VoiceHandle voice, const math::Vec3& position) {
+  Command cmd{};
+  cmd.type = CommandType::kSetPosition;
+  cmd.v0   = position;
+  return Send(voice, cmd);
+}
+
+bool AudioMixer::SetVolume(VoiceHandle voice, float volume) {
+  Command cmd{};
+  cmd.type = CommandType::kSetVolume;
+  cmd.f    = volume;
+  return Send(voice, cmd);
+}
+
+bool AudioMixer::SetPitch(VoiceHandle voice, float pitch) {
+  Command cmd{};
+  cmd.type = CommandType::kSetPitch;
+  cmd.f    = pitch;
+  return Send(voice, cmd);
+}
+
+bool AudioMixer::SetListener(const math::Vec3& position,
+                             const math::Vec3& forward,
+                             const math::Vec3& up) {
+  if (voices_ == nullptr) {
+    return false;
+  }
+  Command cmd{};
+  cmd.type = CommandType::kSetListener;
+  cmd.v0   = position;
+  cmd.v1   = forward;
+  cmd.v2   = up;
+  return commands_.TryPush(cmd);
+}
+
+void AudioMixer::Update() {
+  if (voices_ == nullptr) {
+    return;
+  }
+  std::uint16_t slot;
+  while (done_.TryPop(&slot)) {
+    slot_busy_[slot] = false;
+    if (++generation_[slot] == 0) {
+      generation_[slot] = 1;  // keep handle ids non-zero
+    }
+    free_slots_[free_count_++] = slot;
+  }
+}
+
+bool AudioMixer::IsPlaying(VoiceHandle voice) const {
+  return voices_ != nullptr && SlotOf(voice) >= 0;
+}
+
+// ---------------------------------------------------------------------------
+// Mixer thread
+// ---------------------------------------------------------------------------
+
+void AudioMixer::ApplyCommands() {
+  Command cmd;
+  while (commands_.TryPop(&cmd)) {
+    Voice* v = &voices_[cmd.slot];
+    switch (cmd.type) {
+      case CommandType::kPlayClip:
+      case CommandType::kPlayStream:
+        *v          = Voice{};
+        v->clip     = cmd.clip;
+        v->stream   = cmd.stream;
+        v->params   = cmd.params;
+        v->active   = true;
+        v->fresh    = true;
+        active_[active_count_++] = cmd.slot;
+        break;
+      case CommandType::kStop:
+        v->stopping = v->active;
+        break;
+      case CommandType::kSetPosition:
+        v->params.position = cmd.v0;
+        break;
+      case CommandType::kSetVolume:
+        v->params.volume = cmd.f;
+        break;
+      case CommandType::kSetPitch:
+        v->params.pitch = cmd.f;
+        break;
+      case CommandType::kSetListener: {
+        listener_pos_          = cmd.v0;
+        const math::Vec3 right = cmd.v1.cross(cmd.v2);
+        if (right.length_sq() > 1e-12f) {
+          listener_right_ = right.normalized();
+        }
+        break;
+      }
+    }
+  }
+}
+
+void AudioMixer::ComputeTargetGains(Voice* v) const {
+  const VoiceParams& p = v->params;
+  const float volume   = p.volume > 0.0f ? p.volume : 0.0f;
+  const bool stereo_2d =
+      !p.spatial && (v->clip != nullptr ? v->clip->channels()
+                                        : v->stream->channels()) == 2;
+  float att = 1.0f;
+  float pan = Clamp(p.pan, -1.0f, 1.0f);
+  if (p.spatial) {
+    const math::Vec3 rel = p.position - listener_pos_;
+    const float d        = rel.length();
+    const float min_d    = p.min_distance > 1e-3f ? p.min_distance : 1e-3f;
+    att = min_d / (d > min_d ? d : min_d);
+    if (p.max_distance > min_d) {
+      att *= Clamp((p.max_distance - d) / (p.max_distance - min_d), 0.0f,
+                   1.0f);
+    } else if (d > min_d) {
+      att = 0.0f;
+    }
+    pan = d > 1e-4f ? Clamp(rel.dot(listener_right_) / d, -1.0f, 1.0f)
+                    : 0.0f;
+  }
+
+  v->audibility = volume * att;
+  if (stereo_2d) {
+    // Balance: attenuate the far side only.
+    v->target[0] = v->audibility * (pan > 0.0f ? 1.0f - pan : 1.0f);
+    v->target[1] = v->audibility * (pan < 0.0f ? 1.0f + pan : 1.0f);
+  } else {
+    const float theta = (pan + 1.0f) * kQuarterPi;  // equal power
+    v->target[0]      = v->audibility * std::cos(theta);
+    v->target[1]      = v->audibility * std::sin(theta);
+  }
+  if (v->stopping) {
+    v->target[0] = 0.0f;
+    v->target[1] = 0.0f;
+  }
+}
+
+bool AudioMixer::RenderVoice(Voice* v, std::uint32_t frames, bool real) {
+  const bool is_clip = v->clip != nullptr;
+  const std::uint32_t ch =
+      is_clip ? v->clip->channels() : v->stream->channels();
+  const std::uint32_t rate =
+      is_clip ? v->clip->sample_rate() : v->stream->sample_rate();
+  const float pitch = Clamp(v->params.pitch, kMinPitch, 4.0f);
+  const float step  = std::min(
+      pitch * static_cast<float>(rate) / static_cast<float>(sample_rate_),
+      kMaxStep);
+  const bool fold_to_mono = ch == 2 && v->params.spatial;
+  bool alive              = true;
+
+  const float* src[2] = {nullptr, nullptr};
+  float win_pos       = 0.0f;
+
+  if (is_clip) {
+    const AudioClip* clip     = v->clip;
+    const std::uint32_t total = clip->frame_count();
+    const auto base           = static_cast<std::uint32_t>(v->pos);
+    win_pos                   = static_cast<float>(v->pos - base);
+    if (real) {
+      const std::uint32_t need = WindowFrames(win_pos, step, frames);
+      const float* s           = clip->samples();
+      if (ch == 1 && base + need <= total) {
+        src[0] = s + base;  // in bounds: read the clip in place
+      } else {
+        for (std::uint32_t k = 0; k < need; ++k) {
+          std::uint32_t f = base + k;
+          if (f >= total) {
+            f = v->params.loop ? f % total : total;
+          }
+          for (std::uint32_t c = 0; c < ch; ++c) {
+            window_[c][k] = f < total ? s[f * ch + c] : 0.0f;
+          }
+        }
+        src[0] = window_[0];
+        src[1] = window_[1];
+      }
+    }
+    v->pos += static_cast<double>(step) * frames;
+    if (v->pos >= total) {
+      if (v->params.loop) {
+        v->pos = std::fmod(v->pos, static_cast<double>(total));
+      } else {
+        alive = false;
+      }
+    }
+  } else {
+    // Streams are consumed even while virtual, so playback stays in time.
+    win_pos                  = static_cast<float>(v->pos);
+    const std::uint32_t need = WindowFrames(win_pos, step, frames);
+    const std::uint32_t want = need - v->carry_count;
+    const std::uint32_t got  = v->stream->Read(interleaved_, want);
+    for (std::uint32_t c = 0; c < ch; ++c) {
+      float* w = window_[c];
+      for (std::uint32_t k = 0; k < v->carry_count; ++k) {
+        w[k] = v->carry[c][k];
+      }
+      for (std::uint32_t k = 0; k < got; ++k) {
+        w[v->carry_count + k] = interleaved_[k * ch + c];
+      }
+      for (std::uint32_t k = v->carry_count + got; k < need; ++k) {
+        w[k] = 0.0f;  // underrun or end of source
+      }
+    }
+    const float end     = win_pos + step * static_cast<float>(frames);
+    const auto consumed = static_cast<std::uint32_t>(end);
+    v->pos              = end - static_cast<float>(consumed);
+    v->carry_count      = need > consumed ? need - consumed : 0;
+    for (std::uint32_t c = 0; c < ch; ++c) {
+      for (std::uint32_t k = 0; k < v->carry_count; ++k) {
+        v->carry[c][k] = window_[c][consumed + k];
+      }
+    }
+    src[0] = window_[0];
+    src[1] = window_[1];
+    if (got < want && v->stream->finished()) {
+      alive = false;
+    }
+  }
+
+  if (!real) {
+    return alive;
+  }
+
+  const std::uint32_t need = WindowFrames(win_pos, step, frames);
+  if (fold_to_mono) {
+    if (src[0] != window_[0]) {
+      std::memcpy(window_[0], src[0], sizeof(float) * need);
+    }
+    for (std::uint32_t k = 0; k < need; ++k) {
+      window_[0][k] = 0.5f * (window_[0][k] + src[1][k]);
+    }
+    src[0] = window_[0];
+  }
+
+  ResampleLinear(src[0], win_pos, step, resampled_[0], frames);
+  const float* left  = resampled_[0];
+  const float* right = resampled_[0];
+  if (ch == 2 && !fold_to_mono) {
+    ResampleLinear(src[1], win_pos, step, resampled_[1], frames);
+    right = resampled_[1];
+  }
+  const float from_l = v->fresh ? v->target[0] : v->gain[0];
+  const float from_r = v->fresh ? v->target[1] : v->gain[1];
+  MixRamp(left, frames, from_l, v->target[0], bus_[0]);
+  MixRamp(right, frames, from_r, v->target[1], bus_[1]);
+  v->gain[0] = v->target[0];
+  v->gain[1] = v->target[1];
+  return alive;
+}
+
+void AudioMixer::FinishVoice(std::uint32_t slot) {
+  voices_[slot].active = false;
+  done_.TryPush(static_cast<std::uint16_t>(slot));  // sized for every slot
+}
+
+void AudioMixer::MixBlock(std::uint32_t frames) {
+  std::memset(bus_[0], 0, sizeof(float) * frames);
+  std::memset(bus_[1], 0, sizeof(float) * frames);
+
+  // Rank: priority, then audibility (non-negative float bits sort as
+  // integers), then slot. Descending; the first max_real_ are mixed.
+  for (std::uint32_t i = 0; i < active_count_; ++i) {
+    Voice* v = &voices_[active_[i]];
+    ComputeTargetGains(v);
+    rank_[i] = (static_cast<std::uint64_t>(v->params.priority) << 48) |
+               (static_cast<std::uint64_t>(
+                    std::bit_cast<std::uint32_t>(v->audibility))
+                << 16) |
+               active_[i];
+  }
+  const std::uint32_t real_cap = std::min(max_real_, active_count_);
+  if (active_count_ > real_cap) {
+    std::nth_element(rank_, rank_ + real_cap, rank_ + active_count_,
+                     std::greater<std::uint64_t>());
+  }
+
+  std::uint32_t real_count = 0;
+  std::uint32_t kept       = 0;
+  for (std::uint32_t i = 0; i < active_count_; ++i) {
+    const auto slot = static_cast<std::uint16_t>(rank_[i] & 0xFFFFu);
+    Voice* v        = &voices_[slot];
+    // A voice losing its real slot fades out over this block instead of
+    // cutting off; one coming back fades in from zero.
+    bool real = i < real_cap && v->audibility > 0.0f;
+    if (!real && v->was_real && !v->fresh) {
+      v->target[0] = 0.0f;
+      v->target[1] = 0.0f;
+      real         = true;
+    }
+    if (!real) {
+      v->gain[0] = 0.0f;
+      v->gain[1] = 0.0f;
+    }
+    real_count += real ? 1 : 0;
+
+    bool alive = true;
+    if (v->stopping && !real) {
+      alive = false;  // virtual: nothing to fade
+    } else {
+      alive = RenderVoice(v, frames, real) && !v->stopping;
+    }
+    v->was_real = real && (v->target[0] > 0.0f || v->target[1] > 0.0f);
+    v->fresh    = false;
+    if (alive) {
+      active_[kept++] = slot;
+    } else {
+      FinishVoice(slot);
+    }
+  }
+  active_count_ = kept;
+  last_real_    = real_count;
+  last_virtual_ = kept > real_count ? kept - real_count : 0;
+}
+
+void AudioMixer::Mix(float* out, std::uint32_t frames) {
+  if (voices_ == nullptr) {
+    std::memset(out, 0, sizeof(float) * 2 * frames);
+    return;
+  }
+  ApplyCommands();
+  while (frames > 0) {
+    const std::uint32_t n = std::min(frames, block_frames_);
+    MixBlock(n);
+    InterleaveStereo(bus_[0], bus_[1], n, out);
+    out += 2 * n;
+    frames -= n;
+  }
+}
+
+void AudioMixer::MixS16(std::int16_t* out, std::uint32_t frames) {
+  if (voices_ == nullptr) {
+    std::memset(out, 0, sizeof(std::int16_t) * 2 * frames);
+    return;
+  }
+  ApplyCommands();
+  while (frames > 0) {
+    const std::uint32_t n = std::min(frames, block_frames_);
+    MixBlock(n);
+    InterleaveStereo(bus_[0], bus_[1], n, interleaved_);
+    FloatToS16(interleaved_, 2 * n, out);
+    out += 2 * n;
+    frames -= n;
+  }
+}
+
+}  // namespace navary::audio
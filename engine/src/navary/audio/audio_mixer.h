@@ -0,0 +1,211 @@
+#pragma once
+// Navary Engine - Audio Subsystem
+// File: navary/audio/audio_mixer.h
+// Purpose: Software voice mixer: game-thread commands over a lock-free
+//          queue, priority / distance virtualization, SIMD resample and
+//          pan into a stereo float bus.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - Two threads. The game thread calls Play / Stop / Set* / Update; each
+//     call is a fixed-size command pushed into a wait-free SPSC queue. The
+//     mixer thread (the device callback, or a render loop when offline)
+//     calls Mix(), which drains the commands first. No locks on either
+//     side, no allocation after Init().
+//   - Voice slots are owned by the game thread. A finished or stopped
+//     voice is reported back over a second SPSC queue and its slot is
+//     recycled on the next Update(); handles carry a generation, so stale
+//     handles are ignored.
+//   - Each block, every playing voice gets an audibility (volume times
+//     distance attenuation from the listener). Voices are ranked by
+//     priority, then audibility; the top max_real_voices are mixed, the
+//     rest are virtual: they keep their play position but cost nothing
+//     beyond the bookkeeping. Inaudible voices are always virtual.
+//   - A real voice is resampled (linear, pitch and rate conversion in one
+//     step) and accumulated into the L / R bus with gains that ramp over
+//     the block. Spatial voices pan with an equal-power law from the
+//     listener's right vector; 2D voices use their pan value.
+//
+// Notes:
+//   - Output is always stereo at Desc::sample_rate. Sources are mono or
+//     stereo at any rate; spatial voices fold stereo sources to mono.
+//   - Attenuation: min_distance / max(d, min_distance), faded linearly to
+//     zero at max_distance.
+//   - Pitch is clamped to [1/16, 4].
+//   - Set* calls return false (dropped) when the command queue is full.
+//
+// Example:
+// ```cpp
+//   AudioMixer mixer;
+//   mixer.Init(AudioMixer::Desc{});
+//   VoiceParams p;
+//   p.position = muzzle;
+//   VoiceHandle v = mixer.Play(&gunshot, p);   // game thread
+//   ...
+//   mixer.Update();                            // game thread, per frame
+//   mixer.Mix(device_buffer, frames);          // audio thread
+// ```
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/audio/audio_source.h"
+#include "navary/math/vec3.h"
+#include "navary/messaging/spsc_queue.h"
+#include "navary/navary_status.h"
+
+namespace navary::audio {
+
+// Slot index in the low 16 bits, generation in the high 16; 0 is invalid.
+struct VoiceHandle {
+  std::uint32_t id;
+
+  bool valid() const {
+    return id != 0;
+  }
+};
+
+inline constexpr VoiceHandle kInvalidVoice{0};
+
+struct VoiceParams {
+  math::Vec3 position   = math::Vec3(0.0f, 0.0f, 0.0f);
+  float volume          = 1.0f;
+  float pitch           = 1.0f;
+  float pan             = 0.0f;  // 2D voices: -1 left .. 1 right
+  float min_distance    = 1.0f;
+  float max_distance    = 50.0f;
+  std::uint8_t priority = 128;  // higher wins a real voice
+  bool spatial          = true;
+  bool loop             = false;  // clips only; streams loop via Desc
+};
+
+class AudioMixer {
+ public:
+  struct Desc {
+    std::uint32_t sample_rate      = 48000;
+    std::uint32_t max_voices       = 256;  // playing, real + virtual
+    std::uint32_t max_real_voices  = 128;  // mixed per block
+    std::uint32_t max_block_frames = 512;  // larger Mix() calls are split
+    std::uint32_t command_capacity = 4096;
+  };
+
+  AudioMixer();
+  ~AudioMixer();
+
+  AudioMixer(const AudioMixer&)            = delete;
+  AudioMixer& operator=(const AudioMixer&) = delete;
+
+  NavaryRC Init(const Desc& desc);
+  void Shutdown();
+
+  // --- Game thread ---------------------------------------------------------
+
+  // kInvalidVoice when every slot is taken or the queue is full. |clip|
+  // must stay alive while the voice plays.
+  VoiceHandle Play(const AudioClip* clip, const VoiceParams& params);
+  // |stream| must not be played by another voice at the same time.
+  VoiceHandle PlayStream(AudioStream* stream, const VoiceParams& params);
+
+  bool Stop(VoiceHandle voice);
+  bool SetPosition(VoiceHandle voice, const math::Vec3& position);
+  bool SetVolume(VoiceHandle voice, float volume);
+  bool SetPitch(VoiceHandle voice, float pitch);
+  bool SetListener(const math::Vec3& position, const math::Vec3& forward,
+                   const math::Vec3& up);
+
+  // Recycles the slots of voices the mixer has finished. Once a frame.
+  void Update();
+
+  // True from Play() until the mixer reports the voice done and Update()
+  // has seen it.
+  bool IsPlaying(VoiceHandle voice) const;
+
+  // --- Mixer thread --------------------------------------------------------
+
+  // Renders |frames| interleaved stereo frames.
+  void Mix(float* out, std::uint32_t frames);
+  // Same, as interleaved int16.
+  void MixS16(std::int16_t* out, std::uint32_t frames);
+
+  // Counts from the last mixed block.
+  std::uint32_t real_voice_count() const {
+    return last_real_;
+  }
+  std::uint32_t virtual_voice_count() const {
+    return last_virtual_;
+  }
+
+  std::uint32_t sample_rate() const {
+    return sample_rate_;
+  }
+
+ private:
+  enum class CommandType : std::uint8_t {
+    kPlayClip,
+    kPlayStream,
+    kStop,
+    kSetPosition,
+    kSetVolume,
+    kSetPitch,
+    kSetListener,
+  };
+
+  struct Command {
+    CommandType type;
+    std::uint16_t slot;
+    const AudioClip* clip;
+    AudioStream* stream;
+    VoiceParams params;  // kPlay*
+    math::Vec3 v0;       // position / listener position
+    math::Vec3 v1;       // listener forward
+    math::Vec3 v2;       // listener up
+    float f;             // volume / pitch
+  };
+
+  struct Voice;
+
+  VoiceHandle Start(const AudioClip* clip, AudioStream* stream,
+                    const VoiceParams& params);
+  bool Send(VoiceHandle voice, Command cmd);
+  int SlotOf(VoiceHandle voice) const;
+
+  void ApplyCommands();
+  void MixBlock(std::uint32_t frames);
+  void ComputeTargetGains(Voice* v) const;
+  // Fills the planar source window of |v|, resamples and advances it.
+  // Returns false when the voice reached its end.
+  bool RenderVoice(Voice* v, std::uint32_t frames, bool audible);
+  void FinishVoice(std::uint32_t slot);
+
+  std::uint32_t sample_rate_;
+  std::uint32_t max_voices_;
+  std::uint32_t max_real_;
+  std::uint32_t block_frames_;
+
+  // Game thread state.
+  std::uint16_t* free_slots_;
+  std::uint32_t free_count_;
+  std::uint16_t* generation_;
+  bool* slot_busy_;
+
+  messaging::SpscQueue<Command> commands_;    // game -> mixer
+  messaging::SpscQueue<std::uint16_t> done_;  // mixer -> game
+
+  // Mixer thread state.
+  Voice* voices_;
+  std::uint16_t* active_;  // slots of playing voices
+  std::uint32_t active_count_;
+  std::uint64_t* rank_;  // priority / audibility sort keys
+  float* window_[2];     // planar source window
+  float* resampled_[2];
+  float* bus_[2];
+  float* interleaved_;  // MixS16 staging
+  math::Vec3 listener_pos_;
+  math::Vec3 listener_right_;
+  std::uint32_t last_real_;
+  std::uint32_t last_virtual_;
+};
+
+}  // namespace navary::audio
@@ -0,0 +1,296 @@
+// Navary Engine - Audio Subsystem
+// File: navary/audio/audio_source.cc
+// Purpose: AudioClip decode, AudioStream ring and the AudioStreamer
+//          decode thread.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/audio/audio_source.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+namespace navary::audio {
+
+// ---------------------------------------------------------------------------
+// AudioClip
+// ---------------------------------------------------------------------------
+
+AudioClip::AudioClip()
+    : samples_(nullptr), frame_count_(0), channels_(0), sample_rate_(0) {}
+
+AudioClip::~AudioClip() {
+  Shutdown();
+}
+
+NavaryRC AudioClip::Allocate(std::uint32_t frames, std::uint16_t channels,
+                             std::uint32_t sample_rate) {
+  if (samples_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "AudioClip: already initialized");
+  }
+  if (frames == 0 || channels == 0 || channels > 2 || sample_rate == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "AudioClip: invalid format");
+  }
+  samples_ = static_cast<float*>(
+      std::malloc(sizeof(float) * static_cast<std::size_t>(frames) *
+                  channels));
+  if (samples_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory, "AudioClip: alloc failed");
+  }
+  frame_count_ = frames;
+  channels_    = channels;
+  sample_rate_ = sample_rate;
+  return NavaryRC::OK();
+}
+
+NavaryRC AudioClip::LoadWav(const std::uint8_t* bytes, std::size_t size) {
+  NavaryResult<WavInfo> info_or = ParseWav(bytes, size);
+  if (!info_or.status().ok()) {
+    return info_or.status();
+  }
+  const WavInfo info = info_or.value();
+  NavaryRC rc = Allocate(info.frame_count, info.channels, info.sample_rate);
+  if (!rc.ok()) {
+    return rc;
+  }
+  DecodeWavFrames(info, 0, info.frame_count, samples_);
+  return NavaryRC::OK();
+}
+
+NavaryRC AudioClip::InitFromSamples(const float* interleaved,
+                                    std::uint32_t frames,
+                                    std::uint16_t channels,
+                                    std::uint32_t sample_rate) {
+  if (interleaved == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "AudioClip: null samples");
+  }
+  NavaryRC rc = Allocate(frames, channels, sample_rate);
+  if (!rc.ok()) {
+    return rc;
+  }
+  std::memcpy(samples_, interleaved,
+              sizeof(float) * static_cast<std::size_t>(frames) * channels);
+  return NavaryRC::OK();
+}
+
+void AudioClip::Shutdown() {
+  std::free(samples_);
+  samples_     = nullptr;
+  frame_count_ = 0;
+  channels_    = 0;
+  sample_rate_ = 0;
+}
+
+// ---------------------------------------------------------------------------
+// AudioStream
+// ---------------------------------------------------------------------------
+
+AudioStream::AudioStream()
+    : info_{},
+      loop_(false),
+      ring_(nullptr),
+      capacity_(0),
+      decode_pos_(0),
+      source_done_(false),
+      read_(0),
+      write_(0) {}
+
+AudioStream::~AudioStream() {
+  Shutdown();
+}
+
+NavaryRC AudioStream::Init(const std::uint8_t* wav_bytes, std::size_t size,
+                           const Desc& desc) {
+  if (ring_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "AudioStream: already initialized");
+  }
+  if (desc.buffer_frames == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "AudioStream: invalid descriptor");
+  }
+  NavaryResult<WavInfo> info_or = ParseWav(wav_bytes, size);
+  if (!info_or.status().ok()) {
+    return info_or.status();
+  }
+  std::uint32_t cap = 2;
+  while (cap < desc.buffer_frames) {
+    cap <<= 1;
+  }
+  info_ = info_or.value();
+  ring_ = static_cast<float*>(
+      std::malloc(sizeof(float) * static_cast<std::size_t>(cap) *
+                  info_.channels));
+  if (ring_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory, "AudioStream: alloc failed");
+  }
+  capacity_   = cap;
+  loop_       = desc.loop;
+  decode_pos_ = 0;
+  source_done_.store(info_.frame_count == 0, std::memory_order_relaxed);
+  read_.store(0, std::memory_order_relaxed);
+  write_.store(0, std::memory_order_relaxed);
+  return NavaryRC::OK();
+}
+
+void AudioStream::Shutdown() {
+  std::free(ring_);
+  ring_       = nullptr;
+  capacity_   = 0;
+  decode_pos_ = 0;
+  info_       = WavInfo{};
+  source_done_.store(true, std::memory_order_relaxed);
+  read_.store(0, std::memory_order_relaxed);
+  write_.store(0, std::memory_order_relaxed);
+}
+
+std::uint32_t AudioStream::Refill(std::uint32_t max_frames) {
+  if (ring_ == nullptr || source_done_.load(std::memory_order_relaxed)) {
+    return 0;
+  }
+  const std::uint64_t write = write_.load(std::memory_order_relaxed);
+  const std::uint64_t read  = read_.load(std::memory_order_acquire);
+  std::uint32_t todo =
+      std::min(max_frames, capacity_ - static_cast<std::uint32_t>(
+                                           write - read));
+  const std::uint32_t ch = info_.channels;
+
+  std::uint32_t done = 0;
+  while (todo > 0) {
+    if (decode_pos_ == info_.frame_count) {
+      if (!loop_) {
+        break;
+      }
+      decode_pos_ = 0;
+    }
+    // Contiguous in both the ring and the source.
+    const std::uint32_t slot =
+        static_cast<std::uint32_t>(write + done) & (capacity_ - 1);
+    std::uint32_t n = std::min(todo, capacity_ - slot);
+    n               = std::min(n, info_.frame_count - decode_pos_);
+    DecodeWavFrames(info_, decode_pos_, n, ring_ + slot * ch);
+    decode_pos_ += n;
+    done += n;
+    todo -= n;
+  }
+  write_.store(write + done, std::memory_order_release);
+  if (!loop_ && decode_pos_ == info_.frame_count) {
+    source_done_.store(true, std::memory_order_release);
+  }
+  return done;
+}
+
+bool AudioStream::NeedsRefill() const {
+  return ring_ != nullptr &&
+         !source_done_.load(std::memory_order_relaxed) &&
+         buffered_frames() < capacity_ / 2;
+}
+
+std::uint32_t AudioStream::buffered_frames() const {
+  return static_cast<std::uint32_t>(write_.load(std::memory_order_acquire) -
+                                    read_.load(std::memory_order_acquire));
+}
+
+std::uint32_t AudioStream::Read(float* out, std::uint32_t frames) {
+  if (ring_ == nullptr) {
+    return 0;
+  }
+  const std::uint64_t read  = read_.load(std::memory_order_relaxed);
+  const std::uint64_t write = write_.load(std::memory_order_acquire);
+  const std::uint32_t n =
+      std::min(frames, static_cast<std::uint32_t>(write - read));
+  const std::uint32_t ch    = info_.channels;
+  const std::uint32_t slot  = static_cast<std::uint32_t>(read) &
+                             (capacity_ - 1);
+  const std::uint32_t first = std::min(n, capacity_ - slot);
+  std::memcpy(out, ring_ + slot * ch, sizeof(float) * first * ch);
+  std::memcpy(out + first * ch, ring_, sizeof(float) * (n - first) * ch);
+  read_.store(read + n, std::memory_order_release);
+  return n;
+}
+
+bool AudioStream::finished() const {
+  return source_done_.load(std::memory_order_acquire) &&
+         buffered_frames() == 0;
+}
+
+// ---------------------------------------------------------------------------
+// AudioStreamer
+// ---------------------------------------------------------------------------
+
+AudioStreamer::AudioStreamer() : running_(false) {}
+
+AudioStreamer::~AudioStreamer() {
+  Stop();
+}
+
+NavaryRC AudioStreamer::Start(std::uint32_t poll_interval_ms) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (running_) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "AudioStreamer: already running");
+  }
+  running_ = true;
+  thread_  = std::thread(&AudioStreamer::ThreadMain, this,
+                         poll_interval_ms == 0 ? 1u : poll_interval_ms);
+  return NavaryRC::OK();
+}
+
+void AudioStreamer::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_) {
+      return;
+    }
+    running_ = false;
+  }
+  wake_.notify_all();
+  thread_.join();
+}
+
+void AudioStreamer::Add(AudioStream* stream) {
+  if (stream == nullptr) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    streams_.push_back(stream);
+  }
+  wake_.notify_all();  // prime the new ring without waiting a full period
+}
+
+void AudioStreamer::Remove(AudioStream* stream) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  streams_.erase(std::remove(streams_.begin(), streams_.end(), stream),
+                 streams_.end());
+}
+
+std::uint32_t AudioStreamer::Pump() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::uint32_t frames = 0;
+  for (AudioStream* s : streams_) {
+    frames += s->Refill(0xFFFFFFFFu);
+  }
+  return frames;
+}
+
+void AudioStreamer::ThreadMain(std::uint32_t poll_interval_ms) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (running_) {
+    for (AudioStream* s : streams_) {
+      if (s->NeedsRefill()) {
+        s->Refill(0xFFFFFFFFu);
+      }
+    }
+    wake_.wait_for(lock, std::chrono::milliseconds(poll_interval_ms));
+  }
+}
+
+}  // namespace navary::audio
@@ -0,0 +1,166 @@
+#pragma once
+// Navary Engine - Audio Subsystem
+// File: navary/audio/audio_source.h
+// Purpose: Sample sources for the mixer: fully decoded clips, and streams
+//          decoded ahead of playback on a background thread.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - AudioClip owns interleaved float samples (short, frequently played
+//     sounds). Any number of voices may play one clip at once.
+//   - AudioStream decodes a WAV image into a wait-free SPSC frame ring:
+//     the streamer thread produces (Refill), the mixer thread consumes
+//     (Read). Only one voice may play a stream at a time.
+//   - AudioStreamer owns the decode thread. It walks its streams, tops up
+//     every ring that has fallen below half full, then sleeps for the
+//     poll interval. Pump() runs the same pass on the calling thread, for
+//     offline rendering and tests.
+//
+// Notes:
+//   - The WAV image given to AudioStream (e.g. an io::MappedFile) must
+//     outlive the stream.
+//   - Size stream rings for the longest stall expected between refills:
+//     the default 16384 frames is ~340 ms at 48 kHz.
+//   - The mixer thread never locks: Add/Remove take the streamer's mutex,
+//     Read only touches the ring's atomics.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "navary/audio/wav.h"
+#include "navary/messaging/mpmc_queue.h"
+#include "navary/navary_status.h"
+
+namespace navary::audio {
+
+class AudioClip {
+ public:
+  AudioClip();
+  ~AudioClip();
+
+  AudioClip(const AudioClip&)            = delete;
+  AudioClip& operator=(const AudioClip&) = delete;
+
+  // Decodes a whole WAV image.
+  NavaryRC LoadWav(const std::uint8_t* bytes, std::size_t size);
+
+  // Copies |frames| interleaved frames (procedural or test sounds).
+  NavaryRC InitFromSamples(const float* interleaved, std::uint32_t frames,
+                           std::uint16_t channels,
+                           std::uint32_t sample_rate);
+
+  void Shutdown();
+
+  const float* samples() const {
+    return samples_;
+  }
+  std::uint32_t frame_count() const {
+    return frame_count_;
+  }
+  std::uint16_t channels() const {
+    return channels_;
+  }
+  std::uint32_t sample_rate() const {
+    return sample_rate_;
+  }
+
+ private:
+  NavaryRC Allocate(std::uint32_t frames, std::uint16_t channels,
+                    std::uint32_t sample_rate);
+
+  float* samples_;
+  std::uint32_t frame_count_;
+  std::uint16_t channels_;
+  std::uint32_t sample_rate_;
+};
+
+class AudioStream {
+ public:
+  struct Desc {
+    std::uint32_t buffer_frames = 16384;  // rounded up to a power of two
+    bool loop                   = false;
+  };
+
+  AudioStream();
+  ~AudioStream();
+
+  AudioStream(const AudioStream&)            = delete;
+  AudioStream& operator=(const AudioStream&) = delete;
+
+  NavaryRC Init(const std::uint8_t* wav_bytes, std::size_t size,
+                const Desc& desc);
+  void Shutdown();
+
+  // Producer (streamer thread): decodes up to |max_frames| into free ring
+  // space. Returns the frames decoded.
+  std::uint32_t Refill(std::uint32_t max_frames);
+
+  // True while the ring is below half full and the source has more.
+  bool NeedsRefill() const;
+
+  // Consumer (mixer thread): copies up to |frames| interleaved frames.
+  // Returns the frames copied; fewer than asked means an underrun or the
+  // end of the source.
+  std::uint32_t Read(float* out, std::uint32_t frames);
+
+  // Source fully decoded (never for looping streams) and ring drained.
+  bool finished() const;
+
+  std::uint16_t channels() const {
+    return info_.channels;
+  }
+  std::uint32_t sample_rate() const {
+    return info_.sample_rate;
+  }
+  std::uint32_t buffered_frames() const;
+
+ private:
+  WavInfo info_;
+  bool loop_;
+  float* ring_;               // capacity_ interleaved frames
+  std::uint32_t capacity_;    // frames, power of two
+  std::uint32_t decode_pos_;  // next source frame (producer only)
+  std::atomic<bool> source_done_;
+
+  alignas(messaging::kCacheLineBytes) std::atomic<std::uint64_t> read_;
+  alignas(messaging::kCacheLineBytes) std::atomic<std::uint64_t> write_;
+};
+
+class AudioStreamer {
+ public:
+  AudioStreamer();
+  ~AudioStreamer();
+
+  AudioStreamer(const AudioStreamer&)            = delete;
+  AudioStreamer& operator=(const AudioStreamer&) = delete;
+
+  // Starts the decode thread, waking every |poll_interval_ms|.
+  NavaryRC Start(std::uint32_t poll_interval_ms = 5);
+  void Stop();
+
+  void Add(AudioStream* stream);
+  void Remove(AudioStream* stream);
+
+  // One refill pass over every stream on the calling thread. Returns the
+  // frames decoded. Do not call while the thread is running.
+  std::uint32_t Pump();
+
+ private:
+  void ThreadMain(std::uint32_t poll_interval_ms);
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::vector<AudioStream*> streams_;
+  std::thread thread_;
+  bool running_;
+};
+
+}  // namespace navary::audio
@@ -0,0 +1,126 @@
+// Navary Engine - Audio Subsystem
+// File: navary/audio/mix_kernels.cc
+// Purpose: SIMD bodies of the mixer kernels with scalar tails.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/audio/mix_kernels.h"
+
+#include <cstring>
+
+#include "navary/math/simd4.h"
+
+namespace navary::audio {
+
+namespace {
+
+namespace simd = math::simd4;
+
+float ClampUnit(float v) {
+  return v < -1.0f ? -1.0f : (v > 1.0f ? 1.0f : v);
+}
+
+}  // namespace
+
+void ResampleLinear(const float* src, float pos, float step, float* out,
+                    std::uint32_t n) {
+  if (step == 1.0f && pos == static_cast<float>(
+                                static_cast<std::uint32_t>(pos))) {
+    std::memcpy(out, src + static_cast<std::uint32_t>(pos),
+                sizeof(float) * n);
+    return;
+  }
+
+  const float kIota[4]   = {0.0f, 1.0f, 2.0f, 3.0f};
+  const simd::F4 v_step  = simd::Splat(step);
+  const simd::F4 v_iota  = simd::Mul(simd::Load(kIota), v_step);
+  const std::uint32_t n4 = n & ~3u;
+  std::int32_t idx[4];
+  float a[4];
+  float b[4];
+  for (std::uint32_t i = 0; i < n4; i += 4) {
+    // Positions from i each time (not accumulated) to avoid drift.
+    const simd::F4 p =
+        simd::Add(simd::Splat(pos + static_cast<float>(i) * step), v_iota);
+    const simd::I4 k = simd::TruncToInt(p);
+    const simd::F4 f = simd::Sub(p, simd::ToFloat(k));
+    simd::StoreI(idx, k);
+    for (int l = 0; l < 4; ++l) {
+      a[l] = src[idx[l]];
+      b[l] = src[idx[l] + 1];
+    }
+    const simd::F4 va = simd::Load(a);
+    simd::Store(out + i, simd::MulAdd(simd::Sub(simd::Load(b), va), f, va));
+  }
+  for (std::uint32_t i = n4; i < n; ++i) {
+    const float p        = pos + static_cast<float>(i) * step;
+    const std::int32_t k = static_cast<std::int32_t>(p);
+    const float f        = p - static_cast<float>(k);
+    out[i]               = src[k] + (src[k + 1] - src[k]) * f;
+  }
+}
+
+void MixRamp(const float* src, std::uint32_t n, float gain_from,
+             float gain_to, float* bus) {
+  if (n == 0) {
+    return;
+  }
+  const float dg = (gain_to - gain_from) / static_cast<float>(n);
+  if (dg == 0.0f) {
+    const simd::F4 g       = simd::Splat(gain_to);
+    const std::uint32_t n4 = n & ~3u;
+    for (std::uint32_t i = 0; i < n4; i += 4) {
+      simd::Store(bus + i, simd::MulAdd(simd::Load(src + i), g,
+                                        simd::Load(bus + i)));
+    }
+    for (std::uint32_t i = n4; i < n; ++i) {
+      bus[i] += src[i] * gain_to;
+    }
+    return;
+  }
+
+  const float kRamp[4]   = {1.0f, 2.0f, 3.0f, 4.0f};
+  const simd::F4 v_dg    = simd::Splat(dg);
+  const simd::F4 v_step  = simd::Splat(4.0f * dg);
+  const std::uint32_t n4 = n & ~3u;
+  simd::F4 g = simd::MulAdd(simd::Load(kRamp), v_dg, simd::Splat(gain_from));
+  for (std::uint32_t i = 0; i < n4; i += 4) {
+    simd::Store(bus + i,
+                simd::MulAdd(simd::Load(src + i), g, simd::Load(bus + i)));
+    g = simd::Add(g, v_step);
+  }
+  for (std::uint32_t i = n4; i < n; ++i) {
+    bus[i] += src[i] * (gain_from + dg * static_cast<float>(i + 1));
+  }
+}
+
+void InterleaveStereo(const float* left, const float* right,
+                      std::uint32_t n, float* out) {
+  for (std::uint32_t i = 0; i < n; ++i) {
+    out[2 * i]     = ClampUnit(left[i]);
+    out[2 * i + 1] = ClampUnit(right[i]);
+  }
+}
+
+void FloatToS16(const float* in, std::uint32_t count, std::int16_t* out) {
+  const simd::F4 scale   = simd::Splat(32767.0f);
+  const std::uint32_t n8 = count & ~7u;
+  for (std::uint32_t i = 0; i < n8; i += 8) {
+    // Out-of-range values saturate in the pack, so no clamp is needed
+    // beyond keeping the int conversion itself in range.
+    const simd::F4 lo = simd::Clamp(simd::Load(in + i), simd::Splat(-2.0f),
+                                    simd::Splat(2.0f));
+    const simd::F4 hi = simd::Clamp(simd::Load(in + i + 4),
+                                    simd::Splat(-2.0f), simd::Splat(2.0f));
+    simd::StoreSaturatedI16(out + i, simd::ToInt(simd::Mul(lo, scale)),
+                            simd::ToInt(simd::Mul(hi, scale)));
+  }
+  for (std::uint32_t i = n8; i < count; ++i) {
+    const float v = ClampUnit(in[i]) * 32767.0f;
+    out[i]        = static_cast<std::int16_t>(v < 0.0f ? v - 0.5f : v + 0.5f);
+  }
+}
+
+}  // namespace navary::audio
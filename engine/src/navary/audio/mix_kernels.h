@@ -0,0 +1,41 @@
+#pragma once
+// Navary Engine - Audio Subsystem
+// File: navary/audio/mix_kernels.h
+// Purpose: 4-wide float kernels behind AudioMixer: linear resampling,
+//          gain-ramped accumulation and output conversion.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - Buffers are planar float (one array per channel) so every kernel is
+//     a straight stream through math/simd4.h; only the resampler's tap
+//     fetch is scalar (a gather).
+//   - Gains ramp linearly across a block, reaching the target on the last
+//     frame, so volume, pan and distance changes never click.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+namespace navary::audio {
+
+// out[i] = src[k] + (src[k + 1] - src[k]) * f for p = pos + i * step,
+// k = floor(p), f = p - k. |pos| >= 0; src must hold
+// floor(pos + (n - 1) * step) + 2 samples.
+void ResampleLinear(const float* src, float pos, float step, float* out,
+                    std::uint32_t n);
+
+// bus[i] += src[i] * g(i), g ramping from |gain_from| (exclusive) to
+// |gain_to| (reached at i = n - 1).
+void MixRamp(const float* src, std::uint32_t n, float gain_from,
+             float gain_to, float* bus);
+
+// Interleaves two planar channels, clamped to [-1, 1].
+void InterleaveStereo(const float* left, const float* right,
+                      std::uint32_t n, float* out);
+
+// Interleaved float -> interleaved int16 with saturation. |count| is the
+// sample count (frames * channels).
+void FloatToS16(const float* in, std::uint32_t count, std::int16_t* out);
+
+}  // namespace navary::audio
@@ -0,0 +1,227 @@
+// Navary Engine - Audio Subsystem
+// File: navary/audio/wav.cc
+// Purpose: WAV chunk walking, sample conversion and the PCM16 writer.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/audio/wav.h"
+
+#include <cstring>
+
+namespace navary::audio {
+
+namespace {
+
+constexpr std::uint16_t kFormatPcm        = 1;
+constexpr std::uint16_t kFormatFloat      = 3;
+constexpr std::uint16_t kFormatExtensible = 0xFFFE;
+constexpr std::uint32_t kHeaderBytes      = 44;
+
+std::uint16_t ReadU16(const std::uint8_t* p) {
+  return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+}
+
+std::uint32_t ReadU32(const std::uint8_t* p) {
+  return static_cast<std::uint32_t>(p[0]) |
+         (static_cast<std::uint32_t>(p[1]) << 8) |
+         (static_cast<std::uint32_t>(p[2]) << 16) |
+         (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+void PutU16(std::uint8_t* p, std::uint32_t v) {
+  p[0] = static_cast<std::uint8_t>(v);
+  p[1] = static_cast<std::uint8_t>(v >> 8);
+}
+
+void PutU32(std::uint8_t* p, std::uint32_t v) {
+  PutU16(p, v);
+  PutU16(p + 2, v >> 16);
+}
+
+NavaryResult<WavInfo> ParseFail(const char* msg) {
+  return NavaryResult<WavInfo>(NavaryRC(NavaryStatus::kParseError, msg));
+}
+
+}  // namespace
+
+NavaryResult<WavInfo> ParseWav(const std::uint8_t* bytes, std::size_t size) {
+  if (bytes == nullptr || size < 12 || std::memcmp(bytes, "RIFF", 4) != 0 ||
+      std::memcmp(bytes + 8, "WAVE", 4) != 0) {
+    return ParseFail("ParseWav: not a RIFF/WAVE image");
+  }
+
+  std::uint16_t format     = 0;
+  std::uint16_t channels   = 0;
+  std::uint32_t rate       = 0;
+  std::uint16_t bits       = 0;
+  const std::uint8_t* data = nullptr;
+  std::uint32_t data_size  = 0;
+
+  std::size_t at = 12;
+  while (at + 8 <= size) {
+    const std::uint8_t* chunk = bytes + at;
+    const std::uint32_t len   = ReadU32(chunk + 4);
+    const std::size_t body    = at + 8;
+    if (len > size - body) {
+      // Truncated data chunks are common (killed recorders); keep what
+      // is there. Any other truncated chunk is an error.
+      if (std::memcmp(chunk, "data", 4) != 0) {
+        return ParseFail("ParseWav: truncated chunk");
+      }
+    }
+    const std::uint32_t avail = static_cast<std::uint32_t>(
+        len > size - body ? size - body : len);
+    if (std::memcmp(chunk, "fmt ", 4) == 0) {
+      if (avail < 16) {
+        return ParseFail("ParseWav: short fmt chunk");
+      }
+      format   = ReadU16(bytes + body);
+      channels = ReadU16(bytes + body + 2);
+      rate     = ReadU32(bytes + body + 4);
+      bits     = ReadU16(bytes + body + 14);
+      if (format == kFormatExtensible) {
+        if (avail < 26) {
+          return ParseFail("ParseWav: short extensible fmt chunk");
+        }
+        format = ReadU16(bytes + body + 24);  // SubFormat GUID, first word
+      }
+    } else if (std::memcmp(chunk, "data", 4) == 0) {
+      data      = bytes + body;
+      data_size = avail;
+      break;
+    }
+    at = body + len + (len & 1);  // chunks are word aligned
+  }
+
+  if (data == nullptr || channels == 0 || rate == 0) {
+    return ParseFail("ParseWav: missing fmt or data chunk");
+  }
+  WavInfo info{};
+  if (format == kFormatPcm && bits == 16) {
+    info.format = WavSampleFormat::kPcm16;
+  } else if (format == kFormatFloat && bits == 32) {
+    info.format = WavSampleFormat::kFloat32;
+  } else {
+    return ParseFail("ParseWav: only PCM16 and float32 are supported");
+  }
+  if (channels > 2) {
+    return ParseFail("ParseWav: only mono and stereo are supported");
+  }
+  info.channels    = channels;
+  info.sample_rate = rate;
+  info.frame_count = data_size / (channels * (bits / 8u));
+  info.samples     = data;
+  return NavaryResult<WavInfo>(info);
+}
+
+void DecodeWavFrames(const WavInfo& info, std::uint32_t first,
+                     std::uint32_t count, float* out) {
+  const std::uint32_t n = count * info.channels;
+  if (info.format == WavSampleFormat::kPcm16) {
+    const std::uint8_t* src = info.samples + 2u * first * info.channels;
+    for (std::uint32_t i = 0; i < n; ++i) {
+      const auto s = static_cast<std::int16_t>(ReadU16(src + 2u * i));
+      out[i]       = static_cast<float>(s) * (1.0f / 32768.0f);
+    }
+  } else {
+    // IEEE float little-endian, as on every supported target.
+    std::memcpy(out, info.samples + 4u * first * info.channels,
+                sizeof(float) * n);
+  }
+}
+
+WavWriter::WavWriter() : file_(nullptr), channels_(0), frames_written_(0) {}
+
+WavWriter::~WavWriter() {
+  Close();
+}
+
+NavaryRC WavWriter::Open(const char* path, std::uint32_t sample_rate,
+                         std::uint16_t channels) {
+  if (file_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "WavWriter: already open");
+  }
+  if (path == nullptr || sample_rate == 0 || channels == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "WavWriter: invalid arguments");
+  }
+  file_ = std::fopen(path, "wb");
+  if (file_ == nullptr) {
+    return NavaryRC(NavaryStatus::kIoError, "WavWriter: cannot open file");
+  }
+  channels_       = channels;
+  frames_written_ = 0;
+
+  // Sizes are zero until Close() patches them.
+  std::uint8_t h[kHeaderBytes];
+  std::memcpy(h, "RIFF", 4);
+  PutU32(h + 4, 0);
+  std::memcpy(h + 8, "WAVEfmt ", 8);
+  PutU32(h + 16, 16);
+  PutU16(h + 20, kFormatPcm);
+  PutU16(h + 22, channels);
+  PutU32(h + 24, sample_rate);
+  PutU32(h + 28, sample_rate * channels * 2u);  // byte rate
+  PutU16(h + 32, channels * 2u);                // block align
+  PutU16(h + 34, 16);
+  std::memcpy(h + 36, "data", 4);
+  PutU32(h + 40, 0);
+  if (std::fwrite(h, 1, sizeof(h), file_) != sizeof(h)) {
+    std::fclose(file_);
+    file_ = nullptr;
+    return NavaryRC(NavaryStatus::kIoError, "WavWriter: header write failed");
+  }
+  return NavaryRC::OK();
+}
+
+NavaryRC WavWriter::Write(const float* interleaved, std::uint32_t frames) {
+  if (file_ == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument, "WavWriter: not open");
+  }
+  std::uint8_t buf[1024];
+  const std::uint32_t total = frames * channels_;
+  std::uint32_t done        = 0;
+  while (done < total) {
+    const std::uint32_t n =
+        total - done < sizeof(buf) / 2 ? total - done : sizeof(buf) / 2;
+    for (std::uint32_t i = 0; i < n; ++i) {
+      float v = interleaved[done + i];
+      v       = v < -1.0f ? -1.0f : (v > 1.0f ? 1.0f : v);
+      const auto s =
+          static_cast<std::int16_t>(v * 32767.0f + (v < 0.0f ? -0.5f : 0.5f));
+      PutU16(buf + 2 * i, static_cast<std::uint16_t>(s));
+    }
+    if (std::fwrite(buf, 2, n, file_) != n) {
+      return NavaryRC(NavaryStatus::kIoError, "WavWriter: write failed");
+    }
+    done += n;
+  }
+  frames_written_ += frames;
+  return NavaryRC::OK();
+}
+
+NavaryRC WavWriter::Close() {
+  if (file_ == nullptr) {
+    return NavaryRC::OK();
+  }
+  const std::uint32_t data_bytes = frames_written_ * channels_ * 2u;
+  std::uint8_t size[4];
+  bool ok = true;
+  PutU32(size, kHeaderBytes - 8 + data_bytes);
+  ok = ok && std::fseek(file_, 4, SEEK_SET) == 0 &&
+       std::fwrite(size, 1, 4, file_) == 4;
+  PutU32(size, data_bytes);
+  ok = ok && std::fseek(file_, 40, SEEK_SET) == 0 &&
+       std::fwrite(size, 1, 4, file_) == 4;
+  ok = std::fclose(file_) == 0 && ok;
+  file_ = nullptr;
+  if (!ok) {
+    return NavaryRC(NavaryStatus::kIoError, "WavWriter: finalize failed");
+  }
+  return NavaryRC::OK();
+}
+
+}  // namespace navary::audio
@@ -0,0 +1,79 @@
+#pragma once
+// Navary Engine - Audio Subsystem
+// File: navary/audio/wav.h
+// Purpose: RIFF/WAVE parsing and decoding to float, plus a PCM16 writer
+//          for offline renders.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - ParseWav() validates a WAV image in memory (loaded or mapped) and
+//     points into its sample data; nothing is copied.
+//   - DecodeWavFrames() converts any frame range to interleaved float in
+//     [-1, 1], so clips decode once and streams decode chunk by chunk.
+//   - WavWriter streams interleaved float frames to a 16-bit PCM file and
+//     patches the header sizes on Close().
+//
+// Notes:
+//   - Accepted formats: PCM 16-bit and IEEE float 32-bit, 1 or 2
+//     channels, plain or WAVE_FORMAT_EXTENSIBLE headers.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "navary/navary_status.h"
+
+namespace navary::audio {
+
+enum class WavSampleFormat : std::uint8_t {
+  kPcm16   = 0,
+  kFloat32 = 1,
+};
+
+struct WavInfo {
+  std::uint16_t channels;
+  std::uint32_t sample_rate;
+  WavSampleFormat format;
+  std::uint32_t frame_count;
+  const std::uint8_t* samples;  // into the parsed image
+};
+
+// kParseError for anything that is not a supported WAV image.
+NavaryResult<WavInfo> ParseWav(const std::uint8_t* bytes, std::size_t size);
+
+// Writes frames [first, first + count) as interleaved float. The range
+// must lie inside the file.
+void DecodeWavFrames(const WavInfo& info, std::uint32_t first,
+                     std::uint32_t count, float* out);
+
+class WavWriter {
+ public:
+  WavWriter();
+  ~WavWriter();
+
+  WavWriter(const WavWriter&)            = delete;
+  WavWriter& operator=(const WavWriter&) = delete;
+
+  NavaryRC Open(const char* path, std::uint32_t sample_rate,
+                std::uint16_t channels);
+
+  // Appends |frames| interleaved frames, clamped to [-1, 1].
+  NavaryRC Write(const float* interleaved, std::uint32_t frames);
+
+  // Finalizes the header. Also run by the destructor.
+  NavaryRC Close();
+
+  std::uint32_t frames_written() const {
+    return frames_written_;
+  }
+
+ private:
+  std::FILE* file_;
+  std::uint16_t channels_;
+  std::uint32_t frames_written_;
+};
+
+}  // namespace navary::audio
@@ -54,6 +54,10 @@ struct BufferHandle {
   std::uint32_t index;
 };
 
+struct MeshHandle {
+  std::uint32_t index;
+};
+
 struct GraphId {
   std::uint32_t index;
 };
@@ -0,0 +1,247 @@
+// Navary Engine - Scheduler Subsystem
+// File: navary/core/scheduler/job_system.cc
+// Purpose: Implementation for JobSystem (worker pool + ParallelFor).
+// Policy: C++20, Google style, no exceptions, no RTTI.
+
+#include "navary/core/scheduler/job_system.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace navary::core::scheduler {
+
+namespace {
+
+// A worker's index is only meaningful to the system that owns it; a job on
+// system A calling B.ParallelFor() must not pass A's index to B's ranges.
+thread_local const JobSystem* tls_owner     = nullptr;
+thread_local std::uint32_t tls_worker_index = 0;
+
+}  // namespace
+
+JobSystem::JobSystem()
+    : queue_(nullptr),
+      queue_capacity_(0),
+      queue_head_(0),
+      queue_size_(0),
+      stop_(false),
+      workers_(nullptr),
+      thread_count_(1),
+      executed_jobs_(0),
+      inline_jobs_(0) {}
+
+JobSystem::~JobSystem() {
+  Shutdown();
+}
+
+NavaryRC JobSystem::Init(std::uint32_t worker_count,
+                         std::uint32_t queue_capacity) {
+  if (queue_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "JobSystem: already initialized");
+  }
+
+  if (worker_count == 0) {
+    const std::uint32_t hw = std::thread::hardware_concurrency();
+    worker_count           = hw > 1 ? hw - 1 : 1;
+  }
+  worker_count   = std::min(worker_count, kMaxThreads - 1);
+  queue_capacity = std::max<std::uint32_t>(queue_capacity, 16);
+
+  queue_   = static_cast<Job*>(std::malloc(sizeof(Job) * queue_capacity));
+  workers_ = static_cast<std::thread*>(
+      std::malloc(sizeof(std::thread) * worker_count));
+  if (queue_ == nullptr || workers_ == nullptr) {
+    std::free(queue_);
+    std::free(workers_);
+    queue_   = nullptr;
+    workers_ = nullptr;
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "JobSystem: storage alloc failed");
+  }
+
+  queue_capacity_ = queue_capacity;
+  queue_head_     = 0;
+  queue_size_     = 0;
+  stop_           = false;
+  thread_count_   = worker_count + 1;
+
+#if NVR_JOBS_ENABLE_TRACE
+  for (auto& c : worker_jobs_) {
+    c.store(0, std::memory_order_relaxed);
+  }
+#endif
+
+  for (std::uint32_t i = 0; i < worker_count; ++i) {
+    new (&workers_[i]) std::thread(&JobSystem::WorkerMain, this, i + 1);
+  }
+
+  return NavaryRC::OK();
+}
+
+void JobSystem::Shutdown() {
+  if (queue_ == nullptr) {
+    return;
+  }
+
+  // Let the owner finish anything still queued before stopping workers.
+  Job job;
+  while (TryPop(&job)) {
+    Run(job);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+
+  for (std::uint32_t i = 0; i + 1 < thread_count_; ++i) {
+    workers_[i].join();
+    workers_[i].~thread();
+  }
+
+  std::free(workers_);
+  std::free(queue_);
+  workers_      = nullptr;
+  queue_        = nullptr;
+  thread_count_ = 1;
+  queue_size_   = 0;
+}
+
+std::uint32_t JobSystem::WorkerIndex() const {
+  return tls_owner == this ? tls_worker_index : 0;
+}
+
+void JobSystem::Push(const Job& job) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_ != nullptr && queue_size_ < queue_capacity_) {
+      queue_[(queue_head_ + queue_size_) % queue_capacity_] = job;
+      ++queue_size_;
+      cv_.notify_one();
+      return;
+    }
+  }
+
+  // Queue full (or not initialized): run inline, preserving completion.
+  inline_jobs_.fetch_add(1, std::memory_order_relaxed);
+  Run(job);
+}
+
+bool JobSystem::TryPop(Job* out) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (queue_size_ == 0) {
+    return false;
+  }
+  *out        = queue_[queue_head_];
+  queue_head_ = (queue_head_ + 1) % queue_capacity_;
+  --queue_size_;
+  return true;
+}
+
+void JobSystem::Run(const Job& job) {
+  if (job.range_fn != nullptr) {
+    job.range_fn(job.begin, job.end, WorkerIndex(), job.user_data);
+  } else if (job.fn != nullptr) {
+    job.fn(job.user_data);
+  }
+
+  executed_jobs_.fetch_add(1, std::memory_order_relaxed);
+#if NVR_JOBS_ENABLE_TRACE
+  const std::uint32_t worker = WorkerIndex();
+  if (worker < kMaxThreads) {
+    worker_jobs_[worker].fetch_add(1, std::memory_order_relaxed);
+  }
+#endif
+
+  if (job.counter != nullptr) {
+    job.counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+  }
+}
+
+void JobSystem::WorkerMain(std::uint32_t index) {
+  tls_owner        = this;
+  tls_worker_index = index;
+
+  for (;;) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] { return stop_ || queue_size_ > 0; });
+      if (queue_size_ == 0) {
+        return;  // stop_ and nothing left
+      }
+      job         = queue_[queue_head_];
+      queue_head_ = (queue_head_ + 1) % queue_capacity_;
+      --queue_size_;
+    }
+    Run(job);
+  }
+}
+
+void JobSystem::Submit(JobFn fn, void* user_data, JobCounter* counter) {
+  if (counter != nullptr) {
+    counter->pending.fetch_add(1, std::memory_order_relaxed);
+  }
+  Push(Job{fn, nullptr, user_data, counter, 0, 0});
+}
+
+void JobSystem::Wait(JobCounter* counter) {
+  if (counter == nullptr) {
+    return;
+  }
+
+  while (!counter->Done()) {
+    Job job;
+    if (TryPop(&job)) {
+      Run(job);
+    } else {
+      // Remaining jobs are running on other workers.
+      std::this_thread::yield();
+    }
+  }
+}
+
+void JobSystem::ParallelFor(std::uint32_t count, std::uint32_t grain,
+                            JobRangeFn fn, void* user_data) {
+  if (count == 0 || fn == nullptr) {
+    return;
+  }
+  if (grain == 0) {
+    grain = 1;
+  }
+
+  // Single range or no workers: skip the queue entirely.
+  if (count <= grain || thread_count_ == 1) {
+    fn(0, count, WorkerIndex(), user_data);
+    return;
+  }
+
+  JobCounter counter;
+  for (std::uint32_t begin = 0; begin < count; begin += grain) {
+    const std::uint32_t end = std::min(count, begin + grain);
+    counter.pending.fetch_add(1, std::memory_order_relaxed);
+    Push(Job{nullptr, fn, user_data, &counter, begin, end});
+  }
+
+  Wait(&counter);
+}
+
+JobSystemStats JobSystem::stats() const {
+  JobSystemStats s{};
+  s.executed_jobs = executed_jobs_.load(std::memory_order_relaxed);
+  s.inline_jobs   = inline_jobs_.load(std::memory_order_relaxed);
+  return s;
+}
+
+#if NVR_JOBS_ENABLE_TRACE
+std::uint64_t JobSystem::worker_jobs(std::uint32_t worker) const {
+  return worker < kMaxThreads
+             ? worker_jobs_[worker].load(std::memory_order_relaxed)
+             : 0;
+}
+#endif
+
+}  // namespace navary::core::scheduler
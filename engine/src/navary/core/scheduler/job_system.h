@@ -0,0 +1,138 @@
+#pragma once
+// Navary Engine - Scheduler Subsystem
+// File: navary/core/scheduler/job_system.h
+// Purpose: Fixed worker pool with counter-based jobs and ParallelFor.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - N worker threads plus the thread that calls Init() (worker 0).
+//   - Jobs are plain function pointers + user data; no allocation per job.
+//   - JobCounter tracks outstanding jobs; Wait() helps run queued jobs
+//     instead of blocking, so nested ParallelFor never deadlocks.
+//   - WorkerIndex() is stable per thread, so systems can keep per-worker
+//     state (command pools, query objects, scratch arenas) without locks.
+//
+// Notes:
+//   - The queue is a bounded ring; when it is full Submit() runs the job
+//     inline on the calling thread.
+//   - Only the owning thread and worker threads may submit/wait.
+//   - NVR_JOBS_ENABLE_TRACE=1 records per-worker executed job counts.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "navary/navary_status.h"
+
+#ifndef NVR_JOBS_ENABLE_TRACE
+#define NVR_JOBS_ENABLE_TRACE 0
+#endif
+
+namespace navary::core::scheduler {
+
+using JobFn = void (*)(void* user_data);
+
+// Executes [begin, end) of a ParallelFor range on |worker|.
+using JobRangeFn = void (*)(std::uint32_t begin, std::uint32_t end,
+                            std::uint32_t worker, void* user_data);
+
+// Outstanding job count. Zero means every job tied to it has finished.
+struct JobCounter {
+  std::atomic<std::uint32_t> pending{0};
+
+  bool Done() const {
+    return pending.load(std::memory_order_acquire) == 0;
+  }
+};
+
+struct JobSystemStats {
+  std::uint64_t executed_jobs;
+  std::uint64_t inline_jobs;  // queue was full
+};
+
+class JobSystem {
+ public:
+  static constexpr std::uint32_t kMaxThreads = 64;
+
+  JobSystem();
+  ~JobSystem();
+
+  JobSystem(const JobSystem&)            = delete;
+  JobSystem& operator=(const JobSystem&) = delete;
+
+  // worker_count == 0 picks hardware_concurrency() - 1. The calling thread
+  // becomes worker 0, so thread_count() == worker_count + 1.
+  NavaryRC Init(std::uint32_t worker_count,
+                std::uint32_t queue_capacity = 4096);
+
+  // Drains the queue and joins workers. Safe to call twice.
+  void Shutdown();
+
+  std::uint32_t thread_count() const {
+    return thread_count_;
+  }
+
+  // Index in [0, thread_count()) of the calling thread; 0 for the owner
+  // thread and for threads the system does not know, including workers of
+  // another JobSystem whose jobs call into this one.
+  std::uint32_t WorkerIndex() const;
+
+  // Queues |fn|; |counter| (optional) is incremented now and decremented
+  // when the job finishes.
+  void Submit(JobFn fn, void* user_data, JobCounter* counter);
+
+  // Runs queued jobs on the calling thread until |counter| reaches zero.
+  void Wait(JobCounter* counter);
+
+  // Splits [0, count) into ranges of at most |grain| items, runs them on all
+  // threads including the caller and returns when every range finished.
+  void ParallelFor(std::uint32_t count, std::uint32_t grain, JobRangeFn fn,
+                   void* user_data);
+
+  JobSystemStats stats() const;
+
+#if NVR_JOBS_ENABLE_TRACE
+  // Jobs executed by |worker| since Init().
+  std::uint64_t worker_jobs(std::uint32_t worker) const;
+#endif
+
+ private:
+  struct Job {
+    JobFn fn;
+    JobRangeFn range_fn;
+    void* user_data;
+    JobCounter* counter;
+    std::uint32_t begin;
+    std::uint32_t end;
+  };
+
+  void Push(const Job& job);
+  bool TryPop(Job* out);
+  void Run(const Job& job);
+  void WorkerMain(std::uint32_t index);
+
+  Job* queue_;
+  std::uint32_t queue_capacity_;
+  std::uint32_t queue_head_;
+  std::uint32_t queue_size_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stop_;
+
+  std::thread* workers_;
+  std::uint32_t thread_count_;
+
+  std::atomic<std::uint64_t> executed_jobs_;
+  std::atomic<std::uint64_t> inline_jobs_;
+#if NVR_JOBS_ENABLE_TRACE
+  std::atomic<std::uint64_t> worker_jobs_[kMaxThreads];
+#endif
+};
+
+}  // namespace navary::core::scheduler
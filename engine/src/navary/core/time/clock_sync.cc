@@ -0,0 +1,163 @@
+// Navary Engine - Timing Subsystem
+// File: navary/core/time/clock_sync.cc
+// Purpose: Implementation of ClockSync (server offset / RTT estimator).
+// Policy: C++20, Google style, no exceptions, no RTTI.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/core/time/clock_sync.h"
+
+namespace navary::core::time {
+
+namespace {
+
+template <typename T>
+void InsertionSort(T* v, std::uint32_t n) {
+  for (std::uint32_t i = 1; i < n; ++i) {
+    const T key     = v[i];
+    std::uint32_t j = i;
+    while (j > 0 && v[j - 1] > key) {
+      v[j] = v[j - 1];
+      --j;
+    }
+    v[j] = key;
+  }
+}
+
+std::int64_t Diff(std::uint64_t a, std::uint64_t b) {
+  return static_cast<std::int64_t>(a - b);
+}
+
+}  // namespace
+
+ClockSync::ClockSync() : ClockSync(ClockSyncConfig{}) {}
+
+ClockSync::ClockSync(const ClockSyncConfig& config)
+    : config_(config),
+      entries_{},
+      head_(0),
+      count_(0),
+      rejected_(0),
+      has_estimate_(false),
+      resync_seeded_(false),
+      offset_ns_(0),
+      rtt_ns_(0),
+      min_rtt_ns_(0),
+      jitter_ns_(0) {
+  if (config_.window == 0) {
+    config_.window = 1;
+  }
+  if (config_.window > kMaxWindow) {
+    config_.window = kMaxWindow;
+  }
+  if (config_.min_samples == 0) {
+    config_.min_samples = 1;
+  }
+  if (config_.min_samples > config_.window) {
+    config_.min_samples = config_.window;
+  }
+}
+
+void ClockSync::Reset() {
+  head_          = 0;
+  count_         = 0;
+  rejected_      = 0;
+  has_estimate_  = false;
+  resync_seeded_ = false;
+  offset_ns_     = 0;
+  rtt_ns_        = 0;
+  min_rtt_ns_    = 0;
+  jitter_ns_     = 0;
+}
+
+bool ClockSync::AddSample(const ClockSyncSample& s) {
+  const std::int64_t round_trip  = Diff(s.client_recv_ns, s.client_send_ns);
+  const std::int64_t server_hold = Diff(s.server_send_ns, s.server_recv_ns);
+  const std::int64_t rtt         = round_trip - server_hold;
+  if (round_trip < 0 || server_hold < 0 || rtt < 0 ||
+      static_cast<std::uint64_t>(rtt) > config_.max_rtt_ns) {
+    ++rejected_;
+    return false;
+  }
+
+  Entry& e = entries_[head_];
+  e.rtt_ns = static_cast<std::uint64_t>(rtt);
+  // Halve each leg first so the sum cannot overflow.
+  e.offset_ns = Diff(s.server_recv_ns, s.client_send_ns) / 2 +
+                Diff(s.server_send_ns, s.client_recv_ns) / 2;
+
+  head_ = (head_ + 1) % config_.window;
+  if (count_ < config_.window) {
+    ++count_;
+  }
+  Recompute();
+  return true;
+}
+
+void ClockSync::Recompute() {
+  std::uint64_t rtts[kMaxWindow];
+  for (std::uint32_t i = 0; i < count_; ++i) {
+    rtts[i] = entries_[i].rtt_ns;
+  }
+  InsertionSort(rtts, count_);
+  min_rtt_ns_ = rtts[0];
+  jitter_ns_  = rtts[count_ / 2] - min_rtt_ns_;
+
+  std::uint64_t tolerance = min_rtt_ns_ / 4;
+  if (tolerance < config_.rtt_tolerance_ns) {
+    tolerance = config_.rtt_tolerance_ns;
+  }
+
+  // Median offset over the low-RTT samples; RTT reported is their mean.
+  std::int64_t offsets[kMaxWindow];
+  std::uint32_t n       = 0;
+  std::uint64_t rtt_sum = 0;
+  for (std::uint32_t i = 0; i < count_; ++i) {
+    if (entries_[i].rtt_ns <= min_rtt_ns_ + tolerance) {
+      offsets[n++] = entries_[i].offset_ns;
+      rtt_sum += entries_[i].rtt_ns;
+    }
+  }
+  InsertionSort(offsets, n);
+  offset_ns_ = (n % 2 == 1) ? offsets[n / 2]
+                            : offsets[n / 2 - 1] / 2 + offsets[n / 2] / 2;
+  rtt_ns_       = rtt_sum / n;
+  has_estimate_ = count_ >= config_.min_samples;
+}
+
+std::int64_t ClockSync::Apply(SoftResync* resync, std::uint64_t mono_ns,
+                              std::int64_t lead_ns) {
+  if (!has_estimate_) {
+    return resync->bias_ns();
+  }
+
+  const std::int64_t target_bias = offset_ns_ + lead_ns;
+  std::int64_t error             = target_bias - resync->bias_ns();
+  if (error < 0) {
+    error = -error;
+  }
+  if (!resync_seeded_ ||
+      static_cast<std::uint64_t>(error) > config_.snap_threshold_ns) {
+    resync->SetBiasNs(target_bias);
+    resync_seeded_ = true;
+    return target_bias;
+  }
+
+  const std::int64_t target =
+      static_cast<std::int64_t>(mono_ns) + target_bias;
+  return resync->Update(mono_ns,
+                        target > 0 ? static_cast<std::uint64_t>(target) : 0);
+}
+
+std::uint64_t ClockSync::ServerNowNs(std::uint64_t mono_ns) const {
+  const std::int64_t t = static_cast<std::int64_t>(mono_ns) + offset_ns_;
+  return t > 0 ? static_cast<std::uint64_t>(t) : 0ull;
+}
+
+std::uint64_t ClockSync::RecommendedLeadNs(
+    std::uint64_t input_buffer_ns) const {
+  return rtt_ns_ / 2 + 2 * jitter_ns_ + input_buffer_ns;
+}
+
+}  // namespace navary::core::time
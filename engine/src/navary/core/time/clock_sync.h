@@ -0,0 +1,132 @@
+#pragma once
+// Navary Engine - Timing Subsystem
+// File: navary/core/time/clock_sync.h
+// Purpose: NTP-style server clock offset / RTT estimation feeding
+// SoftResync. Policy: C++20, Google style, no exceptions, no RTTI.
+//
+// Design Summary:
+//  - Each exchange yields four timestamps: client send (t0), server receive
+//    (t1), server send (t2), client receive (t3). Client stamps are local
+//    monotonic ns, server stamps are the server's clock in ns.
+//
+//  Math:
+//     rtt    = (t3 - t0) - (t2 - t1)
+//     offset = ((t1 - t0) + (t2 - t3)) / 2      (server - client)
+//
+//  - An offset sample is wrong by at most rtt / 2 (asymmetric paths), so
+//    samples with the lowest RTT are the most trustworthy. The estimator
+//    keeps a small window, drops impossible / too-slow exchanges, keeps
+//    only samples within a tolerance of the window's minimum RTT and takes
+//    the median offset of those (outlier rejection).
+//  - Apply() feeds the estimate into SoftResync::Update as the "wall"
+//    target, so adjusted time converges on server time at the resync slew
+//    rate, never with speed jumps. Only the first estimate (or a gross
+//    error beyond snap_threshold_ns) hard-sets the bias.
+//  - |lead_ns| lets lockstep clients run slightly ahead of the server
+//    (input must arrive before the tick it targets); see
+//    RecommendedLeadNs().
+//
+// Usage:
+//   ClockSync sync;
+//   // on each pong: sync.AddSample({t0, t1, t2, MonotonicNowNs()});
+//   // per frame:
+//   sync.Apply(&resync, MonotonicNowNs(), sync.RecommendedLeadNs(MsToNs(5)));
+//   const uint64_t server_ns = resync.AdjustedNs(MonotonicNowNs());
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/core/time/soft_resync.h"
+#include "navary/core/time/time_types.h"
+
+namespace navary::core::time {
+
+struct ClockSyncSample {
+  std::uint64_t client_send_ns;  // t0, client monotonic
+  std::uint64_t server_recv_ns;  // t1, server clock
+  std::uint64_t server_send_ns;  // t2, server clock
+  std::uint64_t client_recv_ns;  // t3, client monotonic
+};
+
+struct ClockSyncConfig {
+  std::uint32_t window      = 16;  // samples kept, 1..kMaxWindow
+  std::uint32_t min_samples = 3;   // before has_estimate()
+  std::uint64_t max_rtt_ns  = SecondsToNs(1.0);  // slower exchanges dropped
+  // Samples with rtt <= min_rtt + max(rtt_tolerance_ns, min_rtt / 4) vote.
+  std::uint64_t rtt_tolerance_ns  = MsToNs(2);
+  std::uint64_t snap_threshold_ns = MsToNs(250);
+};
+
+class ClockSync {
+ public:
+  static constexpr std::uint32_t kMaxWindow = 64;
+
+  ClockSync();
+  explicit ClockSync(const ClockSyncConfig& config);
+
+  // Adds one exchange. Returns false if it was rejected outright (negative
+  // or above max_rtt_ns round trip).
+  bool AddSample(const ClockSyncSample& sample);
+
+  // Steers |resync| toward server time (+ lead_ns) at client time |mono_ns|.
+  // No-op until has_estimate(). Returns the resync bias after the update.
+  std::int64_t Apply(SoftResync* resync, std::uint64_t mono_ns,
+                     std::int64_t lead_ns = 0);
+
+  // Server time estimate for a client monotonic timestamp (unsmoothed).
+  std::uint64_t ServerNowNs(std::uint64_t mono_ns) const;
+
+  // One-way latency + twice the jitter + |input_buffer_ns|: how far ahead of
+  // the server a lockstep client should schedule its ticks.
+  std::uint64_t RecommendedLeadNs(std::uint64_t input_buffer_ns) const;
+
+  void Reset();
+
+  bool has_estimate() const {
+    return has_estimate_;
+  }
+  std::int64_t offset_ns() const {
+    return offset_ns_;
+  }
+  std::uint64_t rtt_ns() const {
+    return rtt_ns_;
+  }
+  std::uint64_t min_rtt_ns() const {
+    return min_rtt_ns_;
+  }
+  // Median window RTT minus minimum RTT.
+  std::uint64_t jitter_ns() const {
+    return jitter_ns_;
+  }
+  std::uint32_t sample_count() const {
+    return count_;
+  }
+  std::uint32_t rejected_count() const {
+    return rejected_;
+  }
+
+ private:
+  struct Entry {
+    std::int64_t offset_ns;
+    std::uint64_t rtt_ns;
+  };
+
+  void Recompute();
+
+  ClockSyncConfig config_;
+  Entry entries_[kMaxWindow];
+  std::uint32_t head_;
+  std::uint32_t count_;
+  std::uint32_t rejected_;
+
+  bool has_estimate_;
+  bool resync_seeded_;
+  std::int64_t offset_ns_;
+  std::uint64_t rtt_ns_;
+  std::uint64_t min_rtt_ns_;
+  std::uint64_t jitter_ns_;
+};
+
+}  // namespace navary::core::time
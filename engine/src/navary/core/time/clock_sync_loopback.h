@@ -0,0 +1,93 @@
+#pragma once
+// Navary Engine - Timing Subsystem
+// File: navary/core/time/clock_sync_loopback.h
+// Purpose: In-process stand-in for a remote time server: injects offset,
+// drift, path delay, jitter and latency spikes into ClockSync exchanges.
+// Policy: C++20, Google style, no exceptions, no RTTI, header-only.
+//
+// Design Summary:
+//  - Server clock = client_mono * (1 + drift_ppm / 1e6) + offset_ns.
+//  - Each direction gets base_delay_ns + uniform[0, jitter_ns) of delay,
+//    drawn independently (asymmetric paths); every spike_every-th exchange
+//    adds spike_ns on the way back.
+//  - Deterministic: a seeded xorshift generator, no wall clock.
+//
+// Usage:
+//   ClockSyncLoopback net(desc);
+//   sync.AddSample(net.Exchange(client_mono_ns));
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/core/time/clock_sync.h"
+
+namespace navary::core::time {
+
+struct ClockSyncLoopbackDesc {
+  std::int64_t server_offset_ns = 0;
+  double server_drift_ppm       = 0.0;
+  std::uint64_t base_delay_ns   = MsToNs(20);  // one way
+  std::uint64_t jitter_ns       = MsToNs(5);   // per direction
+  std::uint64_t server_hold_ns  = UsToNs(200);
+  std::uint32_t spike_every     = 0;  // 0: no spikes
+  std::uint64_t spike_ns        = MsToNs(150);
+  std::uint64_t seed            = 0x9E3779B97F4A7C15ull;
+};
+
+class ClockSyncLoopback {
+ public:
+  explicit ClockSyncLoopback(const ClockSyncLoopbackDesc& desc)
+      : desc_(desc), state_(desc.seed ? desc.seed : 1), exchanges_(0) {}
+
+  // True server time at client monotonic |mono_ns|.
+  std::uint64_t ServerNowNs(std::uint64_t mono_ns) const {
+    const double drift = static_cast<double>(mono_ns) *
+                         (desc_.server_drift_ppm * 1e-6);
+    return static_cast<std::uint64_t>(static_cast<std::int64_t>(mono_ns) +
+                                      static_cast<std::int64_t>(drift) +
+                                      desc_.server_offset_ns);
+  }
+
+  // Simulates one ping sent at |client_send_ns| and its pong.
+  ClockSyncSample Exchange(std::uint64_t client_send_ns) {
+    ++exchanges_;
+    const std::uint64_t up = desc_.base_delay_ns + Jitter();
+    std::uint64_t down     = desc_.base_delay_ns + Jitter();
+    if (desc_.spike_every != 0 && exchanges_ % desc_.spike_every == 0) {
+      down += desc_.spike_ns;
+    }
+
+    const std::uint64_t arrive = client_send_ns + up;
+    const std::uint64_t depart = arrive + desc_.server_hold_ns;
+
+    ClockSyncSample s;
+    s.client_send_ns = client_send_ns;
+    s.server_recv_ns = ServerNowNs(arrive);
+    s.server_send_ns = ServerNowNs(depart);
+    s.client_recv_ns = depart + down;
+    return s;
+  }
+
+  std::uint32_t exchanges() const {
+    return exchanges_;
+  }
+
+ private:
+  std::uint64_t Jitter() {
+    if (desc_.jitter_ns == 0) {
+      return 0;
+    }
+    state_ ^= state_ << 13;
+    state_ ^= state_ >> 7;
+    state_ ^= state_ << 17;
+    return state_ % desc_.jitter_ns;
+  }
+
+  ClockSyncLoopbackDesc desc_;
+  std::uint64_t state_;
+  std::uint32_t exchanges_;
+};
+
+}  // namespace navary::core::time
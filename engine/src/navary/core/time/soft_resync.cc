@@ -24,6 +24,10 @@ void SoftResync::Reset() {
   bias_ns_ = 0;
 }
 
+void SoftResync::SetBiasNs(std::int64_t bias_ns) {
+  bias_ns_ = bias_ns;
+}
+
 std::int64_t SoftResync::Update(std::uint64_t mono_ns, std::uint64_t wall_ns) {
   if (target_window_ns_ == 0){
     return bias_ns_;
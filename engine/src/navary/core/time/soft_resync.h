@@ -56,6 +56,10 @@ class SoftResync {
   // Reset the internal bias to 0.
   void Reset();
 
+  // Hard-set the bias (a step, not a slew). Only for the initial sync or
+  // after a reset, before ticks depend on the adjusted time.
+  void SetBiasNs(std::int64_t bias_ns);
+
   // Perform a correction step using the current wall and monotonic times.
   // wall_ns:  system_clock-derived timestamp (converted to ns)
   // mono_ns:  monotonic timestamp (MonotonicNowNs)
@@ -0,0 +1,441 @@
+// Navary Engine - Effects Subsystem
+// File: navary/effects/particle_emitter.cc
+// Purpose: ParticleEmitter spawn, SIMD update kernel, branch-free
+//          compaction and ring upload.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/effects/particle_emitter.h"
+
+#include <bit>
+#include <cstdlib>
+#include <limits>
+
+#include "navary/math/simd4.h"
+
+namespace navary::effects {
+
+namespace {
+
+namespace simd = math::simd4;
+
+float Clamp01(float v) {
+  return v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v);
+}
+
+std::uint32_t PackColor(const ParticleCurve* curves, float t) {
+  std::uint32_t rgba = 0;
+  for (std::uint32_t c = 0; c < 4; ++c) {
+    const float v = Clamp01(curves[c].Evaluate(t)) * 255.0f + 0.5f;
+    rgba |= static_cast<std::uint32_t>(v) << (8 * c);
+  }
+  return rgba;
+}
+
+simd::F4 EvaluateCurve(const ParticleCurve& k, simd::F4 t) {
+  simd::F4 r = simd::MulAdd(simd::Splat(k.a), t, simd::Splat(k.b));
+  r          = simd::MulAdd(r, t, simd::Splat(k.c));
+  return simd::MulAdd(r, t, simd::Splat(k.d));
+}
+
+// Curve value scaled to a byte, still in int lanes.
+simd::I4 ColorChannel(const ParticleCurve& k, simd::F4 t) {
+  const simd::F4 v = simd::Clamp(EvaluateCurve(k, t), simd::Splat(0.0f),
+                                 simd::Splat(1.0f));
+  return simd::ToInt(simd::Mul(v, simd::Splat(255.0f)));
+}
+
+template <typename T>
+T* AllocArray(std::uint32_t n) {
+  return static_cast<T*>(std::malloc(sizeof(T) * n));
+}
+
+}  // namespace
+
+ParticleCurve ParticleCurve::Bezier(float p0, float p1, float p2,
+                                    float p3) {
+  ParticleCurve k;
+  k.a = -p0 + 3.0f * p1 - 3.0f * p2 + p3;
+  k.b = 3.0f * p0 - 6.0f * p1 + 3.0f * p2;
+  k.c = -3.0f * p0 + 3.0f * p1;
+  k.d = p0;
+  return k;
+}
+
+ParticleCurve ParticleCurve::Constant(float v) {
+  ParticleCurve k;
+  k.d = v;
+  return k;
+}
+
+ParticleCurve ParticleCurve::Linear(float from, float to) {
+  ParticleCurve k;
+  k.c = to - from;
+  k.d = from;
+  return k;
+}
+
+ParticleEmitter::ParticleEmitter()
+    : capacity_(0),
+      count_(0),
+      spawn_rate_(0.0f),
+      spawn_accum_(0.0f),
+      lifetime_min_(1.0f),
+      lifetime_max_(1.0f),
+      position_(0.0f, 0.0f, 0.0f),
+      spawn_radius_(0.0f),
+      velocity_min_(0.0f, 0.0f, 0.0f),
+      velocity_max_(0.0f, 0.0f, 0.0f),
+      gravity_(0.0f, 0.0f, 0.0f),
+      drag_(0.0f),
+      rng_(1),
+      px_(nullptr),
+      py_(nullptr),
+      pz_(nullptr),
+      vx_(nullptr),
+      vy_(nullptr),
+      vz_(nullptr),
+      age_(nullptr),
+      age_rate_(nullptr),
+      size_(nullptr),
+      color_(nullptr) {}
+
+ParticleEmitter::~ParticleEmitter() {
+  Shutdown();
+}
+
+NavaryRC ParticleEmitter::Init(const Desc& desc) {
+  if (px_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "ParticleEmitter: already initialized");
+  }
+  if (desc.max_particles == 0 || !(desc.lifetime_min > 0.0f) ||
+      desc.lifetime_max < desc.lifetime_min || desc.spawn_rate < 0.0f ||
+      desc.drag < 0.0f) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "ParticleEmitter: invalid descriptor");
+  }
+
+  const std::uint32_t n = desc.max_particles;
+  px_                   = AllocArray<float>(n);
+  py_                   = AllocArray<float>(n);
+  pz_                   = AllocArray<float>(n);
+  vx_                   = AllocArray<float>(n);
+  vy_                   = AllocArray<float>(n);
+  vz_                   = AllocArray<float>(n);
+  age_                  = AllocArray<float>(n);
+  age_rate_             = AllocArray<float>(n);
+  size_                 = AllocArray<float>(n);
+  color_                = AllocArray<std::uint32_t>(n);
+  if (px_ == nullptr || py_ == nullptr || pz_ == nullptr || vx_ == nullptr ||
+      vy_ == nullptr || vz_ == nullptr || age_ == nullptr ||
+      age_rate_ == nullptr || size_ == nullptr || color_ == nullptr) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "ParticleEmitter: alloc failed");
+  }
+
+  capacity_       = n;
+  count_          = 0;
+  spawn_rate_     = desc.spawn_rate;
+  spawn_accum_    = 0.0f;
+  lifetime_min_   = desc.lifetime_min;
+  lifetime_max_   = desc.lifetime_max;
+  position_       = desc.position;
+  spawn_radius_   = desc.spawn_radius;
+  velocity_min_   = desc.velocity_min;
+  velocity_max_   = desc.velocity_max;
+  gravity_        = desc.gravity;
+  drag_           = desc.drag;
+  rng_            = desc.seed != 0 ? desc.seed : 1;  // xorshift needs != 0
+  size_curve_     = desc.size;
+  color_curve_[0] = desc.color_r;
+  color_curve_[1] = desc.color_g;
+  color_curve_[2] = desc.color_b;
+  color_curve_[3] = desc.color_a;
+  bounds_.SetEmpty();
+  return NavaryRC::OK();
+}
+
+void ParticleEmitter::Shutdown() {
+  std::free(px_);
+  std::free(py_);
+  std::free(pz_);
+  std::free(vx_);
+  std::free(vy_);
+  std::free(vz_);
+  std::free(age_);
+  std::free(age_rate_);
+  std::free(size_);
+  std::free(color_);
+  px_       = nullptr;
+  py_       = nullptr;
+  pz_       = nullptr;
+  vx_       = nullptr;
+  vy_       = nullptr;
+  vz_       = nullptr;
+  age_      = nullptr;
+  age_rate_ = nullptr;
+  size_     = nullptr;
+  color_    = nullptr;
+  capacity_ = 0;
+  count_    = 0;
+  bounds_.SetEmpty();
+}
+
+float ParticleEmitter::NextFloat() {
+  rng_ ^= rng_ << 13;
+  rng_ ^= rng_ >> 17;
+  rng_ ^= rng_ << 5;
+  return static_cast<float>(rng_ >> 8) * (1.0f / 16777216.0f);
+}
+
+void ParticleEmitter::Spawn(std::uint32_t n) {
+  const float r           = spawn_radius_;
+  const std::uint32_t end = count_ + n;
+  for (std::uint32_t i = count_; i < end; ++i) {
+    px_[i] = position_.x + (NextFloat() * 2.0f - 1.0f) * r;
+    py_[i] = position_.y + (NextFloat() * 2.0f - 1.0f) * r;
+    pz_[i] = position_.z + (NextFloat() * 2.0f - 1.0f) * r;
+    vx_[i] = velocity_min_.x + (velocity_max_.x - velocity_min_.x) *
+                                   NextFloat();
+    vy_[i] = velocity_min_.y + (velocity_max_.y - velocity_min_.y) *
+                                   NextFloat();
+    vz_[i] = velocity_min_.z + (velocity_max_.z - velocity_min_.z) *
+                                   NextFloat();
+    const float life =
+        lifetime_min_ + (lifetime_max_ - lifetime_min_) * NextFloat();
+    age_[i]      = 0.0f;
+    age_rate_[i] = 1.0f / life;
+    size_[i]     = size_curve_.Evaluate(0.0f);
+    color_[i]    = PackColor(color_curve_, 0.0f);
+  }
+  count_ = end;
+}
+
+std::uint32_t ParticleEmitter::Burst(std::uint32_t n) {
+  const std::uint32_t free_slots = capacity_ - count_;
+  n = n < free_slots ? n : free_slots;
+  Spawn(n);
+  return n;
+}
+
+void ParticleEmitter::Clear() {
+  count_ = 0;
+  bounds_.SetEmpty();
+}
+
+void ParticleEmitter::Update(float dt) {
+  if (capacity_ == 0) {
+    return;
+  }
+  spawn_accum_ += spawn_rate_ * dt;
+  const std::uint32_t want = static_cast<std::uint32_t>(spawn_accum_);
+  spawn_accum_ -= static_cast<float>(want);
+  Burst(want);  // overflow beyond capacity is dropped, not queued
+
+  if (Simulate(dt) != 0) {
+    Compact();
+  }
+}
+
+std::uint32_t ParticleEmitter::Simulate(float dt) {
+  const float inf  = std::numeric_limits<float>::infinity();
+  const float damp = drag_ * dt < 1.0f ? 1.0f - drag_ * dt : 0.0f;
+  const float gx   = gravity_.x * dt;
+  const float gy   = gravity_.y * dt;
+  const float gz   = gravity_.z * dt;
+
+  const simd::F4 v_dt   = simd::Splat(dt);
+  const simd::F4 v_damp = simd::Splat(damp);
+  const simd::F4 v_gx   = simd::Splat(gx);
+  const simd::F4 v_gy   = simd::Splat(gy);
+  const simd::F4 v_gz   = simd::Splat(gz);
+  const simd::F4 v_one  = simd::Splat(1.0f);
+  const simd::F4 v_pinf = simd::Splat(inf);
+  const simd::F4 v_ninf = simd::Splat(-inf);
+  const simd::F4 v_zero = simd::Splat(0.0f);
+
+  simd::F4 min_x = v_pinf, min_y = v_pinf, min_z = v_pinf;
+  simd::F4 max_x = v_ninf, max_y = v_ninf, max_z = v_ninf;
+  simd::F4 max_size   = v_zero;
+  std::uint32_t alive = 0;
+
+  const std::uint32_t n  = count_;
+  const std::uint32_t n4 = n & ~3u;
+  auto* color            = reinterpret_cast<std::int32_t*>(color_);
+  for (std::uint32_t i = 0; i < n4; i += 4) {
+    // v = (v + g dt) * damp; p += v dt.
+    const simd::F4 vx =
+        simd::Mul(simd::Add(simd::Load(vx_ + i), v_gx), v_damp);
+    const simd::F4 vy =
+        simd::Mul(simd::Add(simd::Load(vy_ + i), v_gy), v_damp);
+    const simd::F4 vz =
+        simd::Mul(simd::Add(simd::Load(vz_ + i), v_gz), v_damp);
+    const simd::F4 px = simd::MulAdd(vx, v_dt, simd::Load(px_ + i));
+    const simd::F4 py = simd::MulAdd(vy, v_dt, simd::Load(py_ + i));
+    const simd::F4 pz = simd::MulAdd(vz, v_dt, simd::Load(pz_ + i));
+    simd::Store(vx_ + i, vx);
+    simd::Store(vy_ + i, vy);
+    simd::Store(vz_ + i, vz);
+    simd::Store(px_ + i, px);
+    simd::Store(py_ + i, py);
+    simd::Store(pz_ + i, pz);
+
+    const simd::F4 age =
+        simd::MulAdd(simd::Load(age_rate_ + i), v_dt, simd::Load(age_ + i));
+    simd::Store(age_ + i, age);
+    const simd::F4 t    = simd::Min(age, v_one);
+    const simd::F4 size = EvaluateCurve(size_curve_, t);
+    simd::Store(size_ + i, size);
+
+    simd::I4 rgba = ColorChannel(color_curve_[0], t);
+    rgba = simd::OrI(rgba,
+                     simd::ShiftLeftI<8>(ColorChannel(color_curve_[1], t)));
+    rgba = simd::OrI(rgba,
+                     simd::ShiftLeftI<16>(ColorChannel(color_curve_[2], t)));
+    rgba = simd::OrI(rgba,
+                     simd::ShiftLeftI<24>(ColorChannel(color_curve_[3], t)));
+    simd::StoreI(color + i, rgba);
+
+    // Bounds over living lanes only; dead lanes contribute +-inf / 0.
+    const simd::F4 live = simd::CmpLt(age, v_one);
+    alive += static_cast<std::uint32_t>(
+        std::popcount(static_cast<unsigned>(simd::MoveMask(live))));
+    min_x    = simd::Min(min_x, simd::Select(live, px, v_pinf));
+    min_y    = simd::Min(min_y, simd::Select(live, py, v_pinf));
+    min_z    = simd::Min(min_z, simd::Select(live, pz, v_pinf));
+    max_x    = simd::Max(max_x, simd::Select(live, px, v_ninf));
+    max_y    = simd::Max(max_y, simd::Select(live, py, v_ninf));
+    max_z    = simd::Max(max_z, simd::Select(live, pz, v_ninf));
+    max_size = simd::Max(max_size, simd::Select(live, size, v_zero));
+  }
+
+  float mnx = simd::ReduceMin(min_x), mny = simd::ReduceMin(min_y);
+  float mnz = simd::ReduceMin(min_z), mxx = simd::ReduceMax(max_x);
+  float mxy = simd::ReduceMax(max_y), mxz = simd::ReduceMax(max_z);
+  float msz = simd::ReduceMax(max_size);
+
+  // Scalar tail, same math.
+  for (std::uint32_t i = n4; i < n; ++i) {
+    vx_[i] = (vx_[i] + gx) * damp;
+    vy_[i] = (vy_[i] + gy) * damp;
+    vz_[i] = (vz_[i] + gz) * damp;
+    px_[i] += vx_[i] * dt;
+    py_[i] += vy_[i] * dt;
+    pz_[i] += vz_[i] * dt;
+    age_[i] += age_rate_[i] * dt;
+    const float t = age_[i] < 1.0f ? age_[i] : 1.0f;
+    size_[i]      = size_curve_.Evaluate(t);
+    color_[i]     = PackColor(color_curve_, t);
+    if (age_[i] < 1.0f) {
+      ++alive;
+      mnx = px_[i] < mnx ? px_[i] : mnx;
+      mny = py_[i] < mny ? py_[i] : mny;
+      mnz = pz_[i] < mnz ? pz_[i] : mnz;
+      mxx = px_[i] > mxx ? px_[i] : mxx;
+      mxy = py_[i] > mxy ? py_[i] : mxy;
+      mxz = pz_[i] > mxz ? pz_[i] : mxz;
+      msz = size_[i] > msz ? size_[i] : msz;
+    }
+  }
+
+  if (alive == 0) {
+    bounds_.SetEmpty();
+  } else {
+    const float h = 0.5f * msz;  // size is the billboard's full width
+    bounds_ = math::Aabb(math::Vec3(mnx - h, mny - h, mnz - h),
+                         math::Vec3(mxx + h, mxy + h, mxz + h));
+  }
+  return n - alive;
+}
+
+void ParticleEmitter::Compact() {
+  // Stable and branch-free: every slot is copied down, the write index
+  // only advances past survivors.
+  std::uint32_t w = 0;
+  for (std::uint32_t r = 0; r < count_; ++r) {
+    const float age = age_[r];
+    px_[w]          = px_[r];
+    py_[w]          = py_[r];
+    pz_[w]          = pz_[r];
+    vx_[w]          = vx_[r];
+    vy_[w]          = vy_[r];
+    vz_[w]          = vz_[r];
+    age_[w]         = age;
+    age_rate_[w]    = age_rate_[r];
+    size_[w]        = size_[r];
+    color_[w]       = color_[r];
+    w += static_cast<std::uint32_t>(age < 1.0f);
+  }
+  count_ = w;
+}
+
+NavaryResult<render::v1::BufferSlice> ParticleEmitter::WriteInstances(
+    render::v1::GpuRingBuffer* ring) const {
+  if (ring == nullptr) {
+    return NavaryResult<render::v1::BufferSlice>(
+        NavaryRC(NavaryStatus::kInvalidArgument,
+                 "ParticleEmitter: null ring buffer"));
+  }
+  if (count_ == 0) {
+    return NavaryResult<render::v1::BufferSlice>(
+        render::v1::BufferSlice{ring->handle(), 0, 0});
+  }
+
+  NavaryResult<render::v1::BufferReservation> res_or =
+      ring->Reserve(sizeof(ParticleInstance) * count_, 16);
+  if (!res_or.status().ok()) {
+    return NavaryResult<render::v1::BufferSlice>(res_or.status());
+  }
+  const render::v1::BufferReservation res = res_or.value();
+
+  // SoA -> AoS straight into mapped (write-combined) memory: one
+  // sequential write stream, nothing read back.
+  auto* dst = reinterpret_cast<ParticleInstance*>(res.data);
+  for (std::uint32_t i = 0; i < count_; ++i) {
+    dst[i].x    = px_[i];
+    dst[i].y    = py_[i];
+    dst[i].z    = pz_[i];
+    dst[i].size = size_[i];
+    dst[i].rgba = color_[i];
+  }
+  return NavaryResult<render::v1::BufferSlice>(res.slice);
+}
+
+NavaryResult<std::uint32_t> UploadVisibleEmitters(
+    const ParticleEmitter* const* emitters, std::uint32_t count,
+    const math::Frustum& frustum, render::v1::GpuRingBuffer* ring,
+    ParticleDraw* out_draws) {
+  if ((count != 0 && (emitters == nullptr || out_draws == nullptr)) ||
+      ring == nullptr) {
+    return NavaryResult<std::uint32_t>(
+        NavaryRC(NavaryStatus::kInvalidArgument,
+                 "UploadVisibleEmitters: null argument"));
+  }
+
+  std::uint32_t draws = 0;
+  for (std::uint32_t i = 0; i < count; ++i) {
+    const ParticleEmitter* e = emitters[i];
+    if (e == nullptr || e->count() == 0) {
+      continue;
+    }
+    const math::Aabb& b = e->bounds();
+    if (!frustum.IsAabbVisible(b.min(), b.max())) {
+      continue;
+    }
+    NavaryResult<render::v1::BufferSlice> slice_or = e->WriteInstances(ring);
+    if (!slice_or.status().ok()) {
+      return NavaryResult<std::uint32_t>(slice_or.status());
+    }
+    out_draws[draws].emitter_index  = i;
+    out_draws[draws].instance_count = e->count();
+    out_draws[draws].slice          = slice_or.value();
+    ++draws;
+  }
+  return NavaryResult<std::uint32_t>(draws);
+}
+
+}  // namespace navary::effects
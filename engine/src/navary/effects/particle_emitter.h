@@ -0,0 +1,225 @@
+#pragma once
+// Navary Engine - Effects Subsystem
+// File: navary/effects/particle_emitter.h
+// Purpose: CPU particle emitters stored as SoA pools, updated with 4-wide
+//          SIMD kernels and uploaded straight into a GpuRingBuffer.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - Each attribute lives in its own array (px, py, pz, vx, vy, vz, age,
+//     age_rate, size, color), so the update kernel streams contiguous
+//     floats four lanes at a time through math/simd4.h.
+//   - Update(dt) spawns (fixed rate with a fractional accumulator), then
+//     one kernel integrates gravity and drag, advances normalized age,
+//     evaluates the size and color curves and folds the living particles
+//     into the emitter bounds. Dead particles are compacted out afterwards
+//     with a branch-free stable pass (copy always, advance the write index
+//     by the alive bit); the pass is skipped when nothing died.
+//   - Curves are cubic Beziers over normalized age, stored in power basis
+//     so a lane evaluates one with three multiply-adds.
+//   - bounds() covers every living particle including its size, for
+//     frustum culling of the whole emitter. UploadVisibleEmitters() culls
+//     a set of emitters and writes the visible ones' instances directly
+//     into ring memory (no staging copy).
+//
+// Notes:
+//   - Capacity is fixed at Init(); spawns beyond it are dropped.
+//   - Randomness is a per-emitter xorshift seeded from Desc::seed, so a
+//     given seed and dt sequence always produces the same particles.
+//   - Particles are simulated in world space; moving the emitter
+//     (set_position) only affects new spawns.
+//   - Budget: 100k particles in about 1 ms of one core (see
+//     effects/ParticleEmitter::Update in navary-bench).
+//
+// Example:
+// ```cpp
+//   navary::effects::ParticleEmitter::Desc desc;
+//   desc.max_particles = 4096;
+//   desc.spawn_rate    = 800.0f;
+//   desc.color_a       = ParticleCurve::Linear(1.0f, 0.0f);  // fade out
+//   emitter.Init(desc);
+//   ...
+//   emitter.Update(dt);
+//   UploadVisibleEmitters(emitters, n, frustum, &ring, draws);
+// ```
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/math/aabb.h"
+#include "navary/math/frustum.h"
+#include "navary/math/vec3.h"
+#include "navary/navary_status.h"
+#include "navary/render/v1/gpu_ring_buffer.h"
+
+namespace navary::effects {
+
+// Cubic Bezier over t in [0, 1] with control values p0..p3, kept in power
+// basis: f(t) = ((a t + b) t + c) t + d.
+struct ParticleCurve {
+  float a = 0.0f;
+  float b = 0.0f;
+  float c = 0.0f;
+  float d = 0.0f;
+
+  static ParticleCurve Bezier(float p0, float p1, float p2, float p3);
+  static ParticleCurve Constant(float v);
+  static ParticleCurve Linear(float from, float to);
+
+  float Evaluate(float t) const {
+    return ((a * t + b) * t + c) * t + d;
+  }
+};
+
+// One particle as the GPU sees it: per-instance vertex attributes
+// (VK_VERTEX_INPUT_RATE_INSTANCE), stride 20.
+struct ParticleInstance {
+  float x;
+  float y;
+  float z;
+  float size;
+  std::uint32_t rgba;  // R in the low byte (VK_FORMAT_R8G8B8A8_UNORM)
+};
+
+static_assert(sizeof(ParticleInstance) == 20,
+              "ParticleInstance must be tightly packed");
+
+class ParticleEmitter {
+ public:
+  struct Desc {
+    std::uint32_t max_particles = 4096;
+    float spawn_rate            = 100.0f;  // particles per second
+    float lifetime_min          = 1.0f;    // seconds
+    float lifetime_max          = 2.0f;
+    math::Vec3 position         = math::Vec3(0.0f, 0.0f, 0.0f);
+    float spawn_radius          = 0.0f;  // half-extent of the spawn cube
+    math::Vec3 velocity_min     = math::Vec3(-1.0f, 2.0f, -1.0f);
+    math::Vec3 velocity_max     = math::Vec3(1.0f, 4.0f, 1.0f);
+    math::Vec3 gravity          = math::Vec3(0.0f, -9.81f, 0.0f);
+    float drag                  = 0.0f;  // fraction of velocity lost / s
+    std::uint32_t seed          = 1;
+    ParticleCurve size          = ParticleCurve::Constant(0.1f);
+    ParticleCurve color_r       = ParticleCurve::Constant(1.0f);
+    ParticleCurve color_g       = ParticleCurve::Constant(1.0f);
+    ParticleCurve color_b       = ParticleCurve::Constant(1.0f);
+    ParticleCurve color_a       = ParticleCurve::Constant(1.0f);
+  };
+
+  ParticleEmitter();
+  ~ParticleEmitter();
+
+  ParticleEmitter(const ParticleEmitter&)            = delete;
+  ParticleEmitter& operator=(const ParticleEmitter&) = delete;
+
+  NavaryRC Init(const Desc& desc);
+  void Shutdown();
+
+  // Spawns, simulates |dt| seconds, retires expired particles and
+  // recomputes bounds().
+  void Update(float dt);
+
+  // Spawns |n| particles now (clamped to the free capacity), independent
+  // of spawn_rate. Returns how many were spawned.
+  std::uint32_t Burst(std::uint32_t n);
+
+  // Drops every particle; the spawn accumulator and RNG keep going.
+  void Clear();
+
+  void set_position(const math::Vec3& p) {
+    position_ = p;
+  }
+  void set_spawn_rate(float rate) {
+    spawn_rate_ = rate;
+  }
+
+  // Reserves count() instances in |ring| and fills them in place. An
+  // empty emitter returns an empty slice without touching the ring.
+  NavaryResult<render::v1::BufferSlice> WriteInstances(
+      render::v1::GpuRingBuffer* ring) const;
+
+  std::uint32_t count() const {
+    return count_;
+  }
+  std::uint32_t capacity() const {
+    return capacity_;
+  }
+  // Empty when there are no particles.
+  const math::Aabb& bounds() const {
+    return bounds_;
+  }
+
+  // Read-only SoA views, count() entries each. Age is normalized: 0 at
+  // spawn, >= 1 once expired.
+  const float* positions_x() const {
+    return px_;
+  }
+  const float* positions_y() const {
+    return py_;
+  }
+  const float* positions_z() const {
+    return pz_;
+  }
+  const float* ages() const {
+    return age_;
+  }
+  const float* sizes() const {
+    return size_;
+  }
+  const std::uint32_t* colors() const {
+    return color_;
+  }
+
+ private:
+  void Spawn(std::uint32_t n);
+  // Returns the number of particles whose age reached 1.
+  std::uint32_t Simulate(float dt);
+  void Compact();
+  float NextFloat();  // [0, 1)
+
+  std::uint32_t capacity_;
+  std::uint32_t count_;
+  float spawn_rate_;
+  float spawn_accum_;
+  float lifetime_min_;
+  float lifetime_max_;
+  math::Vec3 position_;
+  float spawn_radius_;
+  math::Vec3 velocity_min_;
+  math::Vec3 velocity_max_;
+  math::Vec3 gravity_;
+  float drag_;
+  std::uint32_t rng_;
+  ParticleCurve size_curve_;
+  ParticleCurve color_curve_[4];  // r, g, b, a
+  math::Aabb bounds_;
+
+  float* px_;
+  float* py_;
+  float* pz_;
+  float* vx_;
+  float* vy_;
+  float* vz_;
+  float* age_;
+  float* age_rate_;  // 1 / lifetime
+  float* size_;
+  std::uint32_t* color_;
+};
+
+// Instances of one visible emitter inside the ring.
+struct ParticleDraw {
+  std::uint32_t emitter_index;
+  std::uint32_t instance_count;
+  render::v1::BufferSlice slice;
+};
+
+// Culls |emitters| against |frustum| by bounds() and writes every visible,
+// non-empty one into |ring|. |out_draws| needs room for |count| entries;
+// returns how many were written, or the first ring failure.
+NavaryResult<std::uint32_t> UploadVisibleEmitters(
+    const ParticleEmitter* const* emitters, std::uint32_t count,
+    const math::Frustum& frustum, render::v1::GpuRingBuffer* ring,
+    ParticleDraw* out_draws);
+
+}  // namespace navary::effects
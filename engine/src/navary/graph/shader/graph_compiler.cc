@@ -431,4 +431,12 @@ NavaryResult<std::string> GraphCompiler::GenerateUserSurfaceGlSl(
   return NavaryResult<std::string>(src);
 }
 
+core::ShaderHash HashUserSurfaceGlsl(const std::string& glsl) {
+  std::uint32_t h = 2166136261u;
+  for (const char c : glsl) {
+    h = (h ^ static_cast<std::uint8_t>(c)) * 16777619u;
+  }
+  return core::ShaderHash{h};
+}
+
 }  // namespace navary::graph::shader
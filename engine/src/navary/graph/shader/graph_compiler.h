@@ -9,6 +9,7 @@
 #include <string>
 
 #include "navary/navary_status.h"
+#include "navary/core/handles.h"
 #include "navary/graph/shader/graph_ir.h"
 
 namespace navary::graph::shader {
@@ -80,4 +81,9 @@ class GraphCompiler {
                            std::string* out, std::string* pin_exprs) const;
 };
 
+// Hash of generated GLSL, used as ShaderKey::graph_hash (FNV-1a).
+// Hashing the output rather than the .navgraph bytes means editor-only
+// changes (string table, unused nodes) do not invalidate pipelines.
+core::ShaderHash HashUserSurfaceGlsl(const std::string& glsl);
+
 }  // namespace navary::graph::shader
\ No newline at end of file
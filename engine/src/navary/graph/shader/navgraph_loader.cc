@@ -156,7 +156,7 @@ NavaryRC NavGraphLoader::LoadFromMemory(const std::uint8_t* data,
     dst.id                        = NodeId{src.id};
 
     NodeOp op;
-    Status st = MapNodeKindToNodeOp(static_cast<NodeKind>(src.kind), &op);
+    NavaryRC st = MapNodeKindToNodeOp(static_cast<NodeKind>(src.kind), &op);
     if (!st.ok()) {
       delete[] nodes;
       delete[] pins;
@@ -192,4 +192,21 @@ NavaryRC NavGraphLoader::LoadFromMemory(const std::uint8_t* data,
   return NavaryRC::OK();
 }
 
+NavaryRC NavGraphLoader::LoadFromSpan(memory::Span<const std::uint8_t> bytes,
+                                      GraphIr* out) {
+  if (bytes.size() > UINT32_MAX) {
+    return NavaryRC(NavaryStatus::kParseError,
+                    "NavGraphLoader: buffer too large");
+  }
+  return LoadFromMemory(bytes.data(), static_cast<std::uint32_t>(bytes.size()),
+                        out);
+}
+
+void NavGraphLoader::Release(GraphIr* ir) {
+  delete[] ir->nodes;
+  delete[] ir->pins;
+  delete[] ir->param_values;
+  *ir = GraphIr{};
+}
+
 }  // namespace navary::graph::shader
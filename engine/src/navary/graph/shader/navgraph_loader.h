@@ -11,6 +11,7 @@
 #include "navary/navary_status.h"
 #include "navary/graph/shader/graph_ir.h"
 #include "navary/graph/shader/navgraph_binary.h"
+#include "navary/memory/span.h"
 
 namespace navary::graph::shader {
 
@@ -28,6 +29,12 @@ class NavGraphLoader {
   NavaryRC LoadFromMemory(const std::uint8_t* data, std::uint32_t size,
                           GraphIr* out);
 
+  // Same as LoadFromMemory; takes VFS/pack bytes directly (zero copy).
+  NavaryRC LoadFromSpan(memory::Span<const std::uint8_t> bytes, GraphIr* out);
+
+  // Frees the arrays a successful load allocated for |ir| and clears it.
+  static void Release(GraphIr* ir);
+
  private:
   NavaryRC MapNodeKindToNodeOp(NodeKind kind, NodeOp* out) const;
 };
@@ -0,0 +1,364 @@
+// navary/graph/shader/navgraph_writer.cc
+// Implementation of NavGraphWriter (editor graph -> navgraph v1 binary).
+// Used by the editor (Schematik) and asset cookers.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include "navary/graph/shader/navgraph_writer.h"
+
+#include <cstring>
+#include <functional>
+#include <map>
+#include <queue>
+
+#include "navary/graph/shader/node_metadata.h"
+
+namespace navary::graph::shader {
+
+namespace {
+
+constexpr std::uint32_t kNoLink   = 0xFFFFFFFFu;
+constexpr std::uint32_t kMaxIndex = 0xFFFFu;  // 16-bit pin / param fields
+
+std::uint32_t FloatBits(float f) {
+  std::uint32_t bits;
+  std::memcpy(&bits, &f, sizeof(bits));
+  return bits;
+}
+
+// Nodes with effects beyond their outputs are never merged.
+bool IsMergeable(NodeKind kind) {
+  return kind != NodeKind::kMakeSurface && kind != NodeKind::kCustomCode;
+}
+
+}  // namespace
+
+NavGraphWriter::NavGraphWriter(core::SurfaceModel surface_model)
+    : surface_model_(surface_model) {}
+
+void NavGraphWriter::Clear() {
+  nodes_.clear();
+  params_.clear();
+  index_of_.clear();
+}
+
+NavaryRC NavGraphWriter::AddNode(const NavGraphNodeDesc& node) {
+  const NodeMetadata* meta = FindNodeMetadata(node.kind);
+  if (meta == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavGraphWriter: unknown node kind");
+  }
+  if (index_of_.count(node.id) != 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavGraphWriter: duplicate node id");
+  }
+  if (node.input_count < meta->min_inputs ||
+      node.input_count > meta->max_inputs ||
+      node.input_count > kNavGraphMaxInputs ||
+      node.output_count < meta->min_outputs ||
+      node.output_count > meta->max_outputs ||
+      node.output_count > kNavGraphMaxOutputs) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavGraphWriter: pin count outside metadata range");
+  }
+  if (node.param_count != meta->param_count ||
+      (node.param_count > 0 && node.params == nullptr)) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavGraphWriter: param count mismatch");
+  }
+  if ((meta->allowed_surface_models_mask &
+       SurfaceModelToMaskBit(surface_model_)) == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavGraphWriter: node not allowed for surface model");
+  }
+
+  SourceNode src{};
+  src.desc        = node;
+  src.desc.params = nullptr;
+  src.param_begin = static_cast<std::uint32_t>(params_.size());
+  for (std::uint32_t i = 0; i < kNavGraphMaxInputs; ++i) {
+    src.input_node[i] = kNoSource;
+  }
+  params_.insert(params_.end(), node.params, node.params + node.param_count);
+
+  index_of_.emplace(node.id, static_cast<std::uint32_t>(nodes_.size()));
+  nodes_.push_back(src);
+  return NavaryRC::OK();
+}
+
+NavaryRC NavGraphWriter::AddLink(const NavGraphLinkDesc& link) {
+  const auto from = index_of_.find(link.from_node);
+  const auto to   = index_of_.find(link.to_node);
+  if (from == index_of_.end() || to == index_of_.end()) {
+    return NavaryRC(NavaryStatus::kNotFound, "NavGraphWriter: unknown node");
+  }
+  const SourceNode& src = nodes_[from->second];
+  SourceNode& dst       = nodes_[to->second];
+  if (link.from_output >= src.desc.output_count ||
+      link.to_input >= dst.desc.input_count) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavGraphWriter: pin index out of range");
+  }
+  if (src.desc.output_types[link.from_output] !=
+      dst.desc.input_types[link.to_input]) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavGraphWriter: pin type mismatch");
+  }
+  if (dst.input_node[link.to_input] != kNoSource) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavGraphWriter: input already linked");
+  }
+  dst.input_node[link.to_input]   = from->second;
+  dst.input_output[link.to_input] = link.from_output;
+  return NavaryRC::OK();
+}
+
+NavaryRC NavGraphWriter::SortReachable(
+    std::uint32_t surface, std::vector<std::uint32_t>* order) const {
+  const std::uint32_t n = static_cast<std::uint32_t>(nodes_.size());
+
+  // Mark everything feeding the surface node.
+  std::vector<std::uint8_t> reachable(n, 0);
+  std::vector<std::uint32_t> stack(1, surface);
+  reachable[surface]            = 1;
+  std::uint32_t reachable_count = 1;
+  while (!stack.empty()) {
+    const SourceNode& node = nodes_[stack.back()];
+    stack.pop_back();
+    for (std::uint32_t i = 0; i < node.desc.input_count; ++i) {
+      const std::uint32_t src = node.input_node[i];
+      if (src != kNoSource && !reachable[src]) {
+        reachable[src] = 1;
+        ++reachable_count;
+        stack.push_back(src);
+      }
+    }
+  }
+
+  // Kahn over the reachable subgraph; the heap orders ready nodes by
+  // caller id so the output does not depend on insertion order.
+  std::vector<std::uint32_t> pending(n, 0);
+  std::vector<std::vector<std::uint32_t>> consumers(n);
+  for (std::uint32_t i = 0; i < n; ++i) {
+    if (!reachable[i]) {
+      continue;
+    }
+    for (std::uint32_t j = 0; j < nodes_[i].desc.input_count; ++j) {
+      const std::uint32_t src = nodes_[i].input_node[j];
+      if (src != kNoSource) {
+        ++pending[i];
+        consumers[src].push_back(i);
+      }
+    }
+  }
+
+  using Ready = std::pair<std::uint32_t, std::uint32_t>;  // (id, index)
+  std::priority_queue<Ready, std::vector<Ready>, std::greater<Ready>> ready;
+  for (std::uint32_t i = 0; i < n; ++i) {
+    if (reachable[i] && pending[i] == 0) {
+      ready.push({nodes_[i].desc.id, i});
+    }
+  }
+  order->clear();
+  while (!ready.empty()) {
+    const std::uint32_t i = ready.top().second;
+    ready.pop();
+    order->push_back(i);
+    for (std::uint32_t c : consumers[i]) {
+      if (--pending[c] == 0) {
+        ready.push({nodes_[c].desc.id, c});
+      }
+    }
+  }
+  if (order->size() != reachable_count) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavGraphWriter: graph has a cycle");
+  }
+  return NavaryRC::OK();
+}
+
+NavaryRC NavGraphWriter::Build(std::vector<std::uint8_t>* out,
+                               NavGraphWriteStats* stats) const {
+  if (out == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavGraphWriter: null argument");
+  }
+
+  std::uint32_t surface       = kNoSource;
+  std::uint32_t surface_count = 0;
+  for (std::uint32_t i = 0; i < nodes_.size(); ++i) {
+    if (nodes_[i].desc.kind == NodeKind::kMakeSurface) {
+      surface = i;
+      ++surface_count;
+    }
+  }
+  if (surface_count != 1) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavGraphWriter: need exactly one MakeSurface node");
+  }
+
+  std::vector<std::uint32_t> order;
+  NavaryRC rc = SortReachable(surface, &order);
+  if (!rc.ok()) {
+    return rc;
+  }
+
+  // Merge pass in topological order: inputs are already canonical when a
+  // node is keyed, so whole duplicate subgraphs collapse bottom-up.
+  std::vector<std::uint32_t> canon(nodes_.size(), kNoSource);
+  std::vector<std::uint32_t> emitted;
+  std::map<std::vector<std::uint32_t>, std::uint32_t> seen;
+  std::vector<std::uint32_t> key;
+  for (std::uint32_t i : order) {
+    const SourceNode& node    = nodes_[i];
+    const NavGraphNodeDesc& d = node.desc;
+    canon[i]                  = i;
+    if (IsMergeable(d.kind)) {
+      key.clear();
+      key.push_back(static_cast<std::uint32_t>(d.kind));
+      key.push_back(d.input_count | (d.output_count << 8u));
+      for (std::uint32_t j = 0; j < d.input_count; ++j) {
+        const std::uint32_t src = node.input_node[j];
+        key.push_back(static_cast<std::uint32_t>(d.input_types[j]));
+        key.push_back(src == kNoSource ? kNoSource : canon[src]);
+        key.push_back(node.input_output[j]);
+      }
+      for (std::uint32_t j = 0; j < d.output_count; ++j) {
+        key.push_back(static_cast<std::uint32_t>(d.output_types[j]));
+      }
+      for (std::uint32_t j = 0; j < d.param_count; ++j) {
+        key.push_back(FloatBits(params_[node.param_begin + j]));
+      }
+      const auto found = seen.find(key);
+      if (found != seen.end()) {
+        canon[i] = found->second;
+        continue;
+      }
+      seen.emplace(key, i);
+    }
+    emitted.push_back(i);
+  }
+
+  // Dense renumbering, pin layout and param packing.
+  const std::uint32_t count = static_cast<std::uint32_t>(emitted.size());
+  std::vector<std::uint32_t> first_output(nodes_.size(), 0);
+  std::vector<NavGraphNodeRecord> node_records(count);
+  std::vector<NavGraphPinRecord> pin_records;
+  std::vector<float> param_block;
+  std::map<std::vector<std::uint32_t>, std::uint32_t> param_runs;
+  std::uint32_t shared_params = 0;
+
+  for (std::uint32_t k = 0; k < count; ++k) {
+    const SourceNode& node    = nodes_[emitted[k]];
+    const NavGraphNodeDesc& d = node.desc;
+    NavGraphNodeRecord& rec   = node_records[k];
+    const std::uint32_t first = static_cast<std::uint32_t>(pin_records.size());
+    if (first + d.input_count + d.output_count > kMaxIndex) {
+      return NavaryRC(NavaryStatus::kInvalidArgument,
+                      "NavGraphWriter: too many pins");
+    }
+
+    rec.id               = k;
+    rec.kind             = static_cast<std::uint16_t>(d.kind);
+    rec.input_count      = d.input_count;
+    rec.output_count     = d.output_count;
+    rec.first_input_pin  = static_cast<std::uint16_t>(first);
+    rec.first_output_pin = static_cast<std::uint16_t>(first + d.input_count);
+    rec.param_count      = d.param_count;
+    rec.param_offset     = 0;
+
+    for (std::uint32_t j = 0; j < d.input_count; ++j) {
+      const std::uint32_t src = node.input_node[j];
+      NavGraphPinRecord pin{};
+      pin.id          = static_cast<std::uint32_t>(pin_records.size());
+      pin.node_id     = k;
+      pin.type        = static_cast<std::uint16_t>(d.input_types[j]);
+      pin.direction   = static_cast<std::uint8_t>(PinDirectionBinary::kInput);
+      pin.link_pin_id = src == kNoSource
+                            ? kNoLink
+                            : first_output[canon[src]] + node.input_output[j];
+      pin_records.push_back(pin);
+    }
+    first_output[emitted[k]] = rec.first_output_pin;
+    for (std::uint32_t j = 0; j < d.output_count; ++j) {
+      NavGraphPinRecord pin{};
+      pin.id          = static_cast<std::uint32_t>(pin_records.size());
+      pin.node_id     = k;
+      pin.type        = static_cast<std::uint16_t>(d.output_types[j]);
+      pin.direction   = static_cast<std::uint8_t>(PinDirectionBinary::kOutput);
+      pin.link_pin_id = kNoLink;
+      pin_records.push_back(pin);
+    }
+
+    if (d.param_count > 0) {
+      key.assign(d.param_count, 0);
+      for (std::uint32_t j = 0; j < d.param_count; ++j) {
+        key[j] = FloatBits(params_[node.param_begin + j]);
+      }
+      const auto run = param_runs.find(key);
+      if (run != param_runs.end()) {
+        rec.param_offset = static_cast<std::uint16_t>(run->second);
+        shared_params += d.param_count;
+        continue;
+      }
+      const std::uint32_t offset =
+          static_cast<std::uint32_t>(param_block.size());
+      if (offset + d.param_count > kMaxIndex) {
+        return NavaryRC(NavaryStatus::kInvalidArgument,
+                        "NavGraphWriter: param block too large");
+      }
+      param_runs.emplace(key, offset);
+      rec.param_offset = static_cast<std::uint16_t>(offset);
+      param_block.insert(param_block.end(),
+                         params_.begin() + node.param_begin,
+                         params_.begin() + node.param_begin + d.param_count);
+    }
+  }
+
+  const std::size_t node_bytes =
+      node_records.size() * sizeof(NavGraphNodeRecord);
+  const std::size_t pin_bytes =
+      pin_records.size() * sizeof(NavGraphPinRecord);
+  const std::size_t param_bytes = param_block.size() * sizeof(float);
+
+  NavGraphHeader header{};
+  header.magic             = kNavGraphMagic;
+  header.version           = 1;
+  header.node_count        = count;
+  header.pin_count         = static_cast<std::uint32_t>(pin_records.size());
+  header.param_value_count = static_cast<std::uint32_t>(param_block.size());
+  header.string_table_size = 0;
+  header.surface_model     = static_cast<std::uint8_t>(surface_model_);
+  header.file_size         = static_cast<std::uint32_t>(
+      sizeof(header) + node_bytes + pin_bytes + param_bytes);
+
+  out->resize(header.file_size);
+  std::uint8_t* cursor = out->data();
+  std::memcpy(cursor, &header, sizeof(header));
+  cursor += sizeof(header);
+  if (node_bytes > 0) {
+    std::memcpy(cursor, node_records.data(), node_bytes);
+    cursor += node_bytes;
+  }
+  if (pin_bytes > 0) {
+    std::memcpy(cursor, pin_records.data(), pin_bytes);
+    cursor += pin_bytes;
+  }
+  if (param_bytes > 0) {
+    std::memcpy(cursor, param_block.data(), param_bytes);
+  }
+
+  if (stats != nullptr) {
+    const auto source  = static_cast<std::uint32_t>(nodes_.size());
+    const auto visited = static_cast<std::uint32_t>(order.size());
+    stats->source_nodes        = source;
+    stats->emitted_nodes       = count;
+    stats->pruned_nodes        = source - visited;
+    stats->merged_nodes        = visited - count;
+    stats->param_floats        = static_cast<std::uint32_t>(param_block.size());
+    stats->shared_param_floats = shared_params;
+  }
+  return NavaryRC::OK();
+}
+
+}  // namespace navary::graph::shader
@@ -0,0 +1,109 @@
+#pragma once
+
+// navary/graph/shader/navgraph_writer.h
+// Defines NavGraphWriter, which compiles an editor node graph into a
+// navgraph v1 binary laid out exactly as NavGraphLoader consumes it.
+// Used by the editor (Schematik) and asset cookers.
+//
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "navary/core/handles.h"
+#include "navary/graph/shader/navgraph_binary.h"
+#include "navary/navary_status.h"
+
+namespace navary::graph::shader {
+
+constexpr std::uint32_t kNavGraphMaxInputs  = 8;
+constexpr std::uint32_t kNavGraphMaxOutputs = 2;
+
+// One source node. |id| is the caller's (editor) id and only has to be
+// unique; the binary renumbers nodes and pins densely.
+struct NavGraphNodeDesc {
+  std::uint32_t id;
+  NodeKind kind;
+  std::uint8_t input_count;
+  std::uint8_t output_count;
+  ValueTypeBinary input_types[kNavGraphMaxInputs];
+  ValueTypeBinary output_types[kNavGraphMaxOutputs];
+  const float* params;  // copied by AddNode
+  std::uint16_t param_count;
+};
+
+// Connects output |from_output| of |from_node| to input |to_input| of
+// |to_node| (caller ids).
+struct NavGraphLinkDesc {
+  std::uint32_t from_node;
+  std::uint8_t from_output;
+  std::uint32_t to_node;
+  std::uint8_t to_input;
+};
+
+struct NavGraphWriteStats {
+  std::uint32_t source_nodes;
+  std::uint32_t emitted_nodes;
+  std::uint32_t pruned_nodes;         // not feeding the MakeSurface node
+  std::uint32_t merged_nodes;         // identical to an earlier node
+  std::uint32_t param_floats;         // floats in the packed param block
+  std::uint32_t shared_param_floats;  // floats saved by sharing runs
+};
+
+// Build() produces a file the runtime can use without any fix-up:
+//   - nodes validated against kNodeMetadataTable (pin counts, param count,
+//     surface model) and links type-checked, one link per input;
+//   - nodes not feeding the single MakeSurface node dropped;
+//   - identical nodes (same kind, pin types, params and input sources)
+//     merged, so duplicated constants and subgraphs are emitted once;
+//   - nodes topologically sorted, ties broken by caller id, so the same
+//     graph always yields the same bytes;
+//   - each node's input pins then output pins stored contiguously and
+//     input pins carrying the source output pin in link_pin_id;
+//   - params packed into one block, identical runs stored once.
+class NavGraphWriter {
+ public:
+  explicit NavGraphWriter(core::SurfaceModel surface_model);
+
+  // Validates |node| against its metadata and copies it. Fails on an
+  // unknown kind, a duplicate id or counts outside the metadata ranges.
+  NavaryRC AddNode(const NavGraphNodeDesc& node);
+
+  // Fails when an endpoint is unknown or out of range, the pin types
+  // differ, or the input is already linked.
+  NavaryRC AddLink(const NavGraphLinkDesc& link);
+
+  // Serializes the graph. Fails without exactly one MakeSurface node, on
+  // a cycle, or when the result overflows the format's 16-bit indices.
+  NavaryRC Build(std::vector<std::uint8_t>* out,
+                 NavGraphWriteStats* stats = nullptr) const;
+
+  void Clear();
+
+  std::uint32_t node_count() const {
+    return static_cast<std::uint32_t>(nodes_.size());
+  }
+
+ private:
+  static constexpr std::uint32_t kNoSource = 0xFFFFFFFFu;
+
+  struct SourceNode {
+    NavGraphNodeDesc desc;  // params points nowhere; see param_begin
+    std::uint32_t param_begin;
+    // Source node index and output per input, kNoSource when unlinked.
+    std::uint32_t input_node[kNavGraphMaxInputs];
+    std::uint8_t input_output[kNavGraphMaxInputs];
+  };
+
+  NavaryRC SortReachable(std::uint32_t surface,
+                         std::vector<std::uint32_t>* order) const;
+
+  core::SurfaceModel surface_model_;
+  std::vector<SourceNode> nodes_;
+  std::vector<float> params_;
+  std::unordered_map<std::uint32_t, std::uint32_t> index_of_;
+};
+
+}  // namespace navary::graph::shader
@@ -0,0 +1,193 @@
+// Navary Engine - Instrumentation Subsystem
+// File: navary/instrument/perf_counters.cc
+// Purpose: perf_event_open backend for PerfCounterGroup, plus the no-op
+//          path used off Linux.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// The group leader is the first counter that opens; the rest join it so
+// one read(PERF_FORMAT_GROUP) returns every value taken at the same
+// instant. Set NVR_INSTRUMENT_ENABLE_PERF_EVENTS=0 to compile it out.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/instrument/perf_counters.h"
+
+#ifndef NVR_INSTRUMENT_ENABLE_PERF_EVENTS
+#define NVR_INSTRUMENT_ENABLE_PERF_EVENTS 1
+#endif
+
+#if defined(__linux__) && NVR_INSTRUMENT_ENABLE_PERF_EVENTS
+#define NVR_INSTRUMENT_HAS_PERF_EVENTS 1
+#else
+#define NVR_INSTRUMENT_HAS_PERF_EVENTS 0
+#endif
+
+#if NVR_INSTRUMENT_HAS_PERF_EVENTS
+#include <cstring>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace navary::instrument {
+
+namespace {
+
+#if NVR_INSTRUMENT_HAS_PERF_EVENTS
+
+constexpr std::uint64_t kEventConfig[kPerfCounterCount] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+int OpenEvent(std::uint64_t config, int group_fd) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size           = sizeof(attr);
+  attr.type           = PERF_TYPE_HARDWARE;
+  attr.config         = config;
+  attr.disabled       = group_fd < 0 ? 1 : 0;  // leader starts the group
+  attr.exclude_kernel = 1;
+  attr.exclude_hv     = 1;
+  attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                        PERF_FORMAT_TOTAL_TIME_RUNNING;
+  // pid 0 / cpu -1: the calling thread on whichever CPU it runs.
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1,
+                                  group_fd, PERF_FLAG_FD_CLOEXEC));
+}
+
+#endif  // NVR_INSTRUMENT_HAS_PERF_EVENTS
+
+}  // namespace
+
+const char* PerfCounterName(PerfCounter counter) {
+  switch (counter) {
+    case PerfCounter::kCycles:
+      return "cycles";
+    case PerfCounter::kInstructions:
+      return "instructions";
+    case PerfCounter::kCacheMisses:
+      return "cache_misses";
+    case PerfCounter::kBranchMisses:
+      return "branch_misses";
+  }
+  return "unknown";
+}
+
+PerfCounterSample PerfCounterDelta(const PerfCounterSample& begin,
+                                   const PerfCounterSample& end) {
+  PerfCounterSample d{};
+  d.valid_mask = begin.valid_mask & end.valid_mask;
+  for (std::uint32_t i = 0; i < kPerfCounterCount; ++i) {
+    d.values[i] = end.values[i] > begin.values[i]
+                      ? end.values[i] - begin.values[i]
+                      : 0;
+  }
+  return d;
+}
+
+PerfCounterGroup::PerfCounterGroup()
+    : leader_fd_(-1), valid_mask_(0), open_count_(0) {
+  for (std::uint32_t i = 0; i < kPerfCounterCount; ++i) {
+    fds_[i]       = -1;
+    read_slot_[i] = 0;
+  }
+}
+
+PerfCounterGroup::~PerfCounterGroup() {
+  Close();
+}
+
+NavaryRC PerfCounterGroup::Open(std::uint32_t mask) {
+  Close();
+#if NVR_INSTRUMENT_HAS_PERF_EVENTS
+  for (std::uint32_t i = 0; i < kPerfCounterCount; ++i) {
+    if ((mask & (1u << i)) == 0) {
+      continue;
+    }
+    const int fd = OpenEvent(kEventConfig[i], leader_fd_);
+    if (fd < 0) {
+      continue;  // unsupported event or not permitted; keep the others
+    }
+    if (leader_fd_ < 0) {
+      leader_fd_ = fd;
+    }
+    fds_[i]       = fd;
+    read_slot_[i] = static_cast<std::uint8_t>(open_count_++);
+    valid_mask_ |= 1u << i;
+  }
+  if (leader_fd_ >= 0) {
+    ioctl(leader_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return NavaryRC::OK();
+  }
+#else
+  (void)mask;
+#endif
+  return NavaryRC(NavaryStatus::kNotFound,
+                  "PerfCounterGroup: no hardware counters available");
+}
+
+void PerfCounterGroup::Close() {
+#if NVR_INSTRUMENT_HAS_PERF_EVENTS
+  // Members first: closing the leader while members are open is allowed,
+  // but this keeps the group intact until the very end.
+  for (std::uint32_t i = 0; i < kPerfCounterCount; ++i) {
+    if (fds_[i] >= 0 && fds_[i] != leader_fd_) {
+      close(fds_[i]);
+    }
+  }
+  if (leader_fd_ >= 0) {
+    close(leader_fd_);
+  }
+#endif
+  for (std::uint32_t i = 0; i < kPerfCounterCount; ++i) {
+    fds_[i]       = -1;
+    read_slot_[i] = 0;
+  }
+  leader_fd_  = -1;
+  valid_mask_ = 0;
+  open_count_ = 0;
+}
+
+PerfCounterSample PerfCounterGroup::Read() const {
+  PerfCounterSample s{};
+#if NVR_INSTRUMENT_HAS_PERF_EVENTS
+  if (leader_fd_ < 0) {
+    return s;
+  }
+  // PERF_FORMAT_GROUP layout: nr, time_enabled, time_running, values[nr].
+  std::uint64_t buf[3 + kPerfCounterCount];
+  const ssize_t want =
+      static_cast<ssize_t>((3 + open_count_) * sizeof(std::uint64_t));
+  if (read(leader_fd_, buf, sizeof(buf)) < want || buf[0] != open_count_) {
+    return s;
+  }
+  const std::uint64_t enabled = buf[1];
+  const std::uint64_t running = buf[2];
+  if (running == 0) {
+    return s;  // never scheduled on the PMU
+  }
+  for (std::uint32_t i = 0; i < kPerfCounterCount; ++i) {
+    if ((valid_mask_ & (1u << i)) == 0) {
+      continue;
+    }
+    std::uint64_t v = buf[3 + read_slot_[i]];
+    if (running < enabled) {
+      v = static_cast<std::uint64_t>(static_cast<double>(v) *
+                                     static_cast<double>(enabled) /
+                                     static_cast<double>(running));
+    }
+    s.values[i] = v;
+  }
+  s.valid_mask = valid_mask_;
+#endif
+  return s;
+}
+
+}  // namespace navary::instrument
@@ -0,0 +1,160 @@
+#pragma once
+// Navary Engine - Instrumentation Subsystem
+// File: navary/instrument/perf_counters.h
+// Purpose: Hardware performance counters (cycles, instructions, cache
+//          misses, branch misses) for scoped regions, backed by Linux
+//          perf_event_open.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - PerfCounterGroup opens one counter group for the calling thread and
+//     leaves it running. A region is measured as the difference of two
+//     Read()s, so any number of nested or sequential scopes share the one
+//     group without enable / disable syscalls.
+//   - ScopedPerfCounters is the zone-sized helper: it reads on entry and
+//     adds the delta to a PerfCounterSample on exit. navary-bench uses it
+//     around timed loops; a profiler zone can hold one the same way.
+//   - Counters the kernel or CPU refuses (VMs without a PMU, containers,
+//     kernel.perf_event_paranoid > 2 without CAP_PERFMON) are dropped one
+//     by one; valid_mask says which survived. With none left, Open()
+//     fails, Read() returns zeros and every scope is a no-op, so callers
+//     never need their own platform checks.
+//   - Values are scaled by time_enabled / time_running when the kernel
+//     multiplexes the PMU between more events than it has counters.
+//
+// Notes:
+//   - Counts cover the opening thread only, user space only (the kernel
+//     is excluded so unprivileged users can count). Open the group on the
+//     thread that runs the region.
+//   - A Read() is one read() syscall (~0.5-1 us): fine around a benchmark
+//     loop or a frame phase, too costly around a single small function.
+//   - Off Linux, or with NVR_INSTRUMENT_ENABLE_PERF_EVENTS=0, the backend
+//     compiles to the no-op path.
+//
+// Example:
+// ```cpp
+//   navary::instrument::PerfCounterGroup counters;
+//   counters.Open();  // fine to ignore failure
+//   navary::instrument::PerfCounterSample cull{};
+//   {
+//     navary::instrument::ScopedPerfCounters zone(&counters, &cull);
+//     CullScene(...);
+//   }
+//   if (cull.Has(PerfCounter::kCacheMisses)) { ... }
+// ```
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/navary_status.h"
+
+namespace navary::instrument {
+
+enum class PerfCounter : std::uint8_t {
+  kCycles = 0,
+  kInstructions,
+  kCacheMisses,  // last-level cache misses
+  kBranchMisses,
+};
+
+constexpr std::uint32_t kPerfCounterCount = 4;
+constexpr std::uint32_t kAllPerfCounters  = (1u << kPerfCounterCount) - 1;
+
+constexpr std::uint32_t PerfCounterBit(PerfCounter counter) {
+  return 1u << static_cast<std::uint32_t>(counter);
+}
+
+// Stable lower_snake name ("cycles", "cache_misses", ...).
+const char* PerfCounterName(PerfCounter counter);
+
+struct PerfCounterSample {
+  std::uint64_t values[kPerfCounterCount];
+  std::uint32_t valid_mask;  // PerfCounterBit() of every counted value
+
+  bool Has(PerfCounter counter) const {
+    return (valid_mask & PerfCounterBit(counter)) != 0;
+  }
+  std::uint64_t Get(PerfCounter counter) const {
+    return values[static_cast<std::uint32_t>(counter)];
+  }
+
+  // Adds |delta|; the valid mask becomes the union, so an empty
+  // accumulator adopts whatever the group can count.
+  void Accumulate(const PerfCounterSample& delta) {
+    for (std::uint32_t i = 0; i < kPerfCounterCount; ++i) {
+      values[i] += delta.values[i];
+    }
+    valid_mask |= delta.valid_mask;
+  }
+};
+
+// |end| - |begin| per counter, clamped at zero (multiplex scaling can
+// make consecutive estimates dip).
+PerfCounterSample PerfCounterDelta(const PerfCounterSample& begin,
+                                   const PerfCounterSample& end);
+
+class PerfCounterGroup {
+ public:
+  PerfCounterGroup();
+  ~PerfCounterGroup();
+
+  PerfCounterGroup(const PerfCounterGroup&)            = delete;
+  PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+  // Opens the counters in |mask| for the calling thread and starts them.
+  // Fails (kNotFound) when not one of them can be opened; the group then
+  // stays usable as a no-op.
+  NavaryRC Open(std::uint32_t mask = kAllPerfCounters);
+
+  void Close();
+
+  bool is_open() const {
+    return valid_mask_ != 0;
+  }
+
+  // Counters that opened successfully.
+  std::uint32_t valid_mask() const {
+    return valid_mask_;
+  }
+
+  // Running totals since Open(). All zero (valid_mask 0) when closed or
+  // when the read fails.
+  PerfCounterSample Read() const;
+
+ private:
+  int fds_[kPerfCounterCount];
+  std::uint8_t read_slot_[kPerfCounterCount];  // position in a group read
+  int leader_fd_;
+  std::uint32_t valid_mask_;
+  std::uint32_t open_count_;
+};
+
+// Measures the enclosing scope on |group| and adds the delta to |sink|.
+// Either pointer may be null, which makes the scope free.
+class ScopedPerfCounters {
+ public:
+  ScopedPerfCounters(const PerfCounterGroup* group, PerfCounterSample* sink)
+      : group_(group && group->is_open() ? group : nullptr), sink_(sink) {
+    if (group_ != nullptr && sink_ != nullptr) {
+      begin_ = group_->Read();
+    }
+  }
+
+  ~ScopedPerfCounters() {
+    if (group_ != nullptr && sink_ != nullptr) {
+      sink_->Accumulate(PerfCounterDelta(begin_, group_->Read()));
+    }
+  }
+
+  ScopedPerfCounters(const ScopedPerfCounters&)            = delete;
+  ScopedPerfCounters& operator=(const ScopedPerfCounters&) = delete;
+
+ private:
+  const PerfCounterGroup* group_;
+  PerfCounterSample* sink_;
+  PerfCounterSample begin_{};
+};
+
+}  // namespace navary::instrument
@@ -0,0 +1,259 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/async_io.cc
+// Purpose: AsyncIo implementation (request slots, batching, draining).
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/io/async_io.h"
+
+#include <cstdlib>
+
+#include "navary/core/scheduler/job_system.h"
+#include "navary/core/time/profiler_time.h"
+#include "navary/io/internal/async_io_backend.h"
+#include "navary/io/internal/platform_file_ifacade.h"
+
+namespace navary::io {
+
+namespace {
+
+// Completions per job when callbacks are spread over workers; callbacks are
+// usually a few stores, so small grains only add scheduling overhead.
+constexpr std::uint32_t kCallbackGrain = 64;
+
+}  // namespace
+
+AsyncIo::AsyncIo()
+    : backend_(nullptr),
+      backend_kind_(AsyncIoBackendKind::kAuto),
+      slots_(nullptr),
+      free_slots_(nullptr),
+      free_count_(0),
+      max_requests_(0),
+      pending_(nullptr),
+      pending_count_(0),
+      in_flight_count_(0),
+      reaped_(nullptr),
+      completed_(nullptr),
+      stats_{} {}
+
+AsyncIo::~AsyncIo() {
+  Shutdown();
+}
+
+NavaryRC AsyncIo::Init(const AsyncIoDesc& desc) {
+  if (backend_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "AsyncIo: already initialized");
+  }
+  if (desc.max_requests == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "AsyncIo: max_requests must be > 0");
+  }
+
+  const std::uint32_t n = desc.max_requests;
+  slots_      = static_cast<Slot*>(std::malloc(sizeof(Slot) * n));
+  free_slots_ = static_cast<std::uint32_t*>(
+      std::malloc(sizeof(std::uint32_t) * n));
+  pending_ = static_cast<AsyncIoOp*>(std::malloc(sizeof(AsyncIoOp) * n));
+  reaped_  = static_cast<AsyncIoCompletion*>(
+      std::malloc(sizeof(AsyncIoCompletion) * n));
+  completed_ = static_cast<Completed*>(std::malloc(sizeof(Completed) * n));
+  if (slots_ == nullptr || free_slots_ == nullptr || pending_ == nullptr ||
+      reaped_ == nullptr || completed_ == nullptr) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kOutOfMemory, "AsyncIo: storage alloc");
+  }
+
+  if (desc.backend != AsyncIoBackendKind::kThreadPool) {
+    backend_      = CreateIoUringBackend(n);
+    backend_kind_ = AsyncIoBackendKind::kIoUring;
+    if (backend_ == nullptr && desc.backend == AsyncIoBackendKind::kIoUring) {
+      Shutdown();
+      return NavaryRC(NavaryStatus::kNotFound,
+                      "AsyncIo: io_uring unavailable");
+    }
+  }
+  if (backend_ == nullptr) {
+    const std::uint32_t workers =
+        desc.worker_count > 0 ? desc.worker_count : 1;
+    backend_      = CreateThreadPoolBackend(n, workers);
+    backend_kind_ = AsyncIoBackendKind::kThreadPool;
+  }
+  if (backend_ == nullptr) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kInternal, "AsyncIo: backend init failed");
+  }
+
+  // Free list hands out low slots first.
+  for (std::uint32_t i = 0; i < n; ++i) {
+    free_slots_[i] = n - 1 - i;
+  }
+  free_count_      = n;
+  max_requests_    = n;
+  pending_count_   = 0;
+  in_flight_count_ = 0;
+  stats_           = AsyncIoStats{};
+  return NavaryRC::OK();
+}
+
+void AsyncIo::Shutdown() {
+  if (backend_ != nullptr) {
+    // Reads that never reached the backend still owe their callback.
+    const std::uint32_t cancelled = pending_count_;
+    for (std::uint32_t i = 0; i < cancelled; ++i) {
+      reaped_[i] = AsyncIoCompletion{pending_[i].slot, -1};
+    }
+    pending_count_ = 0;
+    Complete(cancelled, nullptr);
+
+    // Reads still target caller memory; never free the ring under them.
+    while (in_flight_count_ > 0) {
+      Drain(nullptr, true);
+    }
+    delete backend_;
+    backend_ = nullptr;
+  }
+
+  std::free(slots_);
+  std::free(free_slots_);
+  std::free(pending_);
+  std::free(reaped_);
+  std::free(completed_);
+  slots_        = nullptr;
+  free_slots_   = nullptr;
+  pending_      = nullptr;
+  reaped_       = nullptr;
+  completed_    = nullptr;
+  free_count_   = 0;
+  max_requests_ = 0;
+}
+
+NavaryResult<AsyncFile> AsyncIo::OpenFile(const char* path) {
+  AsyncFile file;
+  if (path == nullptr || !PlatformOpenRead(path, &file.native)) {
+    return NavaryResult<AsyncFile>(
+        NavaryRC(NavaryStatus::kNotFound, "AsyncIo: cannot open file"));
+  }
+  return NavaryResult<AsyncFile>(file);
+}
+
+void AsyncIo::CloseFile(AsyncFile file) {
+  if (file.valid()) {
+    PlatformCloseFile(file.native);
+  }
+}
+
+NavaryRC AsyncIo::Enqueue(const AsyncReadRequest& request) {
+  if (backend_ == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "AsyncIo: not initialized");
+  }
+  if (!request.file.valid() || (request.dst == nullptr && request.size > 0)) {
+    return NavaryRC(NavaryStatus::kInvalidArgument, "AsyncIo: bad request");
+  }
+  if (free_count_ == 0) {
+    return NavaryRC(NavaryStatus::kOutOfMemory, "AsyncIo: queue full");
+  }
+
+  const std::uint32_t slot = free_slots_[--free_count_];
+  slots_[slot].request       = request;
+  slots_[slot].enqueue_ticks = core::time::ProfilerNowTicks();
+
+  AsyncIoOp& op = pending_[pending_count_++];
+  op.file       = request.file.native;
+  op.offset     = request.offset;
+  op.dst        = request.dst;
+  op.size       = request.size;
+  op.slot       = slot;
+
+  ++stats_.enqueued;
+  return NavaryRC::OK();
+}
+
+std::uint32_t AsyncIo::Submit() {
+  if (backend_ == nullptr || pending_count_ == 0) {
+    return 0;
+  }
+
+  const std::uint32_t accepted = backend_->Submit(pending_, pending_count_);
+  // Keep whatever the backend could not take at the front for next time.
+  for (std::uint32_t i = accepted; i < pending_count_; ++i) {
+    pending_[i - accepted] = pending_[i];
+  }
+  pending_count_ -= accepted;
+  in_flight_count_ += accepted;
+  if (accepted > 0) {
+    ++stats_.batches;
+  }
+  return accepted;
+}
+
+std::uint32_t AsyncIo::Drain(core::scheduler::JobSystem* jobs, bool wait) {
+  if (backend_ == nullptr || in_flight_count_ == 0) {
+    return 0;
+  }
+
+  const std::uint32_t n = backend_->Reap(reaped_, in_flight_count_, wait);
+  in_flight_count_ -= n;
+  Complete(n, jobs);
+  return n;
+}
+
+void AsyncIo::Complete(std::uint32_t n, core::scheduler::JobSystem* jobs) {
+  const std::uint64_t now = core::time::ProfilerNowTicks();
+  for (std::uint32_t i = 0; i < n; ++i) {
+    const std::uint32_t slot   = reaped_[i].slot;
+    const std::int64_t result  = reaped_[i].result;
+    const AsyncReadRequest& rq = slots_[slot].request;
+
+    const bool ok =
+        result >= 0 && static_cast<std::uint64_t>(result) == rq.size;
+    const std::uint32_t bytes =
+        result > 0 ? static_cast<std::uint32_t>(result) : 0;
+
+    // Copy out before the slot is recycled below.
+    Completed& done           = completed_[i];
+    done.callback             = rq.callback;
+    done.result.status        = ok ? NavaryStatus::kOk : NavaryStatus::kIoError;
+    done.result.bytes_read    = bytes;
+    done.result.dst           = rq.dst;
+    done.result.user_data     = rq.user_data;
+    done.result.user_tag      = rq.user_tag;
+    done.result.latency_ticks = now - slots_[slot].enqueue_ticks;
+
+    stats_.bytes_read += bytes;
+    stats_.failed += ok ? 0 : 1;
+    free_slots_[free_count_++] = slot;
+  }
+  stats_.completed += n;
+
+  if (jobs != nullptr && n > kCallbackGrain) {
+    jobs->ParallelFor(n, kCallbackGrain, &AsyncIo::RunCallbacks, this);
+  } else {
+    RunCallbacks(0, n, 0, this);
+  }
+}
+
+void AsyncIo::RunCallbacks(std::uint32_t begin, std::uint32_t end,
+                           std::uint32_t worker, void* user_data) {
+  (void)worker;
+  auto* self = static_cast<AsyncIo*>(user_data);
+  for (std::uint32_t i = begin; i < end; ++i) {
+    const Completed& done = self->completed_[i];
+    if (done.callback != nullptr) {
+      done.callback(done.result);
+    }
+  }
+}
+
+void AsyncIo::WaitIdle(core::scheduler::JobSystem* jobs) {
+  while (pending_count_ > 0 || in_flight_count_ > 0) {
+    Submit();
+    Drain(jobs, in_flight_count_ > 0);
+  }
+}
+
+}  // namespace navary::io
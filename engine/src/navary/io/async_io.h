@@ -0,0 +1,170 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/async_io.h
+// Purpose: Batched asynchronous file reads into caller-provided memory
+//          (staging reservations, streaming pools).
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - Enqueue() records a read; Submit() hands the whole batch to the
+//     backend at once (one io_uring_enter on Linux).
+//   - Drain() reaps finished reads and runs their callbacks, spread over
+//     the JobSystem when one is given.
+//   - Backends: io_uring (Linux, picked by kAuto when the kernel allows
+//     it) and a portable pool of threads doing positional reads.
+//
+// Notes:
+//   - Enqueue/Submit/Drain/OpenFile belong to one owner thread (usually
+//     the streaming thread or the main thread).
+//   - Callbacks may run on job workers and must not call into AsyncIo.
+//   - |dst| must stay valid until the request's callback has run.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/navary_status.h"
+
+namespace navary::core::scheduler {
+class JobSystem;
+}  // namespace navary::core::scheduler
+
+namespace navary::io {
+
+class AsyncIoBackend;
+struct AsyncIoCompletion;
+struct AsyncIoOp;
+
+enum class AsyncIoBackendKind : std::uint8_t {
+  kAuto       = 0,  // io_uring when available, else thread pool
+  kIoUring    = 1,
+  kThreadPool = 2,
+};
+
+struct AsyncIoDesc {
+  AsyncIoBackendKind backend = AsyncIoBackendKind::kAuto;
+  std::uint32_t max_requests = 1024;  // enqueued + in flight
+  std::uint32_t worker_count = 4;     // thread-pool backend only
+};
+
+struct AsyncFile {
+  std::intptr_t native = -1;
+
+  bool valid() const {
+    return native != -1;
+  }
+};
+
+struct AsyncReadResult {
+  NavaryStatus status;  // kOk only when all requested bytes arrived
+  std::uint32_t bytes_read;
+  void* dst;
+  void* user_data;
+  std::uint64_t user_tag;
+  std::uint64_t latency_ticks;  // Enqueue() to reap, profiler ticks
+};
+
+using AsyncReadCallback = void (*)(const AsyncReadResult& result);
+
+struct AsyncReadRequest {
+  AsyncFile file;
+  std::uint64_t offset;
+  std::uint32_t size;
+  void* dst;
+  AsyncReadCallback callback;  // optional
+  void* user_data;
+  std::uint64_t user_tag;  // e.g. a handle, avoids per-request allocation
+};
+
+struct AsyncIoStats {
+  std::uint64_t enqueued;
+  std::uint64_t completed;
+  std::uint64_t failed;
+  std::uint64_t bytes_read;
+  std::uint64_t batches;  // Submit() calls that reached the backend
+};
+
+class AsyncIo {
+ public:
+  AsyncIo();
+  ~AsyncIo();
+
+  AsyncIo(const AsyncIo&)            = delete;
+  AsyncIo& operator=(const AsyncIo&) = delete;
+
+  NavaryRC Init(const AsyncIoDesc& desc);
+
+  // Fails reads that were enqueued but never submitted (kIoError), waits
+  // for in-flight reads (callbacks run inline), then releases the backend.
+  // Safe to call twice.
+  void Shutdown();
+
+  NavaryResult<AsyncFile> OpenFile(const char* path);
+  void CloseFile(AsyncFile file);
+
+  // kOutOfMemory when max_requests are already enqueued or in flight.
+  NavaryRC Enqueue(const AsyncReadRequest& request);
+
+  // Sends everything enqueued since the last call; returns the count.
+  std::uint32_t Submit();
+
+  // Reaps finished reads and runs their callbacks; |jobs| may be null.
+  // With |wait| it blocks until at least one read finished (if any are in
+  // flight). Returns the number of completions processed.
+  std::uint32_t Drain(core::scheduler::JobSystem* jobs, bool wait = false);
+
+  // Submit + Drain until nothing is enqueued or in flight.
+  void WaitIdle(core::scheduler::JobSystem* jobs);
+
+  AsyncIoBackendKind backend_kind() const {
+    return backend_kind_;
+  }
+  std::uint32_t pending_count() const {
+    return pending_count_;
+  }
+  std::uint32_t in_flight_count() const {
+    return in_flight_count_;
+  }
+
+  AsyncIoStats stats() const {
+    return stats_;
+  }
+
+ private:
+  struct Slot {
+    AsyncReadRequest request;
+    std::uint64_t enqueue_ticks;
+  };
+
+  struct Completed {
+    AsyncReadResult result;
+    AsyncReadCallback callback;
+  };
+
+  // Turns reaped_[0, n) into results, recycles their slots and runs the
+  // callbacks.
+  void Complete(std::uint32_t n, core::scheduler::JobSystem* jobs);
+
+  static void RunCallbacks(std::uint32_t begin, std::uint32_t end,
+                           std::uint32_t worker, void* user_data);
+
+  AsyncIoBackend* backend_;
+  AsyncIoBackendKind backend_kind_;
+
+  Slot* slots_;
+  std::uint32_t* free_slots_;
+  std::uint32_t free_count_;
+  std::uint32_t max_requests_;
+
+  AsyncIoOp* pending_;  // enqueued, not yet submitted
+  std::uint32_t pending_count_;
+  std::uint32_t in_flight_count_;
+
+  AsyncIoCompletion* reaped_;
+  Completed* completed_;
+
+  AsyncIoStats stats_;
+};
+
+}  // namespace navary::io
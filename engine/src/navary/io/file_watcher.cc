@@ -0,0 +1,226 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/file_watcher.cc
+// Purpose: FileWatcher slot table, backend selection and debouncing.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/io/file_watcher.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "navary/core/time/profiler_time.h"
+#include "navary/io/internal/file_watch_backend.h"
+
+namespace navary::io {
+
+namespace {
+
+std::uint64_t MsToTicks(std::uint32_t ms) {
+  return core::time::ProfilerTicksPerSecond() * ms / 1000;
+}
+
+}  // namespace
+
+FileWatcher::FileWatcher()
+    : backend_(nullptr),
+      backend_kind_(FileWatchBackendKind::kAuto),
+      slots_(nullptr),
+      free_slots_(nullptr),
+      free_count_(0),
+      max_watches_(0),
+      watch_count_(0),
+      changed_(nullptr),
+      pending_(nullptr),
+      pending_count_(0),
+      debounce_ticks_(0) {}
+
+FileWatcher::~FileWatcher() {
+  Shutdown();
+}
+
+NavaryRC FileWatcher::Init(const FileWatcherDesc& desc) {
+  if (backend_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "FileWatcher: already initialized");
+  }
+  if (desc.max_watches == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "FileWatcher: max_watches must be > 0");
+  }
+
+  const std::uint32_t n = desc.max_watches;
+  slots_      = static_cast<Slot*>(std::malloc(sizeof(Slot) * n));
+  free_slots_ = static_cast<std::uint32_t*>(
+      std::malloc(sizeof(std::uint32_t) * n));
+  changed_ = static_cast<std::uint32_t*>(
+      std::malloc(sizeof(std::uint32_t) * n));
+  pending_ = static_cast<std::uint32_t*>(
+      std::malloc(sizeof(std::uint32_t) * n));
+  if (slots_ == nullptr || free_slots_ == nullptr || changed_ == nullptr ||
+      pending_ == nullptr) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kOutOfMemory, "FileWatcher: storage alloc");
+  }
+  std::memset(slots_, 0, sizeof(Slot) * n);
+
+  if (desc.backend != FileWatchBackendKind::kPolling) {
+    backend_      = CreateInotifyWatchBackend(n);
+    backend_kind_ = FileWatchBackendKind::kInotify;
+    if (backend_ == nullptr && desc.backend == FileWatchBackendKind::kInotify) {
+      Shutdown();
+      return NavaryRC(NavaryStatus::kNotFound,
+                      "FileWatcher: inotify unavailable");
+    }
+  }
+  if (backend_ == nullptr) {
+    backend_ = CreatePollingWatchBackend(n, MsToTicks(desc.poll_interval_ms));
+    backend_kind_ = FileWatchBackendKind::kPolling;
+  }
+  if (backend_ == nullptr) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kInternal,
+                    "FileWatcher: backend init failed");
+  }
+
+  for (std::uint32_t i = 0; i < n; ++i) {
+    free_slots_[i] = n - 1 - i;
+  }
+  free_count_     = n;
+  max_watches_    = n;
+  watch_count_    = 0;
+  pending_count_  = 0;
+  debounce_ticks_ = MsToTicks(desc.debounce_ms);
+  return NavaryRC::OK();
+}
+
+void FileWatcher::Shutdown() {
+  delete backend_;
+  backend_ = nullptr;
+
+  if (slots_ != nullptr) {
+    for (std::uint32_t i = 0; i < max_watches_; ++i) {
+      std::free(const_cast<char*>(slots_[i].path));
+    }
+  }
+  std::free(slots_);
+  std::free(free_slots_);
+  std::free(changed_);
+  std::free(pending_);
+  slots_         = nullptr;
+  free_slots_    = nullptr;
+  changed_       = nullptr;
+  pending_       = nullptr;
+  free_count_    = 0;
+  max_watches_   = 0;
+  watch_count_   = 0;
+  pending_count_ = 0;
+}
+
+NavaryResult<std::uint32_t> FileWatcher::Watch(const char* path,
+                                               std::uint64_t user_tag) {
+  if (backend_ == nullptr || path == nullptr || path[0] == '\0') {
+    return NavaryResult<std::uint32_t>(NavaryRC(
+        NavaryStatus::kInvalidArgument, "FileWatcher: bad watch request"));
+  }
+  if (free_count_ == 0) {
+    return NavaryResult<std::uint32_t>(
+        NavaryRC(NavaryStatus::kOutOfMemory, "FileWatcher: no free watches"));
+  }
+
+  const std::size_t length = std::strlen(path);
+  char* copy               = static_cast<char*>(std::malloc(length + 1));
+  if (copy == nullptr) {
+    return NavaryResult<std::uint32_t>(
+        NavaryRC(NavaryStatus::kOutOfMemory, "FileWatcher: path alloc"));
+  }
+  std::memcpy(copy, path, length + 1);
+
+  const std::uint32_t slot = free_slots_[free_count_ - 1];
+  if (!backend_->Add(slot, copy)) {
+    std::free(copy);
+    return NavaryResult<std::uint32_t>(
+        NavaryRC(NavaryStatus::kNotFound, "FileWatcher: cannot watch path"));
+  }
+  --free_count_;
+
+  Slot& s             = slots_[slot];
+  s.path              = copy;
+  s.user_tag          = user_tag;
+  s.last_change_ticks = 0;
+  s.active            = true;
+  s.pending           = false;
+  ++watch_count_;
+  return NavaryResult<std::uint32_t>(slot);
+}
+
+void FileWatcher::Unwatch(std::uint32_t watch) {
+  if (watch >= max_watches_ || !slots_[watch].active) {
+    return;
+  }
+  backend_->Remove(watch);
+  if (slots_[watch].pending) {
+    RemovePending(watch);
+  }
+
+  Slot& s = slots_[watch];
+  std::free(const_cast<char*>(s.path));
+  s = Slot{};
+  free_slots_[free_count_++] = watch;
+  --watch_count_;
+}
+
+std::uint32_t FileWatcher::Poll(FileWatchEvent* out, std::uint32_t max) {
+  return PollAt(core::time::ProfilerNowTicks(), out, max);
+}
+
+std::uint32_t FileWatcher::PollAt(std::uint64_t now_ticks,
+                                  FileWatchEvent* out, std::uint32_t max) {
+  if (backend_ == nullptr) {
+    return 0;
+  }
+
+  // Every raw change restarts the slot's window (trailing debounce).
+  const std::uint32_t changed = backend_->Collect(now_ticks, changed_);
+  for (std::uint32_t i = 0; i < changed; ++i) {
+    Slot& s = slots_[changed_[i]];
+    if (!s.active) {
+      continue;
+    }
+    s.last_change_ticks = now_ticks;
+    if (!s.pending) {
+      s.pending                  = true;
+      pending_[pending_count_++] = changed_[i];
+    }
+  }
+
+  std::uint32_t count = 0;
+  std::uint32_t keep  = 0;
+  for (std::uint32_t i = 0; i < pending_count_; ++i) {
+    const std::uint32_t slot = pending_[i];
+    Slot& s                  = slots_[slot];
+    if (count < max && now_ticks - s.last_change_ticks >= debounce_ticks_) {
+      s.pending  = false;
+      out[count] = FileWatchEvent{slot, s.user_tag, s.path};
+      ++count;
+    } else {
+      pending_[keep++] = slot;
+    }
+  }
+  pending_count_ = keep;
+  return count;
+}
+
+void FileWatcher::RemovePending(std::uint32_t slot) {
+  for (std::uint32_t i = 0; i < pending_count_; ++i) {
+    if (pending_[i] == slot) {
+      pending_[i] = pending_[--pending_count_];
+      break;
+    }
+  }
+  slots_[slot].pending = false;
+}
+
+}  // namespace navary::io
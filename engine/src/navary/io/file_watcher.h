@@ -0,0 +1,118 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/file_watcher.h
+// Purpose: Debounced change notifications for individual asset files
+//          (hot reload of .navgraph, shaders, textures).
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - Watch() registers a file path plus a caller tag; the file may not
+//     exist yet.
+//   - Poll() (once per frame) collects raw changes from the backend and
+//     returns each file once its changes have been quiet for the debounce
+//     window, so a save that touches a file several times, or a tool that
+//     rewrites a batch of files, yields a single event per file.
+//   - Backends: inotify on Linux (picked by kAuto), stat polling
+//     everywhere else.
+//
+// Notes:
+//   - All calls belong to one owner thread; nothing runs in the background.
+//   - Event paths stay valid until the watch is removed.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/navary_status.h"
+
+namespace navary::io {
+
+class FileWatchBackend;
+
+enum class FileWatchBackendKind : std::uint8_t {
+  kAuto    = 0,  // inotify when available, else polling
+  kInotify = 1,
+  kPolling = 2,
+};
+
+struct FileWatcherDesc {
+  FileWatchBackendKind backend   = FileWatchBackendKind::kAuto;
+  std::uint32_t max_watches      = 1024;
+  std::uint32_t debounce_ms      = 50;
+  std::uint32_t poll_interval_ms = 250;  // polling backend only
+};
+
+struct FileWatchEvent {
+  std::uint32_t watch;  // id returned by Watch()
+  std::uint64_t user_tag;
+  const char* path;
+};
+
+class FileWatcher {
+ public:
+  FileWatcher();
+  ~FileWatcher();
+
+  FileWatcher(const FileWatcher&)            = delete;
+  FileWatcher& operator=(const FileWatcher&) = delete;
+
+  NavaryRC Init(const FileWatcherDesc& desc);
+
+  // Releases the backend and every watch. Safe to call twice.
+  void Shutdown();
+
+  // kOutOfMemory when max_watches are in use; kNotFound when the parent
+  // directory cannot be watched.
+  NavaryResult<std::uint32_t> Watch(const char* path, std::uint64_t user_tag);
+
+  // Drops the watch and any event still waiting out its debounce window.
+  void Unwatch(std::uint32_t watch);
+
+  // Writes up to |max| settled changes into |out| and returns the count.
+  // Changes that do not fit stay queued for the next call.
+  std::uint32_t Poll(FileWatchEvent* out, std::uint32_t max);
+
+  // Poll() with an explicit profiler-tick clock (tests, replay).
+  std::uint32_t PollAt(std::uint64_t now_ticks, FileWatchEvent* out,
+                       std::uint32_t max);
+
+  FileWatchBackendKind backend_kind() const {
+    return backend_kind_;
+  }
+  std::uint32_t watch_count() const {
+    return watch_count_;
+  }
+  // Files that changed and are still inside their debounce window.
+  std::uint32_t pending_count() const {
+    return pending_count_;
+  }
+
+ private:
+  struct Slot {
+    const char* path;  // owned, malloc'd copy
+    std::uint64_t user_tag;
+    std::uint64_t last_change_ticks;
+    bool active;
+    bool pending;
+  };
+
+  void RemovePending(std::uint32_t slot);
+
+  FileWatchBackend* backend_;
+  FileWatchBackendKind backend_kind_;
+
+  Slot* slots_;
+  std::uint32_t* free_slots_;
+  std::uint32_t free_count_;
+  std::uint32_t max_watches_;
+  std::uint32_t watch_count_;
+
+  std::uint32_t* changed_;  // scratch for FileWatchBackend::Collect
+  std::uint32_t* pending_;  // slots inside their debounce window
+  std::uint32_t pending_count_;
+
+  std::uint64_t debounce_ticks_;
+};
+
+}  // namespace navary::io
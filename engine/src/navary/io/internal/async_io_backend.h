@@ -0,0 +1,54 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/internal/async_io_backend.h
+// Purpose: Internal interface implemented by the async read backends
+//          (io_uring on Linux, portable thread pool everywhere).
+// Policy: C++20, Google style, no exceptions, no RTTI.
+//
+// Backends only move bytes: AsyncIo owns request state and callbacks, and
+// never has more than queue_depth reads outstanding, so backends can size
+// their rings once at creation.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+namespace navary::io {
+
+struct AsyncIoOp {
+  std::intptr_t file;
+  std::uint64_t offset;
+  void* dst;
+  std::uint32_t size;
+  std::uint32_t slot;  // AsyncIo request slot, echoed in the completion
+};
+
+struct AsyncIoCompletion {
+  std::uint32_t slot;
+  std::int64_t result;  // bytes read, or < 0 on error
+};
+
+class AsyncIoBackend {
+ public:
+  virtual ~AsyncIoBackend() = default;
+
+  // Hands |count| reads to the device; a batch costs one syscall where the
+  // backend allows it. Returns how many were accepted.
+  virtual std::uint32_t Submit(const AsyncIoOp* ops, std::uint32_t count) = 0;
+
+  // Copies up to |max| finished reads into |out|. With |wait| it blocks
+  // until at least one is available (caller guarantees one is in flight).
+  virtual std::uint32_t Reap(AsyncIoCompletion* out, std::uint32_t max,
+                             bool wait) = 0;
+};
+
+// Factories return an initialized backend (caller deletes) or nullptr.
+// io_uring yields nullptr when it is not compiled in or the kernel refuses
+// it (old kernel, seccomp-restricted container).
+AsyncIoBackend* CreateIoUringBackend(std::uint32_t queue_depth);
+
+AsyncIoBackend* CreateThreadPoolBackend(std::uint32_t queue_depth,
+                                        std::uint32_t worker_count);
+
+}  // namespace navary::io
@@ -0,0 +1,159 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/internal/async_io_threads.cc
+// Purpose: Portable async read backend: blocking positional reads on a
+//          small dedicated thread pool.
+// Policy: C++20, Google style, no exceptions, no RTTI.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include "navary/io/internal/async_io_backend.h"
+#include "navary/io/internal/platform_file_ifacade.h"
+
+namespace navary::io {
+
+namespace {
+
+class ThreadPoolBackend final : public AsyncIoBackend {
+ public:
+  ThreadPoolBackend()
+      : ops_(nullptr),
+        done_(nullptr),
+        capacity_(0),
+        op_head_(0),
+        op_count_(0),
+        done_head_(0),
+        done_count_(0),
+        stop_(false),
+        workers_(nullptr),
+        worker_count_(0) {}
+
+  ~ThreadPoolBackend() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (std::uint32_t i = 0; i < worker_count_; ++i) {
+      workers_[i].join();
+      workers_[i].~thread();
+    }
+    std::free(workers_);
+    std::free(ops_);
+    std::free(done_);
+  }
+
+  bool Init(std::uint32_t queue_depth, std::uint32_t worker_count) {
+    ops_ = static_cast<AsyncIoOp*>(
+        std::malloc(sizeof(AsyncIoOp) * queue_depth));
+    done_ = static_cast<AsyncIoCompletion*>(
+        std::malloc(sizeof(AsyncIoCompletion) * queue_depth));
+    workers_ = static_cast<std::thread*>(
+        std::malloc(sizeof(std::thread) * worker_count));
+    if (ops_ == nullptr || done_ == nullptr || workers_ == nullptr) {
+      return false;
+    }
+
+    capacity_ = queue_depth;
+    for (std::uint32_t i = 0; i < worker_count; ++i) {
+      new (&workers_[i]) std::thread(&ThreadPoolBackend::WorkerMain, this);
+      ++worker_count_;
+    }
+    return true;
+  }
+
+  std::uint32_t Submit(const AsyncIoOp* ops, std::uint32_t count) override {
+    std::uint32_t accepted = 0;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      while (accepted < count && op_count_ < capacity_) {
+        ops_[(op_head_ + op_count_) % capacity_] = ops[accepted++];
+        ++op_count_;
+      }
+    }
+    if (accepted == 1) {
+      work_cv_.notify_one();
+    } else if (accepted > 1) {
+      work_cv_.notify_all();
+    }
+    return accepted;
+  }
+
+  std::uint32_t Reap(AsyncIoCompletion* out, std::uint32_t max,
+                     bool wait) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (wait) {
+      done_cv_.wait(lock, [this] { return done_count_ > 0; });
+    }
+
+    std::uint32_t n = 0;
+    while (n < max && done_count_ > 0) {
+      out[n++]   = done_[done_head_];
+      done_head_ = (done_head_ + 1) % capacity_;
+      --done_count_;
+    }
+    return n;
+  }
+
+ private:
+  void WorkerMain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+      work_cv_.wait(lock, [this] { return stop_ || op_count_ > 0; });
+      if (stop_) {
+        return;
+      }
+
+      const AsyncIoOp op = ops_[op_head_];
+      op_head_           = (op_head_ + 1) % capacity_;
+      --op_count_;
+
+      lock.unlock();
+      const std::int64_t result =
+          PlatformReadAt(op.file, op.offset, op.dst, op.size);
+      lock.lock();
+
+      // AsyncIo caps outstanding reads at capacity_, so this never fills.
+      done_[(done_head_ + done_count_) % capacity_] =
+          AsyncIoCompletion{op.slot, result};
+      ++done_count_;
+      done_cv_.notify_one();
+    }
+  }
+
+  AsyncIoOp* ops_;
+  AsyncIoCompletion* done_;
+  std::uint32_t capacity_;
+  std::uint32_t op_head_;
+  std::uint32_t op_count_;
+  std::uint32_t done_head_;
+  std::uint32_t done_count_;
+
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  bool stop_;
+
+  std::thread* workers_;
+  std::uint32_t worker_count_;
+};
+
+}  // namespace
+
+AsyncIoBackend* CreateThreadPoolBackend(std::uint32_t queue_depth,
+                                        std::uint32_t worker_count) {
+  auto* backend = new (std::nothrow) ThreadPoolBackend();
+  if (backend != nullptr && !backend->Init(queue_depth, worker_count)) {
+    delete backend;
+    backend = nullptr;
+  }
+  return backend;
+}
+
+}  // namespace navary::io
@@ -0,0 +1,338 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/internal/async_io_uring.cc
+// Purpose: Linux io_uring async read backend (raw syscalls, no liburing).
+// Policy: C++20, Google style, no exceptions, no RTTI.
+//
+// One ring per AsyncIo. A whole Submit() batch is published to the SQ and
+// handed to the kernel with a single io_uring_enter; completions are read
+// straight from the shared CQ ring without a syscall unless Reap() waits.
+// IORING_OP_READ needs Linux 5.6; older kernels (5.1+) get IORING_OP_READV
+// with one iovec per request slot.
+// Set NVR_IO_ENABLE_URING=0 to compile the backend out.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/io/internal/async_io_backend.h"
+
+#ifndef NVR_IO_ENABLE_URING
+#define NVR_IO_ENABLE_URING 1
+#endif
+
+#if defined(__linux__) && NVR_IO_ENABLE_URING && \
+    __has_include(<linux/io_uring.h>)
+#define NVR_IO_HAS_URING 1
+#else
+#define NVR_IO_HAS_URING 0
+#endif
+
+#if NVR_IO_HAS_URING
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace navary::io {
+
+namespace {
+
+int SysSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int SysEnter(int fd, unsigned to_submit, unsigned min_complete,
+             unsigned flags) {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit,
+                                    min_complete, flags, nullptr, 0));
+}
+
+int SysRegister(int fd, unsigned opcode, void* arg, unsigned nr_args) {
+  return static_cast<int>(
+      ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+template <typename T>
+T* RingField(void* ring, std::uint32_t offset) {
+  return reinterpret_cast<T*>(static_cast<std::uint8_t*>(ring) + offset);
+}
+
+// The ring indices are shared with the kernel, which uses acquire/release
+// on them; plain fields on our side are wrapped in atomic_ref.
+std::uint32_t LoadAcquire(std::uint32_t* p) {
+  return std::atomic_ref<std::uint32_t>(*p).load(std::memory_order_acquire);
+}
+
+void StoreRelease(std::uint32_t* p, std::uint32_t v) {
+  std::atomic_ref<std::uint32_t>(*p).store(v, std::memory_order_release);
+}
+
+class IoUringBackend final : public AsyncIoBackend {
+ public:
+  IoUringBackend()
+      : ring_fd_(-1),
+        sq_ring_(nullptr),
+        cq_ring_(nullptr),
+        sqes_(nullptr),
+        sq_ring_size_(0),
+        cq_ring_size_(0),
+        sqes_size_(0),
+        sq_head_(nullptr),
+        sq_tail_(nullptr),
+        sq_mask_(0),
+        sq_entries_(0),
+        sq_array_(nullptr),
+        cq_head_(nullptr),
+        cq_tail_(nullptr),
+        cq_mask_(0),
+        cqes_(nullptr),
+        unsubmitted_(0),
+        read_op_(IORING_OP_READ),
+        iovecs_(nullptr) {}
+
+  ~IoUringBackend() override {
+    if (sqes_ != nullptr) {
+      ::munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      ::munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != nullptr) {
+      ::munmap(sq_ring_, sq_ring_size_);
+    }
+    if (ring_fd_ >= 0) {
+      ::close(ring_fd_);
+    }
+    std::free(iovecs_);
+  }
+
+  bool Init(std::uint32_t queue_depth) {
+    io_uring_params p;
+    std::memset(&p, 0, sizeof(p));
+    ring_fd_ = SysSetup(queue_depth, &p);
+    if (ring_fd_ < 0) {
+      return false;
+    }
+
+    sq_ring_size_ = p.sq_off.array + p.sq_entries * sizeof(std::uint32_t);
+    cq_ring_size_ = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+      cq_ring_size_ = sq_ring_size_;
+    }
+
+    sq_ring_ = MapRing(sq_ring_size_, IORING_OFF_SQ_RING);
+    if (sq_ring_ == nullptr) {
+      return false;
+    }
+    cq_ring_ =
+        single_mmap ? sq_ring_ : MapRing(cq_ring_size_, IORING_OFF_CQ_RING);
+    if (cq_ring_ == nullptr) {
+      return false;
+    }
+    sqes_size_ = p.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = static_cast<io_uring_sqe*>(MapRing(sqes_size_, IORING_OFF_SQES));
+    if (sqes_ == nullptr) {
+      return false;
+    }
+
+    sq_head_    = RingField<std::uint32_t>(sq_ring_, p.sq_off.head);
+    sq_tail_    = RingField<std::uint32_t>(sq_ring_, p.sq_off.tail);
+    sq_mask_    = *RingField<std::uint32_t>(sq_ring_, p.sq_off.ring_mask);
+    sq_entries_ = p.sq_entries;
+    sq_array_   = RingField<std::uint32_t>(sq_ring_, p.sq_off.array);
+    cq_head_    = RingField<std::uint32_t>(cq_ring_, p.cq_off.head);
+    cq_tail_    = RingField<std::uint32_t>(cq_ring_, p.cq_off.tail);
+    cq_mask_    = *RingField<std::uint32_t>(cq_ring_, p.cq_off.ring_mask);
+    cqes_       = RingField<io_uring_cqe>(cq_ring_, p.cq_off.cqes);
+
+    // A ring that cannot read at all leaves AsyncIo on the thread pool.
+    bool has_read  = false;
+    bool has_readv = false;
+    ProbeReadOps(&has_read, &has_readv);
+    if (has_read) {
+      read_op_ = IORING_OP_READ;
+    } else if (has_readv) {
+      // AsyncIo slots are < queue_depth, so each in-flight read owns one.
+      iovecs_ = static_cast<iovec*>(std::malloc(sizeof(iovec) * queue_depth));
+      if (iovecs_ == nullptr) {
+        return false;
+      }
+      read_op_ = IORING_OP_READV;
+    } else {
+      return false;
+    }
+    return true;
+  }
+
+  std::uint32_t Submit(const AsyncIoOp* ops, std::uint32_t count) override {
+    std::uint32_t accepted = 0;
+    while (accepted < count) {
+      // Only this thread produces SQEs; the kernel advances the head.
+      const std::uint32_t head = LoadAcquire(sq_head_);
+      std::uint32_t tail       = *sq_tail_;
+      std::uint32_t batch      = 0;
+      while (accepted + batch < count && tail - head < sq_entries_) {
+        const AsyncIoOp& op     = ops[accepted + batch];
+        const std::uint32_t idx = tail & sq_mask_;
+
+        io_uring_sqe* sqe = &sqes_[idx];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode    = read_op_;
+        sqe->fd        = static_cast<int>(op.file);
+        sqe->off       = op.offset;
+        sqe->user_data = op.slot;
+        if (read_op_ == IORING_OP_READ) {
+          sqe->addr = reinterpret_cast<std::uint64_t>(op.dst);
+          sqe->len  = op.size;
+        } else {
+          iovec& iov   = iovecs_[op.slot];
+          iov.iov_base = op.dst;
+          iov.iov_len  = op.size;
+          sqe->addr    = reinterpret_cast<std::uint64_t>(&iov);
+          sqe->len     = 1;
+        }
+
+        sq_array_[idx] = idx;
+        ++tail;
+        ++batch;
+      }
+      if (batch == 0) {
+        break;
+      }
+      StoreRelease(sq_tail_, tail);
+      accepted += batch;
+
+      // Published entries are owned by the ring now; any the kernel does
+      // not take here go out with the next enter.
+      unsubmitted_ += batch;
+      if (!Enter(0, 0)) {
+        break;
+      }
+    }
+    return accepted;
+  }
+
+  std::uint32_t Reap(AsyncIoCompletion* out, std::uint32_t max,
+                     bool wait) override {
+    std::uint32_t head = *cq_head_;
+    if (wait && head == LoadAcquire(cq_tail_)) {
+      Enter(1, IORING_ENTER_GETEVENTS);
+    } else if (unsubmitted_ > 0) {
+      Enter(0, 0);
+    }
+
+    const std::uint32_t tail = LoadAcquire(cq_tail_);
+    std::uint32_t n          = 0;
+    while (n < max && head != tail) {
+      const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+      out[n++] = AsyncIoCompletion{static_cast<std::uint32_t>(cqe.user_data),
+                                   cqe.res};
+      ++head;
+    }
+    StoreRelease(cq_head_, head);
+    return n;
+  }
+
+ private:
+  // The opcode probe arrived in 5.6 together with IORING_OP_READ, so a
+  // kernel that rejects it is 5.1-5.5 and only has IORING_OP_READV.
+  void ProbeReadOps(bool* has_read, bool* has_readv) {
+    constexpr unsigned kProbeOps = 256;
+    auto* probe = static_cast<io_uring_probe*>(std::calloc(
+        1, sizeof(io_uring_probe) + kProbeOps * sizeof(io_uring_probe_op)));
+    if (probe == nullptr) {
+      *has_read  = false;
+      *has_readv = false;
+      return;
+    }
+    if (SysRegister(ring_fd_, IORING_REGISTER_PROBE, probe, kProbeOps) < 0) {
+      *has_read  = false;
+      *has_readv = true;
+    } else {
+      const auto supported = [probe](std::uint8_t op) {
+        return op <= probe->last_op &&
+               (probe->ops[op].flags & IO_URING_OP_SUPPORTED) != 0;
+      };
+      *has_read  = supported(IORING_OP_READ);
+      *has_readv = supported(IORING_OP_READV);
+    }
+    std::free(probe);
+  }
+
+  // Flushes unsubmitted SQEs; true once the kernel has taken all of them.
+  bool Enter(unsigned min_complete, unsigned flags) {
+    int r;
+    do {
+      r = SysEnter(ring_fd_, unsubmitted_, min_complete, flags);
+    } while (r < 0 && errno == EINTR);
+    if (r < 0) {
+      return false;
+    }
+    unsubmitted_ -= static_cast<std::uint32_t>(r);
+    return unsubmitted_ == 0;
+  }
+
+  void* MapRing(std::size_t size, std::uint64_t offset) {
+    void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ring_fd_,
+                     static_cast<off_t>(offset));
+    return p == MAP_FAILED ? nullptr : p;
+  }
+
+  int ring_fd_;
+  void* sq_ring_;
+  void* cq_ring_;
+  io_uring_sqe* sqes_;
+  std::size_t sq_ring_size_;
+  std::size_t cq_ring_size_;
+  std::size_t sqes_size_;
+
+  std::uint32_t* sq_head_;
+  std::uint32_t* sq_tail_;
+  std::uint32_t sq_mask_;
+  std::uint32_t sq_entries_;
+  std::uint32_t* sq_array_;
+  std::uint32_t* cq_head_;
+  std::uint32_t* cq_tail_;
+  std::uint32_t cq_mask_;
+  io_uring_cqe* cqes_;
+  std::uint32_t unsubmitted_;
+  std::uint8_t read_op_;  // IORING_OP_READ, or IORING_OP_READV pre-5.6
+  iovec* iovecs_;         // READV only, indexed by AsyncIoOp::slot
+};
+
+}  // namespace
+
+AsyncIoBackend* CreateIoUringBackend(std::uint32_t queue_depth) {
+  auto* backend = new (std::nothrow) IoUringBackend();
+  if (backend != nullptr && !backend->Init(queue_depth)) {
+    delete backend;
+    backend = nullptr;
+  }
+  return backend;
+}
+
+}  // namespace navary::io
+
+#else  // !NVR_IO_HAS_URING
+
+namespace navary::io {
+
+AsyncIoBackend* CreateIoUringBackend(std::uint32_t queue_depth) {
+  (void)queue_depth;
+  return nullptr;
+}
+
+}  // namespace navary::io
+
+#endif  // NVR_IO_HAS_URING
@@ -0,0 +1,44 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/internal/file_watch_backend.h
+// Purpose: Internal interface implemented by the change-detection backends
+//          (inotify on Linux, stat polling everywhere).
+// Policy: C++20, Google style, no exceptions, no RTTI.
+//
+// Backends only report raw "something happened to slot N"; FileWatcher
+// owns paths, user tags and debouncing. Slots are FileWatcher watch
+// indices in [0, max_watches).
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+namespace navary::io {
+
+class FileWatchBackend {
+ public:
+  virtual ~FileWatchBackend() = default;
+
+  // Starts watching |path| for |slot|. The file need not exist yet (it may
+  // be mid-save); false only when the location cannot be watched at all.
+  virtual bool Add(std::uint32_t slot, const char* path) = 0;
+
+  virtual void Remove(std::uint32_t slot) = 0;
+
+  // Writes each slot that changed since the last call once into |out|
+  // (capacity max_watches) and returns the count. Never blocks.
+  virtual std::uint32_t Collect(std::uint64_t now_ticks,
+                                std::uint32_t* out) = 0;
+};
+
+// Factories return an initialized backend (caller deletes) or nullptr.
+// inotify yields nullptr off Linux or when the kernel refuses an instance
+// (fs.inotify.max_user_instances exhausted).
+FileWatchBackend* CreateInotifyWatchBackend(std::uint32_t max_watches);
+
+// Stats every watched file at most once per |interval_ticks|.
+FileWatchBackend* CreatePollingWatchBackend(std::uint32_t max_watches,
+                                            std::uint64_t interval_ticks);
+
+}  // namespace navary::io
@@ -0,0 +1,293 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/internal/file_watch_inotify.cc
+// Purpose: Linux inotify change-detection backend.
+// Policy: C++20, Google style, no exceptions, no RTTI.
+//
+// Watches are placed on the parent directory, not the file: editors and
+// asset tools usually save by writing a temp file and renaming it over the
+// original, which would silently kill a watch on the old inode. One
+// directory watch is shared by every file watched inside it, keyed by the
+// watch descriptor so "a/b" and "./a/b" land on the same entry. The
+// descriptor is non-blocking, so Collect() costs one read() when idle.
+// Set NVR_IO_ENABLE_INOTIFY=0 to compile the backend out.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/io/internal/file_watch_backend.h"
+
+#ifndef NVR_IO_ENABLE_INOTIFY
+#define NVR_IO_ENABLE_INOTIFY 1
+#endif
+
+#if defined(__linux__) && NVR_IO_ENABLE_INOTIFY
+#define NVR_IO_HAS_INOTIFY 1
+#else
+#define NVR_IO_HAS_INOTIFY 0
+#endif
+
+#if NVR_IO_HAS_INOTIFY
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <string_view>
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace navary::io {
+
+namespace {
+
+constexpr std::uint32_t kWatchMask = IN_CLOSE_WRITE | IN_MODIFY |
+                                     IN_ATTRIB | IN_CREATE | IN_DELETE |
+                                     IN_MOVED_FROM | IN_MOVED_TO;
+
+constexpr std::uint32_t kNoDir = 0xFFFFFFFFu;
+
+std::uint32_t HashName(std::string_view name) {
+  std::uint32_t h = 2166136261u;
+  for (const char c : name) {
+    h = (h ^ static_cast<std::uint8_t>(c)) * 16777619u;
+  }
+  return h;
+}
+
+class InotifyWatchBackend final : public FileWatchBackend {
+ public:
+  InotifyWatchBackend()
+      : fd_(-1),
+        slots_(nullptr),
+        names_(nullptr),
+        dirs_(nullptr),
+        dirty_(nullptr),
+        dirty_list_(nullptr),
+        dirty_count_(0),
+        capacity_(0) {}
+
+  ~InotifyWatchBackend() override {
+    if (fd_ >= 0) {
+      ::close(fd_);  // drops every watch
+    }
+    delete[] names_;
+    std::free(slots_);
+    std::free(dirs_);
+    std::free(dirty_);
+    std::free(dirty_list_);
+  }
+
+  bool Init(std::uint32_t max_watches) {
+    slots_ = static_cast<Slot*>(std::malloc(sizeof(Slot) * max_watches));
+    dirs_  = static_cast<Dir*>(std::malloc(sizeof(Dir) * max_watches));
+    dirty_ = static_cast<std::uint8_t*>(std::malloc(max_watches));
+    dirty_list_ = static_cast<std::uint32_t*>(
+        std::malloc(sizeof(std::uint32_t) * max_watches));
+    names_ = new (std::nothrow) std::string[max_watches];
+    if (slots_ == nullptr || dirs_ == nullptr || dirty_ == nullptr ||
+        dirty_list_ == nullptr || names_ == nullptr) {
+      return false;
+    }
+    for (std::uint32_t i = 0; i < max_watches; ++i) {
+      slots_[i] = Slot{kNoDir, 0};
+      dirs_[i]  = Dir{-1, 0};
+      dirty_[i] = 0;
+    }
+    capacity_ = max_watches;
+
+    fd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    return fd_ >= 0;
+  }
+
+  bool Add(std::uint32_t slot, const char* path) override {
+    const std::string_view full(path);
+    const std::size_t split = full.find_last_of('/');
+    const std::string_view dir_path =
+        split == std::string_view::npos ? std::string_view(".")
+        : split == 0                    ? std::string_view("/")
+                                        : full.substr(0, split);
+    const std::string_view name =
+        split == std::string_view::npos ? full : full.substr(split + 1);
+    if (name.empty()) {
+      return false;
+    }
+
+    // The kernel returns the existing wd for a directory it already
+    // watches, however the path is spelled.
+    const std::string dir_string(dir_path);
+    const int wd = ::inotify_add_watch(fd_, dir_string.c_str(), kWatchMask);
+    if (wd < 0) {
+      return false;
+    }
+    std::uint32_t dir = FindDir(wd);
+    if (dir == kNoDir) {
+      dir = FindFreeDir();
+      if (dir == kNoDir) {
+        ::inotify_rm_watch(fd_, wd);
+        return false;
+      }
+      dirs_[dir] = Dir{wd, 0};
+    }
+
+    ++dirs_[dir].refs;
+    slots_[slot] = Slot{dir, HashName(name)};
+    names_[slot] = name;
+    return true;
+  }
+
+  void Remove(std::uint32_t slot) override {
+    const std::uint32_t dir = slots_[slot].dir;
+    if (dir == kNoDir) {
+      return;
+    }
+    slots_[slot] = Slot{kNoDir, 0};
+    names_[slot].clear();
+    if (--dirs_[dir].refs == 0) {
+      if (dirs_[dir].wd >= 0) {
+        ::inotify_rm_watch(fd_, dirs_[dir].wd);
+      }
+      dirs_[dir] = Dir{-1, 0};
+    }
+  }
+
+  std::uint32_t Collect(std::uint64_t now_ticks,
+                        std::uint32_t* out) override {
+    (void)now_ticks;
+    alignas(inotify_event) char buffer[16 * 1024];
+    for (;;) {
+      const ssize_t n = ::read(fd_, buffer, sizeof(buffer));
+      if (n <= 0) {
+        break;  // EAGAIN: queue drained
+      }
+      for (ssize_t at = 0; at < n;) {
+        const auto* ev = reinterpret_cast<const inotify_event*>(buffer + at);
+        at += static_cast<ssize_t>(sizeof(inotify_event) + ev->len);
+        if ((ev->mask & IN_Q_OVERFLOW) != 0) {
+          MarkAll();  // events were lost; let the owner re-check everything
+        } else if ((ev->mask & IN_IGNORED) != 0) {
+          DropDir(ev->wd);
+        } else if (ev->len > 0) {
+          MarkMatching(ev->wd, std::string_view(
+                                   ev->name, ::strnlen(ev->name, ev->len)));
+        }
+      }
+    }
+
+    const std::uint32_t count = dirty_count_;
+    for (std::uint32_t i = 0; i < count; ++i) {
+      out[i]                 = dirty_list_[i];
+      dirty_[dirty_list_[i]] = 0;
+    }
+    dirty_count_ = 0;
+    return count;
+  }
+
+ private:
+  struct Slot {
+    std::uint32_t dir;  // index into dirs_, kNoDir when unused
+    std::uint32_t name_hash;
+  };
+
+  struct Dir {
+    int wd;  // -1 once the kernel dropped the watch
+    std::uint32_t refs;
+  };
+
+  std::uint32_t FindDir(int wd) const {
+    for (std::uint32_t i = 0; i < capacity_; ++i) {
+      if (dirs_[i].refs > 0 && dirs_[i].wd == wd) {
+        return i;
+      }
+    }
+    return kNoDir;
+  }
+
+  // The kernel removed |wd| (directory deleted or unmounted). Its files
+  // are reported as changed and the entry stays, watch-less, until they
+  // are removed; watching them again once the directory is back re-arms.
+  void DropDir(int wd) {
+    const std::uint32_t dir = FindDir(wd);
+    if (dir == kNoDir) {
+      return;  // our own inotify_rm_watch
+    }
+    dirs_[dir].wd = -1;
+    for (std::uint32_t i = 0; i < capacity_; ++i) {
+      if (slots_[i].dir == dir) {
+        Mark(i);
+      }
+    }
+  }
+
+  std::uint32_t FindFreeDir() const {
+    for (std::uint32_t i = 0; i < capacity_; ++i) {
+      if (dirs_[i].refs == 0) {
+        return i;
+      }
+    }
+    return kNoDir;
+  }
+
+  void Mark(std::uint32_t slot) {
+    if (dirty_[slot] == 0) {
+      dirty_[slot]                = 1;
+      dirty_list_[dirty_count_++] = slot;
+    }
+  }
+
+  void MarkAll() {
+    for (std::uint32_t i = 0; i < capacity_; ++i) {
+      if (slots_[i].dir != kNoDir) {
+        Mark(i);
+      }
+    }
+  }
+
+  // Linear over slots, but the hash rejects nearly all of them without a
+  // string compare; events only arrive while someone is editing.
+  void MarkMatching(int wd, std::string_view name) {
+    const std::uint32_t hash = HashName(name);
+    for (std::uint32_t i = 0; i < capacity_; ++i) {
+      const Slot& s = slots_[i];
+      if (s.dir != kNoDir && s.name_hash == hash && dirs_[s.dir].wd == wd &&
+          names_[i] == name) {
+        Mark(i);
+      }
+    }
+  }
+
+  int fd_;
+  Slot* slots_;
+  std::string* names_;
+  Dir* dirs_;
+  std::uint8_t* dirty_;
+  std::uint32_t* dirty_list_;
+  std::uint32_t dirty_count_;
+  std::uint32_t capacity_;
+};
+
+}  // namespace
+
+FileWatchBackend* CreateInotifyWatchBackend(std::uint32_t max_watches) {
+  auto* backend = new (std::nothrow) InotifyWatchBackend();
+  if (backend != nullptr && !backend->Init(max_watches)) {
+    delete backend;
+    backend = nullptr;
+  }
+  return backend;
+}
+
+}  // namespace navary::io
+
+#else  // !NVR_IO_HAS_INOTIFY
+
+namespace navary::io {
+
+FileWatchBackend* CreateInotifyWatchBackend(std::uint32_t max_watches) {
+  (void)max_watches;
+  return nullptr;
+}
+
+}  // namespace navary::io
+
+#endif  // NVR_IO_HAS_INOTIFY
@@ -0,0 +1,120 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/internal/file_watch_polling.cc
+// Purpose: Portable change-detection backend: compares size and last
+//          write time of every watched file at a fixed interval.
+// Policy: C++20, Google style, no exceptions, no RTTI.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+#include "navary/io/internal/file_watch_backend.h"
+#include "navary/io/internal/platform_file_ifacade.h"
+
+namespace navary::io {
+
+namespace {
+
+class PollingWatchBackend final : public FileWatchBackend {
+ public:
+  PollingWatchBackend()
+      : entries_(nullptr),
+        paths_(nullptr),
+        capacity_(0),
+        interval_ticks_(0),
+        last_poll_ticks_(0),
+        polled_(false) {}
+
+  ~PollingWatchBackend() override {
+    delete[] paths_;
+    std::free(entries_);
+  }
+
+  bool Init(std::uint32_t max_watches, std::uint64_t interval_ticks) {
+    entries_ =
+        static_cast<Entry*>(std::malloc(sizeof(Entry) * max_watches));
+    paths_ = new (std::nothrow) std::string[max_watches];
+    if (entries_ == nullptr || paths_ == nullptr) {
+      return false;
+    }
+    std::memset(entries_, 0, sizeof(Entry) * max_watches);
+    capacity_       = max_watches;
+    interval_ticks_ = interval_ticks;
+    return true;
+  }
+
+  bool Add(std::uint32_t slot, const char* path) override {
+    Entry& e    = entries_[slot];
+    paths_[slot] = path;
+    e.exists    = PlatformFileStamp(path, &e.size, &e.mtime_ns);
+    e.active    = true;
+    return true;
+  }
+
+  void Remove(std::uint32_t slot) override {
+    entries_[slot].active = false;
+    paths_[slot].clear();
+  }
+
+  std::uint32_t Collect(std::uint64_t now_ticks,
+                        std::uint32_t* out) override {
+    if (polled_ && now_ticks - last_poll_ticks_ < interval_ticks_) {
+      return 0;
+    }
+    polled_          = true;
+    last_poll_ticks_ = now_ticks;
+
+    std::uint32_t count = 0;
+    for (std::uint32_t i = 0; i < capacity_; ++i) {
+      Entry& e = entries_[i];
+      if (!e.active) {
+        continue;
+      }
+      std::uint64_t size  = 0;
+      std::uint64_t mtime = 0;
+      const bool exists =
+          PlatformFileStamp(paths_[i].c_str(), &size, &mtime);
+      if (exists != e.exists || size != e.size || mtime != e.mtime_ns) {
+        e.exists   = exists;
+        e.size     = size;
+        e.mtime_ns = mtime;
+
+        out[count++] = i;
+      }
+    }
+    return count;
+  }
+
+ private:
+  struct Entry {
+    std::uint64_t size;
+    std::uint64_t mtime_ns;
+    bool exists;
+    bool active;
+  };
+
+  Entry* entries_;
+  std::string* paths_;
+  std::uint32_t capacity_;
+  std::uint64_t interval_ticks_;
+  std::uint64_t last_poll_ticks_;
+  bool polled_;
+};
+
+}  // namespace
+
+FileWatchBackend* CreatePollingWatchBackend(std::uint32_t max_watches,
+                                            std::uint64_t interval_ticks) {
+  auto* backend = new (std::nothrow) PollingWatchBackend();
+  if (backend != nullptr && !backend->Init(max_watches, interval_ticks)) {
+    delete backend;
+    backend = nullptr;
+  }
+  return backend;
+}
+
+}  // namespace navary::io
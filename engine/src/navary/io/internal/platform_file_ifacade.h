@@ -0,0 +1,48 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/internal/platform_file_ifacade.h
+// Purpose: Internal per-OS file mapping backend interface facade.
+// Policy: C++20, Google style, no exceptions, no RTTI.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+namespace navary::io {
+
+// Read-only mapping of a whole file. Empty files map to data == nullptr,
+// size == 0.
+struct PlatformFileMapping {
+  const std::uint8_t* data = nullptr;
+  std::uint64_t size       = 0;
+  std::intptr_t file       = -1;  // fd / HANDLE
+  std::intptr_t mapping    = 0;   // Windows mapping object, unused on POSIX
+};
+
+// Maps |path| read-only. Returns false if the file cannot be opened/mapped.
+bool PlatformMapFile(const char* path, PlatformFileMapping* out);
+
+// Releases a mapping produced by PlatformMapFile; safe on an empty mapping.
+void PlatformUnmapFile(PlatformFileMapping* mapping);
+
+// Returns true and the size if |path| is an existing regular file.
+bool PlatformFileSize(const char* path, std::uint64_t* out_size);
+
+// Size and last write time (nanoseconds, platform epoch) of a regular
+// file; used to detect edits where no change notifications exist.
+bool PlatformFileStamp(const char* path, std::uint64_t* out_size,
+                       std::uint64_t* out_mtime_ns);
+
+// Opens |path| for positional reads. Returns false if it cannot be opened.
+bool PlatformOpenRead(const char* path, std::intptr_t* out_file);
+
+// Reads up to |size| bytes at |offset| without moving a shared file
+// position, so concurrent calls on one handle are safe. Returns the byte
+// count (short only at end of file) or -1 on error.
+std::int64_t PlatformReadAt(std::intptr_t file, std::uint64_t offset,
+                            void* dst, std::uint32_t size);
+
+void PlatformCloseFile(std::intptr_t file);
+
+}  // namespace navary::io
@@ -0,0 +1,130 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/internal/platform_file_posix.cc
+// Purpose: POSIX (Linux, Android, Apple) file mapping backend (mmap).
+// Policy: C++20, Google style, no exceptions, no RTTI.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#if !defined(_WIN32)
+
+#include "navary/io/internal/platform_file_ifacade.h"
+
+#include <cerrno>
+#include <cstddef>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace navary::io {
+
+bool PlatformMapFile(const char* path, PlatformFileMapping* out) {
+  *out = PlatformFileMapping{};
+
+  const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat st{};
+  if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+    ::close(fd);
+    return false;
+  }
+
+  if (st.st_size == 0) {
+    out->file = fd;
+    return true;
+  }
+
+  void* p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ,
+                   MAP_PRIVATE, fd, 0);
+  if (p == MAP_FAILED) {
+    ::close(fd);
+    return false;
+  }
+
+  out->data = static_cast<const std::uint8_t*>(p);
+  out->size = static_cast<std::uint64_t>(st.st_size);
+  out->file = fd;
+  return true;
+}
+
+void PlatformUnmapFile(PlatformFileMapping* mapping) {
+  if (mapping->data != nullptr) {
+    ::munmap(const_cast<std::uint8_t*>(mapping->data),
+             static_cast<std::size_t>(mapping->size));
+  }
+  if (mapping->file >= 0) {
+    ::close(static_cast<int>(mapping->file));
+  }
+  *mapping = PlatformFileMapping{};
+}
+
+bool PlatformFileSize(const char* path, std::uint64_t* out_size) {
+  struct stat st{};
+  if (::stat(path, &st) != 0 || !S_ISREG(st.st_mode)) {
+    return false;
+  }
+  *out_size = static_cast<std::uint64_t>(st.st_size);
+  return true;
+}
+
+bool PlatformFileStamp(const char* path, std::uint64_t* out_size,
+                       std::uint64_t* out_mtime_ns) {
+  struct stat st{};
+  if (::stat(path, &st) != 0 || !S_ISREG(st.st_mode)) {
+    return false;
+  }
+#if defined(__APPLE__)
+  const struct timespec& mtime = st.st_mtimespec;
+#else
+  const struct timespec& mtime = st.st_mtim;
+#endif
+  *out_size     = static_cast<std::uint64_t>(st.st_size);
+  *out_mtime_ns = static_cast<std::uint64_t>(mtime.tv_sec) * 1000000000ull +
+                  static_cast<std::uint64_t>(mtime.tv_nsec);
+  return true;
+}
+
+bool PlatformOpenRead(const char* path, std::intptr_t* out_file) {
+  const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  *out_file = fd;
+  return true;
+}
+
+std::int64_t PlatformReadAt(std::intptr_t file, std::uint64_t offset,
+                            void* dst, std::uint32_t size) {
+  auto* out         = static_cast<std::uint8_t*>(dst);
+  std::uint32_t got = 0;
+  while (got < size) {
+    const ssize_t n = ::pread(static_cast<int>(file), out + got, size - got,
+                              static_cast<off_t>(offset + got));
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return -1;
+    }
+    if (n == 0) {
+      break;  // end of file
+    }
+    got += static_cast<std::uint32_t>(n);
+  }
+  return got;
+}
+
+void PlatformCloseFile(std::intptr_t file) {
+  if (file >= 0) {
+    ::close(static_cast<int>(file));
+  }
+}
+
+}  // namespace navary::io
+
+#endif  // !_WIN32
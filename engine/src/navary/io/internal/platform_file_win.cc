@@ -0,0 +1,146 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/internal/platform_file_win.cc
+// Purpose: Windows file mapping backend (CreateFileMapping/MapViewOfFile).
+// Policy: C++20, Google style, no exceptions, no RTTI.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#if defined(_WIN32)
+
+#include "navary/io/internal/platform_file_ifacade.h"
+
+#include <windows.h>
+
+namespace navary::io {
+
+bool PlatformMapFile(const char* path, PlatformFileMapping* out) {
+  *out = PlatformFileMapping{};
+
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size)) {
+    CloseHandle(file);
+    return false;
+  }
+
+  out->file = reinterpret_cast<std::intptr_t>(file);
+  if (size.QuadPart == 0) {
+    return true;
+  }
+
+  HANDLE mapping =
+      CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping == nullptr) {
+    CloseHandle(file);
+    *out = PlatformFileMapping{};
+    return false;
+  }
+
+  void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (view == nullptr) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    *out = PlatformFileMapping{};
+    return false;
+  }
+
+  out->data    = static_cast<const std::uint8_t*>(view);
+  out->size    = static_cast<std::uint64_t>(size.QuadPart);
+  out->mapping = reinterpret_cast<std::intptr_t>(mapping);
+  return true;
+}
+
+void PlatformUnmapFile(PlatformFileMapping* mapping) {
+  if (mapping->data != nullptr) {
+    UnmapViewOfFile(mapping->data);
+  }
+  if (mapping->mapping != 0) {
+    CloseHandle(reinterpret_cast<HANDLE>(mapping->mapping));
+  }
+  if (mapping->file != -1) {
+    CloseHandle(reinterpret_cast<HANDLE>(mapping->file));
+  }
+  *mapping = PlatformFileMapping{};
+}
+
+bool PlatformFileSize(const char* path, std::uint64_t* out_size) {
+  WIN32_FILE_ATTRIBUTE_DATA attr;
+  if (!GetFileAttributesExA(path, GetFileExInfoStandard, &attr) ||
+      (attr.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0) {
+    return false;
+  }
+  *out_size = (static_cast<std::uint64_t>(attr.nFileSizeHigh) << 32) |
+              attr.nFileSizeLow;
+  return true;
+}
+
+bool PlatformFileStamp(const char* path, std::uint64_t* out_size,
+                       std::uint64_t* out_mtime_ns) {
+  WIN32_FILE_ATTRIBUTE_DATA attr;
+  if (!GetFileAttributesExA(path, GetFileExInfoStandard, &attr) ||
+      (attr.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0) {
+    return false;
+  }
+  *out_size = (static_cast<std::uint64_t>(attr.nFileSizeHigh) << 32) |
+              attr.nFileSizeLow;
+  // FILETIME counts 100 ns intervals.
+  const std::uint64_t ticks =
+      (static_cast<std::uint64_t>(attr.ftLastWriteTime.dwHighDateTime) << 32) |
+      attr.ftLastWriteTime.dwLowDateTime;
+  *out_mtime_ns = ticks * 100;
+  return true;
+}
+
+bool PlatformOpenRead(const char* path, std::intptr_t* out_file) {
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  *out_file = reinterpret_cast<std::intptr_t>(file);
+  return true;
+}
+
+std::int64_t PlatformReadAt(std::intptr_t file, std::uint64_t offset,
+                            void* dst, std::uint32_t size) {
+  auto* out         = static_cast<std::uint8_t*>(dst);
+  std::uint32_t got = 0;
+  while (got < size) {
+    // An explicit OVERLAPPED offset makes ReadFile positional on a
+    // synchronous handle, so threads do not race on the file pointer.
+    OVERLAPPED ov{};
+    const std::uint64_t at = offset + got;
+    ov.Offset              = static_cast<DWORD>(at & 0xFFFFFFFFu);
+    ov.OffsetHigh          = static_cast<DWORD>(at >> 32);
+
+    DWORD n = 0;
+    if (!ReadFile(reinterpret_cast<HANDLE>(file), out + got, size - got, &n,
+                  &ov)) {
+      if (GetLastError() == ERROR_HANDLE_EOF) {
+        break;
+      }
+      return -1;
+    }
+    if (n == 0) {
+      break;  // end of file
+    }
+    got += n;
+  }
+  return got;
+}
+
+void PlatformCloseFile(std::intptr_t file) {
+  if (file != -1) {
+    CloseHandle(reinterpret_cast<HANDLE>(file));
+  }
+}
+
+}  // namespace navary::io
+
+#endif  // _WIN32
@@ -0,0 +1,201 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/lz_block.cc
+// Purpose: LZ4 block format encoder/decoder.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/io/lz_block.h"
+
+#include <cstring>
+
+namespace navary::io {
+
+namespace {
+
+constexpr std::size_t kMinMatch     = 4;
+constexpr std::size_t kLastLiterals = 5;   // format: tail is literals
+constexpr std::size_t kMatchLimit   = 12;  // format: no match starts later
+constexpr std::size_t kMaxOffset    = 65535;
+constexpr int kHashBits             = 13;
+
+inline std::uint32_t Read32(const std::uint8_t* p) {
+  std::uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline std::uint32_t Hash(std::uint32_t v) {
+  return (v * 2654435761u) >> (32 - kHashBits);
+}
+
+// Writes the 255-run continuation of a length field that overflowed 15.
+inline bool PutLength(std::size_t rest, std::uint8_t* dst, std::size_t* op,
+                      std::size_t capacity) {
+  while (rest >= 255) {
+    if (*op >= capacity) {
+      return false;
+    }
+    dst[(*op)++] = 255;
+    rest -= 255;
+  }
+  if (*op >= capacity) {
+    return false;
+  }
+  dst[(*op)++] = static_cast<std::uint8_t>(rest);
+  return true;
+}
+
+inline bool GetLength(const std::uint8_t* src, std::size_t size,
+                      std::size_t* ip, std::size_t* len) {
+  std::uint8_t b;
+  do {
+    if (*ip >= size) {
+      return false;
+    }
+    b = src[(*ip)++];
+    *len += b;
+  } while (b == 255);
+  return true;
+}
+
+// Emits literals [anchor, anchor + literals) and, if |match_len| > 0, the
+// match that follows them.
+bool EmitSequence(const std::uint8_t* anchor, std::size_t literals,
+                  std::size_t offset, std::size_t match_len, std::uint8_t* dst,
+                  std::size_t* op, std::size_t capacity) {
+  if (*op >= capacity) {
+    return false;
+  }
+  const std::size_t ml = match_len > 0 ? match_len - kMinMatch : 0;
+  std::uint8_t& token  = dst[(*op)++];
+  token = static_cast<std::uint8_t>(((literals < 15 ? literals : 15) << 4) |
+                                    (ml < 15 ? ml : 15));
+
+  if (literals >= 15 && !PutLength(literals - 15, dst, op, capacity)) {
+    return false;
+  }
+  if (literals > capacity - *op) {
+    return false;
+  }
+  std::memcpy(dst + *op, anchor, literals);
+  *op += literals;
+
+  if (match_len == 0) {
+    return true;
+  }
+  if (capacity - *op < 2) {
+    return false;
+  }
+  dst[(*op)++] = static_cast<std::uint8_t>(offset & 0xFF);
+  dst[(*op)++] = static_cast<std::uint8_t>(offset >> 8);
+  return ml < 15 || PutLength(ml - 15, dst, op, capacity);
+}
+
+}  // namespace
+
+std::size_t LzCompress(const std::uint8_t* src, std::size_t size,
+                       std::uint8_t* dst, std::size_t capacity) {
+  std::size_t op     = 0;
+  std::size_t anchor = 0;
+
+  if (size > kMatchLimit) {
+    std::uint32_t table[1u << kHashBits] = {};
+    const std::size_t match_start_end    = size - kMatchLimit;
+    const std::size_t match_end_limit    = size - kLastLiterals;
+
+    std::size_t ip = 0;
+    while (ip < match_start_end) {
+      const std::uint32_t seq  = Read32(src + ip);
+      const std::uint32_t h    = Hash(seq);
+      std::size_t cand         = table[h];
+      table[h]                 = static_cast<std::uint32_t>(ip);
+      if (cand >= ip || ip - cand > kMaxOffset || Read32(src + cand) != seq) {
+        ++ip;
+        continue;
+      }
+
+      // Grow the match backwards into pending literals, then forwards.
+      std::size_t start = ip;
+      while (start > anchor && cand > 0 && src[start - 1] == src[cand - 1]) {
+        --start;
+        --cand;
+      }
+      std::size_t end = ip + kMinMatch;
+      while (end < match_end_limit && src[end] == src[cand + (end - start)]) {
+        ++end;
+      }
+
+      if (!EmitSequence(src + anchor, start - anchor, start - cand,
+                        end - start, dst, &op, capacity)) {
+        return 0;
+      }
+      ip = anchor = end;
+      if (ip - 2 < match_start_end) {
+        table[Hash(Read32(src + ip - 2))] = static_cast<std::uint32_t>(ip - 2);
+      }
+    }
+  }
+
+  if (!EmitSequence(src + anchor, size - anchor, 0, 0, dst, &op, capacity)) {
+    return 0;
+  }
+  return op;
+}
+
+bool LzDecompress(const std::uint8_t* src, std::size_t size,
+                  std::uint8_t* dst, std::size_t dst_size) {
+  std::size_t ip = 0;
+  std::size_t op = 0;
+  while (ip < size) {
+    const std::uint8_t token = src[ip++];
+
+    std::size_t literals = token >> 4;
+    if (literals == 15 && !GetLength(src, size, &ip, &literals)) {
+      return false;
+    }
+    if (literals > size - ip || literals > dst_size - op) {
+      return false;
+    }
+    std::memcpy(dst + op, src + ip, literals);
+    ip += literals;
+    op += literals;
+
+    if (ip == size) {
+      break;  // the last sequence carries literals only
+    }
+
+    if (size - ip < 2) {
+      return false;
+    }
+    const std::size_t offset = src[ip] | (std::size_t{src[ip + 1]} << 8);
+    ip += 2;
+    if (offset == 0 || offset > op) {
+      return false;
+    }
+
+    std::size_t match_len = token & 15;
+    if (match_len == 15 && !GetLength(src, size, &ip, &match_len)) {
+      return false;
+    }
+    match_len += kMinMatch;
+    if (match_len > dst_size - op) {
+      return false;
+    }
+
+    const std::uint8_t* from = dst + op - offset;
+    if (offset >= match_len) {
+      std::memcpy(dst + op, from, match_len);
+    } else {
+      // Overlapping copy replicates the last |offset| bytes (RLE runs).
+      for (std::size_t i = 0; i < match_len; ++i) {
+        dst[op + i] = from[i];
+      }
+    }
+    op += match_len;
+  }
+  return op == dst_size;
+}
+
+}  // namespace navary::io
@@ -0,0 +1,36 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/lz_block.h
+// Purpose: Fast LZ77 block codec for pack entries (LZ4 block format).
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Streams use the LZ4 block format (token, literals, 16-bit offset, match
+// length; last 5 bytes are literals), so blocks can be produced or checked
+// with stock lz4 tooling. The encoder is a single-probe greedy matcher:
+// it trades ratio for speed, since packs are decoded far more often than
+// they are built. Blocks are independent; no dictionary carries over.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstddef>
+#include <cstdint>
+
+namespace navary::io {
+
+// Worst-case encoded size of |size| input bytes.
+inline constexpr std::size_t LzCompressBound(std::size_t size) {
+  return size + size / 255 + 16;
+}
+
+// Encodes |src| into |dst|. Returns the encoded size, or 0 if it does not
+// fit in |capacity| (callers then store the block raw).
+std::size_t LzCompress(const std::uint8_t* src, std::size_t size,
+                       std::uint8_t* dst, std::size_t capacity);
+
+// Decodes a block that must expand to exactly |dst_size| bytes. Returns
+// false on malformed input; never reads or writes out of bounds.
+bool LzDecompress(const std::uint8_t* src, std::size_t size,
+                  std::uint8_t* dst, std::size_t dst_size);
+
+}  // namespace navary::io
@@ -0,0 +1,53 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/mapped_file.cc
+// Purpose: MappedFile implementation over the platform mapping backend.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/io/mapped_file.h"
+
+namespace navary::io {
+
+MappedFile::~MappedFile() {
+  Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : mapping_(other.mapping_), open_(other.open_) {
+  other.mapping_ = PlatformFileMapping{};
+  other.open_    = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    Close();
+    mapping_       = other.mapping_;
+    open_          = other.open_;
+    other.mapping_ = PlatformFileMapping{};
+    other.open_    = false;
+  }
+  return *this;
+}
+
+NavaryRC MappedFile::Open(const char* path) {
+  Close();
+  if (path == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument, "MappedFile: null path");
+  }
+  if (!PlatformMapFile(path, &mapping_)) {
+    return NavaryRC(NavaryStatus::kNotFound, "MappedFile: cannot map file");
+  }
+  open_ = true;
+  return NavaryRC::OK();
+}
+
+void MappedFile::Close() {
+  if (open_) {
+    PlatformUnmapFile(&mapping_);
+    open_ = false;
+  }
+}
+
+}  // namespace navary::io
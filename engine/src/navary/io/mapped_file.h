@@ -0,0 +1,54 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/mapped_file.h
+// Purpose: RAII read-only memory mapping of a whole file.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/io/internal/platform_file_ifacade.h"
+#include "navary/memory/span.h"
+#include "navary/navary_status.h"
+
+namespace navary::io {
+
+class MappedFile {
+ public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile&)            = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+  // Maps |path|; an already open mapping is closed first.
+  NavaryRC Open(const char* path);
+  void Close();
+
+  bool is_open() const {
+    return open_;
+  }
+
+  // Valid until Close() or destruction.
+  memory::Span<const std::uint8_t> bytes() const {
+    return memory::Span<const std::uint8_t>(
+        mapping_.data, static_cast<std::size_t>(mapping_.size));
+  }
+  const std::uint8_t* data() const {
+    return mapping_.data;
+  }
+  std::uint64_t size() const {
+    return mapping_.size;
+  }
+
+ private:
+  PlatformFileMapping mapping_{};
+  bool open_ = false;
+};
+
+}  // namespace navary::io
@@ -0,0 +1,167 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/pack_archive.cc
+// Purpose: PackArchive implementation (validation, hash lookup).
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/io/pack_archive.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "navary/io/vfs_path.h"
+
+namespace navary::io {
+
+NavaryRC PackArchive::Open(const char* path) {
+  Close();
+  NAVARY_RETURN_IF_ERROR(file_.Open(path));
+
+  NavaryRC rc = Validate(file_.bytes());
+  if (!rc.ok()) {
+    file_.Close();
+  }
+  return rc;
+}
+
+NavaryRC PackArchive::OpenFromMemory(memory::Span<const std::uint8_t> bytes) {
+  Close();
+  return Validate(bytes);
+}
+
+void PackArchive::Close() {
+  file_.Close();
+  base_        = nullptr;
+  size_        = 0;
+  toc_         = nullptr;
+  names_       = nullptr;
+  entry_count_ = 0;
+}
+
+NavaryRC PackArchive::Validate(memory::Span<const std::uint8_t> bytes) {
+  if (bytes.data() == nullptr || bytes.size() < sizeof(PackHeader)) {
+    return NavaryRC(NavaryStatus::kParseError, "PackArchive: file too small");
+  }
+
+  PackHeader header;
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  if (header.magic != kPackMagic) {
+    return NavaryRC(NavaryStatus::kParseError, "PackArchive: bad magic");
+  }
+  if (header.version != kPackVersion) {
+    return NavaryRC(NavaryStatus::kParseError,
+                    "PackArchive: unsupported version");
+  }
+
+  const std::uint64_t size      = bytes.size();
+  const std::uint64_t toc_bytes =
+      static_cast<std::uint64_t>(header.entry_count) * sizeof(PackTocEntry);
+  const std::uintptr_t toc_address =
+      reinterpret_cast<std::uintptr_t>(bytes.data()) + header.toc_offset;
+  if (toc_address % alignof(PackTocEntry) != 0 ||
+      header.toc_offset > size || toc_bytes > size - header.toc_offset ||
+      header.names_offset > size ||
+      header.names_size > size - header.names_offset) {
+    return NavaryRC(NavaryStatus::kParseError,
+                    "PackArchive: table out of bounds");
+  }
+
+  const auto* toc =
+      reinterpret_cast<const PackTocEntry*>(bytes.data() + header.toc_offset);
+  for (std::uint32_t i = 0; i < header.entry_count; ++i) {
+    const PackTocEntry& e = toc[i];
+    if (e.offset > size || e.size > size - e.offset ||
+        static_cast<std::uint64_t>(e.name_offset) + e.name_length >
+            header.names_size) {
+      return NavaryRC(NavaryStatus::kParseError,
+                      "PackArchive: entry out of bounds");
+    }
+    const memory::Span<const std::uint8_t> stored(
+        bytes.data() + e.offset, static_cast<std::size_t>(e.size));
+    if (!ValidatePackEntryBlocks(e, stored)) {
+      return NavaryRC(NavaryStatus::kParseError,
+                      "PackArchive: bad block table");
+    }
+    if (i > 0 && toc[i - 1].path_hash > e.path_hash) {
+      return NavaryRC(NavaryStatus::kParseError,
+                      "PackArchive: table not sorted");
+    }
+  }
+
+  const auto* names =
+      reinterpret_cast<const char*>(bytes.data() + header.names_offset);
+
+  base_        = bytes.data();
+  size_        = size;
+  toc_         = toc;
+  names_       = names;
+  entry_count_ = header.entry_count;
+  return NavaryRC::OK();
+}
+
+const PackTocEntry* PackArchive::Find(std::string_view path) const {
+  if (toc_ == nullptr) {
+    return nullptr;
+  }
+
+  char buffer[kVfsMaxPath];
+  const std::size_t n = NormalizeVfsPath(path, buffer, sizeof(buffer));
+  if (n == 0) {
+    return nullptr;
+  }
+  const std::string_view normalized(buffer, n);
+  const std::uint64_t hash = HashVfsPath(normalized);
+
+  const PackTocEntry* end = toc_ + entry_count_;
+  const PackTocEntry* it  = std::lower_bound(
+      toc_, end, hash, [](const PackTocEntry& e, std::uint64_t h) {
+        return e.path_hash < h;
+      });
+
+  // Hash collisions are resolved by the stored name.
+  for (; it != end && it->path_hash == hash; ++it) {
+    if (EntryName(*it) == normalized) {
+      return it;
+    }
+  }
+  return nullptr;
+}
+
+NavaryResult<memory::Span<const std::uint8_t>> PackArchive::Read(
+    std::string_view path) const {
+  const PackTocEntry* entry = Find(path);
+  if (entry == nullptr) {
+    return NavaryResult<memory::Span<const std::uint8_t>>(
+        NavaryRC(NavaryStatus::kNotFound, "PackArchive: entry not found"));
+  }
+  if (IsPackEntryCompressed(*entry)) {
+    return NavaryResult<memory::Span<const std::uint8_t>>(
+        NavaryRC(NavaryStatus::kInvalidArgument,
+                 "PackArchive: entry is compressed"));
+  }
+  return NavaryResult<memory::Span<const std::uint8_t>>(EntryData(*entry));
+}
+
+NavaryRC PackArchive::ReadInto(std::string_view path,
+                               memory::Span<std::uint8_t> dst,
+                               core::scheduler::JobSystem* jobs) const {
+  const PackTocEntry* entry = Find(path);
+  if (entry == nullptr) {
+    return NavaryRC(NavaryStatus::kNotFound, "PackArchive: entry not found");
+  }
+  return DecodePackEntry(*entry, EntryData(*entry), dst, jobs);
+}
+
+memory::Span<const std::uint8_t> PackArchive::EntryData(
+    const PackTocEntry& entry) const {
+  return memory::Span<const std::uint8_t>(
+      base_ + entry.offset, static_cast<std::size_t>(entry.size));
+}
+
+std::string_view PackArchive::EntryName(const PackTocEntry& entry) const {
+  return std::string_view(names_ + entry.name_offset, entry.name_length);
+}
+
+}  // namespace navary::io
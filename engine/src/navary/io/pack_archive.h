@@ -0,0 +1,79 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/pack_archive.h
+// Purpose: Read-only, memory-mapped pack archive with a sorted hash TOC.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Lookups are a binary search over path hashes; reads return spans into
+// the mapping (zero copy) that stay valid while the archive is open.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+#include <string_view>
+
+#include "navary/io/mapped_file.h"
+#include "navary/io/pack_compression.h"
+#include "navary/io/pack_format.h"
+#include "navary/memory/span.h"
+#include "navary/navary_status.h"
+
+namespace navary::io {
+
+class PackArchive {
+ public:
+  PackArchive() = default;
+
+  PackArchive(const PackArchive&)            = delete;
+  PackArchive& operator=(const PackArchive&) = delete;
+
+  // Maps and validates |path|.
+  NavaryRC Open(const char* path);
+
+  // Uses caller-owned bytes (embedded packs, tests); must outlive the
+  // archive.
+  NavaryRC OpenFromMemory(memory::Span<const std::uint8_t> bytes);
+
+  void Close();
+
+  bool is_open() const {
+    return base_ != nullptr;
+  }
+
+  // nullptr if |path| is not in the pack.
+  const PackTocEntry* Find(std::string_view path) const;
+
+  // Zero-copy view of an uncompressed entry; kInvalidArgument for
+  // compressed entries (use ReadInto).
+  NavaryResult<memory::Span<const std::uint8_t>> Read(
+      std::string_view path) const;
+
+  // Decodes |path| into |dst| (>= raw_size bytes, e.g. an arena block or a
+  // staging reservation), in parallel over |jobs| when given.
+  NavaryRC ReadInto(std::string_view path, memory::Span<std::uint8_t> dst,
+                    core::scheduler::JobSystem* jobs) const;
+
+  // Stored bytes (block table + payloads for compressed entries).
+  memory::Span<const std::uint8_t> EntryData(const PackTocEntry& entry) const;
+  std::string_view EntryName(const PackTocEntry& entry) const;
+
+  std::uint32_t entry_count() const {
+    return entry_count_;
+  }
+  const PackTocEntry* entries() const {
+    return toc_;
+  }
+
+ private:
+  NavaryRC Validate(memory::Span<const std::uint8_t> bytes);
+
+  MappedFile file_;
+  const std::uint8_t* base_  = nullptr;
+  std::uint64_t size_        = 0;
+  const PackTocEntry* toc_   = nullptr;
+  const char* names_         = nullptr;
+  std::uint32_t entry_count_ = 0;
+};
+
+}  // namespace navary::io
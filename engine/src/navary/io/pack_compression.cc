@@ -0,0 +1,188 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/pack_compression.cc
+// Purpose: Block table validation and (parallel) block decoding.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/io/pack_compression.h"
+
+#include <atomic>
+#include <cstring>
+
+#include "navary/core/scheduler/job_system.h"
+#include "navary/io/lz_block.h"
+
+namespace navary::io {
+
+namespace {
+
+struct DecodeContext {
+  const PackTocEntry* entry;
+  const std::uint8_t* stored;
+  const PackBlock* blocks;
+  std::uint8_t* dst;
+  std::uint32_t first_block;
+  std::atomic<bool> failed;
+};
+
+bool DecodeBlock(const DecodeContext& ctx, std::uint32_t index) {
+  const PackBlock block    = ctx.blocks[index];
+  const std::uint64_t raw  = PackBlockRawSize(*ctx.entry, index);
+  const std::uint64_t at   = std::uint64_t{index - ctx.first_block}
+                           << ctx.entry->block_shift;
+  std::uint8_t* out        = ctx.dst + at;
+  const std::uint8_t* from = ctx.stored + block.offset;
+
+  if (block.size == raw) {
+    std::memcpy(out, from, block.size);
+    return true;
+  }
+  return LzDecompress(from, block.size, out, static_cast<std::size_t>(raw));
+}
+
+void DecodeRange(std::uint32_t begin, std::uint32_t end, std::uint32_t worker,
+                 void* user_data) {
+  (void)worker;
+  auto* ctx = static_cast<DecodeContext*>(user_data);
+  for (std::uint32_t i = begin; i < end; ++i) {
+    if (!DecodeBlock(*ctx, ctx->first_block + i)) {
+      ctx->failed.store(true, std::memory_order_relaxed);
+    }
+  }
+}
+
+// Codec, block size / count and table placement; not the blocks.
+bool ValidateBlockGeometry(const PackTocEntry& entry,
+                           memory::Span<const std::uint8_t> stored) {
+  if (entry.codec != static_cast<std::uint8_t>(PackCodec::kLz) ||
+      entry.block_shift < kPackMinBlockShift ||
+      entry.block_shift > kPackMaxBlockShift) {
+    return false;
+  }
+
+  const std::uint64_t block_size = std::uint64_t{1} << entry.block_shift;
+  if (entry.block_count != (entry.raw_size + block_size - 1) / block_size) {
+    return false;
+  }
+
+  const std::uint64_t table_bytes =
+      std::uint64_t{entry.block_count} * sizeof(PackBlock);
+  if (stored.size() < table_bytes ||
+      reinterpret_cast<std::uintptr_t>(stored.data()) % alignof(PackBlock) !=
+          0) {
+    return false;
+  }
+  return true;
+}
+
+// Blocks [begin, end) lie after the table and inside |stored|. Requires
+// ValidateBlockGeometry().
+bool ValidateBlockRange(const PackTocEntry& entry,
+                        memory::Span<const std::uint8_t> stored,
+                        std::uint32_t begin, std::uint32_t end) {
+  const std::uint64_t table_bytes =
+      std::uint64_t{entry.block_count} * sizeof(PackBlock);
+  const auto* blocks = reinterpret_cast<const PackBlock*>(stored.data());
+  for (std::uint32_t i = begin; i < end; ++i) {
+    const PackBlock& b = blocks[i];
+    if (b.offset < table_bytes || b.offset > stored.size() ||
+        b.size > stored.size() - b.offset ||
+        b.size > PackBlockRawSize(entry, i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+bool ValidatePackEntryBlocks(const PackTocEntry& entry,
+                             memory::Span<const std::uint8_t> stored) {
+  if (!IsPackEntryCompressed(entry)) {
+    return entry.raw_size == entry.size;
+  }
+  return ValidateBlockGeometry(entry, stored) &&
+         ValidateBlockRange(entry, stored, 0, entry.block_count);
+}
+
+NavaryRC DecodePackBlocks(const PackTocEntry& entry,
+                          memory::Span<const std::uint8_t> stored,
+                          std::uint32_t first_block,
+                          std::uint32_t block_count,
+                          memory::Span<std::uint8_t> dst,
+                          core::scheduler::JobSystem* jobs) {
+  if (!IsPackEntryCompressed(entry)) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "DecodePackBlocks: entry is not compressed");
+  }
+  if (first_block > entry.block_count ||
+      block_count > entry.block_count - first_block) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "DecodePackBlocks: block range out of bounds");
+  }
+  if (block_count == 0) {
+    return NavaryRC::OK();
+  }
+
+  const std::uint64_t raw_begin = std::uint64_t{first_block}
+                                  << entry.block_shift;
+  const std::uint32_t last      = first_block + block_count - 1;
+  const std::uint64_t raw_bytes = (std::uint64_t{last} << entry.block_shift) +
+                                  PackBlockRawSize(entry, last) - raw_begin;
+  if (dst.size() < raw_bytes) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "DecodePackBlocks: destination too small");
+  }
+  if (!ValidateBlockGeometry(entry, stored) ||
+      !ValidateBlockRange(entry, stored, first_block,
+                          first_block + block_count)) {
+    return NavaryRC(NavaryStatus::kParseError,
+                    "DecodePackBlocks: bad block table");
+  }
+
+  DecodeContext ctx;
+  ctx.entry       = &entry;
+  ctx.stored      = stored.data();
+  ctx.blocks      = reinterpret_cast<const PackBlock*>(stored.data());
+  ctx.dst         = dst.data();
+  ctx.first_block = first_block;
+  ctx.failed.store(false, std::memory_order_relaxed);
+
+  if (jobs != nullptr && block_count > 1) {
+    jobs->ParallelFor(block_count, 1, &DecodeRange, &ctx);
+  } else {
+    DecodeRange(0, block_count, 0, &ctx);
+  }
+
+  if (ctx.failed.load(std::memory_order_relaxed)) {
+    return NavaryRC(NavaryStatus::kParseError,
+                    "DecodePackBlocks: corrupt block");
+  }
+  return NavaryRC::OK();
+}
+
+NavaryRC DecodePackEntry(const PackTocEntry& entry,
+                         memory::Span<const std::uint8_t> stored,
+                         memory::Span<std::uint8_t> dst,
+                         core::scheduler::JobSystem* jobs) {
+  if (dst.size() < entry.raw_size) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "DecodePackEntry: destination too small");
+  }
+  if (!IsPackEntryCompressed(entry)) {
+    if (stored.size() < entry.raw_size) {
+      return NavaryRC(NavaryStatus::kParseError,
+                      "DecodePackEntry: truncated entry");
+    }
+    if (entry.raw_size > 0) {
+      std::memcpy(dst.data(), stored.data(),
+                  static_cast<std::size_t>(entry.raw_size));
+    }
+    return NavaryRC::OK();
+  }
+  return DecodePackBlocks(entry, stored, 0, entry.block_count, dst, jobs);
+}
+
+}  // namespace navary::io
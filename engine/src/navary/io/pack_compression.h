@@ -0,0 +1,61 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/pack_compression.h
+// Purpose: Decoding of block-compressed pack entries (random access and
+//          job-parallel), shared by PackArchive, Vfs and streaming code
+//          that reads stored bytes through AsyncIo.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/io/pack_format.h"
+#include "navary/memory/span.h"
+#include "navary/navary_status.h"
+
+namespace navary::core::scheduler {
+class JobSystem;
+}  // namespace navary::core::scheduler
+
+namespace navary::io {
+
+inline bool IsPackEntryCompressed(const PackTocEntry& entry) {
+  return entry.codec != static_cast<std::uint8_t>(PackCodec::kNone);
+}
+
+// Raw bytes covered by block |index| of a compressed entry.
+inline std::uint64_t PackBlockRawSize(const PackTocEntry& entry,
+                                      std::uint32_t index) {
+  const std::uint64_t begin = std::uint64_t{index} << entry.block_shift;
+  const std::uint64_t end   = begin + (std::uint64_t{1} << entry.block_shift);
+  return (end < entry.raw_size ? end : entry.raw_size) - begin;
+}
+
+// Checks codec, block geometry and that every block lies inside |stored|
+// (the entry's stored bytes). Uncompressed entries pass when raw_size
+// equals size. PackArchive runs this once per entry at open.
+bool ValidatePackEntryBlocks(const PackTocEntry& entry,
+                             memory::Span<const std::uint8_t> stored);
+
+// Decodes blocks [first_block, first_block + block_count) into |dst|,
+// which receives raw bytes starting at first_block's raw offset. With
+// |jobs| the blocks decode in parallel across workers. Only the geometry
+// and the requested blocks' table entries are checked, so the cost follows
+// the range, not the entry's block count.
+NavaryRC DecodePackBlocks(const PackTocEntry& entry,
+                          memory::Span<const std::uint8_t> stored,
+                          std::uint32_t first_block,
+                          std::uint32_t block_count,
+                          memory::Span<std::uint8_t> dst,
+                          core::scheduler::JobSystem* jobs);
+
+// Decodes the whole entry into |dst| (>= raw_size bytes); uncompressed
+// entries are copied.
+NavaryRC DecodePackEntry(const PackTocEntry& entry,
+                         memory::Span<const std::uint8_t> stored,
+                         memory::Span<std::uint8_t> dst,
+                         core::scheduler::JobSystem* jobs);
+
+}  // namespace navary::io
@@ -0,0 +1,74 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/pack_format.h
+// Purpose: On-disk layout of .nvpk pack archives.
+// Policy: C++20, Google style, no exceptions, no RTTI, header-only.
+//
+// Layout (little-endian):
+//   PackHeader
+//   file data        each entry aligned to kPackDataAlignment
+//   PackTocEntry[]   sorted by path_hash, then name
+//   name table       normalized paths, not terminated
+//
+// Compressed entries (codec != kNone) store their data as:
+//   PackBlock[block_count]   offsets relative to the entry data start
+//   block payloads           each independently encoded
+// Block i covers raw bytes [i << block_shift, min(raw_size, (i+1) <<
+// block_shift)), so any range can be decoded without touching the rest.
+// A block whose stored size equals its raw size is stored uncompressed.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+namespace navary::io {
+
+inline constexpr std::uint32_t kPackMagic         = 0x4B50564Eu;  // "NVPK"
+inline constexpr std::uint16_t kPackVersion       = 2;
+inline constexpr std::uint64_t kPackDataAlignment = 16;
+
+// Block sizes accepted by readers: 4 KiB .. 1 MiB. Tools default to 64 KiB.
+inline constexpr std::uint8_t kPackMinBlockShift     = 12;
+inline constexpr std::uint8_t kPackMaxBlockShift     = 20;
+inline constexpr std::uint8_t kPackDefaultBlockShift = 16;
+
+enum class PackCodec : std::uint8_t {
+  kNone = 0,
+  kLz   = 1,  // navary/io/lz_block.h
+};
+
+struct PackHeader {
+  std::uint32_t magic;
+  std::uint16_t version;
+  std::uint16_t flags;  // reserved, 0
+  std::uint32_t entry_count;
+  std::uint32_t reserved;
+  std::uint64_t toc_offset;
+  std::uint64_t names_offset;
+  std::uint64_t names_size;
+};
+
+struct PackTocEntry {
+  std::uint64_t path_hash;  // HashVfsPath(normalized name)
+  std::uint64_t offset;     // from file start
+  std::uint64_t size;       // stored bytes (block table included)
+  std::uint64_t raw_size;   // decoded bytes; == size when codec is kNone
+  std::uint32_t name_offset;  // into the name table
+  std::uint32_t name_length;
+  std::uint8_t codec;  // PackCodec
+  std::uint8_t block_shift;
+  std::uint16_t reserved;
+  std::uint32_t block_count;
+};
+
+struct PackBlock {
+  std::uint32_t offset;  // from the entry data start
+  std::uint32_t size;    // stored bytes
+};
+
+static_assert(sizeof(PackHeader) == 40, "PackHeader layout");
+static_assert(sizeof(PackTocEntry) == 48, "PackTocEntry layout");
+static_assert(sizeof(PackBlock) == 8, "PackBlock layout");
+
+}  // namespace navary::io
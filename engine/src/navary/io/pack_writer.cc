@@ -0,0 +1,192 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/pack_writer.cc
+// Purpose: PackWriter implementation.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/io/pack_writer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "navary/io/lz_block.h"
+#include "navary/io/vfs_path.h"
+
+namespace navary::io {
+
+namespace {
+
+inline std::uint64_t AlignUp(std::uint64_t v, std::uint64_t a) {
+  return (v + (a - 1)) & ~(a - 1);
+}
+
+}  // namespace
+
+NavaryRC PackWriter::AddFile(std::string_view path,
+                             memory::Span<const std::uint8_t> data,
+                             const PackFileOptions& options) {
+  if (options.codec != PackCodec::kNone &&
+      (options.block_shift < kPackMinBlockShift ||
+       options.block_shift > kPackMaxBlockShift)) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "PackWriter: unsupported block size");
+  }
+
+  char buffer[kVfsMaxPath];
+  const std::size_t n = NormalizeVfsPath(path, buffer, sizeof(buffer));
+  if (n == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument, "PackWriter: bad path");
+  }
+
+  File file;
+  file.name.assign(buffer, n);
+  file.hash = HashVfsPath(file.name);
+  for (const File& f : files_) {
+    if (f.hash == file.hash && f.name == file.name) {
+      return NavaryRC(NavaryStatus::kInvalidArgument,
+                      "PackWriter: duplicate path");
+    }
+  }
+
+  file.raw_size    = data.size();
+  file.codec       = PackCodec::kNone;
+  file.block_shift = 0;
+  file.block_count = 0;
+  if (options.codec == PackCodec::kNone ||
+      !EncodeBlocks(data, options.block_shift, &file)) {
+    file.data.assign(data.begin(), data.end());
+  }
+  files_.push_back(std::move(file));
+  return NavaryRC::OK();
+}
+
+bool PackWriter::EncodeBlocks(memory::Span<const std::uint8_t> data,
+                              std::uint8_t block_shift, File* file) {
+  const std::uint64_t block_size = std::uint64_t{1} << block_shift;
+  const std::uint64_t count      = (data.size() + block_size - 1) / block_size;
+  const std::uint64_t table      = count * sizeof(PackBlock);
+  if (count == 0 || table >= data.size()) {
+    return false;
+  }
+
+  std::vector<PackBlock> blocks(count);
+  std::vector<std::uint8_t> payload;
+  std::vector<std::uint8_t> scratch(LzCompressBound(block_size));
+  for (std::uint64_t i = 0; i < count; ++i) {
+    const std::uint8_t* src = data.data() + i * block_size;
+    const std::size_t raw   = static_cast<std::size_t>(
+        std::min<std::uint64_t>(block_size, data.size() - i * block_size));
+
+    // Keep the encoded form only when it is strictly smaller; readers treat
+    // size == raw as a stored block.
+    std::size_t n = LzCompress(src, raw, scratch.data(), raw - 1);
+    if (n == 0) {
+      n = raw;
+      std::memcpy(scratch.data(), src, raw);
+    }
+
+    const std::uint64_t offset = table + payload.size();
+    if (offset + n > UINT32_MAX) {
+      return false;
+    }
+    blocks[i].offset = static_cast<std::uint32_t>(offset);
+    blocks[i].size   = static_cast<std::uint32_t>(n);
+    payload.insert(payload.end(), scratch.data(), scratch.data() + n);
+  }
+
+  if (table + payload.size() >= data.size()) {
+    return false;
+  }
+
+  file->data.resize(static_cast<std::size_t>(table));
+  std::memcpy(file->data.data(), blocks.data(),
+              static_cast<std::size_t>(table));
+  file->data.insert(file->data.end(), payload.begin(), payload.end());
+  file->codec       = PackCodec::kLz;
+  file->block_shift = block_shift;
+  file->block_count = static_cast<std::uint32_t>(count);
+  return true;
+}
+
+NavaryRC PackWriter::Build(std::vector<std::uint8_t>* out) const {
+  if (out == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument, "PackWriter: null out");
+  }
+
+  std::vector<const File*> order;
+  order.reserve(files_.size());
+  for (const File& f : files_) {
+    order.push_back(&f);
+  }
+  std::sort(order.begin(), order.end(), [](const File* a, const File* b) {
+    return a->hash != b->hash ? a->hash < b->hash : a->name < b->name;
+  });
+
+  std::vector<PackTocEntry> toc(order.size());
+  std::string names;
+
+  // Data first, in TOC order so neighbouring lookups stay close on disk.
+  std::uint64_t cursor = AlignUp(sizeof(PackHeader), kPackDataAlignment);
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    const File& f = *order[i];
+
+    toc[i].path_hash   = f.hash;
+    toc[i].offset      = cursor;
+    toc[i].size        = f.data.size();
+    toc[i].raw_size    = f.raw_size;
+    toc[i].name_offset = static_cast<std::uint32_t>(names.size());
+    toc[i].name_length = static_cast<std::uint32_t>(f.name.size());
+    toc[i].codec       = static_cast<std::uint8_t>(f.codec);
+    toc[i].block_shift = f.block_shift;
+    toc[i].block_count = f.block_count;
+    names += f.name;
+    cursor = AlignUp(cursor + f.data.size(), kPackDataAlignment);
+  }
+
+  PackHeader header{};
+  header.magic        = kPackMagic;
+  header.version      = kPackVersion;
+  header.entry_count  = static_cast<std::uint32_t>(toc.size());
+  header.toc_offset   = cursor;
+  header.names_offset = cursor + toc.size() * sizeof(PackTocEntry);
+  header.names_size   = names.size();
+
+  out->assign(header.names_offset + names.size(), 0);
+  std::uint8_t* dst = out->data();
+  std::memcpy(dst, &header, sizeof(header));
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    if (!order[i]->data.empty()) {
+      std::memcpy(dst + toc[i].offset, order[i]->data.data(),
+                  order[i]->data.size());
+    }
+  }
+  if (!toc.empty()) {
+    std::memcpy(dst + header.toc_offset, toc.data(),
+                toc.size() * sizeof(PackTocEntry));
+  }
+  if (!names.empty()) {
+    std::memcpy(dst + header.names_offset, names.data(), names.size());
+  }
+  return NavaryRC::OK();
+}
+
+NavaryRC PackWriter::WriteToFile(const char* path) const {
+  std::vector<std::uint8_t> bytes;
+  NAVARY_RETURN_IF_ERROR(Build(&bytes));
+
+  std::FILE* f = std::fopen(path, "wb");
+  if (f == nullptr) {
+    return NavaryRC(NavaryStatus::kIoError, "PackWriter: cannot open output");
+  }
+  const std::size_t written = std::fwrite(bytes.data(), 1, bytes.size(), f);
+  const bool closed         = std::fclose(f) == 0;
+  if (written != bytes.size() || !closed) {
+    return NavaryRC(NavaryStatus::kIoError, "PackWriter: write failed");
+  }
+  return NavaryRC::OK();
+}
+
+}  // namespace navary::io
@@ -0,0 +1,64 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/pack_writer.h
+// Purpose: Builds .nvpk pack archives (tools, cookers and tests).
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "navary/io/pack_format.h"
+#include "navary/memory/span.h"
+#include "navary/navary_status.h"
+
+namespace navary::io {
+
+struct PackFileOptions {
+  PackCodec codec          = PackCodec::kNone;
+  std::uint8_t block_shift = kPackDefaultBlockShift;
+};
+
+class PackWriter {
+ public:
+  PackWriter() = default;
+
+  // Copies |data|, block-compressing it when |options| ask for a codec.
+  // Entries that do not shrink are stored raw. Fails on an empty/overlong
+  // path, a duplicate or an unsupported block size.
+  NavaryRC AddFile(std::string_view path,
+                   memory::Span<const std::uint8_t> data,
+                   const PackFileOptions& options = {});
+
+  // Serializes the archive (TOC sorted by path hash).
+  NavaryRC Build(std::vector<std::uint8_t>* out) const;
+  NavaryRC WriteToFile(const char* path) const;
+
+  std::size_t file_count() const {
+    return files_.size();
+  }
+
+ private:
+  struct File {
+    std::string name;  // normalized
+    std::uint64_t hash;
+    std::vector<std::uint8_t> data;  // stored bytes
+    std::uint64_t raw_size;
+    PackCodec codec;
+    std::uint8_t block_shift;
+    std::uint32_t block_count;
+  };
+
+  // Fills |file| with the block table + encoded blocks; false if the
+  // result would not be smaller than |data|.
+  static bool EncodeBlocks(memory::Span<const std::uint8_t> data,
+                           std::uint8_t block_shift, File* file);
+
+  std::vector<File> files_;
+};
+
+}  // namespace navary::io
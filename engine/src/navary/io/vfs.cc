@@ -0,0 +1,234 @@
+// Navary Engine - IO Subsystem
+// File: navary/io/vfs.cc
+// Purpose: Vfs implementation (mount table, overlay, lookup).
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/io/vfs.h"
+
+#include <new>  // std::nothrow
+
+#include "navary/io/internal/platform_file_ifacade.h"
+#include "navary/io/pack_compression.h"
+#include "navary/io/vfs_path.h"
+
+namespace navary::io {
+
+Vfs::Vfs()
+    : mounts_(nullptr),
+      mount_paths_(nullptr),
+      max_mounts_(0),
+      mount_count_(0),
+      loose_hits_(0),
+      pack_hits_(0),
+      misses_(0) {}
+
+Vfs::~Vfs() {
+  delete[] mounts_;
+  delete[] mount_paths_;
+}
+
+NavaryRC Vfs::Init(std::uint32_t max_mounts) {
+  if (mounts_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument, "Vfs: already initialized");
+  }
+  if (max_mounts == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "Vfs: max_mounts must be > 0");
+  }
+
+  mounts_      = new (std::nothrow) PackArchive[max_mounts];
+  mount_paths_ = new (std::nothrow) std::string[max_mounts];
+  if (mounts_ == nullptr || mount_paths_ == nullptr) {
+    delete[] mounts_;
+    delete[] mount_paths_;
+    mounts_      = nullptr;
+    mount_paths_ = nullptr;
+    return NavaryRC(NavaryStatus::kOutOfMemory, "Vfs: mount table alloc");
+  }
+  max_mounts_  = max_mounts;
+  mount_count_ = 0;
+  return NavaryRC::OK();
+}
+
+NavaryResult<PackArchive*> Vfs::NextMount() {
+  if (mounts_ == nullptr) {
+    return NavaryResult<PackArchive*>(
+        NavaryRC(NavaryStatus::kInvalidArgument, "Vfs: not initialized"));
+  }
+  if (mount_count_ >= max_mounts_) {
+    return NavaryResult<PackArchive*>(
+        NavaryRC(NavaryStatus::kOutOfMemory, "Vfs: mount table full"));
+  }
+  return NavaryResult<PackArchive*>(&mounts_[mount_count_]);
+}
+
+NavaryResult<std::uint32_t> Vfs::MountPack(const char* path) {
+  NavaryResult<PackArchive*> slot_or = NextMount();
+  if (!slot_or.status().ok()) {
+    return NavaryResult<std::uint32_t>(slot_or.status());
+  }
+
+  NavaryRC rc = slot_or.value()->Open(path);
+  if (!rc.ok()) {
+    return NavaryResult<std::uint32_t>(rc);
+  }
+  mount_paths_[mount_count_].assign(path);
+  return NavaryResult<std::uint32_t>(mount_count_++);
+}
+
+NavaryResult<std::uint32_t> Vfs::MountPackFromMemory(
+    memory::Span<const std::uint8_t> bytes) {
+  NavaryResult<PackArchive*> slot_or = NextMount();
+  if (!slot_or.status().ok()) {
+    return NavaryResult<std::uint32_t>(slot_or.status());
+  }
+
+  NavaryRC rc = slot_or.value()->OpenFromMemory(bytes);
+  if (!rc.ok()) {
+    return NavaryResult<std::uint32_t>(rc);
+  }
+  return NavaryResult<std::uint32_t>(mount_count_++);
+}
+
+void Vfs::UnmountFrom(std::uint32_t mount_index) {
+  while (mount_count_ > mount_index) {
+    --mount_count_;
+    mounts_[mount_count_].Close();
+    mount_paths_[mount_count_].clear();
+  }
+}
+
+void Vfs::SetLooseRoot(std::string_view directory) {
+  loose_root_.assign(directory.data(), directory.size());
+  while (!loose_root_.empty() &&
+         (loose_root_.back() == '/' || loose_root_.back() == '\\')) {
+    loose_root_.pop_back();
+  }
+}
+
+void Vfs::ClearLooseRoot() {
+  loose_root_.clear();
+}
+
+bool Vfs::LoosePath(std::string_view path, std::string* out) const {
+  if (loose_root_.empty()) {
+    return false;
+  }
+
+  char buffer[kVfsMaxPath];
+  const std::size_t n = NormalizeVfsPath(path, buffer, sizeof(buffer));
+  if (n == 0) {
+    return false;
+  }
+
+  out->assign(loose_root_);
+  out->push_back('/');
+  out->append(buffer, n);
+  return true;
+}
+
+NavaryRC Vfs::Read(std::string_view path, VfsFile* out,
+                   core::scheduler::JobSystem* jobs) const {
+  if (out == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument, "Vfs: null out");
+  }
+  *out = VfsFile{};
+
+  std::string loose_path;
+  std::uint64_t loose_size = 0;
+  if (LoosePath(path, &loose_path) &&
+      PlatformFileSize(loose_path.c_str(), &loose_size)) {
+    NAVARY_RETURN_IF_ERROR(out->loose_.Open(loose_path.c_str()));
+    out->bytes_ = out->loose_.bytes();
+    loose_hits_.fetch_add(1, std::memory_order_relaxed);
+    return NavaryRC::OK();
+  }
+
+  for (std::uint32_t i = mount_count_; i > 0; --i) {
+    const PackTocEntry* entry = mounts_[i - 1].Find(path);
+    if (entry == nullptr) {
+      continue;
+    }
+    const memory::Span<const std::uint8_t> stored =
+        mounts_[i - 1].EntryData(*entry);
+    if (IsPackEntryCompressed(*entry)) {
+      out->decoded_.resize(static_cast<std::size_t>(entry->raw_size));
+      NAVARY_RETURN_IF_ERROR(DecodePackEntry(
+          *entry, stored,
+          memory::Span<std::uint8_t>(out->decoded_.data(),
+                                     out->decoded_.size()),
+          jobs));
+      out->bytes_ = memory::Span<const std::uint8_t>(out->decoded_.data(),
+                                                     out->decoded_.size());
+    } else {
+      out->bytes_ = stored;
+    }
+    pack_hits_.fetch_add(1, std::memory_order_relaxed);
+    return NavaryRC::OK();
+  }
+
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  return NavaryRC(NavaryStatus::kNotFound, "Vfs: file not found");
+}
+
+bool Vfs::Exists(std::string_view path) const {
+  std::string loose_path;
+  std::uint64_t loose_size = 0;
+  if (LoosePath(path, &loose_path) &&
+      PlatformFileSize(loose_path.c_str(), &loose_size)) {
+    return true;
+  }
+  for (std::uint32_t i = mount_count_; i > 0; --i) {
+    if (mounts_[i - 1].Find(path) != nullptr) {
+      return true;
+    }
+  }
+  return false;
+}
+
+NavaryRC Vfs::Locate(std::string_view path, VfsLocation* out) const {
+  if (out == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument, "Vfs: null out");
+  }
+
+  std::uint64_t loose_size = 0;
+  if (LoosePath(path, &out->file_path) &&
+      PlatformFileSize(out->file_path.c_str(), &loose_size)) {
+    out->offset     = 0;
+    out->size       = loose_size;
+    out->compressed = false;
+    out->entry      = PackTocEntry{};
+    return NavaryRC::OK();
+  }
+
+  for (std::uint32_t i = mount_count_; i > 0; --i) {
+    const PackTocEntry* entry = mounts_[i - 1].Find(path);
+    if (entry == nullptr) {
+      continue;
+    }
+    if (mount_paths_[i - 1].empty()) {
+      return NavaryRC(NavaryStatus::kNotFound,
+                      "Vfs: entry has no backing file");
+    }
+    out->file_path  = mount_paths_[i - 1];
+    out->offset     = entry->offset;
+    out->size       = entry->size;
+    out->compressed = IsPackEntryCompressed(*entry);
+    out->entry      = *entry;
+    return NavaryRC::OK();
+  }
+  return NavaryRC(NavaryStatus::kNotFound, "Vfs: file not found");
+}
+
+VfsStats Vfs::stats() const {
+  VfsStats s{};
+  s.loose_hits = loose_hits_.load(std::memory_order_relaxed);
+  s.pack_hits  = pack_hits_.load(std::memory_order_relaxed);
+  s.misses     = misses_.load(std::memory_order_relaxed);
+  return s;
+}
+
+}  // namespace navary::io
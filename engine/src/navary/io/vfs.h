@@ -0,0 +1,137 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/vfs.h
+// Purpose: Virtual file system over mounted pack archives with an optional
+//          loose-file overlay for development.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Resolution order: loose overlay (if set), then packs from the most
+// recently mounted to the first, so patch packs shadow base packs.
+// Reads are zero copy: pack reads point into the pack mapping, loose reads
+// map the file. Compressed pack entries are the exception: they decode
+// into memory owned by the VfsFile (in parallel when a JobSystem is
+// given). Read() is safe to call concurrently once mounting is done.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "navary/io/mapped_file.h"
+#include "navary/io/pack_archive.h"
+#include "navary/memory/span.h"
+#include "navary/navary_status.h"
+
+namespace navary::core::scheduler {
+class JobSystem;
+}  // namespace navary::core::scheduler
+
+namespace navary::io {
+
+// Result of a VFS read. Pack-backed bytes stay valid while the pack is
+// mounted; loose-backed and decoded bytes while this object lives.
+class VfsFile {
+ public:
+  VfsFile() = default;
+
+  VfsFile(const VfsFile&)            = delete;
+  VfsFile& operator=(const VfsFile&) = delete;
+  VfsFile(VfsFile&&)                 = default;
+  VfsFile& operator=(VfsFile&&)      = default;
+
+  memory::Span<const std::uint8_t> bytes() const {
+    return bytes_;
+  }
+  bool from_pack() const {
+    return !loose_.is_open();
+  }
+
+ private:
+  friend class Vfs;
+
+  memory::Span<const std::uint8_t> bytes_;
+  MappedFile loose_;
+  std::vector<std::uint8_t> decoded_;
+};
+
+// On-disk home of a file, for streaming it through AsyncIo into staging
+// memory instead of faulting in the pack mapping.
+struct VfsLocation {
+  std::string file_path;
+  std::uint64_t offset;
+  std::uint64_t size;  // stored bytes
+  // Set for block-compressed pack entries: read |size| stored bytes, then
+  // DecodePackEntry/DecodePackBlocks them with |entry|.
+  bool compressed;
+  PackTocEntry entry;
+};
+
+struct VfsStats {
+  std::uint64_t loose_hits;
+  std::uint64_t pack_hits;
+  std::uint64_t misses;
+};
+
+class Vfs {
+ public:
+  Vfs();
+  ~Vfs();
+
+  Vfs(const Vfs&)            = delete;
+  Vfs& operator=(const Vfs&) = delete;
+
+  NavaryRC Init(std::uint32_t max_mounts = 16);
+
+  // Mounts a pack file; returns its mount index.
+  NavaryResult<std::uint32_t> MountPack(const char* path);
+
+  // Mounts caller-owned pack bytes (must outlive the mount).
+  NavaryResult<std::uint32_t> MountPackFromMemory(
+      memory::Span<const std::uint8_t> bytes);
+
+  // Unmounts everything mounted at or after |mount_index|.
+  void UnmountFrom(std::uint32_t mount_index);
+
+  // Directory whose files shadow pack contents (development builds).
+  void SetLooseRoot(std::string_view directory);
+  void ClearLooseRoot();
+
+  NavaryRC Read(std::string_view path, VfsFile* out,
+                core::scheduler::JobSystem* jobs = nullptr) const;
+
+  bool Exists(std::string_view path) const;
+
+  // Resolves like Read() without touching file contents. kNotFound on a
+  // miss or when the hit is a pack mounted from memory.
+  NavaryRC Locate(std::string_view path, VfsLocation* out) const;
+
+  VfsStats stats() const;
+
+  std::uint32_t mount_count() const {
+    return mount_count_;
+  }
+  const PackArchive* mount(std::uint32_t index) const {
+    return index < mount_count_ ? &mounts_[index] : nullptr;
+  }
+
+ private:
+  // Builds "<root>/<normalized>"; false if there is no loose root.
+  bool LoosePath(std::string_view path, std::string* out) const;
+  NavaryResult<PackArchive*> NextMount();
+
+  PackArchive* mounts_;
+  std::string* mount_paths_;  // empty for memory mounts
+  std::uint32_t max_mounts_;
+  std::uint32_t mount_count_;
+  std::string loose_root_;
+
+  mutable std::atomic<std::uint64_t> loose_hits_;
+  mutable std::atomic<std::uint64_t> pack_hits_;
+  mutable std::atomic<std::uint64_t> misses_;
+};
+
+}  // namespace navary::io
@@ -0,0 +1,74 @@
+#pragma once
+// Navary Engine - IO Subsystem
+// File: navary/io/vfs_path.h
+// Purpose: VFS path normalization and hashing shared by packs and lookups.
+// Policy: C++20, Google style, no exceptions, no RTTI, header-only.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace navary::io {
+
+inline constexpr std::size_t kVfsMaxPath = 512;
+
+// Normalized form: '/' separators, no leading "/" or "./", no empty
+// segments. Case is preserved. Returns the length written to |out|
+// (not terminated), or 0 if |path| is empty, does not fit or contains a
+// ".." segment (paths may never climb out of a pack or the loose root).
+inline std::size_t NormalizeVfsPath(std::string_view path, char* out,
+                                    std::size_t capacity) {
+  std::size_t n = 0;
+  std::size_t i = 0;
+  while (i < path.size()) {
+    const char c = path[i] == '\\' ? '/' : path[i];
+    if (c == '/') {
+      if (n > 0 && out[n - 1] != '/') {
+        if (n >= capacity) {
+          return 0;
+        }
+        out[n++] = '/';
+      }
+      ++i;
+      continue;
+    }
+    // Drop "./" segments, reject "../" ones.
+    const bool segment_start = n == 0 || out[n - 1] == '/';
+    if (segment_start && c == '.') {
+      const auto ends_at = [&](std::size_t j) {
+        return j == path.size() || path[j] == '/' || path[j] == '\\';
+      };
+      if (ends_at(i + 1)) {
+        ++i;
+        continue;
+      }
+      if (path[i + 1] == '.' && ends_at(i + 2)) {
+        return 0;
+      }
+    }
+    if (n >= capacity) {
+      return 0;
+    }
+    out[n++] = c;
+    ++i;
+  }
+  while (n > 0 && out[n - 1] == '/') {
+    --n;
+  }
+  return n;
+}
+
+// FNV-1a 64 over an already normalized path.
+inline constexpr std::uint64_t HashVfsPath(std::string_view normalized) {
+  std::uint64_t h = 1469598103934665603ull;
+  for (char c : normalized) {
+    h ^= static_cast<std::uint8_t>(c);
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+}  // namespace navary::io
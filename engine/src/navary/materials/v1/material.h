@@ -23,6 +23,7 @@ struct Material {
   MaterialClass material_class;
   AlphaMode alpha_mode;
 
+  GraphId graph_id;  // .navgraph the shader was generated from
   ShaderKey shader_key;
   PipelineHandle pipeline;
 
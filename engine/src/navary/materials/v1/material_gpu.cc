@@ -11,7 +11,8 @@ namespace navary::materials::v1 {
 NavaryRC AllocateAndWriteMaterialDescriptor(const Material& material,
                                             MaterialGpuContext* ctx,
                                             DescriptorHandle* out_set1) {
-  if (ctx == nullptr || out_set1 == nullptr) {
+  if (ctx == nullptr || ctx->material_params == nullptr ||
+      out_set1 == nullptr) {
     return NavaryRC(NavaryStatus::kInvalidArgument,
                     "AllocateAndWriteMaterialDescriptor: null arg");
   }
@@ -24,22 +25,11 @@ NavaryRC AllocateAndWriteMaterialDescriptor(const Material& material,
 
   DescriptorHandle set1 = set_or.value();
 
-  MaterialUbo ubo{};
-  for (int i = 0; i < 4; ++i) {
-    ubo.base_color[i] = material.params.base_color[i];
-    ubo.params0[i]    = material.params.params0[i];
-    ubo.params1[i]    = material.params.params1[i];
-    ubo.user0[i]      = 0.0f;
-    ubo.user1[i]      = 0.0f;
-  }
-
-  NavaryResult<renderv1::BufferSlice> slice_or =
-      ctx->material_ubo_ring->AllocateAndWrite(&ubo, sizeof(MaterialUbo));
-  if (!slice_or.status().ok()) {
-    return slice_or.status();
-  }
+  NAVARY_RETURN_IF_ERROR(ctx->material_params->Write(
+      material.handle, MakeMaterialUbo(material.params)));
 
-  renderv1::BufferSlice slice = slice_or.value();
+  const renderv1::BufferSlice slice =
+      ctx->material_params->Slot(material.handle);
 
   // Bind textures in fixed layout 0..7
   auto write_tex = [&](std::uint32_t binding, TextureHandle tex) -> NavaryRC {
@@ -63,4 +53,17 @@ NavaryRC AllocateAndWriteMaterialDescriptor(const Material& material,
   return NavaryRC::OK();
 }
 
+NavaryRC UpdateMaterialParams(Material* material, const MaterialParams& params,
+                              MaterialGpuContext* ctx) {
+  if (material == nullptr || ctx == nullptr ||
+      ctx->material_params == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "UpdateMaterialParams: null arg");
+  }
+
+  material->params = params;
+  return ctx->material_params->Write(material->handle,
+                                     MakeMaterialUbo(params));
+}
+
 }  // namespace navary::materials::v1
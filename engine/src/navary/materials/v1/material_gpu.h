@@ -7,9 +7,9 @@
 
 #include "navary/navary_status.h"
 #include "navary/materials/v1/material.h"
+#include "navary/materials/v1/material_param_buffer.h"
 #include "navary/materials/v1/material_ubo.h"
 #include "navary/render/v1/descriptor_allocator.h"
-#include "navary/render/v1/gpu_ring_buffer.h"
 
 namespace navary::materials::v1 {
 
@@ -18,12 +18,18 @@ namespace renderv1 = navary::render::v1;
 struct MaterialGpuContext {
   renderv1::DescriptorAllocator* descriptor_allocator;
   DescriptorSetLayoutHandle material_set_layout;  // set=1
-  renderv1::GpuRingBuffer* material_ubo_ring;
+  MaterialParamBuffer* material_params;  // persistent MaterialUbo slots
 };
 
+// Stores the material's UBO in its persistent slot (uploaded on the next
+// MaterialParamBuffer::Flush) and binds that slot at binding 8.
 NavaryRC AllocateAndWriteMaterialDescriptor(const Material& material,
                                           MaterialGpuContext* ctx,
                                           DescriptorHandle* out_set1);
 
+// Edits parameters of a live material; only its slot is re-uploaded.
+NavaryRC UpdateMaterialParams(Material* material, const MaterialParams& params,
+                              MaterialGpuContext* ctx);
+
 }  // namespace navary
 
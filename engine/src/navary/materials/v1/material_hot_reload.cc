@@ -0,0 +1,298 @@
+// navary/materials/v1/material_hot_reload.cc
+// Implementation of MaterialHotReload: background graph recompiles and
+// frame-boundary material swaps.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include "navary/materials/v1/material_hot_reload.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>  // std::nothrow
+#include <vector>
+
+#include "navary/core/time/profiler_time.h"
+#include "navary/graph/shader/graph_compiler.h"
+#include "navary/graph/shader/graph_ir.h"
+#include "navary/graph/shader/navgraph_loader.h"
+
+namespace navary::materials::v1 {
+
+namespace {
+
+namespace gs = navary::graph::shader;
+
+// Reads the whole file with plain stdio. Not mapped: the editor may
+// truncate and rewrite the file while we read, which a mapping would turn
+// into SIGBUS instead of a failed parse.
+bool ReadWholeFile(const char* path, std::vector<std::uint8_t>* out) {
+  std::FILE* f = std::fopen(path, "rb");
+  if (f == nullptr) {
+    return false;
+  }
+  out->clear();
+  std::uint8_t chunk[16 * 1024];
+  std::size_t n = 0;
+  while ((n = std::fread(chunk, 1, sizeof(chunk), f)) > 0) {
+    out->insert(out->end(), chunk, chunk + n);
+  }
+  const bool ok = std::ferror(f) == 0;
+  std::fclose(f);
+  return ok;
+}
+
+}  // namespace
+
+MaterialHotReload::MaterialHotReload()
+    : registry_(nullptr),
+      jobs_(nullptr),
+      events_(nullptr),
+      slots_(nullptr),
+      slot_count_(0),
+      max_graphs_(0),
+      rebuild_(nullptr),
+      user_data_(nullptr),
+      stats_{} {}
+
+MaterialHotReload::~MaterialHotReload() {
+  Shutdown();
+}
+
+NavaryRC MaterialHotReload::Init(const MaterialHotReloadDesc& desc,
+                                 MaterialRegistry* registry,
+                                 core::scheduler::JobSystem* jobs) {
+  if (slots_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MaterialHotReload: already initialized");
+  }
+  if (registry == nullptr || desc.max_graphs == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MaterialHotReload: bad init arguments");
+  }
+
+  io::FileWatcherDesc watcher_desc = desc.watcher;
+  watcher_desc.max_watches         = desc.max_graphs;
+  NAVARY_RETURN_IF_ERROR(watcher_.Init(watcher_desc));
+
+  slots_  = new (std::nothrow) GraphSlot[desc.max_graphs];
+  events_ = static_cast<io::FileWatchEvent*>(
+      std::malloc(sizeof(io::FileWatchEvent) * desc.max_graphs));
+  if (slots_ == nullptr || events_ == nullptr) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "MaterialHotReload: storage alloc failed");
+  }
+
+  registry_   = registry;
+  jobs_       = jobs;
+  slot_count_ = 0;
+  max_graphs_ = desc.max_graphs;
+  rebuild_    = desc.rebuild;
+  user_data_  = desc.user_data;
+  stats_      = MaterialHotReloadStats{};
+  return NavaryRC::OK();
+}
+
+void MaterialHotReload::Shutdown() {
+  WaitIdle();
+  watcher_.Shutdown();
+
+  delete[] slots_;
+  std::free(events_);
+  slots_      = nullptr;
+  events_     = nullptr;
+  slot_count_ = 0;
+  max_graphs_ = 0;
+  registry_   = nullptr;
+}
+
+NavaryRC MaterialHotReload::WatchGraph(GraphId graph, const char* path,
+                                       ShaderHash current_hash) {
+  if (slots_ == nullptr || path == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MaterialHotReload: not initialized");
+  }
+  if (FindSlot(graph) != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MaterialHotReload: graph already watched");
+  }
+  if (slot_count_ == max_graphs_) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "MaterialHotReload: max_graphs reached");
+  }
+
+  const NavaryResult<std::uint32_t> watch =
+      watcher_.Watch(path, slot_count_);
+  if (!watch.status().ok()) {
+    return watch.status();
+  }
+
+  GraphSlot& slot   = slots_[slot_count_++];
+  slot.graph        = graph;
+  slot.path         = path;
+  slot.watch        = watch.value();
+  slot.applied_hash = current_hash;
+  slot.state.store(CompileState::kIdle, std::memory_order_relaxed);
+  slot.requeue = false;
+  return NavaryRC::OK();
+}
+
+NavaryRC MaterialHotReload::RequestReload(GraphId graph) {
+  GraphSlot* slot = FindSlot(graph);
+  if (slot == nullptr) {
+    return NavaryRC(NavaryStatus::kNotFound,
+                    "MaterialHotReload: graph not watched");
+  }
+  Kick(slot);
+  return NavaryRC::OK();
+}
+
+void MaterialHotReload::Update() {
+  UpdateAt(core::time::ProfilerNowTicks());
+}
+
+void MaterialHotReload::UpdateAt(std::uint64_t now_ticks) {
+  if (slots_ == nullptr) {
+    return;
+  }
+  const std::uint32_t count =
+      watcher_.PollAt(now_ticks, events_, max_graphs_);
+  for (std::uint32_t i = 0; i < count; ++i) {
+    Kick(&slots_[events_[i].user_tag]);
+  }
+}
+
+std::uint32_t MaterialHotReload::ApplyAtFrameBoundary() {
+  std::uint32_t rebuilt = 0;
+  for (std::uint32_t i = 0; i < slot_count_; ++i) {
+    GraphSlot& slot         = slots_[i];
+    const CompileState done = slot.state.load(std::memory_order_acquire);
+    if (done == CompileState::kIdle || done == CompileState::kRunning) {
+      continue;
+    }
+
+    ++stats_.compiles;
+    if (done == CompileState::kFailed) {
+      // Keep the last good shader; the next save retries.
+      ++stats_.failed;
+    } else if (slot.compiled_hash.value == slot.applied_hash.value) {
+      ++stats_.unchanged;
+    } else {
+      const std::uint32_t capacity = registry_->capacity();
+      for (std::uint32_t m = 0; m < capacity; ++m) {
+        const MaterialHandle handle{m};
+        if (!registry_->IsAlive(handle)) {
+          continue;
+        }
+        Material* material = registry_->GetMaterial(handle);
+        if (material->graph_id.index != slot.graph.index ||
+            material->shader_key.graph_hash.value ==
+                slot.compiled_hash.value) {
+          continue;
+        }
+        material->shader_key.graph_hash = slot.compiled_hash;
+        material->pipeline              = PipelineHandle{};
+        if (rebuild_ != nullptr) {
+          rebuild_(material, slot.glsl, user_data_);
+        }
+        ++rebuilt;
+      }
+      slot.applied_hash = slot.compiled_hash;
+    }
+
+    slot.glsl.clear();
+    slot.state.store(CompileState::kIdle, std::memory_order_relaxed);
+    if (slot.requeue) {
+      slot.requeue = false;
+      Kick(&slot);
+    }
+  }
+
+  stats_.materials_rebuilt += rebuilt;
+  return rebuilt;
+}
+
+void MaterialHotReload::WaitIdle() {
+  if (jobs_ != nullptr) {
+    jobs_->Wait(&counter_);
+  }
+}
+
+ShaderHash MaterialHotReload::graph_hash(GraphId graph) const {
+  const GraphSlot* slot = FindSlot(graph);
+  return slot != nullptr ? slot->applied_hash : ShaderHash{0};
+}
+
+bool MaterialHotReload::busy() const {
+  for (std::uint32_t i = 0; i < slot_count_; ++i) {
+    if (slots_[i].requeue || slots_[i].state.load(std::memory_order_acquire) !=
+                                 CompileState::kIdle) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void MaterialHotReload::CompileJob(void* user_data) {
+  auto* slot = static_cast<GraphSlot*>(user_data);
+
+  std::vector<std::uint8_t> bytes;
+  gs::GraphIr ir{};
+  gs::NavGraphLoader loader;
+  if (!ReadWholeFile(slot->path.c_str(), &bytes) ||
+      !loader
+           .LoadFromSpan(memory::Span<const std::uint8_t>(bytes.data(),
+                                                          bytes.size()),
+                         &ir)
+           .ok()) {
+    slot->state.store(CompileState::kFailed, std::memory_order_release);
+    return;
+  }
+
+  const gs::GraphCompiler compiler;
+  NavaryResult<std::string> glsl = compiler.GenerateUserSurfaceGlSl(ir);
+  gs::NavGraphLoader::Release(&ir);
+  if (!glsl.status().ok()) {
+    slot->state.store(CompileState::kFailed, std::memory_order_release);
+    return;
+  }
+
+  slot->glsl          = std::move(glsl.value());
+  slot->compiled_hash = gs::HashUserSurfaceGlsl(slot->glsl);
+  slot->state.store(CompileState::kSucceeded, std::memory_order_release);
+}
+
+MaterialHotReload::GraphSlot* MaterialHotReload::FindSlot(GraphId graph) {
+  for (std::uint32_t i = 0; i < slot_count_; ++i) {
+    if (slots_[i].graph.index == graph.index) {
+      return &slots_[i];
+    }
+  }
+  return nullptr;
+}
+
+const MaterialHotReload::GraphSlot* MaterialHotReload::FindSlot(
+    GraphId graph) const {
+  for (std::uint32_t i = 0; i < slot_count_; ++i) {
+    if (slots_[i].graph.index == graph.index) {
+      return &slots_[i];
+    }
+  }
+  return nullptr;
+}
+
+void MaterialHotReload::Kick(GraphSlot* slot) {
+  if (slot->state.load(std::memory_order_acquire) != CompileState::kIdle) {
+    // Running, or finished but not applied yet: compile again afterwards.
+    slot->requeue = true;
+    return;
+  }
+  slot->state.store(CompileState::kRunning, std::memory_order_relaxed);
+  if (jobs_ != nullptr) {
+    jobs_->Submit(&CompileJob, slot, &counter_);
+  } else {
+    CompileJob(slot);
+  }
+}
+
+}  // namespace navary::materials::v1
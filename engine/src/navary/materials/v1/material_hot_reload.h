@@ -0,0 +1,144 @@
+#pragma once
+
+// navary/materials/v1/material_hot_reload.h
+// Defines MaterialHotReload, which recompiles edited .navgraph assets in
+// the background and swaps affected materials at a frame boundary.
+// Used by editor and development builds.
+//
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "navary/navary_status.h"
+#include "navary/core/scheduler/job_system.h"
+#include "navary/io/file_watcher.h"
+#include "navary/materials/v1/material.h"
+#include "navary/materials/v1/material_registry.h"
+#include "navary/materials/v1/material_types.h"
+
+namespace navary::materials::v1 {
+
+// Called at the frame boundary for each material whose graph_hash changed,
+// after its shader_key was updated and pipeline reset. Typically builds the
+// pipeline for material->shader_key from |glsl|.
+using MaterialRebuildFn = void (*)(Material* material, const std::string& glsl,
+                                   void* user_data);
+
+struct MaterialHotReloadDesc {
+  std::uint32_t max_graphs = 256;
+  io::FileWatcherDesc watcher;
+  MaterialRebuildFn rebuild = nullptr;  // optional
+  void* user_data           = nullptr;
+};
+
+struct MaterialHotReloadStats {
+  std::uint64_t compiles;           // background loads + compiles finished
+  std::uint64_t failed;             // load or compile errors
+  std::uint64_t unchanged;          // compiled to the same graph_hash
+  std::uint64_t materials_rebuilt;  // MaterialRebuildFn calls
+};
+
+// Hot reload for shader graphs.
+// Update() polls the file watcher and queues a NavGraphLoader +
+// GraphCompiler job for every graph whose file settled. Jobs never touch
+// materials; ApplyAtFrameBoundary() publishes finished results on the
+// owner thread, so the renderer never sees a half-updated material set.
+// Only materials whose graph_hash actually changed are rebuilt.
+class MaterialHotReload {
+ public:
+  MaterialHotReload();
+  ~MaterialHotReload();
+
+  MaterialHotReload(const MaterialHotReload&)            = delete;
+  MaterialHotReload& operator=(const MaterialHotReload&) = delete;
+
+  NavaryRC Init(const MaterialHotReloadDesc& desc, MaterialRegistry* registry,
+                core::scheduler::JobSystem* jobs);
+
+  // Waits for running compiles and releases everything.
+  void Shutdown();
+
+  // Watches |path| as the source of |graph|. |current_hash| is the
+  // graph_hash materials were created with (0 if unknown).
+  NavaryRC WatchGraph(GraphId graph, const char* path,
+                      ShaderHash current_hash);
+
+  // Queues a recompile of |graph| without waiting for a file change.
+  NavaryRC RequestReload(GraphId graph);
+
+  // Polls file changes and kicks background compiles. Call once per frame.
+  void Update();
+
+  // Same as Update() with an explicit profiler-tick clock.
+  void UpdateAt(std::uint64_t now_ticks);
+
+  // Publishes finished compiles to materials. Call where no command
+  // recording reads materials (between frames). Returns materials rebuilt.
+  std::uint32_t ApplyAtFrameBoundary();
+
+  // Blocks until no compile is running (tests, shutdown).
+  void WaitIdle();
+
+  // Last graph_hash applied for |graph|, 0 if unknown.
+  ShaderHash graph_hash(GraphId graph) const;
+
+  // True while any compile is queued or running.
+  bool busy() const;
+
+  io::FileWatcher& watcher() {
+    return watcher_;
+  }
+
+  MaterialHotReloadStats stats() const {
+    return stats_;
+  }
+
+ private:
+  enum class CompileState : std::uint8_t {
+    kIdle      = 0,
+    kRunning   = 1,
+    kSucceeded = 2,
+    kFailed    = 3,
+  };
+
+  struct GraphSlot {
+    GraphId graph;
+    std::string path;
+    std::uint32_t watch;
+    ShaderHash applied_hash;
+
+    // Written by the compile job, read once state leaves kRunning.
+    std::atomic<CompileState> state;
+    ShaderHash compiled_hash;
+    std::string glsl;
+
+    bool requeue;  // file changed again while compiling
+  };
+
+  static void CompileJob(void* user_data);
+
+  GraphSlot* FindSlot(GraphId graph);
+  const GraphSlot* FindSlot(GraphId graph) const;
+  void Kick(GraphSlot* slot);
+
+  MaterialRegistry* registry_;
+  core::scheduler::JobSystem* jobs_;
+  core::scheduler::JobCounter counter_;
+
+  io::FileWatcher watcher_;
+  io::FileWatchEvent* events_;
+
+  GraphSlot* slots_;
+  std::uint32_t slot_count_;
+  std::uint32_t max_graphs_;
+
+  MaterialRebuildFn rebuild_;
+  void* user_data_;
+
+  MaterialHotReloadStats stats_;
+};
+
+}  // namespace navary::materials::v1
@@ -0,0 +1,215 @@
+// navary/materials/v1/material_param_buffer.cc
+// Implementation of MaterialParamBuffer.
+// This file is part of the Navary engine.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include "navary/materials/v1/material_param_buffer.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace navary::materials::v1 {
+
+namespace {
+
+// Longest dirty run merged into one copy; bounds a single staging request.
+constexpr std::uint32_t kMaxRunSlots = 64;
+
+}  // namespace
+
+MaterialUbo MakeMaterialUbo(const MaterialParams& params) {
+  MaterialUbo ubo{};
+  for (int i = 0; i < 4; ++i) {
+    ubo.base_color[i] = params.base_color[i];
+    ubo.params0[i]    = params.params0[i];
+    ubo.params1[i]    = params.params1[i];
+    ubo.user0[i]      = 0.0f;
+    ubo.user1[i]      = 0.0f;
+  }
+  return ubo;
+}
+
+MaterialParamBuffer::MaterialParamBuffer()
+    : buffer_{0},
+      shadow_(nullptr),
+      dirty_bits_(nullptr),
+      written_bits_(nullptr),
+      dirty_words_(0),
+      dirty_count_(0),
+      capacity_(0),
+      stride_(0) {}
+
+MaterialParamBuffer::~MaterialParamBuffer() {
+  std::free(shadow_);
+  std::free(dirty_bits_);
+  std::free(written_bits_);
+}
+
+NavaryRC MaterialParamBuffer::Init(std::uint32_t max_materials,
+                                   core::BufferHandle buffer,
+                                   std::size_t offset_alignment) {
+  if (max_materials == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MaterialParamBuffer: max_materials must be > 0");
+  }
+  if (offset_alignment == 0 ||
+      (offset_alignment & (offset_alignment - 1)) != 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MaterialParamBuffer: alignment must be a power of two");
+  }
+
+  std::free(shadow_);
+  std::free(dirty_bits_);
+  std::free(written_bits_);
+
+  stride_ = (sizeof(MaterialUbo) + offset_alignment - 1) &
+            ~(offset_alignment - 1);
+  dirty_words_ = (max_materials + 63) / 64;
+
+  shadow_ = static_cast<std::uint8_t*>(std::calloc(max_materials, stride_));
+  dirty_bits_ = static_cast<std::uint64_t*>(
+      std::calloc(dirty_words_, sizeof(std::uint64_t)));
+  written_bits_ = static_cast<std::uint64_t*>(
+      std::calloc(dirty_words_, sizeof(std::uint64_t)));
+  if (shadow_ == nullptr || dirty_bits_ == nullptr ||
+      written_bits_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "MaterialParamBuffer: allocation failed");
+  }
+
+  buffer_      = buffer;
+  capacity_    = max_materials;
+  dirty_count_ = 0;
+  return NavaryRC::OK();
+}
+
+void MaterialParamBuffer::SetDirty(std::uint32_t index) {
+  std::uint64_t& word     = dirty_bits_[index >> 6];
+  const std::uint64_t bit = 1ull << (index & 63u);
+  if ((word & bit) == 0) {
+    word |= bit;
+    ++dirty_count_;
+  }
+}
+
+NavaryRC MaterialParamBuffer::Write(MaterialHandle handle,
+                                    const MaterialUbo& ubo) {
+  if (handle.index >= capacity_) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MaterialParamBuffer: handle out of range");
+  }
+
+  // The first write of a slot always uploads; the GPU copy is undefined.
+  std::uint64_t& written  = written_bits_[handle.index >> 6];
+  const std::uint64_t bit = 1ull << (handle.index & 63u);
+  std::uint8_t* slot      = shadow_ + handle.index * stride_;
+  if ((written & bit) == 0 ||
+      std::memcmp(slot, &ubo, sizeof(MaterialUbo)) != 0) {
+    std::memcpy(slot, &ubo, sizeof(MaterialUbo));
+    written |= bit;
+    SetDirty(handle.index);
+  }
+  return NavaryRC::OK();
+}
+
+void MaterialParamBuffer::Release(MaterialHandle handle) {
+  if (handle.index >= capacity_) {
+    return;
+  }
+  const std::uint64_t bit = 1ull << (handle.index & 63u);
+  written_bits_[handle.index >> 6] &= ~bit;
+  if (dirty_bits_[handle.index >> 6] & bit) {
+    dirty_bits_[handle.index >> 6] &= ~bit;
+    --dirty_count_;
+  }
+}
+
+void MaterialParamBuffer::MarkDirty(MaterialHandle handle) {
+  if (handle.index < capacity_) {
+    SetDirty(handle.index);
+  }
+}
+
+void MaterialParamBuffer::MarkAllDirty() {
+  for (std::uint32_t i = 0; i < capacity_; ++i) {
+    SetDirty(i);
+  }
+}
+
+bool MaterialParamBuffer::IsDirty(MaterialHandle handle) const {
+  if (handle.index >= capacity_) {
+    return false;
+  }
+  return (dirty_bits_[handle.index >> 6] >> (handle.index & 63u)) & 1u;
+}
+
+NavaryRC MaterialParamBuffer::Flush(renderv1::UploadManager* uploads,
+                                    MaterialParamFlushStats* stats) {
+  if (uploads == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MaterialParamBuffer: null upload manager");
+  }
+
+  MaterialParamFlushStats local{};
+
+  std::uint32_t i = 0;
+  while (i < capacity_ && dirty_count_ > 0) {
+    const std::uint64_t word = dirty_bits_[i >> 6];
+    if (word == 0) {
+      i = (i | 63u) + 1;  // skip a clean word
+      continue;
+    }
+    if (((word >> (i & 63u)) & 1u) == 0) {
+      ++i;
+      continue;
+    }
+
+    // Upload a run of adjacent dirty slots as one copy (padding included).
+    const std::uint32_t begin = i;
+    while (i < capacity_ && i - begin < kMaxRunSlots &&
+           ((dirty_bits_[i >> 6] >> (i & 63u)) & 1u)) {
+      ++i;
+    }
+    const std::uint32_t run = i - begin;
+    const std::size_t size  = (run - 1) * stride_ + sizeof(MaterialUbo);
+
+    NavaryResult<renderv1::UploadTicket> ticket_or = uploads->UploadBuffer(
+        buffer_, begin * stride_, shadow_ + begin * stride_, size);
+    if (!ticket_or.status().ok()) {
+      if (ticket_or.status().code() != NavaryStatus::kOutOfMemory) {
+        return ticket_or.status();
+      }
+      break;  // over budget: the rest stays dirty for next frame
+    }
+
+    for (std::uint32_t s = begin; s < i; ++s) {
+      dirty_bits_[s >> 6] &= ~(1ull << (s & 63u));
+    }
+    dirty_count_ -= run;
+    local.slots_uploaded += run;
+    local.bytes += size;
+    ++local.copies;
+  }
+
+  local.slots_deferred = dirty_count_;
+  if (stats != nullptr) {
+    *stats = local;
+  }
+  return NavaryRC::OK();
+}
+
+renderv1::BufferSlice MaterialParamBuffer::Slot(MaterialHandle handle) const {
+  return renderv1::BufferSlice{buffer_, handle.index * stride_,
+                               sizeof(MaterialUbo)};
+}
+
+const MaterialUbo* MaterialParamBuffer::Get(MaterialHandle handle) const {
+  if (handle.index >= capacity_) {
+    return nullptr;
+  }
+  return reinterpret_cast<const MaterialUbo*>(shadow_ +
+                                              handle.index * stride_);
+}
+
+}  // namespace navary::materials::v1
@@ -0,0 +1,91 @@
+#pragma once
+
+// navary/materials/v1/material_param_buffer.h
+// Persistent GPU buffer of MaterialUbo slots, one per MaterialHandle.
+// Parameter edits update a CPU shadow and set a dirty bit; Flush() uploads
+// only the changed slots through the UploadManager, so per-frame material
+// bandwidth is proportional to the number of edits, not materials.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstddef>
+#include <cstdint>
+
+#include "navary/navary_status.h"
+#include "navary/materials/v1/material_types.h"
+#include "navary/materials/v1/material_ubo.h"
+#include "navary/render/v1/gpu_ring_buffer.h"
+#include "navary/render/v1/upload_manager.h"
+
+namespace navary::materials::v1 {
+
+namespace renderv1 = navary::render::v1;
+
+struct MaterialParamFlushStats {
+  std::uint32_t slots_uploaded;
+  std::uint32_t copies;          // contiguous dirty runs
+  std::uint32_t slots_deferred;  // left dirty (budget / staging full)
+  std::size_t bytes;
+};
+
+MaterialUbo MakeMaterialUbo(const MaterialParams& params);
+
+class MaterialParamBuffer {
+ public:
+  MaterialParamBuffer();
+  ~MaterialParamBuffer();
+
+  MaterialParamBuffer(const MaterialParamBuffer&)            = delete;
+  MaterialParamBuffer& operator=(const MaterialParamBuffer&) = delete;
+
+  // |buffer| is a device-local uniform buffer of at least
+  // max_materials * slot_stride() bytes. |offset_alignment| is
+  // minUniformBufferOffsetAlignment.
+  NavaryRC Init(std::uint32_t max_materials, core::BufferHandle buffer,
+                std::size_t offset_alignment);
+
+  // Stores |ubo| for |handle| and marks it dirty if it changed.
+  NavaryRC Write(MaterialHandle handle, const MaterialUbo& ubo);
+
+  // Forgets |handle|'s slot (material destroyed); the next Write() uploads.
+  void Release(MaterialHandle handle);
+
+  // Forces a re-upload (e.g. after the GPU buffer was recreated).
+  void MarkDirty(MaterialHandle handle);
+  void MarkAllDirty();
+
+  // Uploads dirty slots; slots the upload manager refuses stay dirty and
+  // are retried on the next call.
+  NavaryRC Flush(renderv1::UploadManager* uploads,
+                 MaterialParamFlushStats* stats = nullptr);
+
+  // Stable binding range of |handle|'s MaterialUbo.
+  renderv1::BufferSlice Slot(MaterialHandle handle) const;
+
+  const MaterialUbo* Get(MaterialHandle handle) const;
+
+  bool IsDirty(MaterialHandle handle) const;
+  std::uint32_t dirty_count() const {
+    return dirty_count_;
+  }
+  std::size_t slot_stride() const {
+    return stride_;
+  }
+  std::uint32_t capacity() const {
+    return capacity_;
+  }
+
+ private:
+  void SetDirty(std::uint32_t index);
+
+  core::BufferHandle buffer_;
+  std::uint8_t* shadow_;  // capacity_ * stride_, same layout as the GPU
+  std::uint64_t* dirty_bits_;
+  std::uint64_t* written_bits_;
+  std::uint32_t dirty_words_;
+  std::uint32_t dirty_count_;
+  std::uint32_t capacity_;
+  std::size_t stride_;
+};
+
+}  // namespace navary::materials::v1
@@ -13,6 +13,7 @@ namespace navary::materials::v1 {
 
 MaterialRegistry::MaterialRegistry()
     : materials_(nullptr),
+      alive_(nullptr),
       capacity_(0),
       alive_count_(0),
       free_indices_(nullptr),
@@ -20,6 +21,7 @@ MaterialRegistry::MaterialRegistry()
 
 MaterialRegistry::~MaterialRegistry() {
   std::free(materials_);
+  std::free(alive_);
   std::free(free_indices_);
 }
 
@@ -35,6 +37,12 @@ NavaryRC MaterialRegistry::Init(std::uint32_t max_materials) {
 
   std::memset(materials_, 0, sizeof(Material) * capacity_);
 
+  alive_ = static_cast<std::uint8_t*>(std::calloc(capacity_, 1));
+  if (alive_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "MaterialRegistry: alive alloc failed");
+  }
+
   free_indices_ = static_cast<std::uint32_t*>(
       std::malloc(sizeof(std::uint32_t) * capacity_));
   if (free_indices_ == nullptr) {
@@ -64,6 +72,7 @@ NavaryResult<MaterialHandle> MaterialRegistry::CreateMaterial(
   *m                        = Material{};  // zero-init
 
   m->handle             = MaterialHandle{index};
+  m->graph_id           = desc.graph_id;
   m->surface_model      = desc.surface_model;
   m->material_class     = desc.material_class;
   m->alpha_mode         = desc.alpha_mode;
@@ -83,6 +92,7 @@ NavaryResult<MaterialHandle> MaterialRegistry::CreateMaterial(
   m->shader_key.vertex_skin     = desc.vertex_skin;
   m->shader_key.graph_hash      = desc.graph_hash;
 
+  alive_[index] = 1;
   ++alive_count_;
   
   return NavaryResult<MaterialHandle>(m->handle);
@@ -105,12 +115,17 @@ const Material* MaterialRegistry::GetMaterial(MaterialHandle handle) const {
 }
 
 void MaterialRegistry::DestroyMaterial(MaterialHandle handle) {
-  if (handle.index >= capacity_) {
+  if (!IsAlive(handle)) {
     return;
   }
 
+  alive_[handle.index]       = 0;
   free_indices_[free_top_++] = handle.index;
   --alive_count_;
 }
 
+bool MaterialRegistry::IsAlive(MaterialHandle handle) const {
+  return handle.index < capacity_ && alive_[handle.index] != 0;
+}
+
 }  // namespace navary::materials::v1
\ No newline at end of file
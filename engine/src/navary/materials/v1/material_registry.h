@@ -32,8 +32,17 @@ class MaterialRegistry {
 
   void DestroyMaterial(MaterialHandle handle);
 
+  // False for free slots; GetMaterial() alone does not tell them apart.
+  bool IsAlive(MaterialHandle handle) const;
+
+  // Slots are indexed [0, capacity()); iterate with IsAlive().
+  std::uint32_t capacity() const {
+    return capacity_;
+  }
+
  private:
   Material* materials_;
+  std::uint8_t* alive_;
   std::uint32_t capacity_;
   std::uint32_t alive_count_;
   std::uint32_t* free_indices_;
@@ -0,0 +1,357 @@
+// navary/math/simd4.h
+
+/**
+ * @file simd4.h
+ * @brief Minimal 4-lane float / int32 SIMD wrapper for SoA kernels.
+ *
+ * Notes:
+ *  - SSE2 on x86-64 (always present), NEON on ARM (arm64 and armv7 with
+ *    NEON, i.e. every mobile target), plain arrays elsewhere. Define
+ *    NAVARY_SIMD_SCALAR=1 to force the scalar path.
+ *  - Only what the particle and audio kernels need: load / store, lane
+ *    arithmetic, min / max, compares producing masks, select, float <->
+ *    int conversion and a few int ops for packing.
+ *  - Loads and stores are unaligned; on current cores the aligned forms
+ *    are no faster when the address happens to be aligned.
+ *  - Masks are all-ones / all-zero lanes (same as the hardware compares).
+ *
+ * ```cpp
+ * using namespace navary::math::simd4;
+ * for (std::uint32_t i = 0; i + 4 <= n; i += 4) {
+ *   const F4 v = Load(vx + i);
+ *   Store(px + i, MulAdd(v, Splat(dt), Load(px + i)));
+ * }
+ * ```
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#ifndef NAVARY_SIMD_SCALAR
+#define NAVARY_SIMD_SCALAR 0
+#endif
+
+#if !NAVARY_SIMD_SCALAR && (defined(__SSE2__) || defined(_M_X64) || \
+                            (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define NAVARY_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif !NAVARY_SIMD_SCALAR && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define NAVARY_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace navary::math::simd4 {
+
+#if defined(NAVARY_SIMD_SSE2)
+
+using F4 = __m128;
+using I4 = __m128i;
+
+inline F4 Load(const float* p) {
+  return _mm_loadu_ps(p);
+}
+inline void Store(float* p, F4 v) {
+  _mm_storeu_ps(p, v);
+}
+inline F4 Splat(float s) {
+  return _mm_set1_ps(s);
+}
+inline F4 Add(F4 a, F4 b) {
+  return _mm_add_ps(a, b);
+}
+inline F4 Sub(F4 a, F4 b) {
+  return _mm_sub_ps(a, b);
+}
+inline F4 Mul(F4 a, F4 b) {
+  return _mm_mul_ps(a, b);
+}
+// a * b + c (two roundings; SSE2 has no FMA).
+inline F4 MulAdd(F4 a, F4 b, F4 c) {
+  return _mm_add_ps(_mm_mul_ps(a, b), c);
+}
+inline F4 Min(F4 a, F4 b) {
+  return _mm_min_ps(a, b);
+}
+inline F4 Max(F4 a, F4 b) {
+  return _mm_max_ps(a, b);
+}
+inline F4 CmpLt(F4 a, F4 b) {
+  return _mm_cmplt_ps(a, b);
+}
+// Lane i of the result is mask ? a : b.
+inline F4 Select(F4 mask, F4 a, F4 b) {
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+// Bit i set when lane i of |mask| is set.
+inline int MoveMask(F4 mask) {
+  return _mm_movemask_ps(mask);
+}
+inline float ReduceMin(F4 v) {
+  v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+  v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtss_f32(v);
+}
+inline float ReduceMax(F4 v) {
+  v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+  v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtss_f32(v);
+}
+
+// Round to nearest.
+inline I4 ToInt(F4 v) {
+  return _mm_cvtps_epi32(v);
+}
+// Round toward zero.
+inline I4 TruncToInt(F4 v) {
+  return _mm_cvttps_epi32(v);
+}
+inline F4 ToFloat(I4 v) {
+  return _mm_cvtepi32_ps(v);
+}
+inline I4 LoadI(const std::int32_t* p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+inline void StoreI(std::int32_t* p, I4 v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+inline I4 SplatI(std::int32_t s) {
+  return _mm_set1_epi32(s);
+}
+inline I4 OrI(I4 a, I4 b) {
+  return _mm_or_si128(a, b);
+}
+template <int kBits>
+inline I4 ShiftLeftI(I4 v) {
+  return _mm_slli_epi32(v, kBits);
+}
+// Saturating int32 -> int16 narrowing of |lo| (lanes 0-3) and |hi| (4-7).
+inline void StoreSaturatedI16(std::int16_t* p, I4 lo, I4 hi) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_packs_epi32(lo, hi));
+}
+
+#elif defined(NAVARY_SIMD_NEON)
+
+using F4 = float32x4_t;
+using I4 = int32x4_t;
+
+inline F4 Load(const float* p) {
+  return vld1q_f32(p);
+}
+inline void Store(float* p, F4 v) {
+  vst1q_f32(p, v);
+}
+inline F4 Splat(float s) {
+  return vdupq_n_f32(s);
+}
+inline F4 Add(F4 a, F4 b) {
+  return vaddq_f32(a, b);
+}
+inline F4 Sub(F4 a, F4 b) {
+  return vsubq_f32(a, b);
+}
+inline F4 Mul(F4 a, F4 b) {
+  return vmulq_f32(a, b);
+}
+inline F4 MulAdd(F4 a, F4 b, F4 c) {
+  return vmlaq_f32(c, a, b);
+}
+inline F4 Min(F4 a, F4 b) {
+  return vminq_f32(a, b);
+}
+inline F4 Max(F4 a, F4 b) {
+  return vmaxq_f32(a, b);
+}
+inline F4 CmpLt(F4 a, F4 b) {
+  return vreinterpretq_f32_u32(vcltq_f32(a, b));
+}
+inline F4 Select(F4 mask, F4 a, F4 b) {
+  return vbslq_f32(vreinterpretq_u32_f32(mask), a, b);
+}
+inline int MoveMask(F4 mask) {
+  const uint32x4_t m     = vshrq_n_u32(vreinterpretq_u32_f32(mask), 31);
+  static const int32_t kShift[4] = {0, 1, 2, 3};
+  const uint32x4_t bits  = vshlq_u32(m, vld1q_s32(kShift));
+  const uint32x2_t pair  = vorr_u32(vget_low_u32(bits), vget_high_u32(bits));
+  return static_cast<int>(vget_lane_u32(pair, 0) | vget_lane_u32(pair, 1));
+}
+inline float ReduceMin(F4 v) {
+  const float32x2_t m = vpmin_f32(vget_low_f32(v), vget_high_f32(v));
+  return vget_lane_f32(vpmin_f32(m, m), 0);
+}
+inline float ReduceMax(F4 v) {
+  const float32x2_t m = vpmax_f32(vget_low_f32(v), vget_high_f32(v));
+  return vget_lane_f32(vpmax_f32(m, m), 0);
+}
+
+inline I4 ToInt(F4 v) {
+  // vcvtnq is ARMv8 only; add +-0.5 and truncate instead.
+  const uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(v),
+                                    vdupq_n_u32(0x80000000u));
+  const F4 half = vreinterpretq_f32_u32(
+      vorrq_u32(sign, vreinterpretq_u32_f32(vdupq_n_f32(0.5f))));
+  return vcvtq_s32_f32(vaddq_f32(v, half));
+}
+inline I4 TruncToInt(F4 v) {
+  return vcvtq_s32_f32(v);
+}
+inline F4 ToFloat(I4 v) {
+  return vcvtq_f32_s32(v);
+}
+inline I4 LoadI(const std::int32_t* p) {
+  return vld1q_s32(p);
+}
+inline void StoreI(std::int32_t* p, I4 v) {
+  vst1q_s32(p, v);
+}
+inline I4 SplatI(std::int32_t s) {
+  return vdupq_n_s32(s);
+}
+inline I4 OrI(I4 a, I4 b) {
+  return vorrq_s32(a, b);
+}
+template <int kBits>
+inline I4 ShiftLeftI(I4 v) {
+  return vshlq_n_s32(v, kBits);
+}
+inline void StoreSaturatedI16(std::int16_t* p, I4 lo, I4 hi) {
+  vst1q_s16(p, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+}
+
+#else  // scalar
+
+struct F4 {
+  float v[4];
+};
+struct I4 {
+  std::int32_t v[4];
+};
+
+inline F4 Load(const float* p) {
+  return F4{{p[0], p[1], p[2], p[3]}};
+}
+inline void Store(float* p, F4 a) {
+  for (int i = 0; i < 4; ++i) {
+    p[i] = a.v[i];
+  }
+}
+inline F4 Splat(float s) {
+  return F4{{s, s, s, s}};
+}
+
+#define NAVARY_SIMD4_LANEWISE(expr) \
+  F4 r;                             \
+  for (int i = 0; i < 4; ++i) {     \
+    r.v[i] = (expr);                \
+  }                                 \
+  return r
+
+inline F4 Add(F4 a, F4 b) {
+  NAVARY_SIMD4_LANEWISE(a.v[i] + b.v[i]);
+}
+inline F4 Sub(F4 a, F4 b) {
+  NAVARY_SIMD4_LANEWISE(a.v[i] - b.v[i]);
+}
+inline F4 Mul(F4 a, F4 b) {
+  NAVARY_SIMD4_LANEWISE(a.v[i] * b.v[i]);
+}
+inline F4 MulAdd(F4 a, F4 b, F4 c) {
+  NAVARY_SIMD4_LANEWISE(a.v[i] * b.v[i] + c.v[i]);
+}
+inline F4 Min(F4 a, F4 b) {
+  NAVARY_SIMD4_LANEWISE(b.v[i] < a.v[i] ? b.v[i] : a.v[i]);
+}
+inline F4 Max(F4 a, F4 b) {
+  NAVARY_SIMD4_LANEWISE(a.v[i] < b.v[i] ? b.v[i] : a.v[i]);
+}
+// Scalar masks are 1.0 / 0.0 rather than bit patterns.
+inline F4 CmpLt(F4 a, F4 b) {
+  NAVARY_SIMD4_LANEWISE(a.v[i] < b.v[i] ? 1.0f : 0.0f);
+}
+inline F4 Select(F4 mask, F4 a, F4 b) {
+  NAVARY_SIMD4_LANEWISE(mask.v[i] != 0.0f ? a.v[i] : b.v[i]);
+}
+
+#undef NAVARY_SIMD4_LANEWISE
+
+inline int MoveMask(F4 mask) {
+  int bits = 0;
+  for (int i = 0; i < 4; ++i) {
+    bits |= (mask.v[i] != 0.0f ? 1 : 0) << i;
+  }
+  return bits;
+}
+inline float ReduceMin(F4 a) {
+  const float lo = a.v[0] < a.v[1] ? a.v[0] : a.v[1];
+  const float hi = a.v[2] < a.v[3] ? a.v[2] : a.v[3];
+  return lo < hi ? lo : hi;
+}
+inline float ReduceMax(F4 a) {
+  const float lo = a.v[0] > a.v[1] ? a.v[0] : a.v[1];
+  const float hi = a.v[2] > a.v[3] ? a.v[2] : a.v[3];
+  return lo > hi ? lo : hi;
+}
+
+inline I4 ToInt(F4 a) {
+  I4 r;
+  for (int i = 0; i < 4; ++i) {
+    const float f = a.v[i];
+    r.v[i] = static_cast<std::int32_t>(f < 0.0f ? f - 0.5f : f + 0.5f);
+  }
+  return r;
+}
+inline I4 TruncToInt(F4 a) {
+  I4 r;
+  for (int i = 0; i < 4; ++i) {
+    r.v[i] = static_cast<std::int32_t>(a.v[i]);
+  }
+  return r;
+}
+inline F4 ToFloat(I4 a) {
+  F4 r;
+  for (int i = 0; i < 4; ++i) {
+    r.v[i] = static_cast<float>(a.v[i]);
+  }
+  return r;
+}
+inline I4 LoadI(const std::int32_t* p) {
+  return I4{{p[0], p[1], p[2], p[3]}};
+}
+inline void StoreI(std::int32_t* p, I4 a) {
+  for (int i = 0; i < 4; ++i) {
+    p[i] = a.v[i];
+  }
+}
+inline I4 SplatI(std::int32_t s) {
+  return I4{{s, s, s, s}};
+}
+inline I4 OrI(I4 a, I4 b) {
+  return I4{{a.v[0] | b.v[0], a.v[1] | b.v[1], a.v[2] | b.v[2],
+             a.v[3] | b.v[3]}};
+}
+template <int kBits>
+inline I4 ShiftLeftI(I4 a) {
+  I4 r;
+  for (int i = 0; i < 4; ++i) {
+    r.v[i] = static_cast<std::int32_t>(static_cast<std::uint32_t>(a.v[i])
+                                       << kBits);
+  }
+  return r;
+}
+inline void StoreSaturatedI16(std::int16_t* p, I4 lo, I4 hi) {
+  for (int i = 0; i < 8; ++i) {
+    const std::int32_t v = i < 4 ? lo.v[i] : hi.v[i - 4];
+    p[i] = static_cast<std::int16_t>(v < -32768 ? -32768
+                                     : v > 32767 ? 32767
+                                                 : v);
+  }
+}
+
+#endif
+
+// Clamp to [lo, hi] lane-wise.
+inline F4 Clamp(F4 v, F4 lo, F4 hi) {
+  return Min(Max(v, lo), hi);
+}
+
+}  // namespace navary::math::simd4
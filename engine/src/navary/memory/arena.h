@@ -274,6 +274,17 @@ struct ArenaOptions {
   ArenaTelemetry telemetry{};
 };
 
+// Position marker returned by Arena::Checkpoint(). Captures the calling
+// thread's lane (block, bump pointer, dtor list head) plus the block list
+// head, so RewindTo() can discard everything allocated after it without
+// returning blocks upstream.
+struct ArenaCheckpoint {
+  ArenaBlock* head            = nullptr;
+  ArenaBlock* block           = nullptr;
+  std::byte* cur              = nullptr;
+  ArenaBlock::DtorNode* dtors = nullptr;
+};
+
 // -----------------------------------------------------------------------------
 // Class: navary::memory::Arena
 // -----------------------------------------------------------------------------
@@ -328,7 +339,7 @@ struct ArenaOptions {
 class Arena {
  public:
   explicit Arena(const ArenaOptions& opts = ArenaOptions())
-      : opts_(opts), head_(nullptr), total_bytes_(0) {}
+      : opts_(opts), head_(nullptr), free_(nullptr), total_bytes_(0) {}
 
   Arena(const Arena&)            = delete;
   Arena& operator=(const Arena&) = delete;
@@ -442,11 +453,91 @@ class Arena {
       FreeBlock_(b);
       b = nxt;
     }
+    for (ArenaBlock* b = free_; b;) {
+      ArenaBlock* nxt = b->next;
+      FreeBlock_(b);
+      b = nxt;
+    }
     head_ = nullptr;
+    free_ = nullptr;
     total_bytes_.store(0, std::memory_order_relaxed);
     T_on_reset_end_();
   }
 
+  // ---------- checkpoints ----------
+  // Marks the calling thread's current position. Checkpoints are meant for
+  // single-lane use (one thread allocating, e.g. a simulation step); blocks
+  // refilled by other threads after the mark are rewound too.
+  ArenaCheckpoint Checkpoint() {
+    auto& lane = GetLane_(this);
+    NAVARY_LOCK_GUARD(lk, mu_);
+    if (lane.block && !IsLinked_(lane.block)) {
+      lane.block = nullptr;
+    }
+
+    ArenaCheckpoint cp;
+    cp.head  = head_;
+    cp.block = lane.block;
+    if (lane.block) {
+      cp.cur   = lane.block->cur;
+      cp.dtors = lane.block->dtors;
+    }
+    return cp;
+  }
+
+  // Discards allocations made after |cp|: runs their registered dtors,
+  // moves blocks added since to the free list (the next refills take them
+  // before going upstream) and restores the lane's bump pointer. Requires
+  // no active epochs; |cp| is invalidated by Reset() or Purge().
+  void RewindTo(const ArenaCheckpoint& cp) {
+    AssertNoEpoch_();
+
+    // Dtor chains detached under the lock and run outside it, without
+    // allocating: the released blocks' chains (each ends in nullptr) are
+    // spliced into one list, newest block first; cp.block's run stops at
+    // cp.dtors.
+    ArenaBlock::DtorNode* released       = nullptr;
+    ArenaBlock::DtorNode** released_tail = &released;
+    ArenaBlock::DtorNode* partial        = nullptr;
+    ArenaBlock::DtorNode* partial_stop   = nullptr;
+    {
+      NAVARY_LOCK_GUARD(lk, mu_);
+      while (head_ && head_ != cp.head) {
+        ArenaBlock* b = head_;
+        head_         = b->next;
+        if (b->dtors) {
+          *released_tail = b->dtors;
+          while (*released_tail) {
+            released_tail = &(*released_tail)->next;
+          }
+        }
+        b->cur   = b->begin;
+        b->dtors = nullptr;
+        b->next  = free_;
+        free_    = b;
+      }
+      if (cp.block) {
+        partial         = cp.block->dtors;
+        partial_stop    = cp.dtors;
+        cp.block->cur   = cp.cur;
+        cp.block->dtors = cp.dtors;
+      }
+    }
+
+    for (ArenaBlock::DtorNode* n = released; n;) {
+      auto* next = n->next;
+      n->fn(n->arg);
+      n = next;
+    }
+    for (ArenaBlock::DtorNode* n = partial; n != partial_stop;) {
+      auto* next = n->next;
+      n->fn(n->arg);
+      n = next;
+    }
+
+    GetLane_(this).block = cp.block;
+  }
+
   // ---------- epoch / wait ----------
   class ArenaEpoch {
    public:
@@ -755,6 +846,20 @@ class Arena {
 
   ArenaBlock* RefillLane_(std::size_t need, std::size_t align) {
     NAVARY_LOCK_GUARD(lk, mu_);
+
+    // Blocks released by RewindTo() come first; they are already counted
+    // in total_bytes_.
+    for (ArenaBlock** link = &free_; *link; link = &(*link)->next) {
+      ArenaBlock* block = *link;
+      if (static_cast<std::size_t>(block->end - block->begin) >= need + align) {
+        *link       = block->next;
+        block->next = head_;
+        head_       = block;
+        (void)TryBump_(block, 0, align);
+        return block;
+      }
+    }
+
     std::size_t want = NextBlockSize_(need, align);
     auto* raw        = static_cast<std::byte*>(
         opts_.upstream.allocate(want, opts_.alignment, opts_.upstream.user));
@@ -775,6 +880,16 @@ class Arena {
     return block;
   }
 
+  // Caller holds mu_.
+  bool IsLinked_(const ArenaBlock* block) const {
+    for (ArenaBlock* b = head_; b; b = b->next) {
+      if (b == block) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   std::size_t NextBlockSize_(std::size_t need, std::size_t align) const {
     std::size_t body       = opts_.initial_block_bytes;
     std::size_t min_needed = need + align + sizeof(ArenaBlock);
@@ -912,6 +1027,7 @@ class Arena {
   ArenaOptions opts_;
   mutable NAVARY_MUTEX mu_;
   ArenaBlock* head_;
+  ArenaBlock* free_;  // rewound blocks, empty, awaiting reuse
   std::atomic<std::size_t> total_bytes_;
 };
 
@@ -0,0 +1,334 @@
+#pragma once
+
+// ============================================================================
+// Navary Engine - Memory / State Arena & Snapshot Ring
+/// ----------------------------------------------------------------------------
+// File: navary/memory/state_arena.h
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+//
+// Overview:
+//   Contiguous, fixed-capacity bump allocator for simulation state that must
+//   be saved and restored wholesale (rollback netcode, replays, desync
+//   checks), plus a ring of N byte snapshots of it.
+//
+//   All state lives in one upstream allocation, so a snapshot is a single
+//   memcpy of [data(), data() + used()) and a restore is the reverse.
+//   Pointers between objects inside the arena stay valid across restores
+//   because they are copied back into the same buffer.
+//
+// ----------------------------------------------------------------------------
+// Typical Usage:
+// ```cpp
+//     navary::memory::StateArena state(4 << 20);
+//     auto* world = state.Create<SimWorld>();
+//     navary::memory::StateSnapshotRing ring(8, state.capacity());
+//
+//     ring.Save(tick, state);              // every simulated tick
+//     ...
+//     ring.Restore(confirmed_tick, &state);  // late input: roll back
+// ```
+// ----------------------------------------------------------------------------
+// Rules:
+//   - Only trivially copyable, trivially destructible types (no dtors run,
+//     bytes are copied blindly). Use handles or in-arena pointers, never
+//     pointers to heap memory owned elsewhere.
+//   - Single-threaded: the owning simulation thread allocates and restores.
+//   - Unused bytes are kept zero (construction, RewindTo, Reset, Restore),
+//     so padding is deterministic and Hash() agrees across peers running
+//     the same simulation.
+//
+// ----------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "navary/memory/arena.h"
+
+namespace navary::memory {
+
+// 64-bit hash over a byte range for desync detection. Four independent
+// multiply-rotate lanes over 8-byte words keep it at memory speed; the
+// result is defined by byte content only (little-endian word loads).
+inline std::uint64_t HashStateBytes(const void* data, std::size_t size) {
+  constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+  constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+
+  auto rotl = [](std::uint64_t v, int r) {
+    return (v << r) | (v >> (64 - r));
+  };
+  auto mix = [&](std::uint64_t acc, std::uint64_t word) {
+    acc += word * kPrime2;
+    return rotl(acc, 31) * kPrime1;
+  };
+
+  const auto* p         = static_cast<const std::uint8_t*>(data);
+  std::uint64_t lane[4] = {kPrime1 + kPrime2, kPrime2, 0, 0 - kPrime1};
+  std::size_t i         = 0;
+  for (; i + 32 <= size; i += 32) {
+    std::uint64_t w[4];
+    std::memcpy(w, p + i, sizeof(w));
+    lane[0] = mix(lane[0], w[0]);
+    lane[1] = mix(lane[1], w[1]);
+    lane[2] = mix(lane[2], w[2]);
+    lane[3] = mix(lane[3], w[3]);
+  }
+
+  std::uint64_t h = rotl(lane[0], 1) + rotl(lane[1], 7) + rotl(lane[2], 12) +
+                    rotl(lane[3], 18) + static_cast<std::uint64_t>(size);
+  for (; i + 8 <= size; i += 8) {
+    std::uint64_t w;
+    std::memcpy(&w, p + i, sizeof(w));
+    h = rotl(h ^ mix(0, w), 27) * kPrime1;
+  }
+  for (; i < size; ++i) {
+    h = rotl(h ^ (p[i] * kPrime2), 11) * kPrime1;
+  }
+
+  h ^= h >> 33;
+  h *= kPrime2;
+  h ^= h >> 29;
+  return h;
+}
+
+// -----------------------------------------------------------------------------
+// Class: navary::memory::StateArena
+// -----------------------------------------------------------------------------
+class StateArena {
+ public:
+  static constexpr std::size_t kBufferAlignment = 64;
+
+  // Reserves |capacity_bytes| up front. On upstream failure capacity() is 0
+  // and every allocation returns nullptr.
+  explicit StateArena(std::size_t capacity_bytes,
+                      const ArenaUpstream& upstream = ArenaUpstream::Default())
+      : upstream_(upstream), data_(nullptr), capacity_(0), used_(0) {
+    if (capacity_bytes == 0) {
+      return;
+    }
+    data_ = static_cast<std::byte*>(
+        upstream_.allocate(capacity_bytes, kBufferAlignment, upstream_.user));
+    if (data_) {
+      capacity_ = capacity_bytes;
+      std::memset(data_, 0, capacity_);
+    }
+  }
+
+  StateArena(const StateArena&)            = delete;
+  StateArena& operator=(const StateArena&) = delete;
+
+  ~StateArena() {
+    if (data_) {
+      upstream_.deallocate(data_, capacity_, upstream_.user);
+    }
+  }
+
+  // ---------- allocation ----------
+  // Returns zeroed memory, or nullptr when the arena is full.
+  void* Allocate(std::size_t size,
+                 std::size_t alignment = alignof(std::max_align_t)) {
+    const std::size_t start = (used_ + (alignment - 1)) & ~(alignment - 1);
+    if (!data_ || start > capacity_ || size > capacity_ - start) {
+      return nullptr;
+    }
+    used_ = start + size;
+    return data_ + start;
+  }
+
+  template <class T, class... Args>
+  T* Create(Args&&... args) {
+    static_assert(std::is_trivially_copyable_v<T> &&
+                      std::is_trivially_destructible_v<T>,
+                  "StateArena holds trivially copyable types only");
+    void* mem = Allocate(sizeof(T), alignof(T));
+    return mem ? new (mem) T(std::forward<Args>(args)...) : nullptr;
+  }
+
+  template <class T>
+  Span<T> MakeSpan(std::size_t n) {
+    static_assert(std::is_trivially_copyable_v<T> &&
+                      std::is_trivially_destructible_v<T>,
+                  "StateArena holds trivially copyable types only");
+    T* data = static_cast<T*>(Allocate(sizeof(T) * n, alignof(T)));
+    return data ? Span<T>(data, n) : Span<T>();
+  }
+
+  // ---------- checkpoints ----------
+  // A checkpoint is the bump offset; rewinding zeroes what was discarded.
+  std::size_t Checkpoint() const {
+    return used_;
+  }
+
+  void RewindTo(std::size_t mark) {
+    if (mark < used_) {
+      std::memset(data_ + mark, 0, used_ - mark);
+      used_ = mark;
+    }
+  }
+
+  void Reset() {
+    RewindTo(0);
+  }
+
+  // ---------- state ----------
+  std::uint64_t Hash() const {
+    return HashStateBytes(data_, used_);
+  }
+
+  const std::byte* data() const {
+    return data_;
+  }
+  std::size_t used() const {
+    return used_;
+  }
+  std::size_t capacity() const {
+    return capacity_;
+  }
+
+ private:
+  friend class StateSnapshotRing;
+
+  ArenaUpstream upstream_;
+  std::byte* data_;
+  std::size_t capacity_;
+  std::size_t used_;
+};
+
+// -----------------------------------------------------------------------------
+// Class: navary::memory::StateSnapshotRing
+// -----------------------------------------------------------------------------
+// N fixed-size slots in one allocation; tick t lives in slot t % N, so the
+// ring always holds the last N saved ticks. Each slot stores the byte
+// image, its size and its hash (computed once on Save).
+class StateSnapshotRing {
+ public:
+  StateSnapshotRing(std::uint32_t slot_count, std::size_t slot_bytes,
+                    const ArenaUpstream& upstream = ArenaUpstream::Default())
+      : upstream_(upstream),
+        storage_(nullptr),
+        slots_(nullptr),
+        slot_count_(0),
+        slot_bytes_(0) {
+    if (slot_count == 0 || slot_bytes == 0) {
+      return;
+    }
+    // Keep every slot image 64-byte aligned.
+    slot_bytes = (slot_bytes + StateArena::kBufferAlignment - 1) &
+                 ~(StateArena::kBufferAlignment - 1);
+    storage_ = static_cast<std::byte*>(
+        upstream_.allocate(StorageBytes(slot_count, slot_bytes),
+                           StateArena::kBufferAlignment, upstream_.user));
+    if (!storage_) {
+      return;
+    }
+    slot_count_ = slot_count;
+    slot_bytes_ = slot_bytes;
+    slots_      = reinterpret_cast<Slot*>(storage_ + slot_count_ * slot_bytes_);
+    for (std::uint32_t i = 0; i < slot_count_; ++i) {
+      new (&slots_[i]) Slot{};
+    }
+  }
+
+  StateSnapshotRing(const StateSnapshotRing&)            = delete;
+  StateSnapshotRing& operator=(const StateSnapshotRing&) = delete;
+
+  ~StateSnapshotRing() {
+    if (storage_) {
+      upstream_.deallocate(storage_, StorageBytes(slot_count_, slot_bytes_),
+                           upstream_.user);
+    }
+  }
+
+  // Copies |state| into the slot for |tick| (evicting tick - N). False if
+  // the state does not fit a slot.
+  bool Save(std::uint32_t tick, const StateArena& state) {
+    if (slot_count_ == 0 || state.used_ > slot_bytes_) {
+      return false;
+    }
+    Slot& slot = slots_[tick % slot_count_];
+    std::memcpy(SlotData(tick), state.data_, state.used_);
+    slot.tick  = tick;
+    slot.used  = state.used_;
+    slot.hash  = HashStateBytes(state.data_, state.used_);
+    slot.valid = true;
+    return true;
+  }
+
+  // Copies the image saved for |tick| back into |state|. False if that
+  // tick was never saved or has been overwritten.
+  bool Restore(std::uint32_t tick, StateArena* state) const {
+    const Slot* slot = Find(tick);
+    if (!slot || slot->used > state->capacity_) {
+      return false;
+    }
+    std::memcpy(state->data_, SlotData(tick), slot->used);
+    if (state->used_ > slot->used) {
+      std::memset(state->data_ + slot->used, 0, state->used_ - slot->used);
+    }
+    state->used_ = slot->used;
+    return true;
+  }
+
+  bool Contains(std::uint32_t tick) const {
+    return Find(tick) != nullptr;
+  }
+
+  // Hash recorded for |tick|, for comparing against a peer's report.
+  bool HashAt(std::uint32_t tick, std::uint64_t* out_hash) const {
+    const Slot* slot = Find(tick);
+    if (!slot) {
+      return false;
+    }
+    *out_hash = slot->hash;
+    return true;
+  }
+
+  void Clear() {
+    for (std::uint32_t i = 0; i < slot_count_; ++i) {
+      slots_[i].valid = false;
+    }
+  }
+
+  std::uint32_t slot_count() const {
+    return slot_count_;
+  }
+  std::size_t slot_bytes() const {
+    return slot_bytes_;
+  }
+
+ private:
+  struct Slot {
+    std::uint32_t tick = 0;
+    bool valid         = false;
+    std::size_t used   = 0;
+    std::uint64_t hash = 0;
+  };
+
+  static std::size_t StorageBytes(std::uint32_t count, std::size_t bytes) {
+    return count * bytes + count * sizeof(Slot);
+  }
+
+  std::byte* SlotData(std::uint32_t tick) const {
+    return storage_ + (tick % slot_count_) * slot_bytes_;
+  }
+
+  const Slot* Find(std::uint32_t tick) const {
+    if (slot_count_ == 0) {
+      return nullptr;
+    }
+    const Slot& slot = slots_[tick % slot_count_];
+    return slot.valid && slot.tick == tick ? &slot : nullptr;
+  }
+
+  ArenaUpstream upstream_;
+  std::byte* storage_;
+  Slot* slots_;
+  std::uint32_t slot_count_;
+  std::size_t slot_bytes_;
+};
+
+}  // namespace navary::memory
@@ -0,0 +1,345 @@
+// Navary Engine - Messaging Subsystem
+// File: navary/messaging/message_bus.cc
+// Purpose: MessageBus / MessageBatch implementation.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/messaging/message_bus.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace navary::messaging {
+
+namespace {
+
+// Record layout inside a block: header, then the payload padded to
+// kMessageAlign.
+struct MessageRecord {
+  std::uint32_t channel;
+  std::uint32_t size;
+};
+
+static_assert(sizeof(MessageRecord) % kMessageAlign == 0);
+static_assert(sizeof(MessageBlock) % kMessageAlign == 0);
+
+constexpr std::uint32_t kMinBlockBytes = 1024;
+constexpr std::uint32_t kMaxBlockBytes = 256 * 1024;
+
+std::uint32_t RecordBytes(std::uint32_t size) {
+  return static_cast<std::uint32_t>(sizeof(MessageRecord)) +
+         ((size + kMessageAlign - 1) & ~(kMessageAlign - 1));
+}
+
+std::uint8_t* BlockData(MessageBlock* block) {
+  return reinterpret_cast<std::uint8_t*>(block) + sizeof(MessageBlock);
+}
+
+memory::ArenaOptions BusArenaOptions() {
+  memory::ArenaOptions opts;
+  opts.initial_block_bytes = 1024 * 1024;
+  opts.max_block_bytes     = 1024 * 1024;
+  return opts;
+}
+
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// MessageBatch
+// ---------------------------------------------------------------------------
+
+MessageBatch::MessageBatch(MessageBus* bus, std::uint32_t lane)
+    : bus_(bus), lane_(lane), block_(nullptr) {}
+
+MessageBatch::~MessageBatch() {
+  Flush();
+}
+
+bool MessageBatch::PushRaw(std::uint32_t channel, const void* data,
+                           std::uint32_t size) {
+  if (channel >= bus_->channel_count_ ||
+      bus_->channels_[channel].payload_size != size) {
+    return false;
+  }
+  const MessagePhase phase   = bus_->channels_[channel].phase;
+  const std::uint32_t record = RecordBytes(size);
+
+  if (block_ != nullptr &&
+      (block_->phase != phase ||
+       block_->used + record > bus_->block_payload_bytes_)) {
+    Flush();
+  }
+  if (block_ == nullptr) {
+    block_ = bus_->AcquireBlock(phase);
+    if (block_ == nullptr) {
+      bus_->dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+  }
+
+  std::uint8_t* dst = BlockData(block_) + block_->used;
+  const MessageRecord header{channel, size};
+  std::memcpy(dst, &header, sizeof(header));
+  std::memcpy(dst + sizeof(header), data, size);
+  block_->used += record;
+  ++block_->count;
+  return true;
+}
+
+void MessageBatch::Flush() {
+  if (block_ == nullptr) {
+    return;
+  }
+  if (block_->count == 0) {
+    bus_->ReleaseBlock(block_);
+  } else {
+    bus_->Submit(block_, lane_);
+  }
+  block_ = nullptr;
+}
+
+// ---------------------------------------------------------------------------
+// MessageBus
+// ---------------------------------------------------------------------------
+
+MessageBus::MessageBus()
+    : arena_(BusArenaOptions()),
+      channels_(nullptr),
+      channel_count_(0),
+      max_channels_(0),
+      block_payload_bytes_(0),
+      lanes_(nullptr),
+      max_lanes_(0),
+      lane_count_(0),
+      pending_head_{},
+      pending_tail_{},
+      published_(0),
+      delivered_(0),
+      dropped_(0),
+      blocks_(0) {}
+
+MessageBus::~MessageBus() {
+  Shutdown();
+}
+
+NavaryRC MessageBus::Init(const MessageBusDesc& desc) {
+  if (channels_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MessageBus: already initialized");
+  }
+  if (desc.max_channels == 0 || desc.block_count == 0 ||
+      desc.block_bytes < kMinBlockBytes || desc.block_bytes > kMaxBlockBytes) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MessageBus: invalid descriptor");
+  }
+
+  channels_ = static_cast<ChannelInfo*>(
+      std::malloc(sizeof(ChannelInfo) * desc.max_channels));
+  if (channels_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "MessageBus: channel table alloc failed");
+  }
+  max_channels_  = desc.max_channels;
+  channel_count_ = 0;
+
+  // Every block is either free, being filled, queued or pending, so queues
+  // sized to the block count can never overflow.
+  NavaryRC rc = free_blocks_.Init(desc.block_count);
+  if (rc.ok()) {
+    rc = inbound_.Init(desc.block_count);
+  }
+  if (rc.ok() && desc.max_lanes > 0) {
+    lanes_ = new (std::nothrow) SpscQueue<MessageBlock*>[desc.max_lanes];
+    if (lanes_ == nullptr) {
+      rc = NavaryRC(NavaryStatus::kOutOfMemory,
+                    "MessageBus: lane alloc failed");
+    }
+    for (std::uint32_t i = 0; rc.ok() && i < desc.max_lanes; ++i) {
+      rc = lanes_[i].Init(desc.block_count);
+    }
+  }
+  if (!rc.ok()) {
+    Shutdown();
+    return rc;
+  }
+  max_lanes_ = desc.max_lanes;
+  lane_count_.store(0, std::memory_order_relaxed);
+
+  block_payload_bytes_ =
+      desc.block_bytes - static_cast<std::uint32_t>(sizeof(MessageBlock));
+  for (std::uint32_t i = 0; i < desc.block_count; ++i) {
+    void* mem = arena_.Allocate(desc.block_bytes, kCacheLineBytes);
+    if (mem == nullptr) {
+      Shutdown();
+      return NavaryRC(NavaryStatus::kOutOfMemory,
+                      "MessageBus: block alloc failed");
+    }
+    free_blocks_.TryPush(new (mem) MessageBlock{});
+  }
+  return NavaryRC::OK();
+}
+
+void MessageBus::Shutdown() {
+  free_blocks_.Shutdown();
+  inbound_.Shutdown();
+  delete[] lanes_;
+  lanes_     = nullptr;
+  max_lanes_ = 0;
+  std::free(channels_);
+  channels_      = nullptr;
+  channel_count_ = 0;
+  max_channels_  = 0;
+  for (std::uint32_t p = 0; p < kMessagePhaseCount; ++p) {
+    pending_head_[p] = nullptr;
+    pending_tail_[p] = nullptr;
+  }
+  arena_.Purge();
+}
+
+NavaryResult<std::uint32_t> MessageBus::CreateChannelRaw(
+    std::uint32_t payload_size, MessagePhase phase) {
+  if (channels_ == nullptr || phase >= MessagePhase::kCount ||
+      RecordBytes(payload_size) > block_payload_bytes_) {
+    return NavaryResult<std::uint32_t>(NavaryRC(
+        NavaryStatus::kInvalidArgument, "MessageBus: invalid channel"));
+  }
+  if (channel_count_ >= max_channels_) {
+    return NavaryResult<std::uint32_t>(
+        NavaryRC(NavaryStatus::kOutOfMemory, "MessageBus: channel table full"));
+  }
+  ChannelInfo& info     = channels_[channel_count_];
+  info.payload_size     = payload_size;
+  info.phase            = phase;
+  info.subscriber_count = 0;
+  return NavaryResult<std::uint32_t>(channel_count_++);
+}
+
+NavaryRC MessageBus::AddSubscriber(std::uint32_t channel, ThunkFn thunk,
+                                   void (*fn)(), void* user) {
+  if (channel >= channel_count_ || fn == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MessageBus: unknown channel");
+  }
+  ChannelInfo& info = channels_[channel];
+  if (info.subscriber_count >= kMaxSubscribers) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "MessageBus: too many subscribers");
+  }
+  info.subscribers[info.subscriber_count++] = Subscriber{thunk, fn, user};
+  return NavaryRC::OK();
+}
+
+NavaryResult<std::uint32_t> MessageBus::OpenLane() {
+  const std::uint32_t lane =
+      lane_count_.fetch_add(1, std::memory_order_relaxed);
+  if (lane >= max_lanes_) {
+    lane_count_.fetch_sub(1, std::memory_order_relaxed);
+    return NavaryResult<std::uint32_t>(
+        NavaryRC(NavaryStatus::kOutOfMemory, "MessageBus: no free lane"));
+  }
+  return NavaryResult<std::uint32_t>(lane);
+}
+
+MessageBlock* MessageBus::AcquireBlock(MessagePhase phase) {
+  MessageBlock* block = nullptr;
+  if (!free_blocks_.TryPop(&block)) {
+    return nullptr;
+  }
+  block->next  = nullptr;
+  block->used  = 0;
+  block->count = 0;
+  block->phase = phase;
+  return block;
+}
+
+void MessageBus::ReleaseBlock(MessageBlock* block) {
+  free_blocks_.TryPush(block);
+}
+
+void MessageBus::Submit(MessageBlock* block, std::uint32_t lane) {
+  published_.fetch_add(block->count, std::memory_order_relaxed);
+  blocks_.fetch_add(1, std::memory_order_relaxed);
+  if (lane < max_lanes_) {
+    lanes_[lane].TryPush(block);
+  } else {
+    inbound_.TryPush(block);
+  }
+}
+
+void MessageBus::Drain() {
+  auto append = [this](MessageBlock* block) {
+    const auto p = static_cast<std::uint32_t>(block->phase);
+    block->next  = nullptr;
+    if (pending_tail_[p] != nullptr) {
+      pending_tail_[p]->next = block;
+    } else {
+      pending_head_[p] = block;
+    }
+    pending_tail_[p] = block;
+  };
+
+  MessageBlock* block = nullptr;
+  while (inbound_.TryPop(&block)) {
+    append(block);
+  }
+  const std::uint32_t lanes = lane_count_.load(std::memory_order_relaxed);
+  for (std::uint32_t i = 0; i < lanes && i < max_lanes_; ++i) {
+    while (lanes_[i].TryPop(&block)) {
+      append(block);
+    }
+  }
+}
+
+std::uint32_t MessageBus::Deliver(MessageBlock* block) {
+  const std::uint8_t* cursor = BlockData(block);
+  for (std::uint32_t i = 0; i < block->count; ++i) {
+    MessageRecord header;
+    std::memcpy(&header, cursor, sizeof(header));
+    const std::uint8_t* payload = cursor + sizeof(header);
+
+    const ChannelInfo& info = channels_[header.channel];
+    for (std::uint32_t s = 0; s < info.subscriber_count; ++s) {
+      const Subscriber& sub = info.subscribers[s];
+      sub.thunk(sub.fn, payload, header.size, sub.user);
+    }
+    cursor += RecordBytes(header.size);
+  }
+  return block->count;
+}
+
+std::uint32_t MessageBus::Dispatch(MessagePhase phase) {
+  if (channels_ == nullptr || phase >= MessagePhase::kCount) {
+    return 0;
+  }
+  Drain();
+
+  // Detach first: subscribers may publish, which only touches the queues.
+  const auto p        = static_cast<std::uint32_t>(phase);
+  MessageBlock* block = pending_head_[p];
+  pending_head_[p]    = nullptr;
+  pending_tail_[p]    = nullptr;
+
+  std::uint32_t delivered = 0;
+  while (block != nullptr) {
+    MessageBlock* next = block->next;
+    delivered += Deliver(block);
+    ReleaseBlock(block);
+    block = next;
+  }
+  delivered_.fetch_add(delivered, std::memory_order_relaxed);
+  return delivered;
+}
+
+MessageBusStats MessageBus::stats() const {
+  MessageBusStats s;
+  s.published = published_.load(std::memory_order_relaxed);
+  s.delivered = delivered_.load(std::memory_order_relaxed);
+  s.dropped   = dropped_.load(std::memory_order_relaxed);
+  s.blocks    = blocks_.load(std::memory_order_relaxed);
+  return s;
+}
+
+}  // namespace navary::messaging
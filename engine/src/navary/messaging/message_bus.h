@@ -0,0 +1,260 @@
+#pragma once
+// Navary Engine - Messaging Subsystem
+// File: navary/messaging/message_bus.h
+// Purpose: Typed cross-thread message channels delivered at frame phases.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - Channels are typed handles (MessageChannel<T>) created up front, each
+//     bound to the MessagePhase at which its messages are delivered.
+//   - Producers write into a MessageBatch: payloads are copied back to back
+//     into a fixed-size block carved from the bus arena at Init(). A full
+//     block (or Flush()) is handed over with a single queue push, so the
+//     per-message cost is a bounds check and a memcpy.
+//   - Blocks travel through a lock-free MPMC queue shared by any thread, or
+//     through a dedicated SPSC lane (OpenLane) for long-lived producer
+//     threads such as streaming or loaders. Used blocks go back to a
+//     lock-free free list. Nothing takes a mutex or allocates after Init().
+//   - The frame thread calls Dispatch(phase) at each phase boundary; that
+//     drains the queues and invokes the phase's subscribers in order.
+//
+// Ordering / threading:
+//   - Messages from one batch arrive in push order; batches from one lane
+//     arrive in submit order. No order is defined across producers.
+//   - CreateChannel/Subscribe/OpenLane are setup-time calls (frame thread,
+//     before producers run). Dispatch runs on one thread at a time.
+//   - Messages published while a phase dispatches (e.g. from a subscriber)
+//     are delivered at that phase's next Dispatch.
+//   - When no free block is left, pushes fail and count as dropped.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "navary/memory/arena.h"
+#include "navary/messaging/mpmc_queue.h"
+#include "navary/messaging/spsc_queue.h"
+#include "navary/navary_status.h"
+
+namespace navary::messaging {
+
+enum class MessagePhase : std::uint8_t {
+  kFrameBegin = 0,  // input, network receive
+  kPreSimulation,
+  kPostSimulation,  // gameplay events raised by the tick
+  kPreRender,       // streaming / loader completions, uploads
+  kFrameEnd,
+  kCount
+};
+
+inline constexpr std::uint32_t kMessagePhaseCount =
+    static_cast<std::uint32_t>(MessagePhase::kCount);
+
+inline constexpr std::uint32_t kInvalidMessageChannel = 0xFFFFFFFFu;
+inline constexpr std::uint32_t kSharedMessageLane     = 0xFFFFFFFFu;
+
+// Payload alignment inside blocks; message types may not exceed it.
+inline constexpr std::uint32_t kMessageAlign = 8;
+
+template <typename T>
+struct MessageChannel {
+  std::uint32_t id = kInvalidMessageChannel;
+
+  bool valid() const {
+    return id != kInvalidMessageChannel;
+  }
+};
+
+struct MessageBusDesc {
+  std::uint32_t max_channels = 128;
+  std::uint32_t block_bytes  = 16 * 1024;  // 1 KiB .. 256 KiB
+  std::uint32_t block_count  = 256;
+  std::uint32_t max_lanes    = 8;
+};
+
+struct MessageBusStats {
+  std::uint64_t published;  // messages submitted
+  std::uint64_t delivered;  // messages dispatched (with or without subs)
+  std::uint64_t dropped;    // no free block
+  std::uint64_t blocks;     // blocks submitted
+};
+
+// Untyped subscriber: |payload| points at |size| bytes valid for the call.
+using RawMessageFn = void (*)(const void* payload, std::uint32_t size,
+                              void* user);
+
+// Payload block header; message records follow it in the same allocation.
+struct alignas(16) MessageBlock {
+  MessageBlock* next;  // consumer-side pending list
+  std::uint32_t used;  // record bytes in use
+  std::uint32_t count;
+  MessagePhase phase;
+};
+
+class MessageBus;
+
+// Per-producer accumulator. Not thread-safe: one batch per thread. The
+// destructor flushes.
+class MessageBatch {
+ public:
+  explicit MessageBatch(MessageBus* bus,
+                        std::uint32_t lane = kSharedMessageLane);
+  ~MessageBatch();
+
+  MessageBatch(const MessageBatch&)            = delete;
+  MessageBatch& operator=(const MessageBatch&) = delete;
+
+  template <typename T>
+  bool Push(MessageChannel<T> channel, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "messages must be trivially copyable");
+    static_assert(alignof(T) <= kMessageAlign, "message alignment too large");
+    return PushRaw(channel.id, &value, sizeof(T));
+  }
+
+  // Copies |size| bytes; |size| must match the channel's payload size.
+  // False when the channel is unknown or no block is available.
+  bool PushRaw(std::uint32_t channel, const void* data, std::uint32_t size);
+
+  // Submits the partially filled block, if any.
+  void Flush();
+
+ private:
+  MessageBus* bus_;
+  std::uint32_t lane_;
+  MessageBlock* block_;
+};
+
+class MessageBus {
+ public:
+  static constexpr std::uint32_t kMaxSubscribers = 8;
+
+  MessageBus();
+  ~MessageBus();
+
+  MessageBus(const MessageBus&)            = delete;
+  MessageBus& operator=(const MessageBus&) = delete;
+
+  NavaryRC Init(const MessageBusDesc& desc);
+
+  // Frees blocks and queues; undelivered messages are discarded. No
+  // producer may be running. Safe to call twice.
+  void Shutdown();
+
+  template <typename T>
+  NavaryResult<MessageChannel<T>> CreateChannel(MessagePhase phase) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "messages must be trivially copyable");
+    static_assert(alignof(T) <= kMessageAlign, "message alignment too large");
+    NavaryResult<std::uint32_t> id = CreateChannelRaw(sizeof(T), phase);
+    if (!id.status().ok()) {
+      return NavaryResult<MessageChannel<T>>(id.status());
+    }
+    return NavaryResult<MessageChannel<T>>(MessageChannel<T>{id.value()});
+  }
+
+  NavaryResult<std::uint32_t> CreateChannelRaw(std::uint32_t payload_size,
+                                               MessagePhase phase);
+
+  template <typename T>
+  NavaryRC Subscribe(MessageChannel<T> channel,
+                     void (*fn)(const T& message, void* user), void* user) {
+    return AddSubscriber(channel.id, &TypedThunk<T>,
+                         reinterpret_cast<void (*)()>(fn), user);
+  }
+
+  NavaryRC SubscribeRaw(std::uint32_t channel, RawMessageFn fn, void* user) {
+    return AddSubscriber(channel, &RawThunk, reinterpret_cast<void (*)()>(fn),
+                         user);
+  }
+
+  // Reserves a dedicated SPSC lane for one producer thread; pass the index
+  // to MessageBatch. kOutOfMemory when all lanes are taken.
+  NavaryResult<std::uint32_t> OpenLane();
+
+  // One-off publish through the shared queue (one block per call; prefer a
+  // MessageBatch for bursts).
+  template <typename T>
+  bool Publish(MessageChannel<T> channel, const T& value) {
+    MessageBatch batch(this);
+    return batch.Push(channel, value);
+  }
+
+  // Drains all queues and delivers every pending message bound to |phase|.
+  // Returns the number of messages delivered.
+  std::uint32_t Dispatch(MessagePhase phase);
+
+  MessageBusStats stats() const;
+
+  std::uint32_t block_payload_bytes() const {
+    return block_payload_bytes_;
+  }
+
+ private:
+  friend class MessageBatch;
+
+  using ThunkFn = void (*)(void (*fn)(), const void* payload,
+                           std::uint32_t size, void* user);
+
+  struct Subscriber {
+    ThunkFn thunk;
+    void (*fn)();
+    void* user;
+  };
+
+  struct ChannelInfo {
+    std::uint32_t payload_size;
+    MessagePhase phase;
+    std::uint32_t subscriber_count;
+    Subscriber subscribers[kMaxSubscribers];
+  };
+
+  template <typename T>
+  static void TypedThunk(void (*fn)(), const void* payload, std::uint32_t,
+                         void* user) {
+    T message;
+    std::memcpy(&message, payload, sizeof(T));
+    reinterpret_cast<void (*)(const T&, void*)>(fn)(message, user);
+  }
+
+  static void RawThunk(void (*fn)(), const void* payload, std::uint32_t size,
+                       void* user) {
+    reinterpret_cast<RawMessageFn>(fn)(payload, size, user);
+  }
+
+  NavaryRC AddSubscriber(std::uint32_t channel, ThunkFn thunk, void (*fn)(),
+                         void* user);
+
+  MessageBlock* AcquireBlock(MessagePhase phase);
+  void ReleaseBlock(MessageBlock* block);
+  void Submit(MessageBlock* block, std::uint32_t lane);
+  void Drain();
+  std::uint32_t Deliver(MessageBlock* block);
+
+  memory::Arena arena_;
+  ChannelInfo* channels_;
+  std::uint32_t channel_count_;
+  std::uint32_t max_channels_;
+  std::uint32_t block_payload_bytes_;
+
+  MpmcQueue<MessageBlock*> free_blocks_;
+  MpmcQueue<MessageBlock*> inbound_;
+  SpscQueue<MessageBlock*>* lanes_;
+  std::uint32_t max_lanes_;
+  std::atomic<std::uint32_t> lane_count_;
+
+  // Consumer-side FIFO of drained blocks per phase.
+  MessageBlock* pending_head_[kMessagePhaseCount];
+  MessageBlock* pending_tail_[kMessagePhaseCount];
+
+  std::atomic<std::uint64_t> published_;
+  std::atomic<std::uint64_t> delivered_;
+  std::atomic<std::uint64_t> dropped_;
+  std::atomic<std::uint64_t> blocks_;
+};
+
+}  // namespace navary::messaging
@@ -0,0 +1,149 @@
+#pragma once
+// Navary Engine - Messaging Subsystem
+// File: navary/messaging/mpmc_queue.h
+// Purpose: Bounded lock-free multi-producer / multi-consumer queue.
+// Policy: C++20, Google style, no exceptions, no RTTI, header-only.
+//
+// Overview:
+//   - Array of cells with per-cell sequence numbers (Vyukov's bounded MPMC
+//     design): one CAS on the shared position per push/pop, no ABA, no
+//     allocation after Init().
+//   - Capacity rounds up to a power of two. TryPush/TryPop fail instead of
+//     blocking when the queue is full/empty.
+//   - T must be trivially copyable (pointers, handles, small PODs).
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+#include "navary/navary_status.h"
+
+namespace navary::messaging {
+
+inline constexpr std::size_t kCacheLineBytes = 64;
+
+template <typename T>
+class MpmcQueue {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "MpmcQueue holds trivially copyable values");
+
+ public:
+  MpmcQueue() : cells_(nullptr), mask_(0), enqueue_pos_(0), dequeue_pos_(0) {}
+
+  ~MpmcQueue() {
+    Shutdown();
+  }
+
+  MpmcQueue(const MpmcQueue&)            = delete;
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+  NavaryRC Init(std::size_t capacity) {
+    if (cells_ != nullptr) {
+      return NavaryRC(NavaryStatus::kInvalidArgument,
+                      "MpmcQueue: already initialized");
+    }
+    std::size_t cap = 2;
+    while (cap < capacity) {
+      cap <<= 1;
+    }
+    cells_ = static_cast<Cell*>(std::malloc(sizeof(Cell) * cap));
+    if (cells_ == nullptr) {
+      return NavaryRC(NavaryStatus::kOutOfMemory, "MpmcQueue: alloc failed");
+    }
+    for (std::size_t i = 0; i < cap; ++i) {
+      new (&cells_[i]) Cell();
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    mask_ = cap - 1;
+    enqueue_pos_.store(0, std::memory_order_relaxed);
+    dequeue_pos_.store(0, std::memory_order_relaxed);
+    return NavaryRC::OK();
+  }
+
+  // Not thread-safe; no pushes/pops may be in flight. Safe to call twice.
+  void Shutdown() {
+    if (cells_ == nullptr) {
+      return;
+    }
+    for (std::size_t i = 0; i <= mask_; ++i) {
+      cells_[i].~Cell();
+    }
+    std::free(cells_);
+    cells_ = nullptr;
+    mask_  = 0;
+  }
+
+  bool TryPush(const T& value) {
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell             = cells_[pos & mask_];
+      const std::size_t seq  = cell.sequence.load(std::memory_order_acquire);
+      const std::intptr_t df = static_cast<std::intptr_t>(seq) -
+                               static_cast<std::intptr_t>(pos);
+      if (df == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          cell.value = value;
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (df < 0) {
+        return false;  // full
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool TryPop(T* out) {
+    std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell& cell             = cells_[pos & mask_];
+      const std::size_t seq  = cell.sequence.load(std::memory_order_acquire);
+      const std::intptr_t df = static_cast<std::intptr_t>(seq) -
+                               static_cast<std::intptr_t>(pos + 1);
+      if (df == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          *out = cell.value;
+          cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (df < 0) {
+        return false;  // empty
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  std::size_t capacity() const {
+    return cells_ ? mask_ + 1 : 0;
+  }
+
+  // Racy snapshot; exact only when no push/pop is in flight.
+  std::size_t ApproxSize() const {
+    const std::size_t e = enqueue_pos_.load(std::memory_order_relaxed);
+    const std::size_t d = dequeue_pos_.load(std::memory_order_relaxed);
+    return e >= d ? e - d : 0;
+  }
+
+ private:
+  struct Cell {
+    std::atomic<std::size_t> sequence{0};
+    T value;
+  };
+
+  Cell* cells_;
+  std::size_t mask_;
+  alignas(kCacheLineBytes) std::atomic<std::size_t> enqueue_pos_;
+  alignas(kCacheLineBytes) std::atomic<std::size_t> dequeue_pos_;
+};
+
+}  // namespace navary::messaging
@@ -0,0 +1,120 @@
+#pragma once
+// Navary Engine - Messaging Subsystem
+// File: navary/messaging/spsc_queue.h
+// Purpose: Bounded wait-free single-producer / single-consumer ring.
+// Policy: C++20, Google style, no exceptions, no RTTI, header-only.
+//
+// Overview:
+//   - One thread pushes, one thread pops. Head and tail live on separate
+//     cache lines and each side caches the other's index, so the common
+//     case touches no shared line at all.
+//   - Capacity rounds up to a power of two; no allocation after Init().
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+
+#include "navary/messaging/mpmc_queue.h"
+#include "navary/navary_status.h"
+
+namespace navary::messaging {
+
+template <typename T>
+class SpscQueue {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "SpscQueue holds trivially copyable values");
+
+ public:
+  SpscQueue()
+      : slots_(nullptr),
+        mask_(0),
+        head_(0),
+        cached_tail_(0),
+        tail_(0),
+        cached_head_(0) {}
+
+  ~SpscQueue() {
+    Shutdown();
+  }
+
+  SpscQueue(const SpscQueue&)            = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  NavaryRC Init(std::size_t capacity) {
+    if (slots_ != nullptr) {
+      return NavaryRC(NavaryStatus::kInvalidArgument,
+                      "SpscQueue: already initialized");
+    }
+    std::size_t cap = 2;
+    while (cap < capacity) {
+      cap <<= 1;
+    }
+    slots_ = static_cast<T*>(std::malloc(sizeof(T) * cap));
+    if (slots_ == nullptr) {
+      return NavaryRC(NavaryStatus::kOutOfMemory, "SpscQueue: alloc failed");
+    }
+    mask_ = cap - 1;
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+    cached_head_ = 0;
+    cached_tail_ = 0;
+    return NavaryRC::OK();
+  }
+
+  void Shutdown() {
+    std::free(slots_);
+    slots_ = nullptr;
+    mask_  = 0;
+  }
+
+  // Producer thread only.
+  bool TryPush(const T& value) {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ > mask_) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ > mask_) {
+        return false;  // full
+      }
+    }
+    slots_[tail & mask_] = value;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer thread only.
+  bool TryPop(T* out) {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_) {
+        return false;  // empty
+      }
+    }
+    *out = slots_[head & mask_];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  std::size_t capacity() const {
+    return slots_ ? mask_ + 1 : 0;
+  }
+
+ private:
+  T* slots_;
+  std::size_t mask_;
+
+  // Consumer side.
+  alignas(kCacheLineBytes) std::atomic<std::size_t> head_;
+  std::size_t cached_tail_;
+
+  // Producer side.
+  alignas(kCacheLineBytes) std::atomic<std::size_t> tail_;
+  std::size_t cached_head_;
+};
+
+}  // namespace navary::messaging
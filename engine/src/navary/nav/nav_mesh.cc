@@ -0,0 +1,380 @@
+// Navary Engine - Navigation Subsystem
+// File: navary/nav/nav_mesh.cc
+// Purpose: NavMesh construction (winding, adjacency, lookup grid) and point
+//          queries.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/nav/nav_mesh.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace navary::nav {
+
+namespace {
+
+using math::Vec3;
+
+struct EdgeKey {
+  std::uint64_t key;  // (min vertex << 32) | max vertex
+  NavPolyRef poly;
+  std::uint32_t edge;
+};
+
+// 2D cross of (b - a) x (p - a) in XZ; > 0 when p is left of a->b with the
+// engine's counter-clockwise polygon winding.
+float CrossXZ(const Vec3& a, const Vec3& b, const Vec3& p) {
+  return (b.x - a.x) * (p.z - a.z) - (b.z - a.z) * (p.x - a.x);
+}
+
+Vec3 ClosestOnSegment(const Vec3& a, const Vec3& b, const Vec3& p) {
+  const Vec3 ab     = b - a;
+  const float denom = ab.length_sq();
+  float t           = denom > 0.0f ? (p - a).dot(ab) / denom : 0.0f;
+  t                 = std::clamp(t, 0.0f, 1.0f);
+  return a + ab * t;
+}
+
+}  // namespace
+
+NavMesh::NavMesh()
+    : vertices_(nullptr),
+      vertex_count_(0),
+      polys_(nullptr),
+      poly_count_(0),
+      grid_min_x_(0.0f),
+      grid_min_z_(0.0f),
+      inv_cell_(0.0f),
+      grid_w_(0),
+      grid_h_(0),
+      cell_start_(nullptr),
+      cell_polys_(nullptr) {}
+
+NavMesh::~NavMesh() {
+  Shutdown();
+}
+
+void NavMesh::Shutdown() {
+  std::free(vertices_);
+  std::free(polys_);
+  std::free(cell_start_);
+  std::free(cell_polys_);
+  vertices_     = nullptr;
+  polys_        = nullptr;
+  cell_start_   = nullptr;
+  cell_polys_   = nullptr;
+  vertex_count_ = 0;
+  poly_count_   = 0;
+  grid_w_       = 0;
+  grid_h_       = 0;
+}
+
+NavaryRC NavMesh::Init(const NavMeshDesc& desc) {
+  if (polys_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavMesh: already initialized");
+  }
+  if (desc.vertices == nullptr || desc.polys == nullptr ||
+      desc.poly_count == 0 || desc.cell_size <= 0.0f) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavMesh: empty or invalid descriptor");
+  }
+
+  vertices_ =
+      static_cast<Vec3*>(std::malloc(sizeof(Vec3) * desc.vertex_count));
+  polys_ =
+      static_cast<NavPoly*>(std::malloc(sizeof(NavPoly) * desc.poly_count));
+  if (vertices_ == nullptr || polys_ == nullptr) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kOutOfMemory, "NavMesh: alloc failed");
+  }
+  std::memcpy(vertices_, desc.vertices, sizeof(Vec3) * desc.vertex_count);
+  vertex_count_ = desc.vertex_count;
+  poly_count_   = desc.poly_count;
+
+  for (std::uint32_t p = 0; p < poly_count_; ++p) {
+    NavPoly& poly            = polys_[p];
+    const std::uint32_t* src = desc.polys + p * kMaxNavPolyVerts;
+    poly.vert_count          = 0;
+    while (poly.vert_count < kMaxNavPolyVerts &&
+           src[poly.vert_count] != kInvalidNavPoly) {
+      if (src[poly.vert_count] >= vertex_count_) {
+        Shutdown();
+        return NavaryRC(NavaryStatus::kInvalidArgument,
+                        "NavMesh: vertex index out of range");
+      }
+      poly.verts[poly.vert_count] = src[poly.vert_count];
+      ++poly.vert_count;
+    }
+    if (poly.vert_count < 3) {
+      Shutdown();
+      return NavaryRC(NavaryStatus::kInvalidArgument,
+                      "NavMesh: polygon with fewer than 3 vertices");
+    }
+
+    // Normalize to counter-clockwise in XZ.
+    float area2 = 0.0f;
+    for (std::uint32_t i = 0; i < poly.vert_count; ++i) {
+      const Vec3& a = vertices_[poly.verts[i]];
+      const Vec3& b = vertices_[poly.verts[(i + 1) % poly.vert_count]];
+      area2 += a.x * b.z - b.x * a.z;
+    }
+    if (area2 < 0.0f) {
+      std::reverse(poly.verts, poly.verts + poly.vert_count);
+    }
+
+    Vec3 sum(0.0f, 0.0f, 0.0f);
+    poly.min_x = poly.min_z = FLT_MAX;
+    poly.max_x = poly.max_z = -FLT_MAX;
+    for (std::uint32_t i = 0; i < poly.vert_count; ++i) {
+      const Vec3& v = vertices_[poly.verts[i]];
+      sum += v;
+      poly.min_x = std::min(poly.min_x, v.x);
+      poly.min_z = std::min(poly.min_z, v.z);
+      poly.max_x = std::max(poly.max_x, v.x);
+      poly.max_z = std::max(poly.max_z, v.z);
+    }
+    poly.center = sum / static_cast<float>(poly.vert_count);
+    for (NavPolyRef& n : poly.neighbors) {
+      n = kInvalidNavPoly;
+    }
+  }
+
+  if (!BuildAdjacency() || !BuildGrid(desc.cell_size)) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "NavMesh: adjacency/grid alloc failed");
+  }
+  return NavaryRC::OK();
+}
+
+bool NavMesh::BuildAdjacency() {
+  std::uint32_t edge_count = 0;
+  for (std::uint32_t p = 0; p < poly_count_; ++p) {
+    edge_count += polys_[p].vert_count;
+  }
+  auto* edges =
+      static_cast<EdgeKey*>(std::malloc(sizeof(EdgeKey) * edge_count));
+  if (edges == nullptr) {
+    return false;
+  }
+
+  std::uint32_t n = 0;
+  for (std::uint32_t p = 0; p < poly_count_; ++p) {
+    const NavPoly& poly = polys_[p];
+    for (std::uint32_t e = 0; e < poly.vert_count; ++e) {
+      const std::uint64_t a = poly.verts[e];
+      const std::uint64_t b = poly.verts[(e + 1) % poly.vert_count];
+      edges[n++] = EdgeKey{a < b ? (a << 32) | b : (b << 32) | a, p, e};
+    }
+  }
+  std::sort(edges, edges + n, [](const EdgeKey& l, const EdgeKey& r) {
+    return l.key < r.key;
+  });
+
+  // Manifold edges appear exactly twice; anything else is a border.
+  for (std::uint32_t i = 0; i + 1 < n;) {
+    if (edges[i].key == edges[i + 1].key &&
+        (i + 2 >= n || edges[i + 2].key != edges[i].key)) {
+      const EdgeKey& a = edges[i];
+      const EdgeKey& b = edges[i + 1];
+      polys_[a.poly].neighbors[a.edge] = b.poly;
+      polys_[b.poly].neighbors[b.edge] = a.poly;
+      i += 2;
+    } else {
+      ++i;
+    }
+  }
+  std::free(edges);
+  return true;
+}
+
+bool NavMesh::BuildGrid(float cell_size) {
+  float min_x = FLT_MAX;
+  float min_z = FLT_MAX;
+  float max_x = -FLT_MAX;
+  float max_z = -FLT_MAX;
+  for (std::uint32_t p = 0; p < poly_count_; ++p) {
+    min_x = std::min(min_x, polys_[p].min_x);
+    min_z = std::min(min_z, polys_[p].min_z);
+    max_x = std::max(max_x, polys_[p].max_x);
+    max_z = std::max(max_z, polys_[p].max_z);
+  }
+  grid_min_x_ = min_x;
+  grid_min_z_ = min_z;
+  inv_cell_   = 1.0f / cell_size;
+  grid_w_ = static_cast<std::uint32_t>((max_x - min_x) * inv_cell_) + 1;
+  grid_h_ = static_cast<std::uint32_t>((max_z - min_z) * inv_cell_) + 1;
+
+  const std::uint32_t cells = grid_w_ * grid_h_;
+  cell_start_ = static_cast<std::uint32_t*>(
+      std::calloc(cells + 1, sizeof(std::uint32_t)));
+  if (cell_start_ == nullptr) {
+    return false;
+  }
+
+  // Two passes (count, fill) into a CSR layout.
+  auto for_each_cell = [&](const NavPoly& poly, auto&& fn) {
+    const auto x0 =
+        static_cast<std::uint32_t>((poly.min_x - grid_min_x_) * inv_cell_);
+    const auto z0 =
+        static_cast<std::uint32_t>((poly.min_z - grid_min_z_) * inv_cell_);
+    const auto x1 = std::min(
+        grid_w_ - 1,
+        static_cast<std::uint32_t>((poly.max_x - grid_min_x_) * inv_cell_));
+    const auto z1 = std::min(
+        grid_h_ - 1,
+        static_cast<std::uint32_t>((poly.max_z - grid_min_z_) * inv_cell_));
+    for (std::uint32_t z = z0; z <= z1; ++z) {
+      for (std::uint32_t x = x0; x <= x1; ++x) {
+        fn(z * grid_w_ + x);
+      }
+    }
+  };
+
+  for (std::uint32_t p = 0; p < poly_count_; ++p) {
+    for_each_cell(polys_[p], [&](std::uint32_t c) { ++cell_start_[c + 1]; });
+  }
+  for (std::uint32_t c = 0; c < cells; ++c) {
+    cell_start_[c + 1] += cell_start_[c];
+  }
+  cell_polys_ = static_cast<NavPolyRef*>(
+      std::malloc(sizeof(NavPolyRef) * (cell_start_[cells] + 1)));
+  auto* fill = static_cast<std::uint32_t*>(
+      std::malloc(sizeof(std::uint32_t) * cells));
+  if (cell_polys_ == nullptr || fill == nullptr) {
+    std::free(fill);
+    return false;
+  }
+  std::memcpy(fill, cell_start_, sizeof(std::uint32_t) * cells);
+  for (std::uint32_t p = 0; p < poly_count_; ++p) {
+    for_each_cell(polys_[p],
+                  [&](std::uint32_t c) { cell_polys_[fill[c]++] = p; });
+  }
+  std::free(fill);
+  return true;
+}
+
+bool NavMesh::ContainsXZ(NavPolyRef ref, const Vec3& p) const {
+  const NavPoly& poly = polys_[ref];
+  for (std::uint32_t i = 0; i < poly.vert_count; ++i) {
+    const Vec3& a = vertices_[poly.verts[i]];
+    const Vec3& b = vertices_[poly.verts[(i + 1) % poly.vert_count]];
+    if (CrossXZ(a, b, p) < 0.0f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Vec3 NavMesh::ClosestPointOnPoly(NavPolyRef ref, const Vec3& p) const {
+  const NavPoly& poly = polys_[ref];
+  if (ContainsXZ(ref, p)) {
+    // Height from the fan triangle (center, v_i, v_i+1) under p.
+    for (std::uint32_t i = 0; i < poly.vert_count; ++i) {
+      const Vec3& a = vertices_[poly.verts[i]];
+      const Vec3& b = vertices_[poly.verts[(i + 1) % poly.vert_count]];
+      const Vec3& c = poly.center;
+      const float d = CrossXZ(c, a, b);
+      if (std::fabs(d) < 1e-12f) {
+        continue;
+      }
+      const float u = CrossXZ(a, b, p) / d;
+      const float v = CrossXZ(b, c, p) / d;
+      const float w = 1.0f - u - v;
+      if (u >= -1e-5f && v >= -1e-5f && w >= -1e-5f) {
+        return Vec3(p.x, u * c.y + v * a.y + w * b.y, p.z);
+      }
+    }
+    return Vec3(p.x, poly.center.y, p.z);
+  }
+
+  Vec3 best;
+  float best_d = FLT_MAX;
+  for (std::uint32_t i = 0; i < poly.vert_count; ++i) {
+    const Vec3 q = ClosestOnSegment(
+        vertices_[poly.verts[i]],
+        vertices_[poly.verts[(i + 1) % poly.vert_count]], p);
+    const float d = (q - p).length_sq();
+    if (d < best_d) {
+      best_d = d;
+      best   = q;
+    }
+  }
+  return best;
+}
+
+NavPolyRef NavMesh::FindNearestPoly(const Vec3& p, float search_radius,
+                                    Vec3* out_point) const {
+  if (polys_ == nullptr) {
+    return kInvalidNavPoly;
+  }
+  const auto cell_of = [this](float v, float origin, std::uint32_t limit) {
+    const float c = (v - origin) * inv_cell_;
+    if (c <= 0.0f) {
+      return 0u;
+    }
+    return std::min(limit - 1, static_cast<std::uint32_t>(c));
+  };
+  const std::uint32_t x0 = cell_of(p.x - search_radius, grid_min_x_, grid_w_);
+  const std::uint32_t x1 = cell_of(p.x + search_radius, grid_min_x_, grid_w_);
+  const std::uint32_t z0 = cell_of(p.z - search_radius, grid_min_z_, grid_h_);
+  const std::uint32_t z1 = cell_of(p.z + search_radius, grid_min_z_, grid_h_);
+
+  NavPolyRef best  = kInvalidNavPoly;
+  float best_d     = search_radius * search_radius;
+  bool best_inside = false;
+  Vec3 best_point  = p;
+  for (std::uint32_t z = z0; z <= z1; ++z) {
+    for (std::uint32_t x = x0; x <= x1; ++x) {
+      const std::uint32_t c = z * grid_w_ + x;
+      for (std::uint32_t i = cell_start_[c]; i < cell_start_[c + 1]; ++i) {
+        const NavPolyRef ref = cell_polys_[i];
+        const NavPoly& poly  = polys_[ref];
+        if (p.x < poly.min_x - search_radius ||
+            p.x > poly.max_x + search_radius ||
+            p.z < poly.min_z - search_radius ||
+            p.z > poly.max_z + search_radius) {
+          continue;
+        }
+        const bool inside = ContainsXZ(ref, p);
+        const Vec3 q      = ClosestPointOnPoly(ref, p);
+        const float d     = (q - p).length_sq();
+        // Inside-XZ hits win over edge hits; among them, closest in Y.
+        if ((inside && !best_inside) ||
+            (inside == best_inside && d <= best_d)) {
+          best        = ref;
+          best_d      = d;
+          best_inside = inside;
+          best_point  = q;
+        }
+      }
+    }
+  }
+  if (out_point != nullptr && best != kInvalidNavPoly) {
+    *out_point = best_point;
+  }
+  return best;
+}
+
+bool NavMesh::PortalPoints(NavPolyRef from, NavPolyRef to, Vec3* left,
+                           Vec3* right) const {
+  const NavPoly& poly = polys_[from];
+  for (std::uint32_t e = 0; e < poly.vert_count; ++e) {
+    if (poly.neighbors[e] == to) {
+      // Leaving a counter-clockwise polygon, the edge end is on the left.
+      *right = vertices_[poly.verts[e]];
+      *left  = vertices_[poly.verts[(e + 1) % poly.vert_count]];
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace navary::nav
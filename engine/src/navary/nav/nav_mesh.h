@@ -0,0 +1,108 @@
+#pragma once
+// Navary Engine - Navigation Subsystem
+// File: navary/nav/nav_mesh.h
+// Purpose: Convex-polygon navigation mesh with edge adjacency and a uniform
+//          XZ lookup grid.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - Input is a vertex array plus polygons of up to kMaxNavPolyVerts
+//     indices (Y up). Winding is normalized at Init(); neighbors are found
+//     by matching shared edges.
+//   - FindNearestPoly() buckets polygon bounds into a grid so lookups touch
+//     a handful of polygons regardless of mesh size.
+//   - Immutable after Init(), so any number of NavQuery objects may read it
+//     concurrently.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/math/vec3.h"
+#include "navary/navary_status.h"
+
+namespace navary::nav {
+
+using NavPolyRef = std::uint32_t;
+
+inline constexpr NavPolyRef kInvalidNavPoly     = 0xFFFFFFFFu;
+inline constexpr std::uint32_t kMaxNavPolyVerts = 6;
+
+struct NavMeshDesc {
+  const math::Vec3* vertices = nullptr;
+  std::uint32_t vertex_count = 0;
+  // poly_count * kMaxNavPolyVerts indices; unused tail entries hold
+  // kInvalidNavPoly. Polygons must be convex with at least 3 vertices.
+  const std::uint32_t* polys = nullptr;
+  std::uint32_t poly_count   = 0;
+  float cell_size            = 4.0f;  // lookup grid cell, world units
+};
+
+struct NavPoly {
+  std::uint32_t verts[kMaxNavPolyVerts];
+  NavPolyRef neighbors[kMaxNavPolyVerts];  // across edge i -> i + 1
+  std::uint32_t vert_count;
+  math::Vec3 center;
+  float min_x, min_z, max_x, max_z;
+};
+
+class NavMesh {
+ public:
+  NavMesh();
+  ~NavMesh();
+
+  NavMesh(const NavMesh&)            = delete;
+  NavMesh& operator=(const NavMesh&) = delete;
+
+  NavaryRC Init(const NavMeshDesc& desc);
+  void Shutdown();
+
+  // Polygon containing |p| in XZ (closest in Y when stacked), else the
+  // polygon whose boundary is nearest within |search_radius|.
+  // kInvalidNavPoly when nothing is in range. |out_point| (optional)
+  // receives |p| clamped onto the polygon.
+  NavPolyRef FindNearestPoly(const math::Vec3& p, float search_radius,
+                             math::Vec3* out_point = nullptr) const;
+
+  // Shared edge between adjacent |from| and |to|, as seen walking from
+  // |from| into |to|. False if they are not neighbors.
+  bool PortalPoints(NavPolyRef from, NavPolyRef to, math::Vec3* left,
+                    math::Vec3* right) const;
+
+  // True when |p| projects inside |ref| in XZ.
+  bool ContainsXZ(NavPolyRef ref, const math::Vec3& p) const;
+
+  const NavPoly& poly(NavPolyRef ref) const {
+    return polys_[ref];
+  }
+  const math::Vec3& vertex(std::uint32_t i) const {
+    return vertices_[i];
+  }
+  std::uint32_t poly_count() const {
+    return poly_count_;
+  }
+  bool valid() const {
+    return polys_ != nullptr;
+  }
+
+ private:
+  bool BuildAdjacency();
+  bool BuildGrid(float cell_size);
+  math::Vec3 ClosestPointOnPoly(NavPolyRef ref, const math::Vec3& p) const;
+
+  math::Vec3* vertices_;
+  std::uint32_t vertex_count_;
+  NavPoly* polys_;
+  std::uint32_t poly_count_;
+
+  float grid_min_x_;
+  float grid_min_z_;
+  float inv_cell_;
+  std::uint32_t grid_w_;
+  std::uint32_t grid_h_;
+  std::uint32_t* cell_start_;  // grid_w_ * grid_h_ + 1 offsets
+  NavPolyRef* cell_polys_;
+};
+
+}  // namespace navary::nav
@@ -0,0 +1,360 @@
+// Navary Engine - Navigation Subsystem
+// File: navary/nav/nav_query.cc
+// Purpose: NavQuery A* search and funnel implementation.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/nav/nav_query.h"
+
+#include <cstdlib>
+
+namespace navary::nav {
+
+namespace {
+
+using math::Vec3;
+
+// Twice the signed XZ area of (a, b, c); > 0 when c lies clockwise
+// (to the right) of a -> b.
+float TriArea2(const Vec3& a, const Vec3& b, const Vec3& c) {
+  const float abx = b.x - a.x;
+  const float abz = b.z - a.z;
+  const float acx = c.x - a.x;
+  const float acz = c.z - a.z;
+  return acx * abz - abx * acz;
+}
+
+bool EqualXZ(const Vec3& a, const Vec3& b) {
+  const float dx = a.x - b.x;
+  const float dz = a.z - b.z;
+  return dx * dx + dz * dz < 1e-6f * 1e-6f;
+}
+
+// Keeps the heuristic marginally below the true remaining cost so ties
+// resolve toward nodes already close to the goal.
+constexpr float kHeuristicScale = 0.999f;
+
+}  // namespace
+
+NavQuery::NavQuery()
+    : mesh_(nullptr),
+      nodes_(nullptr),
+      heap_(nullptr),
+      heap_capacity_(0),
+      heap_size_(0),
+      generation_(0),
+      start_ref_(kInvalidNavPoly),
+      end_ref_(kInvalidNavPoly),
+      end_pos_(),
+      best_ref_(kInvalidNavPoly),
+      best_h_(0.0f),
+      status_(NavQueryStatus::kFailure) {}
+
+NavQuery::~NavQuery() {
+  Shutdown();
+}
+
+NavaryRC NavQuery::Init(const NavMesh* mesh) {
+  if (nodes_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavQuery: already initialized");
+  }
+  if (mesh == nullptr || !mesh->valid()) {
+    return NavaryRC(NavaryStatus::kInvalidArgument, "NavQuery: invalid mesh");
+  }
+
+  // With lazy deletion every relaxed edge may push once, plus the start.
+  std::uint32_t edges = 1;
+  for (NavPolyRef p = 0; p < mesh->poly_count(); ++p) {
+    edges += mesh->poly(p).vert_count;
+  }
+  nodes_ =
+      static_cast<Node*>(std::calloc(mesh->poly_count(), sizeof(Node)));
+  heap_ = static_cast<HeapEntry*>(std::malloc(sizeof(HeapEntry) * edges));
+  if (nodes_ == nullptr || heap_ == nullptr) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kOutOfMemory, "NavQuery: alloc failed");
+  }
+  mesh_          = mesh;
+  heap_capacity_ = edges;
+  heap_size_     = 0;
+  generation_    = 0;
+  status_        = NavQueryStatus::kFailure;
+  return NavaryRC::OK();
+}
+
+void NavQuery::Shutdown() {
+  std::free(nodes_);
+  std::free(heap_);
+  nodes_         = nullptr;
+  heap_          = nullptr;
+  mesh_          = nullptr;
+  heap_capacity_ = 0;
+  heap_size_     = 0;
+  status_        = NavQueryStatus::kFailure;
+}
+
+void NavQuery::Push(float f, NavPolyRef ref) {
+  std::uint32_t i = heap_size_++;
+  while (i > 0) {
+    const std::uint32_t parent = (i - 1) / 2;
+    if (heap_[parent].f <= f) {
+      break;
+    }
+    heap_[i] = heap_[parent];
+    i        = parent;
+  }
+  heap_[i] = HeapEntry{f, ref};
+}
+
+NavQuery::HeapEntry NavQuery::Pop() {
+  const HeapEntry top  = heap_[0];
+  const HeapEntry last = heap_[--heap_size_];
+  std::uint32_t i      = 0;
+  for (;;) {
+    std::uint32_t child = i * 2 + 1;
+    if (child >= heap_size_) {
+      break;
+    }
+    if (child + 1 < heap_size_ && heap_[child + 1].f < heap_[child].f) {
+      ++child;
+    }
+    if (last.f <= heap_[child].f) {
+      break;
+    }
+    heap_[i] = heap_[child];
+    i        = child;
+  }
+  heap_[i] = last;
+  return top;
+}
+
+NavQueryStatus NavQuery::BeginPath(NavPolyRef start_ref, NavPolyRef end_ref,
+                                   const Vec3& start_pos,
+                                   const Vec3& end_pos) {
+  if (nodes_ == nullptr || start_ref >= mesh_->poly_count() ||
+      end_ref >= mesh_->poly_count()) {
+    status_ = NavQueryStatus::kFailure;
+    return status_;
+  }
+
+  if (++generation_ == 0) {
+    // Stamp wrapped: old stamps could alias, so clear once.
+    for (NavPolyRef p = 0; p < mesh_->poly_count(); ++p) {
+      nodes_[p].stamp = 0;
+    }
+    generation_ = 1;
+  }
+  start_ref_ = start_ref;
+  end_ref_   = end_ref;
+  end_pos_   = end_pos;
+  heap_size_ = 0;
+
+  Node& start  = nodes_[start_ref];
+  start.pos    = start_pos;
+  start.g      = 0.0f;
+  start.parent = kInvalidNavPoly;
+  start.stamp  = generation_;
+  start.closed = false;
+  best_ref_    = start_ref;
+  best_h_      = (end_pos - start_pos).length();
+  Push(best_h_ * kHeuristicScale, start_ref);
+
+  status_ = NavQueryStatus::kInProgress;
+  return status_;
+}
+
+NavQueryStatus NavQuery::Step(std::uint32_t max_iterations,
+                              std::uint32_t* out_iterations) {
+  std::uint32_t iterations = 0;
+  while (status_ == NavQueryStatus::kInProgress &&
+         iterations < max_iterations) {
+    if (heap_size_ == 0) {
+      status_ = NavQueryStatus::kPartial;
+      break;
+    }
+    const HeapEntry top = Pop();
+    Node& cur           = nodes_[top.ref];
+    if (cur.closed) {
+      continue;  // stale entry superseded by a cheaper push
+    }
+    cur.closed = true;
+    ++iterations;
+
+    if (top.ref == end_ref_) {
+      best_ref_ = end_ref_;
+      status_   = NavQueryStatus::kSuccess;
+      break;
+    }
+
+    const NavPoly& poly = mesh_->poly(top.ref);
+    for (std::uint32_t e = 0; e < poly.vert_count; ++e) {
+      const NavPolyRef next_ref = poly.neighbors[e];
+      if (next_ref == kInvalidNavPoly || next_ref == cur.parent) {
+        continue;
+      }
+      Node& next = nodes_[next_ref];
+      if (next.stamp == generation_ && next.closed) {
+        continue;
+      }
+
+      const Vec3 portal_mid =
+          (mesh_->vertex(poly.verts[e]) +
+           mesh_->vertex(poly.verts[(e + 1) % poly.vert_count])) *
+          0.5f;
+      float g = cur.g + (portal_mid - cur.pos).length();
+      if (next_ref == end_ref_) {
+        g += (end_pos_ - portal_mid).length();
+      }
+      if (next.stamp == generation_ && next.g <= g) {
+        continue;
+      }
+
+      next.pos    = portal_mid;
+      next.g      = g;
+      next.parent = top.ref;
+      next.stamp  = generation_;
+      next.closed = false;
+
+      const float h =
+          next_ref == end_ref_ ? 0.0f : (end_pos_ - portal_mid).length();
+      if (h < best_h_) {
+        best_h_   = h;
+        best_ref_ = next_ref;
+      }
+      Push(g + h * kHeuristicScale, next_ref);
+    }
+  }
+  if (out_iterations != nullptr) {
+    *out_iterations = iterations;
+  }
+  return status_;
+}
+
+std::uint32_t NavQuery::FinishPath(NavPolyRef* out,
+                                   std::uint32_t max_count) const {
+  if (nodes_ == nullptr || status_ == NavQueryStatus::kFailure ||
+      max_count == 0) {
+    return 0;
+  }
+  std::uint32_t length = 0;
+  for (NavPolyRef r = best_ref_; r != kInvalidNavPoly; r = nodes_[r].parent) {
+    ++length;
+  }
+  // Walk back from the tail, keeping only the first |max_count| polys.
+  std::uint32_t i = length;
+  for (NavPolyRef r = best_ref_; r != kInvalidNavPoly; r = nodes_[r].parent) {
+    if (--i < max_count) {
+      out[i] = r;
+    }
+  }
+  return length < max_count ? length : max_count;
+}
+
+NavQueryStatus NavQuery::FindPath(NavPolyRef start_ref, NavPolyRef end_ref,
+                                  const Vec3& start_pos, const Vec3& end_pos,
+                                  NavPolyRef* out, std::uint32_t max_count,
+                                  std::uint32_t* out_count,
+                                  std::uint32_t max_iterations) {
+  *out_count = 0;
+  if (BeginPath(start_ref, end_ref, start_pos, end_pos) ==
+      NavQueryStatus::kFailure) {
+    return status_;
+  }
+  NavQueryStatus status = Step(max_iterations);
+  if (status == NavQueryStatus::kInProgress) {
+    status = NavQueryStatus::kPartial;
+  }
+  *out_count = FinishPath(out, max_count);
+  return status;
+}
+
+std::uint32_t NavQuery::StraightPath(const NavMesh& mesh, const Vec3& start,
+                                     const Vec3& end,
+                                     const NavPolyRef* corridor,
+                                     std::uint32_t corridor_count,
+                                     Vec3* out_points,
+                                     std::uint32_t max_points) {
+  if (corridor_count == 0 || max_points == 0) {
+    return 0;
+  }
+
+  // Portal i sits between corridor[i - 1] and corridor[i]; portal 0 is the
+  // start point and portal corridor_count the end point.
+  auto portal = [&](std::uint32_t i, Vec3* left, Vec3* right) {
+    if (i == 0) {
+      *left = *right = start;
+    } else if (i >= corridor_count ||
+               !mesh.PortalPoints(corridor[i - 1], corridor[i], left, right)) {
+      *left = *right = end;
+    }
+  };
+
+  std::uint32_t count = 0;
+  out_points[count++] = start;
+
+  Vec3 apex                 = start;
+  Vec3 portal_left          = start;
+  Vec3 portal_right         = start;
+  std::uint32_t apex_index  = 0;
+  std::uint32_t left_index  = 0;
+  std::uint32_t right_index = 0;
+
+  for (std::uint32_t i = 1; i <= corridor_count && count < max_points; ++i) {
+    Vec3 left;
+    Vec3 right;
+    portal(i, &left, &right);
+
+    // Narrow the right side.
+    if (TriArea2(apex, portal_right, right) <= 0.0f) {
+      if (EqualXZ(apex, portal_right) ||
+          TriArea2(apex, portal_left, right) > 0.0f) {
+        portal_right = right;
+        right_index  = i;
+      } else {
+        // Right crossed over left: the left point becomes a corner.
+        apex = portal_left;
+        if (!EqualXZ(out_points[count - 1], apex)) {
+          out_points[count++] = apex;
+        }
+        apex_index   = left_index;
+        portal_left  = apex;
+        portal_right = apex;
+        left_index   = apex_index;
+        right_index  = apex_index;
+        i            = apex_index;
+        continue;
+      }
+    }
+
+    // Narrow the left side.
+    if (TriArea2(apex, portal_left, left) >= 0.0f) {
+      if (EqualXZ(apex, portal_left) ||
+          TriArea2(apex, portal_right, left) < 0.0f) {
+        portal_left = left;
+        left_index  = i;
+      } else {
+        apex = portal_right;
+        if (!EqualXZ(out_points[count - 1], apex)) {
+          out_points[count++] = apex;
+        }
+        apex_index   = right_index;
+        portal_left  = apex;
+        portal_right = apex;
+        left_index   = apex_index;
+        right_index  = apex_index;
+        i            = apex_index;
+        continue;
+      }
+    }
+  }
+
+  if (count < max_points && !EqualXZ(out_points[count - 1], end)) {
+    out_points[count++] = end;
+  }
+  return count;
+}
+
+}  // namespace navary::nav
@@ -0,0 +1,121 @@
+#pragma once
+// Navary Engine - Navigation Subsystem
+// File: navary/nav/nav_query.h
+// Purpose: A* over NavMesh polygons (sliceable) and funnel string pulling.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - Nodes are polygons; a node's position is the midpoint of the portal
+//     it was entered through, costs are Euclidean distances between those
+//     points and the heuristic is the distance to the goal.
+//   - BeginPath/Step/FinishPath run the search in bounded slices so long
+//     queries can spread over frames; FindPath is the one-shot form.
+//   - Per-polygon node state is stamped with a search generation, so a new
+//     search costs O(1) instead of clearing poly_count entries.
+//   - When the goal is unreachable (or the caller stops early) the result
+//     is a partial corridor to the node closest to the goal.
+//
+// Notes:
+//   - One NavQuery per thread; the mesh is shared read-only.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/math/vec3.h"
+#include "navary/nav/nav_mesh.h"
+#include "navary/navary_status.h"
+
+namespace navary::nav {
+
+enum class NavQueryStatus : std::uint8_t {
+  kInProgress = 0,
+  kSuccess,  // corridor reaches the goal polygon
+  kPartial,  // corridor ends at the polygon closest to the goal
+  kFailure,  // invalid input, nothing searched
+};
+
+class NavQuery {
+ public:
+  NavQuery();
+  ~NavQuery();
+
+  NavQuery(const NavQuery&)            = delete;
+  NavQuery& operator=(const NavQuery&) = delete;
+
+  // Sizes node storage for |mesh|, which must outlive the query.
+  NavaryRC Init(const NavMesh* mesh);
+  void Shutdown();
+
+  // Starts a search; returns kInProgress, or kFailure for invalid refs.
+  NavQueryStatus BeginPath(NavPolyRef start_ref, NavPolyRef end_ref,
+                           const math::Vec3& start_pos,
+                           const math::Vec3& end_pos);
+
+  // Expands up to |max_iterations| nodes. Returns kInProgress while work
+  // remains, else the final status. |out_iterations| is optional.
+  NavQueryStatus Step(std::uint32_t max_iterations,
+                      std::uint32_t* out_iterations = nullptr);
+
+  // Writes the corridor (start .. goal or closest) and returns its length,
+  // truncated to |max_count| from the start. Callable mid-search, which
+  // yields the current best partial corridor.
+  std::uint32_t FinishPath(NavPolyRef* out, std::uint32_t max_count) const;
+
+  // BeginPath + Step(max_iterations) + FinishPath. A search that runs out
+  // of iterations returns kPartial.
+  NavQueryStatus FindPath(NavPolyRef start_ref, NavPolyRef end_ref,
+                          const math::Vec3& start_pos,
+                          const math::Vec3& end_pos, NavPolyRef* out,
+                          std::uint32_t max_count, std::uint32_t* out_count,
+                          std::uint32_t max_iterations = 0xFFFFFFFFu);
+
+  // Funnel (simple stupid funnel) over |corridor| in XZ. Writes corner
+  // points including |start| and |end|, truncated to |max_points|, and
+  // returns the count. |end| is clamped by the caller onto the last poly.
+  static std::uint32_t StraightPath(const NavMesh& mesh,
+                                    const math::Vec3& start,
+                                    const math::Vec3& end,
+                                    const NavPolyRef* corridor,
+                                    std::uint32_t corridor_count,
+                                    math::Vec3* out_points,
+                                    std::uint32_t max_points);
+
+  NavQueryStatus status() const {
+    return status_;
+  }
+
+ private:
+  struct Node {
+    math::Vec3 pos;
+    float g;
+    NavPolyRef parent;
+    std::uint32_t stamp;  // == generation_ when touched by this search
+    bool closed;
+  };
+
+  struct HeapEntry {
+    float f;
+    NavPolyRef ref;
+  };
+
+  void Push(float f, NavPolyRef ref);
+  HeapEntry Pop();
+
+  const NavMesh* mesh_;
+  Node* nodes_;  // one per polygon
+  HeapEntry* heap_;
+  std::uint32_t heap_capacity_;
+  std::uint32_t heap_size_;
+  std::uint32_t generation_;
+
+  NavPolyRef start_ref_;
+  NavPolyRef end_ref_;
+  math::Vec3 end_pos_;
+  NavPolyRef best_ref_;  // lowest heuristic seen
+  float best_h_;
+  NavQueryStatus status_;
+};
+
+}  // namespace navary::nav
@@ -0,0 +1,572 @@
+// Navary Engine - Navigation Subsystem
+// File: navary/nav/nav_service.cc
+// Purpose: NavService request batching, path cache and sliced searches.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/nav/nav_service.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace navary::nav {
+
+namespace {
+
+using math::Vec3;
+
+std::uint32_t CacheHash(NavPolyRef start_ref, NavPolyRef end_ref) {
+  std::uint64_t h = (static_cast<std::uint64_t>(start_ref) << 32) | end_ref;
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDull;
+  h ^= h >> 33;
+  return static_cast<std::uint32_t>(h);
+}
+
+}  // namespace
+
+NavService::NavService()
+    : desc_(),
+      mesh_(nullptr),
+      jobs_(nullptr),
+      slots_(nullptr),
+      free_slots_(nullptr),
+      free_count_(0),
+      corridors_(nullptr),
+      points_(nullptr),
+      queue_head_(kNoSlot),
+      queue_tail_(kNoSlot),
+      work_(nullptr),
+      fresh_count_(0),
+      work_count_(0),
+      worker_queries_(nullptr),
+      worker_count_(0),
+      sliced_(nullptr),
+      cache_(nullptr),
+      cache_corridors_(nullptr),
+      cache_sets_(0),
+      update_index_(0),
+      stats_{} {}
+
+NavService::~NavService() {
+  Shutdown();
+}
+
+NavaryRC NavService::Init(const NavServiceDesc& desc, const NavMesh* mesh,
+                          core::scheduler::JobSystem* jobs) {
+  if (slots_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavService: already initialized");
+  }
+  if (mesh == nullptr || !mesh->valid() || desc.max_requests == 0 ||
+      desc.max_requests > 0xFFFF || desc.max_path_polys == 0 ||
+      desc.max_path_points < 2 || desc.max_requests_per_update == 0 ||
+      desc.iterations_per_request == 0 || desc.slice_iterations == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "NavService: invalid descriptor");
+  }
+  desc_         = desc;
+  mesh_         = mesh;
+  jobs_         = jobs;
+  worker_count_ = jobs != nullptr ? jobs->thread_count() : 1;
+
+  const std::uint32_t n = desc.max_requests;
+  cache_sets_ = (desc.cache_capacity + kCacheWays - 1) / kCacheWays;
+  const std::uint32_t cache_entries = cache_sets_ * kCacheWays;
+
+  slots_          = new (std::nothrow) Slot[n];
+  worker_queries_ = new (std::nothrow) NavQuery[worker_count_];
+  if (desc.max_sliced > 0) {
+    sliced_ = new (std::nothrow) SlicedQuery[desc.max_sliced];
+  }
+  free_slots_ =
+      static_cast<std::uint32_t*>(std::malloc(sizeof(std::uint32_t) * n));
+  work_ = static_cast<std::uint32_t*>(
+      std::malloc(sizeof(std::uint32_t) *
+                  (desc.max_requests_per_update + desc.max_sliced)));
+  corridors_ = static_cast<NavPolyRef*>(
+      std::malloc(sizeof(NavPolyRef) * n * desc.max_path_polys));
+  points_ =
+      static_cast<Vec3*>(std::malloc(sizeof(Vec3) * n * desc.max_path_points));
+  if (cache_entries > 0) {
+    cache_ = static_cast<CacheEntry*>(
+        std::calloc(cache_entries, sizeof(CacheEntry)));
+    cache_corridors_ = static_cast<NavPolyRef*>(std::malloc(
+        sizeof(NavPolyRef) * cache_entries * desc.max_path_polys));
+  }
+  const bool cache_ok =
+      cache_entries == 0 || (cache_ != nullptr && cache_corridors_ != nullptr);
+  if (slots_ == nullptr || worker_queries_ == nullptr ||
+      (desc.max_sliced > 0 && sliced_ == nullptr) || free_slots_ == nullptr ||
+      work_ == nullptr || corridors_ == nullptr || points_ == nullptr ||
+      !cache_ok) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kOutOfMemory, "NavService: alloc failed");
+  }
+
+  NavaryRC rc = NavaryRC::OK();
+  for (std::uint32_t i = 0; rc.ok() && i < worker_count_; ++i) {
+    rc = worker_queries_[i].Init(mesh);
+  }
+  for (std::uint32_t i = 0; rc.ok() && i < desc.max_sliced; ++i) {
+    rc              = sliced_[i].query.Init(mesh);
+    sliced_[i].slot = kNoSlice;
+  }
+  if (!rc.ok()) {
+    Shutdown();
+    return rc;
+  }
+
+  for (std::uint32_t i = 0; i < n; ++i) {
+    Slot& slot      = slots_[i];
+    slot.generation = 1;
+    slot.state      = NavPathState::kInvalid;
+    slot.outcome    = Outcome::kNone;
+    slot.sliced     = kNoSlice;
+    slot.queue_prev = kNoSlot;
+    slot.queue_next = kNoSlot;
+    free_slots_[i]  = n - 1 - i;  // hand out low slots first
+  }
+  free_count_   = n;
+  queue_head_   = kNoSlot;
+  queue_tail_   = kNoSlot;
+  update_index_ = 0;
+  stats_        = NavServiceStats{};
+  return NavaryRC::OK();
+}
+
+void NavService::Shutdown() {
+  delete[] slots_;
+  delete[] worker_queries_;
+  delete[] sliced_;
+  std::free(free_slots_);
+  std::free(work_);
+  std::free(corridors_);
+  std::free(points_);
+  std::free(cache_);
+  std::free(cache_corridors_);
+  slots_           = nullptr;
+  worker_queries_  = nullptr;
+  sliced_          = nullptr;
+  free_slots_      = nullptr;
+  work_            = nullptr;
+  corridors_       = nullptr;
+  points_          = nullptr;
+  cache_           = nullptr;
+  cache_corridors_ = nullptr;
+  cache_sets_      = 0;
+  free_count_      = 0;
+  queue_head_      = kNoSlot;
+  queue_tail_      = kNoSlot;
+  worker_count_    = 0;
+  mesh_            = nullptr;
+  jobs_            = nullptr;
+}
+
+NavPathId NavService::MakeId(std::uint32_t slot_index) const {
+  return (static_cast<NavPathId>(slots_[slot_index].generation) << 16) |
+         slot_index;
+}
+
+NavService::Slot* NavService::Resolve(NavPathId id) {
+  const std::uint32_t index = id & 0xFFFF;
+  if (slots_ == nullptr || index >= desc_.max_requests) {
+    return nullptr;
+  }
+  Slot& slot = slots_[index];
+  return slot.state != NavPathState::kInvalid && MakeId(index) == id ? &slot
+                                                                     : nullptr;
+}
+
+const NavService::Slot* NavService::Resolve(NavPathId id) const {
+  return const_cast<NavService*>(this)->Resolve(id);
+}
+
+NavPolyRef* NavService::SlotCorridor(std::uint32_t slot_index) const {
+  return corridors_ + slot_index * desc_.max_path_polys;
+}
+
+Vec3* NavService::SlotPoints(std::uint32_t slot_index) const {
+  return points_ + slot_index * desc_.max_path_points;
+}
+
+void NavService::Enqueue(std::uint32_t slot_index) {
+  Slot& slot      = slots_[slot_index];
+  slot.queue_prev = queue_tail_;
+  slot.queue_next = kNoSlot;
+  if (queue_tail_ != kNoSlot) {
+    slots_[queue_tail_].queue_next = slot_index;
+  } else {
+    queue_head_ = slot_index;
+  }
+  queue_tail_ = slot_index;
+}
+
+void NavService::Unlink(std::uint32_t slot_index) {
+  Slot& slot = slots_[slot_index];
+  if (slot.queue_prev != kNoSlot) {
+    slots_[slot.queue_prev].queue_next = slot.queue_next;
+  } else {
+    queue_head_ = slot.queue_next;
+  }
+  if (slot.queue_next != kNoSlot) {
+    slots_[slot.queue_next].queue_prev = slot.queue_prev;
+  } else {
+    queue_tail_ = slot.queue_prev;
+  }
+  slot.queue_prev = kNoSlot;
+  slot.queue_next = kNoSlot;
+}
+
+NavaryResult<NavPathId> NavService::RequestPath(
+    const NavPathRequest& request) {
+  if (slots_ == nullptr) {
+    return NavaryResult<NavPathId>(NavaryRC(NavaryStatus::kInvalidArgument,
+                                            "NavService: not initialized"));
+  }
+  if (free_count_ == 0) {
+    return NavaryResult<NavPathId>(
+        NavaryRC(NavaryStatus::kOutOfMemory, "NavService: no free request"));
+  }
+  const std::uint32_t index = free_slots_[--free_count_];
+  Slot& slot                = slots_[index];
+  slot.state                = NavPathState::kQueued;
+  slot.outcome              = Outcome::kNone;
+  slot.request              = request;
+  slot.sliced               = kNoSlice;
+  slot.corridor_count       = 0;
+  slot.point_count          = 0;
+
+  Enqueue(index);
+  ++stats_.requests;
+  return NavaryResult<NavPathId>(MakeId(index));
+}
+
+void NavService::Release(NavPathId id) {
+  Slot* slot = Resolve(id);
+  if (slot == nullptr) {
+    return;
+  }
+  const std::uint32_t index = id & 0xFFFF;
+  if (slot->state == NavPathState::kQueued) {
+    Unlink(index);
+  }
+  if (slot->sliced != kNoSlice) {
+    sliced_[slot->sliced].slot = kNoSlice;
+    slot->sliced               = kNoSlice;
+  }
+  slot->state = NavPathState::kInvalid;
+  slot->rn_spline.Clear();
+  slot->tn_spline.Clear();
+  if (++slot->generation == 0) {
+    slot->generation = 1;
+  }
+  free_slots_[free_count_++] = index;
+}
+
+NavPathState NavService::state(NavPathId id) const {
+  const Slot* slot = Resolve(id);
+  return slot != nullptr ? slot->state : NavPathState::kInvalid;
+}
+
+bool NavService::GetPath(NavPathId id, NavPath* out) const {
+  const Slot* slot = Resolve(id);
+  if (slot == nullptr || slot->state != NavPathState::kReady) {
+    return false;
+  }
+  const std::uint32_t index = id & 0xFFFF;
+  out->status               = slot->status;
+  out->from_cache           = slot->from_cache;
+  out->corridor             = SlotCorridor(index);
+  out->corridor_count       = slot->corridor_count;
+  out->points               = SlotPoints(index);
+  out->point_count          = slot->point_count;
+  out->spline_kind          = slot->request.spline;
+  out->rn_spline =
+      slot->request.spline == NavSplineKind::kRn ? &slot->rn_spline : nullptr;
+  out->tn_spline =
+      slot->request.spline == NavSplineKind::kTn ? &slot->tn_spline : nullptr;
+  return true;
+}
+
+// ---------------------------------------------------------------------------
+// Cache
+// ---------------------------------------------------------------------------
+
+bool NavService::CacheLookup(NavPolyRef start_ref, NavPolyRef end_ref,
+                             NavPolyRef* out, std::uint32_t* out_count) const {
+  if (cache_sets_ == 0) {
+    return false;
+  }
+  const std::uint32_t set = CacheHash(start_ref, end_ref) % cache_sets_;
+  for (std::uint32_t w = 0; w < kCacheWays; ++w) {
+    const std::uint32_t e   = set * kCacheWays + w;
+    const CacheEntry& entry = cache_[e];
+    if (entry.count != 0 && entry.start_ref == start_ref &&
+        entry.end_ref == end_ref &&
+        update_index_ - entry.stamp <= desc_.cache_ttl_updates) {
+      std::memcpy(out, cache_corridors_ + e * desc_.max_path_polys,
+                  sizeof(NavPolyRef) * entry.count);
+      *out_count = entry.count;
+      return true;
+    }
+  }
+  return false;
+}
+
+void NavService::CacheInsert(const Slot& slot) {
+  if (cache_sets_ == 0) {
+    return;
+  }
+  const std::uint32_t set =
+      CacheHash(slot.start_ref, slot.end_ref) % cache_sets_;
+
+  // Same key, else an empty or expired way, else the oldest.
+  std::uint32_t victim = set * kCacheWays;
+  for (std::uint32_t w = 0; w < kCacheWays; ++w) {
+    const std::uint32_t e   = set * kCacheWays + w;
+    const CacheEntry& entry = cache_[e];
+    if (entry.count != 0 && entry.start_ref == slot.start_ref &&
+        entry.end_ref == slot.end_ref) {
+      victim = e;
+      break;
+    }
+    if (entry.count == 0 ||
+        update_index_ - entry.stamp > desc_.cache_ttl_updates) {
+      victim = e;
+    } else if (cache_[victim].count != 0 &&
+               update_index_ - entry.stamp >
+                   update_index_ - cache_[victim].stamp) {
+      victim = e;
+    }
+  }
+
+  const auto index  = static_cast<std::uint32_t>(&slot - slots_);
+  CacheEntry& entry = cache_[victim];
+  entry.start_ref   = slot.start_ref;
+  entry.end_ref     = slot.end_ref;
+  entry.stamp       = update_index_;
+  entry.count       = slot.corridor_count;
+  std::memcpy(cache_corridors_ + victim * desc_.max_path_polys,
+              SlotCorridor(index), sizeof(NavPolyRef) * slot.corridor_count);
+}
+
+void NavService::InvalidateCache() {
+  if (cache_ != nullptr) {
+    std::memset(cache_, 0, sizeof(CacheEntry) * cache_sets_ * kCacheWays);
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Solving (worker side)
+// ---------------------------------------------------------------------------
+
+void NavService::BuildSpline(Slot* slot) {
+  const Vec3* points = SlotPoints(static_cast<std::uint32_t>(slot - slots_));
+  switch (slot->request.spline) {
+    case NavSplineKind::kRn:
+      slot->rn_spline.Clear();
+      for (std::uint32_t i = 0; i < slot->point_count; ++i) {
+        slot->rn_spline.AddNode(points[i]);
+      }
+      slot->rn_spline.Build();
+      break;
+    case NavSplineKind::kTn: {
+      const float inv_speed =
+          slot->request.speed > 0.0f ? 1.0f / slot->request.speed : 1.0f;
+      slot->tn_spline.Clear();
+      for (std::uint32_t i = 0; i < slot->point_count; ++i) {
+        const float period =
+            i == 0 ? 0.0f : (points[i] - points[i - 1]).length() * inv_speed;
+        slot->tn_spline.AddNodeTimed(points[i], Vec3(), period);
+      }
+      slot->tn_spline.Build();
+      break;
+    }
+    case NavSplineKind::kNone:
+      break;
+  }
+}
+
+void NavService::Finalize(Slot* slot, NavQueryStatus status) {
+  const auto index           = static_cast<std::uint32_t>(slot - slots_);
+  const NavPolyRef* corridor = SlotCorridor(index);
+
+  // A corridor cut at max_path_polys or ending short of the goal polygon
+  // only gets the agent part of the way.
+  if (slot->corridor_count == 0) {
+    slot->status      = NavQueryStatus::kFailure;
+    slot->point_count = 0;
+    return;
+  }
+  Vec3 end = slot->end_pos;
+  if (corridor[slot->corridor_count - 1] != slot->end_ref) {
+    status = NavQueryStatus::kPartial;
+    end    = mesh_->poly(corridor[slot->corridor_count - 1]).center;
+  }
+  slot->status      = status;
+  slot->point_count = NavQuery::StraightPath(
+      *mesh_, slot->start_pos, end, corridor, slot->corridor_count,
+      SlotPoints(index), desc_.max_path_points);
+  BuildSpline(slot);
+}
+
+void NavService::SolveFresh(std::uint32_t slot_index, NavQuery* query) {
+  Slot& slot     = slots_[slot_index];
+  slot.start_ref = mesh_->FindNearestPoly(
+      slot.request.start, desc_.poly_search_radius, &slot.start_pos);
+  slot.end_ref = mesh_->FindNearestPoly(slot.request.end,
+                                        desc_.poly_search_radius,
+                                        &slot.end_pos);
+  if (slot.start_ref == kInvalidNavPoly || slot.end_ref == kInvalidNavPoly) {
+    slot.outcome = Outcome::kFailed;
+    return;
+  }
+
+  NavPolyRef* corridor = SlotCorridor(slot_index);
+  if (CacheLookup(slot.start_ref, slot.end_ref, corridor,
+                  &slot.corridor_count)) {
+    slot.from_cache = true;
+    slot.outcome    = Outcome::kCacheHit;
+    Finalize(&slot, NavQueryStatus::kSuccess);
+    return;
+  }
+
+  query->BeginPath(slot.start_ref, slot.end_ref, slot.start_pos,
+                   slot.end_pos);
+  const NavQueryStatus status = query->Step(desc_.iterations_per_request);
+  if (status == NavQueryStatus::kInProgress && desc_.max_sliced > 0) {
+    slot.outcome = Outcome::kNeedsSlice;
+    return;
+  }
+  slot.corridor_count = query->FinishPath(corridor, desc_.max_path_polys);
+  slot.from_cache     = false;
+  slot.outcome        = Outcome::kDone;
+  Finalize(&slot, status == NavQueryStatus::kInProgress
+                      ? NavQueryStatus::kPartial
+                      : status);
+}
+
+void NavService::AdvanceSliced(std::uint32_t sliced_index) {
+  SlicedQuery& sq             = sliced_[sliced_index];
+  Slot& slot                  = slots_[sq.slot];
+  const NavQueryStatus status = sq.query.Step(desc_.slice_iterations);
+  if (status == NavQueryStatus::kInProgress) {
+    slot.outcome = Outcome::kNone;
+    return;
+  }
+  slot.corridor_count =
+      sq.query.FinishPath(SlotCorridor(sq.slot), desc_.max_path_polys);
+  slot.from_cache = false;
+  slot.outcome    = Outcome::kDone;
+  Finalize(&slot, status);
+}
+
+void NavService::SolveRange(std::uint32_t begin, std::uint32_t end,
+                            std::uint32_t worker, void* user_data) {
+  auto* self = static_cast<NavService*>(user_data);
+  for (std::uint32_t i = begin; i < end; ++i) {
+    if (i < self->fresh_count_) {
+      self->SolveFresh(self->work_[i], &self->worker_queries_[worker]);
+    } else {
+      self->AdvanceSliced(self->work_[i]);
+    }
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Update (owner thread)
+// ---------------------------------------------------------------------------
+
+void NavService::Update() {
+  if (slots_ == nullptr) {
+    return;
+  }
+  ++update_index_;
+
+  // Sliced searches run alongside this update's fresh batch.
+  fresh_count_ = 0;
+  while (queue_head_ != kNoSlot &&
+         fresh_count_ < desc_.max_requests_per_update) {
+    const std::uint32_t index = queue_head_;
+    Unlink(index);
+    slots_[index].state   = NavPathState::kSearching;
+    work_[fresh_count_++] = index;
+  }
+  work_count_ = fresh_count_;
+  for (std::uint32_t i = 0; i < desc_.max_sliced; ++i) {
+    if (sliced_[i].slot != kNoSlice) {
+      work_[work_count_++] = i;
+    }
+  }
+
+  if (jobs_ != nullptr && work_count_ > 1) {
+    jobs_->ParallelFor(work_count_, 1, &SolveRange, this);
+  } else {
+    SolveRange(0, work_count_, 0, this);
+  }
+
+  // Publish results, fill the cache and hand over-budget searches to the
+  // sliced queries.
+  std::uint32_t free_sliced = 0;
+  for (std::uint32_t i = 0; i < work_count_; ++i) {
+    const std::uint32_t index =
+        i < fresh_count_ ? work_[i] : sliced_[work_[i]].slot;
+    Slot& slot = slots_[index];
+    switch (slot.outcome) {
+      case Outcome::kCacheHit:
+        ++stats_.cache_hits;
+        ++stats_.completed;
+        slot.state = NavPathState::kReady;
+        break;
+      case Outcome::kDone:
+        if (i < fresh_count_) {
+          ++stats_.cache_misses;
+        } else {
+          sliced_[work_[i]].slot = kNoSlice;
+          slot.sliced            = kNoSlice;
+        }
+        if (slot.status == NavQueryStatus::kSuccess) {
+          CacheInsert(slot);
+        }
+        ++stats_.completed;
+        slot.state = NavPathState::kReady;
+        break;
+      case Outcome::kFailed:
+        ++stats_.failed;
+        slot.state = NavPathState::kFailed;
+        break;
+      case Outcome::kNeedsSlice: {
+        while (free_sliced < desc_.max_sliced &&
+               sliced_[free_sliced].slot != kNoSlice) {
+          ++free_sliced;
+        }
+        if (free_sliced == desc_.max_sliced) {
+          // Every sliced query is busy; retry from the queue next update.
+          slot.state = NavPathState::kQueued;
+          Enqueue(index);
+          break;
+        }
+        ++stats_.cache_misses;
+        ++stats_.sliced;
+        SlicedQuery& sq = sliced_[free_sliced];
+        sq.slot         = index;
+        slot.sliced     = free_sliced;
+        slot.state      = NavPathState::kSearching;
+        // The budgeted attempt ran on a worker query; restart here. The
+        // repeat costs at most iterations_per_request.
+        sq.query.BeginPath(slot.start_ref, slot.end_ref, slot.start_pos,
+                           slot.end_pos);
+        break;
+      }
+      case Outcome::kNone:
+        break;
+    }
+    slot.outcome = Outcome::kNone;
+  }
+}
+
+}  // namespace navary::nav
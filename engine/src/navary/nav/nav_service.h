@@ -0,0 +1,236 @@
+#pragma once
+// Navary Engine - Navigation Subsystem
+// File: navary/nav/nav_service.h
+// Purpose: Batched path requests for many agents, solved on job workers
+//          with a corridor cache and time-sliced long searches.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - Agents call RequestPath() any time on the owner thread; requests are
+//     queued and Update() solves up to max_requests_per_update of them per
+//     frame with one ParallelFor. Each worker thread owns a NavQuery.
+//   - A request first probes the corridor cache, keyed by (start poly, end
+//     poly). Hits skip A* entirely; the funnel still runs on the caller's
+//     exact endpoints, so cached corridors stay correct.
+//   - A search that exceeds iterations_per_request is moved to one of
+//     max_sliced dedicated queries and advanced by slice_iterations per
+//     Update() until it completes, so a handful of long queries cannot
+//     stall a frame.
+//   - Results carry the poly corridor, the funnel corner points and a
+//     spline through them: RnSpline (distance-parameterized) or TnSpline
+//     (timed by segment length / speed).
+//
+// Threading:
+//   - All public calls are owner-thread only. During Update() the cache
+//     is read-only; inserts happen after the workers finished.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/core/scheduler/job_system.h"
+#include "navary/math/spline.h"
+#include "navary/math/vec3.h"
+#include "navary/nav/nav_mesh.h"
+#include "navary/nav/nav_query.h"
+#include "navary/navary_status.h"
+
+namespace navary::nav {
+
+// (generation << 16) | slot; 0 is never issued.
+using NavPathId = std::uint32_t;
+
+inline constexpr NavPathId kInvalidNavPath = 0;
+
+enum class NavSplineKind : std::uint8_t {
+  kNone = 0,  // corner points only
+  kRn,
+  kTn,
+};
+
+enum class NavPathState : std::uint8_t {
+  kInvalid = 0,  // unknown or released id
+  kQueued,
+  kSearching,  // being solved, or sliced across updates
+  kReady,
+  kFailed,  // no polygon near an endpoint
+};
+
+struct NavPathRequest {
+  math::Vec3 start;
+  math::Vec3 end;
+  NavSplineKind spline = NavSplineKind::kRn;
+  float speed          = 1.0f;  // kTn: world units per second
+};
+
+struct NavServiceDesc {
+  std::uint32_t max_requests            = 1024;  // live ids, <= 65535
+  std::uint32_t max_path_polys          = 256;
+  std::uint32_t max_path_points         = 64;
+  std::uint32_t max_requests_per_update = 256;
+  std::uint32_t iterations_per_request  = 512;
+  std::uint32_t max_sliced              = 8;
+  std::uint32_t slice_iterations        = 256;
+  std::uint32_t cache_capacity          = 1024;  // rounded up to 4 ways
+  std::uint32_t cache_ttl_updates       = 600;
+  float poly_search_radius              = 2.0f;
+};
+
+struct NavServiceStats {
+  std::uint64_t requests;
+  std::uint64_t completed;
+  std::uint64_t failed;
+  std::uint64_t cache_hits;
+  std::uint64_t cache_misses;
+  std::uint64_t sliced;  // searches that needed more than one update
+};
+
+// Completed path; valid until Release() of its id.
+struct NavPath {
+  NavQueryStatus status;  // kSuccess or kPartial
+  bool from_cache;
+  const NavPolyRef* corridor;
+  std::uint32_t corridor_count;
+  const math::Vec3* points;  // funnel corners, start .. end
+  std::uint32_t point_count;
+  NavSplineKind spline_kind;
+  const math::RnSpline* rn_spline;  // set for kRn
+  const math::TnSpline* tn_spline;  // set for kTn
+};
+
+class NavService {
+ public:
+  NavService();
+  ~NavService();
+
+  NavService(const NavService&)            = delete;
+  NavService& operator=(const NavService&) = delete;
+
+  // |mesh| must outlive the service. |jobs| may be null (solve inline);
+  // otherwise one NavQuery is created per jobs->thread_count().
+  NavaryRC Init(const NavServiceDesc& desc, const NavMesh* mesh,
+                core::scheduler::JobSystem* jobs);
+  void Shutdown();
+
+  // Queues a request. kOutOfMemory when max_requests ids are live.
+  NavaryResult<NavPathId> RequestPath(const NavPathRequest& request);
+
+  // Solves queued requests and advances sliced searches. Once per frame.
+  void Update();
+
+  NavPathState state(NavPathId id) const;
+
+  // Filled when state(id) == kReady.
+  bool GetPath(NavPathId id, NavPath* out) const;
+
+  // Frees the id (cancelling a queued or sliced search).
+  void Release(NavPathId id);
+
+  // Drops every cached corridor, e.g. after the mesh changed.
+  void InvalidateCache();
+
+  NavServiceStats stats() const {
+    return stats_;
+  }
+
+ private:
+  enum class Outcome : std::uint8_t {
+    kNone = 0,
+    kDone,        // solved by search this update
+    kCacheHit,    // solved from the cache
+    kNeedsSlice,  // over budget, restart on a sliced query
+    kFailed,
+  };
+
+  struct Slot {
+    std::uint16_t generation;
+    NavPathState state;
+    Outcome outcome;
+    NavPathRequest request;
+    NavPolyRef start_ref;
+    NavPolyRef end_ref;
+    math::Vec3 start_pos;  // endpoints clamped onto the mesh
+    math::Vec3 end_pos;
+    std::uint32_t sliced;      // sliced query index, or kNoSlice
+    std::uint32_t queue_prev;  // intrusive FIFO links, or kNoSlot
+    std::uint32_t queue_next;
+
+    NavQueryStatus status;
+    bool from_cache;
+    std::uint32_t corridor_count;
+    std::uint32_t point_count;
+    math::RnSpline rn_spline;
+    math::TnSpline tn_spline;
+  };
+
+  struct SlicedQuery {
+    NavQuery query;
+    std::uint32_t slot;  // kNoSlice when free
+  };
+
+  struct CacheEntry {
+    NavPolyRef start_ref;
+    NavPolyRef end_ref;
+    std::uint32_t stamp;  // update the entry was stored
+    std::uint32_t count;  // 0: empty
+  };
+
+  static constexpr std::uint32_t kNoSlice   = 0xFFFFFFFFu;
+  static constexpr std::uint32_t kNoSlot    = 0xFFFFFFFFu;
+  static constexpr std::uint32_t kCacheWays = 4;
+
+  static void SolveRange(std::uint32_t begin, std::uint32_t end,
+                         std::uint32_t worker, void* user_data);
+
+  void SolveFresh(std::uint32_t slot_index, NavQuery* query);
+  void AdvanceSliced(std::uint32_t sliced_index);
+  void Finalize(Slot* slot, NavQueryStatus status);
+  void BuildSpline(Slot* slot);
+
+  Slot* Resolve(NavPathId id);
+  const Slot* Resolve(NavPathId id) const;
+  NavPathId MakeId(std::uint32_t slot_index) const;
+
+  void Enqueue(std::uint32_t slot_index);
+  void Unlink(std::uint32_t slot_index);
+
+  bool CacheLookup(NavPolyRef start_ref, NavPolyRef end_ref,
+                   NavPolyRef* out, std::uint32_t* out_count) const;
+  void CacheInsert(const Slot& slot);
+
+  NavPolyRef* SlotCorridor(std::uint32_t slot_index) const;
+  math::Vec3* SlotPoints(std::uint32_t slot_index) const;
+
+  NavServiceDesc desc_;
+  const NavMesh* mesh_;
+  core::scheduler::JobSystem* jobs_;
+
+  Slot* slots_;
+  std::uint32_t* free_slots_;  // stack
+  std::uint32_t free_count_;
+  NavPolyRef* corridors_;  // max_requests * max_path_polys
+  math::Vec3* points_;     // max_requests * max_path_points
+
+  // FIFO of queued slots; Release() unlinks in O(1).
+  std::uint32_t queue_head_;
+  std::uint32_t queue_tail_;
+
+  // Per-update work list: fresh slot indices, then sliced query indices.
+  std::uint32_t* work_;
+  std::uint32_t fresh_count_;
+  std::uint32_t work_count_;
+
+  NavQuery* worker_queries_;
+  std::uint32_t worker_count_;
+  SlicedQuery* sliced_;
+
+  CacheEntry* cache_;
+  NavPolyRef* cache_corridors_;  // cache entries * max_path_polys
+  std::uint32_t cache_sets_;
+
+  std::uint32_t update_index_;
+  NavServiceStats stats_;
+};
+
+}  // namespace navary::nav
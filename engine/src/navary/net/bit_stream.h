@@ -0,0 +1,156 @@
+#pragma once
+// Navary Engine - Net Subsystem
+// File: navary/net/bit_stream.h
+// Purpose: Bit-granular writer/reader over caller-owned buffers (arena
+//          scratch, packet pools) for snapshot serialization.
+// Policy: C++20, Google style, no exceptions, no RTTI, header-only.
+//
+// Bits are packed LSB-first into little-endian 32-bit words, so a stream
+// is byte-identical on every platform the engine targets. Neither class
+// allocates. Running out of space (writer) or data (reader) sets a sticky
+// overflow flag; callers check it once after a whole message instead of
+// after every field.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "navary/memory/span.h"
+
+namespace navary::net {
+
+class BitWriter {
+ public:
+  explicit BitWriter(memory::Span<std::uint8_t> buffer)
+      : data_(buffer.data()),
+        capacity_(buffer.size()),
+        byte_pos_(0),
+        scratch_(0),
+        scratch_bits_(0),
+        overflowed_(false) {}
+
+  // Appends the low |bits| (1..32) of |value|.
+  void WriteBits(std::uint32_t value, std::uint32_t bits) {
+    const std::uint64_t mask = (std::uint64_t{1} << bits) - 1;
+    scratch_ |= (std::uint64_t{value} & mask) << scratch_bits_;
+    scratch_bits_ += bits;
+    if (scratch_bits_ >= 32) {
+      FlushWord();
+    }
+  }
+
+  void WriteBool(bool value) {
+    WriteBits(value ? 1u : 0u, 1);
+  }
+
+  // Flushes the partial word (zero padded to a byte) and returns the
+  // stream size in bytes. Further writes continue after the padding.
+  std::size_t Finish() {
+    while (scratch_bits_ > 0) {
+      if (byte_pos_ >= capacity_) {
+        overflowed_   = true;
+        scratch_bits_ = 0;
+        break;
+      }
+      data_[byte_pos_++] = static_cast<std::uint8_t>(scratch_);
+      scratch_ >>= 8;
+      scratch_bits_ = scratch_bits_ > 8 ? scratch_bits_ - 8 : 0;
+    }
+    scratch_ = 0;
+    return byte_pos_;
+  }
+
+  std::size_t bits_written() const {
+    return byte_pos_ * 8 + scratch_bits_;
+  }
+
+  bool overflowed() const {
+    return overflowed_;
+  }
+
+ private:
+  void FlushWord() {
+    if (capacity_ - byte_pos_ < 4) {
+      overflowed_ = true;
+      byte_pos_   = capacity_;
+    } else {
+      const std::uint32_t word = static_cast<std::uint32_t>(scratch_);
+      std::memcpy(data_ + byte_pos_, &word, sizeof(word));
+      byte_pos_ += 4;
+    }
+    scratch_ >>= 32;
+    scratch_bits_ -= 32;
+  }
+
+  std::uint8_t* data_;
+  std::size_t capacity_;
+  std::size_t byte_pos_;
+  std::uint64_t scratch_;
+  std::uint32_t scratch_bits_;
+  bool overflowed_;
+};
+
+class BitReader {
+ public:
+  explicit BitReader(memory::Span<const std::uint8_t> buffer)
+      : data_(buffer.data()),
+        size_(buffer.size()),
+        byte_pos_(0),
+        scratch_(0),
+        scratch_bits_(0),
+        overflowed_(false) {}
+
+  // Reads |bits| (1..32). Past the end it returns 0 and sets overflowed().
+  std::uint32_t ReadBits(std::uint32_t bits) {
+    if (scratch_bits_ < bits && !Refill(bits)) {
+      overflowed_ = true;
+      return 0;
+    }
+    const std::uint64_t mask = (std::uint64_t{1} << bits) - 1;
+    const auto value         = static_cast<std::uint32_t>(scratch_ & mask);
+    scratch_ >>= bits;
+    scratch_bits_ -= bits;
+    return value;
+  }
+
+  bool ReadBool() {
+    return ReadBits(1) != 0;
+  }
+
+  std::size_t bits_read() const {
+    return byte_pos_ * 8 - scratch_bits_;
+  }
+
+  bool overflowed() const {
+    return overflowed_;
+  }
+
+ private:
+  bool Refill(std::uint32_t bits) {
+    if (size_ - byte_pos_ >= 4) {
+      std::uint32_t word;
+      std::memcpy(&word, data_ + byte_pos_, sizeof(word));
+      scratch_ |= std::uint64_t{word} << scratch_bits_;
+      scratch_bits_ += 32;
+      byte_pos_ += 4;
+      return true;  // scratch_bits_ was < 32, so now >= bits
+    }
+    while (scratch_bits_ < bits && byte_pos_ < size_) {
+      scratch_ |= std::uint64_t{data_[byte_pos_++]} << scratch_bits_;
+      scratch_bits_ += 8;
+    }
+    return scratch_bits_ >= bits;
+  }
+
+  const std::uint8_t* data_;
+  std::size_t size_;
+  std::size_t byte_pos_;
+  std::uint64_t scratch_;
+  std::uint32_t scratch_bits_;
+  bool overflowed_;
+};
+
+}  // namespace navary::net
@@ -0,0 +1,156 @@
+// Navary Engine - Net Subsystem
+// File: navary/net/quantize.cc
+// Purpose: Integer-only quantizers for Fixed15p16 values and quaternions.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/net/quantize.h"
+
+namespace navary::net {
+
+namespace {
+
+using F = math::Fixed15p16;
+
+constexpr std::int64_t kOneRaw = F::kOneRaw;
+
+// ceil(kOneRaw / sqrt(2)): bound of the three smallest components of a
+// unit quaternion.
+constexpr std::int32_t kQuatComponentMax = 46341;
+
+std::uint64_t Steps(std::uint32_t bits) {
+  return bits >= 32 ? 0xFFFFFFFFull : (std::uint64_t{1} << bits) - 1;
+}
+
+// floor(sqrt(v)), bit by bit so every platform agrees.
+std::uint64_t IntegerSqrt(std::uint64_t v) {
+  std::uint64_t result = 0;
+  std::uint64_t bit    = std::uint64_t{1} << 62;
+  while (bit > v) {
+    bit >>= 2;
+  }
+  while (bit != 0) {
+    if (v >= result + bit) {
+      v -= result + bit;
+      result = (result >> 1) + bit;
+    } else {
+      result >>= 1;
+    }
+    bit >>= 2;
+  }
+  return result;
+}
+
+FixedRange QuatComponentRange(std::uint32_t component_bits) {
+  return FixedRange{F::FromRaw(-kQuatComponentMax),
+                    F::FromRaw(kQuatComponentMax),
+                    static_cast<std::uint8_t>(component_bits)};
+}
+
+}  // namespace
+
+std::uint32_t QuantizeFixed(F value, const FixedRange& range) {
+  const std::int64_t lo = range.min.Raw();
+  const std::int64_t hi = range.max.Raw();
+  if (hi <= lo) {
+    return 0;
+  }
+  std::int64_t v = value.Raw();
+  v              = v < lo ? lo : (v > hi ? hi : v);
+
+  const auto span   = static_cast<std::uint64_t>(hi - lo);
+  const auto offset = static_cast<std::uint64_t>(v - lo);
+  return static_cast<std::uint32_t>(
+      (offset * Steps(range.bits) + span / 2) / span);
+}
+
+F DequantizeFixed(std::uint32_t q, const FixedRange& range) {
+  const std::int64_t lo = range.min.Raw();
+  const std::int64_t hi = range.max.Raw();
+  if (hi <= lo) {
+    return range.min;
+  }
+  const std::uint64_t steps = Steps(range.bits);
+  const std::uint64_t qq    = q > steps ? steps : q;
+  const auto span           = static_cast<std::uint64_t>(hi - lo);
+  const auto offset =
+      static_cast<std::int64_t>((qq * span + steps / 2) / steps);
+  return F::FromRaw(static_cast<std::int32_t>(lo + offset));
+}
+
+QuantizedVec3 QuantizeVec3(const math::FixedVec3& v, const FixedRange& range) {
+  return QuantizedVec3{QuantizeFixed(v.x, range), QuantizeFixed(v.y, range),
+                       QuantizeFixed(v.z, range)};
+}
+
+math::FixedVec3 DequantizeVec3(const QuantizedVec3& q,
+                               const FixedRange& range) {
+  math::FixedVec3 v;
+  v.x = DequantizeFixed(q.x, range);
+  v.y = DequantizeFixed(q.y, range);
+  v.z = DequantizeFixed(q.z, range);
+  return v;
+}
+
+std::uint32_t QuantizeQuat(const math::FixedQuat& q,
+                           std::uint32_t component_bits) {
+  std::int32_t c[4] = {q.x.Raw(), q.y.Raw(), q.z.Raw(), q.w.Raw()};
+
+  std::uint32_t largest = 0;
+  for (std::uint32_t i = 1; i < 4; ++i) {
+    const std::int64_t a = c[i] < 0 ? -std::int64_t{c[i]} : c[i];
+    const std::int64_t b =
+        c[largest] < 0 ? -std::int64_t{c[largest]} : c[largest];
+    if (a > b) {
+      largest = i;
+    }
+  }
+  // q and -q are the same rotation; make the dropped component positive.
+  if (c[largest] < 0) {
+    for (std::int32_t& v : c) {
+      v = -v;
+    }
+  }
+
+  const FixedRange range = QuatComponentRange(component_bits);
+  std::uint32_t packed   = largest;
+  std::uint32_t shift    = 2;
+  for (std::uint32_t i = 0; i < 4; ++i) {
+    if (i == largest) {
+      continue;
+    }
+    packed |= QuantizeFixed(F::FromRaw(c[i]), range) << shift;
+    shift += component_bits;
+  }
+  return packed;
+}
+
+math::FixedQuat DequantizeQuat(std::uint32_t packed,
+                               std::uint32_t component_bits) {
+  const FixedRange range      = QuatComponentRange(component_bits);
+  const std::uint32_t mask    = (1u << component_bits) - 1;
+  const std::uint32_t largest = packed & 3u;
+
+  std::int32_t c[4]   = {};
+  std::int64_t sum    = 0;
+  std::uint32_t shift = 2;
+  for (std::uint32_t i = 0; i < 4; ++i) {
+    if (i == largest) {
+      continue;
+    }
+    c[i] = DequantizeFixed((packed >> shift) & mask, range).Raw();
+    sum += std::int64_t{c[i]} * c[i];
+    shift += component_bits;
+  }
+  const std::int64_t rest = kOneRaw * kOneRaw - sum;
+  c[largest] = rest > 0 ? static_cast<std::int32_t>(IntegerSqrt(
+                              static_cast<std::uint64_t>(rest)))
+                        : 0;
+
+  return math::FixedQuat{F::FromRaw(c[0]), F::FromRaw(c[1]),
+                         F::FromRaw(c[2]), F::FromRaw(c[3])};
+}
+
+}  // namespace navary::net
@@ -0,0 +1,57 @@
+#pragma once
+// Navary Engine - Net Subsystem
+// File: navary/net/quantize.h
+// Purpose: Range quantization of Fixed15p16 scalars/vectors and
+//          smallest-three compression of FixedQuat for snapshots.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// All conversions are integer-only on the raw fixed-point values, so the
+// sender's dequantized state and the receiver's are bit-identical, which
+// lockstep checks and delta baselines rely on.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/math/fixed.h"
+#include "navary/math/fixed_quat.h"
+#include "navary/math/fixed_vec3.h"
+
+namespace navary::net {
+
+// Values are clamped to [min, max] and mapped onto 2^bits evenly spaced
+// steps, both ends exact. Resolution is (max - min) / (2^bits - 1).
+struct FixedRange {
+  math::Fixed15p16 min;
+  math::Fixed15p16 max;
+  std::uint8_t bits;  // 1..32
+};
+
+struct QuantizedVec3 {
+  std::uint32_t x;
+  std::uint32_t y;
+  std::uint32_t z;
+};
+
+std::uint32_t QuantizeFixed(math::Fixed15p16 value, const FixedRange& range);
+math::Fixed15p16 DequantizeFixed(std::uint32_t q, const FixedRange& range);
+
+QuantizedVec3 QuantizeVec3(const math::FixedVec3& v, const FixedRange& range);
+math::FixedVec3 DequantizeVec3(const QuantizedVec3& q,
+                               const FixedRange& range);
+
+// Smallest-three: 2 bits select the largest component (rebuilt from the
+// unit-length constraint), the other three use |component_bits| each over
+// [-1/sqrt(2), 1/sqrt(2)]. Packed result uses 2 + 3 * component_bits bits
+// (component_bits 2..10, so it fits a word). |q| should be unit length.
+inline constexpr std::uint32_t QuatPackedBits(std::uint32_t component_bits) {
+  return 2 + 3 * component_bits;
+}
+
+std::uint32_t QuantizeQuat(const math::FixedQuat& q,
+                           std::uint32_t component_bits);
+math::FixedQuat DequantizeQuat(std::uint32_t packed,
+                               std::uint32_t component_bits);
+
+}  // namespace navary::net
@@ -0,0 +1,323 @@
+// Navary Engine - Net Subsystem
+// File: navary/net/snapshot_codec.cc
+// Purpose: Snapshot wire format: full and baseline-delta entity encoding.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Wire format (BitWriter order):
+//   tick:32  has_baseline:1  [baseline_tick:32]  count:16
+//   per entity:
+//     id gap      0 -> next id, else 1 + class:2 + gap:{4,8,16,32}
+//     in baseline changed:1 [field mask:4 (position, rotation, velocity,
+//                 flags), then each changed field]
+//     otherwise   position, rotation, velocity, flags at full width
+//   delta component: 0 = same, 10 + sign + (|d|-1):delta_bits, 11 + value
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/net/snapshot_codec.h"
+
+namespace navary::net {
+
+namespace {
+
+constexpr std::uint32_t kGapBits[4] = {4, 8, 16, 32};
+
+enum FieldBit : std::uint32_t {
+  kFieldPosition = 1u << 0,
+  kFieldRotation = 1u << 1,
+  kFieldVelocity = 1u << 2,
+  kFieldFlags    = 1u << 3,
+};
+
+bool SameVec(const QuantizedVec3& a, const QuantizedVec3& b) {
+  return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+std::uint32_t ChangedFields(const QuantizedEntityState& e,
+                            const QuantizedEntityState& base) {
+  std::uint32_t mask = 0;
+  mask |= SameVec(e.position, base.position) ? 0u : kFieldPosition;
+  mask |= e.rotation == base.rotation ? 0u : kFieldRotation;
+  mask |= SameVec(e.velocity, base.velocity) ? 0u : kFieldVelocity;
+  mask |= e.flags == base.flags ? 0u : kFieldFlags;
+  return mask;
+}
+
+void WriteGap(std::uint32_t gap, BitWriter* out) {
+  if (gap == 0) {
+    out->WriteBits(0, 1);
+    return;
+  }
+  std::uint32_t cls = 0;
+  while (cls < 3 && gap >= (1u << kGapBits[cls])) {
+    ++cls;
+  }
+  out->WriteBits(1, 1);
+  out->WriteBits(cls, 2);
+  out->WriteBits(gap, kGapBits[cls]);
+}
+
+std::uint32_t ReadGap(BitReader* in) {
+  if (!in->ReadBool()) {
+    return 0;
+  }
+  return in->ReadBits(kGapBits[in->ReadBits(2)]);
+}
+
+// Walks |baseline| alongside ascending ids; null when |id| is not in it.
+const QuantizedEntityState* FindInBaseline(const QuantizedSnapshot* baseline,
+                                           std::uint32_t id,
+                                           std::uint32_t* cursor) {
+  if (baseline == nullptr) {
+    return nullptr;
+  }
+  while (*cursor < baseline->count && baseline->entities[*cursor].id < id) {
+    ++*cursor;
+  }
+  if (*cursor < baseline->count && baseline->entities[*cursor].id == id) {
+    return &baseline->entities[*cursor];
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+SnapshotCodec::SnapshotCodec(const SnapshotSchema& schema) : schema_(schema) {}
+
+void SnapshotCodec::Quantize(const NetEntityState& in,
+                             QuantizedEntityState* out) const {
+  out->id       = in.id;
+  out->position = QuantizeVec3(in.position, schema_.position);
+  out->rotation = QuantizeQuat(in.rotation, schema_.rotation_bits);
+  out->velocity = QuantizeVec3(in.velocity, schema_.velocity);
+  out->flags    = schema_.flags_bits >= 32
+                      ? in.flags
+                      : in.flags & ((1u << schema_.flags_bits) - 1);
+}
+
+void SnapshotCodec::Dequantize(const QuantizedEntityState& in,
+                               NetEntityState* out) const {
+  out->id       = in.id;
+  out->position = DequantizeVec3(in.position, schema_.position);
+  out->rotation = DequantizeQuat(in.rotation, schema_.rotation_bits);
+  out->velocity = DequantizeVec3(in.velocity, schema_.velocity);
+  out->flags    = in.flags;
+}
+
+NavaryRC SnapshotCodec::Write(const QuantizedSnapshot& current,
+                              const QuantizedSnapshot* baseline,
+                              BitWriter* out,
+                              SnapshotWriteStats* stats) const {
+  if (current.count > kMaxEntities) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "SnapshotCodec: too many entities");
+  }
+  for (std::uint32_t i = 1; i < current.count; ++i) {
+    if (current.entities[i].id <= current.entities[i - 1].id) {
+      return NavaryRC(NavaryStatus::kInvalidArgument,
+                      "SnapshotCodec: ids must be sorted and unique");
+    }
+  }
+
+  SnapshotWriteStats local{};
+  out->WriteBits(current.tick, 32);
+  out->WriteBool(baseline != nullptr);
+  if (baseline != nullptr) {
+    out->WriteBits(baseline->tick, 32);
+  }
+  out->WriteBits(current.count, 16);
+
+  std::uint32_t next_id = 0;
+  std::uint32_t cursor  = 0;
+  for (std::uint32_t i = 0; i < current.count; ++i) {
+    const QuantizedEntityState& e = current.entities[i];
+    WriteGap(e.id - next_id, out);
+    next_id = e.id + 1;
+
+    const QuantizedEntityState* base = FindInBaseline(baseline, e.id, &cursor);
+    if (base == nullptr) {
+      WriteFull(e, out);
+      ++local.full;
+    } else if (ChangedFields(e, *base) == 0) {
+      out->WriteBool(false);
+      ++local.unchanged;
+    } else {
+      out->WriteBool(true);
+      WriteDelta(e, *base, out);
+      ++local.delta;
+    }
+  }
+
+  if (stats != nullptr) {
+    *stats = local;
+  }
+  if (out->overflowed()) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "SnapshotCodec: output buffer too small");
+  }
+  return NavaryRC::OK();
+}
+
+NavaryRC SnapshotCodec::Read(BitReader* in, const QuantizedSnapshot* baseline,
+                             QuantizedSnapshot* out) const {
+  const std::uint32_t tick = in->ReadBits(32);
+  const bool has_baseline  = in->ReadBool();
+  if (has_baseline) {
+    const std::uint32_t baseline_tick = in->ReadBits(32);
+    if (baseline == nullptr || baseline->tick != baseline_tick) {
+      return NavaryRC(NavaryStatus::kInvalidArgument,
+                      "SnapshotCodec: baseline mismatch");
+    }
+  } else {
+    baseline = nullptr;
+  }
+  const std::uint32_t count = in->ReadBits(16);
+  if (in->overflowed()) {
+    return NavaryRC(NavaryStatus::kParseError, "SnapshotCodec: truncated");
+  }
+  if (count > out->capacity) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "SnapshotCodec: snapshot exceeds capacity");
+  }
+
+  std::uint64_t next_id = 0;
+  std::uint32_t cursor  = 0;
+  for (std::uint32_t i = 0; i < count; ++i) {
+    const std::uint64_t id = next_id + ReadGap(in);
+    if (id > 0xFFFFFFFFull || in->overflowed()) {
+      return NavaryRC(NavaryStatus::kParseError, "SnapshotCodec: bad id");
+    }
+    next_id = id + 1;
+
+    QuantizedEntityState& e = out->entities[i];
+    const QuantizedEntityState* base =
+        FindInBaseline(baseline, static_cast<std::uint32_t>(id), &cursor);
+    if (base == nullptr) {
+      ReadFull(in, &e);
+    } else if (in->ReadBool()) {
+      ReadDelta(in, *base, &e);
+    } else {
+      e = *base;
+    }
+    e.id = static_cast<std::uint32_t>(id);
+  }
+
+  if (in->overflowed()) {
+    return NavaryRC(NavaryStatus::kParseError, "SnapshotCodec: truncated");
+  }
+  out->tick  = tick;
+  out->count = count;
+  return NavaryRC::OK();
+}
+
+void SnapshotCodec::WriteFull(const QuantizedEntityState& e,
+                              BitWriter* out) const {
+  const std::uint32_t pb = schema_.position.bits;
+  const std::uint32_t vb = schema_.velocity.bits;
+  out->WriteBits(e.position.x, pb);
+  out->WriteBits(e.position.y, pb);
+  out->WriteBits(e.position.z, pb);
+  out->WriteBits(e.rotation, QuatPackedBits(schema_.rotation_bits));
+  out->WriteBits(e.velocity.x, vb);
+  out->WriteBits(e.velocity.y, vb);
+  out->WriteBits(e.velocity.z, vb);
+  out->WriteBits(e.flags, schema_.flags_bits);
+}
+
+void SnapshotCodec::ReadFull(BitReader* in, QuantizedEntityState* e) const {
+  const std::uint32_t pb = schema_.position.bits;
+  const std::uint32_t vb = schema_.velocity.bits;
+  e->position.x = in->ReadBits(pb);
+  e->position.y = in->ReadBits(pb);
+  e->position.z = in->ReadBits(pb);
+  e->rotation   = in->ReadBits(QuatPackedBits(schema_.rotation_bits));
+  e->velocity.x = in->ReadBits(vb);
+  e->velocity.y = in->ReadBits(vb);
+  e->velocity.z = in->ReadBits(vb);
+  e->flags      = in->ReadBits(schema_.flags_bits);
+}
+
+void SnapshotCodec::WriteDelta(const QuantizedEntityState& e,
+                               const QuantizedEntityState& base,
+                               BitWriter* out) const {
+  const std::uint32_t mask = ChangedFields(e, base);
+  out->WriteBits(mask, 4);
+  if ((mask & kFieldPosition) != 0) {
+    const std::uint32_t pb = schema_.position.bits;
+    WriteComponent(e.position.x, base.position.x, pb, out);
+    WriteComponent(e.position.y, base.position.y, pb, out);
+    WriteComponent(e.position.z, base.position.z, pb, out);
+  }
+  if ((mask & kFieldRotation) != 0) {
+    // Smallest-three fields do not move smoothly (the dropped component
+    // can switch), so rotation is always sent whole.
+    out->WriteBits(e.rotation, QuatPackedBits(schema_.rotation_bits));
+  }
+  if ((mask & kFieldVelocity) != 0) {
+    const std::uint32_t vb = schema_.velocity.bits;
+    WriteComponent(e.velocity.x, base.velocity.x, vb, out);
+    WriteComponent(e.velocity.y, base.velocity.y, vb, out);
+    WriteComponent(e.velocity.z, base.velocity.z, vb, out);
+  }
+  if ((mask & kFieldFlags) != 0) {
+    out->WriteBits(e.flags, schema_.flags_bits);
+  }
+}
+
+void SnapshotCodec::ReadDelta(BitReader* in, const QuantizedEntityState& base,
+                              QuantizedEntityState* e) const {
+  *e                       = base;
+  const std::uint32_t mask = in->ReadBits(4);
+  if ((mask & kFieldPosition) != 0) {
+    const std::uint32_t pb = schema_.position.bits;
+    e->position.x          = ReadComponent(in, base.position.x, pb);
+    e->position.y          = ReadComponent(in, base.position.y, pb);
+    e->position.z          = ReadComponent(in, base.position.z, pb);
+  }
+  if ((mask & kFieldRotation) != 0) {
+    e->rotation = in->ReadBits(QuatPackedBits(schema_.rotation_bits));
+  }
+  if ((mask & kFieldVelocity) != 0) {
+    const std::uint32_t vb = schema_.velocity.bits;
+    e->velocity.x          = ReadComponent(in, base.velocity.x, vb);
+    e->velocity.y          = ReadComponent(in, base.velocity.y, vb);
+    e->velocity.z          = ReadComponent(in, base.velocity.z, vb);
+  }
+  if ((mask & kFieldFlags) != 0) {
+    e->flags = in->ReadBits(schema_.flags_bits);
+  }
+}
+
+void SnapshotCodec::WriteComponent(std::uint32_t value, std::uint32_t base,
+                                   std::uint32_t bits, BitWriter* out) const {
+  if (value == base) {
+    out->WriteBits(0, 1);
+    return;
+  }
+  const bool negative     = value < base;
+  const std::uint64_t mag = negative ? base - value : value - base;
+  if (mag <= (std::uint64_t{1} << schema_.delta_bits)) {
+    out->WriteBits(0b01, 2);  // "10" in stream order (LSB first)
+    out->WriteBool(negative);
+    out->WriteBits(static_cast<std::uint32_t>(mag - 1), schema_.delta_bits);
+  } else {
+    out->WriteBits(0b11, 2);
+    out->WriteBits(value, bits);
+  }
+}
+
+std::uint32_t SnapshotCodec::ReadComponent(BitReader* in, std::uint32_t base,
+                                           std::uint32_t bits) const {
+  if (!in->ReadBool()) {
+    return base;
+  }
+  if (!in->ReadBool()) {
+    const bool negative     = in->ReadBool();
+    const std::uint32_t mag = in->ReadBits(schema_.delta_bits) + 1;
+    return negative ? base - mag : base + mag;
+  }
+  return in->ReadBits(bits);
+}
+
+}  // namespace navary::net
@@ -0,0 +1,116 @@
+#pragma once
+// Navary Engine - Net Subsystem
+// File: navary/net/snapshot_codec.h
+// Purpose: Quantized, delta-compressed entity snapshots on top of
+//          BitWriter/BitReader.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - The server quantizes entity state once per tick (Quantize) and keeps
+//     the quantized snapshots; a client's last acknowledged one is the
+//     baseline for its next packet. Because deltas are taken between
+//     quantized values, sender and receiver reconstruct identical state.
+//   - Entities are sorted by id. Ids travel as gaps (1 bit for runs),
+//     unchanged entities cost 1 bit, changed ones send only changed fields,
+//     and small position/velocity moves send short signed deltas.
+//   - Entities in the baseline but missing from the snapshot are removed.
+//
+// Notes:
+//   - Nothing allocates: snapshots point at caller storage (arena scratch,
+//     a per-client ring), streams wrap caller buffers.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/math/fixed_quat.h"
+#include "navary/math/fixed_vec3.h"
+#include "navary/navary_status.h"
+#include "navary/net/bit_stream.h"
+#include "navary/net/quantize.h"
+
+namespace navary::net {
+
+struct SnapshotSchema {
+  FixedRange position;  // world bounds; e.g. +-4096 m at 20 bits ~ 8 mm
+  FixedRange velocity;
+  std::uint32_t rotation_bits = 10;  // per smallest-three component, 2..10
+  std::uint32_t delta_bits    = 6;   // magnitude of short deltas, 1..16
+  std::uint32_t flags_bits    = 8;   // gameplay state bits, 1..32
+};
+
+struct NetEntityState {
+  std::uint32_t id;
+  math::FixedVec3 position;
+  math::FixedQuat rotation;
+  math::FixedVec3 velocity;
+  std::uint32_t flags;
+};
+
+struct QuantizedEntityState {
+  std::uint32_t id;
+  QuantizedVec3 position;
+  std::uint32_t rotation;  // QuantizeQuat packing
+  QuantizedVec3 velocity;
+  std::uint32_t flags;
+};
+
+// View over caller-owned entity storage, sorted by ascending unique id.
+struct QuantizedSnapshot {
+  std::uint32_t tick;
+  QuantizedEntityState* entities;
+  std::uint32_t count;
+  std::uint32_t capacity;  // read side: entities may hold this many
+};
+
+struct SnapshotWriteStats {
+  std::uint32_t unchanged;  // matched baseline exactly
+  std::uint32_t delta;      // sent as field deltas
+  std::uint32_t full;       // not in baseline
+};
+
+class SnapshotCodec {
+ public:
+  static constexpr std::uint32_t kMaxEntities = 0xFFFF;
+
+  explicit SnapshotCodec(const SnapshotSchema& schema);
+
+  void Quantize(const NetEntityState& in, QuantizedEntityState* out) const;
+  void Dequantize(const QuantizedEntityState& in, NetEntityState* out) const;
+
+  // Encodes |current| against |baseline| (null: full snapshot).
+  // kInvalidArgument for unsorted ids or too many entities, kOutOfMemory
+  // when |out| ran out of space. |stats| is optional.
+  NavaryRC Write(const QuantizedSnapshot& current,
+                 const QuantizedSnapshot* baseline, BitWriter* out,
+                 SnapshotWriteStats* stats = nullptr) const;
+
+  // Decodes into out->entities (up to out->capacity). |baseline| must be
+  // the snapshot the sender used; a mismatched tick is kInvalidArgument.
+  // kOutOfMemory when out->capacity is too small, kParseError for
+  // truncated or inconsistent data.
+  NavaryRC Read(BitReader* in, const QuantizedSnapshot* baseline,
+                QuantizedSnapshot* out) const;
+
+  const SnapshotSchema& schema() const {
+    return schema_;
+  }
+
+ private:
+  void WriteFull(const QuantizedEntityState& e, BitWriter* out) const;
+  void WriteDelta(const QuantizedEntityState& e,
+                  const QuantizedEntityState& base, BitWriter* out) const;
+  void WriteComponent(std::uint32_t value, std::uint32_t base,
+                      std::uint32_t bits, BitWriter* out) const;
+
+  void ReadFull(BitReader* in, QuantizedEntityState* e) const;
+  void ReadDelta(BitReader* in, const QuantizedEntityState& base,
+                 QuantizedEntityState* e) const;
+  std::uint32_t ReadComponent(BitReader* in, std::uint32_t base,
+                              std::uint32_t bits) const;
+
+  SnapshotSchema schema_;
+};
+
+}  // namespace navary::net
@@ -0,0 +1,72 @@
+#pragma once
+
+// navary/render/v1/command_list.h
+// Defines the backend-agnostic CommandList recording interface and the
+// CommandBackend that hands out per-worker secondary command lists.
+// Used by ParallelCommandRecorder and render graph pass callbacks.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstddef>
+#include <cstdint>
+
+#include "navary/core/handles.h"
+#include "navary/navary_status.h"
+
+namespace navary::render::v1 {
+
+// Recording interface. One CommandList is only ever touched by one thread.
+class CommandList {
+ public:
+  virtual ~CommandList() = default;
+
+  virtual void BindPipeline(core::PipelineHandle pipeline) = 0;
+
+  virtual void BindDescriptorSet(std::uint32_t set_index,
+                                 core::DescriptorHandle set) = 0;
+
+  virtual void BindVertexBuffer(core::BufferHandle buffer,
+                                std::size_t offset) = 0;
+
+  virtual void BindIndexBuffer(core::BufferHandle buffer,
+                               std::size_t offset) = 0;
+
+  virtual void PushConstants(const void* data, std::uint32_t size) = 0;
+
+  virtual void DrawIndexed(std::uint32_t index_count,
+                           std::uint32_t instance_count,
+                           std::uint32_t first_index,
+                           std::int32_t vertex_offset,
+                           std::uint32_t first_instance) = 0;
+
+  virtual void DrawIndexedIndirect(core::BufferHandle buffer,
+                                   std::size_t offset,
+                                   std::uint32_t draw_count,
+                                   std::uint32_t stride) = 0;
+};
+
+// Owns one command pool per worker thread (per frame in flight). Secondary
+// lists begun on worker N come from pool N, so recording needs no locks.
+class CommandBackend {
+ public:
+  virtual ~CommandBackend() = default;
+
+  // Resets every worker pool for |frame_slot|. Main thread, before recording.
+  virtual NavaryRC BeginFrame(std::uint32_t frame_slot) = 0;
+
+  // Number of worker pools; worker indices must be below this.
+  virtual std::uint32_t worker_count() const = 0;
+
+  // Begins a secondary list inheriting the current render pass.
+  // Callable concurrently for distinct |worker| values.
+  virtual NavaryResult<CommandList*> BeginSecondary(std::uint32_t worker) = 0;
+
+  virtual NavaryRC EndSecondary(std::uint32_t worker, CommandList* list) = 0;
+
+  // Executes finished secondaries into the primary list in array order.
+  // Main thread only.
+  virtual NavaryRC ExecuteSecondaries(CommandList* const* lists,
+                                      std::uint32_t count) = 0;
+};
+
+}  // namespace navary::render::v1
@@ -0,0 +1,59 @@
+#pragma once
+
+// navary/render/v1/draw_sort_key.h
+// 64-bit draw sort key used to order visible draws before recording.
+// Sorting by the key groups draws by pipeline first (most expensive state
+// change), then by material (descriptor set 1), then by mesh.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstdint>
+
+#include "navary/core/handles.h"
+
+namespace navary::render::v1 {
+
+// Layout: [63:48] pipeline | [47:24] material | [23:0] mesh
+using DrawSortKey = std::uint64_t;
+
+constexpr std::uint32_t kSortKeyPipelineBits = 16;
+constexpr std::uint32_t kSortKeyMaterialBits = 24;
+constexpr std::uint32_t kSortKeyMeshBits     = 24;
+
+constexpr std::uint64_t kSortKeyPipelineMask =
+    (1ull << kSortKeyPipelineBits) - 1ull;
+constexpr std::uint64_t kSortKeyMaterialMask =
+    (1ull << kSortKeyMaterialBits) - 1ull;
+constexpr std::uint64_t kSortKeyMeshMask = (1ull << kSortKeyMeshBits) - 1ull;
+
+constexpr DrawSortKey MakeDrawSortKey(core::PipelineHandle pipeline,
+                                      core::MaterialHandle material,
+                                      core::MeshHandle mesh) {
+  return ((pipeline.index & kSortKeyPipelineMask)
+          << (kSortKeyMaterialBits + kSortKeyMeshBits)) |
+         ((material.index & kSortKeyMaterialMask) << kSortKeyMeshBits) |
+         (mesh.index & kSortKeyMeshMask);
+}
+
+constexpr std::uint32_t SortKeyPipeline(DrawSortKey key) {
+  return static_cast<std::uint32_t>(
+      (key >> (kSortKeyMaterialBits + kSortKeyMeshBits)) &
+      kSortKeyPipelineMask);
+}
+
+constexpr std::uint32_t SortKeyMaterial(DrawSortKey key) {
+  return static_cast<std::uint32_t>((key >> kSortKeyMeshBits) &
+                                    kSortKeyMaterialMask);
+}
+
+constexpr std::uint32_t SortKeyMesh(DrawSortKey key) {
+  return static_cast<std::uint32_t>(key & kSortKeyMeshMask);
+}
+
+// Pipeline + material part of the key; draws sharing it can be issued from
+// one multi-draw indirect call.
+constexpr DrawSortKey SortKeyStatePrefix(DrawSortKey key) {
+  return key >> kSortKeyMeshBits;
+}
+
+}  // namespace navary::render::v1
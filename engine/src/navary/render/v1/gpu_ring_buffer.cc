@@ -34,8 +34,11 @@ NavaryResult<BufferSlice> GpuRingBuffer::AllocateAndWrite(const void* data,
                  "GpuRingBuffer: size larger than capacity"));
   }
 
+  // Everything since ResetFrame() lives in [0, write_head_), so wrapping
+  // to offset 0 would overwrite this frame's data.
   if (write_head_ + size > capacity_) {
-    write_head_ = 0;  // simple wraparound; fences must ensure safety.
+    return NavaryResult<BufferSlice>(NavaryRC(
+        NavaryStatus::kOutOfMemory, "GpuRingBuffer: frame budget exhausted"));
   }
 
   std::memcpy(mapped_ptr_ + write_head_, data, size);
@@ -45,6 +48,35 @@ NavaryResult<BufferSlice> GpuRingBuffer::AllocateAndWrite(const void* data,
   return NavaryResult<BufferSlice>(slice);
 }
 
+NavaryResult<BufferReservation> GpuRingBuffer::Reserve(std::size_t size,
+                                                       std::size_t alignment) {
+  if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+    return NavaryResult<BufferReservation>(
+        NavaryRC(NavaryStatus::kInvalidArgument,
+                 "GpuRingBuffer: alignment must be a power of two"));
+  }
+
+  if (size > capacity_) {
+    return NavaryResult<BufferReservation>(
+        NavaryRC(NavaryStatus::kOutOfMemory,
+                 "GpuRingBuffer: size larger than capacity"));
+  }
+
+  const std::size_t offset =
+      (write_head_ + (alignment - 1)) & ~(alignment - 1);
+  if (offset + size > capacity_) {
+    return NavaryResult<BufferReservation>(NavaryRC(
+        NavaryStatus::kOutOfMemory, "GpuRingBuffer: frame budget exhausted"));
+  }
+
+  BufferReservation reservation{};
+  reservation.slice = BufferSlice{handle_, offset, size};
+  reservation.data  = mapped_ptr_ + offset;
+  write_head_       = offset + size;
+
+  return NavaryResult<BufferReservation>(reservation);
+}
+
 void GpuRingBuffer::ResetFrame() {
   // Optional: write_head_ = 0; if you want strict per-frame.
   write_head_ = 0;
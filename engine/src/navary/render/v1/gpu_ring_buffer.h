@@ -22,6 +22,13 @@ struct BufferSlice {
   std::size_t size;
 };
 
+// Writable window into the ring. `data` points at the mapped bytes backing
+// `slice`, so callers can fill it in place instead of staging and copying.
+struct BufferReservation {
+  BufferSlice slice;
+  std::uint8_t* data;
+};
+
 class GpuRingBuffer {
  public:
   GpuRingBuffer();
@@ -33,10 +40,25 @@ class GpuRingBuffer {
   NavaryResult<BufferSlice> AllocateAndWrite(const void* data,
                                                std::size_t size);
 
+  // Reserves |size| bytes at an offset aligned to |alignment| (power of two).
+  // Nothing is copied; the caller writes through BufferReservation::data.
+  // Allocations never wrap over data written since ResetFrame(): when the
+  // frame's space runs out both calls return kOutOfMemory.
+  NavaryResult<BufferReservation> Reserve(std::size_t size,
+                                          std::size_t alignment = 16);
+
   core::BufferHandle handle() const {
     return handle_;
   }
 
+  std::size_t capacity() const {
+    return capacity_;
+  }
+
+  std::size_t write_head() const {
+    return write_head_;
+  }
+
   void ResetFrame();
 
  private:
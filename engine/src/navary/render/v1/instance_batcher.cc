@@ -0,0 +1,176 @@
+// navary/render/v1/instance_batcher.cc
+// Implementation of InstanceBatchBuilder (instanced indirect draw builder).
+// This file is part of the Navary rendering engine.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include "navary/render/v1/instance_batcher.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace navary::render::v1 {
+
+InstanceBatchBuilder::InstanceBatchBuilder()
+    : entries_(nullptr), batches_(nullptr), capacity_(0) {}
+
+InstanceBatchBuilder::~InstanceBatchBuilder() {
+  std::free(entries_);
+  std::free(batches_);
+}
+
+NavaryRC InstanceBatchBuilder::Init(std::uint32_t max_instances) {
+  std::free(entries_);
+  std::free(batches_);
+  entries_  = nullptr;
+  batches_  = nullptr;
+  capacity_ = 0;
+
+  if (max_instances == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "InstanceBatchBuilder: max_instances must be > 0");
+  }
+
+  entries_ =
+      static_cast<SortEntry*>(std::malloc(sizeof(SortEntry) * max_instances));
+  if (entries_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "InstanceBatchBuilder: entries alloc failed");
+  }
+
+  // Worst case every instance opens its own batch.
+  batches_ = static_cast<IndirectBatch*>(
+      std::malloc(sizeof(IndirectBatch) * max_instances));
+  if (batches_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "InstanceBatchBuilder: batches alloc failed");
+  }
+
+  capacity_ = max_instances;
+  return NavaryRC::OK();
+}
+
+NavaryRC InstanceBatchBuilder::Build(const VisibleInstance* instances,
+                                     std::uint32_t count,
+                                     GpuRingBuffer* instance_ring,
+                                     GpuRingBuffer* indirect_ring,
+                                     InstanceBatchOutput* out) {
+  if (out == nullptr || instance_ring == nullptr || indirect_ring == nullptr ||
+      (instances == nullptr && count > 0)) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "InstanceBatchBuilder: null argument");
+  }
+
+  *out = InstanceBatchOutput{};
+  if (count == 0) {
+    return NavaryRC::OK();
+  }
+
+  if (count > capacity_) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "InstanceBatchBuilder: too many instances");
+  }
+
+  for (std::uint32_t i = 0; i < count; ++i) {
+    const VisibleInstance& inst = instances[i];
+    entries_[i].key = MakeDrawSortKey(inst.pipeline, inst.material, inst.mesh);
+    entries_[i].index = i;
+  }
+
+  // Index tie-break keeps the output deterministic for equal keys.
+  std::sort(entries_, entries_ + count,
+            [](const SortEntry& a, const SortEntry& b) {
+              return a.key < b.key || (a.key == b.key && a.index < b.index);
+            });
+
+  // Pass 1: count commands so the indirect slice is reserved exactly.
+  std::uint32_t command_count = 0;
+  for (std::uint32_t i = 0; i < count; ++i) {
+    const VisibleInstance& inst = instances[entries_[i].index];
+    const bool merges = i > 0 && inst.instanced &&
+                        instances[entries_[i - 1].index].instanced &&
+                        entries_[i].key == entries_[i - 1].key;
+    if (!merges) {
+      ++command_count;
+    }
+  }
+
+  // Aligned to a whole record so the slice starts at an InstanceData index
+  // of the buffer (also satisfies std430's 16-byte mat4 alignment).
+  NavaryResult<BufferReservation> inst_or = instance_ring->Reserve(
+      sizeof(InstanceData) * count, sizeof(InstanceData));
+  if (!inst_or.status().ok()) {
+    return inst_or.status();
+  }
+
+  NavaryResult<BufferReservation> cmd_or = indirect_ring->Reserve(
+      sizeof(DrawIndexedIndirectCommand) * command_count, 4);
+  if (!cmd_or.status().ok()) {
+    return cmd_or.status();
+  }
+
+  const BufferReservation inst_res = inst_or.value();
+  const BufferReservation cmd_res  = cmd_or.value();
+
+  auto* inst_dst = reinterpret_cast<InstanceData*>(inst_res.data);
+  auto* cmd_dst  = reinterpret_cast<DrawIndexedIndirectCommand*>(cmd_res.data);
+  const auto first_record = static_cast<std::uint32_t>(
+      inst_res.slice.offset / sizeof(InstanceData));
+
+  // Pass 2: write transforms in sorted order so each command's instances are
+  // contiguous, then open commands/batches on key changes.
+  std::uint32_t cmd_index   = 0;
+  std::uint32_t batch_count = 0;
+  DrawIndexedIndirectCommand* cmd = nullptr;
+  IndirectBatch* batch            = nullptr;
+
+  for (std::uint32_t i = 0; i < count; ++i) {
+    const DrawSortKey key       = entries_[i].key;
+    const VisibleInstance& inst = instances[entries_[i].index];
+
+    std::memcpy(inst_dst[i].world, inst.world.data(), sizeof(InstanceData));
+
+    const bool merges = i > 0 && inst.instanced &&
+                        instances[entries_[i - 1].index].instanced &&
+                        key == entries_[i - 1].key;
+    if (merges) {
+      ++cmd->instance_count;
+      continue;
+    }
+
+    cmd                 = &cmd_dst[cmd_index];
+    cmd->index_count    = inst.range.index_count;
+    cmd->instance_count = 1;
+    cmd->first_index    = inst.range.first_index;
+    cmd->vertex_offset  = inst.range.vertex_offset;
+    cmd->first_instance = first_record + i;
+
+    if (batch == nullptr ||
+        SortKeyStatePrefix(batch->sort_key) != SortKeyStatePrefix(key)) {
+      batch                  = &batches_[batch_count++];
+      batch->sort_key        = key;
+      batch->pipeline        = inst.pipeline;
+      batch->material        = inst.material;
+      batch->first_command   = cmd_index;
+      batch->command_count   = 0;
+      batch->indirect_offset = cmd_res.slice.offset +
+                               sizeof(DrawIndexedIndirectCommand) * cmd_index;
+    }
+
+    ++batch->command_count;
+    ++cmd_index;
+  }
+
+  out->instance_slice = inst_res.slice;
+  out->indirect_slice = cmd_res.slice;
+  out->commands       = cmd_dst;
+  out->batches        = batches_;
+  out->instance_count = count;
+  out->command_count  = command_count;
+  out->batch_count    = batch_count;
+
+  return NavaryRC::OK();
+}
+
+}  // namespace navary::render::v1
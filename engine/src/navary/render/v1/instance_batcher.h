@@ -0,0 +1,124 @@
+#pragma once
+
+// navary/render/v1/instance_batcher.h
+// Groups culled visible instances into instanced indirect draws.
+// Purpose:
+//   Sort visible instances by DrawSortKey, write per-instance transforms
+//   into a GpuRingBuffer slice and emit VkDrawIndexedIndirectCommand
+//   compatible records, so thousands of draws collapse into a handful of
+//   multi-draw indirect calls (one per pipeline + material run).
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstddef>
+#include <cstdint>
+
+#include "navary/navary_status.h"
+#include "navary/core/handles.h"
+#include "navary/math/mat4.h"
+#include "navary/render/v1/draw_sort_key.h"
+#include "navary/render/v1/gpu_ring_buffer.h"
+
+namespace navary::render::v1 {
+
+// Binary compatible with VkDrawIndexedIndirectCommand.
+struct DrawIndexedIndirectCommand {
+  std::uint32_t index_count;
+  std::uint32_t instance_count;
+  std::uint32_t first_index;
+  std::int32_t vertex_offset;
+  std::uint32_t first_instance;
+};
+
+static_assert(sizeof(DrawIndexedIndirectCommand) == 20,
+              "DrawIndexedIndirectCommand must match "
+              "VkDrawIndexedIndirectCommand");
+
+// Per-instance GPU record. Matches a std430 `mat4` (column-major), indexed in
+// the vertex shader by gl_InstanceIndex (first_instance + instance id).
+// first_instance counts records from the start of the instance buffer, so
+// the buffer is bound at offset 0, not at instance_slice.offset.
+struct InstanceData {
+  float world[16];
+};
+
+static_assert(sizeof(InstanceData) == 64, "InstanceData must be one mat4");
+
+// Index range of a mesh inside the shared index/vertex buffers.
+struct MeshDrawRange {
+  std::uint32_t index_count;
+  std::uint32_t first_index;
+  std::int32_t vertex_offset;
+};
+
+// One culled, visible instance as produced by the visibility pass.
+struct VisibleInstance {
+  core::PipelineHandle pipeline;
+  core::MaterialHandle material;
+  core::MeshHandle mesh;
+  MeshDrawRange range;
+  bool instanced;  // Material::instanced; false -> one command per instance.
+  math::Mat4 world;
+};
+
+// One multi-draw indirect call: consecutive commands that share the same
+// pipeline and material (vkCmdDrawIndexedIndirect with drawCount > 1).
+struct IndirectBatch {
+  DrawSortKey sort_key;  // key of the first command in the batch
+  core::PipelineHandle pipeline;
+  core::MaterialHandle material;
+  std::uint32_t first_command;  // index into InstanceBatchOutput::commands
+  std::uint32_t command_count;  // drawCount
+  std::size_t indirect_offset;  // byte offset inside indirect_slice.buffer
+};
+
+struct InstanceBatchOutput {
+  BufferSlice instance_slice;  // InstanceData[instance_count]
+  BufferSlice indirect_slice;  // DrawIndexedIndirectCommand[command_count]
+
+  // CPU views of the written records. Commands point into mapped ring memory;
+  // batches are owned by the builder and valid until the next Build().
+  const DrawIndexedIndirectCommand* commands;
+  const IndirectBatch* batches;
+
+  std::uint32_t instance_count;
+  std::uint32_t command_count;
+  std::uint32_t batch_count;
+};
+
+// Builds instanced indirect draws from a visible instance list.
+// Scratch arrays are sized once by Init(); Build() does not allocate.
+class InstanceBatchBuilder {
+ public:
+  InstanceBatchBuilder();
+  ~InstanceBatchBuilder();
+
+  InstanceBatchBuilder(const InstanceBatchBuilder&)            = delete;
+  InstanceBatchBuilder& operator=(const InstanceBatchBuilder&) = delete;
+
+  // kInvalidArgument when |max_instances| is 0.
+  NavaryRC Init(std::uint32_t max_instances);
+
+  // Sorts |instances| by DrawSortKey and writes transforms into
+  // |instance_ring| and indirect commands into |indirect_ring|. Both rings may
+  // be the same object if the buffer carries both usages.
+  NavaryRC Build(const VisibleInstance* instances, std::uint32_t count,
+                 GpuRingBuffer* instance_ring, GpuRingBuffer* indirect_ring,
+                 InstanceBatchOutput* out);
+
+  std::uint32_t capacity() const {
+    return capacity_;
+  }
+
+ private:
+  struct SortEntry {
+    DrawSortKey key;
+    std::uint32_t index;
+  };
+
+  SortEntry* entries_;
+  IndirectBatch* batches_;
+  std::uint32_t capacity_;
+};
+
+}  // namespace navary::render::v1
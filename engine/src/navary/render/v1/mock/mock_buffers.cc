@@ -0,0 +1,136 @@
+// navary/render/v1/mock/mock_buffers.cc
+// Implementation of MockBufferHeap and MockUploadBackend.
+// This file is part of the Navary rendering engine.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include "navary/render/v1/mock/mock_buffers.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "navary/core/time/profiler_time.h"
+
+namespace navary::render::v1::mock {
+
+// ------------------------------------------------------------
+// MockBufferHeap
+// ------------------------------------------------------------
+
+MockBufferHeap::MockBufferHeap()
+    : entries_(nullptr), capacity_(0), count_(0) {}
+
+MockBufferHeap::~MockBufferHeap() {
+  for (std::uint32_t i = 0; i < count_; ++i) {
+    std::free(entries_[i].data);
+  }
+  std::free(entries_);
+}
+
+NavaryRC MockBufferHeap::Init(std::uint32_t max_buffers) {
+  if (entries_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MockBufferHeap: already initialized");
+  }
+  if (max_buffers == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MockBufferHeap: max_buffers must be > 0");
+  }
+
+  entries_ = static_cast<Entry*>(std::calloc(max_buffers, sizeof(Entry)));
+  if (entries_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "MockBufferHeap: entries alloc failed");
+  }
+
+  capacity_ = max_buffers;
+  count_    = 0;
+  return NavaryRC::OK();
+}
+
+NavaryResult<MockBuffer> MockBufferHeap::CreateBuffer(std::size_t size) {
+  if (size == 0) {
+    return NavaryResult<MockBuffer>(NavaryRC(
+        NavaryStatus::kInvalidArgument, "MockBufferHeap: empty buffer"));
+  }
+  if (count_ >= capacity_) {
+    return NavaryResult<MockBuffer>(
+        NavaryRC(NavaryStatus::kOutOfMemory, "MockBufferHeap: no free slots"));
+  }
+
+  auto* data = static_cast<std::uint8_t*>(std::calloc(size, 1));
+  if (data == nullptr) {
+    return NavaryResult<MockBuffer>(NavaryRC(
+        NavaryStatus::kOutOfMemory, "MockBufferHeap: buffer alloc failed"));
+  }
+
+  const std::uint32_t index = count_++;
+  entries_[index]           = Entry{data, size};
+  return NavaryResult<MockBuffer>(
+      MockBuffer{core::BufferHandle{index}, data, size});
+}
+
+std::uint8_t* MockBufferHeap::Map(core::BufferHandle handle) const {
+  return handle.index < count_ ? entries_[handle.index].data : nullptr;
+}
+
+std::size_t MockBufferHeap::Size(core::BufferHandle handle) const {
+  return handle.index < count_ ? entries_[handle.index].size : 0;
+}
+
+// ------------------------------------------------------------
+// MockUploadBackend
+// ------------------------------------------------------------
+
+MockUploadBackend::MockUploadBackend(MockBufferHeap* heap)
+    : heap_(heap), stats_{}, timing_(false) {}
+
+NavaryRC MockUploadBackend::CopyBufferRegions(core::BufferHandle staging,
+                                              core::BufferHandle dst,
+                                              const BufferCopyRegion* regions,
+                                              std::uint32_t count) {
+  const std::uint64_t start = timing_ ? core::time::ProfilerNowTicks() : 0;
+  ++stats_.buffer_copies.calls;
+  stats_.buffer_regions += count;
+
+  const std::uint8_t* src    = heap_->Map(staging);
+  std::uint8_t* out          = heap_->Map(dst);
+  const std::size_t src_size = heap_->Size(staging);
+  const std::size_t dst_size = heap_->Size(dst);
+
+  bool failed = false;
+  for (std::uint32_t i = 0; i < count; ++i) {
+    const BufferCopyRegion& r = regions[i];
+    if (src == nullptr || out == nullptr ||
+        r.src_offset + r.size > src_size || r.dst_offset + r.size > dst_size) {
+      ++stats_.buffer_copies.failures;
+      failed = true;
+      continue;
+    }
+    std::memcpy(out + r.dst_offset, src + r.src_offset, r.size);
+    stats_.bytes += r.size;
+  }
+
+  if (timing_) {
+    stats_.buffer_copies.total_ns += core::time::ProfilerNowTicks() - start;
+  }
+  if (failed) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MockUploadBackend: copy region out of range");
+  }
+  return NavaryRC::OK();
+}
+
+NavaryRC MockUploadBackend::CopyTextureRegions(
+    core::BufferHandle /*staging*/, core::TextureHandle /*dst*/,
+    const TextureCopyRegion* regions, std::uint32_t count) {
+  ++stats_.texture_copies.calls;
+  stats_.texture_regions += count;
+  for (std::uint32_t i = 0; i < count; ++i) {
+    stats_.texels += static_cast<std::uint64_t>(regions[i].width) *
+                     regions[i].height;
+  }
+  return NavaryRC::OK();
+}
+
+}  // namespace navary::render::v1::mock
@@ -0,0 +1,103 @@
+#pragma once
+
+// navary/render/v1/mock/mock_buffers.h
+// Host-memory buffers standing in for mapped GPU buffers, and an
+// UploadBackend that executes staging copies on them immediately.
+// Lets GpuRingBuffer, UploadManager and MaterialParamBuffer run end to end
+// without a device; buffer contents are what the GPU would have seen.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstddef>
+#include <cstdint>
+
+#include "navary/core/handles.h"
+#include "navary/navary_status.h"
+#include "navary/render/v1/mock/mock_descriptor_allocator.h"
+#include "navary/render/v1/upload_manager.h"
+
+namespace navary::render::v1::mock {
+
+struct MockBuffer {
+  core::BufferHandle handle;
+  std::uint8_t* mapped;
+  std::size_t size;
+};
+
+class MockBufferHeap {
+ public:
+  MockBufferHeap();
+  ~MockBufferHeap();
+
+  MockBufferHeap(const MockBufferHeap&)            = delete;
+  MockBufferHeap& operator=(const MockBufferHeap&) = delete;
+
+  NavaryRC Init(std::uint32_t max_buffers);
+
+  // Zero-filled host buffer, "persistently mapped" for its lifetime.
+  NavaryResult<MockBuffer> CreateBuffer(std::size_t size);
+
+  // nullptr if |handle| was never created.
+  std::uint8_t* Map(core::BufferHandle handle) const;
+  std::size_t Size(core::BufferHandle handle) const;
+
+  std::uint32_t buffer_count() const {
+    return count_;
+  }
+
+ private:
+  struct Entry {
+    std::uint8_t* data;
+    std::size_t size;
+  };
+
+  Entry* entries_;
+  std::uint32_t capacity_;
+  std::uint32_t count_;
+};
+
+struct MockUploadStats {
+  MockCallStats buffer_copies;  // one call per destination
+  MockCallStats texture_copies;
+  std::uint64_t buffer_regions;
+  std::uint64_t texture_regions;
+  std::uint64_t bytes;   // buffer bytes copied
+  std::uint64_t texels;  // texture texels copied
+};
+
+class MockUploadBackend : public UploadBackend {
+ public:
+  // |heap| owns both the staging buffer and the destinations; not null.
+  explicit MockUploadBackend(MockBufferHeap* heap);
+
+  void set_timing_enabled(bool enabled) {
+    timing_ = enabled;
+  }
+
+  // Buffer copies are applied to |heap|. Out-of-range regions are counted
+  // as failures and skipped, and the call returns kInvalidArgument after
+  // applying the valid ones. Texture copies are counted only.
+  NavaryRC CopyBufferRegions(core::BufferHandle staging,
+                             core::BufferHandle dst,
+                             const BufferCopyRegion* regions,
+                             std::uint32_t count) override;
+
+  NavaryRC CopyTextureRegions(core::BufferHandle staging,
+                              core::TextureHandle dst,
+                              const TextureCopyRegion* regions,
+                              std::uint32_t count) override;
+
+  const MockUploadStats& stats() const {
+    return stats_;
+  }
+  void ResetStats() {
+    stats_ = MockUploadStats{};
+  }
+
+ private:
+  MockBufferHeap* heap_;
+  MockUploadStats stats_;
+  bool timing_;
+};
+
+}  // namespace navary::render::v1::mock
@@ -0,0 +1,263 @@
+// navary/render/v1/mock/mock_command_backend.cc
+// Implementation of MockCommandList and MockCommandBackend.
+// This file is part of the Navary rendering engine.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include "navary/render/v1/mock/mock_command_backend.h"
+
+namespace navary::render::v1::mock {
+
+namespace {
+
+constexpr std::uint64_t kFnvOffset = 1469598103934665603ull;
+constexpr std::uint64_t kFnvPrime  = 1099511628211ull;
+
+enum CommandTag : std::uint64_t {
+  kTagPipeline = 1,
+  kTagDescriptor,
+  kTagVertexBuffer,
+  kTagIndexBuffer,
+  kTagPushConstants,
+  kTagDraw,
+  kTagDrawIndirect,
+};
+
+inline std::uint64_t Fnv(std::uint64_t h, std::uint64_t v) {
+  for (int i = 0; i < 8; ++i) {
+    h ^= (v >> (i * 8)) & 0xFFu;
+    h *= kFnvPrime;
+  }
+  return h;
+}
+
+}  // namespace
+
+// ------------------------------------------------------------
+// MockCommandList
+// ------------------------------------------------------------
+
+MockCommandList::MockCommandList()
+    : counts_{},
+      command_hash_(kFnvOffset),
+      work_per_command_(0),
+      ended_(false) {}
+
+void MockCommandList::Reset(std::uint32_t work_per_command) {
+  counts_           = MockCommandCounts{};
+  command_hash_     = kFnvOffset;
+  work_per_command_ = work_per_command;
+  ended_            = false;
+  draw_log_.clear();
+}
+
+void MockCommandList::Mix(std::uint64_t v) {
+  command_hash_ = Fnv(command_hash_, v);
+}
+
+// Emulates the CPU cost a driver spends per recorded command.
+void MockCommandList::Spin() {
+  std::uint64_t h = command_hash_;
+  for (std::uint32_t i = 0; i < work_per_command_; ++i) {
+    h = (h ^ i) * kFnvPrime;
+  }
+  // Keep the loop observable without changing the recorded hash.
+  volatile std::uint64_t sink = h;
+  (void)sink;
+}
+
+void MockCommandList::BindPipeline(core::PipelineHandle pipeline) {
+  ++counts_.pipeline_binds;
+  Mix(kTagPipeline);
+  Mix(pipeline.index);
+  Spin();
+}
+
+void MockCommandList::BindDescriptorSet(std::uint32_t set_index,
+                                        core::DescriptorHandle set) {
+  ++counts_.descriptor_binds;
+  Mix(kTagDescriptor);
+  Mix((static_cast<std::uint64_t>(set_index) << 32) | set.index);
+  Spin();
+}
+
+void MockCommandList::BindVertexBuffer(core::BufferHandle buffer,
+                                       std::size_t offset) {
+  ++counts_.vertex_buffer_binds;
+  Mix(kTagVertexBuffer);
+  Mix(buffer.index);
+  Mix(offset);
+  Spin();
+}
+
+void MockCommandList::BindIndexBuffer(core::BufferHandle buffer,
+                                      std::size_t offset) {
+  ++counts_.index_buffer_binds;
+  Mix(kTagIndexBuffer);
+  Mix(buffer.index);
+  Mix(offset);
+  Spin();
+}
+
+void MockCommandList::PushConstants(const void* data, std::uint32_t size) {
+  ++counts_.push_constants;
+  Mix(kTagPushConstants);
+  const auto* bytes = static_cast<const std::uint8_t*>(data);
+  for (std::uint32_t i = 0; i < size && bytes != nullptr; ++i) {
+    Mix(bytes[i]);
+  }
+  Spin();
+}
+
+void MockCommandList::DrawIndexed(std::uint32_t index_count,
+                                  std::uint32_t instance_count,
+                                  std::uint32_t first_index,
+                                  std::int32_t vertex_offset,
+                                  std::uint32_t first_instance) {
+  ++counts_.draws;
+
+  std::uint64_t d = Fnv(kFnvOffset, kTagDraw);
+  d = Fnv(d, (static_cast<std::uint64_t>(index_count) << 32) | instance_count);
+  d = Fnv(d, (static_cast<std::uint64_t>(first_index) << 32) |
+                 static_cast<std::uint32_t>(vertex_offset));
+  d = Fnv(d, first_instance);
+  draw_log_.push_back(d);
+
+  Mix(d);
+  Spin();
+}
+
+void MockCommandList::DrawIndexedIndirect(core::BufferHandle buffer,
+                                          std::size_t offset,
+                                          std::uint32_t draw_count,
+                                          std::uint32_t stride) {
+  ++counts_.indirect_draws;
+
+  std::uint64_t d = Fnv(kFnvOffset, kTagDrawIndirect);
+  d = Fnv(d, buffer.index);
+  d = Fnv(d, offset);
+  d = Fnv(d, (static_cast<std::uint64_t>(draw_count) << 32) | stride);
+  draw_log_.push_back(d);
+
+  Mix(d);
+  Spin();
+}
+
+// ------------------------------------------------------------
+// MockCommandBackend
+// ------------------------------------------------------------
+
+MockCommandBackend::MockCommandBackend()
+    : pools_(nullptr),
+      worker_count_(0),
+      lists_per_worker_(0),
+      work_per_command_(0),
+      frame_slot_(0),
+      primary_counts_{},
+      primary_draw_hash_(kFnvOffset),
+      executed_secondaries_(0) {}
+
+MockCommandBackend::~MockCommandBackend() {
+  if (pools_ != nullptr) {
+    for (std::uint32_t w = 0; w < worker_count_; ++w) {
+      delete[] pools_[w].lists;
+    }
+    delete[] pools_;
+  }
+}
+
+NavaryRC MockCommandBackend::Init(std::uint32_t worker_count,
+                                  std::uint32_t lists_per_worker,
+                                  std::uint32_t work_per_command) {
+  if (pools_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MockCommandBackend: already initialized");
+  }
+  if (worker_count == 0 || lists_per_worker == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MockCommandBackend: counts must be > 0");
+  }
+
+  pools_ = new WorkerPool[worker_count];
+  for (std::uint32_t w = 0; w < worker_count; ++w) {
+    pools_[w].lists  = new MockCommandList[lists_per_worker];
+    pools_[w].cursor = 0;
+  }
+
+  worker_count_     = worker_count;
+  lists_per_worker_ = lists_per_worker;
+  work_per_command_ = work_per_command;
+  return BeginFrame(0);
+}
+
+NavaryRC MockCommandBackend::BeginFrame(std::uint32_t frame_slot) {
+  for (std::uint32_t w = 0; w < worker_count_; ++w) {
+    pools_[w].cursor = 0;
+  }
+  frame_slot_           = frame_slot;
+  primary_counts_       = MockCommandCounts{};
+  primary_draw_hash_    = kFnvOffset;
+  executed_secondaries_ = 0;
+  return NavaryRC::OK();
+}
+
+NavaryResult<CommandList*> MockCommandBackend::BeginSecondary(
+    std::uint32_t worker) {
+  if (worker >= worker_count_) {
+    return NavaryResult<CommandList*>(
+        NavaryRC(NavaryStatus::kInvalidArgument,
+                 "MockCommandBackend: worker index out of range"));
+  }
+
+  WorkerPool& pool = pools_[worker];
+  if (pool.cursor >= lists_per_worker_) {
+    return NavaryResult<CommandList*>(NavaryRC(
+        NavaryStatus::kOutOfMemory, "MockCommandBackend: worker pool empty"));
+  }
+
+  MockCommandList* list = &pool.lists[pool.cursor++];
+  list->Reset(work_per_command_);
+  return NavaryResult<CommandList*>(list);
+}
+
+NavaryRC MockCommandBackend::EndSecondary(std::uint32_t worker,
+                                          CommandList* list) {
+  if (worker >= worker_count_ || list == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MockCommandBackend: invalid EndSecondary");
+  }
+  static_cast<MockCommandList*>(list)->set_ended(true);
+  return NavaryRC::OK();
+}
+
+NavaryRC MockCommandBackend::ExecuteSecondaries(CommandList* const* lists,
+                                                std::uint32_t count) {
+  for (std::uint32_t i = 0; i < count; ++i) {
+    const auto* list = static_cast<const MockCommandList*>(lists[i]);
+    if (list == nullptr || !list->ended()) {
+      return NavaryRC(NavaryStatus::kInvalidArgument,
+                      "MockCommandBackend: executing unfinished list");
+    }
+
+    const MockCommandCounts& c = list->counts();
+    primary_counts_.pipeline_binds += c.pipeline_binds;
+    primary_counts_.descriptor_binds += c.descriptor_binds;
+    primary_counts_.vertex_buffer_binds += c.vertex_buffer_binds;
+    primary_counts_.index_buffer_binds += c.index_buffer_binds;
+    primary_counts_.push_constants += c.push_constants;
+    primary_counts_.draws += c.draws;
+    primary_counts_.indirect_draws += c.indirect_draws;
+
+    for (std::uint64_t d : list->draw_log()) {
+      primary_draw_hash_ = Fnv(primary_draw_hash_, d);
+    }
+    ++executed_secondaries_;
+  }
+  return NavaryRC::OK();
+}
+
+std::uint32_t MockCommandBackend::lists_begun(std::uint32_t worker) const {
+  return worker < worker_count_ ? pools_[worker].cursor : 0;
+}
+
+}  // namespace navary::render::v1::mock
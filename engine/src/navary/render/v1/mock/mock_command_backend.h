@@ -0,0 +1,152 @@
+#pragma once
+
+// navary/render/v1/mock/mock_command_backend.h
+// GPU-free CommandBackend that counts and hashes recorded commands.
+// Used by tests and benchmarks to measure recording scaling on the CPU
+// alone. An optional per-command spin emulates driver recording cost.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "navary/core/handles.h"
+#include "navary/navary_status.h"
+#include "navary/render/v1/command_list.h"
+
+namespace navary::render::v1::mock {
+
+struct MockCommandCounts {
+  std::uint64_t pipeline_binds;
+  std::uint64_t descriptor_binds;
+  std::uint64_t vertex_buffer_binds;
+  std::uint64_t index_buffer_binds;
+  std::uint64_t push_constants;
+  std::uint64_t draws;
+  std::uint64_t indirect_draws;
+
+  std::uint64_t total() const {
+    return pipeline_binds + descriptor_binds + vertex_buffer_binds +
+           index_buffer_binds + push_constants + draws + indirect_draws;
+  }
+};
+
+class MockCommandList : public CommandList {
+ public:
+  MockCommandList();
+
+  void Reset(std::uint32_t work_per_command);
+
+  void BindPipeline(core::PipelineHandle pipeline) override;
+  void BindDescriptorSet(std::uint32_t set_index,
+                         core::DescriptorHandle set) override;
+  void BindVertexBuffer(core::BufferHandle buffer,
+                        std::size_t offset) override;
+  void BindIndexBuffer(core::BufferHandle buffer, std::size_t offset) override;
+  void PushConstants(const void* data, std::uint32_t size) override;
+  void DrawIndexed(std::uint32_t index_count, std::uint32_t instance_count,
+                   std::uint32_t first_index, std::int32_t vertex_offset,
+                   std::uint32_t first_instance) override;
+  void DrawIndexedIndirect(core::BufferHandle buffer, std::size_t offset,
+                           std::uint32_t draw_count,
+                           std::uint32_t stride) override;
+
+  const MockCommandCounts& counts() const {
+    return counts_;
+  }
+
+  // FNV-1a over every command and its arguments, in recording order.
+  std::uint64_t command_hash() const {
+    return command_hash_;
+  }
+
+  // Per-draw hashes (draw arguments only), in recording order.
+  const std::vector<std::uint64_t>& draw_log() const {
+    return draw_log_;
+  }
+
+  bool ended() const {
+    return ended_;
+  }
+  void set_ended(bool ended) {
+    ended_ = ended;
+  }
+
+ private:
+  void Mix(std::uint64_t v);
+  void Spin();
+
+  MockCommandCounts counts_;
+  std::uint64_t command_hash_;
+  std::vector<std::uint64_t> draw_log_;
+  std::uint32_t work_per_command_;
+  bool ended_;
+};
+
+class MockCommandBackend : public CommandBackend {
+ public:
+  MockCommandBackend();
+  ~MockCommandBackend() override;
+
+  MockCommandBackend(const MockCommandBackend&)            = delete;
+  MockCommandBackend& operator=(const MockCommandBackend&) = delete;
+
+  // |work_per_command| spins that many hash rounds per recorded command.
+  NavaryRC Init(std::uint32_t worker_count, std::uint32_t lists_per_worker,
+                std::uint32_t work_per_command = 0);
+
+  // ---- CommandBackend ----
+
+  NavaryRC BeginFrame(std::uint32_t frame_slot) override;
+
+  std::uint32_t worker_count() const override {
+    return worker_count_;
+  }
+
+  NavaryResult<CommandList*> BeginSecondary(std::uint32_t worker) override;
+  NavaryRC EndSecondary(std::uint32_t worker, CommandList* list) override;
+  NavaryRC ExecuteSecondaries(CommandList* const* lists,
+                              std::uint32_t count) override;
+
+  // ---- Inspection (main thread, after ExecuteSecondaries) ----
+
+  const MockCommandCounts& primary_counts() const {
+    return primary_counts_;
+  }
+
+  // Hash of the draw stream as the GPU would see it; independent of how the
+  // stream was split into secondaries.
+  std::uint64_t primary_draw_hash() const {
+    return primary_draw_hash_;
+  }
+
+  std::uint32_t executed_secondaries() const {
+    return executed_secondaries_;
+  }
+
+  // Secondaries begun on |worker| since BeginFrame().
+  std::uint32_t lists_begun(std::uint32_t worker) const;
+
+  std::uint32_t frame_slot() const {
+    return frame_slot_;
+  }
+
+ private:
+  struct alignas(64) WorkerPool {
+    MockCommandList* lists;
+    std::uint32_t cursor;
+  };
+
+  WorkerPool* pools_;
+  std::uint32_t worker_count_;
+  std::uint32_t lists_per_worker_;
+  std::uint32_t work_per_command_;
+  std::uint32_t frame_slot_;
+
+  MockCommandCounts primary_counts_;
+  std::uint64_t primary_draw_hash_;
+  std::uint32_t executed_secondaries_;
+};
+
+}  // namespace navary::render::v1::mock
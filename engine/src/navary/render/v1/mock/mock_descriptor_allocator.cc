@@ -0,0 +1,179 @@
+// navary/render/v1/mock/mock_descriptor_allocator.cc
+// Implementation of MockDescriptorAllocator.
+// This file is part of the Navary rendering engine.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include "navary/render/v1/mock/mock_descriptor_allocator.h"
+
+#include <cstdlib>
+
+#include "navary/core/time/profiler_time.h"
+
+namespace navary::render::v1::mock {
+
+namespace {
+
+// Adds elapsed time to |stats| when enabled; counts every call.
+class ScopedCall {
+ public:
+  ScopedCall(MockCallStats* stats, bool timing)
+      : stats_(stats),
+        start_(timing ? core::time::ProfilerNowTicks() : 0),
+        timing_(timing) {
+    ++stats_->calls;
+  }
+
+  ~ScopedCall() {
+    if (timing_) {
+      stats_->total_ns += core::time::ProfilerNowTicks() - start_;
+    }
+  }
+
+  void Fail() {
+    ++stats_->failures;
+  }
+
+ private:
+  MockCallStats* stats_;
+  std::uint64_t start_;
+  bool timing_;
+};
+
+}  // namespace
+
+MockDescriptorAllocator::MockDescriptorAllocator()
+    : limits_{},
+      bindings_(nullptr),
+      layouts_(nullptr),
+      count_(0),
+      stats_{},
+      timing_(false) {}
+
+MockDescriptorAllocator::~MockDescriptorAllocator() {
+  std::free(bindings_);
+  std::free(layouts_);
+}
+
+NavaryRC MockDescriptorAllocator::Init(const MockDescriptorLimits& limits) {
+  if (limits.max_sets == 0 || limits.max_bindings == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MockDescriptorAllocator: limits must be > 0");
+  }
+
+  std::free(bindings_);
+  std::free(layouts_);
+
+  bindings_ = static_cast<MockBinding*>(
+      std::calloc(static_cast<std::size_t>(limits.max_sets) *
+                      limits.max_bindings,
+                  sizeof(MockBinding)));
+  layouts_ = static_cast<core::DescriptorSetLayoutHandle*>(std::malloc(
+      sizeof(core::DescriptorSetLayoutHandle) * limits.max_sets));
+  if (bindings_ == nullptr || layouts_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "MockDescriptorAllocator: storage alloc failed");
+  }
+
+  limits_ = limits;
+  count_  = 0;
+  stats_  = MockDescriptorStats{};
+  return NavaryRC::OK();
+}
+
+void MockDescriptorAllocator::Reset() {
+  count_ = 0;
+}
+
+MockBinding* MockDescriptorAllocator::FindBinding(core::DescriptorHandle set,
+                                                  std::uint32_t binding) {
+  if (set.index >= count_ || binding >= limits_.max_bindings) {
+    return nullptr;
+  }
+  return &bindings_[static_cast<std::size_t>(set.index) *
+                        limits_.max_bindings +
+                    binding];
+}
+
+NavaryResult<core::DescriptorHandle> MockDescriptorAllocator::Allocate(
+    core::DescriptorSetLayoutHandle layout) {
+  ScopedCall call(&stats_.allocate, timing_);
+
+  if (layout.index >= limits_.layout_count) {
+    call.Fail();
+    return NavaryResult<core::DescriptorHandle>(
+        NavaryRC(NavaryStatus::kInvalidArgument,
+                 "MockDescriptorAllocator: invalid layout handle"));
+  }
+  if (count_ >= limits_.max_sets) {
+    call.Fail();
+    return NavaryResult<core::DescriptorHandle>(
+        NavaryRC(NavaryStatus::kOutOfMemory,
+                 "MockDescriptorAllocator: descriptor set capacity exceeded"));
+  }
+
+  const std::uint32_t index = count_++;
+  layouts_[index]           = layout;
+  MockBinding* first =
+      &bindings_[static_cast<std::size_t>(index) * limits_.max_bindings];
+  for (std::uint32_t b = 0; b < limits_.max_bindings; ++b) {
+    first[b] = MockBinding{};
+  }
+  return NavaryResult<core::DescriptorHandle>(core::DescriptorHandle{index});
+}
+
+NavaryRC MockDescriptorAllocator::WriteImageSampler(
+    core::DescriptorHandle set, std::uint32_t binding,
+    core::TextureHandle texture) {
+  ScopedCall call(&stats_.write_image, timing_);
+
+  MockBinding* slot = FindBinding(set, binding);
+  if (slot == nullptr || texture.index >= limits_.texture_count) {
+    call.Fail();
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MockDescriptorAllocator: WriteImageSampler invalid arg");
+  }
+
+  slot->kind    = MockBindingKind::kImageSampler;
+  slot->texture = texture;
+  return NavaryRC::OK();
+}
+
+NavaryRC MockDescriptorAllocator::WriteUniformBuffer(
+    core::DescriptorHandle set, std::uint32_t binding,
+    core::BufferHandle buffer, std::size_t offset, std::size_t range) {
+  ScopedCall call(&stats_.write_buffer, timing_);
+
+  MockBinding* slot = FindBinding(set, binding);
+  if (slot == nullptr || buffer.index >= limits_.buffer_count || range == 0) {
+    call.Fail();
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "MockDescriptorAllocator: WriteUniformBuffer invalid arg");
+  }
+
+  slot->kind   = MockBindingKind::kUniformBuffer;
+  slot->buffer = buffer;
+  slot->offset = offset;
+  slot->range  = range;
+  return NavaryRC::OK();
+}
+
+const MockBinding* MockDescriptorAllocator::GetBinding(
+    core::DescriptorHandle set, std::uint32_t binding) const {
+  if (set.index >= count_ || binding >= limits_.max_bindings) {
+    return nullptr;
+  }
+  return &bindings_[static_cast<std::size_t>(set.index) *
+                        limits_.max_bindings +
+                    binding];
+}
+
+core::DescriptorSetLayoutHandle MockDescriptorAllocator::GetLayout(
+    core::DescriptorHandle set) const {
+  if (set.index >= count_) {
+    return core::DescriptorSetLayoutHandle{0};
+  }
+  return layouts_[set.index];
+}
+
+}  // namespace navary::render::v1::mock
@@ -0,0 +1,112 @@
+#pragma once
+
+// navary/render/v1/mock/mock_descriptor_allocator.h
+// GPU-free DescriptorAllocator. Sets live in host memory; every write is
+// validated like DescriptorAllocatorVk (layout, texture and buffer ranges)
+// and kept so tests can inspect bindings. Per-call counts and timings let
+// material and draw-list paths be benchmarked headless.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstddef>
+#include <cstdint>
+
+#include "navary/core/handles.h"
+#include "navary/navary_status.h"
+#include "navary/render/v1/descriptor_allocator.h"
+
+namespace navary::render::v1::mock {
+
+struct MockCallStats {
+  std::uint64_t calls;
+  std::uint64_t failures;
+  std::uint64_t total_ns;  // 0 unless timing is enabled
+};
+
+struct MockDescriptorStats {
+  MockCallStats allocate;
+  MockCallStats write_image;
+  MockCallStats write_buffer;
+};
+
+struct MockDescriptorLimits {
+  std::uint32_t max_sets;
+  std::uint32_t max_bindings;  // per set
+  std::uint32_t layout_count;
+  std::uint32_t texture_count;
+  std::uint32_t buffer_count;
+};
+
+enum class MockBindingKind : std::uint8_t {
+  kEmpty         = 0,
+  kImageSampler  = 1,
+  kUniformBuffer = 2,
+};
+
+struct MockBinding {
+  MockBindingKind kind;
+  core::TextureHandle texture;
+  core::BufferHandle buffer;
+  std::size_t offset;
+  std::size_t range;
+};
+
+class MockDescriptorAllocator : public DescriptorAllocator {
+ public:
+  MockDescriptorAllocator();
+  ~MockDescriptorAllocator() override;
+
+  MockDescriptorAllocator(const MockDescriptorAllocator&)            = delete;
+  MockDescriptorAllocator& operator=(const MockDescriptorAllocator&) = delete;
+
+  NavaryRC Init(const MockDescriptorLimits& limits);
+
+  // Releases every set (vkResetDescriptorPool equivalent). Stats are kept.
+  void Reset();
+
+  void set_timing_enabled(bool enabled) {
+    timing_ = enabled;
+  }
+
+  // ---- DescriptorAllocator ----
+
+  NavaryResult<core::DescriptorHandle> Allocate(
+      core::DescriptorSetLayoutHandle layout) override;
+
+  NavaryRC WriteImageSampler(core::DescriptorHandle set, std::uint32_t binding,
+                             core::TextureHandle texture) override;
+
+  NavaryRC WriteUniformBuffer(core::DescriptorHandle set, std::uint32_t binding,
+                              core::BufferHandle buffer, std::size_t offset,
+                              std::size_t range) override;
+
+  // ---- Inspection ----
+
+  // nullptr if |set| or |binding| is out of range.
+  const MockBinding* GetBinding(core::DescriptorHandle set,
+                                std::uint32_t binding) const;
+  core::DescriptorSetLayoutHandle GetLayout(core::DescriptorHandle set) const;
+
+  const MockDescriptorStats& stats() const {
+    return stats_;
+  }
+  void ResetStats() {
+    stats_ = MockDescriptorStats{};
+  }
+
+  std::uint32_t allocated_sets() const {
+    return count_;
+  }
+
+ private:
+  MockBinding* FindBinding(core::DescriptorHandle set, std::uint32_t binding);
+
+  MockDescriptorLimits limits_;
+  MockBinding* bindings_;  // max_sets * max_bindings
+  core::DescriptorSetLayoutHandle* layouts_;
+  std::uint32_t count_;
+  MockDescriptorStats stats_;
+  bool timing_;
+};
+
+}  // namespace navary::render::v1::mock
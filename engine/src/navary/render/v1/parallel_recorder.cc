@@ -0,0 +1,227 @@
+// navary/render/v1/parallel_recorder.cc
+// Implementation of ParallelCommandRecorder.
+// This file is part of the Navary rendering engine.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include "navary/render/v1/parallel_recorder.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace navary::render::v1 {
+
+namespace {
+
+constexpr std::uint32_t kNoBinding = 0xFFFFFFFFu;
+
+}  // namespace
+
+ParallelCommandRecorder::ParallelCommandRecorder()
+    : config_{},
+      ranges_(nullptr),
+      lists_(nullptr),
+      max_ranges_(0),
+      range_count_(0) {}
+
+ParallelCommandRecorder::~ParallelCommandRecorder() {
+  std::free(ranges_);
+  std::free(lists_);
+}
+
+NavaryRC ParallelCommandRecorder::Init(std::uint32_t max_ranges,
+                                       const ParallelRecordConfig& config) {
+  if (max_ranges == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "ParallelCommandRecorder: max_ranges must be > 0");
+  }
+
+  std::free(ranges_);
+  std::free(lists_);
+
+  ranges_ = static_cast<Range*>(std::malloc(sizeof(Range) * max_ranges));
+  lists_  = static_cast<CommandList**>(
+      std::malloc(sizeof(CommandList*) * max_ranges));
+  if (ranges_ == nullptr || lists_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "ParallelCommandRecorder: ranges alloc failed");
+  }
+
+  config_      = config;
+  max_ranges_  = max_ranges;
+  range_count_ = 0;
+  return NavaryRC::OK();
+}
+
+std::uint32_t ParallelCommandRecorder::RangeBegin(std::uint32_t range) const {
+  return range < range_count_ ? ranges_[range].begin : 0;
+}
+
+// Even split by draw count, then each boundary slides forward (bounded) to
+// the next pipeline/material change so ranges rarely rebind the same state.
+std::uint32_t ParallelCommandRecorder::SplitRanges(
+    const DrawItem* draws, std::uint32_t count, std::uint32_t thread_count) {
+  const std::uint32_t min_draws = std::max(config_.min_draws_per_range, 1u);
+  std::uint32_t target          = thread_count * config_.ranges_per_thread;
+  target = std::min(target, std::max(count / min_draws, 1u));
+  target = std::min(target, max_ranges_);
+  target = std::max(target, 1u);
+
+  std::uint32_t n     = 0;
+  std::uint32_t begin = 0;
+  for (std::uint32_t k = 1; k <= target; ++k) {
+    std::uint32_t end = static_cast<std::uint32_t>(
+        (static_cast<std::uint64_t>(count) * k) / target);
+
+    if (k < target) {
+      const std::uint32_t limit =
+          std::min(count, end + config_.boundary_search);
+      for (std::uint32_t j = end; j < limit; ++j) {
+        if (j > 0 && SortKeyStatePrefix(draws[j].key) !=
+                         SortKeyStatePrefix(draws[j - 1].key)) {
+          end = j;
+          break;
+        }
+      }
+    }
+
+    if (end <= begin) {
+      continue;  // boundary swallowed by the previous snap
+    }
+
+    Range& r           = ranges_[n++];
+    r.begin            = begin;
+    r.end              = end;
+    r.list             = nullptr;
+    r.status           = NavaryStatus::kOk;
+    r.pipeline_binds   = 0;
+    r.descriptor_binds = 0;
+    begin              = end;
+  }
+
+  return n;
+}
+
+// Secondary lists inherit no bound state, so each range starts clean and
+// only rebinds when the value changes.
+void ParallelCommandRecorder::RecordRange(Range* range, const DrawItem* draws,
+                                          CommandBackend* backend,
+                                          std::uint32_t worker) {
+  NavaryResult<CommandList*> list_or = backend->BeginSecondary(worker);
+  if (!list_or.status().ok()) {
+    range->status = list_or.status().code();
+    return;
+  }
+
+  CommandList* cmd = list_or.value();
+
+  std::uint32_t pipeline = kNoBinding;
+  std::uint32_t material = kNoBinding;
+  std::uint32_t vb       = kNoBinding;
+  std::uint32_t ib       = kNoBinding;
+
+  for (std::uint32_t i = range->begin; i < range->end; ++i) {
+    const DrawItem& d = draws[i];
+
+    if (d.pipeline.index != pipeline) {
+      cmd->BindPipeline(d.pipeline);
+      pipeline = d.pipeline.index;
+      ++range->pipeline_binds;
+      material = kNoBinding;  // layout may differ; rebind set 1
+    }
+    if (d.material_set.index != material) {
+      cmd->BindDescriptorSet(1, d.material_set);
+      material = d.material_set.index;
+      ++range->descriptor_binds;
+    }
+    if (d.vertex_buffer.index != vb) {
+      cmd->BindVertexBuffer(d.vertex_buffer, 0);
+      vb = d.vertex_buffer.index;
+    }
+    if (d.index_buffer.index != ib) {
+      cmd->BindIndexBuffer(d.index_buffer, 0);
+      ib = d.index_buffer.index;
+    }
+
+    cmd->DrawIndexed(d.index_count, d.instance_count, d.first_index,
+                     d.vertex_offset, d.first_instance);
+  }
+
+  const NavaryRC end_rc = backend->EndSecondary(worker, cmd);
+  range->status         = end_rc.code();
+  range->list           = cmd;
+}
+
+void ParallelCommandRecorder::RecordRangesJob(std::uint32_t begin,
+                                              std::uint32_t end,
+                                              std::uint32_t worker,
+                                              void* user_data) {
+  RecordJob* job = static_cast<RecordJob*>(user_data);
+  for (std::uint32_t r = begin; r < end; ++r) {
+    job->self->RecordRange(&job->self->ranges_[r], job->draws, job->backend,
+                           worker);
+  }
+}
+
+NavaryRC ParallelCommandRecorder::Record(const DrawItem* draws,
+                                         std::uint32_t count,
+                                         core::scheduler::JobSystem* jobs,
+                                         CommandBackend* backend,
+                                         ParallelRecordStats* stats) {
+  if (backend == nullptr || (draws == nullptr && count > 0)) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "ParallelCommandRecorder: null argument");
+  }
+  if (ranges_ == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "ParallelCommandRecorder: not initialized");
+  }
+
+  const std::uint32_t threads = jobs != nullptr ? jobs->thread_count() : 1;
+  if (threads > backend->worker_count()) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "ParallelCommandRecorder: backend has fewer worker pools "
+                    "than job threads");
+  }
+
+  range_count_ = 0;
+  if (stats != nullptr) {
+    *stats = ParallelRecordStats{};
+  }
+  if (count == 0) {
+    return NavaryRC::OK();
+  }
+
+  range_count_ = SplitRanges(draws, count, threads);
+
+  RecordJob job{this, draws, backend};
+  if (jobs != nullptr) {
+    jobs->ParallelFor(range_count_, 1, &RecordRangesJob, &job);
+  } else {
+    RecordRangesJob(0, range_count_, 0, &job);
+  }
+
+  // Submission order is range order, independent of which worker ran what.
+  ParallelRecordStats s{};
+  for (std::uint32_t r = 0; r < range_count_; ++r) {
+    const Range& range = ranges_[r];
+    if (range.status != NavaryStatus::kOk) {
+      return NavaryRC(range.status,
+                      "ParallelCommandRecorder: range recording failed");
+    }
+    lists_[r] = range.list;
+    s.draw_count += range.end - range.begin;
+    s.pipeline_binds += range.pipeline_binds;
+    s.descriptor_binds += range.descriptor_binds;
+  }
+  s.range_count = range_count_;
+
+  NAVARY_RETURN_IF_ERROR(backend->ExecuteSecondaries(lists_, range_count_));
+
+  if (stats != nullptr) {
+    *stats = s;
+  }
+  return NavaryRC::OK();
+}
+
+}  // namespace navary::render::v1
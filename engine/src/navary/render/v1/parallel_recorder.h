@@ -0,0 +1,111 @@
+#pragma once
+
+// navary/render/v1/parallel_recorder.h
+// Records a sorted draw list into secondary command lists on job workers.
+// Purpose:
+//   Split the draw list into contiguous ranges (boundaries snapped to
+//   pipeline/material changes), record each range on whichever worker picks
+//   it up using that worker's command pool, then execute the secondaries in
+//   range order so submission is identical regardless of scheduling.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstddef>
+#include <cstdint>
+
+#include "navary/core/handles.h"
+#include "navary/core/scheduler/job_system.h"
+#include "navary/navary_status.h"
+#include "navary/render/v1/command_list.h"
+#include "navary/render/v1/draw_sort_key.h"
+
+namespace navary::render::v1 {
+
+// One draw in submission order; the list must be sorted by |key|.
+struct DrawItem {
+  DrawSortKey key;
+  core::PipelineHandle pipeline;
+  core::DescriptorHandle material_set;  // descriptor set 1
+  core::BufferHandle vertex_buffer;
+  core::BufferHandle index_buffer;
+  std::uint32_t index_count;
+  std::uint32_t first_index;
+  std::int32_t vertex_offset;
+  std::uint32_t instance_count;
+  std::uint32_t first_instance;
+};
+
+struct ParallelRecordConfig {
+  // Ranges smaller than this are not worth a secondary list.
+  std::uint32_t min_draws_per_range = 256;
+
+  // Target ranges per thread; more ranges balance load better.
+  std::uint32_t ranges_per_thread = 4;
+
+  // How far a range boundary may move forward to land on a state change.
+  std::uint32_t boundary_search = 64;
+};
+
+struct ParallelRecordStats {
+  std::uint32_t range_count;
+  std::uint32_t draw_count;
+  std::uint32_t pipeline_binds;
+  std::uint32_t descriptor_binds;
+};
+
+class ParallelCommandRecorder {
+ public:
+  ParallelCommandRecorder();
+  ~ParallelCommandRecorder();
+
+  ParallelCommandRecorder(const ParallelCommandRecorder&)            = delete;
+  ParallelCommandRecorder& operator=(const ParallelCommandRecorder&) = delete;
+
+  NavaryRC Init(std::uint32_t max_ranges,
+                const ParallelRecordConfig& config = ParallelRecordConfig{});
+
+  // Records |draws| through |backend|. |jobs| may be null (records inline on
+  // the calling thread, worker 0). Blocks until the secondaries have been
+  // executed into the primary list.
+  NavaryRC Record(const DrawItem* draws, std::uint32_t count,
+                  core::scheduler::JobSystem* jobs, CommandBackend* backend,
+                  ParallelRecordStats* stats = nullptr);
+
+  // Range layout of the last Record() call.
+  std::uint32_t range_count() const {
+    return range_count_;
+  }
+  std::uint32_t RangeBegin(std::uint32_t range) const;
+
+ private:
+  struct Range {
+    std::uint32_t begin;
+    std::uint32_t end;
+    CommandList* list;
+    NavaryStatus status;
+    std::uint32_t pipeline_binds;
+    std::uint32_t descriptor_binds;
+  };
+
+  struct RecordJob {
+    ParallelCommandRecorder* self;
+    const DrawItem* draws;
+    CommandBackend* backend;
+  };
+
+  std::uint32_t SplitRanges(const DrawItem* draws, std::uint32_t count,
+                            std::uint32_t thread_count);
+  void RecordRange(Range* range, const DrawItem* draws,
+                   CommandBackend* backend, std::uint32_t worker);
+
+  static void RecordRangesJob(std::uint32_t begin, std::uint32_t end,
+                              std::uint32_t worker, void* user_data);
+
+  ParallelRecordConfig config_;
+  Range* ranges_;
+  CommandList** lists_;
+  std::uint32_t max_ranges_;
+  std::uint32_t range_count_;
+};
+
+}  // namespace navary::render::v1
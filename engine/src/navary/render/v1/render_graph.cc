@@ -0,0 +1,692 @@
+// navary/render/v1/render_graph.cc
+// Implementation of RenderGraph (frame graph compiler).
+// This file is part of the Navary rendering engine.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include "navary/render/v1/render_graph.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace navary::render::v1 {
+
+namespace {
+
+inline std::size_t AlignUp(std::size_t v, std::size_t alignment) {
+  return (v + alignment - 1) & ~(alignment - 1);
+}
+
+inline bool RangesOverlap(std::size_t a_begin, std::size_t a_size,
+                          std::size_t b_begin, std::size_t b_size) {
+  return a_begin < b_begin + b_size && b_begin < a_begin + a_size;
+}
+
+inline bool LifetimesOverlap(std::uint32_t a_first, std::uint32_t a_last,
+                             std::uint32_t b_first, std::uint32_t b_last) {
+  return a_first <= b_last && b_first <= a_last;
+}
+
+template <typename T>
+T* AllocArray(std::uint32_t count) {
+  // Avoid malloc(0) returning nullptr being treated as a failure.
+  const std::size_t n = count == 0 ? 1 : count;
+  return static_cast<T*>(std::malloc(sizeof(T) * n));
+}
+
+}  // namespace
+
+RenderGraph::RenderGraph()
+    : limits_{},
+      passes_(nullptr),
+      resources_(nullptr),
+      accesses_(nullptr),
+      order_(nullptr),
+      batches_(nullptr),
+      barriers_(nullptr),
+      placements_(nullptr),
+      heaps_{},
+      pass_count_(0),
+      resource_count_(0),
+      access_count_(0),
+      order_count_(0),
+      barrier_count_(0),
+      max_batch_barriers_(0),
+      placement_count_(0),
+      heap_count_(0),
+      unaliased_bytes_(0),
+      compiled_(false) {}
+
+RenderGraph::~RenderGraph() {
+  std::free(passes_);
+  std::free(resources_);
+  std::free(accesses_);
+  std::free(order_);
+  std::free(batches_);
+  std::free(barriers_);
+  std::free(placements_);
+}
+
+NavaryRC RenderGraph::Init(const RenderGraphLimits& limits) {
+  if (passes_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraph: already initialized");
+  }
+
+  limits_ = limits;
+
+  passes_     = AllocArray<Pass>(limits.max_passes);
+  resources_  = AllocArray<Resource>(limits.max_resources);
+  accesses_   = AllocArray<Access>(limits.max_accesses);
+  order_      = AllocArray<std::uint32_t>(limits.max_passes);
+  batches_    = AllocArray<RgBarrierBatch>(limits.max_passes + 1);
+  barriers_   = AllocArray<RgBarrier>(limits.max_accesses +
+                                      limits.max_resources);
+  placements_ = AllocArray<RgTransientPlacement>(limits.max_resources);
+
+  if (passes_ == nullptr || resources_ == nullptr || accesses_ == nullptr ||
+      order_ == nullptr || batches_ == nullptr || barriers_ == nullptr ||
+      placements_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "RenderGraph: storage alloc failed");
+  }
+
+  Reset();
+  return NavaryRC::OK();
+}
+
+void RenderGraph::Reset() {
+  pass_count_      = 0;
+  resource_count_  = 0;
+  access_count_    = 0;
+  order_count_     = 0;
+  barrier_count_      = 0;
+  max_batch_barriers_ = 0;
+  placement_count_    = 0;
+  heap_count_         = 0;
+  unaliased_bytes_    = 0;
+  compiled_           = false;
+}
+
+// ------------------------------------------------------------
+// Declaration
+// ------------------------------------------------------------
+
+NavaryResult<RgResourceHandle> RenderGraph::AddResource(
+    const char* name, const RgResourceDesc& desc, bool imported,
+    std::uint32_t external_index, RgAccessFlags initial_access,
+    RgAccessFlags final_access) {
+  if (resource_count_ >= limits_.max_resources) {
+    return NavaryResult<RgResourceHandle>(NavaryRC(
+        NavaryStatus::kOutOfMemory, "RenderGraph: resource array full"));
+  }
+
+  const std::uint32_t index = resource_count_++;
+  Resource& r               = resources_[index];
+  r.name                    = name;
+  r.desc                    = desc;
+  r.desc.usage              = kRgAccessNone;
+  r.imported                = imported;
+  r.external_index          = external_index;
+  r.initial_access          = initial_access;
+  r.final_access            = final_access;
+  r.first_use               = kRgInvalidIndex;
+  r.last_use                = kRgInvalidIndex;
+  r.placement               = kRgInvalidIndex;
+  r.needed                  = false;
+  r.state                   = kRgAccessNone;
+  r.state_pass_type         = RgPassType::kRaster;
+  r.state_pass_types        = RgPassTypeBit(RgPassType::kRaster);
+
+  compiled_ = false;
+  return NavaryResult<RgResourceHandle>(RgResourceHandle{index});
+}
+
+NavaryResult<RgResourceHandle> RenderGraph::CreateImage(
+    const char* name, const RgImageDesc& desc) {
+  RgResourceDesc d{};
+  d.kind  = RgResourceKind::kImage;
+  d.image = desc;
+  return AddResource(name, d, false, kRgInvalidIndex, kRgAccessNone,
+                     kRgAccessNone);
+}
+
+NavaryResult<RgResourceHandle> RenderGraph::CreateBuffer(
+    const char* name, const RgBufferDesc& desc) {
+  RgResourceDesc d{};
+  d.kind   = RgResourceKind::kBuffer;
+  d.buffer = desc;
+  return AddResource(name, d, false, kRgInvalidIndex, kRgAccessNone,
+                     kRgAccessNone);
+}
+
+NavaryResult<RgResourceHandle> RenderGraph::ImportImage(
+    const char* name, const RgImageDesc& desc, std::uint32_t external_index,
+    RgAccessFlags initial_access, RgAccessFlags final_access) {
+  RgResourceDesc d{};
+  d.kind  = RgResourceKind::kImage;
+  d.image = desc;
+  return AddResource(name, d, true, external_index, initial_access,
+                     final_access);
+}
+
+NavaryResult<RgResourceHandle> RenderGraph::ImportBuffer(
+    const char* name, const RgBufferDesc& desc, std::uint32_t external_index,
+    RgAccessFlags initial_access, RgAccessFlags final_access) {
+  RgResourceDesc d{};
+  d.kind   = RgResourceKind::kBuffer;
+  d.buffer = desc;
+  return AddResource(name, d, true, external_index, initial_access,
+                     final_access);
+}
+
+NavaryResult<RgPassHandle> RenderGraph::AddPass(const char* name,
+                                                RgPassType type,
+                                                RgExecuteFn execute,
+                                                void* user_data) {
+  if (pass_count_ >= limits_.max_passes) {
+    return NavaryResult<RgPassHandle>(
+        NavaryRC(NavaryStatus::kOutOfMemory, "RenderGraph: pass array full"));
+  }
+
+  const std::uint32_t index = pass_count_++;
+  Pass& p                   = passes_[index];
+  p.name                    = name;
+  p.type                    = type;
+  p.execute                 = execute;
+  p.user_data               = user_data;
+  p.first_access            = kRgInvalidIndex;
+  p.last_access             = kRgInvalidIndex;
+  p.side_effect             = false;
+  p.alive                   = false;
+
+  compiled_ = false;
+  return NavaryResult<RgPassHandle>(RgPassHandle{index});
+}
+
+NavaryRC RenderGraph::AddAccess(RgPassHandle pass, RgResourceHandle resource,
+                                RgAccessFlags access) {
+  if (pass.index >= pass_count_ || resource.index >= resource_count_) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraph: invalid pass or resource handle");
+  }
+
+  Pass& p = passes_[pass.index];
+
+  // Read + write of the same resource in one pass collapse into one access,
+  // so the pass gets a single barrier for it.
+  for (std::uint32_t a = p.first_access; a != kRgInvalidIndex;
+       a               = accesses_[a].next) {
+    if (accesses_[a].resource == resource.index) {
+      accesses_[a].flags |= access;
+      compiled_ = false;
+      return NavaryRC::OK();
+    }
+  }
+
+  if (access_count_ >= limits_.max_accesses) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "RenderGraph: access array full");
+  }
+
+  const std::uint32_t index = access_count_++;
+  accesses_[index].resource = resource.index;
+  accesses_[index].flags    = access;
+  accesses_[index].next     = kRgInvalidIndex;
+
+  if (p.first_access == kRgInvalidIndex) {
+    p.first_access = index;
+  } else {
+    accesses_[p.last_access].next = index;
+  }
+  p.last_access = index;
+
+  compiled_ = false;
+  return NavaryRC::OK();
+}
+
+NavaryRC RenderGraph::Read(RgPassHandle pass, RgResourceHandle resource,
+                           RgAccessFlags access) {
+  if (access == kRgAccessNone || RgIsWrite(access)) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraph: Read() needs read-only access bits");
+  }
+  return AddAccess(pass, resource, access);
+}
+
+NavaryRC RenderGraph::Write(RgPassHandle pass, RgResourceHandle resource,
+                            RgAccessFlags access) {
+  if (!RgIsWrite(access)) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraph: Write() needs a write access bit");
+  }
+  return AddAccess(pass, resource, access);
+}
+
+NavaryRC RenderGraph::SetSideEffect(RgPassHandle pass) {
+  if (pass.index >= pass_count_) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraph: invalid pass handle");
+  }
+  passes_[pass.index].side_effect = true;
+  return NavaryRC::OK();
+}
+
+// ------------------------------------------------------------
+// Compile
+// ------------------------------------------------------------
+
+NavaryRC RenderGraph::Compile(RenderGraphBackend* backend) {
+  if (backend == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraph: null backend");
+  }
+
+  compiled_           = false;
+  order_count_        = 0;
+  barrier_count_      = 0;
+  max_batch_barriers_ = 0;
+  placement_count_    = 0;
+  heap_count_         = 0;
+  unaliased_bytes_    = 0;
+
+  NAVARY_RETURN_IF_ERROR(Validate());
+  CullPasses();
+  ComputeLifetimes();
+  NAVARY_RETURN_IF_ERROR(PlaceTransients(backend));
+  NAVARY_RETURN_IF_ERROR(BuildBarriers());
+  NAVARY_RETURN_IF_ERROR(backend->RealizeTransients(
+      placements_, placement_count_, heaps_, heap_count_));
+
+  compiled_ = true;
+  return NavaryRC::OK();
+}
+
+// Declaration order is the execution order, so a transient must be written
+// by an earlier pass before anything reads it.
+NavaryRC RenderGraph::Validate() {
+  for (std::uint32_t i = 0; i < resource_count_; ++i) {
+    resources_[i].state = kRgAccessNone;
+  }
+
+  for (std::uint32_t p = 0; p < pass_count_; ++p) {
+    for (std::uint32_t a = passes_[p].first_access; a != kRgInvalidIndex;
+         a               = accesses_[a].next) {
+      Resource& r                = resources_[accesses_[a].resource];
+      const RgAccessFlags reads  = accesses_[a].flags & ~kRgAccessWriteMask;
+      const bool written_before  = r.state != kRgAccessNone;
+      if (reads != 0 && !r.imported && !written_before) {
+        return NavaryRC(NavaryStatus::kInvalidArgument,
+                        "RenderGraph: transient read before first write");
+      }
+      if (RgIsWrite(accesses_[a].flags)) {
+        r.state = accesses_[a].flags;
+      }
+    }
+  }
+
+  return NavaryRC::OK();
+}
+
+// Reverse walk: a pass is alive when it has side effects or writes a
+// resource somebody later needs. Imported resources are always needed.
+void RenderGraph::CullPasses() {
+  for (std::uint32_t i = 0; i < resource_count_; ++i) {
+    resources_[i].needed = resources_[i].imported;
+  }
+
+  for (std::uint32_t p = pass_count_; p-- > 0;) {
+    Pass& pass = passes_[p];
+    bool alive = pass.side_effect;
+
+    for (std::uint32_t a = pass.first_access; !alive && a != kRgInvalidIndex;
+         a               = accesses_[a].next) {
+      if (RgIsWrite(accesses_[a].flags) &&
+          resources_[accesses_[a].resource].needed) {
+        alive = true;
+      }
+    }
+
+    pass.alive = alive;
+    if (!alive) {
+      continue;
+    }
+
+    // This pass produces its outputs: earlier writers are only needed again
+    // if this pass (or another live one) also reads the previous contents.
+    for (std::uint32_t a = pass.first_access; a != kRgInvalidIndex;
+         a               = accesses_[a].next) {
+      Resource& r = resources_[accesses_[a].resource];
+      if (RgIsWrite(accesses_[a].flags) && !r.imported) {
+        r.needed = false;
+      }
+    }
+    for (std::uint32_t a = pass.first_access; a != kRgInvalidIndex;
+         a               = accesses_[a].next) {
+      if ((accesses_[a].flags & ~kRgAccessWriteMask) != 0) {
+        resources_[accesses_[a].resource].needed = true;
+      }
+    }
+  }
+
+  for (std::uint32_t p = 0; p < pass_count_; ++p) {
+    if (passes_[p].alive) {
+      order_[order_count_++] = p;
+    }
+  }
+}
+
+void RenderGraph::ComputeLifetimes() {
+  for (std::uint32_t i = 0; i < resource_count_; ++i) {
+    Resource& r    = resources_[i];
+    r.first_use    = kRgInvalidIndex;
+    r.last_use     = kRgInvalidIndex;
+    r.placement    = kRgInvalidIndex;
+    r.desc.usage   = kRgAccessNone;
+  }
+
+  for (std::uint32_t i = 0; i < order_count_; ++i) {
+    const Pass& pass = passes_[order_[i]];
+    for (std::uint32_t a = pass.first_access; a != kRgInvalidIndex;
+         a               = accesses_[a].next) {
+      Resource& r = resources_[accesses_[a].resource];
+      if (r.first_use == kRgInvalidIndex) {
+        r.first_use = i;
+      }
+      r.last_use = i;
+      r.desc.usage |= accesses_[a].flags;
+    }
+  }
+}
+
+// Greedy interval packing: largest resources first, each placed at the lowest
+// offset that does not collide with an already placed resource whose
+// lifetime overlaps.
+NavaryRC RenderGraph::PlaceTransients(RenderGraphBackend* backend) {
+  std::uint32_t count = 0;
+
+  for (std::uint32_t i = 0; i < resource_count_; ++i) {
+    Resource& r = resources_[i];
+    if (r.imported || r.first_use == kRgInvalidIndex) {
+      continue;
+    }
+
+    NavaryResult<RgMemoryRequirements> req_or =
+        backend->GetMemoryRequirements(r.desc);
+    if (!req_or.status().ok()) {
+      return req_or.status();
+    }
+    const RgMemoryRequirements req = req_or.value();
+    if (req.alignment == 0 || (req.alignment & (req.alignment - 1)) != 0) {
+      return NavaryRC(NavaryStatus::kInternal,
+                      "RenderGraph: backend returned invalid alignment");
+    }
+
+    std::uint32_t heap = 0;
+    while (heap < heap_count_ && (heaps_[heap].heap_class != req.heap_class ||
+                                  heaps_[heap].kind != r.desc.kind)) {
+      ++heap;
+    }
+    if (heap == heap_count_) {
+      if (heap_count_ >= kMaxHeaps) {
+        return NavaryRC(NavaryStatus::kOutOfMemory,
+                        "RenderGraph: too many heap classes");
+      }
+      heaps_[heap_count_++] = RgHeapInfo{req.heap_class, r.desc.kind, 0};
+    }
+
+    RgTransientPlacement& pl = placements_[count];
+    pl.resource              = RgResourceHandle{i};
+    pl.desc                  = r.desc;
+    pl.heap                  = heap;
+    pl.offset                = 0;
+    pl.size                  = req.size;
+    pl.alignment             = req.alignment;
+    pl.alias_predecessor     = kRgInvalidIndex;
+
+    unaliased_bytes_ += req.size;
+    ++count;
+  }
+
+  // Size descending; lifetime start and index keep the order deterministic.
+  std::sort(placements_, placements_ + count,
+            [this](const RgTransientPlacement& a,
+                   const RgTransientPlacement& b) {
+              if (a.size != b.size) {
+                return a.size > b.size;
+              }
+              const std::uint32_t fa = resources_[a.resource.index].first_use;
+              const std::uint32_t fb = resources_[b.resource.index].first_use;
+              if (fa != fb) {
+                return fa < fb;
+              }
+              return a.resource.index < b.resource.index;
+            });
+
+  for (std::uint32_t k = 0; k < count; ++k) {
+    RgTransientPlacement& pl = placements_[k];
+    const Resource& r        = resources_[pl.resource.index];
+
+    std::size_t offset = 0;
+    bool moved         = true;
+    while (moved) {
+      moved = false;
+      for (std::uint32_t j = 0; j < k; ++j) {
+        const RgTransientPlacement& other = placements_[j];
+        const Resource& o                 = resources_[other.resource.index];
+        if (other.heap != pl.heap ||
+            !LifetimesOverlap(r.first_use, r.last_use, o.first_use,
+                              o.last_use) ||
+            !RangesOverlap(offset, pl.size, other.offset, other.size)) {
+          continue;
+        }
+        offset = AlignUp(other.offset + other.size, pl.alignment);
+        moved  = true;
+      }
+    }
+
+    pl.offset = offset;
+    heaps_[pl.heap].size = std::max(heaps_[pl.heap].size, offset + pl.size);
+  }
+
+  // The latest earlier user of overlapping memory is reported as the aliasing
+  // predecessor; BuildBarriers() waits on every earlier user.
+  for (std::uint32_t k = 0; k < count; ++k) {
+    RgTransientPlacement& pl = placements_[k];
+    const Resource& r        = resources_[pl.resource.index];
+    std::uint32_t best_last  = 0;
+
+    for (std::uint32_t j = 0; j < count; ++j) {
+      const RgTransientPlacement& other = placements_[j];
+      const Resource& o                 = resources_[other.resource.index];
+      if (j == k || other.heap != pl.heap || o.last_use >= r.first_use ||
+          !RangesOverlap(pl.offset, pl.size, other.offset, other.size)) {
+        continue;
+      }
+      if (pl.alias_predecessor == kRgInvalidIndex || o.last_use > best_last) {
+        pl.alias_predecessor = other.resource.index;
+        best_last            = o.last_use;
+      }
+    }
+
+    resources_[pl.resource.index].placement = k;
+  }
+
+  placement_count_ = count;
+  return NavaryRC::OK();
+}
+
+void RenderGraph::PushBarrier(std::uint32_t resource_index, RgAccessFlags dst,
+                              RgPassType dst_type, bool discard,
+                              RgAccessFlags src_override,
+                              RgPassTypeMask src_types_override) {
+  Resource& r = resources_[resource_index];
+
+  RgBarrier& b     = barriers_[barrier_count_++];
+  b.resource       = RgResourceHandle{resource_index};
+  b.kind           = r.desc.kind;
+  b.external_index = r.imported ? r.external_index : kRgInvalidIndex;
+  b.src_access     = discard ? src_override : r.state;
+  b.dst_access     = dst;
+  b.src_pass_type  = r.state_pass_type;
+  b.dst_pass_type  = dst_type;
+  b.src_pass_types = discard ? src_types_override : r.state_pass_types;
+  b.discard        = discard;
+}
+
+NavaryRC RenderGraph::BuildBarriers() {
+  for (std::uint32_t i = 0; i < resource_count_; ++i) {
+    Resource& r        = resources_[i];
+    r.state            = r.imported ? r.initial_access : kRgAccessNone;
+    r.state_pass_type  = RgPassType::kRaster;
+    r.state_pass_types = RgPassTypeBit(RgPassType::kRaster);
+  }
+
+  for (std::uint32_t i = 0; i < order_count_; ++i) {
+    const Pass& pass     = passes_[order_[i]];
+    RgBarrierBatch& bat  = batches_[i];
+    bat.first_barrier    = barrier_count_;
+
+    for (std::uint32_t a = pass.first_access; a != kRgInvalidIndex;
+         a               = accesses_[a].next) {
+      const std::uint32_t ri  = accesses_[a].resource;
+      Resource& r             = resources_[ri];
+      const RgAccessFlags dst = accesses_[a].flags;
+
+      if (!r.imported && r.first_use == i) {
+        // First use of a transient: contents undefined. When the memory
+        // belonged to other resources, wait for the last use of every one
+        // of them: with partial overlaps the latest occupant does not
+        // cover the earlier ones.
+        RgAccessFlags src        = kRgAccessNone;
+        RgPassTypeMask src_types = 0;
+        if (r.placement != kRgInvalidIndex) {
+          const RgTransientPlacement& pl = placements_[r.placement];
+          if (pl.alias_predecessor != kRgInvalidIndex) {
+            r.state_pass_type =
+                resources_[pl.alias_predecessor].state_pass_type;
+          }
+          for (std::uint32_t j = 0; j < placement_count_; ++j) {
+            const RgTransientPlacement& other = placements_[j];
+            const Resource& o = resources_[other.resource.index];
+            if (j == r.placement || other.heap != pl.heap ||
+                o.last_use >= r.first_use ||
+                !RangesOverlap(pl.offset, pl.size, other.offset,
+                               other.size)) {
+              continue;
+            }
+            src |= o.state;
+            src_types |= o.state_pass_types;
+          }
+        }
+        PushBarrier(ri, dst, pass.type, true, src, src_types);
+        r.state_pass_types = 0;
+      } else if (RgIsWrite(r.state) || RgIsWrite(dst) || r.state != dst) {
+        PushBarrier(ri, dst, pass.type, false, kRgAccessNone, 0);
+        r.state_pass_types = 0;
+      }
+
+      // Readers sharing a state accumulate, so the next barrier waits for
+      // all of them rather than only the last one.
+      r.state             = dst;
+      r.state_pass_type   = pass.type;
+      r.state_pass_types |= RgPassTypeBit(pass.type);
+    }
+
+    bat.barrier_count   = barrier_count_ - bat.first_barrier;
+    max_batch_barriers_ = std::max(max_batch_barriers_, bat.barrier_count);
+  }
+
+  // Final batch returns imported resources to the state the owner expects.
+  RgBarrierBatch& final_batch = batches_[order_count_];
+  final_batch.first_barrier   = barrier_count_;
+  for (std::uint32_t i = 0; i < resource_count_; ++i) {
+    const Resource& r = resources_[i];
+    if (!r.imported || r.final_access == kRgAccessNone ||
+        (r.state == r.final_access && !RgIsWrite(r.state))) {
+      continue;
+    }
+    PushBarrier(i, r.final_access, r.state_pass_type, false, kRgAccessNone,
+                0);
+  }
+  final_batch.barrier_count = barrier_count_ - final_batch.first_barrier;
+  max_batch_barriers_ =
+      std::max(max_batch_barriers_, final_batch.barrier_count);
+
+  return NavaryRC::OK();
+}
+
+// ------------------------------------------------------------
+// Execute
+// ------------------------------------------------------------
+
+NavaryRC RenderGraph::Execute(RenderGraphBackend* backend, void* frame_data) {
+  if (!compiled_) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraph: Execute() before Compile()");
+  }
+  if (backend == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraph: null backend");
+  }
+
+  for (std::uint32_t i = 0; i <= order_count_; ++i) {
+    const RgBarrierBatch& bat = batches_[i];
+    if (bat.barrier_count > 0) {
+      NAVARY_RETURN_IF_ERROR(backend->RecordBarriers(
+          barriers_ + bat.first_barrier, bat.barrier_count));
+    }
+
+    if (i == order_count_) {
+      break;
+    }
+
+    const Pass& pass = passes_[order_[i]];
+    if (pass.execute != nullptr) {
+      RgPassContext ctx{};
+      ctx.graph      = this;
+      ctx.pass       = RgPassHandle{order_[i]};
+      ctx.backend    = backend;
+      ctx.frame_data = frame_data;
+      pass.execute(ctx, pass.user_data);
+    }
+  }
+
+  return NavaryRC::OK();
+}
+
+// ------------------------------------------------------------
+// Queries
+// ------------------------------------------------------------
+
+bool RenderGraph::IsPassCulled(RgPassHandle pass) const {
+  return pass.index >= pass_count_ || !passes_[pass.index].alive;
+}
+
+const char* RenderGraph::PassName(RgPassHandle pass) const {
+  return pass.index < pass_count_ ? passes_[pass.index].name : nullptr;
+}
+
+const char* RenderGraph::ResourceName(RgResourceHandle resource) const {
+  return resource.index < resource_count_ ? resources_[resource.index].name
+                                          : nullptr;
+}
+
+const RgResourceDesc* RenderGraph::ResourceDesc(
+    RgResourceHandle resource) const {
+  return resource.index < resource_count_ ? &resources_[resource.index].desc
+                                          : nullptr;
+}
+
+bool RenderGraph::IsImported(RgResourceHandle resource) const {
+  return resource.index < resource_count_ &&
+         resources_[resource.index].imported;
+}
+
+std::uint32_t RenderGraph::ExternalIndex(RgResourceHandle resource) const {
+  return resource.index < resource_count_
+             ? resources_[resource.index].external_index
+             : kRgInvalidIndex;
+}
+
+}  // namespace navary::render::v1
@@ -0,0 +1,393 @@
+#pragma once
+
+// navary/render/v1/render_graph.h
+// Backend-agnostic frame graph: passes declare reads/writes of resources,
+// Compile() produces the execution order, merged barrier batches and
+// lifetime-based aliasing of transient images/buffers.
+// Purpose:
+//   - Cull passes whose outputs are never consumed.
+//   - Emit exactly one barrier batch per pass (one vkCmdPipelineBarrier).
+//   - Place transients with disjoint lifetimes at overlapping heap offsets.
+// The compiler never touches a GPU API; RenderGraphBackend does.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstddef>
+#include <cstdint>
+
+#include "navary/navary_status.h"
+
+namespace navary::render::v1 {
+
+struct RgResourceHandle {
+  std::uint32_t index;
+};
+
+struct RgPassHandle {
+  std::uint32_t index;
+};
+
+constexpr std::uint32_t kRgInvalidIndex = 0xFFFFFFFFu;
+
+// Access bits. A pass may combine several bits for one resource
+// (e.g. depth read + depth write).
+using RgAccessFlags = std::uint32_t;
+
+constexpr RgAccessFlags kRgAccessNone            = 0;
+constexpr RgAccessFlags kRgAccessColorAttachment = 1u << 0;
+constexpr RgAccessFlags kRgAccessDepthWrite      = 1u << 1;
+constexpr RgAccessFlags kRgAccessDepthRead       = 1u << 2;
+constexpr RgAccessFlags kRgAccessSampled         = 1u << 3;
+constexpr RgAccessFlags kRgAccessStorageRead     = 1u << 4;
+constexpr RgAccessFlags kRgAccessStorageWrite    = 1u << 5;
+constexpr RgAccessFlags kRgAccessTransferSrc     = 1u << 6;
+constexpr RgAccessFlags kRgAccessTransferDst     = 1u << 7;
+constexpr RgAccessFlags kRgAccessIndirect        = 1u << 8;
+constexpr RgAccessFlags kRgAccessVertexIndex     = 1u << 9;
+constexpr RgAccessFlags kRgAccessUniform         = 1u << 10;
+constexpr RgAccessFlags kRgAccessPresent         = 1u << 11;
+
+constexpr RgAccessFlags kRgAccessWriteMask =
+    kRgAccessColorAttachment | kRgAccessDepthWrite | kRgAccessStorageWrite |
+    kRgAccessTransferDst;
+
+inline bool RgIsWrite(RgAccessFlags access) {
+  return (access & kRgAccessWriteMask) != 0;
+}
+
+enum class RgPassType : std::uint8_t {
+  kRaster   = 0,
+  kCompute  = 1,
+  kTransfer = 2,
+};
+
+enum class RgResourceKind : std::uint8_t {
+  kImage  = 0,
+  kBuffer = 1,
+};
+
+// Bit per RgPassType, for barriers waiting on several earlier passes.
+using RgPassTypeMask = std::uint8_t;
+
+inline RgPassTypeMask RgPassTypeBit(RgPassType type) {
+  return static_cast<RgPassTypeMask>(1u << static_cast<std::uint32_t>(type));
+}
+
+struct RgImageDesc {
+  std::uint32_t width;
+  std::uint32_t height;
+  std::uint32_t mip_levels;
+  std::uint32_t format;  // backend format value (VkFormat for Vulkan)
+};
+
+struct RgBufferDesc {
+  std::size_t size;
+};
+
+struct RgResourceDesc {
+  RgResourceKind kind;
+  RgImageDesc image;
+  RgBufferDesc buffer;
+
+  // Union of every access the compiled graph performs on the resource;
+  // filled by Compile() so backends can derive usage flags.
+  RgAccessFlags usage;
+};
+
+struct RgMemoryRequirements {
+  std::size_t size;
+  std::size_t alignment;
+
+  // Resources only alias other resources of the same heap class
+  // (e.g. compatible memory type bits).
+  std::uint32_t heap_class;
+};
+
+// One resource transition inside a barrier batch.
+struct RgBarrier {
+  RgResourceHandle resource;
+  RgResourceKind kind;
+  std::uint32_t external_index;  // imported resources only
+  RgAccessFlags src_access;  // kRgAccessNone on first use
+  RgAccessFlags dst_access;
+  RgPassType src_pass_type;
+  RgPassType dst_pass_type;
+
+  // Every pass type the source scope covers: all passes that used the
+  // resource in src_access since its previous barrier (several readers can
+  // share one read state), or on aliasing barriers, whose src_access is the
+  // union of the final accesses of all earlier occupants of the memory,
+  // every type those occupants were last used by.
+  RgPassTypeMask src_pass_types;
+
+  // Previous contents are not needed (first use of a transient, or memory
+  // taken over from an aliased resource). Images may use UNDEFINED layout.
+  bool discard;
+};
+
+struct RgBarrierBatch {
+  std::uint32_t first_barrier;
+  std::uint32_t barrier_count;
+};
+
+struct RgTransientPlacement {
+  RgResourceHandle resource;
+  RgResourceDesc desc;
+  std::uint32_t heap;  // index into heaps(), not the heap class
+  std::size_t offset;
+  std::size_t size;
+  std::size_t alignment;
+
+  // Latest resource that used overlapping memory before, or
+  // kRgInvalidIndex. The first barrier waits on all earlier occupants.
+  std::uint32_t alias_predecessor;
+};
+
+// Images and buffers never share a heap: linear and optimal-tiling resources
+// placed next to each other would need bufferImageGranularity padding
+// (Vulkan) or separate heap tiers (D3D12 tier 1).
+struct RgHeapInfo {
+  std::uint32_t heap_class;
+  RgResourceKind kind;
+  std::size_t size;
+};
+
+class RenderGraph;
+class RenderGraphBackend;
+
+struct RgPassContext {
+  const RenderGraph* graph;
+  RgPassHandle pass;
+  RenderGraphBackend* backend;
+  void* frame_data;  // caller-provided, passed through Execute()
+};
+
+using RgExecuteFn = void (*)(const RgPassContext& ctx, void* user_data);
+
+// GPU-facing side of the render graph. The compiler only asks for memory
+// requirements; the backend creates/aliases objects and records barriers.
+class RenderGraphBackend {
+ public:
+  virtual ~RenderGraphBackend() = default;
+
+  // Fails when the resource cannot be created or no allowed memory type
+  // fits it; Compile() returns the error.
+  virtual NavaryResult<RgMemoryRequirements> GetMemoryRequirements(
+      const RgResourceDesc& desc) = 0;
+
+  // Creates transient objects bound to heap memory at the given offsets.
+  virtual NavaryRC RealizeTransients(const RgTransientPlacement* placements,
+                                     std::uint32_t placement_count,
+                                     const RgHeapInfo* heaps,
+                                     std::uint32_t heap_count) = 0;
+
+  // Records one merged barrier batch. Never called with count == 0.
+  // Execute() stops at the first error (e.g. a batch above the backend's
+  // capacity; see RenderGraph::max_batch_barriers()).
+  virtual NavaryRC RecordBarriers(const RgBarrier* barriers,
+                                  std::uint32_t count) = 0;
+};
+
+struct RenderGraphLimits {
+  std::uint32_t max_passes;
+  std::uint32_t max_resources;
+  std::uint32_t max_accesses;  // total read/write declarations per frame
+};
+
+// RenderGraph is rebuilt every frame: Reset(), declare resources and passes,
+// Compile(), Execute(). Storage is allocated once by Init(); a frame does not
+// allocate.
+class RenderGraph {
+ public:
+  static constexpr std::uint32_t kMaxHeaps = 8;
+
+  RenderGraph();
+  ~RenderGraph();
+
+  RenderGraph(const RenderGraph&)            = delete;
+  RenderGraph& operator=(const RenderGraph&) = delete;
+
+  NavaryRC Init(const RenderGraphLimits& limits);
+
+  // Clears all passes/resources; keeps storage.
+  void Reset();
+
+  // ---- Resources ----
+
+  NavaryResult<RgResourceHandle> CreateImage(const char* name,
+                                             const RgImageDesc& desc);
+  NavaryResult<RgResourceHandle> CreateBuffer(const char* name,
+                                              const RgBufferDesc& desc);
+
+  // Imported resources live outside the graph (swapchain, history buffers).
+  // They are never aliased and writes to them keep their passes alive.
+  // |external_index| is resolved by the backend.
+  NavaryResult<RgResourceHandle> ImportImage(const char* name,
+                                             const RgImageDesc& desc,
+                                             std::uint32_t external_index,
+                                             RgAccessFlags initial_access,
+                                             RgAccessFlags final_access);
+  NavaryResult<RgResourceHandle> ImportBuffer(const char* name,
+                                              const RgBufferDesc& desc,
+                                              std::uint32_t external_index,
+                                              RgAccessFlags initial_access,
+                                              RgAccessFlags final_access);
+
+  // ---- Passes ----
+
+  NavaryResult<RgPassHandle> AddPass(const char* name, RgPassType type,
+                                     RgExecuteFn execute, void* user_data);
+
+  NavaryRC Read(RgPassHandle pass, RgResourceHandle resource,
+                RgAccessFlags access);
+  NavaryRC Write(RgPassHandle pass, RgResourceHandle resource,
+                 RgAccessFlags access);
+
+  // Keeps the pass even when nothing reads its outputs (readback, queries).
+  NavaryRC SetSideEffect(RgPassHandle pass);
+
+  // ---- Compile / execute ----
+
+  NavaryRC Compile(RenderGraphBackend* backend);
+
+  // Records barriers and runs pass callbacks in compiled order, followed by
+  // a final batch transitioning imported resources to their final access.
+  NavaryRC Execute(RenderGraphBackend* backend, void* frame_data);
+
+  // ---- Compiled results (valid after Compile) ----
+
+  std::uint32_t pass_count() const {
+    return pass_count_;
+  }
+  std::uint32_t resource_count() const {
+    return resource_count_;
+  }
+
+  const std::uint32_t* pass_order() const {
+    return order_;
+  }
+  std::uint32_t compiled_pass_count() const {
+    return order_count_;
+  }
+  bool IsPassCulled(RgPassHandle pass) const;
+
+  // Barrier batch recorded before order_[i]; batch at index
+  // compiled_pass_count() is the final imported-resource transition.
+  const RgBarrierBatch* barrier_batches() const {
+    return batches_;
+  }
+  const RgBarrier* barriers() const {
+    return barriers_;
+  }
+  std::uint32_t barrier_count() const {
+    return barrier_count_;
+  }
+  // Largest batch, for sizing backend barrier arrays.
+  std::uint32_t max_batch_barriers() const {
+    return max_batch_barriers_;
+  }
+
+  const RgTransientPlacement* placements() const {
+    return placements_;
+  }
+  std::uint32_t placement_count() const {
+    return placement_count_;
+  }
+  const RgHeapInfo* heaps() const {
+    return heaps_;
+  }
+  std::uint32_t heap_count() const {
+    return heap_count_;
+  }
+
+  // Sum of all transient sizes without aliasing, for statistics.
+  std::size_t unaliased_transient_bytes() const {
+    return unaliased_bytes_;
+  }
+
+  const char* PassName(RgPassHandle pass) const;
+  const char* ResourceName(RgResourceHandle resource) const;
+  const RgResourceDesc* ResourceDesc(RgResourceHandle resource) const;
+  bool IsImported(RgResourceHandle resource) const;
+  std::uint32_t ExternalIndex(RgResourceHandle resource) const;
+
+ private:
+  struct Access {
+    std::uint32_t resource;
+    RgAccessFlags flags;
+    std::uint32_t next;  // next access of the same pass, or kRgInvalidIndex
+  };
+
+  struct Pass {
+    const char* name;
+    RgPassType type;
+    RgExecuteFn execute;
+    void* user_data;
+    std::uint32_t first_access;
+    std::uint32_t last_access;
+    bool side_effect;
+    bool alive;
+  };
+
+  struct Resource {
+    const char* name;
+    RgResourceDesc desc;
+    bool imported;
+    std::uint32_t external_index;
+    RgAccessFlags initial_access;
+    RgAccessFlags final_access;
+
+    // Compile-time state.
+    std::uint32_t first_use;  // position in order_, kRgInvalidIndex if unused
+    std::uint32_t last_use;
+    std::uint32_t placement;  // index into placements_, or kRgInvalidIndex
+    bool needed;
+    RgAccessFlags state;  // current access during barrier generation
+    RgPassType state_pass_type;
+    RgPassTypeMask state_pass_types;  // users of |state| since its barrier
+  };
+
+  NavaryResult<RgResourceHandle> AddResource(const char* name,
+                                             const RgResourceDesc& desc,
+                                             bool imported,
+                                             std::uint32_t external_index,
+                                             RgAccessFlags initial_access,
+                                             RgAccessFlags final_access);
+  NavaryRC AddAccess(RgPassHandle pass, RgResourceHandle resource,
+                     RgAccessFlags access);
+
+  NavaryRC Validate();
+  void CullPasses();
+  void ComputeLifetimes();
+  NavaryRC PlaceTransients(RenderGraphBackend* backend);
+  NavaryRC BuildBarriers();
+  void PushBarrier(std::uint32_t resource_index, RgAccessFlags dst,
+                   RgPassType dst_type, bool discard,
+                   RgAccessFlags src_override,
+                   RgPassTypeMask src_types_override);
+
+  RenderGraphLimits limits_;
+
+  Pass* passes_;
+  Resource* resources_;
+  Access* accesses_;
+
+  std::uint32_t* order_;
+  RgBarrierBatch* batches_;  // limits_.max_passes + 1
+  RgBarrier* barriers_;      // limits_.max_accesses + limits_.max_resources
+  RgTransientPlacement* placements_;
+  RgHeapInfo heaps_[kMaxHeaps];
+
+  std::uint32_t pass_count_;
+  std::uint32_t resource_count_;
+  std::uint32_t access_count_;
+  std::uint32_t order_count_;
+  std::uint32_t barrier_count_;
+  std::uint32_t max_batch_barriers_;
+  std::uint32_t placement_count_;
+  std::uint32_t heap_count_;
+  std::size_t unaliased_bytes_;
+  bool compiled_;
+};
+
+}  // namespace navary::render::v1
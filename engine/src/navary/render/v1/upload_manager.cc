@@ -0,0 +1,511 @@
+// navary/render/v1/upload_manager.cc
+// Implementation of UploadManager (staging ring + copy batching).
+// This file is part of the Navary rendering engine.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include "navary/render/v1/upload_manager.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace navary::render::v1 {
+
+namespace {
+
+constexpr std::size_t kDefaultCopyAlignment = 16;
+
+inline std::size_t AlignUp(std::size_t v, std::size_t a) {
+  return (v + (a - 1)) & ~(a - 1);
+}
+
+}  // namespace
+
+UploadManager::UploadManager()
+    : desc_{},
+      pending_(nullptr),
+      order_(nullptr),
+      buffer_regions_(nullptr),
+      texture_regions_(nullptr),
+      bounds_(nullptr),
+      pending_count_(0),
+      marks_(nullptr),
+      mark_head_(0),
+      mark_count_(0),
+      head_(0),
+      tail_(0),
+      used_(0),
+      frame_bytes_(0),
+      frame_requested_(0),
+      frame_index_(0),
+      completed_frame_(0),
+      has_completed_(false) {}
+
+UploadManager::~UploadManager() {
+  std::free(pending_);
+  std::free(order_);
+  std::free(buffer_regions_);
+  std::free(texture_regions_);
+  std::free(bounds_);
+  std::free(marks_);
+}
+
+NavaryRC UploadManager::Init(const UploadManagerDesc& desc) {
+  if (desc.staging_mapped == nullptr || desc.staging_size == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "UploadManager: staging buffer not mapped");
+  }
+  if (desc.max_requests == 0 || desc.max_frames_in_flight == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "UploadManager: limits must be > 0");
+  }
+
+  const std::size_t alignment = desc.copy_alignment == 0
+                                    ? kDefaultCopyAlignment
+                                    : desc.copy_alignment;
+  if (alignment < 4 || (alignment & (alignment - 1)) != 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "UploadManager: copy alignment must be a power of two");
+  }
+
+  std::free(pending_);
+  std::free(order_);
+  std::free(buffer_regions_);
+  std::free(texture_regions_);
+  std::free(bounds_);
+  std::free(marks_);
+
+  const std::uint32_t n = desc.max_requests;
+  pending_ = static_cast<PendingCopy*>(std::malloc(sizeof(PendingCopy) * n));
+  order_   = static_cast<std::uint32_t*>(std::malloc(sizeof(std::uint32_t) * n));
+  // Resolving overlaps splits n requests into at most 2n - 1 pieces.
+  buffer_regions_ = static_cast<BufferCopyRegion*>(
+      std::malloc(sizeof(BufferCopyRegion) * 2 * n));
+  texture_regions_ = static_cast<TextureCopyRegion*>(
+      std::malloc(sizeof(TextureCopyRegion) * n));
+  bounds_ =
+      static_cast<std::size_t*>(std::malloc(sizeof(std::size_t) * 2 * n));
+  // One slot per in-flight frame plus the frame being closed.
+  marks_ = static_cast<FrameMark*>(
+      std::malloc(sizeof(FrameMark) * (desc.max_frames_in_flight + 1)));
+
+  if (pending_ == nullptr || order_ == nullptr || buffer_regions_ == nullptr ||
+      texture_regions_ == nullptr || bounds_ == nullptr ||
+      marks_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "UploadManager: allocation failed");
+  }
+
+  desc_                = desc;
+  desc_.copy_alignment = alignment;
+
+  pending_count_   = 0;
+  mark_head_       = 0;
+  mark_count_      = 0;
+  head_            = 0;
+  tail_            = 0;
+  used_            = 0;
+  frame_bytes_     = 0;
+  frame_requested_ = 0;
+  frame_index_     = 0;
+  completed_frame_ = 0;
+  has_completed_   = false;
+  return NavaryRC::OK();
+}
+
+void UploadManager::BeginFrame(std::uint64_t frame_index) {
+  // Close the previous frame's staging range so it retires with that frame.
+  if (frame_bytes_ > 0) {
+    const std::uint32_t mark_capacity = desc_.max_frames_in_flight + 1;
+    if (mark_count_ == mark_capacity) {
+      // Completion is lagging; fold into the newest mark (retires later,
+      // never earlier).
+      FrameMark& last =
+          marks_[(mark_head_ + mark_count_ - 1) % mark_capacity];
+      last.frame      = frame_index_;
+      last.end_offset = head_;
+      last.bytes += frame_bytes_;
+    } else {
+      FrameMark& mark = marks_[(mark_head_ + mark_count_) % mark_capacity];
+      mark.frame      = frame_index_;
+      mark.end_offset = head_;
+      mark.bytes      = frame_bytes_;
+      ++mark_count_;
+    }
+  }
+
+  pending_count_   = 0;
+  frame_bytes_     = 0;
+  frame_requested_ = 0;
+  frame_index_     = frame_index;
+}
+
+std::size_t UploadManager::remaining_budget() const {
+  if (desc_.frame_budget_bytes == 0) {
+    return std::numeric_limits<std::size_t>::max();
+  }
+  return frame_requested_ >= desc_.frame_budget_bytes
+             ? 0
+             : desc_.frame_budget_bytes - frame_requested_;
+}
+
+NavaryResult<std::size_t> UploadManager::AllocateStaging(std::size_t size) {
+  const std::size_t capacity = desc_.staging_size;
+  if (used_ == 0) {
+    head_ = 0;
+    tail_ = 0;
+  }
+
+  std::size_t offset   = 0;
+  std::size_t consumed = 0;
+
+  if (used_ == 0 || head_ > tail_) {
+    // Live range is [tail, head): free space at the end, then at the start.
+    const std::size_t aligned = AlignUp(head_, desc_.copy_alignment);
+    if (aligned + size <= capacity) {
+      offset   = aligned;
+      consumed = aligned + size - head_;
+    } else if (used_ > 0 && size <= tail_) {
+      offset   = 0;
+      consumed = (capacity - head_) + size;  // tail end is wasted
+    } else {
+      return NavaryResult<std::size_t>(NavaryRC(
+          NavaryStatus::kOutOfMemory, "UploadManager: staging ring full"));
+    }
+  } else {
+    // Wrapped: free space is [head, tail). head == tail means full.
+    const std::size_t aligned = AlignUp(head_, desc_.copy_alignment);
+    if (head_ == tail_ || aligned + size > tail_) {
+      return NavaryResult<std::size_t>(NavaryRC(
+          NavaryStatus::kOutOfMemory, "UploadManager: staging ring full"));
+    }
+    offset   = aligned;
+    consumed = aligned + size - head_;
+  }
+
+  head_ = offset + size;
+  used_ += consumed;
+  frame_bytes_ += consumed;
+  return NavaryResult<std::size_t>(offset);
+}
+
+NavaryResult<UploadManager::PendingCopy*> UploadManager::Enqueue(
+    CopyKind kind, std::size_t size) {
+  if (size == 0) {
+    return NavaryResult<PendingCopy*>(NavaryRC(
+        NavaryStatus::kInvalidArgument, "UploadManager: empty upload"));
+  }
+
+  // The first request of a frame always passes so oversized uploads still
+  // make progress.
+  if (desc_.frame_budget_bytes != 0 && frame_requested_ > 0 &&
+      frame_requested_ + size > desc_.frame_budget_bytes) {
+    return NavaryResult<PendingCopy*>(
+        NavaryRC(NavaryStatus::kOutOfMemory,
+                 "UploadManager: frame budget exhausted"));
+  }
+  if (pending_count_ >= desc_.max_requests) {
+    return NavaryResult<PendingCopy*>(NavaryRC(
+        NavaryStatus::kOutOfMemory, "UploadManager: request queue full"));
+  }
+
+  NavaryResult<std::size_t> offset_or = AllocateStaging(size);
+  if (!offset_or.status().ok()) {
+    return NavaryResult<PendingCopy*>(offset_or.status());
+  }
+
+  PendingCopy* copy = &pending_[pending_count_++];
+  *copy             = PendingCopy{};
+  copy->kind        = kind;
+  copy->src_offset  = offset_or.value();
+  copy->size        = size;
+  frame_requested_ += size;
+  return NavaryResult<PendingCopy*>(copy);
+}
+
+NavaryResult<UploadReservation> UploadManager::ReserveBuffer(
+    core::BufferHandle dst, std::size_t dst_offset, std::size_t size) {
+  NavaryResult<PendingCopy*> copy_or = Enqueue(CopyKind::kBuffer, size);
+  if (!copy_or.status().ok()) {
+    return NavaryResult<UploadReservation>(copy_or.status());
+  }
+
+  PendingCopy* copy = copy_or.value();
+  copy->dst         = dst.index;
+  copy->dst_offset  = dst_offset;
+
+  UploadReservation reservation{};
+  reservation.data   = desc_.staging_mapped + copy->src_offset;
+  reservation.size   = size;
+  reservation.ticket = UploadTicket{frame_index_};
+  return NavaryResult<UploadReservation>(reservation);
+}
+
+NavaryResult<UploadTicket> UploadManager::UploadBuffer(core::BufferHandle dst,
+                                                       std::size_t dst_offset,
+                                                       const void* data,
+                                                       std::size_t size) {
+  if (data == nullptr) {
+    return NavaryResult<UploadTicket>(
+        NavaryRC(NavaryStatus::kInvalidArgument, "UploadManager: null data"));
+  }
+
+  NavaryResult<UploadReservation> res_or =
+      ReserveBuffer(dst, dst_offset, size);
+  if (!res_or.status().ok()) {
+    return NavaryResult<UploadTicket>(res_or.status());
+  }
+
+  std::memcpy(res_or.value().data, data, size);
+  return NavaryResult<UploadTicket>(res_or.value().ticket);
+}
+
+NavaryResult<UploadReservation> UploadManager::ReserveTexture(
+    core::TextureHandle dst, std::uint32_t mip_level,
+    std::uint32_t array_layer, std::uint32_t width, std::uint32_t height,
+    std::size_t size) {
+  if (width == 0 || height == 0) {
+    return NavaryResult<UploadReservation>(
+        NavaryRC(NavaryStatus::kInvalidArgument,
+                 "UploadManager: texture extent must be > 0"));
+  }
+
+  NavaryResult<PendingCopy*> copy_or = Enqueue(CopyKind::kTexture, size);
+  if (!copy_or.status().ok()) {
+    return NavaryResult<UploadReservation>(copy_or.status());
+  }
+
+  PendingCopy* copy = copy_or.value();
+  copy->dst         = dst.index;
+  copy->mip_level   = mip_level;
+  copy->array_layer = array_layer;
+  copy->width       = width;
+  copy->height      = height;
+
+  UploadReservation reservation{};
+  reservation.data   = desc_.staging_mapped + copy->src_offset;
+  reservation.size   = size;
+  reservation.ticket = UploadTicket{frame_index_};
+  return NavaryResult<UploadReservation>(reservation);
+}
+
+NavaryResult<UploadTicket> UploadManager::UploadTexture(
+    core::TextureHandle dst, std::uint32_t mip_level,
+    std::uint32_t array_layer, std::uint32_t width, std::uint32_t height,
+    const void* data, std::size_t size) {
+  if (data == nullptr) {
+    return NavaryResult<UploadTicket>(
+        NavaryRC(NavaryStatus::kInvalidArgument, "UploadManager: null data"));
+  }
+
+  NavaryResult<UploadReservation> res_or =
+      ReserveTexture(dst, mip_level, array_layer, width, height, size);
+  if (!res_or.status().ok()) {
+    return NavaryResult<UploadTicket>(res_or.status());
+  }
+
+  std::memcpy(res_or.value().data, data, size);
+  return NavaryResult<UploadTicket>(res_or.value().ticket);
+}
+
+std::uint32_t UploadManager::MergeBufferRegions(std::uint32_t begin,
+                                                std::uint32_t end) {
+  std::uint32_t region_count = 0;
+  for (std::uint32_t i = begin; i < end; ++i) {
+    const PendingCopy& c = pending_[order_[i]];
+    if (region_count > 0) {
+      BufferCopyRegion& last = buffer_regions_[region_count - 1];
+      if (last.src_offset + last.size == c.src_offset &&
+          last.dst_offset + last.size == c.dst_offset) {
+        last.size += c.size;
+        continue;
+      }
+    }
+    buffer_regions_[region_count++] =
+        BufferCopyRegion{c.src_offset, c.dst_offset, c.size};
+  }
+  return region_count;
+}
+
+std::uint32_t UploadManager::ResolveBufferOverlaps(std::uint32_t begin,
+                                                   std::uint32_t end) {
+  // Split the destination at every request boundary; each piece between two
+  // boundaries is copied from the newest request covering it. Quadratic in
+  // the group size, but overlapping writes to one buffer are rare.
+  std::uint32_t bound_count = 0;
+  for (std::uint32_t i = begin; i < end; ++i) {
+    const PendingCopy& c   = pending_[order_[i]];
+    bounds_[bound_count++] = c.dst_offset;
+    bounds_[bound_count++] = c.dst_offset + c.size;
+  }
+  std::sort(bounds_, bounds_ + bound_count);
+  bound_count = static_cast<std::uint32_t>(
+      std::unique(bounds_, bounds_ + bound_count) - bounds_);
+
+  std::uint32_t region_count = 0;
+  for (std::uint32_t b = 0; b + 1 < bound_count; ++b) {
+    const std::size_t lo = bounds_[b];
+    const std::size_t hi = bounds_[b + 1];
+
+    const PendingCopy* newest = nullptr;
+    std::uint32_t newest_index = 0;
+    for (std::uint32_t i = begin; i < end; ++i) {
+      const PendingCopy& c = pending_[order_[i]];
+      if (c.dst_offset <= lo && c.dst_offset + c.size >= hi &&
+          (newest == nullptr || order_[i] > newest_index)) {
+        newest       = &c;
+        newest_index = order_[i];
+      }
+    }
+    if (newest == nullptr) {
+      continue;  // gap between requests
+    }
+
+    const std::size_t src = newest->src_offset + (lo - newest->dst_offset);
+    if (region_count > 0) {
+      BufferCopyRegion& last = buffer_regions_[region_count - 1];
+      if (last.src_offset + last.size == src &&
+          last.dst_offset + last.size == lo) {
+        last.size += hi - lo;
+        continue;
+      }
+    }
+    buffer_regions_[region_count++] = BufferCopyRegion{src, lo, hi - lo};
+  }
+  return region_count;
+}
+
+NavaryRC UploadManager::Flush(UploadBackend* backend, UploadStats* stats) {
+  if (backend == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "UploadManager: null backend");
+  }
+
+  UploadStats local{};
+  local.requests = pending_count_;
+
+  for (std::uint32_t i = 0; i < pending_count_; ++i) {
+    order_[i] = i;
+    local.bytes += pending_[i].size;
+  }
+
+  // Group by destination; within a destination order by target location,
+  // then by request order so duplicates stay in submission order.
+  const PendingCopy* pending = pending_;
+  std::sort(order_, order_ + pending_count_,
+            [pending](std::uint32_t a, std::uint32_t b) {
+              const PendingCopy& x = pending[a];
+              const PendingCopy& y = pending[b];
+              if (x.kind != y.kind) {
+                return x.kind < y.kind;
+              }
+              if (x.dst != y.dst) {
+                return x.dst < y.dst;
+              }
+              if (x.kind == CopyKind::kBuffer) {
+                if (x.dst_offset != y.dst_offset) {
+                  return x.dst_offset < y.dst_offset;
+                }
+              } else {
+                if (x.array_layer != y.array_layer) {
+                  return x.array_layer < y.array_layer;
+                }
+                if (x.mip_level != y.mip_level) {
+                  return x.mip_level < y.mip_level;
+                }
+              }
+              return a < b;
+            });
+
+  const core::BufferHandle staging = desc_.staging_buffer;
+
+  std::uint32_t begin = 0;
+  while (begin < pending_count_) {
+    const PendingCopy& first = pending_[order_[begin]];
+    std::uint32_t end        = begin + 1;
+    while (end < pending_count_ &&
+           pending_[order_[end]].kind == first.kind &&
+           pending_[order_[end]].dst == first.dst) {
+      ++end;
+    }
+
+    // Regions of one copy command have no defined order, so overlapping
+    // writes are resolved here: the newest request wins every byte (or
+    // subresource) it covers and the backend only sees disjoint regions.
+    bool overlaps = false;
+    for (std::uint32_t i = begin + 1; i < end && !overlaps; ++i) {
+      const PendingCopy& prev = pending_[order_[i - 1]];
+      const PendingCopy& cur  = pending_[order_[i]];
+      overlaps = first.kind == CopyKind::kBuffer
+                     ? prev.dst_offset + prev.size > cur.dst_offset
+                     : (prev.array_layer == cur.array_layer &&
+                        prev.mip_level == cur.mip_level);
+    }
+
+    if (first.kind == CopyKind::kBuffer) {
+      const std::uint32_t region_count =
+          overlaps ? ResolveBufferOverlaps(begin, end)
+                   : MergeBufferRegions(begin, end);
+
+      NAVARY_RETURN_IF_ERROR(backend->CopyBufferRegions(
+          staging, core::BufferHandle{first.dst}, buffer_regions_,
+          region_count));
+      local.regions += region_count;
+    } else {
+      // Each request replaces a whole subresource; ties are sorted by
+      // request index, so the last of a run is the newest.
+      std::uint32_t region_count = 0;
+      for (std::uint32_t i = begin; i < end; ++i) {
+        const PendingCopy& c = pending_[order_[i]];
+        if (i + 1 < end) {
+          const PendingCopy& next = pending_[order_[i + 1]];
+          if (next.array_layer == c.array_layer &&
+              next.mip_level == c.mip_level) {
+            continue;
+          }
+        }
+        texture_regions_[region_count++] = TextureCopyRegion{
+            c.src_offset, c.mip_level, c.array_layer, c.width, c.height};
+      }
+
+      NAVARY_RETURN_IF_ERROR(backend->CopyTextureRegions(
+          staging, core::TextureHandle{first.dst}, texture_regions_,
+          region_count));
+      local.regions += region_count;
+    }
+    ++local.destinations;
+
+    begin = end;
+  }
+
+  pending_count_ = 0;
+  if (stats != nullptr) {
+    *stats = local;
+  }
+  return NavaryRC::OK();
+}
+
+void UploadManager::NotifyFrameComplete(std::uint64_t frame_index) {
+  if (!has_completed_ || frame_index > completed_frame_) {
+    completed_frame_ = frame_index;
+    has_completed_   = true;
+  }
+
+  const std::uint32_t mark_capacity = desc_.max_frames_in_flight + 1;
+  while (mark_count_ > 0 && marks_[mark_head_].frame <= completed_frame_) {
+    const FrameMark& mark = marks_[mark_head_];
+    tail_                 = mark.end_offset;
+    used_ -= mark.bytes;
+    mark_head_ = (mark_head_ + 1) % mark_capacity;
+    --mark_count_;
+  }
+
+  if (used_ == 0) {
+    head_ = 0;
+    tail_ = 0;
+  }
+}
+
+}  // namespace navary::render::v1
@@ -0,0 +1,215 @@
+#pragma once
+
+// navary/render/v1/upload_manager.h
+// Staging upload manager for buffers and textures.
+// Purpose:
+//   - One large persistently mapped staging ring shared by every uploader
+//     (texture streaming, meshes, material parameters).
+//   - Requests are copied (or read directly) into staging and queued; Flush()
+//     sorts them per destination and merges contiguous regions so each
+//     destination gets a single batched copy call. Overlapping requests are
+//     resolved on the CPU (newest wins), so regions never overlap.
+//   - Per-frame byte budget bounds upload cost; over-budget requests fail
+//     with kOutOfMemory and should be retried next frame.
+//   - Staging memory is reclaimed by frame index once the GPU finished it.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstddef>
+#include <cstdint>
+
+#include "navary/core/handles.h"
+#include "navary/navary_status.h"
+
+namespace navary::render::v1 {
+
+struct BufferCopyRegion {
+  std::size_t src_offset;  // in the staging buffer
+  std::size_t dst_offset;
+  std::size_t size;
+};
+
+// Whole mip level (of one array layer) copied from tightly packed rows.
+struct TextureCopyRegion {
+  std::size_t src_offset;
+  std::uint32_t mip_level;
+  std::uint32_t array_layer;
+  std::uint32_t width;
+  std::uint32_t height;
+};
+
+// Records the batched copies. One call per destination per Flush(); the
+// regions of a call never overlap. An error means the copies were not
+// recorded; Flush() returns it.
+class UploadBackend {
+ public:
+  virtual ~UploadBackend() = default;
+
+  virtual NavaryRC CopyBufferRegions(core::BufferHandle staging,
+                                     core::BufferHandle dst,
+                                     const BufferCopyRegion* regions,
+                                     std::uint32_t count) = 0;
+
+  virtual NavaryRC CopyTextureRegions(core::BufferHandle staging,
+                                      core::TextureHandle dst,
+                                      const TextureCopyRegion* regions,
+                                      std::uint32_t count) = 0;
+};
+
+// Completion token; the upload is visible to GPU work submitted after
+// frame |frame| once NotifyFrameComplete(frame) has been called.
+struct UploadTicket {
+  std::uint64_t frame;
+};
+
+// Staging memory the caller fills directly (e.g. file reads).
+struct UploadReservation {
+  std::uint8_t* data;
+  std::size_t size;
+  UploadTicket ticket;
+};
+
+struct UploadManagerDesc {
+  core::BufferHandle staging_buffer;
+  std::uint8_t* staging_mapped;  // persistently mapped, host-coherent
+  std::size_t staging_size;
+
+  std::size_t frame_budget_bytes;  // 0 = unlimited
+  std::uint32_t max_requests;      // queued copies per frame
+  std::uint32_t max_frames_in_flight;
+
+  // Staging offset alignment (optimalBufferCopyOffsetAlignment, >= 4).
+  std::size_t copy_alignment;
+};
+
+struct UploadStats {
+  std::uint32_t requests;
+  std::uint32_t regions;       // after coalescing
+  std::uint32_t destinations;  // backend copy calls
+  std::size_t bytes;
+};
+
+class UploadManager {
+ public:
+  UploadManager();
+  ~UploadManager();
+
+  UploadManager(const UploadManager&)            = delete;
+  UploadManager& operator=(const UploadManager&) = delete;
+
+  NavaryRC Init(const UploadManagerDesc& desc);
+
+  // Starts accepting requests for |frame_index| (monotonic) and resets the
+  // frame budget. Requests not flushed in the previous frame are dropped.
+  void BeginFrame(std::uint64_t frame_index);
+
+  // Copies |size| bytes into staging and queues a buffer copy.
+  NavaryResult<UploadTicket> UploadBuffer(core::BufferHandle dst,
+                                          std::size_t dst_offset,
+                                          const void* data, std::size_t size);
+
+  // Queues a buffer copy; the caller writes the bytes through |data| before
+  // Flush().
+  NavaryResult<UploadReservation> ReserveBuffer(core::BufferHandle dst,
+                                                std::size_t dst_offset,
+                                                std::size_t size);
+
+  // Copies one mip level (tightly packed, |size| bytes) into staging.
+  NavaryResult<UploadTicket> UploadTexture(core::TextureHandle dst,
+                                           std::uint32_t mip_level,
+                                           std::uint32_t array_layer,
+                                           std::uint32_t width,
+                                           std::uint32_t height,
+                                           const void* data,
+                                           std::size_t size);
+
+  NavaryResult<UploadReservation> ReserveTexture(core::TextureHandle dst,
+                                                 std::uint32_t mip_level,
+                                                 std::uint32_t array_layer,
+                                                 std::uint32_t width,
+                                                 std::uint32_t height,
+                                                 std::size_t size);
+
+  // Sorts, coalesces and records this frame's copies through |backend|.
+  // Stops at the first backend error and keeps the queue, so the caller can
+  // fix the cause and Flush() again (re-recording is harmless: the staging
+  // bytes are unchanged). Calling BeginFrame() instead drops the queue and
+  // this frame's tickets must be treated as failed.
+  NavaryRC Flush(UploadBackend* backend, UploadStats* stats = nullptr);
+
+  // GPU finished every submission of frames <= |frame_index|; reclaims their
+  // staging memory.
+  void NotifyFrameComplete(std::uint64_t frame_index);
+
+  bool IsComplete(UploadTicket ticket) const {
+    return has_completed_ && ticket.frame <= completed_frame_;
+  }
+
+  // Bytes a request could still use this frame.
+  std::size_t remaining_budget() const;
+
+  std::size_t staging_in_use() const {
+    return used_;
+  }
+  std::uint64_t frame_index() const {
+    return frame_index_;
+  }
+
+ private:
+  enum class CopyKind : std::uint8_t {
+    kBuffer  = 0,
+    kTexture = 1,
+  };
+
+  struct PendingCopy {
+    CopyKind kind;
+    std::uint32_t dst;  // handle index
+    std::size_t src_offset;
+    std::size_t size;
+    std::size_t dst_offset;  // buffers
+    std::uint32_t mip_level;
+    std::uint32_t array_layer;
+    std::uint32_t width;
+    std::uint32_t height;
+  };
+
+  struct FrameMark {
+    std::uint64_t frame;
+    std::size_t end_offset;  // staging head after the frame's allocations
+    std::size_t bytes;       // consumed including padding / wrap waste
+  };
+
+  NavaryResult<std::size_t> AllocateStaging(std::size_t size);
+  NavaryResult<PendingCopy*> Enqueue(CopyKind kind, std::size_t size);
+
+  // Fill buffer_regions_ from the sorted group order_[begin, end) and return
+  // the region count. Merge assumes disjoint requests; Resolve cuts
+  // overlapping ones into disjoint pieces taken from the newest request.
+  std::uint32_t MergeBufferRegions(std::uint32_t begin, std::uint32_t end);
+  std::uint32_t ResolveBufferOverlaps(std::uint32_t begin, std::uint32_t end);
+
+  UploadManagerDesc desc_;
+
+  PendingCopy* pending_;
+  std::uint32_t* order_;
+  BufferCopyRegion* buffer_regions_;
+  TextureCopyRegion* texture_regions_;
+  std::size_t* bounds_;  // overlap split points, 2 per request
+  std::uint32_t pending_count_;
+
+  FrameMark* marks_;
+  std::uint32_t mark_head_;
+  std::uint32_t mark_count_;
+
+  std::size_t head_;
+  std::size_t tail_;
+  std::size_t used_;
+  std::size_t frame_bytes_;     // staging consumed by the open frame
+  std::size_t frame_requested_; // payload bytes requested this frame
+
+  std::uint64_t frame_index_;
+  std::uint64_t completed_frame_;
+  bool has_completed_;
+};
+
+}  // namespace navary::render::v1
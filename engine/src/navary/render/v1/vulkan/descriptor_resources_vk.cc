@@ -117,6 +117,18 @@ VulkanDescriptorResourceTable::RegisterTexture(VkImageView view,
   return NavaryResult<core::TextureHandle>(core::TextureHandle{index});
 }
 
+NavaryRC VulkanDescriptorResourceTable::UpdateTexture(
+    core::TextureHandle texture, VkImageView view, VkSampler sampler) {
+  if (texture.index >= texture_count_) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "UpdateTexture: invalid texture handle");
+  }
+
+  texture_views_[texture.index]    = view;
+  texture_samplers_[texture.index] = sampler;
+  return NavaryRC::OK();
+}
+
 NavaryResult<core::BufferHandle>
 VulkanDescriptorResourceTable::RegisterUniformBuffer(VkBuffer buffer) {
   if (buffer_count_ >= max_buffers_) {
@@ -37,6 +37,11 @@ class VulkanDescriptorResourceTable {
   NavaryResult<core::TextureHandle> RegisterTexture(VkImageView view,
                                                     VkSampler sampler);
 
+  // Rebinds an already registered texture slot. Used for per-frame transient
+  // images so their slots are reused instead of growing the table.
+  NavaryRC UpdateTexture(core::TextureHandle texture, VkImageView view,
+                         VkSampler sampler);
+
   // Registers a uniform buffer. Engine must have created it.
   NavaryResult<core::BufferHandle> RegisterUniformBuffer(VkBuffer buffer);
 
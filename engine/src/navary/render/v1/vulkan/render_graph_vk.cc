@@ -0,0 +1,710 @@
+// navary/render/v1/vulkan/render_graph_vk.cc
+// Implementation of RenderGraphBackendVk.
+// This file is part of the Navary rendering engine.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include "navary/render/v1/vulkan/render_graph_vk.h"
+
+#include <cstdlib>
+
+namespace navary::render::v1::vulkan {
+
+namespace {
+
+constexpr RgAccessFlags kShaderAccessMask =
+    kRgAccessSampled | kRgAccessStorageRead | kRgAccessStorageWrite |
+    kRgAccessUniform;
+
+VkPipelineStageFlags ShaderStages(RgPassType type) {
+  switch (type) {
+    case RgPassType::kCompute:
+      return VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    case RgPassType::kTransfer:
+      return VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    case RgPassType::kRaster:
+    default:
+      return VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+  }
+}
+
+VkPipelineStageFlags ShaderStagesOf(RgPassTypeMask types) {
+  VkPipelineStageFlags s = 0;
+  for (std::uint32_t t = 0; t <= static_cast<std::uint32_t>(
+                               RgPassType::kTransfer);
+       ++t) {
+    const auto type = static_cast<RgPassType>(t);
+    if (types & RgPassTypeBit(type)) {
+      s |= ShaderStages(type);
+    }
+  }
+  return s;
+}
+
+VkPipelineStageFlags ToStages(RgAccessFlags a, RgPassTypeMask types) {
+  VkPipelineStageFlags s = 0;
+  if (a & kRgAccessColorAttachment) {
+    s |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+  }
+  if (a & (kRgAccessDepthRead | kRgAccessDepthWrite)) {
+    s |= VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+         VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+  }
+  if (a & kShaderAccessMask) {
+    s |= ShaderStagesOf(types);
+  }
+  if (a & (kRgAccessTransferSrc | kRgAccessTransferDst)) {
+    s |= VK_PIPELINE_STAGE_TRANSFER_BIT;
+  }
+  if (a & kRgAccessIndirect) {
+    s |= VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+  }
+  if (a & kRgAccessVertexIndex) {
+    s |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+  }
+  if (a & kRgAccessPresent) {
+    s |= VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+  }
+  return s;
+}
+
+VkAccessFlags ToAccess(RgAccessFlags a) {
+  VkAccessFlags f = 0;
+  if (a & kRgAccessColorAttachment) {
+    f |= VK_ACCESS_COLOR_ATTACHMENT_READ_BIT |
+         VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+  }
+  if (a & kRgAccessDepthWrite) {
+    f |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+  }
+  if (a & kRgAccessDepthRead) {
+    f |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
+  }
+  if (a & (kRgAccessSampled | kRgAccessStorageRead)) {
+    f |= VK_ACCESS_SHADER_READ_BIT;
+  }
+  if (a & kRgAccessStorageWrite) {
+    f |= VK_ACCESS_SHADER_WRITE_BIT;
+  }
+  if (a & kRgAccessUniform) {
+    f |= VK_ACCESS_UNIFORM_READ_BIT;
+  }
+  if (a & kRgAccessTransferSrc) {
+    f |= VK_ACCESS_TRANSFER_READ_BIT;
+  }
+  if (a & kRgAccessTransferDst) {
+    f |= VK_ACCESS_TRANSFER_WRITE_BIT;
+  }
+  if (a & kRgAccessIndirect) {
+    f |= VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+  }
+  if (a & kRgAccessVertexIndex) {
+    f |= VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT;
+  }
+  return f;
+}
+
+// Accesses needing different layouts in the same pass fall back to GENERAL.
+VkImageLayout ToLayout(RgAccessFlags a) {
+  if (a == kRgAccessNone) {
+    return VK_IMAGE_LAYOUT_UNDEFINED;
+  }
+  if (a == kRgAccessPresent) {
+    return VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+  }
+  if (a == kRgAccessColorAttachment) {
+    return VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+  }
+  if ((a & kRgAccessDepthWrite) &&
+      (a & ~(kRgAccessDepthWrite | kRgAccessDepthRead)) == 0) {
+    return VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+  }
+  if ((a & kRgAccessDepthRead) &&
+      (a & ~(kRgAccessDepthRead | kRgAccessSampled)) == 0) {
+    return VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+  }
+  if (a == kRgAccessSampled) {
+    return VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+  }
+  if (a == kRgAccessTransferSrc) {
+    return VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+  }
+  if (a == kRgAccessTransferDst) {
+    return VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+  }
+  return VK_IMAGE_LAYOUT_GENERAL;
+}
+
+VkImageUsageFlags ToImageUsage(RgAccessFlags a) {
+  VkImageUsageFlags u = 0;
+  if (a & kRgAccessColorAttachment) {
+    u |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+  }
+  if (a & (kRgAccessDepthRead | kRgAccessDepthWrite)) {
+    u |= VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+  }
+  if (a & kRgAccessSampled) {
+    u |= VK_IMAGE_USAGE_SAMPLED_BIT;
+  }
+  if (a & (kRgAccessStorageRead | kRgAccessStorageWrite)) {
+    u |= VK_IMAGE_USAGE_STORAGE_BIT;
+  }
+  if (a & kRgAccessTransferSrc) {
+    u |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+  }
+  if (a & kRgAccessTransferDst) {
+    u |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+  }
+  return u;
+}
+
+VkBufferUsageFlags ToBufferUsage(RgAccessFlags a) {
+  VkBufferUsageFlags u = 0;
+  if (a & (kRgAccessStorageRead | kRgAccessStorageWrite)) {
+    u |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+  }
+  if (a & kRgAccessUniform) {
+    u |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+  }
+  if (a & kRgAccessIndirect) {
+    u |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+  }
+  if (a & kRgAccessVertexIndex) {
+    u |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+  }
+  if (a & kRgAccessTransferSrc) {
+    u |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+  }
+  if (a & kRgAccessTransferDst) {
+    u |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+  }
+  return u;
+}
+
+// Every aspect of |format|; barriers and layout transitions need all of
+// them.
+VkImageAspectFlags ToAspect(VkFormat format) {
+  switch (format) {
+    case VK_FORMAT_D16_UNORM:
+    case VK_FORMAT_X8_D24_UNORM_PACK32:
+    case VK_FORMAT_D32_SFLOAT:
+      return VK_IMAGE_ASPECT_DEPTH_BIT;
+    case VK_FORMAT_S8_UINT:
+      return VK_IMAGE_ASPECT_STENCIL_BIT;
+    case VK_FORMAT_D16_UNORM_S8_UINT:
+    case VK_FORMAT_D24_UNORM_S8_UINT:
+    case VK_FORMAT_D32_SFLOAT_S8_UINT:
+      return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+    default:
+      return VK_IMAGE_ASPECT_COLOR_BIT;
+  }
+}
+
+// Views read by shaders must name a single aspect; depth-stencil images
+// are sampled / stored through their depth.
+VkImageAspectFlags ToViewAspect(VkImageAspectFlags aspect,
+                                RgAccessFlags usage) {
+  const bool shader = (usage & kShaderAccessMask) != 0;
+  if (shader && (aspect & VK_IMAGE_ASPECT_DEPTH_BIT) != 0) {
+    return VK_IMAGE_ASPECT_DEPTH_BIT;
+  }
+  return aspect;
+}
+
+bool SameDesc(const RgResourceDesc& a, const RgResourceDesc& b) {
+  if (a.kind != b.kind || a.usage != b.usage) {
+    return false;
+  }
+  if (a.kind == RgResourceKind::kBuffer) {
+    return a.buffer.size == b.buffer.size;
+  }
+  return a.image.width == b.image.width && a.image.height == b.image.height &&
+         a.image.mip_levels == b.image.mip_levels &&
+         a.image.format == b.image.format;
+}
+
+bool HeapFits(VkDeviceMemory memory, std::uint32_t memory_type,
+              VkDeviceSize size, const RgHeapInfo& info) {
+  return memory != VK_NULL_HANDLE && memory_type == info.heap_class &&
+         size >= info.size;
+}
+
+VkImageCreateInfo MakeImageInfo(const RgResourceDesc& desc) {
+  VkImageCreateInfo info{};
+  info.sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+  info.imageType     = VK_IMAGE_TYPE_2D;
+  info.format        = static_cast<VkFormat>(desc.image.format);
+  info.extent.width  = desc.image.width;
+  info.extent.height = desc.image.height;
+  info.extent.depth  = 1;
+  info.mipLevels     = desc.image.mip_levels == 0 ? 1 : desc.image.mip_levels;
+  info.arrayLayers   = 1;
+  info.samples       = VK_SAMPLE_COUNT_1_BIT;
+  info.tiling        = VK_IMAGE_TILING_OPTIMAL;
+  info.usage         = ToImageUsage(desc.usage);
+  info.sharingMode   = VK_SHARING_MODE_EXCLUSIVE;
+  info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+  return info;
+}
+
+VkBufferCreateInfo MakeBufferInfo(const RgResourceDesc& desc) {
+  VkBufferCreateInfo info{};
+  info.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+  info.size        = desc.buffer.size;
+  info.usage       = ToBufferUsage(desc.usage);
+  info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  return info;
+}
+
+// Requirements of a throwaway object created with the same info the
+// transient will use.
+NavaryRC ProbeRequirements(VkDevice device, const RgResourceDesc& desc,
+                           VkMemoryRequirements* req) {
+  if (desc.kind == RgResourceKind::kImage) {
+    const VkImageCreateInfo info = MakeImageInfo(desc);
+    VkImage probe                = VK_NULL_HANDLE;
+    if (vkCreateImage(device, &info, nullptr, &probe) != VK_SUCCESS) {
+      return NavaryRC(NavaryStatus::kInternal,
+                      "RenderGraphBackendVk: probe image creation failed");
+    }
+    vkGetImageMemoryRequirements(device, probe, req);
+    vkDestroyImage(device, probe, nullptr);
+  } else {
+    const VkBufferCreateInfo info = MakeBufferInfo(desc);
+    VkBuffer probe                = VK_NULL_HANDLE;
+    if (vkCreateBuffer(device, &info, nullptr, &probe) != VK_SUCCESS) {
+      return NavaryRC(NavaryStatus::kInternal,
+                      "RenderGraphBackendVk: probe buffer creation failed");
+    }
+    vkGetBufferMemoryRequirements(device, probe, req);
+    vkDestroyBuffer(device, probe, nullptr);
+  }
+  return NavaryRC::OK();
+}
+
+// Caller guarantees bits != 0.
+std::uint32_t LowestBit(std::uint32_t bits) {
+  std::uint32_t i = 0;
+  while ((bits & (1u << i)) == 0) {
+    ++i;
+  }
+  return i;
+}
+
+}  // namespace
+
+RenderGraphBackendVk::RenderGraphBackendVk()
+    : desc_{},
+      cmd_(VK_NULL_HANDLE),
+      transients_(nullptr),
+      externals_(nullptr),
+      heaps_{},
+      texture_slots_(nullptr),
+      texture_slot_used_(nullptr),
+      texture_slot_count_(0),
+      requirements_(nullptr),
+      requirements_count_(0),
+      requirements_next_(0),
+      image_barriers_(nullptr),
+      buffer_barriers_(nullptr) {}
+
+RenderGraphBackendVk::~RenderGraphBackendVk() {
+  Shutdown();
+  std::free(transients_);
+  std::free(externals_);
+  std::free(texture_slots_);
+  std::free(texture_slot_used_);
+  std::free(requirements_);
+  std::free(image_barriers_);
+  std::free(buffer_barriers_);
+}
+
+NavaryRC RenderGraphBackendVk::Init(const RenderGraphVkDesc& desc) {
+  if (desc.device == VK_NULL_HANDLE || desc.max_resources == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraphBackendVk: invalid desc");
+  }
+
+  desc_ = desc;
+
+  transients_ = static_cast<Transient*>(
+      std::calloc(desc.max_resources, sizeof(Transient)));
+  externals_ = static_cast<External*>(
+      std::calloc(desc.max_external == 0 ? 1 : desc.max_external,
+                  sizeof(External)));
+  texture_slots_ = static_cast<core::TextureHandle*>(
+      std::malloc(sizeof(core::TextureHandle) * desc.max_resources));
+  texture_slot_used_ =
+      static_cast<std::uint8_t*>(std::calloc(desc.max_resources, 1));
+  requirements_ = static_cast<CachedRequirements*>(
+      std::malloc(sizeof(CachedRequirements) * desc.max_resources));
+  image_barriers_ = static_cast<VkImageMemoryBarrier*>(
+      std::malloc(sizeof(VkImageMemoryBarrier) * desc.max_barriers));
+  buffer_barriers_ = static_cast<VkBufferMemoryBarrier*>(
+      std::malloc(sizeof(VkBufferMemoryBarrier) * desc.max_barriers));
+
+  if (transients_ == nullptr || externals_ == nullptr ||
+      texture_slots_ == nullptr || texture_slot_used_ == nullptr ||
+      requirements_ == nullptr || image_barriers_ == nullptr ||
+      buffer_barriers_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "RenderGraphBackendVk: storage alloc failed");
+  }
+
+  return NavaryRC::OK();
+}
+
+void RenderGraphBackendVk::Shutdown() {
+  if (desc_.device == VK_NULL_HANDLE || transients_ == nullptr) {
+    return;
+  }
+
+  DestroyTransients();
+  for (Heap& h : heaps_) {
+    if (h.memory != VK_NULL_HANDLE) {
+      vkFreeMemory(desc_.device, h.memory, nullptr);
+    }
+    h = Heap{};
+  }
+}
+
+NavaryRC RenderGraphBackendVk::SetExternalImage(std::uint32_t external_index,
+                                                VkImage image,
+                                                VkImageAspectFlags aspect) {
+  if (external_index >= desc_.max_external) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraphBackendVk: external index out of range");
+  }
+  externals_[external_index].image  = image;
+  externals_[external_index].aspect = aspect;
+  return NavaryRC::OK();
+}
+
+NavaryRC RenderGraphBackendVk::SetExternalBuffer(std::uint32_t external_index,
+                                                 VkBuffer buffer) {
+  if (external_index >= desc_.max_external) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraphBackendVk: external index out of range");
+  }
+  externals_[external_index].buffer = buffer;
+  return NavaryRC::OK();
+}
+
+// The renderer targets Vulkan 1.1, so vkGetDevice*MemoryRequirements
+// (1.3 / VK_KHR_maintenance4) is not available: requirements come from a
+// probe object. Graphs are recompiled with the same descs, so results are
+// cached and the probe only runs for descs not seen recently.
+NavaryResult<RgMemoryRequirements> RenderGraphBackendVk::GetMemoryRequirements(
+    const RgResourceDesc& desc) {
+  VkMemoryRequirements req{};
+  bool cached = false;
+  for (std::uint32_t i = 0; i < requirements_count_ && !cached; ++i) {
+    if (SameDesc(requirements_[i].desc, desc)) {
+      req    = requirements_[i].req;
+      cached = true;
+    }
+  }
+
+  if (!cached) {
+    NAVARY_RETURN_IF_ERROR(ProbeRequirements(desc_.device, desc, &req));
+    std::uint32_t entry = requirements_count_;
+    if (entry == desc_.max_resources) {
+      entry              = requirements_next_;
+      requirements_next_ = (requirements_next_ + 1) % desc_.max_resources;
+    } else {
+      ++requirements_count_;
+    }
+    requirements_[entry] = CachedRequirements{desc, req};
+  }
+
+  const std::uint32_t types =
+      req.memoryTypeBits & desc_.allowed_memory_type_bits;
+  if (types == 0) {
+    return NavaryResult<RgMemoryRequirements>(
+        NavaryRC(NavaryStatus::kNotFound,
+                 "RenderGraphBackendVk: no allowed memory type fits"));
+  }
+
+  RgMemoryRequirements out{};
+  out.size       = static_cast<std::size_t>(req.size);
+  out.alignment  = static_cast<std::size_t>(req.alignment);
+  out.heap_class = LowestBit(types);  // memory type index
+  return NavaryResult<RgMemoryRequirements>(out);
+}
+
+// The texture slot stays registered (pointing at the dead view) until a
+// later sampled transient takes it over.
+void RenderGraphBackendVk::DestroyTransient(Transient* t) {
+  if (t->view != VK_NULL_HANDLE) {
+    vkDestroyImageView(desc_.device, t->view, nullptr);
+  }
+  if (t->image != VK_NULL_HANDLE) {
+    vkDestroyImage(desc_.device, t->image, nullptr);
+  }
+  if (t->buffer != VK_NULL_HANDLE) {
+    vkDestroyBuffer(desc_.device, t->buffer, nullptr);
+  }
+  if (t->has_texture) {
+    texture_slot_used_[t->texture_slot] = 0;
+  }
+  *t = Transient{};
+}
+
+void RenderGraphBackendVk::DestroyTransients() {
+  for (std::uint32_t i = 0; i < desc_.max_resources; ++i) {
+    DestroyTransient(&transients_[i]);
+  }
+}
+
+NavaryRC RenderGraphBackendVk::EnsureHeap(std::uint32_t heap,
+                                          const RgHeapInfo& info) {
+  Heap& h = heaps_[heap];
+  if (HeapFits(h.memory, h.memory_type, h.size, info)) {
+    return NavaryRC::OK();
+  }
+
+  if (h.memory != VK_NULL_HANDLE) {
+    vkFreeMemory(desc_.device, h.memory, nullptr);
+    h = Heap{};
+  }
+
+  VkMemoryAllocateInfo alloc{};
+  alloc.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+  alloc.allocationSize  = info.size;
+  alloc.memoryTypeIndex = info.heap_class;
+
+  if (vkAllocateMemory(desc_.device, &alloc, nullptr, &h.memory) !=
+      VK_SUCCESS) {
+    h = Heap{};
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "RenderGraphBackendVk: vkAllocateMemory failed");
+  }
+
+  h.size        = info.size;
+  h.memory_type = info.heap_class;
+  return NavaryRC::OK();
+}
+
+NavaryRC RenderGraphBackendVk::CreateTransient(
+    const RgTransientPlacement& placement) {
+  Transient& t          = transients_[placement.resource.index];
+  VkDeviceMemory memory = heaps_[placement.heap].memory;
+  t.desc                = placement.desc;
+  t.heap                = placement.heap;
+  t.offset              = placement.offset;
+
+  if (placement.desc.kind == RgResourceKind::kBuffer) {
+    const VkBufferCreateInfo info = MakeBufferInfo(placement.desc);
+    if (vkCreateBuffer(desc_.device, &info, nullptr, &t.buffer) !=
+            VK_SUCCESS ||
+        vkBindBufferMemory(desc_.device, t.buffer, memory, placement.offset) !=
+            VK_SUCCESS) {
+      return NavaryRC(NavaryStatus::kInternal,
+                      "RenderGraphBackendVk: transient buffer failed");
+    }
+    t.live = true;
+    return NavaryRC::OK();
+  }
+
+  const VkImageCreateInfo info = MakeImageInfo(placement.desc);
+  if (vkCreateImage(desc_.device, &info, nullptr, &t.image) != VK_SUCCESS ||
+      vkBindImageMemory(desc_.device, t.image, memory, placement.offset) !=
+          VK_SUCCESS) {
+    return NavaryRC(NavaryStatus::kInternal,
+                    "RenderGraphBackendVk: transient image failed");
+  }
+
+  t.aspect = ToAspect(info.format);
+
+  VkImageViewCreateInfo view{};
+  view.sType    = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+  view.image    = t.image;
+  view.viewType = VK_IMAGE_VIEW_TYPE_2D;
+  view.format   = info.format;
+  view.subresourceRange.aspectMask =
+      ToViewAspect(t.aspect, placement.desc.usage);
+  view.subresourceRange.levelCount = info.mipLevels;
+  view.subresourceRange.layerCount = 1;
+
+  if (vkCreateImageView(desc_.device, &view, nullptr, &t.view) !=
+      VK_SUCCESS) {
+    return NavaryRC(NavaryStatus::kInternal,
+                    "RenderGraphBackendVk: transient view failed");
+  }
+
+  // Sampled transients get a texture slot; freed slots are reused.
+  if (desc_.resource_table != nullptr &&
+      (placement.desc.usage & kRgAccessSampled) != 0) {
+    std::uint32_t slot = 0;
+    while (slot < texture_slot_count_ && texture_slot_used_[slot] != 0) {
+      ++slot;
+    }
+    if (slot < texture_slot_count_) {
+      NAVARY_RETURN_IF_ERROR(desc_.resource_table->UpdateTexture(
+          texture_slots_[slot], t.view, desc_.transient_sampler));
+    } else {
+      NavaryResult<core::TextureHandle> tex =
+          desc_.resource_table->RegisterTexture(t.view,
+                                                desc_.transient_sampler);
+      if (!tex.status().ok()) {
+        return tex.status();
+      }
+      texture_slots_[texture_slot_count_++] = tex.value();
+    }
+    texture_slot_used_[slot] = 1;
+    t.texture                = texture_slots_[slot];
+    t.texture_slot           = slot;
+    t.has_texture            = true;
+  }
+
+  t.live = true;
+  return NavaryRC::OK();
+}
+
+NavaryRC RenderGraphBackendVk::RealizeTransients(
+    const RgTransientPlacement* placements, std::uint32_t placement_count,
+    const RgHeapInfo* heaps, std::uint32_t heap_count) {
+  if (heap_count > RenderGraph::kMaxHeaps) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraphBackendVk: too many heaps");
+  }
+  for (std::uint32_t i = 0; i < placement_count; ++i) {
+    if (placements[i].resource.index >= desc_.max_resources ||
+        placements[i].heap >= heap_count) {
+      return NavaryRC(NavaryStatus::kInvalidArgument,
+                      "RenderGraphBackendVk: placement out of range");
+    }
+  }
+
+  // A recompiled graph usually places everything where it was; those
+  // objects stay. Anything moved, resized or on a heap about to be
+  // reallocated is destroyed before its memory goes away.
+  for (std::uint32_t i = 0; i < desc_.max_resources; ++i) {
+    transients_[i].keep = false;
+  }
+  for (std::uint32_t i = 0; i < placement_count; ++i) {
+    const RgTransientPlacement& pl = placements[i];
+    Transient& t                   = transients_[pl.resource.index];
+    const Heap& h                  = heaps_[pl.heap];
+    t.keep = t.live && t.heap == pl.heap && t.offset == pl.offset &&
+             SameDesc(t.desc, pl.desc) &&
+             HeapFits(h.memory, h.memory_type, h.size, heaps[pl.heap]);
+  }
+  for (std::uint32_t i = 0; i < desc_.max_resources; ++i) {
+    if (!transients_[i].keep) {
+      DestroyTransient(&transients_[i]);  // also a failed half-creation
+    }
+  }
+
+  for (std::uint32_t h = 0; h < heap_count; ++h) {
+    NAVARY_RETURN_IF_ERROR(EnsureHeap(h, heaps[h]));
+  }
+
+  for (std::uint32_t i = 0; i < placement_count; ++i) {
+    if (!transients_[placements[i].resource.index].live) {
+      NAVARY_RETURN_IF_ERROR(CreateTransient(placements[i]));
+    }
+  }
+
+  return NavaryRC::OK();
+}
+
+NavaryRC RenderGraphBackendVk::RecordBarriers(const RgBarrier* barriers,
+                                              std::uint32_t count) {
+  // Dropping part of a batch would leave a hazard; size max_barriers from
+  // RenderGraph::max_batch_barriers().
+  if (count > desc_.max_barriers) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "RenderGraphBackendVk: barrier batch exceeds max_barriers");
+  }
+  if (cmd_ == VK_NULL_HANDLE) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "RenderGraphBackendVk: no command buffer set");
+  }
+
+  VkPipelineStageFlags src_stages = 0;
+  VkPipelineStageFlags dst_stages = 0;
+  std::uint32_t image_count       = 0;
+  std::uint32_t buffer_count      = 0;
+
+  for (std::uint32_t i = 0; i < count; ++i) {
+    const RgBarrier& b = barriers[i];
+    const bool external = b.external_index != kRgInvalidIndex;
+
+    src_stages |= ToStages(b.src_access, b.src_pass_types);
+    dst_stages |= ToStages(b.dst_access, RgPassTypeBit(b.dst_pass_type));
+
+    if (b.kind == RgResourceKind::kImage) {
+      VkImageMemoryBarrier& ib = image_barriers_[image_count++];
+      ib                       = VkImageMemoryBarrier{};
+      ib.sType                 = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+      ib.srcAccessMask         = ToAccess(b.src_access);
+      ib.dstAccessMask         = ToAccess(b.dst_access);
+      ib.oldLayout = b.discard ? VK_IMAGE_LAYOUT_UNDEFINED
+                               : ToLayout(b.src_access);
+      ib.newLayout           = ToLayout(b.dst_access);
+      ib.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+      ib.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+      ib.image  = external ? externals_[b.external_index].image
+                           : transients_[b.resource.index].image;
+      ib.subresourceRange.aspectMask =
+          external ? externals_[b.external_index].aspect
+                   : transients_[b.resource.index].aspect;
+      ib.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+      ib.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+    } else {
+      VkBufferMemoryBarrier& bb = buffer_barriers_[buffer_count++];
+      bb                        = VkBufferMemoryBarrier{};
+      bb.sType                  = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+      bb.srcAccessMask          = ToAccess(b.src_access);
+      bb.dstAccessMask          = ToAccess(b.dst_access);
+      bb.srcQueueFamilyIndex    = VK_QUEUE_FAMILY_IGNORED;
+      bb.dstQueueFamilyIndex    = VK_QUEUE_FAMILY_IGNORED;
+      bb.buffer = external ? externals_[b.external_index].buffer
+                           : transients_[b.resource.index].buffer;
+      bb.offset = 0;
+      bb.size   = VK_WHOLE_SIZE;
+    }
+  }
+
+  if (src_stages == 0) {
+    src_stages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+  }
+  if (dst_stages == 0) {
+    dst_stages = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+  }
+
+  vkCmdPipelineBarrier(cmd_, src_stages, dst_stages, 0, 0, nullptr,
+                       buffer_count, buffer_barriers_, image_count,
+                       image_barriers_);
+  return NavaryRC::OK();
+}
+
+VkImage RenderGraphBackendVk::GetImage(RgResourceHandle resource) const {
+  return resource.index < desc_.max_resources
+             ? transients_[resource.index].image
+             : VK_NULL_HANDLE;
+}
+
+VkImageView RenderGraphBackendVk::GetImageView(
+    RgResourceHandle resource) const {
+  return resource.index < desc_.max_resources
+             ? transients_[resource.index].view
+             : VK_NULL_HANDLE;
+}
+
+VkBuffer RenderGraphBackendVk::GetBuffer(RgResourceHandle resource) const {
+  return resource.index < desc_.max_resources
+             ? transients_[resource.index].buffer
+             : VK_NULL_HANDLE;
+}
+
+core::TextureHandle RenderGraphBackendVk::GetTexture(
+    RgResourceHandle resource) const {
+  return resource.index < desc_.max_resources
+             ? transients_[resource.index].texture
+             : core::TextureHandle{0};
+}
+
+}  // namespace navary::render::v1::vulkan
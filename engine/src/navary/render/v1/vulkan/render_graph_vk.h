@@ -0,0 +1,142 @@
+#pragma once
+
+// navary/render/v1/vulkan/render_graph_vk.h
+// Vulkan implementation of RenderGraphBackend.
+// Owns one VkDeviceMemory heap per RenderGraph heap class, creates aliased
+// transient images/buffers on it and records each barrier batch as a single
+// vkCmdPipelineBarrier. Sampled transients are exposed to materials through
+// VulkanDescriptorResourceTable texture slots. Transients whose placement is
+// unchanged keep their objects across RealizeTransients() calls, and memory
+// requirements are cached per resource desc.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstddef>
+#include <cstdint>
+#include <vulkan/vulkan.h>
+
+#include "navary/navary_status.h"
+#include "navary/core/handles.h"
+#include "navary/render/v1/render_graph.h"
+#include "navary/render/v1/vulkan/descriptor_resources_vk.h"
+
+namespace navary::render::v1::vulkan {
+
+struct RenderGraphVkDesc {
+  VkDevice device;
+  VulkanDescriptorResourceTable* resource_table;  // optional
+  VkSampler transient_sampler;  // used when registering sampled transients
+
+  // Memory types transients may live in (usually DEVICE_LOCAL types).
+  std::uint32_t allowed_memory_type_bits;
+
+  std::uint32_t max_resources;  // RenderGraphLimits::max_resources
+  std::uint32_t max_barriers;   // >= RenderGraph::max_batch_barriers()
+  std::uint32_t max_external;   // imported image/buffer slots
+};
+
+class RenderGraphBackendVk : public RenderGraphBackend {
+ public:
+  RenderGraphBackendVk();
+  ~RenderGraphBackendVk() override;
+
+  NavaryRC Init(const RenderGraphVkDesc& desc);
+
+  // Destroys transient objects and heaps. The GPU must be idle.
+  void Shutdown();
+
+  // Imported resources referenced by RenderGraph::Import*(external_index).
+  NavaryRC SetExternalImage(std::uint32_t external_index, VkImage image,
+                            VkImageAspectFlags aspect);
+  NavaryRC SetExternalBuffer(std::uint32_t external_index, VkBuffer buffer);
+
+  // Command buffer that receives barriers during RenderGraph::Execute().
+  void SetCommandBuffer(VkCommandBuffer cmd) {
+    cmd_ = cmd;
+  }
+
+  // ---- RenderGraphBackend ----
+
+  NavaryResult<RgMemoryRequirements> GetMemoryRequirements(
+      const RgResourceDesc& desc) override;
+
+  // Keeps transients whose desc, heap and offset are unchanged (and whose
+  // heap is not reallocated) and recreates the rest. The caller must have
+  // waited on the fence of the frame that last executed this graph.
+  NavaryRC RealizeTransients(const RgTransientPlacement* placements,
+                             std::uint32_t placement_count,
+                             const RgHeapInfo* heaps,
+                             std::uint32_t heap_count) override;
+
+  NavaryRC RecordBarriers(const RgBarrier* barriers,
+                          std::uint32_t count) override;
+
+  // ---- Lookups for pass callbacks ----
+
+  VkImage GetImage(RgResourceHandle resource) const;
+  VkImageView GetImageView(RgResourceHandle resource) const;
+  VkBuffer GetBuffer(RgResourceHandle resource) const;
+
+  // Texture slot of a sampled transient, for material descriptors.
+  core::TextureHandle GetTexture(RgResourceHandle resource) const;
+
+ private:
+  struct Transient {
+    VkImage image;
+    VkImageView view;
+    VkBuffer buffer;
+    VkImageAspectFlags aspect;  // every aspect of the format, for barriers
+    core::TextureHandle texture;
+    std::uint32_t texture_slot;  // index into texture_slots_
+    bool has_texture;
+
+    // Placement the objects were created for.
+    bool live;
+    bool keep;  // scratch for RealizeTransients()
+    RgResourceDesc desc;
+    std::uint32_t heap;
+    std::size_t offset;
+  };
+
+  struct CachedRequirements {
+    RgResourceDesc desc;
+    VkMemoryRequirements req;
+  };
+
+  struct External {
+    VkImage image;
+    VkBuffer buffer;
+    VkImageAspectFlags aspect;
+  };
+
+  struct Heap {
+    VkDeviceMemory memory;
+    VkDeviceSize size;
+    std::uint32_t memory_type;
+  };
+
+  void DestroyTransient(Transient* t);
+  void DestroyTransients();
+  NavaryRC EnsureHeap(std::uint32_t heap, const RgHeapInfo& info);
+  NavaryRC CreateTransient(const RgTransientPlacement& placement);
+
+  RenderGraphVkDesc desc_;
+  VkCommandBuffer cmd_;
+
+  Transient* transients_;  // indexed by RgResourceHandle.index
+  External* externals_;
+  Heap heaps_[RenderGraph::kMaxHeaps];
+
+  core::TextureHandle* texture_slots_;  // registered table slots, reused
+  std::uint8_t* texture_slot_used_;
+  std::uint32_t texture_slot_count_;
+
+  CachedRequirements* requirements_;  // max_resources entries
+  std::uint32_t requirements_count_;
+  std::uint32_t requirements_next_;  // replaced next once full
+
+  VkImageMemoryBarrier* image_barriers_;
+  VkBufferMemoryBarrier* buffer_barriers_;
+};
+
+}  // namespace navary::render::v1::vulkan
@@ -0,0 +1,298 @@
+// navary/render/v1/vulkan/upload_backend_vk.cc
+// Implementation of UploadBackendVk.
+// This file is part of the Navary rendering engine.
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include "navary/render/v1/vulkan/upload_backend_vk.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace navary::render::v1::vulkan {
+
+UploadBackendVk::UploadBackendVk()
+    : desc_{},
+      cmd_(VK_NULL_HANDLE),
+      buffers_(nullptr),
+      images_(nullptr),
+      buffer_copies_(nullptr),
+      image_copies_(nullptr),
+      barriers_(nullptr),
+      buffer_copies_pending_(false) {}
+
+UploadBackendVk::~UploadBackendVk() {
+  for (std::uint32_t i = 0; images_ != nullptr && i < desc_.max_textures;
+       ++i) {
+    std::free(images_[i].readable);
+  }
+  std::free(buffers_);
+  std::free(images_);
+  std::free(buffer_copies_);
+  std::free(image_copies_);
+  std::free(barriers_);
+}
+
+NavaryRC UploadBackendVk::Init(const UploadBackendVkDesc& desc) {
+  if (desc.staging_buffer == VK_NULL_HANDLE || desc.max_regions == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "UploadBackendVk: invalid desc");
+  }
+
+  desc_ = desc;
+  if (desc_.texture_dst_stages == 0) {
+    desc_.texture_dst_stages = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+  }
+  if (desc_.buffer_dst_stages == 0) {
+    desc_.buffer_dst_stages = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+                              VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                              VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
+                              VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+  }
+
+  buffers_ = static_cast<VkBuffer*>(
+      std::calloc(desc.max_buffers == 0 ? 1 : desc.max_buffers,
+                  sizeof(VkBuffer)));
+  images_ = static_cast<Image*>(
+      std::calloc(desc.max_textures == 0 ? 1 : desc.max_textures,
+                  sizeof(Image)));
+  buffer_copies_ = static_cast<VkBufferCopy*>(
+      std::malloc(sizeof(VkBufferCopy) * desc.max_regions));
+  image_copies_ = static_cast<VkBufferImageCopy*>(
+      std::malloc(sizeof(VkBufferImageCopy) * desc.max_regions));
+  barriers_ = static_cast<VkImageMemoryBarrier*>(
+      std::malloc(sizeof(VkImageMemoryBarrier) * desc.max_regions));
+
+  if (buffers_ == nullptr || images_ == nullptr ||
+      buffer_copies_ == nullptr || image_copies_ == nullptr ||
+      barriers_ == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "UploadBackendVk: storage alloc failed");
+  }
+
+  return NavaryRC::OK();
+}
+
+NavaryRC UploadBackendVk::SetBuffer(core::BufferHandle handle,
+                                    VkBuffer buffer) {
+  if (handle.index >= desc_.max_buffers) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "UploadBackendVk: buffer handle out of range");
+  }
+  buffers_[handle.index] = buffer;
+  return NavaryRC::OK();
+}
+
+NavaryRC UploadBackendVk::SetImage(core::TextureHandle handle, VkImage image,
+                                   VkImageAspectFlags aspect,
+                                   std::uint32_t mip_levels,
+                                   std::uint32_t array_layers,
+                                   VkImageLayout layout) {
+  if (handle.index >= desc_.max_textures) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "UploadBackendVk: texture handle out of range");
+  }
+  if (mip_levels == 0 || array_layers == 0 ||
+      (layout != VK_IMAGE_LAYOUT_UNDEFINED &&
+       layout != VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "UploadBackendVk: invalid image description");
+  }
+
+  const std::size_t subresources =
+      static_cast<std::size_t>(mip_levels) * array_layers;
+  const std::size_t words = (subresources + 63) / 64;
+  auto* readable =
+      static_cast<std::uint64_t*>(std::malloc(sizeof(std::uint64_t) * words));
+  if (readable == nullptr) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "UploadBackendVk: image state alloc failed");
+  }
+  const std::uint64_t fill =
+      layout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL ? ~0ull : 0ull;
+  std::fill(readable, readable + words, fill);
+
+  Image& slot = images_[handle.index];
+  std::free(slot.readable);
+  slot = Image{image, aspect, mip_levels, array_layers, readable};
+  return NavaryRC::OK();
+}
+
+NavaryRC UploadBackendVk::CopyBufferRegions(core::BufferHandle /*staging*/,
+                                            core::BufferHandle dst,
+                                            const BufferCopyRegion* regions,
+                                            std::uint32_t count) {
+  if (count == 0) {
+    return NavaryRC::OK();
+  }
+  if (cmd_ == VK_NULL_HANDLE) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "UploadBackendVk: no command buffer set");
+  }
+  if (dst.index >= desc_.max_buffers ||
+      buffers_[dst.index] == VK_NULL_HANDLE) {
+    return NavaryRC(NavaryStatus::kNotFound,
+                    "UploadBackendVk: unknown destination buffer");
+  }
+
+  // Earlier GPU work may still read the buffer (write-after-read), and an
+  // earlier Flush() may have written the same bytes (write-after-write).
+  // Reads need only the execution dependency; earlier copies also need
+  // their writes made available. The regions below are disjoint, so the
+  // split vkCmdCopyBuffer calls need no barrier between them.
+  VkBufferMemoryBarrier barrier{};
+  barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+  barrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+  barrier.dstAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+  barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barrier.buffer              = buffers_[dst.index];
+  barrier.offset              = 0;
+  barrier.size                = VK_WHOLE_SIZE;
+
+  vkCmdPipelineBarrier(cmd_,
+                       desc_.buffer_dst_stages | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1,
+                       &barrier, 0, nullptr);
+
+  for (std::uint32_t base = 0; base < count; base += desc_.max_regions) {
+    const std::uint32_t n = std::min(count - base, desc_.max_regions);
+    for (std::uint32_t i = 0; i < n; ++i) {
+      buffer_copies_[i].srcOffset = regions[base + i].src_offset;
+      buffer_copies_[i].dstOffset = regions[base + i].dst_offset;
+      buffer_copies_[i].size      = regions[base + i].size;
+    }
+    vkCmdCopyBuffer(cmd_, desc_.staging_buffer, buffers_[dst.index], n,
+                    buffer_copies_);
+  }
+
+  buffer_copies_pending_ = true;
+  return NavaryRC::OK();
+}
+
+NavaryRC UploadBackendVk::CopyTextureRegions(core::BufferHandle /*staging*/,
+                                             core::TextureHandle dst,
+                                             const TextureCopyRegion* regions,
+                                             std::uint32_t count) {
+  if (count == 0) {
+    return NavaryRC::OK();
+  }
+  if (cmd_ == VK_NULL_HANDLE) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "UploadBackendVk: no command buffer set");
+  }
+  if (dst.index >= desc_.max_textures ||
+      images_[dst.index].image == VK_NULL_HANDLE) {
+    return NavaryRC(NavaryStatus::kNotFound,
+                    "UploadBackendVk: unknown destination image");
+  }
+
+  Image& image = images_[dst.index];
+  for (std::uint32_t i = 0; i < count; ++i) {
+    if (regions[i].mip_level >= image.mip_levels ||
+        regions[i].array_layer >= image.array_layers) {
+      return NavaryRC(NavaryStatus::kInvalidArgument,
+                      "UploadBackendVk: region outside the image");
+    }
+  }
+
+  for (std::uint32_t base = 0; base < count; base += desc_.max_regions) {
+    RecordTextureChunk(&image, regions + base,
+                       std::min(count - base, desc_.max_regions));
+  }
+  return NavaryRC::OK();
+}
+
+void UploadBackendVk::RecordTextureChunk(Image* image,
+                                         const TextureCopyRegion* regions,
+                                         std::uint32_t count) {
+  VkPipelineStageFlags src_stages = 0;
+
+  for (std::uint32_t i = 0; i < count; ++i) {
+    const std::size_t bit =
+        static_cast<std::size_t>(regions[i].array_layer) * image->mip_levels +
+        regions[i].mip_level;
+    const bool readable = (image->readable[bit / 64] >> (bit % 64)) & 1u;
+
+    // Whole levels are replaced, so never-uploaded ones may be discarded.
+    VkImageMemoryBarrier& b = barriers_[i];
+    b                       = VkImageMemoryBarrier{};
+    b.sType                 = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    b.dstAccessMask         = VK_ACCESS_TRANSFER_WRITE_BIT;
+    if (readable) {
+      b.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+      b.oldLayout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+      src_stages |= desc_.texture_dst_stages;
+    } else {
+      b.srcAccessMask = 0;
+      b.oldLayout     = VK_IMAGE_LAYOUT_UNDEFINED;
+      src_stages |= VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    }
+    b.newLayout             = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    b.srcQueueFamilyIndex   = VK_QUEUE_FAMILY_IGNORED;
+    b.dstQueueFamilyIndex   = VK_QUEUE_FAMILY_IGNORED;
+    b.image                 = image->image;
+    b.subresourceRange.aspectMask     = image->aspect;
+    b.subresourceRange.baseMipLevel   = regions[i].mip_level;
+    b.subresourceRange.levelCount     = 1;
+    b.subresourceRange.baseArrayLayer = regions[i].array_layer;
+    b.subresourceRange.layerCount     = 1;
+
+    VkBufferImageCopy& c              = image_copies_[i];
+    c                                 = VkBufferImageCopy{};
+    c.bufferOffset                    = regions[i].src_offset;
+    c.bufferRowLength                 = 0;  // tightly packed
+    c.bufferImageHeight               = 0;
+    c.imageSubresource.aspectMask     = image->aspect;
+    c.imageSubresource.mipLevel       = regions[i].mip_level;
+    c.imageSubresource.baseArrayLayer = regions[i].array_layer;
+    c.imageSubresource.layerCount     = 1;
+    c.imageExtent = VkExtent3D{regions[i].width, regions[i].height, 1};
+  }
+
+  vkCmdPipelineBarrier(cmd_, src_stages, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                       nullptr, 0, nullptr, count, barriers_);
+
+  vkCmdCopyBufferToImage(cmd_, desc_.staging_buffer, image->image,
+                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, count,
+                         image_copies_);
+
+  for (std::uint32_t i = 0; i < count; ++i) {
+    VkImageMemoryBarrier& b = barriers_[i];
+    b.srcAccessMask         = VK_ACCESS_TRANSFER_WRITE_BIT;
+    b.dstAccessMask         = VK_ACCESS_SHADER_READ_BIT;
+    b.oldLayout             = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    b.newLayout             = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+    const std::size_t bit =
+        static_cast<std::size_t>(regions[i].array_layer) * image->mip_levels +
+        regions[i].mip_level;
+    image->readable[bit / 64] |= 1ull << (bit % 64);
+  }
+
+  vkCmdPipelineBarrier(cmd_, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       desc_.texture_dst_stages, 0, 0, nullptr, 0, nullptr,
+                       count, barriers_);
+}
+
+void UploadBackendVk::RecordBufferVisibilityBarrier() {
+  if (cmd_ == VK_NULL_HANDLE || !buffer_copies_pending_) {
+    return;
+  }
+
+  VkMemoryBarrier barrier{};
+  barrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+  barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+  barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
+                          VK_ACCESS_INDEX_READ_BIT |
+                          VK_ACCESS_UNIFORM_READ_BIT |
+                          VK_ACCESS_SHADER_READ_BIT |
+                          VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+
+  vkCmdPipelineBarrier(cmd_, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                       desc_.buffer_dst_stages, 0, 1, &barrier, 0, nullptr, 0,
+                       nullptr);
+  buffer_copies_pending_ = false;
+}
+
+}  // namespace navary::render::v1::vulkan
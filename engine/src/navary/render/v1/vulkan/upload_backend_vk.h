@@ -0,0 +1,108 @@
+#pragma once
+
+// navary/render/v1/vulkan/upload_backend_vk.h
+// Vulkan implementation of UploadBackend.
+// Each destination receives one vkCmdCopyBuffer / vkCmdCopyBufferToImage with
+// all of its regions (batches above max_regions are split). Buffer copies
+// first wait for buffer_dst_stages reads and earlier transfer writes of the
+// destination, so rewriting a buffer in use does not race the GPU. Texture
+// subresources are transitioned to TRANSFER_DST before the copy and to
+// SHADER_READ_ONLY after it, each side as a single batched barrier. The
+// backend tracks which subresources it already made SHADER_READ_ONLY: those
+// are transitioned from that layout and wait for texture_dst_stages reads,
+// so re-uploading a mip that is being sampled keeps its contents until the
+// copy and does not race the shader. Never-uploaded ones start from the
+// layout given to SetImage().
+// Author:
+// - Linggawasistha Djohari  [2024-Present]
+
+#include <cstdint>
+#include <vulkan/vulkan.h>
+
+#include "navary/core/handles.h"
+#include "navary/navary_status.h"
+#include "navary/render/v1/upload_manager.h"
+
+namespace navary::render::v1::vulkan {
+
+struct UploadBackendVkDesc {
+  VkBuffer staging_buffer;  // UploadManagerDesc::staging_buffer
+
+  std::uint32_t max_buffers;   // BufferHandle index range
+  std::uint32_t max_textures;  // TextureHandle index range
+  std::uint32_t max_regions;   // UploadManagerDesc::max_requests
+
+  // Stages that consume uploaded textures / buffers.
+  VkPipelineStageFlags texture_dst_stages;
+  VkPipelineStageFlags buffer_dst_stages;
+};
+
+class UploadBackendVk : public UploadBackend {
+ public:
+  UploadBackendVk();
+  ~UploadBackendVk() override;
+
+  UploadBackendVk(const UploadBackendVk&)            = delete;
+  UploadBackendVk& operator=(const UploadBackendVk&) = delete;
+
+  NavaryRC Init(const UploadBackendVkDesc& desc);
+
+  NavaryRC SetBuffer(core::BufferHandle handle, VkBuffer buffer);
+
+  // |layout| is the current layout of every subresource: UNDEFINED for a
+  // new image, SHADER_READ_ONLY_OPTIMAL for one already sampled.
+  NavaryRC SetImage(core::TextureHandle handle, VkImage image,
+                    VkImageAspectFlags aspect, std::uint32_t mip_levels,
+                    std::uint32_t array_layers,
+                    VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED);
+
+  // Command buffer that receives copies during UploadManager::Flush().
+  void SetCommandBuffer(VkCommandBuffer cmd) {
+    cmd_ = cmd;
+  }
+
+  // Makes buffer copies recorded since the last call visible to
+  // |buffer_dst_stages|. Call once after Flush().
+  void RecordBufferVisibilityBarrier();
+
+  // ---- UploadBackend ----
+
+  // Fail without recording when no command buffer is set, the destination
+  // was never registered or a region lies outside the image.
+  NavaryRC CopyBufferRegions(core::BufferHandle staging,
+                             core::BufferHandle dst,
+                             const BufferCopyRegion* regions,
+                             std::uint32_t count) override;
+
+  NavaryRC CopyTextureRegions(core::BufferHandle staging,
+                              core::TextureHandle dst,
+                              const TextureCopyRegion* regions,
+                              std::uint32_t count) override;
+
+ private:
+  struct Image {
+    VkImage image;
+    VkImageAspectFlags aspect;
+    std::uint32_t mip_levels;
+    std::uint32_t array_layers;
+    // Bit per (layer * mip_levels + mip): subresource is SHADER_READ_ONLY.
+    std::uint64_t* readable;
+  };
+
+  void RecordTextureChunk(Image* image, const TextureCopyRegion* regions,
+                          std::uint32_t count);
+
+  UploadBackendVkDesc desc_;
+  VkCommandBuffer cmd_;
+
+  VkBuffer* buffers_;
+  Image* images_;
+
+  VkBufferCopy* buffer_copies_;
+  VkBufferImageCopy* image_copies_;
+  VkImageMemoryBarrier* barriers_;
+
+  bool buffer_copies_pending_;
+};
+
+}  // namespace navary::render::v1::vulkan
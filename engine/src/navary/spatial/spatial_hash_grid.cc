@@ -0,0 +1,509 @@
+// Navary Engine - Spatial Subsystem
+// File: navary/spatial/spatial_hash_grid.cc
+// Purpose: SpatialHashGrid rebuild (parallel counting sort) and queries,
+//          instantiated for the float and fixed-point traits.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/spatial/spatial_hash_grid.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace navary::spatial {
+
+namespace {
+
+constexpr std::uint32_t kBatchGrain = 128;
+
+std::uint32_t NextPow2(std::uint32_t v) {
+  std::uint32_t p = 1;
+  while (p < v) {
+    p <<= 1;
+  }
+  return p;
+}
+
+}  // namespace
+
+template <typename Traits>
+struct SpatialHashGrid<Traits>::RebuildContext {
+  SpatialHashGrid* grid;
+  const Vec* positions;
+  std::uint32_t count;
+  std::uint32_t chunk_size;
+};
+
+template <typename Traits>
+struct SpatialHashGrid<Traits>::BatchContext {
+  const SpatialHashGrid* grid;
+  BatchMode mode;
+  const Vec* centers;
+  Coord radius;
+  std::uint32_t stride;
+  std::uint32_t* out_ids;
+  std::uint32_t* out_counts;
+};
+
+template <typename Traits>
+SpatialHashGrid<Traits>::SpatialHashGrid()
+    : cell_size_(),
+      inv_cell_(0.0f),
+      planar_(false),
+      max_points_(0),
+      bucket_mask_(0),
+      x_mask_(0),
+      z_mask_(0),
+      y_mask_(0),
+      z_shift_(0),
+      y_shift_(0),
+      count_(0),
+      cell_start_(nullptr),
+      xs_(nullptr),
+      ys_(nullptr),
+      zs_(nullptr),
+      keys_(nullptr),
+      ids_(nullptr),
+      point_keys_(nullptr),
+      point_buckets_(nullptr),
+      histograms_(nullptr) {}
+
+template <typename Traits>
+SpatialHashGrid<Traits>::~SpatialHashGrid() {
+  Shutdown();
+}
+
+template <typename Traits>
+NavaryRC SpatialHashGrid<Traits>::Init(const Desc& desc) {
+  if (cell_start_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "SpatialHashGrid: already initialized");
+  }
+  const Coord cell = Traits::ToCoord(desc.cell_size);
+  if (desc.max_points == 0 || !(cell > Coord(0)) ||
+      (desc.bucket_count & (desc.bucket_count - 1)) != 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "SpatialHashGrid: invalid descriptor");
+  }
+
+  const std::uint32_t buckets = desc.bucket_count != 0
+                                    ? desc.bucket_count
+                                    : NextPow2(desc.max_points);
+  const std::size_t n = desc.max_points;
+  cell_start_         = static_cast<std::uint32_t*>(
+      std::malloc(sizeof(std::uint32_t) * (buckets + 1)));
+  xs_   = static_cast<Coord*>(std::malloc(sizeof(Coord) * n));
+  ys_   = static_cast<Coord*>(std::malloc(sizeof(Coord) * n));
+  zs_   = static_cast<Coord*>(std::malloc(sizeof(Coord) * n));
+  keys_ = static_cast<std::uint64_t*>(std::malloc(sizeof(std::uint64_t) * n));
+  ids_  = static_cast<std::uint32_t*>(std::malloc(sizeof(std::uint32_t) * n));
+  point_keys_ =
+      static_cast<std::uint64_t*>(std::malloc(sizeof(std::uint64_t) * n));
+  point_buckets_ =
+      static_cast<std::uint32_t*>(std::malloc(sizeof(std::uint32_t) * n));
+  histograms_ = static_cast<std::uint32_t*>(
+      std::malloc(sizeof(std::uint32_t) * kMaxChunks * buckets));
+  if (cell_start_ == nullptr || xs_ == nullptr || ys_ == nullptr ||
+      zs_ == nullptr || keys_ == nullptr || ids_ == nullptr ||
+      point_keys_ == nullptr || point_buckets_ == nullptr ||
+      histograms_ == nullptr) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "SpatialHashGrid: alloc failed");
+  }
+  std::memset(cell_start_, 0, sizeof(std::uint32_t) * (buckets + 1));
+
+  // Split the table bits over the axes, x widest: planar X x Z, else
+  // X x Z x Y.
+  std::uint32_t bits = 0;
+  while ((1u << bits) < buckets) {
+    ++bits;
+  }
+  const std::uint32_t axes   = desc.planar ? 2 : 3;
+  const std::uint32_t y_bits = desc.planar ? 0 : bits / axes;
+  const std::uint32_t z_bits = (bits - y_bits) / 2;
+  const std::uint32_t x_bits = bits - y_bits - z_bits;
+
+  cell_size_   = cell;
+  inv_cell_    = 1.0f / static_cast<float>(cell);
+  planar_      = desc.planar;
+  max_points_  = desc.max_points;
+  bucket_mask_ = buckets - 1;
+  x_mask_      = (1u << x_bits) - 1;
+  z_mask_      = (1u << z_bits) - 1;
+  y_mask_      = (1u << y_bits) - 1;
+  z_shift_     = x_bits;
+  y_shift_     = x_bits + z_bits;
+  count_       = 0;
+  return NavaryRC::OK();
+}
+
+template <typename Traits>
+void SpatialHashGrid<Traits>::Shutdown() {
+  std::free(cell_start_);
+  std::free(xs_);
+  std::free(ys_);
+  std::free(zs_);
+  std::free(keys_);
+  std::free(ids_);
+  std::free(point_keys_);
+  std::free(point_buckets_);
+  std::free(histograms_);
+  cell_start_    = nullptr;
+  xs_            = nullptr;
+  ys_            = nullptr;
+  zs_            = nullptr;
+  keys_          = nullptr;
+  ids_           = nullptr;
+  point_keys_    = nullptr;
+  point_buckets_ = nullptr;
+  histograms_    = nullptr;
+  max_points_    = 0;
+  bucket_mask_   = 0;
+  count_         = 0;
+}
+
+template <typename Traits>
+std::uint64_t SpatialHashGrid<Traits>::CellKey(std::int32_t ix,
+                                               std::int32_t iy,
+                                               std::int32_t iz) const {
+  // Biased 21-bit fields, x lowest, so keys of one row order by x.
+  constexpr std::uint64_t kMask = (1u << 21) - 1;
+  constexpr std::int64_t kBias  = 1 << 20;
+  return ((static_cast<std::uint64_t>(iy + kBias) & kMask) << 42) |
+         ((static_cast<std::uint64_t>(iz + kBias) & kMask) << 21) |
+         (static_cast<std::uint64_t>(ix + kBias) & kMask);
+}
+
+template <typename Traits>
+std::uint32_t SpatialHashGrid<Traits>::Bucket(std::int32_t ix,
+                                              std::int32_t iy,
+                                              std::int32_t iz) const {
+  return ((static_cast<std::uint32_t>(iy) & y_mask_) << y_shift_) |
+         ((static_cast<std::uint32_t>(iz) & z_mask_) << z_shift_) |
+         (static_cast<std::uint32_t>(ix) & x_mask_);
+}
+
+// ---------------------------------------------------------------------------
+// Rebuild
+// ---------------------------------------------------------------------------
+
+template <typename Traits>
+void SpatialHashGrid<Traits>::CountRange(std::uint32_t begin,
+                                         std::uint32_t end, std::uint32_t,
+                                         void* user_data) {
+  auto* ctx                   = static_cast<RebuildContext*>(user_data);
+  SpatialHashGrid* grid       = ctx->grid;
+  const std::uint32_t buckets = grid->bucket_mask_ + 1;
+  for (std::uint32_t chunk = begin; chunk < end; ++chunk) {
+    std::uint32_t* hist = grid->histograms_ + chunk * buckets;
+    std::memset(hist, 0, sizeof(std::uint32_t) * buckets);
+
+    const std::uint32_t first = chunk * ctx->chunk_size;
+    const std::uint32_t last  = std::min(ctx->count, first + ctx->chunk_size);
+    for (std::uint32_t i = first; i < last; ++i) {
+      const Vec& p          = ctx->positions[i];
+      const std::int32_t ix = grid->Cell(Traits::X(p));
+      const std::int32_t iy = grid->planar_ ? 0 : grid->Cell(Traits::Y(p));
+      const std::int32_t iz = grid->Cell(Traits::Z(p));
+      const std::uint32_t b = grid->Bucket(ix, iy, iz);
+      grid->point_keys_[i]    = grid->CellKey(ix, iy, iz);
+      grid->point_buckets_[i] = b;
+      ++hist[b];
+    }
+  }
+}
+
+template <typename Traits>
+void SpatialHashGrid<Traits>::ScatterRange(std::uint32_t begin,
+                                           std::uint32_t end, std::uint32_t,
+                                           void* user_data) {
+  auto* ctx                   = static_cast<RebuildContext*>(user_data);
+  SpatialHashGrid* grid       = ctx->grid;
+  const std::uint32_t buckets = grid->bucket_mask_ + 1;
+  for (std::uint32_t chunk = begin; chunk < end; ++chunk) {
+    std::uint32_t* cursor     = grid->histograms_ + chunk * buckets;
+    const std::uint32_t first = chunk * ctx->chunk_size;
+    const std::uint32_t last  = std::min(ctx->count, first + ctx->chunk_size);
+    for (std::uint32_t i = first; i < last; ++i) {
+      const std::uint32_t dst = cursor[grid->point_buckets_[i]]++;
+      const Vec& p            = ctx->positions[i];
+      grid->xs_[dst]          = Traits::X(p);
+      grid->ys_[dst]          = Traits::Y(p);
+      grid->zs_[dst]          = Traits::Z(p);
+      grid->keys_[dst]        = grid->point_keys_[i];
+      grid->ids_[dst]         = i;
+    }
+  }
+}
+
+template <typename Traits>
+NavaryRC SpatialHashGrid<Traits>::Rebuild(const Vec* positions,
+                                          std::uint32_t count,
+                                          core::scheduler::JobSystem* jobs) {
+  if (cell_start_ == nullptr || count > max_points_ ||
+      (count > 0 && positions == nullptr)) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "SpatialHashGrid: invalid rebuild input");
+  }
+
+  // One chunk per thread at most: every chunk costs a bucket_count
+  // histogram clear and prefix pass. The sort is stable, so the layout is
+  // the same for any chunk count.
+  std::uint32_t chunks = (count + kMinChunkSize - 1) / kMinChunkSize;
+  chunks = std::min(chunks, jobs != nullptr ? jobs->thread_count() : 1u);
+  chunks = std::clamp(chunks, 1u, kMaxChunks);
+  RebuildContext ctx{this, positions, count, (count + chunks - 1) / chunks};
+  if (ctx.chunk_size == 0) {
+    ctx.chunk_size = 1;
+  }
+
+  if (jobs != nullptr && chunks > 1) {
+    jobs->ParallelFor(chunks, 1, &CountRange, &ctx);
+  } else {
+    CountRange(0, chunks, 0, &ctx);
+  }
+
+  // Exclusive prefix over (bucket, chunk): chunk k's run of bucket b
+  // follows chunk k - 1's, which keeps input order within a cell.
+  const std::uint32_t buckets = bucket_mask_ + 1;
+  std::uint32_t running       = 0;
+  for (std::uint32_t b = 0; b < buckets; ++b) {
+    cell_start_[b] = running;
+    for (std::uint32_t k = 0; k < chunks; ++k) {
+      std::uint32_t& h = histograms_[k * buckets + b];
+      const std::uint32_t n = h;
+      h                     = running;
+      running += n;
+    }
+  }
+  cell_start_[buckets] = running;
+
+  if (jobs != nullptr && chunks > 1) {
+    jobs->ParallelFor(chunks, 1, &ScatterRange, &ctx);
+  } else {
+    ScatterRange(0, chunks, 0, &ctx);
+  }
+  count_ = count;
+  return NavaryRC::OK();
+}
+
+// ---------------------------------------------------------------------------
+// Queries
+// ---------------------------------------------------------------------------
+
+template <typename Traits>
+template <typename Fn>
+void SpatialHashGrid<Traits>::ForEachInRadius(Coord cx, Coord cy, Coord cz,
+                                              Coord radius, Fn&& fn) const {
+  const DistSq r2       = Traits::Square(radius);
+  const std::int32_t x0 = Cell(cx - radius);
+  const std::int32_t x1 = Cell(cx + radius);
+  const std::int32_t z0 = Cell(cz - radius);
+  const std::int32_t z1 = Cell(cz + radius);
+  const std::int32_t y0 = planar_ ? 0 : Cell(cy - radius);
+  const std::int32_t y1 = planar_ ? 0 : Cell(cy + radius);
+
+  // Cells wrap row-major into the table, so the x run of one (iy, iz) row
+  // is one contiguous bucket range (two when it wraps). Entries of other
+  // rows or of aliased cells fall outside [key_lo, key_hi].
+  const std::uint32_t width = x_mask_ + 1;
+  const bool full_row       = static_cast<std::uint32_t>(x1 - x0) >= x_mask_;
+  for (std::int32_t iy = y0; iy <= y1; ++iy) {
+    for (std::int32_t iz = z0; iz <= z1; ++iz) {
+      const std::uint64_t key_lo = CellKey(x0, iy, iz);
+      const std::uint64_t key_hi = CellKey(x1, iy, iz);
+      const std::uint32_t row    = Bucket(0, iy, iz);
+
+      auto scan = [&](std::uint32_t bx0, std::uint32_t bx1) {
+        const std::uint32_t end = cell_start_[row + bx1 + 1];
+        for (std::uint32_t i = cell_start_[row + bx0]; i < end; ++i) {
+          if (keys_[i] < key_lo || keys_[i] > key_hi) {
+            continue;
+          }
+          DistSq d =
+              Traits::Square(xs_[i] - cx) + Traits::Square(zs_[i] - cz);
+          if (!planar_) {
+            d += Traits::Square(ys_[i] - cy);
+          }
+          if (d <= r2) {
+            fn(i, d);
+          }
+        }
+      };
+
+      const std::uint32_t bx0 = static_cast<std::uint32_t>(x0) & x_mask_;
+      const std::uint32_t bx1 = static_cast<std::uint32_t>(x1) & x_mask_;
+      if (full_row) {
+        scan(0, width - 1);
+      } else if (bx0 <= bx1) {
+        scan(bx0, bx1);
+      } else {
+        scan(bx0, width - 1);
+        scan(0, bx1);
+      }
+    }
+  }
+}
+
+template <typename Traits>
+std::uint32_t SpatialHashGrid<Traits>::QueryRadius(
+    const Vec& center, Scalar radius, std::uint32_t* out_ids,
+    std::uint32_t max_out, std::uint32_t exclude) const {
+  if (count_ == 0 || max_out == 0) {
+    return 0;
+  }
+  std::uint32_t n = 0;
+  ForEachInRadius(Traits::X(center), Traits::Y(center), Traits::Z(center),
+                  Traits::ToCoord(radius), [&](std::uint32_t i, DistSq) {
+                    if (n < max_out && ids_[i] != exclude) {
+                      out_ids[n++] = ids_[i];
+                    }
+                  });
+  return n;
+}
+
+template <typename Traits>
+std::uint32_t SpatialHashGrid<Traits>::KNearestAt(
+    Coord cx, Coord cy, Coord cz, Coord radius, std::uint32_t k,
+    std::uint32_t* out_ids, DistSq* out_dist_sq, std::uint32_t exclude) const {
+  k = std::min(k, kMaxK);
+  if (count_ == 0 || k == 0) {
+    return 0;
+  }
+  // Sorted insertion into k slots; k is small, so this beats a heap.
+  DistSq dist[kMaxK];
+  std::uint32_t ids[kMaxK];
+  std::uint32_t n = 0;
+  ForEachInRadius(cx, cy, cz, radius, [&](std::uint32_t i, DistSq d) {
+    const std::uint32_t id = ids_[i];
+    if (id == exclude) {
+      return;
+    }
+    if (n == k &&
+        (d > dist[k - 1] || (d == dist[k - 1] && id > ids[k - 1]))) {
+      return;
+    }
+    std::uint32_t pos = n < k ? n++ : k - 1;
+    while (pos > 0 &&
+           (dist[pos - 1] > d || (dist[pos - 1] == d && ids[pos - 1] > id))) {
+      dist[pos] = dist[pos - 1];
+      ids[pos]  = ids[pos - 1];
+      --pos;
+    }
+    dist[pos] = d;
+    ids[pos]  = id;
+  });
+
+  std::memcpy(out_ids, ids, sizeof(std::uint32_t) * n);
+  if (out_dist_sq != nullptr) {
+    std::memcpy(out_dist_sq, dist, sizeof(DistSq) * n);
+  }
+  return n;
+}
+
+template <typename Traits>
+std::uint32_t SpatialHashGrid<Traits>::QueryKNearest(
+    const Vec& center, Scalar radius, std::uint32_t k, std::uint32_t* out_ids,
+    DistSq* out_dist_sq, std::uint32_t exclude) const {
+  return KNearestAt(Traits::X(center), Traits::Y(center), Traits::Z(center),
+                    Traits::ToCoord(radius), k, out_ids, out_dist_sq,
+                    exclude);
+}
+
+template <typename Traits>
+void SpatialHashGrid<Traits>::BatchRange(std::uint32_t begin,
+                                         std::uint32_t end, std::uint32_t,
+                                         void* user_data) {
+  const auto* ctx             = static_cast<const BatchContext*>(user_data);
+  const SpatialHashGrid* grid = ctx->grid;
+  for (std::uint32_t q = begin; q < end; ++q) {
+    switch (ctx->mode) {
+      case BatchMode::kRadius: {
+        const Vec& c = ctx->centers[q];
+        std::uint32_t n = 0;
+        grid->ForEachInRadius(
+            Traits::X(c), Traits::Y(c), Traits::Z(c), ctx->radius,
+            [&](std::uint32_t i, DistSq) {
+              if (n < ctx->stride) {
+                ctx->out_ids[q * ctx->stride + n++] = grid->ids_[i];
+              }
+            });
+        ctx->out_counts[q] = n;
+        break;
+      }
+      case BatchMode::kKNearest: {
+        const Vec& c       = ctx->centers[q];
+        ctx->out_counts[q] = grid->KNearestAt(
+            Traits::X(c), Traits::Y(c), Traits::Z(c), ctx->radius,
+            ctx->stride, ctx->out_ids + q * ctx->stride, nullptr,
+            kNoSpatialId);
+        break;
+      }
+      case BatchMode::kNeighbors: {
+        // q is a sorted index: consecutive queries come from one cell.
+        const std::uint32_t id = grid->ids_[q];
+        ctx->out_counts[id]    = grid->KNearestAt(
+            grid->xs_[q], grid->ys_[q], grid->zs_[q], ctx->radius,
+            ctx->stride, ctx->out_ids + id * ctx->stride, nullptr, id);
+        break;
+      }
+    }
+  }
+}
+
+template <typename Traits>
+void SpatialHashGrid<Traits>::RunBatch(BatchMode mode, const Vec* centers,
+                                       std::uint32_t count, Scalar radius,
+                                       std::uint32_t stride,
+                                       std::uint32_t* out_ids,
+                                       std::uint32_t* out_counts,
+                                       core::scheduler::JobSystem* jobs) const {
+  BatchContext ctx;
+  ctx.grid       = this;
+  ctx.mode       = mode;
+  ctx.centers    = centers;
+  ctx.radius     = Traits::ToCoord(radius);
+  ctx.stride     = stride;
+  ctx.out_ids    = out_ids;
+  ctx.out_counts = out_counts;
+  if (jobs != nullptr && count > kBatchGrain) {
+    jobs->ParallelFor(count, kBatchGrain, &BatchRange, &ctx);
+  } else {
+    BatchRange(0, count, 0, &ctx);
+  }
+}
+
+template <typename Traits>
+void SpatialHashGrid<Traits>::QueryRadiusBatch(
+    const Vec* centers, std::uint32_t count, Scalar radius,
+    std::uint32_t stride, std::uint32_t* out_ids, std::uint32_t* out_counts,
+    core::scheduler::JobSystem* jobs) const {
+  RunBatch(BatchMode::kRadius, centers, count, radius, stride, out_ids,
+           out_counts, jobs);
+}
+
+template <typename Traits>
+void SpatialHashGrid<Traits>::QueryKNearestBatch(
+    const Vec* centers, std::uint32_t count, Scalar radius, std::uint32_t k,
+    std::uint32_t* out_ids, std::uint32_t* out_counts,
+    core::scheduler::JobSystem* jobs) const {
+  RunBatch(BatchMode::kKNearest, centers, count, radius, k, out_ids,
+           out_counts, jobs);
+}
+
+template <typename Traits>
+void SpatialHashGrid<Traits>::UpdateNeighbors(
+    Scalar radius, std::uint32_t k, std::uint32_t* out_ids,
+    std::uint32_t* out_counts, core::scheduler::JobSystem* jobs) const {
+  RunBatch(BatchMode::kNeighbors, nullptr, count_, radius, k, out_ids,
+           out_counts, jobs);
+}
+
+template class SpatialHashGrid<FloatGridTraits>;
+template class SpatialHashGrid<FixedGridTraits>;
+
+}  // namespace navary::spatial
@@ -0,0 +1,256 @@
+#pragma once
+// Navary Engine - Spatial Subsystem
+// File: navary/spatial/spatial_hash_grid.h
+// Purpose: Uniform spatial hash grid for radius and k-nearest queries over
+//          moving points (crowds, steering, sensors).
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - Space is cut into cubic cells of cell_size. Cells hash into a
+//     bucket_count table by wrapping each coordinate (x fastest), so the
+//     grid is unbounded, its memory depends only on the point count, and
+//     a row of neighboring cells is one contiguous bucket range.
+//   - Rebuild() runs every tick: a counting sort by bucket, split into
+//     chunks whose histograms and scatters run on job workers. The sort is
+//     stable (input order inside a bucket), so the layout is deterministic.
+//   - Points are stored cell-sorted as SoA (x[], y[], z[], cell key[],
+//     id[]); a query walks the few buckets it overlaps and streams through
+//     contiguous arrays. Entries of aliased cells (a table width apart)
+//     are rejected by cell key.
+//   - Two variants share the code: FloatSpatialHashGrid (math::Vec3) and
+//     FixedSpatialHashGrid (math::FixedVec3, exact integer distances for
+//     lockstep simulation).
+//
+// Notes:
+//   - Choose cell_size near the typical query radius; a query scans
+//     (2 * ceil(radius / cell_size) + 1) rows of as many cells (planar:
+//     X and Z only). Cell coordinates must stay within +-2^20.
+//   - Queries are const and may run concurrently after Rebuild().
+//   - Member definitions live in spatial_hash_grid.cc, instantiated for the
+//     two traits below.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/core/scheduler/job_system.h"
+#include "navary/math/fixed.h"
+#include "navary/math/fixed_vec3.h"
+#include "navary/math/vec3.h"
+#include "navary/navary_status.h"
+
+namespace navary::spatial {
+
+inline constexpr std::uint32_t kNoSpatialId = 0xFFFFFFFFu;
+
+// Float coordinates; distances compared squared in float.
+struct FloatGridTraits {
+  using Vec    = math::Vec3;
+  using Scalar = float;
+  using Coord  = float;
+  using DistSq = float;
+
+  static Coord X(const Vec& v) {
+    return v.x;
+  }
+  static Coord Y(const Vec& v) {
+    return v.y;
+  }
+  static Coord Z(const Vec& v) {
+    return v.z;
+  }
+  static Coord ToCoord(Scalar s) {
+    return s;
+  }
+  // |inv_cell| is 1 / cell_size. Truncate-and-adjust floor: std::floor
+  // is a libm call without SSE4.1.
+  static std::int32_t CellOf(Coord c, Coord, float inv_cell) {
+    const float v        = c * inv_cell;
+    const std::int32_t i = static_cast<std::int32_t>(v);
+    return i - (v < static_cast<float>(i) ? 1 : 0);
+  }
+  static DistSq Square(Coord d) {
+    return d * d;
+  }
+};
+
+// 15.16 raw coordinates; squared distances in int64, bit-exact across
+// platforms.
+struct FixedGridTraits {
+  using Vec    = math::FixedVec3;
+  using Scalar = math::Fixed15p16;
+  using Coord  = std::int32_t;
+  using DistSq = std::int64_t;
+
+  static Coord X(const Vec& v) {
+    return v.x.Raw();
+  }
+  static Coord Y(const Vec& v) {
+    return v.y.Raw();
+  }
+  static Coord Z(const Vec& v) {
+    return v.z.Raw();
+  }
+  static Coord ToCoord(Scalar s) {
+    return s.Raw();
+  }
+  static std::int32_t CellOf(Coord c, Coord cell_size, float) {
+    // Floor division, also for negative coordinates.
+    return c >= 0 ? c / cell_size : -((-(c + 1)) / cell_size) - 1;
+  }
+  static DistSq Square(Coord d) {
+    return static_cast<DistSq>(d) * d;
+  }
+};
+
+template <typename Traits>
+class SpatialHashGrid {
+ public:
+  using Vec    = typename Traits::Vec;
+  using Scalar = typename Traits::Scalar;
+  using Coord  = typename Traits::Coord;
+  using DistSq = typename Traits::DistSq;
+
+  // Upper bound for k in k-nearest queries; larger values are clamped.
+  static constexpr std::uint32_t kMaxK = 64;
+
+  struct Desc {
+    std::uint32_t max_points   = 16384;
+    std::uint32_t bucket_count = 0;  // power of two; 0: >= max_points
+    Scalar cell_size           = Scalar(1);
+    bool planar                = false;  // ignore Y (ground crowds)
+  };
+
+  SpatialHashGrid();
+  ~SpatialHashGrid();
+
+  SpatialHashGrid(const SpatialHashGrid&)            = delete;
+  SpatialHashGrid& operator=(const SpatialHashGrid&) = delete;
+
+  NavaryRC Init(const Desc& desc);
+  void Shutdown();
+
+  // Re-sorts |count| points; point i keeps id i. |jobs| may be null.
+  // kInvalidArgument when count exceeds max_points.
+  NavaryRC Rebuild(const Vec* positions, std::uint32_t count,
+                   core::scheduler::JobSystem* jobs);
+
+  // Ids within |radius| of |center| (inclusive), in cell order, at most
+  // |max_out|. |exclude| (e.g. the querying agent) is skipped.
+  std::uint32_t QueryRadius(const Vec& center, Scalar radius,
+                            std::uint32_t* out_ids, std::uint32_t max_out,
+                            std::uint32_t exclude = kNoSpatialId) const;
+
+  // Up to |k| nearest ids within |radius|, ascending by distance (ties by
+  // id). |out_dist_sq| is optional.
+  std::uint32_t QueryKNearest(const Vec& center, Scalar radius,
+                              std::uint32_t k, std::uint32_t* out_ids,
+                              DistSq* out_dist_sq = nullptr,
+                              std::uint32_t exclude = kNoSpatialId) const;
+
+  // Batched forms: query q writes up to |stride| ids at out_ids[q * stride]
+  // and its count to out_counts[q]. Runs on |jobs| when given.
+  void QueryRadiusBatch(const Vec* centers, std::uint32_t count,
+                        Scalar radius, std::uint32_t stride,
+                        std::uint32_t* out_ids, std::uint32_t* out_counts,
+                        core::scheduler::JobSystem* jobs) const;
+  void QueryKNearestBatch(const Vec* centers, std::uint32_t count,
+                          Scalar radius, std::uint32_t k,
+                          std::uint32_t* out_ids, std::uint32_t* out_counts,
+                          core::scheduler::JobSystem* jobs) const;
+
+  // k nearest neighbors of every indexed point (itself excluded), written
+  // by point id with stride |k|. Walks points in cell order so neighboring
+  // queries share cache lines.
+  void UpdateNeighbors(Scalar radius, std::uint32_t k,
+                       std::uint32_t* out_ids, std::uint32_t* out_counts,
+                       core::scheduler::JobSystem* jobs) const;
+
+  std::uint32_t size() const {
+    return count_;
+  }
+  std::uint32_t bucket_count() const {
+    return bucket_mask_ + 1;
+  }
+
+  // Cell-sorted storage, for callers that want to stream it directly.
+  const Coord* sorted_x() const {
+    return xs_;
+  }
+  const Coord* sorted_y() const {
+    return ys_;
+  }
+  const Coord* sorted_z() const {
+    return zs_;
+  }
+  const std::uint32_t* sorted_ids() const {
+    return ids_;
+  }
+
+ private:
+  static constexpr std::uint32_t kMaxChunks    = 16;
+  static constexpr std::uint32_t kMinChunkSize = 2048;
+
+  enum class BatchMode : std::uint8_t { kRadius, kKNearest, kNeighbors };
+
+  struct RebuildContext;
+  struct BatchContext;
+
+  static void CountRange(std::uint32_t begin, std::uint32_t end,
+                         std::uint32_t worker, void* user_data);
+  static void ScatterRange(std::uint32_t begin, std::uint32_t end,
+                           std::uint32_t worker, void* user_data);
+  static void BatchRange(std::uint32_t begin, std::uint32_t end,
+                         std::uint32_t worker, void* user_data);
+  void RunBatch(BatchMode mode, const Vec* centers, std::uint32_t count,
+                Scalar radius, std::uint32_t stride, std::uint32_t* out_ids,
+                std::uint32_t* out_counts,
+                core::scheduler::JobSystem* jobs) const;
+
+  std::int32_t Cell(Coord c) const {
+    return Traits::CellOf(c, cell_size_, inv_cell_);
+  }
+  std::uint64_t CellKey(std::int32_t ix, std::int32_t iy,
+                        std::int32_t iz) const;
+  std::uint32_t Bucket(std::int32_t ix, std::int32_t iy,
+                       std::int32_t iz) const;
+
+  // Calls fn(sorted_index, dist_sq) for every point within |radius|.
+  template <typename Fn>
+  void ForEachInRadius(Coord cx, Coord cy, Coord cz, Coord radius,
+                       Fn&& fn) const;
+
+  std::uint32_t KNearestAt(Coord cx, Coord cy, Coord cz, Coord radius,
+                           std::uint32_t k, std::uint32_t* out_ids,
+                           DistSq* out_dist_sq, std::uint32_t exclude) const;
+
+  Coord cell_size_;
+  float inv_cell_;
+  bool planar_;
+  std::uint32_t max_points_;
+  std::uint32_t bucket_mask_;
+  std::uint32_t x_mask_;
+  std::uint32_t z_mask_;
+  std::uint32_t y_mask_;
+  std::uint32_t z_shift_;
+  std::uint32_t y_shift_;
+  std::uint32_t count_;
+
+  std::uint32_t* cell_start_;  // bucket_count + 1 offsets into the arrays
+  Coord* xs_;
+  Coord* ys_;
+  Coord* zs_;
+  std::uint64_t* keys_;
+  std::uint32_t* ids_;
+
+  // Rebuild scratch.
+  std::uint64_t* point_keys_;
+  std::uint32_t* point_buckets_;
+  std::uint32_t* histograms_;  // kMaxChunks * bucket_count
+};
+
+using FloatSpatialHashGrid = SpatialHashGrid<FloatGridTraits>;
+using FixedSpatialHashGrid = SpatialHashGrid<FixedGridTraits>;
+
+}  // namespace navary::spatial
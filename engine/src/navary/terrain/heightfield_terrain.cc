@@ -0,0 +1,582 @@
+// Navary Engine - Terrain Subsystem
+// File: navary/terrain/heightfield_terrain.cc
+// Purpose: Quadtree traversal, stitch lookup and the height / ray queries.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/terrain/heightfield_terrain.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+
+#include "navary/math/simd4.h"
+
+namespace navary::terrain {
+
+namespace {
+
+namespace simd = math::simd4;
+
+// Drawn nodes whose error is above this fraction of the budget already
+// stream their children, so refinement rarely waits on IO.
+constexpr float kPrefetchRatio = 0.5f;
+
+// Ray march step in full-resolution samples, and bisection steps once a
+// crossing is bracketed.
+constexpr float kRayStepSamples   = 0.5f;
+constexpr int kRayBisectSteps     = 12;
+constexpr std::uint32_t kMaxStack = 4 * (kTerrainMaxDepth + 1);
+
+struct StackEntry {
+  std::uint8_t depth;
+  std::uint16_t x;
+  std::uint16_t z;
+};
+
+// All four (rx, rz) in [0, size).
+bool Inside(simd::F4 rx, simd::F4 rz, float size) {
+  const simd::F4 zero = simd::Splat(0.0f);
+  const simd::F4 s    = simd::Splat(size);
+  return simd::MoveMask(simd::CmpLt(rx, zero)) == 0 &&
+         simd::MoveMask(simd::CmpLt(rz, zero)) == 0 &&
+         simd::MoveMask(simd::CmpLt(rx, s)) == 0xF &&
+         simd::MoveMask(simd::CmpLt(rz, s)) == 0xF;
+}
+
+float DistanceToAabb(const math::Vec3& p, const math::Aabb& b) {
+  const float dx = std::max({b.min().x - p.x, 0.0f, p.x - b.max().x});
+  const float dy = std::max({b.min().y - p.y, 0.0f, p.y - b.max().y});
+  const float dz = std::max({b.min().z - p.z, 0.0f, p.z - b.max().z});
+  return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+}  // namespace
+
+HeightfieldTerrain::HeightfieldTerrain()
+    : cache_(),
+      origin_(0.0f, 0.0f, 0.0f),
+      max_depth_(0),
+      tile_quads_(0),
+      leaf_size_(0.0f),
+      map_size_(0.0f),
+      map_limit_(0.0f),
+      height_offset_(0.0f),
+      height_scale_(0.0f),
+      patches_(nullptr),
+      patch_count_(0),
+      max_patches_(0),
+      patches_dropped_(0),
+      drawn_frame_(nullptr),
+      frame_(0),
+      nodes_visited_(0) {}
+
+HeightfieldTerrain::~HeightfieldTerrain() {
+  Shutdown();
+}
+
+NavaryRC HeightfieldTerrain::Init(const Desc& desc) {
+  if (patches_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "HeightfieldTerrain: already initialized");
+  }
+  if (desc.max_patches == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "HeightfieldTerrain: max_patches must be > 0");
+  }
+  TerrainTileCache::Desc cache_desc;
+  cache_desc.async_io            = desc.async_io;
+  cache_desc.jobs                = desc.jobs;
+  cache_desc.max_resident_tiles  = desc.max_resident_tiles;
+  cache_desc.max_loads_in_flight = desc.max_loads_in_flight;
+  NAVARY_RETURN_IF_ERROR(cache_.Open(desc.path, cache_desc));
+
+  const TerrainFileHeader& h = cache_.header();
+  const std::uint32_t pinned =
+      TerrainNodeCount(std::min(desc.pinned_depth, h.max_depth));
+  if (pinned >= desc.max_resident_tiles) {
+    cache_.Shutdown();
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "HeightfieldTerrain: pinned levels fill the tile pool");
+  }
+
+  patches_ = static_cast<TerrainPatch*>(
+      std::malloc(sizeof(TerrainPatch) * desc.max_patches));
+  drawn_frame_ = static_cast<std::uint32_t*>(
+      std::malloc(sizeof(std::uint32_t) * h.node_count));
+  if (patches_ == nullptr || drawn_frame_ == nullptr) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "HeightfieldTerrain: alloc failed");
+  }
+  std::fill(drawn_frame_, drawn_frame_ + h.node_count, 0u);
+
+  for (std::uint32_t node = 0; node < pinned; ++node) {
+    NavaryRC rc = cache_.LoadBlocking(node, /*pin=*/true);
+    if (!rc.ok()) {
+      Shutdown();
+      return rc;
+    }
+  }
+
+  origin_        = desc.origin;
+  max_depth_     = h.max_depth;
+  tile_quads_    = h.tile_quads;
+  leaf_size_     = static_cast<float>(h.tile_quads) * h.sample_spacing;
+  map_size_      = leaf_size_ * static_cast<float>(1u << h.max_depth);
+  map_limit_     = std::nextafter(map_size_, 0.0f);
+  height_offset_ = origin_.y + h.height_offset;
+  height_scale_  = h.height_scale;
+  max_patches_     = desc.max_patches;
+  patch_count_     = 0;
+  patches_dropped_ = 0;
+  frame_           = 0;
+  return NavaryRC::OK();
+}
+
+void HeightfieldTerrain::Shutdown() {
+  cache_.Shutdown();
+  std::free(patches_);
+  std::free(drawn_frame_);
+  patches_         = nullptr;
+  drawn_frame_     = nullptr;
+  patch_count_     = 0;
+  max_patches_     = 0;
+  patches_dropped_ = 0;
+  nodes_visited_   = 0;
+}
+
+math::Aabb HeightfieldTerrain::NodeBounds(std::uint32_t depth,
+                                          std::uint32_t x,
+                                          std::uint32_t z) const {
+  const TerrainNodeRecord& r = cache_.record(TerrainNodeIndex(depth, x, z));
+  const float size           = map_size_ / static_cast<float>(1u << depth);
+  const float x0             = origin_.x + static_cast<float>(x) * size;
+  const float z0             = origin_.z + static_cast<float>(z) * size;
+  return math::Aabb(
+      math::Vec3(x0, height_offset_ + r.min_q * height_scale_, z0),
+      math::Vec3(x0 + size, height_offset_ + r.max_q * height_scale_,
+                 z0 + size));
+}
+
+std::uint32_t HeightfieldTerrain::Update(const TerrainView& view) {
+  patch_count_     = 0;
+  patches_dropped_ = 0;
+  nodes_visited_   = 0;
+  if (patches_ == nullptr) {
+    return 0;
+  }
+  ++frame_;
+
+  const float k =
+      view.viewport_height / (2.0f * std::tan(view.fovy * 0.5f));
+  StackEntry stack[kMaxStack];
+  std::uint32_t top = 0;
+  stack[top++]      = StackEntry{0, 0, 0};
+  while (top > 0) {
+    const StackEntry e       = stack[--top];
+    const std::uint32_t node = TerrainNodeIndex(e.depth, e.x, e.z);
+    ++nodes_visited_;
+    if (cache_.Acquire(node) == nullptr) {
+      continue;  // only the root can get here unloaded (failed pin)
+    }
+    const math::Aabb box = NodeBounds(e.depth, e.x, e.z);
+    if (view.frustum != nullptr &&
+        !view.frustum->IsAabbVisible(box.min(), box.max())) {
+      continue;
+    }
+    if (e.depth == max_depth_) {
+      Emit(e.depth, e.x, e.z, node);
+      continue;
+    }
+
+    const float dist = std::max(DistanceToAabb(view.eye, box), 1e-3f);
+    const float rho  = cache_.record(node).error * k / dist;
+    std::uint32_t children[4];
+    bool all_resident = true;
+    for (std::uint32_t c = 0; c < 4; ++c) {
+      children[c] = TerrainNodeIndex(e.depth + 1, 2u * e.x + (c & 1),
+                                     2u * e.z + (c >> 1));
+      all_resident = all_resident && cache_.IsResident(children[c]);
+    }
+    if (rho <= view.max_pixel_error || !all_resident) {
+      if (rho > view.max_pixel_error * kPrefetchRatio) {
+        for (std::uint32_t child : children) {
+          cache_.Request(child, rho);
+          // Keep the siblings that did arrive until the rest do.
+          cache_.Acquire(child);
+        }
+      }
+      Emit(e.depth, e.x, e.z, node);
+      continue;
+    }
+    const auto child_depth = static_cast<std::uint8_t>(e.depth + 1);
+    for (std::uint32_t c = 0; c < 4; ++c) {
+      const auto cx = static_cast<std::uint16_t>(2u * e.x + (c & 1));
+      const auto cz = static_cast<std::uint16_t>(2u * e.z + (c >> 1));
+      stack[top++]  = StackEntry{child_depth, cx, cz};
+    }
+  }
+
+  for (std::uint32_t i = 0; i < patch_count_; ++i) {
+    ComputeStitch(&patches_[i]);
+  }
+  cache_.Update();
+  return patch_count_;
+}
+
+void HeightfieldTerrain::Emit(std::uint32_t depth, std::uint32_t x,
+                              std::uint32_t z, std::uint32_t node) {
+  if (patch_count_ == max_patches_) {
+    ++patches_dropped_;  // a hole this frame; see Desc::max_patches
+    return;
+  }
+  const float size   = map_size_ / static_cast<float>(1u << depth);
+  TerrainPatch& p    = patches_[patch_count_++];
+  p.node             = node;
+  p.slot             = cache_.SlotOf(node);
+  p.x                = static_cast<std::uint16_t>(x);
+  p.z                = static_cast<std::uint16_t>(z);
+  p.depth            = static_cast<std::uint8_t>(depth);
+  p.stitch[0]        = 0;
+  p.stitch[1]        = 0;
+  p.stitch[2]        = 0;
+  p.stitch[3]        = 0;
+  p.origin_x         = origin_.x + static_cast<float>(x) * size;
+  p.origin_z         = origin_.z + static_cast<float>(z) * size;
+  p.spacing          = size / static_cast<float>(tile_quads_);
+  drawn_frame_[node] = frame_;
+}
+
+void HeightfieldTerrain::ComputeStitch(TerrainPatch* patch) const {
+  static constexpr int kDx[4] = {-1, 1, 0, 0};
+  static constexpr int kDz[4] = {0, 0, -1, 1};
+  const std::uint32_t depth   = patch->depth;
+  const std::int64_t side     = std::int64_t{1} << depth;
+  const std::uint32_t limit   = std::countr_zero(tile_quads_);
+  for (int edge = 0; edge < 4; ++edge) {
+    const std::int64_t nx = std::int64_t{patch->x} + kDx[edge];
+    const std::int64_t nz = std::int64_t{patch->z} + kDz[edge];
+    if (nx < 0 || nz < 0 || nx >= side || nz >= side) {
+      continue;  // map border
+    }
+    // At most one node on the path to the root is drawn; none means the
+    // neighbour is finer (it stitches to us) or culled.
+    auto x = static_cast<std::uint32_t>(nx);
+    auto z = static_cast<std::uint32_t>(nz);
+    for (std::uint32_t d = depth;; --d) {
+      if (drawn_frame_[TerrainNodeIndex(d, x, z)] == frame_) {
+        patch->stitch[edge] =
+            static_cast<std::uint8_t>(std::min(depth - d, limit));
+        break;
+      }
+      if (d == 0) {
+        break;
+      }
+      x >>= 1;
+      z >>= 1;
+    }
+  }
+}
+
+HeightfieldTerrain::NodeRef HeightfieldTerrain::FindNode(float lx,
+                                                         float lz) const {
+  const std::uint32_t last = (1u << max_depth_) - 1;
+  const auto tx =
+      std::min(static_cast<std::uint32_t>(lx / leaf_size_), last);
+  const auto tz =
+      std::min(static_cast<std::uint32_t>(lz / leaf_size_), last);
+  std::uint32_t depth = 0;
+  std::uint32_t node  = 0;
+  while (depth < max_depth_) {
+    const std::uint32_t shift = max_depth_ - depth - 1;
+    const std::uint32_t child =
+        TerrainNodeIndex(depth + 1, tx >> shift, tz >> shift);
+    if (!cache_.IsResident(child)) {
+      break;
+    }
+    ++depth;
+    node = child;
+  }
+
+  NodeRef ref;
+  const std::uint32_t shift = max_depth_ - depth;
+  ref.tile        = cache_.Peek(node);
+  ref.size        = leaf_size_ * static_cast<float>(1u << shift);
+  ref.origin_x    = static_cast<float>(tx >> shift) * ref.size;
+  ref.origin_z    = static_cast<float>(tz >> shift) * ref.size;
+  ref.inv_spacing = static_cast<float>(tile_quads_) / ref.size;
+  ref.max_height  = height_offset_ + cache_.record(node).max_q * height_scale_;
+  ref.covers_extent = true;
+  if (depth < max_depth_) {
+    const std::uint32_t cx = (tx >> shift) * 2u;
+    const std::uint32_t cz = (tz >> shift) * 2u;
+    for (std::uint32_t c = 0; c < 4 && ref.covers_extent; ++c) {
+      ref.covers_extent = !cache_.IsResident(
+          TerrainNodeIndex(depth + 1, cx + (c & 1), cz + (c >> 1)));
+    }
+  }
+  return ref;
+}
+
+float HeightfieldTerrain::SampleNode(const NodeRef& ref, float lx,
+                                     float lz) const {
+  const float n = static_cast<float>(tile_quads_);
+  const float u = std::clamp((lx - ref.origin_x) * ref.inv_spacing, 0.0f, n);
+  const float v = std::clamp((lz - ref.origin_z) * ref.inv_spacing, 0.0f, n);
+  const auto i  = static_cast<std::uint32_t>(std::min(u, n - 1.0f));
+  const auto j  = static_cast<std::uint32_t>(std::min(v, n - 1.0f));
+  const float fu = u - static_cast<float>(i);
+  const float fv = v - static_cast<float>(j);
+
+  const std::uint32_t side = tile_quads_ + 1;
+  const std::uint16_t* r0  = ref.tile + j * side + i;
+  const std::uint16_t* r1  = r0 + side;
+  const float h0 = r0[0] + (static_cast<float>(r0[1]) - r0[0]) * fu;
+  const float h1 = r1[0] + (static_cast<float>(r1[1]) - r1[0]) * fu;
+  return height_offset_ + (h0 + (h1 - h0) * fv) * height_scale_;
+}
+
+float HeightfieldTerrain::HeightAt(float x, float z) const {
+  const float lx = std::clamp(x - origin_.x, 0.0f, map_limit_);
+  const float lz = std::clamp(z - origin_.z, 0.0f, map_limit_);
+  return SampleNode(FindNode(lx, lz), lx, lz);
+}
+
+void HeightfieldTerrain::HeightsAt(const float* xs, const float* zs,
+                                   std::uint32_t n, float* out) const {
+  const simd::F4 zero      = simd::Splat(0.0f);
+  const simd::F4 limit     = simd::Splat(map_limit_);
+  const simd::F4 last_quad = simd::Splat(static_cast<float>(tile_quads_ - 1));
+  const std::uint32_t side = tile_quads_ + 1;
+  const std::uint32_t n4   = n & ~3u;
+  float lx[4];
+  float lz[4];
+  std::int32_t ii[4];
+  std::int32_t jj[4];
+  float q00[4];
+  float q10[4];
+  float q01[4];
+  float q11[4];
+  NodeRef ref{};
+  for (std::uint32_t b = 0; b < n4; b += 4) {
+    const simd::F4 vx = simd::Clamp(
+        simd::Sub(simd::Load(xs + b), simd::Splat(origin_.x)), zero, limit);
+    const simd::F4 vz = simd::Clamp(
+        simd::Sub(simd::Load(zs + b), simd::Splat(origin_.z)), zero, limit);
+    simd::Store(lx, vx);
+    simd::Store(lz, vz);
+
+    // Batches are usually spatially coherent: keep the previous group's
+    // node while all four points stay inside it, else look up the first
+    // point's. Groups straddling nodes resolve each point.
+    simd::F4 rx = simd::Sub(vx, simd::Splat(ref.origin_x));
+    simd::F4 rz = simd::Sub(vz, simd::Splat(ref.origin_z));
+    if (ref.tile == nullptr || !Inside(rx, rz, ref.size)) {
+      ref = FindNode(lx[0], lz[0]);
+      rx  = simd::Sub(vx, simd::Splat(ref.origin_x));
+      rz  = simd::Sub(vz, simd::Splat(ref.origin_z));
+    }
+    if (!ref.covers_extent || !Inside(rx, rz, ref.size)) {
+      for (int l = 0; l < 4; ++l) {
+        out[b + l] = SampleNode(FindNode(lx[l], lz[l]), lx[l], lz[l]);
+      }
+      continue;
+    }
+
+    const simd::F4 inv = simd::Splat(ref.inv_spacing);
+    const simd::F4 u   = simd::Mul(rx, inv);
+    const simd::F4 v   = simd::Mul(rz, inv);
+    const simd::I4 i   = simd::TruncToInt(simd::Min(u, last_quad));
+    const simd::I4 j   = simd::TruncToInt(simd::Min(v, last_quad));
+    const simd::F4 fu  = simd::Sub(u, simd::ToFloat(i));
+    const simd::F4 fv  = simd::Sub(v, simd::ToFloat(j));
+    simd::StoreI(ii, i);
+    simd::StoreI(jj, j);
+    for (int l = 0; l < 4; ++l) {
+      const std::uint16_t* r0 = ref.tile + jj[l] * side + ii[l];
+      q00[l]                  = r0[0];
+      q10[l]                  = r0[1];
+      q01[l]                  = r0[side];
+      q11[l]                  = r0[side + 1];
+    }
+    const simd::F4 a0 = simd::Load(q00);
+    const simd::F4 a1 = simd::Load(q01);
+    const simd::F4 h0 = simd::MulAdd(simd::Sub(simd::Load(q10), a0), fu, a0);
+    const simd::F4 h1 = simd::MulAdd(simd::Sub(simd::Load(q11), a1), fu, a1);
+    const simd::F4 h  = simd::MulAdd(simd::Sub(h1, h0), fv, h0);
+    simd::Store(out + b, simd::MulAdd(h, simd::Splat(height_scale_),
+                                      simd::Splat(height_offset_)));
+  }
+  for (std::uint32_t b = n4; b < n; ++b) {
+    out[b] = HeightAt(xs[b], zs[b]);
+  }
+}
+
+math::Vec3 HeightfieldTerrain::NormalAt(float x, float z) const {
+  const float s     = leaf_size_ / static_cast<float>(tile_quads_);
+  const float xs[4] = {x - s, x + s, x, x};
+  const float zs[4] = {z, z, z - s, z + s};
+  float h[4];
+  HeightsAt(xs, zs, 4, h);
+  return math::Vec3(h[0] - h[1], 2.0f * s, h[2] - h[3]).normalized();
+}
+
+bool HeightfieldTerrain::Raycast(const math::Vec3& origin,
+                                 const math::Vec3& dir, float max_distance,
+                                 TerrainRayHit* hit) const {
+  const float len = dir.length();
+  if (patches_ == nullptr || !(len > 0.0f) || !(max_distance > 0.0f)) {
+    return false;
+  }
+  const math::Vec3 d = dir / len;
+
+  // Clip to the terrain box.
+  const math::Aabb box = bounds();
+  const float o[3]     = {origin.x, origin.y, origin.z};
+  const float v[3]     = {d.x, d.y, d.z};
+  const float lo[3]    = {box.min().x, box.min().y, box.min().z};
+  const float hi[3]    = {box.max().x, box.max().y, box.max().z};
+  float t0             = 0.0f;
+  float t1             = max_distance;
+  for (int a = 0; a < 3; ++a) {
+    if (std::fabs(v[a]) < 1e-12f) {
+      if (o[a] < lo[a] || o[a] > hi[a]) {
+        return false;
+      }
+      continue;
+    }
+    float ta = (lo[a] - o[a]) / v[a];
+    float tb = (hi[a] - o[a]) / v[a];
+    if (ta > tb) {
+      std::swap(ta, tb);
+    }
+    t0 = std::max(t0, ta);
+    t1 = std::min(t1, tb);
+    if (t0 > t1) {
+      return false;
+    }
+  }
+
+  auto report = [&](float t) {
+    if (hit != nullptr) {
+      const math::Vec3 p = origin + d * t;
+      hit->position      = math::Vec3(p.x, HeightAt(p.x, p.z), p.z);
+      hit->normal        = NormalAt(p.x, p.z);
+      hit->distance      = t;
+    }
+    return true;
+  };
+  auto below = [&](float t) {
+    const math::Vec3 p = origin + d * t;
+    return p.y <= HeightAt(p.x, p.z);
+  };
+  if (below(t0)) {
+    return report(t0);
+  }
+
+  const float step = kRayStepSamples * leaf_size_ /
+                     static_cast<float>(tile_quads_);
+  const float kIota[4]  = {1.0f, 2.0f, 3.0f, 4.0f};
+  const simd::F4 v_step = simd::Mul(simd::Load(kIota), simd::Splat(step));
+  float ts[4];
+  float xs[4];
+  float zs[4];
+  float hs[4];
+  float t = t0;
+  while (t < t1) {
+    // Skip the whole node under the ray when the ray stays above its
+    // highest sample across it.
+    const math::Vec3 p = origin + d * t;
+    const NodeRef ref  =
+        FindNode(std::clamp(p.x - origin_.x, 0.0f, map_limit_),
+                 std::clamp(p.z - origin_.z, 0.0f, map_limit_));
+    float t_exit = t1;
+    if (d.x != 0.0f) {
+      const float edge = d.x > 0.0f ? ref.origin_x + ref.size : ref.origin_x;
+      t_exit = std::min(t_exit, (origin_.x + edge - origin.x) / d.x);
+    }
+    if (d.z != 0.0f) {
+      const float edge = d.z > 0.0f ? ref.origin_z + ref.size : ref.origin_z;
+      t_exit = std::min(t_exit, (origin_.z + edge - origin.z) / d.z);
+    }
+    t_exit = std::max(t_exit, t + step * 1e-3f);
+    if (std::min(p.y, origin.y + d.y * t_exit) > ref.max_height) {
+      t = t_exit;
+      continue;
+    }
+
+    // March the node four samples at a time.
+    while (t < t_exit) {
+      const simd::F4 vt = simd::Min(simd::Add(simd::Splat(t), v_step),
+                                    simd::Splat(t_exit));
+      simd::Store(ts, vt);
+      simd::Store(xs, simd::MulAdd(vt, simd::Splat(d.x),
+                                   simd::Splat(origin.x)));
+      simd::Store(zs, simd::MulAdd(vt, simd::Splat(d.z),
+                                   simd::Splat(origin.z)));
+      HeightsAt(xs, zs, 4, hs);
+      const simd::F4 ys =
+          simd::MulAdd(vt, simd::Splat(d.y), simd::Splat(origin.y));
+      const int mask = simd::MoveMask(
+          simd::CmpLt(ys, simd::Add(simd::Load(hs), simd::Splat(1e-6f))));
+      if (mask != 0) {
+        const int lane = std::countr_zero(static_cast<unsigned>(mask));
+        float a        = lane == 0 ? t : ts[lane - 1];
+        float c        = ts[lane];
+        for (int s = 0; s < kRayBisectSteps; ++s) {
+          const float m = 0.5f * (a + c);
+          (below(m) ? c : a) = m;
+        }
+        return report(c);
+      }
+      t = ts[3];
+    }
+  }
+  return false;
+}
+
+void HeightfieldTerrain::BuildPatchHeights(const TerrainPatch& patch,
+                                           float* out) const {
+  const std::uint16_t* tile = cache_.tile(patch.slot);
+  const std::uint32_t n     = tile_quads_;
+  const std::uint32_t side  = n + 1;
+  for (std::uint32_t i = 0; i < side * side; ++i) {
+    out[i] = height_offset_ + tile[i] * height_scale_;
+  }
+  // Vertex k of an edge, as an index into |out|.
+  auto at = [&](int edge, std::uint32_t k) {
+    switch (edge) {
+      case kTerrainEdgeMinX:
+        return k * side;
+      case kTerrainEdgeMaxX:
+        return k * side + n;
+      case kTerrainEdgeMinZ:
+        return k;
+      default:
+        return n * side + k;
+    }
+  };
+  for (int edge = 0; edge < 4; ++edge) {
+    if (patch.stitch[edge] == 0) {
+      continue;
+    }
+    const std::uint32_t step = 1u << patch.stitch[edge];
+    const float inv_step     = 1.0f / static_cast<float>(step);
+    for (std::uint32_t k = 0; k <= n; ++k) {
+      const std::uint32_t k0 = k & ~(step - 1);
+      if (k0 == k) {
+        continue;  // shared with the coarse neighbour
+      }
+      const float a = out[at(edge, k0)];
+      const float b = out[at(edge, k0 + step)];
+      out[at(edge, k)] =
+          a + (b - a) * (static_cast<float>(k - k0) * inv_step);
+    }
+  }
+}
+
+}  // namespace navary::terrain
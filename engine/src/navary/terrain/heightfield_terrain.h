@@ -0,0 +1,220 @@
+#pragma once
+// Navary Engine - Terrain Subsystem
+// File: navary/terrain/heightfield_terrain.h
+// Purpose: Streamed heightfield terrain: quadtree LOD selection by
+//          screen-space error, crack-free patch stitching and SIMD height,
+//          normal and ray queries.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - Every quadtree node is one fixed-size patch (tile_quads^2 quads) of
+//     a .nvtr file (terrain_format.h); deeper nodes cover less ground at a
+//     finer sample stride. Tiles stream through TerrainTileCache.
+//   - Update(view) walks the tree from the root. A node is culled when
+//     its Aabb (full-resolution min / max height) is outside the frustum,
+//     drawn when its screen-space error (geometric error * K / distance,
+//     K = viewport_height / (2 tan(fovy / 2))) is within max_pixel_error,
+//     and refined otherwise, provided all four children are resident.
+//     Missing children are requested with their screen-space error as
+//     priority and the node is drawn meanwhile. Children of drawn nodes
+//     that are close to needing refinement are prefetched at low
+//     priority. The work per frame follows the view, not the map size.
+//   - Stitching: for each edge of each patch, the neighbour across it is
+//     looked up by walking up from the same-depth neighbour until a drawn
+//     ancestor is found (bounded by the depth). TerrainPatch::stitch holds
+//     log2 of how much coarser that neighbour is; the vertex shader (or
+//     BuildPatchHeights) snaps the edge vertices onto the coarse edge.
+//     Tiles are decimated, so the coarse edge's vertices are exact fine
+//     vertices and the edges match bit for bit.
+//   - Queries use the finest resident tile under each point (the pinned
+//     coarse levels guarantee one). HeightsAt() evaluates four points at a
+//     time with math/simd4.h when they share a tile; Raycast() marches
+//     the ray four samples per step and bisects the first crossing.
+//
+// Notes:
+//   - Owner thread only: Update() and the queries must not overlap.
+//   - Heights between samples are bilinear. Positions outside the map are
+//     clamped to its edge.
+//   - Neighbours more than log2(tile_quads) levels apart are stitched to
+//     that limit only; the error metric keeps real views far from it.
+//
+// Example:
+// ```cpp
+//   navary::terrain::HeightfieldTerrain::Desc desc;
+//   desc.path     = "maps/island.nvtr";
+//   desc.async_io = &async_io;
+//   terrain.Init(desc);
+//   ...
+//   TerrainView view;
+//   view.eye     = camera_pos;
+//   view.frustum = &frustum;
+//   terrain.Update(view);
+//   for (uint32_t i = 0; i < terrain.patch_count(); ++i) {
+//     DrawPatch(terrain.patches()[i]);
+//   }
+//   float ground = terrain.HeightAt(player.x, player.z);
+// ```
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/io/async_io.h"
+#include "navary/math/aabb.h"
+#include "navary/math/frustum.h"
+#include "navary/math/vec3.h"
+#include "navary/navary_status.h"
+#include "navary/terrain/terrain_tile_cache.h"
+
+namespace navary::terrain {
+
+enum TerrainEdge : std::uint8_t {
+  kTerrainEdgeMinX = 0,
+  kTerrainEdgeMaxX = 1,
+  kTerrainEdgeMinZ = 2,
+  kTerrainEdgeMaxZ = 3,
+};
+
+struct TerrainView {
+  math::Vec3 eye               = math::Vec3(0.0f, 0.0f, 0.0f);
+  const math::Frustum* frustum = nullptr;     // null: no culling
+  float viewport_height        = 1080.0f;     // pixels
+  float fovy                   = 1.0471976f;  // radians
+  float max_pixel_error        = 2.0f;
+};
+
+// One patch to draw: the tile of |node| in pool slot |slot|.
+struct TerrainPatch {
+  std::uint32_t node;
+  std::int32_t slot;
+  std::uint16_t x;  // node coordinates at |depth|
+  std::uint16_t z;
+  std::uint8_t depth;
+  std::uint8_t stitch[4];  // by TerrainEdge; 0 = same or finer neighbour
+  float origin_x;          // world position of tile sample (0, 0)
+  float origin_z;
+  float spacing;  // world units between this tile's samples
+};
+
+struct TerrainRayHit {
+  math::Vec3 position;
+  math::Vec3 normal;
+  float distance;
+};
+
+class HeightfieldTerrain {
+ public:
+  struct Desc {
+    const char* path                  = nullptr;
+    io::AsyncIo* async_io             = nullptr;
+    core::scheduler::JobSystem* jobs  = nullptr;
+    math::Vec3 origin                 = math::Vec3(0.0f, 0.0f, 0.0f);
+    std::uint32_t max_resident_tiles  = 256;
+    std::uint32_t max_loads_in_flight = 16;
+    // Patch list capacity. Every drawn patch is a distinct resident tile,
+    // so max_patches >= max_resident_tiles never overflows; smaller lists
+    // save memory but a view that needs more patches leaves holes, counted
+    // by patches_dropped().
+    std::uint32_t max_patches = 1024;
+    // Depths 0..pinned_depth load during Init() and are never evicted.
+    std::uint32_t pinned_depth = 1;
+  };
+
+  HeightfieldTerrain();
+  ~HeightfieldTerrain();
+
+  HeightfieldTerrain(const HeightfieldTerrain&)            = delete;
+  HeightfieldTerrain& operator=(const HeightfieldTerrain&) = delete;
+
+  NavaryRC Init(const Desc& desc);
+  void Shutdown();
+
+  // Selects this frame's patches, then lets the tile cache evict and
+  // start loads. Returns patch_count().
+  std::uint32_t Update(const TerrainView& view);
+
+  const TerrainPatch* patches() const {
+    return patches_;
+  }
+  std::uint32_t patch_count() const {
+    return patch_count_;
+  }
+  // Nodes the last Update() looked at (drawn, refined or culled).
+  std::uint32_t nodes_visited() const {
+    return nodes_visited_;
+  }
+  // Patches the last Update() selected but had no room for; their area
+  // is not covered this frame. Non-zero means max_patches is too small.
+  std::uint32_t patches_dropped() const {
+    return patches_dropped_;
+  }
+
+  math::Aabb bounds() const {
+    return NodeBounds(0, 0, 0);
+  }
+  math::Aabb NodeBounds(std::uint32_t depth, std::uint32_t x,
+                        std::uint32_t z) const;
+
+  float HeightAt(float x, float z) const;
+  // |n| points; any n, any alignment.
+  void HeightsAt(const float* xs, const float* zs, std::uint32_t n,
+                 float* out) const;
+  math::Vec3 NormalAt(float x, float z) const;
+
+  // First hit along |dir| (need not be normalized) within max_distance
+  // world units of |origin|.
+  bool Raycast(const math::Vec3& origin, const math::Vec3& dir,
+               float max_distance, TerrainRayHit* hit) const;
+
+  // World heights of the patch's (tile_quads + 1)^2 vertices, row-major
+  // in z, with stitched edges: what a vertex shader produces from the
+  // tile and TerrainPatch::stitch.
+  void BuildPatchHeights(const TerrainPatch& patch, float* out) const;
+
+  const TerrainTileCache& cache() const {
+    return cache_;
+  }
+  TerrainTileCache& cache() {
+    return cache_;
+  }
+
+ private:
+  struct NodeRef {
+    const std::uint16_t* tile;
+    float origin_x;  // local (map) coordinates
+    float origin_z;
+    float inv_spacing;
+    float size;
+    float max_height;    // world, over the node's full-res samples
+    bool covers_extent;  // no resident child: finest over its whole area
+  };
+
+  void Emit(std::uint32_t depth, std::uint32_t x, std::uint32_t z,
+            std::uint32_t node);
+  void ComputeStitch(TerrainPatch* patch) const;
+
+  // Finest resident node under local (lx, lz).
+  NodeRef FindNode(float lx, float lz) const;
+  float SampleNode(const NodeRef& ref, float lx, float lz) const;
+
+  TerrainTileCache cache_;
+  math::Vec3 origin_;
+  std::uint32_t max_depth_;
+  std::uint32_t tile_quads_;
+  float leaf_size_;  // world size of a max-depth node
+  float map_size_;
+  float map_limit_;  // largest local coordinate inside the map
+  float height_offset_;
+  float height_scale_;
+
+  TerrainPatch* patches_;
+  std::uint32_t patch_count_;
+  std::uint32_t max_patches_;
+  std::uint32_t patches_dropped_;
+  std::uint32_t* drawn_frame_;  // per node, frame it was last drawn
+  std::uint32_t frame_;
+  std::uint32_t nodes_visited_;
+};
+
+}  // namespace navary::terrain
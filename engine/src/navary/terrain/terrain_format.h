@@ -0,0 +1,85 @@
+#pragma once
+// Navary Engine - Terrain Subsystem
+// File: navary/terrain/terrain_format.h
+// Purpose: On-disk layout of .nvtr streamed heightfields.
+// Policy: C++20, Google style, no exceptions, no RTTI, header-only.
+//
+// Layout (little-endian):
+//   TerrainFileHeader
+//   TerrainNodeRecord[node_count]   loaded whole when the terrain opens
+//   tiles[node_count]               tile_bytes each, streamed on demand
+//
+// The map is a square grid of (tile_quads << max_depth) + 1 samples.
+// Quadtree node (depth, x, z) covers tile_quads << (max_depth - depth)
+// quads and is stored as one (tile_quads + 1)^2 tile of uint16 heights
+// taking every (1 << (max_depth - depth))-th sample, row-major in z.
+// Coarse tiles are decimated, never filtered, so every coarse vertex is
+// also a vertex of each finer tile below it; edge stitching relies on it.
+//
+// Nodes are numbered breadth first: depth d starts at (4^d - 1) / 3 and
+// is row-major within the depth (z * 2^d + x).
+//
+// Heights dequantize as height_offset + q * height_scale. A node record
+// holds the min / max over every full-resolution sample the node covers
+// (not only its tile's) and its geometric error: the largest vertical
+// distance between the bilinear surface of its tile and the full
+// resolution samples, raised to at least each child's error so that
+// screen-space error never grows on refinement.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+namespace navary::terrain {
+
+inline constexpr std::uint32_t kTerrainMagic   = 0x5254564Eu;  // "NVTR"
+inline constexpr std::uint32_t kTerrainVersion = 1;
+
+// 4^13 / 3 nodes is ~22M records; deeper maps should split into regions.
+inline constexpr std::uint32_t kTerrainMaxDepth     = 12;
+inline constexpr std::uint32_t kTerrainMinTileQuads = 2;
+inline constexpr std::uint32_t kTerrainMaxTileQuads = 256;
+
+struct TerrainFileHeader {
+  std::uint32_t magic;
+  std::uint32_t version;
+  std::uint32_t max_depth;
+  std::uint32_t tile_quads;  // power of two
+  std::uint32_t node_count;
+  float sample_spacing;  // world units between full-resolution samples
+  float height_offset;
+  float height_scale;
+};
+
+struct TerrainNodeRecord {
+  std::uint16_t min_q;
+  std::uint16_t max_q;
+  float error;  // world units
+};
+
+static_assert(sizeof(TerrainFileHeader) == 32);
+static_assert(sizeof(TerrainNodeRecord) == 8);
+
+inline constexpr std::uint32_t TerrainNodeCount(std::uint32_t max_depth) {
+  return ((1u << (2 * (max_depth + 1))) - 1) / 3;
+}
+
+inline constexpr std::uint32_t TerrainNodeIndex(std::uint32_t depth,
+                                                std::uint32_t x,
+                                                std::uint32_t z) {
+  return ((1u << (2 * depth)) - 1) / 3 + (z << depth) + x;
+}
+
+inline constexpr std::uint32_t TerrainTileSamples(std::uint32_t tile_quads) {
+  return (tile_quads + 1) * (tile_quads + 1);
+}
+
+inline constexpr std::uint64_t TerrainTileOffset(
+    const TerrainFileHeader& header, std::uint32_t node) {
+  return sizeof(TerrainFileHeader) +
+         std::uint64_t{header.node_count} * sizeof(TerrainNodeRecord) +
+         std::uint64_t{node} * TerrainTileSamples(header.tile_quads) * 2u;
+}
+
+}  // namespace navary::terrain
@@ -0,0 +1,403 @@
+// Navary Engine - Terrain Subsystem
+// File: navary/terrain/terrain_tile_cache.cc
+// Purpose: Slot pool, LRU list and AsyncIo plumbing for height tiles.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/terrain/terrain_tile_cache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace navary::terrain {
+
+namespace {
+
+constexpr std::uint8_t kReadPending = 0;
+constexpr std::uint8_t kReadOk      = 1;
+constexpr std::uint8_t kReadFailed  = 2;
+
+bool ValidHeader(const TerrainFileHeader& h) {
+  return h.magic == kTerrainMagic && h.version == kTerrainVersion &&
+         h.max_depth <= kTerrainMaxDepth &&
+         h.tile_quads >= kTerrainMinTileQuads &&
+         h.tile_quads <= kTerrainMaxTileQuads &&
+         (h.tile_quads & (h.tile_quads - 1)) == 0 &&
+         h.node_count == TerrainNodeCount(h.max_depth) &&
+         h.sample_spacing > 0.0f && h.height_scale > 0.0f;
+}
+
+}  // namespace
+
+TerrainTileCache::TerrainTileCache()
+    : async_io_(nullptr),
+      jobs_(nullptr),
+      file_(),
+      header_(),
+      records_(nullptr),
+      node_slot_(nullptr),
+      tile_samples_(0),
+      max_slots_(0),
+      tiles_(nullptr),
+      slot_state_(nullptr),
+      slot_node_(nullptr),
+      slot_frame_(nullptr),
+      slot_pinned_(nullptr),
+      slot_ready_(nullptr),
+      lru_prev_(nullptr),
+      lru_next_(nullptr),
+      lru_head_(kNil),
+      lru_tail_(kNil),
+      free_slots_(nullptr),
+      free_count_(0),
+      resident_count_(0),
+      loading_(nullptr),
+      loading_count_(0),
+      max_loading_(0),
+      requests_(nullptr),
+      request_count_(0),
+      max_requests_(0),
+      frame_(1),
+      stats_() {}
+
+TerrainTileCache::~TerrainTileCache() {
+  Shutdown();
+}
+
+NavaryRC TerrainTileCache::Open(const char* path, const Desc& desc) {
+  if (records_ != nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "TerrainTileCache: already open");
+  }
+  if (path == nullptr || desc.async_io == nullptr ||
+      desc.max_resident_tiles == 0 || desc.max_loads_in_flight == 0 ||
+      desc.max_requests == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "TerrainTileCache: invalid desc");
+  }
+
+  std::FILE* f = std::fopen(path, "rb");
+  if (f == nullptr) {
+    return NavaryRC(NavaryStatus::kIoError, "TerrainTileCache: cannot open");
+  }
+  TerrainFileHeader header{};
+  if (std::fread(&header, sizeof(header), 1, f) != 1 || !ValidHeader(header)) {
+    std::fclose(f);
+    return NavaryRC(NavaryStatus::kParseError,
+                    "TerrainTileCache: bad terrain header");
+  }
+  records_ = static_cast<TerrainNodeRecord*>(
+      std::malloc(sizeof(TerrainNodeRecord) * header.node_count));
+  if (records_ == nullptr) {
+    std::fclose(f);
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "TerrainTileCache: alloc failed");
+  }
+  const bool read_ok = std::fread(records_, sizeof(TerrainNodeRecord),
+                                  header.node_count, f) == header.node_count;
+  std::fclose(f);
+  if (!read_ok) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kParseError,
+                    "TerrainTileCache: truncated node table");
+  }
+
+  NavaryResult<io::AsyncFile> file_or = desc.async_io->OpenFile(path);
+  if (!file_or.status().ok()) {
+    Shutdown();
+    return file_or.status();
+  }
+  async_io_     = desc.async_io;
+  jobs_         = desc.jobs;
+  file_         = file_or.value();
+  header_       = header;
+  tile_samples_ = TerrainTileSamples(header.tile_quads);
+  max_slots_    = desc.max_resident_tiles;
+  max_loading_  = desc.max_loads_in_flight;
+  max_requests_ = desc.max_requests;
+
+  const std::uint32_t n = max_slots_;
+  node_slot_            = static_cast<std::int32_t*>(
+      std::malloc(sizeof(std::int32_t) * header.node_count));
+  tiles_ = static_cast<std::uint16_t*>(
+      std::malloc(sizeof(std::uint16_t) * tile_samples_ * std::size_t{n}));
+  slot_state_  = static_cast<SlotState*>(std::malloc(sizeof(SlotState) * n));
+  slot_node_   = static_cast<std::uint32_t*>(std::malloc(4u * n));
+  slot_frame_  = static_cast<std::uint64_t*>(std::malloc(8u * n));
+  slot_pinned_ = static_cast<bool*>(std::malloc(sizeof(bool) * n));
+  slot_ready_  = new (std::nothrow) std::atomic<std::uint8_t>[n];
+  lru_prev_    = static_cast<std::uint32_t*>(std::malloc(4u * n));
+  lru_next_    = static_cast<std::uint32_t*>(std::malloc(4u * n));
+  free_slots_  = static_cast<std::uint32_t*>(std::malloc(4u * n));
+  loading_     = static_cast<std::uint32_t*>(std::malloc(4u * max_loading_));
+  requests_    = static_cast<PendingRequest*>(
+      std::malloc(sizeof(PendingRequest) * max_requests_));
+  if (node_slot_ == nullptr || tiles_ == nullptr || slot_state_ == nullptr ||
+      slot_node_ == nullptr || slot_frame_ == nullptr ||
+      slot_pinned_ == nullptr || slot_ready_ == nullptr ||
+      lru_prev_ == nullptr || lru_next_ == nullptr || free_slots_ == nullptr ||
+      loading_ == nullptr || requests_ == nullptr) {
+    Shutdown();
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "TerrainTileCache: alloc failed");
+  }
+
+  std::fill(node_slot_, node_slot_ + header.node_count, -1);
+  for (std::uint32_t i = 0; i < n; ++i) {
+    slot_state_[i]  = SlotState::kFree;
+    slot_node_[i]   = 0;
+    slot_frame_[i]  = 0;
+    slot_pinned_[i] = false;
+    slot_ready_[i].store(kReadPending, std::memory_order_relaxed);
+    lru_prev_[i]    = kNil;
+    lru_next_[i]    = kNil;
+    free_slots_[i]  = n - 1 - i;  // pop slot 0 first
+  }
+  free_count_     = n;
+  resident_count_ = 0;
+  loading_count_  = 0;
+  request_count_  = 0;
+  lru_head_       = kNil;
+  lru_tail_       = kNil;
+  frame_          = 1;
+  stats_          = TerrainCacheStats{};
+  return NavaryRC::OK();
+}
+
+void TerrainTileCache::Shutdown() {
+  if (async_io_ != nullptr) {
+    if (loading_count_ > 0) {
+      // Reads land in tiles_; they must finish before it is released.
+      async_io_->WaitIdle(jobs_);
+    }
+    async_io_->CloseFile(file_);
+  }
+  std::free(records_);
+  std::free(node_slot_);
+  std::free(tiles_);
+  std::free(slot_state_);
+  std::free(slot_node_);
+  std::free(slot_frame_);
+  std::free(slot_pinned_);
+  delete[] slot_ready_;
+  std::free(lru_prev_);
+  std::free(lru_next_);
+  std::free(free_slots_);
+  std::free(loading_);
+  std::free(requests_);
+  async_io_      = nullptr;
+  jobs_          = nullptr;
+  file_          = io::AsyncFile{};
+  records_       = nullptr;
+  node_slot_     = nullptr;
+  tiles_         = nullptr;
+  slot_state_    = nullptr;
+  slot_node_     = nullptr;
+  slot_frame_    = nullptr;
+  slot_pinned_   = nullptr;
+  slot_ready_    = nullptr;
+  lru_prev_      = nullptr;
+  lru_next_      = nullptr;
+  free_slots_    = nullptr;
+  loading_       = nullptr;
+  requests_      = nullptr;
+  max_slots_     = 0;
+  free_count_    = 0;
+  loading_count_ = 0;
+  request_count_ = 0;
+}
+
+const std::uint16_t* TerrainTileCache::Acquire(std::uint32_t node) {
+  const std::int32_t slot = node_slot_[node];
+  if (slot < 0 || slot_state_[slot] != SlotState::kResident) {
+    return nullptr;
+  }
+  slot_frame_[slot] = frame_;
+  if (!slot_pinned_[slot] && lru_head_ != std::uint32_t(slot)) {
+    LruUnlink(slot);
+    LruPushFront(slot);
+  }
+  return tile(slot);
+}
+
+void TerrainTileCache::Request(std::uint32_t node, float priority) {
+  if (node_slot_[node] >= 0 || request_count_ == max_requests_) {
+    return;
+  }
+  requests_[request_count_++] = PendingRequest{node, priority};
+}
+
+void TerrainTileCache::Update() {
+  if (records_ == nullptr) {
+    return;
+  }
+  async_io_->Drain(jobs_, false);
+  PromoteFinished();
+
+  std::sort(requests_, requests_ + request_count_,
+            [](const PendingRequest& a, const PendingRequest& b) {
+              return a.priority > b.priority;
+            });
+  for (std::uint32_t i = 0;
+       i < request_count_ && loading_count_ < max_loading_; ++i) {
+    const std::uint32_t node = requests_[i].node;
+    if (node_slot_[node] >= 0) {
+      continue;  // duplicate request, already started
+    }
+    const std::int32_t slot = TakeSlot();
+    if (slot < 0) {
+      break;  // every slot is pinned, loading or in use this frame
+    }
+    if (!StartLoad(node, slot).ok()) {
+      free_slots_[free_count_++] = std::uint32_t(slot);
+      break;  // AsyncIo is full; retry next frame
+    }
+  }
+  request_count_ = 0;
+  async_io_->Submit();
+  ++frame_;
+}
+
+NavaryRC TerrainTileCache::LoadBlocking(std::uint32_t node, bool pin) {
+  if (records_ == nullptr || node >= header_.node_count) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "TerrainTileCache: bad node");
+  }
+  std::int32_t slot = node_slot_[node];
+  if (slot >= 0 && slot_state_[slot] == SlotState::kResident) {
+    if (pin && !slot_pinned_[slot]) {
+      LruUnlink(slot);
+      slot_pinned_[slot] = true;
+    }
+    return NavaryRC::OK();
+  }
+  if (slot < 0) {
+    slot = TakeSlot();
+    if (slot < 0) {
+      return NavaryRC(NavaryStatus::kOutOfMemory,
+                      "TerrainTileCache: no evictable slot");
+    }
+    NavaryRC rc = StartLoad(node, slot);
+    if (!rc.ok()) {
+      free_slots_[free_count_++] = std::uint32_t(slot);
+      return rc;
+    }
+  }
+  slot_pinned_[slot] = slot_pinned_[slot] || pin;
+
+  async_io_->Submit();
+  while (slot_state_[slot] == SlotState::kLoading) {
+    async_io_->Drain(jobs_, true);
+    PromoteFinished();
+    if (slot_state_[slot] == SlotState::kLoading &&
+        async_io_->in_flight_count() == 0 &&
+        async_io_->pending_count() == 0) {
+      return NavaryRC(NavaryStatus::kInternal,
+                      "TerrainTileCache: read lost");
+    }
+  }
+  if (node_slot_[node] != slot) {
+    return NavaryRC(NavaryStatus::kIoError,
+                    "TerrainTileCache: tile read failed");
+  }
+  return NavaryRC::OK();
+}
+
+void TerrainTileCache::OnTileRead(const io::AsyncReadResult& result) {
+  auto* self = static_cast<TerrainTileCache*>(result.user_data);
+  self->slot_ready_[result.user_tag].store(
+      result.status == NavaryStatus::kOk ? kReadOk : kReadFailed,
+      std::memory_order_release);
+}
+
+std::int32_t TerrainTileCache::TakeSlot() {
+  if (free_count_ > 0) {
+    return std::int32_t(free_slots_[--free_count_]);
+  }
+  const std::uint32_t victim = lru_tail_;
+  if (victim == kNil || slot_frame_[victim] == frame_) {
+    return -1;
+  }
+  LruUnlink(victim);
+  node_slot_[slot_node_[victim]] = -1;
+  slot_state_[victim]            = SlotState::kFree;
+  --resident_count_;
+  ++stats_.evictions;
+  return std::int32_t(victim);
+}
+
+NavaryRC TerrainTileCache::StartLoad(std::uint32_t node, std::int32_t slot) {
+  io::AsyncReadRequest read{};
+  read.file      = file_;
+  read.offset    = TerrainTileOffset(header_, node);
+  read.size      = tile_samples_ * 2u;
+  read.dst       = mutable_tile(slot);
+  read.callback  = &TerrainTileCache::OnTileRead;
+  read.user_data = this;
+  read.user_tag  = std::uint64_t(slot);
+  slot_ready_[slot].store(kReadPending, std::memory_order_relaxed);
+  NAVARY_RETURN_IF_ERROR(async_io_->Enqueue(read));
+
+  slot_state_[slot]          = SlotState::kLoading;
+  slot_node_[slot]           = node;
+  slot_pinned_[slot]         = false;
+  node_slot_[node]           = slot;
+  loading_[loading_count_++] = std::uint32_t(slot);
+  ++stats_.loads_started;
+  return NavaryRC::OK();
+}
+
+void TerrainTileCache::PromoteFinished() {
+  std::uint32_t i = 0;
+  while (i < loading_count_) {
+    const std::uint32_t slot = loading_[i];
+    const std::uint8_t ready =
+        slot_ready_[slot].load(std::memory_order_acquire);
+    if (ready == kReadPending) {
+      ++i;
+      continue;
+    }
+    loading_[i] = loading_[--loading_count_];
+    if (ready == kReadOk) {
+      slot_state_[slot] = SlotState::kResident;
+      slot_frame_[slot] = frame_;  // not evicted by this Update()
+      ++resident_count_;
+      ++stats_.loads_completed;
+      if (!slot_pinned_[slot]) {
+        LruPushFront(slot);
+      }
+    } else {
+      node_slot_[slot_node_[slot]] = -1;
+      slot_state_[slot]            = SlotState::kFree;
+      slot_pinned_[slot]           = false;
+      free_slots_[free_count_++]   = slot;
+      ++stats_.load_failures;
+    }
+  }
+}
+
+void TerrainTileCache::LruUnlink(std::uint32_t slot) {
+  const std::uint32_t prev = lru_prev_[slot];
+  const std::uint32_t next = lru_next_[slot];
+  (prev == kNil ? lru_head_ : lru_next_[prev]) = next;
+  (next == kNil ? lru_tail_ : lru_prev_[next]) = prev;
+  lru_prev_[slot]                              = kNil;
+  lru_next_[slot]                              = kNil;
+}
+
+void TerrainTileCache::LruPushFront(std::uint32_t slot) {
+  lru_prev_[slot] = kNil;
+  lru_next_[slot] = lru_head_;
+  if (lru_head_ != kNil) {
+    lru_prev_[lru_head_] = slot;
+  } else {
+    lru_tail_ = slot;
+  }
+  lru_head_ = slot;
+}
+
+}  // namespace navary::terrain
@@ -0,0 +1,192 @@
+#pragma once
+// Navary Engine - Terrain Subsystem
+// File: navary/terrain/terrain_tile_cache.h
+// Purpose: Fixed pool of resident height tiles for one .nvtr file, filled
+//          through AsyncIo and recycled least-recently-used first.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Overview:
+//   - Open() reads the header and node table synchronously; tiles are
+//     only read on demand. Each resident tile occupies one slot of a pool
+//     sized at Open(), so memory does not depend on the map size (apart
+//     from the node table and a 4-byte slot index per node).
+//   - Per frame, the owner calls Acquire() for every tile it uses (which
+//     marks the slot used this frame and moves it to the LRU head) and
+//     Request() for tiles it wants, then Update(). Update() promotes
+//     finished reads, then starts the highest-priority requests, taking
+//     free slots first and otherwise evicting from the LRU tail. A slot
+//     used in the current frame is never evicted, so a tile handed out by
+//     Acquire() stays valid until the next Update().
+//   - Pinned tiles (LoadBlocking with pin) are outside the LRU and never
+//     evicted; the terrain pins its coarsest levels so there is always
+//     something to draw and to query.
+//
+// Notes:
+//   - Single owner thread. Read completions may run on job workers; they
+//     only flip a per-slot atomic that Update() picks up.
+//   - Slot indices are stable while a tile is resident, so a renderer can
+//     mirror the pool as a texture array (one layer per slot).
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <atomic>
+#include <cstdint>
+
+#include "navary/io/async_io.h"
+#include "navary/navary_status.h"
+#include "navary/terrain/terrain_format.h"
+
+namespace navary::core::scheduler {
+class JobSystem;
+}  // namespace navary::core::scheduler
+
+namespace navary::terrain {
+
+struct TerrainCacheStats {
+  std::uint64_t loads_started;
+  std::uint64_t loads_completed;
+  std::uint64_t load_failures;
+  std::uint64_t evictions;
+};
+
+class TerrainTileCache {
+ public:
+  struct Desc {
+    io::AsyncIo* async_io             = nullptr;  // required
+    core::scheduler::JobSystem* jobs  = nullptr;  // completion callbacks
+    std::uint32_t max_resident_tiles  = 256;
+    std::uint32_t max_loads_in_flight = 16;
+    std::uint32_t max_requests        = 256;  // per frame, extra dropped
+  };
+
+  TerrainTileCache();
+  ~TerrainTileCache();
+
+  TerrainTileCache(const TerrainTileCache&)            = delete;
+  TerrainTileCache& operator=(const TerrainTileCache&) = delete;
+
+  NavaryRC Open(const char* path, const Desc& desc);
+
+  // Waits for in-flight reads, then releases everything. Safe to call
+  // twice.
+  void Shutdown();
+
+  const TerrainFileHeader& header() const {
+    return header_;
+  }
+  const TerrainNodeRecord& record(std::uint32_t node) const {
+    return records_[node];
+  }
+
+  bool IsResident(std::uint32_t node) const {
+    const std::int32_t slot = node_slot_[node];
+    return slot >= 0 && slot_state_[slot] == SlotState::kResident;
+  }
+
+  // Tile of |node| ((tile_quads + 1)^2 quantized heights) or nullptr when
+  // it is not resident. Acquire() also keeps it resident this frame;
+  // Peek() leaves the LRU untouched (queries).
+  const std::uint16_t* Acquire(std::uint32_t node);
+  const std::uint16_t* Peek(std::uint32_t node) const {
+    return IsResident(node) ? tile(node_slot_[node]) : nullptr;
+  }
+
+  // Pool slot of a resident |node|, -1 otherwise.
+  std::int32_t SlotOf(std::uint32_t node) const {
+    return IsResident(node) ? node_slot_[node] : -1;
+  }
+  const std::uint16_t* tile(std::int32_t slot) const {
+    return tiles_ + std::size_t(slot) * tile_samples_;
+  }
+
+  // Asks for |node| to be loaded; larger |priority| first. No-op when it
+  // is resident or loading.
+  void Request(std::uint32_t node, float priority);
+
+  // Once a frame, after the frame's Acquire / Request calls.
+  void Update();
+
+  // Loads |node| now (blocking on AsyncIo). Pinned tiles are never
+  // evicted; kOutOfMemory when every slot is pinned or in use.
+  NavaryRC LoadBlocking(std::uint32_t node, bool pin);
+
+  std::uint32_t resident_count() const {
+    return resident_count_;
+  }
+  std::uint32_t loads_in_flight() const {
+    return loading_count_;
+  }
+  std::uint32_t max_resident_tiles() const {
+    return max_slots_;
+  }
+  TerrainCacheStats stats() const {
+    return stats_;
+  }
+
+ private:
+  enum class SlotState : std::uint8_t {
+    kFree,
+    kLoading,
+    kResident,
+  };
+
+  struct PendingRequest {
+    std::uint32_t node;
+    float priority;
+  };
+
+  static constexpr std::uint32_t kNil = 0xFFFFFFFFu;
+
+  static void OnTileRead(const io::AsyncReadResult& result);
+
+  // Slot for a new load: free list first, then the LRU tail if it was not
+  // used this frame. -1 when neither.
+  std::int32_t TakeSlot();
+  NavaryRC StartLoad(std::uint32_t node, std::int32_t slot);
+  void PromoteFinished();
+
+  void LruUnlink(std::uint32_t slot);
+  void LruPushFront(std::uint32_t slot);
+
+  std::uint16_t* mutable_tile(std::int32_t slot) {
+    return tiles_ + std::size_t(slot) * tile_samples_;
+  }
+
+  io::AsyncIo* async_io_;
+  core::scheduler::JobSystem* jobs_;
+  io::AsyncFile file_;
+
+  TerrainFileHeader header_;
+  TerrainNodeRecord* records_;
+  std::int32_t* node_slot_;  // per node, -1 when absent
+  std::uint32_t tile_samples_;
+
+  std::uint32_t max_slots_;
+  std::uint16_t* tiles_;
+  SlotState* slot_state_;
+  std::uint32_t* slot_node_;
+  std::uint64_t* slot_frame_;  // last frame the slot was acquired
+  bool* slot_pinned_;
+  std::atomic<std::uint8_t>* slot_ready_;  // 0 pending, 1 ok, 2 failed
+  std::uint32_t* lru_prev_;
+  std::uint32_t* lru_next_;
+  std::uint32_t lru_head_;
+  std::uint32_t lru_tail_;
+  std::uint32_t* free_slots_;
+  std::uint32_t free_count_;
+  std::uint32_t resident_count_;
+
+  std::uint32_t* loading_;  // slots with a read in flight
+  std::uint32_t loading_count_;
+  std::uint32_t max_loading_;
+
+  PendingRequest* requests_;
+  std::uint32_t request_count_;
+  std::uint32_t max_requests_;
+
+  std::uint64_t frame_;
+  TerrainCacheStats stats_;
+};
+
+}  // namespace navary::terrain
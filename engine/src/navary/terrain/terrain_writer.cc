@@ -0,0 +1,176 @@
+// Navary Engine - Terrain Subsystem
+// File: navary/terrain/terrain_writer.cc
+// Purpose: Quantization, node bounds / error and tile decimation for .nvtr.
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include "navary/terrain/terrain_writer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace navary::terrain {
+
+namespace {
+
+bool IsPowerOfTwo(std::uint32_t v) {
+  return v != 0 && (v & (v - 1)) == 0;
+}
+
+// Largest |full - bilinear(tile)| over the full-resolution samples of a
+// node whose tile takes every |stride|-th sample from (ox, oz).
+float NodeDeviation(const std::uint16_t* q, std::uint32_t n, std::uint32_t ox,
+                    std::uint32_t oz, std::uint32_t tile_quads,
+                    std::uint32_t stride) {
+  const std::uint32_t span = tile_quads * stride;
+  const float inv_stride   = 1.0f / static_cast<float>(stride);
+  float worst              = 0.0f;
+  for (std::uint32_t b = 0; b <= span; ++b) {
+    const std::uint32_t j = std::min(b / stride, tile_quads - 1);
+    const float fv        = static_cast<float>(b - j * stride) * inv_stride;
+    const std::uint16_t* r0 = q + (oz + j * stride) * n + ox;
+    const std::uint16_t* r1 = r0 + stride * n;
+    for (std::uint32_t a = 0; a <= span; ++a) {
+      const std::uint32_t i = std::min(a / stride, tile_quads - 1);
+      const float fu        = static_cast<float>(a - i * stride) * inv_stride;
+      const std::uint32_t c = i * stride;
+      const float h0        = r0[c] + (r0[c + stride] - r0[c]) * fu;
+      const float h1        = r1[c] + (r1[c + stride] - r1[c]) * fu;
+      const float h         = h0 + (h1 - h0) * fv;
+      const float full      = q[(oz + b) * n + ox + a];
+      worst                 = std::max(worst, std::fabs(full - h));
+    }
+  }
+  return worst;
+}
+
+}  // namespace
+
+NavaryRC WriteTerrainFile(const char* path, const float* heights,
+                          std::uint32_t samples_per_side,
+                          const TerrainBuildOptions& options) {
+  const std::uint32_t tile_quads = options.tile_quads;
+  if (path == nullptr || heights == nullptr || !IsPowerOfTwo(tile_quads) ||
+      tile_quads < kTerrainMinTileQuads || tile_quads > kTerrainMaxTileQuads ||
+      !(options.sample_spacing > 0.0f) || samples_per_side < 2) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "WriteTerrainFile: invalid arguments");
+  }
+  const std::uint32_t quads = samples_per_side - 1;
+  if (quads % tile_quads != 0 || !IsPowerOfTwo(quads / tile_quads)) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "WriteTerrainFile: size must be (tile_quads << k) + 1");
+  }
+  std::uint32_t max_depth = 0;
+  while ((tile_quads << max_depth) < quads) {
+    ++max_depth;
+  }
+  if (max_depth > kTerrainMaxDepth) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "WriteTerrainFile: map too large for one file");
+  }
+
+  const std::uint32_t n     = samples_per_side;
+  const std::size_t samples = std::size_t{n} * n;
+  const auto [lo_it, hi_it] = std::minmax_element(heights, heights + samples);
+  const float lo            = *lo_it;
+  float scale               = (*hi_it - lo) / 65535.0f;
+  if (!(scale > 0.0f)) {
+    scale = 1.0f / 65535.0f;  // flat map
+  }
+  std::vector<std::uint16_t> q(samples);
+  for (std::size_t i = 0; i < samples; ++i) {
+    const float v = std::round((heights[i] - lo) / scale);
+    q[i]          = static_cast<std::uint16_t>(std::clamp(v, 0.0f, 65535.0f));
+  }
+
+  TerrainFileHeader header{};
+  header.magic          = kTerrainMagic;
+  header.version        = kTerrainVersion;
+  header.max_depth      = max_depth;
+  header.tile_quads     = tile_quads;
+  header.node_count     = TerrainNodeCount(max_depth);
+  header.sample_spacing = options.sample_spacing;
+  header.height_offset  = lo;
+  header.height_scale   = scale;
+
+  std::vector<TerrainNodeRecord> records(header.node_count);
+  for (std::uint32_t d = 0; d <= max_depth; ++d) {
+    const std::uint32_t stride = 1u << (max_depth - d);
+    const std::uint32_t span   = tile_quads * stride;
+    for (std::uint32_t z = 0; z < (1u << d); ++z) {
+      for (std::uint32_t x = 0; x < (1u << d); ++x) {
+        const std::uint32_t ox = x * span;
+        const std::uint32_t oz = z * span;
+        std::uint16_t mn       = 0xFFFF;
+        std::uint16_t mx       = 0;
+        for (std::uint32_t b = 0; b <= span; ++b) {
+          const std::uint16_t* row = q.data() + (oz + b) * n + ox;
+          const auto [r_lo, r_hi]  = std::minmax_element(row, row + span + 1);
+          mn                       = std::min(mn, *r_lo);
+          mx                       = std::max(mx, *r_hi);
+        }
+        TerrainNodeRecord& r = records[TerrainNodeIndex(d, x, z)];
+        r.min_q              = mn;
+        r.max_q              = mx;
+        r.error              = 0.0f;
+        if (stride > 1) {
+          r.error =
+              NodeDeviation(q.data(), n, ox, oz, tile_quads, stride) * scale;
+        }
+      }
+    }
+  }
+  // Parents never claim less error than their children.
+  for (std::uint32_t d = max_depth; d-- > 0;) {
+    for (std::uint32_t z = 0; z < (1u << d); ++z) {
+      for (std::uint32_t x = 0; x < (1u << d); ++x) {
+        TerrainNodeRecord& r = records[TerrainNodeIndex(d, x, z)];
+        for (std::uint32_t c = 0; c < 4; ++c) {
+          const std::uint32_t child =
+              TerrainNodeIndex(d + 1, 2 * x + (c & 1), 2 * z + (c >> 1));
+          r.error = std::max(r.error, records[child].error);
+        }
+      }
+    }
+  }
+
+  std::FILE* f = std::fopen(path, "wb");
+  if (f == nullptr) {
+    return NavaryRC(NavaryStatus::kIoError,
+                    "WriteTerrainFile: cannot open output");
+  }
+  bool ok = std::fwrite(&header, sizeof(header), 1, f) == 1 &&
+            std::fwrite(records.data(), sizeof(TerrainNodeRecord),
+                        records.size(), f) == records.size();
+
+  const std::uint32_t side = tile_quads + 1;
+  std::vector<std::uint16_t> tile(TerrainTileSamples(tile_quads));
+  for (std::uint32_t d = 0; ok && d <= max_depth; ++d) {
+    const std::uint32_t stride = 1u << (max_depth - d);
+    for (std::uint32_t z = 0; ok && z < (1u << d); ++z) {
+      for (std::uint32_t x = 0; ok && x < (1u << d); ++x) {
+        const std::uint32_t ox = x * tile_quads * stride;
+        const std::uint32_t oz = z * tile_quads * stride;
+        for (std::uint32_t j = 0; j < side; ++j) {
+          const std::uint16_t* row = q.data() + (oz + j * stride) * n + ox;
+          for (std::uint32_t i = 0; i < side; ++i) {
+            tile[j * side + i] = row[i * stride];
+          }
+        }
+        ok = std::fwrite(tile.data(), 2, tile.size(), f) == tile.size();
+      }
+    }
+  }
+  const bool closed = std::fclose(f) == 0;
+  if (!ok || !closed) {
+    return NavaryRC(NavaryStatus::kIoError, "WriteTerrainFile: write failed");
+  }
+  return NavaryRC::OK();
+}
+
+}  // namespace navary::terrain
@@ -0,0 +1,30 @@
+#pragma once
+// Navary Engine - Terrain Subsystem
+// File: navary/terrain/terrain_writer.h
+// Purpose: Builds .nvtr heightfield files (tools, cookers and tests).
+// Policy: C++20, Google style, no exceptions, no RTTI, cross-platform.
+//
+// Author:
+// Linggawasistha Djohari              [2025-Present]
+
+#include <cstdint>
+
+#include "navary/navary_status.h"
+#include "navary/terrain/terrain_format.h"
+
+namespace navary::terrain {
+
+struct TerrainBuildOptions {
+  std::uint32_t tile_quads = 64;  // power of two
+  float sample_spacing     = 1.0f;
+};
+
+// |heights| is a row-major (z-major) grid of samples_per_side^2 world
+// heights; samples_per_side must be (tile_quads << k) + 1 for some k up to
+// kTerrainMaxDepth. Tiles are written one at a time, so peak memory is
+// the quantized copy of the input plus one tile.
+NavaryRC WriteTerrainFile(const char* path, const float* heights,
+                          std::uint32_t samples_per_side,
+                          const TerrainBuildOptions& options = {});
+
+}  // namespace navary::terrain
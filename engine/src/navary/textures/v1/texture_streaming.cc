@@ -7,25 +7,178 @@
 
 #include "navary/textures/v1/texture_streaming.h"
 
+#include <cstdlib>
+
 namespace navary::textures::v1 {
 
 TextureStreamingManager::TextureStreamingManager(
     TextureManager* texture_manager)
-    : texture_manager_(texture_manager) {}
+    : texture_manager_(texture_manager),
+      async_io_(nullptr),
+      uploads_(nullptr),
+      jobs_(nullptr),
+      streams_(nullptr),
+      active_(nullptr),
+      free_streams_(nullptr),
+      active_count_(0),
+      free_count_(0),
+      reading_(0),
+      pending_streams_(0),
+      failed_streams_(0) {}
+
+TextureStreamingManager::~TextureStreamingManager() {
+  std::free(streams_);
+  std::free(active_);
+  std::free(free_streams_);
+}
+
+NavaryRC TextureStreamingManager::SetAsyncIo(io::AsyncIo* async_io,
+                                             render::v1::UploadManager* uploads,
+                                             core::scheduler::JobSystem* jobs,
+                                             std::uint32_t max_streams) {
+  if (async_io == nullptr || uploads == nullptr || max_streams == 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "TextureStreamingManager: streaming needs io, uploads "
+                    "and max_streams > 0");
+  }
+  if (active_count_ > 0) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "TextureStreamingManager: streams still pending");
+  }
+
+  std::free(streams_);
+  std::free(active_);
+  std::free(free_streams_);
+  streams_ = static_cast<Stream*>(std::malloc(sizeof(Stream) * max_streams));
+  active_ = static_cast<std::uint32_t*>(
+      std::malloc(sizeof(std::uint32_t) * max_streams));
+  free_streams_ = static_cast<std::uint32_t*>(
+      std::malloc(sizeof(std::uint32_t) * max_streams));
+  if (streams_ == nullptr || active_ == nullptr || free_streams_ == nullptr) {
+    async_io_ = nullptr;
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "TextureStreamingManager: allocation failed");
+  }
+
+  // Pop order hands out low indices first.
+  for (std::uint32_t i = 0; i < max_streams; ++i) {
+    free_streams_[i] = max_streams - 1 - i;
+  }
+  free_count_   = max_streams;
+  active_count_ = 0;
+
+  async_io_ = async_io;
+  uploads_  = uploads;
+  jobs_     = jobs;
+  return NavaryRC::OK();
+}
+
+NavaryRC TextureStreamingManager::StreamTexture(
+    core::TextureHandle handle, const TextureStreamRequest& request) {
+  if (async_io_ == nullptr || texture_manager_ == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "TextureStreamingManager: no async io");
+  }
+  if (texture_manager_->GetTexture(handle) == nullptr) {
+    return NavaryRC(NavaryStatus::kInvalidArgument,
+                    "TextureStreamingManager: bad texture handle");
+  }
+  if (free_count_ == 0) {
+    return NavaryRC(NavaryStatus::kOutOfMemory,
+                    "TextureStreamingManager: too many pending streams");
+  }
+
+  // Over the frame budget this fails with kOutOfMemory; retry next frame.
+  NavaryResult<render::v1::UploadReservation> res_or =
+      uploads_->ReserveTexture(handle, request.mip_level, request.array_layer,
+                               request.width, request.height, request.size);
+  if (!res_or.status().ok()) {
+    return res_or.status();
+  }
+  const render::v1::UploadReservation& reservation = res_or.value();
+
+  const std::uint32_t index = free_streams_[free_count_ - 1];
+
+  io::AsyncReadRequest read{};
+  read.file      = request.file;
+  read.offset    = request.offset;
+  read.size      = request.size;
+  read.dst       = reservation.data;
+  read.callback  = &TextureStreamingManager::OnStreamComplete;
+  read.user_data = this;
+  read.user_tag  = index;
+  // On failure the reservation is still flushed, into a texture that is not
+  // resident; nothing samples it.
+  NAVARY_RETURN_IF_ERROR(async_io_->Enqueue(read));
+
+  --free_count_;
+  Stream& stream = streams_[index];
+  stream.handle  = handle;
+  stream.ticket  = reservation.ticket;
+  stream.state   = StreamState::kReading;
+  active_[active_count_++] = index;
+
+  texture_manager_->SetResident(handle, false);
+  reading_.fetch_add(1, std::memory_order_relaxed);
+  pending_streams_.fetch_add(1, std::memory_order_relaxed);
+  return NavaryRC::OK();
+}
+
+void TextureStreamingManager::OnStreamComplete(
+    const io::AsyncReadResult& result) {
+  auto* self = static_cast<TextureStreamingManager*>(result.user_data);
+  // Each completion owns a distinct stream entry; the owner reads it after
+  // Drain() has joined the callbacks.
+  Stream& stream = self->streams_[result.user_tag];
+  if (result.status == NavaryStatus::kOk) {
+    stream.state = StreamState::kUploading;
+  } else {
+    stream.state = StreamState::kFailed;
+    self->failed_streams_.fetch_add(1, std::memory_order_relaxed);
+  }
+  self->reading_.fetch_sub(1, std::memory_order_release);
+}
 
 void TextureStreamingManager::TouchTexture(core::TextureHandle handle,
                                            std::uint8_t streaming_group,
                                            std::uint8_t streaming_priority) {
   (void)streaming_group;
   (void)streaming_priority;
-  // Simple implementation: keep everything resident whenever touched.
-  if (texture_manager_ != nullptr) {
+  // Without async streaming, keep everything resident whenever touched.
+  // With it, residency follows completed uploads only.
+  if (texture_manager_ != nullptr && async_io_ == nullptr) {
     texture_manager_->SetResident(handle, true);
   }
 }
 
 void TextureStreamingManager::UpdateStreaming() {
-  // Trivial: no eviction yet. This is where you'd implement LRU / priorities.
+  if (async_io_ == nullptr) {
+    return;
+  }
+
+  // This frame's reads target staging that the coming Flush() records, so
+  // they must all have landed before it.
+  while (reading_.load(std::memory_order_acquire) > 0) {
+    async_io_->Submit();
+    async_io_->Drain(jobs_, true);
+  }
+
+  for (std::uint32_t i = 0; i < active_count_;) {
+    const std::uint32_t index = active_[i];
+    Stream& stream            = streams_[index];
+    if (stream.state == StreamState::kUploading &&
+        uploads_->IsComplete(stream.ticket)) {
+      texture_manager_->SetResident(stream.handle, true);
+    } else if (stream.state != StreamState::kFailed) {
+      ++i;
+      continue;
+    }
+
+    active_[i]                   = active_[--active_count_];
+    free_streams_[free_count_++] = index;
+    pending_streams_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  // No eviction yet. This is where you'd implement LRU / priorities.
 }
 
 }  // namespace navary::textures::v1
@@ -7,26 +7,103 @@
 // Author:
 // - Linggawasistha Djohari  [2024-Present]
 
+#include <atomic>
 #include <cstdint>
 
 #include "navary/core/handles.h"
+#include "navary/io/async_io.h"
+#include "navary/navary_status.h"
+#include "navary/render/v1/upload_manager.h"
 #include "navary/textures/v1/texture_manager.h"
 
+namespace navary::core::scheduler {
+class JobSystem;
+}  // namespace navary::core::scheduler
+
 namespace navary::textures::v1 {
 
+// Where a texture's payload lives and which subresource it fills. The
+// payload is one tightly packed mip level; it is read straight into an
+// UploadManager staging reservation.
+struct TextureStreamRequest {
+  io::AsyncFile file;
+  std::uint64_t offset;
+  std::uint32_t size;
+  std::uint32_t mip_level;
+  std::uint32_t array_layer;
+  std::uint32_t width;
+  std::uint32_t height;
+};
+
+// Per frame, in order: UploadManager::BeginFrame(), StreamTexture() calls,
+// UpdateStreaming(), UploadManager::Flush(). A texture becomes resident once
+// the upload ticket of its read has completed.
 class TextureStreamingManager {
  public:
   explicit TextureStreamingManager(TextureManager* texture_manager);
+  ~TextureStreamingManager();
+
+  TextureStreamingManager(const TextureStreamingManager&)            = delete;
+  TextureStreamingManager& operator=(const TextureStreamingManager&) = delete;
+
+  // Enables StreamTexture() with up to |max_streams| textures between
+  // request and residency. |jobs| (optional) runs completion callbacks.
+  NavaryRC SetAsyncIo(io::AsyncIo* async_io, render::v1::UploadManager* uploads,
+                      core::scheduler::JobSystem* jobs,
+                      std::uint32_t max_streams);
+
+  // Marks |handle| non-resident, reserves staging for the payload in the
+  // current upload frame and queues the read into it.
+  NavaryRC StreamTexture(core::TextureHandle handle,
+                         const TextureStreamRequest& request);
 
   // Called every frame when building draw lists to mark textures as used.
   void TouchTexture(core::TextureHandle handle, std::uint8_t streaming_group,
                     std::uint8_t streaming_priority);
 
-  // Called once per frame to update residency; trivial in this version.
+  // Called once per frame before UploadManager::Flush(): submits queued
+  // reads and waits for them (their staging is recorded by that Flush()),
+  // then marks textures whose uploads completed as resident.
   void UpdateStreaming();
 
+  // Textures requested and not yet resident or failed.
+  std::uint32_t pending_streams() const {
+    return pending_streams_.load(std::memory_order_relaxed);
+  }
+  std::uint32_t failed_streams() const {
+    return failed_streams_.load(std::memory_order_relaxed);
+  }
+
  private:
+  enum class StreamState : std::uint8_t {
+    kReading   = 0,
+    kUploading = 1,  // bytes in staging, waiting for the upload ticket
+    kFailed    = 2,
+  };
+
+  struct Stream {
+    core::TextureHandle handle;
+    render::v1::UploadTicket ticket;
+    StreamState state;
+  };
+
+  static void OnStreamComplete(const io::AsyncReadResult& result);
+
   TextureManager* texture_manager_;
+  io::AsyncIo* async_io_;
+  render::v1::UploadManager* uploads_;
+  core::scheduler::JobSystem* jobs_;
+
+  Stream* streams_;
+  std::uint32_t* active_;  // indices into streams_, [0, active_count_)
+  std::uint32_t* free_streams_;
+  std::uint32_t active_count_;
+  std::uint32_t free_count_;
+
+  // Completions may land on job workers.
+  std::atomic<std::uint32_t> reading_;
+  std::atomic<std::uint32_t> pending_streams_;
+  std::atomic<std::uint32_t> failed_streams_;
 };
 
 }  // namespace navary::textures::v1
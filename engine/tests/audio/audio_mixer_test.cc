@@ -0,0 +1,404 @@
+// Navary Engine - Audio Subsystem Tests
+// File: tests/audio/audio_mixer_test.cc
+// Focus: WAV round trips, mixer kernels, voice lifecycle over the command
+//        queue, panning, virtualization, resampling, streaming and an
+//        offline render to a WAV file.
+
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "navary/audio/audio_mixer.h"
+#include "navary/audio/audio_source.h"
+#include "navary/audio/mix_kernels.h"
+#include "navary/audio/wav.h"
+
+using namespace navary;
+using namespace navary::audio;
+
+namespace {
+
+constexpr std::uint32_t kRate = 48000;
+
+std::vector<float> Sine(std::uint32_t frames, float hz, std::uint32_t rate,
+                        float amplitude = 0.5f) {
+  std::vector<float> s(frames);
+  for (std::uint32_t i = 0; i < frames; ++i) {
+    s[i] = amplitude *
+           std::sin(6.2831853f * hz * static_cast<float>(i) /
+                    static_cast<float>(rate));
+  }
+  return s;
+}
+
+std::string TempPath(const char* name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+std::vector<std::uint8_t> ReadFile(const std::string& path) {
+  std::vector<std::uint8_t> bytes;
+  std::FILE* f = std::fopen(path.c_str(), "rb");
+  REQUIRE(f != nullptr);
+  std::uint8_t buf[4096];
+  std::size_t n;
+  while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0) {
+    bytes.insert(bytes.end(), buf, buf + n);
+  }
+  std::fclose(f);
+  return bytes;
+}
+
+// Writes |samples| as a PCM16 WAV and returns the file image.
+std::vector<std::uint8_t> MakeWav(const char* name,
+                                  const std::vector<float>& samples,
+                                  std::uint16_t channels,
+                                  std::uint32_t rate) {
+  const std::string path = TempPath(name);
+  WavWriter w;
+  REQUIRE(w.Open(path.c_str(), rate, channels).ok());
+  REQUIRE(w.Write(samples.data(),
+                  static_cast<std::uint32_t>(samples.size() / channels))
+              .ok());
+  REQUIRE(w.Close().ok());
+  std::vector<std::uint8_t> bytes = ReadFile(path);
+  std::filesystem::remove(path);
+  return bytes;
+}
+
+// Sum of squares of one channel of interleaved stereo.
+double Energy(const std::vector<float>& stereo, int channel) {
+  double e = 0.0;
+  for (std::size_t i = channel; i < stereo.size(); i += 2) {
+    e += static_cast<double>(stereo[i]) * stereo[i];
+  }
+  return e;
+}
+
+AudioMixer::Desc SmallDesc() {
+  AudioMixer::Desc d;
+  d.sample_rate      = kRate;
+  d.max_voices       = 16;
+  d.max_real_voices  = 16;
+  d.max_block_frames = 256;
+  d.command_capacity = 64;
+  return d;
+}
+
+VoiceParams Params2D(float pan = 0.0f) {
+  VoiceParams p;
+  p.spatial = false;
+  p.pan     = pan;
+  return p;
+}
+
+}  // namespace
+
+TEST_CASE("Wav: PCM16 write / parse / decode round trip", "[audio]") {
+  std::vector<float> stereo = {0.0f, 0.5f, -0.5f, 1.0f, 2.0f, -2.0f};
+  const std::vector<std::uint8_t> bytes =
+      MakeWav("navary_audio_roundtrip.wav", stereo, 2, 22050);
+
+  NavaryResult<WavInfo> info_or = ParseWav(bytes.data(), bytes.size());
+  REQUIRE(info_or.status().ok());
+  const WavInfo info = info_or.value();
+  REQUIRE(info.channels == 2);
+  REQUIRE(info.sample_rate == 22050);
+  REQUIRE(info.format == WavSampleFormat::kPcm16);
+  REQUIRE(info.frame_count == 3);
+
+  float out[6];
+  DecodeWavFrames(info, 0, 3, out);
+  REQUIRE(out[0] == 0.0f);
+  REQUIRE(out[1] == Catch::Approx(0.5f).margin(1e-4));
+  REQUIRE(out[2] == Catch::Approx(-0.5f).margin(1e-4));
+  REQUIRE(out[3] == Catch::Approx(1.0f).margin(1e-4));
+  REQUIRE(out[4] == Catch::Approx(1.0f).margin(1e-4));  // clamped
+  REQUIRE(out[5] == Catch::Approx(-1.0f).margin(1e-4));
+
+  const std::uint8_t junk[16] = {'R', 'I', 'F', 'F'};
+  REQUIRE(ParseWav(junk, sizeof(junk)).status().code() ==
+          NavaryStatus::kParseError);
+}
+
+TEST_CASE("Mix kernels: resample, ramp, convert", "[audio]") {
+  const float src[8] = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+  float out[9];
+  ResampleLinear(src, 0.25f, 0.5f, out, 9);
+  for (int i = 0; i < 9; ++i) {
+    REQUIRE(out[i] == Catch::Approx(0.25f + 0.5f * i));
+  }
+  ResampleLinear(src, 2.0f, 1.0f, out, 5);  // integer copy path
+  REQUIRE(out[0] == 2.0f);
+  REQUIRE(out[4] == 6.0f);
+
+  const float ones[7] = {1, 1, 1, 1, 1, 1, 1};
+  float bus[7]        = {};
+  MixRamp(ones, 7, 0.0f, 0.7f, bus);
+  for (int i = 0; i < 7; ++i) {
+    REQUIRE(bus[i] == Catch::Approx(0.1f * (i + 1)));
+  }
+  MixRamp(ones, 7, 0.5f, 0.5f, bus);
+  REQUIRE(bus[6] == Catch::Approx(1.2f));
+
+  const float f[10] = {0.0f, 1.0f, -1.0f, 0.5f, 3.0f,
+                       -3.0f, 0.25f, -0.25f, 1.5f, -1.5f};
+  std::int16_t s[10];
+  FloatToS16(f, 10, s);
+  REQUIRE(s[0] == 0);
+  REQUIRE(s[1] == 32767);
+  REQUIRE(s[2] == -32767);
+  REQUIRE(s[4] == 32767);
+  REQUIRE(s[5] == -32768);
+  REQUIRE(s[8] == 32767);  // scalar tail clamps too
+  REQUIRE(s[9] == -32767);
+}
+
+TEST_CASE("AudioMixer: voice lifecycle and handle generations",
+          "[audio]") {
+  AudioMixer mixer;
+  REQUIRE(mixer.Init(SmallDesc()).ok());
+  AudioClip clip;
+  const std::vector<float> tone = Sine(1000, 440.0f, kRate);
+  REQUIRE(clip.InitFromSamples(tone.data(), 1000, 1, kRate).ok());
+
+  const VoiceHandle v = mixer.Play(&clip, Params2D());
+  REQUIRE(v.valid());
+  REQUIRE(mixer.IsPlaying(v));
+
+  std::vector<float> out(2 * 512);
+  mixer.Mix(out.data(), 512);
+  mixer.Update();
+  REQUIRE(mixer.IsPlaying(v));  // 1000 frames: still going
+  REQUIRE(mixer.real_voice_count() == 1);
+
+  mixer.Mix(out.data(), 512);
+  mixer.Update();
+  REQUIRE_FALSE(mixer.IsPlaying(v));
+  REQUIRE_FALSE(mixer.SetVolume(v, 0.5f));  // stale handle
+
+  // The slot comes back with a new generation.
+  const VoiceHandle w = mixer.Play(&clip, Params2D());
+  REQUIRE(w.valid());
+  REQUIRE((w.id & 0xFFFFu) == (v.id & 0xFFFFu));
+  REQUIRE(w.id != v.id);
+  REQUIRE(mixer.Stop(w));
+  mixer.Mix(out.data(), 64);
+  mixer.Update();
+  REQUIRE_FALSE(mixer.IsPlaying(w));
+
+  REQUIRE_FALSE(mixer.Play(nullptr, Params2D()).valid());
+}
+
+TEST_CASE("AudioMixer: 2D pan and spatial pan", "[audio]") {
+  AudioMixer mixer;
+  REQUIRE(mixer.Init(SmallDesc()).ok());
+  AudioClip clip;
+  const std::vector<float> tone = Sine(48000, 440.0f, kRate);
+  REQUIRE(clip.InitFromSamples(tone.data(), 48000, 1, kRate).ok());
+  std::vector<float> out(2 * 1024);
+
+  VoiceHandle v = mixer.Play(&clip, Params2D(-1.0f));
+  mixer.Mix(out.data(), 1024);
+  REQUIRE(Energy(out, 0) > 10.0);
+  REQUIRE(Energy(out, 1) < 1e-6);
+  mixer.Stop(v);
+  mixer.Mix(out.data(), 256);
+  mixer.Update();
+
+  // Listener at the origin looking down -Z; +X is to the right.
+  REQUIRE(mixer.SetListener(math::Vec3(0, 0, 0), math::Vec3(0, 0, -1),
+                            math::Vec3(0, 1, 0)));
+  VoiceParams p;
+  p.position     = math::Vec3(5.0f, 0.0f, 0.0f);
+  p.min_distance = 1.0f;
+  p.max_distance = 100.0f;
+  v              = mixer.Play(&clip, p);
+  mixer.Mix(out.data(), 1024);
+  const double near_r = Energy(out, 1);
+  REQUIRE(near_r > 1.0);
+  REQUIRE(Energy(out, 0) < near_r * 1e-3);
+
+  // Further away: quieter.
+  REQUIRE(mixer.SetPosition(v, math::Vec3(20.0f, 0.0f, 0.0f)));
+  mixer.Mix(out.data(), 256);  // let the gain ramp settle
+  mixer.Mix(out.data(), 1024);
+  REQUIRE(Energy(out, 1) < near_r * 0.25);
+
+  // Beyond max_distance: silent and virtual.
+  REQUIRE(mixer.SetPosition(v, math::Vec3(500.0f, 0.0f, 0.0f)));
+  mixer.Mix(out.data(), 256);
+  mixer.Mix(out.data(), 1024);
+  REQUIRE(Energy(out, 1) == 0.0);
+  REQUIRE(mixer.real_voice_count() == 0);
+  REQUIRE(mixer.virtual_voice_count() == 1);
+}
+
+TEST_CASE("AudioMixer: priority and distance virtualization", "[audio]") {
+  AudioMixer::Desc d = SmallDesc();
+  d.max_real_voices  = 2;
+  AudioMixer mixer;
+  REQUIRE(mixer.Init(d).ok());
+  AudioClip clip;
+  const std::vector<float> tone = Sine(4800, 440.0f, kRate);
+  REQUIRE(clip.InitFromSamples(tone.data(), 4800, 1, kRate).ok());
+
+  AudioMixer reference;
+  d.max_real_voices = 16;
+  REQUIRE(reference.Init(d).ok());
+
+  VoiceParams p = Params2D();
+  p.loop        = true;
+  p.priority    = 10;
+  mixer.Play(&clip, p);  // loses on priority despite full volume
+  p.priority = 200;
+  mixer.Play(&clip, p);
+  reference.Play(&clip, p);
+  p.volume = 0.2f;  // loses on audibility
+  mixer.Play(&clip, p);
+  p.volume = 0.9f;
+  mixer.Play(&clip, p);
+  reference.Play(&clip, p);
+
+  std::vector<float> out(2 * 256), expected(2 * 256);
+  mixer.Mix(out.data(), 256);
+  reference.Mix(expected.data(), 256);
+  REQUIRE(mixer.real_voice_count() == 2);
+  REQUIRE(mixer.virtual_voice_count() == 2);
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    REQUIRE(out[i] == Catch::Approx(expected[i]).margin(1e-6));
+  }
+}
+
+TEST_CASE("AudioMixer: resampling follows source rate and pitch",
+          "[audio]") {
+  AudioMixer mixer;
+  REQUIRE(mixer.Init(SmallDesc()).ok());
+  AudioClip clip;
+  const std::vector<float> tone = Sine(2400, 220.0f, 24000);
+  REQUIRE(clip.InitFromSamples(tone.data(), 2400, 1, 24000).ok());
+
+  // 100 ms at 24 kHz lasts 4800 output frames at 48 kHz.
+  const VoiceHandle v = mixer.Play(&clip, Params2D());
+  std::vector<float> out(2 * 4700);
+  mixer.Mix(out.data(), 4700);
+  mixer.Update();
+  REQUIRE(mixer.IsPlaying(v));
+  mixer.Mix(out.data(), 200);
+  mixer.Update();
+  REQUIRE_FALSE(mixer.IsPlaying(v));
+
+  // Pitch 2 halves it again.
+  VoiceParams p     = Params2D();
+  p.pitch           = 2.0f;
+  const VoiceHandle w = mixer.Play(&clip, p);
+  mixer.Mix(out.data(), 2300);
+  mixer.Update();
+  REQUIRE(mixer.IsPlaying(w));
+  mixer.Mix(out.data(), 200);
+  mixer.Update();
+  REQUIRE_FALSE(mixer.IsPlaying(w));
+}
+
+TEST_CASE("AudioMixer: streams play like the decoded clip", "[audio]") {
+  const std::vector<float> tone = Sine(6000, 330.0f, 44100, 0.8f);
+  const std::vector<std::uint8_t> wav =
+      MakeWav("navary_audio_stream.wav", tone, 1, 44100);
+
+  AudioClip clip;
+  REQUIRE(clip.LoadWav(wav.data(), wav.size()).ok());
+  AudioStream stream;
+  AudioStream::Desc sd;
+  sd.buffer_frames = 1024;  // several refills over the file
+  REQUIRE(stream.Init(wav.data(), wav.size(), sd).ok());
+  AudioStreamer streamer;
+  streamer.Add(&stream);
+
+  AudioMixer a, b;
+  REQUIRE(a.Init(SmallDesc()).ok());
+  REQUIRE(b.Init(SmallDesc()).ok());
+  const VoiceHandle va = a.Play(&clip, Params2D());
+  const VoiceHandle vb = b.PlayStream(&stream, Params2D());
+  REQUIRE(va.valid());
+  REQUIRE(vb.valid());
+
+  std::vector<float> oa(2 * 256), ob(2 * 256);
+  for (int block = 0; block < 40; ++block) {
+    streamer.Pump();
+    a.Mix(oa.data(), 256);
+    b.Mix(ob.data(), 256);
+    for (std::size_t i = 0; i < oa.size(); ++i) {
+      REQUIRE(ob[i] == Catch::Approx(oa[i]).margin(1e-5));
+    }
+  }
+  a.Update();
+  b.Update();
+  REQUIRE_FALSE(a.IsPlaying(va));
+  REQUIRE_FALSE(b.IsPlaying(vb));
+  REQUIRE(stream.finished());
+}
+
+TEST_CASE("AudioStreamer: background thread fills rings", "[audio]") {
+  const std::vector<float> tone = Sine(20000, 200.0f, kRate);
+  const std::vector<std::uint8_t> wav =
+      MakeWav("navary_audio_thread.wav", tone, 1, kRate);
+  AudioStream stream;
+  REQUIRE(stream.Init(wav.data(), wav.size(), AudioStream::Desc{}).ok());
+
+  AudioStreamer streamer;
+  REQUIRE(streamer.Start(1).ok());
+  streamer.Add(&stream);
+  for (int i = 0; i < 1000 && stream.buffered_frames() == 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  REQUIRE(stream.buffered_frames() > 0);
+  std::vector<float> sink(4096);
+  REQUIRE(stream.Read(sink.data(), 4096) == 4096);
+  streamer.Remove(&stream);
+  streamer.Stop();
+}
+
+TEST_CASE("AudioMixer: offline render to a WAV file", "[audio]") {
+  AudioMixer mixer;
+  REQUIRE(mixer.Init(SmallDesc()).ok());
+  AudioClip clip;
+  const std::vector<float> tone = Sine(kRate, 440.0f, kRate, 0.25f);
+  REQUIRE(clip.InitFromSamples(tone.data(), kRate, 1, kRate).ok());
+  VoiceParams p = Params2D(0.5f);
+  p.loop        = true;
+  mixer.Play(&clip, p);
+
+  const std::string path = TempPath("navary_audio_render.wav");
+  WavWriter writer;
+  REQUIRE(writer.Open(path.c_str(), kRate, 2).ok());
+  std::vector<float> block(2 * 480);
+  for (int i = 0; i < 50; ++i) {  // 0.5 s
+    mixer.Mix(block.data(), 480);
+    REQUIRE(writer.Write(block.data(), 480).ok());
+  }
+  REQUIRE(writer.Close().ok());
+
+  const std::vector<std::uint8_t> bytes = ReadFile(path);
+  std::filesystem::remove(path);
+  NavaryResult<WavInfo> info_or = ParseWav(bytes.data(), bytes.size());
+  REQUIRE(info_or.status().ok());
+  const WavInfo info = info_or.value();
+  REQUIRE(info.channels == 2);
+  REQUIRE(info.frame_count == 24000);
+
+  std::vector<float> decoded(2 * info.frame_count);
+  DecodeWavFrames(info, 0, info.frame_count, decoded.data());
+  const double l = Energy(decoded, 0);
+  const double r = Energy(decoded, 1);
+  REQUIRE(l > 0.0);
+  REQUIRE(r > l);  // panned right
+  // Equal power: L^2 + R^2 carries the source energy.
+  const double src = 24000.0 * 0.25 * 0.25 * 0.5;
+  REQUIRE((l + r) == Catch::Approx(src).epsilon(0.02));
+}
@@ -0,0 +1,211 @@
+// Navary Engine - Benchmark Suite Tests
+// File: tests/bench/bench_compare_test.cc
+// Focus: navary-bench JSON reader, Mann-Whitney p-values (with ties),
+//        bootstrap median-ratio CI and the regression verdict rule.
+
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <vector>
+
+#include "bench_compare.h"
+
+using namespace navary::bench;
+using Catch::Matchers::WithinAbs;
+using Catch::Matchers::WithinRel;
+
+namespace {
+
+// Ten samples around |center| with +-0.4% deterministic jitter.
+std::vector<double> Samples(double center) {
+  static const double kJitter[] = {-0.004, 0.001, 0.003, -0.002, 0.0,
+                                   0.004,  -0.001, 0.002, -0.003, 0.0005};
+  std::vector<double> out;
+  for (double j : kJitter) {
+    out.push_back(center * (1.0 + j));
+  }
+  return out;
+}
+
+BenchRun Run(const char* label,
+             std::vector<std::pair<std::string, std::vector<double>>> series) {
+  BenchRun run;
+  run.label = label;
+  for (auto& [name, samples] : series) {
+    run.benchmarks.push_back(RunSeries{name, 1, std::move(samples)});
+  }
+  return run;
+}
+
+const Comparison& Find(const std::vector<Comparison>& comparisons,
+                       const std::string& name) {
+  for (const Comparison& c : comparisons) {
+    if (c.name == name) {
+      return c;
+    }
+  }
+  FAIL("no comparison for " << name);
+  return comparisons.front();
+}
+
+}  // namespace
+
+TEST_CASE("BenchCompare: parses navary-bench JSON", "[bench][compare]") {
+  const std::string json = R"({
+  "schema": "navary-bench/1",
+  "context": {
+    "label": "abc1 \"main\"",
+    "cpu_model": "Test CPU",
+    "logical_cpus": 8,
+    "governor": "performance",
+    "mhz_before": 3200.5,
+    "future_flag": true,
+    "future_list": [1, {"x": null}],
+    "build": "release"
+  },
+  "benchmarks": [
+    {"name": "memory/Arena::Allocate/64", "threads": 1, "iterations": 10,
+     "ns_per_op": {"min": 1.5, "median": 2, "mean": 2, "stddev": 0.1,
+                   "p90": 2.5, "max": 3},
+     "items_per_second": 5e8,
+     "samples_ns_per_op": [2.0, 1.5e0, 3]},
+    {"name": "math/Mat4::Mul", "threads": 4, "samples_ns_per_op": []}
+  ]
+}
+)";
+  BenchRun run;
+  std::string error;
+  REQUIRE(ParseBenchRun(json, &run, &error));
+  REQUIRE(run.label == "abc1 \"main\"");
+  REQUIRE(run.cpu_model == "Test CPU");
+  REQUIRE(run.governor == "performance");
+  REQUIRE(run.build == "release");
+  REQUIRE(run.benchmarks.size() == 2);
+  REQUIRE(run.benchmarks[0].name == "memory/Arena::Allocate/64");
+  REQUIRE(run.benchmarks[0].threads == 1);
+  REQUIRE(run.benchmarks[0].samples_ns_per_op ==
+          std::vector<double>{2.0, 1.5, 3.0});
+  REQUIRE(run.benchmarks[1].threads == 4);
+  REQUIRE(run.benchmarks[1].samples_ns_per_op.empty());
+
+  REQUIRE_FALSE(ParseBenchRun(R"({"schema": "navary-bench/2"})", &run,
+                              &error));
+  REQUIRE(error.find("unsupported schema") != std::string::npos);
+  REQUIRE_FALSE(ParseBenchRun(R"({"schema": "navary-bench/1", "benchmarks": [)",
+                              &run, &error));
+  REQUIRE_FALSE(error.empty());
+  REQUIRE_FALSE(ParseBenchRun(R"({"schema": "navary-bench/1)", &run, &error));
+}
+
+TEST_CASE("BenchCompare: Mann-Whitney p-values", "[bench][compare]") {
+  // Complete separation, 5 vs 5: U = 0, z = 12 / sqrt(275 / 12).
+  REQUIRE_THAT(MannWhitneyPValue({1, 2, 3, 4, 5}, {6, 7, 8, 9, 10}),
+               WithinAbs(0.0121858, 1e-6));
+  REQUIRE_THAT(MannWhitneyPValue({6, 7, 8, 9, 10}, {1, 2, 3, 4, 5}),
+               WithinAbs(0.0121858, 1e-6));
+
+  // Ties (a 2-group and a 4-group) shrink the variance to 20.9722; without
+  // the correction the p-value would be 0.1437.
+  REQUIRE_THAT(MannWhitneyPValue({1, 2, 2, 3, 3}, {2, 3, 3, 4, 5}),
+               WithinAbs(0.1263794, 1e-6));
+
+  REQUIRE(MannWhitneyPValue({1, 1, 1}, {1, 1, 1}) == 1.0);
+  REQUIRE(MannWhitneyPValue({}, {1, 2}) == 1.0);
+  REQUIRE(MannWhitneyPValue(Samples(100.0), Samples(100.0)) == 1.0);
+}
+
+TEST_CASE("BenchCompare: median and bootstrap ratio CI", "[bench][compare]") {
+  REQUIRE(Median({3, 1, 2}) == 2.0);
+  REQUIRE(Median({4, 1, 3, 2}) == 2.5);
+  REQUIRE(Median({}) == 0.0);
+
+  double lo = 0.0;
+  double hi = 0.0;
+  BootstrapMedianRatioCi({100, 100, 100}, {105, 105, 105}, 500, 1, &lo, &hi);
+  REQUIRE_THAT(lo, WithinRel(1.05, 1e-12));
+  REQUIRE_THAT(hi, WithinRel(1.05, 1e-12));
+
+  const std::vector<double> base = Samples(100.0);
+  const std::vector<double> cur  = Samples(105.0);
+  BootstrapMedianRatioCi(base, cur, 2000, 7, &lo, &hi);
+  REQUIRE(lo > 1.0);
+  REQUIRE(lo <= 1.05);
+  REQUIRE(hi >= 1.05);
+  REQUIRE(hi < 1.1);
+
+  // Fixed seed: identical interval on every run.
+  double lo2 = 0.0;
+  double hi2 = 0.0;
+  BootstrapMedianRatioCi(base, cur, 2000, 7, &lo2, &hi2);
+  REQUIRE(lo2 == lo);
+  REQUIRE(hi2 == hi);
+
+  BootstrapMedianRatioCi({}, cur, 2000, 7, &lo, &hi);
+  REQUIRE(lo == 0.0);
+  REQUIRE(hi == 0.0);
+}
+
+TEST_CASE("BenchCompare: verdict rule", "[bench][compare]") {
+  // Same distribution, samples reordered: noise only.
+  std::vector<double> shuffled = Samples(50.0);
+  std::swap(shuffled[0], shuffled[5]);
+  std::swap(shuffled[2], shuffled[7]);
+
+  const BenchRun baseline =
+      Run("base", {{"memory/slower", Samples(100.0)},
+                   {"memory/faster", Samples(100.0)},
+                   {"math/noise", Samples(50.0)},
+                   {"math/small_shift", Samples(100.0)},
+                   {"math/loose", Samples(100.0)},
+                   {"time/gone", Samples(10.0)}});
+  const BenchRun current =
+      Run("cur", {{"memory/slower", Samples(105.0)},
+                  {"memory/faster", Samples(95.0)},
+                  {"math/noise", shuffled},
+                  {"math/small_shift", Samples(102.0)},
+                  {"math/loose", Samples(105.0)},
+                  {"audio/added", Samples(1.0)}});
+
+  CompareOptions options;
+  options.thresholds.emplace_back("loose", 0.10);
+  const std::vector<Comparison> out = CompareRuns(baseline, current, options);
+  REQUIRE(out.size() == 7);
+
+  const Comparison& slower = Find(out, "memory/slower");
+  REQUIRE(slower.verdict == Verdict::kRegressed);
+  REQUIRE(std::string(VerdictName(slower.verdict)) == "SLOWER");
+  REQUIRE_THAT(slower.ratio, WithinRel(1.05, 1e-9));
+  REQUIRE(slower.p_value < options.alpha);
+  REQUIRE(slower.ratio_lo > 1.0);
+
+  REQUIRE(Find(out, "memory/faster").verdict == Verdict::kImproved);
+
+  const Comparison& noise = Find(out, "math/noise");
+  REQUIRE(noise.verdict == Verdict::kUnchanged);
+  REQUIRE(std::string(VerdictName(noise.verdict)) == "ok");
+  REQUIRE(noise.p_value > 0.5);
+
+  // Significant but inside the 3% default threshold.
+  const Comparison& small = Find(out, "math/small_shift");
+  REQUIRE(small.p_value < options.alpha);
+  REQUIRE(small.verdict == Verdict::kUnchanged);
+
+  // Per-benchmark override raises the bar to 10%.
+  const Comparison& loose = Find(out, "math/loose");
+  REQUIRE(loose.threshold == 0.10);
+  REQUIRE(loose.verdict == Verdict::kUnchanged);
+
+  REQUIRE(Find(out, "time/gone").verdict == Verdict::kMissing);
+  REQUIRE(Find(out, "audio/added").verdict == Verdict::kNew);
+
+  // Report order: memory, math, time, then others alphabetically.
+  REQUIRE(out.front().subsystem == "memory");
+  REQUIRE(out[2].subsystem == "math");
+  REQUIRE(out[5].subsystem == "time");
+  REQUIRE(out.back().subsystem == "audio");
+
+  REQUIRE(CountVerdict(out, Verdict::kRegressed) == 1);
+  const std::string report = FormatReport(baseline, current, out, options);
+  REQUIRE(report.find("1 slower, 1 faster, 3 unchanged, 1 new, 1 missing") !=
+          std::string::npos);
+}
@@ -0,0 +1,263 @@
+// Navary Engine - Effects Subsystem Tests
+// File: tests/effects/particle_emitter_test.cc
+// Focus: ParticleEmitter spawn / expiry accounting, compaction order,
+//        bounds, curve packing and the in-place ring upload with culling.
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "navary/effects/particle_emitter.h"
+#include "navary/math/frustum.h"
+#include "navary/math/mat4.h"
+#include "navary/math/simd4.h"
+#include "navary/render/v1/gpu_ring_buffer.h"
+
+using namespace navary;
+using namespace navary::effects;
+
+namespace {
+
+// Host-memory stand-in for a persistently mapped GPU buffer.
+struct HostRing {
+  std::vector<std::uint8_t> memory;
+  render::v1::GpuRingBuffer ring;
+
+  explicit HostRing(std::size_t bytes) : memory(bytes) {
+    REQUIRE(ring.Init(core::BufferHandle{1}, bytes, memory.data()).ok());
+  }
+};
+
+ParticleEmitter::Desc StillDesc(std::uint32_t max_particles) {
+  ParticleEmitter::Desc d;
+  d.max_particles = max_particles;
+  d.spawn_rate    = 0.0f;
+  d.lifetime_min  = 1.0f;
+  d.lifetime_max  = 1.0f;
+  d.velocity_min  = math::Vec3(0.0f, 0.0f, 0.0f);
+  d.velocity_max  = math::Vec3(0.0f, 0.0f, 0.0f);
+  d.gravity       = math::Vec3(0.0f, 0.0f, 0.0f);
+  return d;
+}
+
+}  // namespace
+
+TEST_CASE("simd4: lane ops match scalar math", "[effects][simd]") {
+  namespace simd = math::simd4;
+  const float a[4] = {1.0f, -2.0f, 3.5f, 0.0f};
+  const float b[4] = {2.0f, 2.0f, -1.0f, 0.0f};
+  float out[4];
+
+  simd::Store(out, simd::MulAdd(simd::Load(a), simd::Load(b),
+                                simd::Splat(1.0f)));
+  REQUIRE(out[0] == 3.0f);
+  REQUIRE(out[1] == -3.0f);
+  REQUIRE(out[2] == -2.5f);
+  REQUIRE(out[3] == 1.0f);
+
+  const simd::F4 lt = simd::CmpLt(simd::Load(a), simd::Load(b));
+  REQUIRE(simd::MoveMask(lt) == 0b0011);
+  simd::Store(out, simd::Select(lt, simd::Load(a), simd::Load(b)));
+  REQUIRE(out[0] == 1.0f);
+  REQUIRE(out[2] == -1.0f);
+  REQUIRE(simd::ReduceMin(simd::Load(a)) == -2.0f);
+  REQUIRE(simd::ReduceMax(simd::Load(a)) == 3.5f);
+
+  std::int32_t ints[4];
+  simd::StoreI(ints, simd::ShiftLeftI<8>(simd::ToInt(simd::Load(a))));
+  REQUIRE(ints[0] == 256);
+  REQUIRE(ints[1] == -512);
+}
+
+TEST_CASE("ParticleCurve: Bezier endpoints and constant", "[effects]") {
+  const ParticleCurve k = ParticleCurve::Bezier(1.0f, 4.0f, -2.0f, 0.5f);
+  REQUIRE(k.Evaluate(0.0f) == Catch::Approx(1.0f));
+  REQUIRE(k.Evaluate(1.0f) == Catch::Approx(0.5f));
+  // B(0.5) = (p0 + 3 p1 + 3 p2 + p3) / 8.
+  REQUIRE(k.Evaluate(0.5f) == Catch::Approx((1.0f + 12.0f - 6.0f + 0.5f) /
+                                            8.0f));
+  REQUIRE(ParticleCurve::Constant(2.0f).Evaluate(0.7f) == 2.0f);
+  REQUIRE(ParticleCurve::Linear(1.0f, 0.0f).Evaluate(0.25f) ==
+          Catch::Approx(0.75f));
+}
+
+TEST_CASE("ParticleEmitter: rejects bad descriptors", "[effects]") {
+  ParticleEmitter e;
+  ParticleEmitter::Desc d = StillDesc(0);
+  REQUIRE(e.Init(d).code() == NavaryStatus::kInvalidArgument);
+  d               = StillDesc(16);
+  d.lifetime_max  = 0.5f;  // below lifetime_min
+  REQUIRE(e.Init(d).code() == NavaryStatus::kInvalidArgument);
+  REQUIRE(e.Init(StillDesc(16)).ok());
+  REQUIRE(e.Init(StillDesc(16)).code() == NavaryStatus::kInvalidArgument);
+}
+
+TEST_CASE("ParticleEmitter: spawn rate and capacity", "[effects]") {
+  ParticleEmitter e;
+  ParticleEmitter::Desc d = StillDesc(100);
+  d.spawn_rate            = 60.0f;
+  d.lifetime_min          = 10.0f;
+  d.lifetime_max          = 10.0f;
+  REQUIRE(e.Init(d).ok());
+
+  // 60 / s at 1/60 s per tick: one per tick once the accumulator settles.
+  for (int i = 0; i < 30; ++i) {
+    e.Update(1.0f / 60.0f);
+  }
+  REQUIRE(e.count() >= 29);
+  REQUIRE(e.count() <= 30);
+
+  REQUIRE(e.Burst(1000) == e.capacity() - e.count());
+  REQUIRE(e.count() == 100);
+  e.Update(1.0f / 60.0f);  // full: new spawns are dropped
+  REQUIRE(e.count() == 100);
+
+  e.Clear();
+  REQUIRE(e.count() == 0);
+  REQUIRE(e.bounds().IsEmpty());
+}
+
+TEST_CASE("ParticleEmitter: expired particles are compacted in order",
+          "[effects]") {
+  ParticleEmitter e;
+  ParticleEmitter::Desc d = StillDesc(64);
+  d.lifetime_min          = 0.5f;
+  d.lifetime_max          = 2.0f;
+  d.spawn_radius          = 10.0f;
+  REQUIRE(e.Init(d).ok());
+  REQUIRE(e.Burst(37) == 37);  // odd count: exercises the scalar tail
+
+  std::vector<float> x_before(e.positions_x(), e.positions_x() + 37);
+  e.Update(0.0f);  // ages stay 0; nothing dies
+  REQUIRE(e.count() == 37);
+
+  e.Update(1.0f);
+  // Survivors: lifetime > 1 s. Particles do not move, so x identifies
+  // them; the survivors must keep their relative order.
+  const std::uint32_t alive = e.count();
+  REQUIRE(alive < 37);
+  REQUIRE(alive > 0);
+  for (std::uint32_t i = 0; i < alive; ++i) {
+    REQUIRE(e.ages()[i] < 1.0f);
+  }
+  std::uint32_t cursor = 0;
+  for (std::uint32_t i = 0; i < alive; ++i) {
+    while (cursor < 37 && x_before[cursor] != e.positions_x()[i]) {
+      ++cursor;
+    }
+    REQUIRE(cursor < 37);
+    ++cursor;
+  }
+
+  e.Update(2.0f);
+  REQUIRE(e.count() == 0);
+  REQUIRE(e.bounds().IsEmpty());
+}
+
+TEST_CASE("ParticleEmitter: motion, bounds and curves", "[effects]") {
+  ParticleEmitter e;
+  ParticleEmitter::Desc d = StillDesc(256);
+  d.position              = math::Vec3(5.0f, 0.0f, 0.0f);
+  d.spawn_radius          = 1.0f;
+  d.velocity_min          = math::Vec3(0.0f, 10.0f, 0.0f);
+  d.velocity_max          = math::Vec3(0.0f, 10.0f, 0.0f);
+  d.gravity               = math::Vec3(0.0f, -10.0f, 0.0f);
+  d.lifetime_min          = 4.0f;
+  d.lifetime_max          = 4.0f;
+  d.size                  = ParticleCurve::Linear(1.0f, 3.0f);
+  d.color_r               = ParticleCurve::Constant(1.0f);
+  d.color_g               = ParticleCurve::Constant(0.0f);
+  d.color_b               = ParticleCurve::Constant(0.5f);
+  d.color_a               = ParticleCurve::Linear(1.0f, 0.0f);
+  REQUIRE(e.Init(d).ok());
+  REQUIRE(e.Burst(203) == 203);
+  std::vector<float> y0(e.positions_y(), e.positions_y() + 203);
+
+  e.Update(0.5f);  // v = 10 - 5 = 5, y += 2.5; age 0.125
+  REQUIRE(e.count() == 203);
+  for (std::uint32_t i = 0; i < e.count(); ++i) {
+    REQUIRE(e.positions_y()[i] == Catch::Approx(y0[i] + 2.5f));
+    REQUIRE(e.ages()[i] == Catch::Approx(0.125f));
+    REQUIRE(e.sizes()[i] == Catch::Approx(1.25f));
+    const std::uint32_t c = e.colors()[i];
+    REQUIRE((c & 0xFFu) == 255u);
+    REQUIRE(((c >> 8) & 0xFFu) == 0u);
+    REQUIRE(((c >> 16) & 0xFFu) == 128u);
+    REQUIRE((c >> 24) == 223u);  // 0.875 * 255 rounded
+
+    const math::Vec3 p(e.positions_x()[i], e.positions_y()[i],
+                       e.positions_z()[i]);
+    REQUIRE(e.bounds().ContainsPoint(p));
+  }
+  // Bounds grow by half the largest size.
+  REQUIRE(e.bounds().min().x >= 4.0f - 0.625f - 1e-4f);
+  REQUIRE(e.bounds().max().x <= 6.0f + 0.625f + 1e-4f);
+}
+
+TEST_CASE("ParticleEmitter: instances written in place", "[effects]") {
+  HostRing host(64 * 1024);
+  ParticleEmitter e;
+  ParticleEmitter::Desc d = StillDesc(64);
+  d.spawn_radius          = 2.0f;
+  REQUIRE(e.Init(d).ok());
+
+  NavaryResult<render::v1::BufferSlice> empty = e.WriteInstances(&host.ring);
+  REQUIRE(empty.status().ok());
+  REQUIRE(empty.value().size == 0);
+  REQUIRE(host.ring.write_head() == 0);
+
+  REQUIRE(e.Burst(21) == 21);
+  e.Update(0.1f);
+  NavaryResult<render::v1::BufferSlice> slice_or =
+      e.WriteInstances(&host.ring);
+  REQUIRE(slice_or.status().ok());
+  const render::v1::BufferSlice slice = slice_or.value();
+  REQUIRE(slice.size == 21 * sizeof(ParticleInstance));
+  REQUIRE(slice.offset % 16 == 0);
+
+  for (std::uint32_t i = 0; i < 21; ++i) {
+    ParticleInstance inst;
+    std::memcpy(&inst,
+                host.memory.data() + slice.offset +
+                    i * sizeof(ParticleInstance),
+                sizeof(inst));
+    REQUIRE(inst.x == e.positions_x()[i]);
+    REQUIRE(inst.y == e.positions_y()[i]);
+    REQUIRE(inst.z == e.positions_z()[i]);
+    REQUIRE(inst.size == e.sizes()[i]);
+    REQUIRE(inst.rgba == e.colors()[i]);
+  }
+
+  REQUIRE(e.WriteInstances(nullptr).status().code() ==
+          NavaryStatus::kInvalidArgument);
+}
+
+TEST_CASE("UploadVisibleEmitters: culls by emitter bounds", "[effects]") {
+  HostRing host(64 * 1024);
+  ParticleEmitter near_e, far_e, empty_e;
+  ParticleEmitter::Desc d = StillDesc(32);
+  d.position              = math::Vec3(0.0f, 0.0f, -10.0f);
+  REQUIRE(near_e.Init(d).ok());
+  d.position = math::Vec3(100.0f, 0.0f, -10.0f);
+  REQUIRE(far_e.Init(d).ok());
+  REQUIRE(empty_e.Init(d).ok());
+  near_e.Burst(8);
+  far_e.Burst(8);
+  near_e.Update(0.0f);
+  far_e.Update(0.0f);
+
+  // Looks down -Z through a 20 x 20 window.
+  const math::Frustum frustum = math::Frustum::FromClipMatrix(
+      math::Mat4::OrthoRH(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 100.0f));
+  const ParticleEmitter* emitters[3] = {&far_e, &empty_e, &near_e};
+  ParticleDraw draws[3];
+  NavaryResult<std::uint32_t> n_or =
+      UploadVisibleEmitters(emitters, 3, frustum, &host.ring, draws);
+  REQUIRE(n_or.status().ok());
+  REQUIRE(n_or.value() == 1);
+  REQUIRE(draws[0].emitter_index == 2);
+  REQUIRE(draws[0].instance_count == 8);
+  REQUIRE(draws[0].slice.size == 8 * sizeof(ParticleInstance));
+}
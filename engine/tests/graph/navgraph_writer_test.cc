@@ -0,0 +1,254 @@
+// Navary Engine - Shader Graph Tests
+// File: tests/graph/navgraph_writer_test.cc
+// Focus: NavGraphWriter validation, pruning, merging, ordering and param
+//        packing, checked through NavGraphLoader round trips.
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "navary/graph/shader/navgraph_loader.h"
+#include "navary/graph/shader/navgraph_writer.h"
+
+using namespace navary;
+using namespace navary::graph::shader;
+using navary::core::SurfaceModel;
+
+namespace {
+
+constexpr ValueTypeBinary kF1 = ValueTypeBinary::kFloat1;
+constexpr ValueTypeBinary kF2 = ValueTypeBinary::kFloat2;
+constexpr ValueTypeBinary kF3 = ValueTypeBinary::kFloat3;
+constexpr ValueTypeBinary kF4 = ValueTypeBinary::kFloat4;
+
+NavGraphNodeDesc MakeNode(std::uint32_t id, NodeKind kind,
+                          std::initializer_list<ValueTypeBinary> inputs,
+                          std::initializer_list<ValueTypeBinary> outputs,
+                          const float* params = nullptr,
+                          std::uint16_t param_count = 0) {
+  NavGraphNodeDesc d{};
+  d.id           = id;
+  d.kind         = kind;
+  d.input_count  = static_cast<std::uint8_t>(inputs.size());
+  d.output_count = static_cast<std::uint8_t>(outputs.size());
+  std::uint32_t i = 0;
+  for (ValueTypeBinary t : inputs) {
+    d.input_types[i++] = t;
+  }
+  i = 0;
+  for (ValueTypeBinary t : outputs) {
+    d.output_types[i++] = t;
+  }
+  d.params      = params;
+  d.param_count = param_count;
+  return d;
+}
+
+NavGraphNodeDesc Surface(std::uint32_t id) {
+  return MakeNode(id, NodeKind::kMakeSurface, {kF4, kF3, kF1, kF1}, {});
+}
+
+NavaryRC Link(NavGraphWriter* w, std::uint32_t from, std::uint8_t out,
+              std::uint32_t to, std::uint8_t in) {
+  return w->AddLink(NavGraphLinkDesc{from, out, to, in});
+}
+
+const float kColor[4] = {1.0f, 0.5f, 0.25f, 1.0f};
+const float kHalf[1]  = {0.5f};
+const float kOther[1] = {0.9f};
+
+// Base color constant, two identical constants feeding two identical
+// multiplies (roughness / metallic) and one constant nobody reads.
+void AddSampleGraph(NavGraphWriter* w, bool reversed) {
+  const NavGraphNodeDesc nodes[] = {
+      MakeNode(10, NodeKind::kConstFloat4, {}, {kF4}, kColor, 4),
+      MakeNode(20, NodeKind::kConstFloat, {}, {kF1}, kHalf, 1),
+      MakeNode(30, NodeKind::kConstFloat, {}, {kF1}, kHalf, 1),
+      MakeNode(40, NodeKind::kConstFloat, {}, {kF1}, kOther, 1),
+      MakeNode(50, NodeKind::kMultiply, {kF1, kF1}, {kF1}),
+      MakeNode(60, NodeKind::kMultiply, {kF1, kF1}, {kF1}),
+      Surface(70),
+  };
+  const std::uint32_t n = sizeof(nodes) / sizeof(nodes[0]);
+  for (std::uint32_t i = 0; i < n; ++i) {
+    REQUIRE(w->AddNode(nodes[reversed ? n - 1 - i : i]).ok());
+  }
+  REQUIRE(Link(w, 20, 0, 50, 0).ok());
+  REQUIRE(Link(w, 20, 0, 50, 1).ok());
+  REQUIRE(Link(w, 30, 0, 60, 0).ok());
+  REQUIRE(Link(w, 30, 0, 60, 1).ok());
+  REQUIRE(Link(w, 10, 0, 70, 0).ok());
+  REQUIRE(Link(w, 50, 0, 70, 2).ok());
+  REQUIRE(Link(w, 60, 0, 70, 3).ok());
+}
+
+}  // namespace
+
+TEST_CASE("NavGraphWriter: prunes, merges and loads without fix-up",
+          "[graph]") {
+  NavGraphWriter writer(SurfaceModel::kLitePbr);
+  AddSampleGraph(&writer, false);
+
+  std::vector<std::uint8_t> bytes;
+  NavGraphWriteStats stats{};
+  REQUIRE(writer.Build(&bytes, &stats).ok());
+  REQUIRE(stats.source_nodes == 7);
+  REQUIRE(stats.pruned_nodes == 1);   // const 40
+  REQUIRE(stats.merged_nodes == 2);   // const 30, multiply 60
+  REQUIRE(stats.emitted_nodes == 4);  // color, half, multiply, surface
+  REQUIRE(stats.param_floats == 5);
+
+  GraphIr ir{};
+  NavGraphLoader loader;
+  REQUIRE(loader.LoadFromMemory(bytes.data(),
+                                static_cast<std::uint32_t>(bytes.size()), &ir)
+              .ok());
+  REQUIRE(ir.node_count == 4);
+  REQUIRE(ir.param_value_count == 5);
+  REQUIRE(ir.surface_model == SurfaceModel::kLitePbr);
+
+  // Dense ids, sources before consumers, and every input link pointing at
+  // an output pin of an earlier node.
+  for (std::uint32_t i = 0; i < ir.node_count; ++i) {
+    const Node& node = ir.nodes[i];
+    REQUIRE(node.id.index == i);
+    for (std::uint32_t j = 0; j < node.input_count && j < 4; ++j) {
+      const Pin& pin = ir.pins[node.inputs[j].index];
+      REQUIRE(!pin.is_output);
+      REQUIRE(pin.node.index == i);
+      if (pin.link.index == 0xFFFFFFFFu) {
+        continue;
+      }
+      const Pin& src = ir.pins[pin.link.index];
+      REQUIRE(src.is_output);
+      REQUIRE(src.node.index < i);
+      REQUIRE(src.type == pin.type);
+    }
+  }
+
+  const Node& surface = ir.nodes[3];
+  REQUIRE(surface.op == NodeOp::kMakeSurface);
+  REQUIRE(ir.pins[surface.inputs[1].index].link.index == 0xFFFFFFFFu);
+  // Roughness and metallic both read the single merged multiply.
+  REQUIRE(ir.pins[surface.inputs[2].index].link.index ==
+          ir.pins[surface.inputs[3].index].link.index);
+
+  NavGraphLoader::Release(&ir);
+}
+
+TEST_CASE("NavGraphWriter: output does not depend on insertion order",
+          "[graph]") {
+  NavGraphWriter a(SurfaceModel::kLitePbr);
+  NavGraphWriter b(SurfaceModel::kLitePbr);
+  AddSampleGraph(&a, false);
+  AddSampleGraph(&b, true);
+
+  std::vector<std::uint8_t> bytes_a;
+  std::vector<std::uint8_t> bytes_b;
+  REQUIRE(a.Build(&bytes_a).ok());
+  REQUIRE(b.Build(&bytes_b).ok());
+  REQUIRE(bytes_a == bytes_b);
+}
+
+TEST_CASE("NavGraphWriter: shares identical param runs", "[graph]") {
+  // Two samples of texture slot 0 with different UVs stay separate nodes
+  // but point at the same packed slot value.
+  const float slot[1] = {0.0f};
+  const float uv_a[2] = {0.0f, 0.0f};
+  const float uv_b[2] = {0.5f, 0.5f};
+
+  NavGraphWriter w(SurfaceModel::kLitePbr);
+  REQUIRE(w.AddNode(MakeNode(1, NodeKind::kConstFloat2, {}, {kF2}, uv_a, 2))
+              .ok());
+  REQUIRE(w.AddNode(MakeNode(2, NodeKind::kConstFloat2, {}, {kF2}, uv_b, 2))
+              .ok());
+  REQUIRE(w.AddNode(MakeNode(3, NodeKind::kTextureSample2D, {kF2}, {kF4},
+                             slot, 1))
+              .ok());
+  REQUIRE(w.AddNode(MakeNode(4, NodeKind::kTextureSample2D, {kF2}, {kF4},
+                             slot, 1))
+              .ok());
+  REQUIRE(w.AddNode(MakeNode(5, NodeKind::kMultiply, {kF4, kF4}, {kF4})).ok());
+  REQUIRE(w.AddNode(Surface(6)).ok());
+  REQUIRE(Link(&w, 1, 0, 3, 0).ok());
+  REQUIRE(Link(&w, 2, 0, 4, 0).ok());
+  REQUIRE(Link(&w, 3, 0, 5, 0).ok());
+  REQUIRE(Link(&w, 4, 0, 5, 1).ok());
+  REQUIRE(Link(&w, 5, 0, 6, 0).ok());
+
+  std::vector<std::uint8_t> bytes;
+  NavGraphWriteStats stats{};
+  REQUIRE(w.Build(&bytes, &stats).ok());
+  REQUIRE(stats.merged_nodes == 0);
+  REQUIRE(stats.emitted_nodes == 6);
+  REQUIRE(stats.param_floats == 5);  // uv_a, uv_b, slot
+  REQUIRE(stats.shared_param_floats == 1);
+
+  GraphIr ir{};
+  NavGraphLoader loader;
+  REQUIRE(loader.LoadFromMemory(bytes.data(),
+                                static_cast<std::uint32_t>(bytes.size()), &ir)
+              .ok());
+  std::uint32_t samples = 0;
+  std::uint16_t offset  = 0xFFFF;
+  for (std::uint32_t i = 0; i < ir.node_count; ++i) {
+    if (ir.nodes[i].op == NodeOp::kTextureSample2D) {
+      REQUIRE((offset == 0xFFFF || offset == ir.nodes[i].param_offset));
+      offset = ir.nodes[i].param_offset;
+      ++samples;
+    }
+  }
+  REQUIRE(samples == 2);
+  NavGraphLoader::Release(&ir);
+}
+
+TEST_CASE("NavGraphWriter: validates against node metadata", "[graph]") {
+  NavGraphWriter w(SurfaceModel::kLitePbr);
+
+  REQUIRE(w.AddNode(MakeNode(1, static_cast<NodeKind>(99), {}, {kF1}))
+              .code() == NavaryStatus::kInvalidArgument);
+  // ConstFloat carries exactly one float.
+  REQUIRE(w.AddNode(MakeNode(1, NodeKind::kConstFloat, {}, {kF1})).code() ==
+          NavaryStatus::kInvalidArgument);
+  // Multiply takes two inputs.
+  REQUIRE(w.AddNode(MakeNode(1, NodeKind::kMultiply, {kF1}, {kF1})).code() ==
+          NavaryStatus::kInvalidArgument);
+
+  REQUIRE(w.AddNode(MakeNode(1, NodeKind::kConstFloat, {}, {kF1}, kHalf, 1))
+              .ok());
+  REQUIRE(w.AddNode(MakeNode(1, NodeKind::kConstFloat, {}, {kF1}, kHalf, 1))
+              .code() == NavaryStatus::kInvalidArgument);
+  REQUIRE(w.AddNode(Surface(2)).ok());
+
+  std::vector<std::uint8_t> bytes;
+  REQUIRE(Link(&w, 1, 0, 2, 0).code() == NavaryStatus::kInvalidArgument);
+  REQUIRE(Link(&w, 1, 0, 9, 2).code() == NavaryStatus::kNotFound);
+  REQUIRE(Link(&w, 1, 1, 2, 2).code() == NavaryStatus::kInvalidArgument);
+  REQUIRE(Link(&w, 1, 0, 2, 2).ok());
+  REQUIRE(Link(&w, 1, 0, 2, 2).code() == NavaryStatus::kInvalidArgument);
+  REQUIRE(w.Build(&bytes).ok());
+
+  REQUIRE(w.AddNode(Surface(3)).ok());
+  REQUIRE(w.Build(&bytes).code() == NavaryStatus::kInvalidArgument);
+
+  w.Clear();
+  REQUIRE(w.Build(&bytes).code() == NavaryStatus::kInvalidArgument);
+}
+
+TEST_CASE("NavGraphWriter: rejects cycles feeding the surface", "[graph]") {
+  NavGraphWriter w(SurfaceModel::kLitePbr);
+  REQUIRE(w.AddNode(MakeNode(1, NodeKind::kConstFloat, {}, {kF1}, kHalf, 1))
+              .ok());
+  REQUIRE(w.AddNode(MakeNode(2, NodeKind::kMultiply, {kF1, kF1}, {kF1})).ok());
+  REQUIRE(w.AddNode(MakeNode(3, NodeKind::kMultiply, {kF1, kF1}, {kF1})).ok());
+  REQUIRE(w.AddNode(Surface(4)).ok());
+  REQUIRE(Link(&w, 1, 0, 2, 0).ok());
+  REQUIRE(Link(&w, 3, 0, 2, 1).ok());
+  REQUIRE(Link(&w, 2, 0, 3, 0).ok());
+  REQUIRE(Link(&w, 1, 0, 3, 1).ok());
+  REQUIRE(Link(&w, 3, 0, 4, 2).ok());
+
+  std::vector<std::uint8_t> bytes;
+  REQUIRE(w.Build(&bytes).code() == NavaryStatus::kInvalidArgument);
+}
@@ -0,0 +1,332 @@
+// Navary Engine - IO Subsystem Tests
+// File: tests/io/async_io_test.cc
+// Focus: AsyncIo backends, batching, job-drained completions, VFS and
+//        texture streaming integration.
+
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "navary/core/scheduler/job_system.h"
+#include "navary/io/async_io.h"
+#include "navary/io/pack_writer.h"
+#include "navary/io/vfs.h"
+#include "navary/render/v1/upload_manager.h"
+#include "navary/textures/v1/texture_manager.h"
+#include "navary/textures/v1/texture_streaming.h"
+
+using namespace navary;
+using namespace navary::io;
+
+namespace {
+
+std::uint8_t PatternByte(std::uint64_t offset) {
+  return static_cast<std::uint8_t>((offset * 131u) ^ (offset >> 8));
+}
+
+// Keeps the staging bytes of each texture copy, as the GPU would see them.
+class StagingCapture : public render::v1::UploadBackend {
+ public:
+  StagingCapture(const std::uint8_t* staging, std::size_t level_size)
+      : staging_(staging), level_size_(level_size) {}
+
+  NavaryRC CopyBufferRegions(core::BufferHandle, core::BufferHandle,
+                             const render::v1::BufferCopyRegion*,
+                             std::uint32_t) override {
+    return NavaryRC::OK();
+  }
+
+  NavaryRC CopyTextureRegions(core::BufferHandle, core::TextureHandle,
+                              const render::v1::TextureCopyRegion* regions,
+                              std::uint32_t count) override {
+    for (std::uint32_t i = 0; i < count; ++i) {
+      const std::uint8_t* src = staging_ + regions[i].src_offset;
+      texels.insert(texels.end(), src, src + level_size_);
+    }
+    return NavaryRC::OK();
+  }
+
+  std::vector<std::uint8_t> texels;
+
+ private:
+  const std::uint8_t* staging_;
+  std::size_t level_size_;
+};
+
+std::string WritePatternFile(const char* name, std::uint32_t size) {
+  const std::filesystem::path path =
+      std::filesystem::temp_directory_path() / name;
+  std::vector<std::uint8_t> bytes(size);
+  for (std::uint32_t i = 0; i < size; ++i) {
+    bytes[i] = PatternByte(i);
+  }
+  std::FILE* f = std::fopen(path.string().c_str(), "wb");
+  REQUIRE(f != nullptr);
+  REQUIRE(std::fwrite(bytes.data(), 1, bytes.size(), f) == bytes.size());
+  std::fclose(f);
+  return path.string();
+}
+
+// io_uring is often blocked in containers; report and skip in that case.
+bool InitBackend(AsyncIo* io, AsyncIoBackendKind kind,
+                 std::uint32_t max_requests) {
+  AsyncIoDesc desc;
+  desc.backend      = kind;
+  desc.max_requests = max_requests;
+  desc.worker_count = 4;
+  NavaryRC rc       = io->Init(desc);
+  if (!rc.ok() && kind == AsyncIoBackendKind::kIoUring) {
+    WARN("io_uring unavailable, skipping");
+    return false;
+  }
+  REQUIRE(rc.ok());
+  return true;
+}
+
+struct ReadCheck {
+  std::atomic<std::uint32_t> done{0};
+  std::atomic<std::uint32_t> bad{0};
+};
+
+void CheckPattern(const AsyncReadResult& r) {
+  auto* check     = static_cast<ReadCheck*>(r.user_data);
+  const auto* dst = static_cast<const std::uint8_t*>(r.dst);
+  bool ok         = r.status == NavaryStatus::kOk;
+  for (std::uint32_t i = 0; ok && i < r.bytes_read; ++i) {
+    ok = dst[i] == PatternByte(r.user_tag + i);
+  }
+  if (!ok) {
+    check->bad.fetch_add(1);
+  }
+  check->done.fetch_add(1);
+}
+
+void RunPatternReads(AsyncIoBackendKind kind) {
+  constexpr std::uint32_t kFileSize = 1u << 20;
+  constexpr std::uint32_t kReads    = 512;
+  constexpr std::uint32_t kReadSize = 1000;
+
+  const std::string path = WritePatternFile("navary_async_io.bin", kFileSize);
+
+  core::scheduler::JobSystem jobs;
+  REQUIRE(jobs.Init(3).ok());
+
+  AsyncIo io;
+  if (!InitBackend(&io, kind, 128)) {
+    return;
+  }
+  REQUIRE(io.backend_kind() == kind);
+
+  auto file = io.OpenFile(path.c_str());
+  REQUIRE(file.status().ok());
+
+  std::vector<std::uint8_t> staging(kReads * kReadSize);
+  ReadCheck check;
+  std::uint32_t queued = 0;
+  while (check.done.load() < kReads) {
+    // Keep the queue full; Enqueue reports kOutOfMemory when it is.
+    while (queued < kReads) {
+      AsyncReadRequest rq{};
+      rq.file      = file.value();
+      rq.offset    = (queued * 7919ull) % (kFileSize - kReadSize);
+      rq.size      = kReadSize;
+      rq.dst       = staging.data() + queued * kReadSize;
+      rq.callback  = &CheckPattern;
+      rq.user_data = &check;
+      rq.user_tag  = rq.offset;
+      if (!io.Enqueue(rq).ok()) {
+        break;
+      }
+      ++queued;
+    }
+    io.Submit();
+    io.Drain(&jobs, true);
+  }
+
+  REQUIRE(check.bad.load() == 0);
+  const AsyncIoStats stats = io.stats();
+  REQUIRE(stats.enqueued == kReads);
+  REQUIRE(stats.completed == kReads);
+  REQUIRE(stats.failed == 0);
+  REQUIRE(stats.bytes_read == std::uint64_t{kReads} * kReadSize);
+  REQUIRE(stats.batches < kReads);
+
+  io.CloseFile(file.value());
+  io.Shutdown();
+  jobs.Shutdown();
+  std::filesystem::remove(path);
+}
+
+}  // namespace
+
+TEST_CASE("AsyncIo: thread-pool backend reads the right bytes", "[io][async]") {
+  RunPatternReads(AsyncIoBackendKind::kThreadPool);
+}
+
+TEST_CASE("AsyncIo: io_uring backend reads the right bytes", "[io][async]") {
+  RunPatternReads(AsyncIoBackendKind::kIoUring);
+}
+
+TEST_CASE("AsyncIo: short reads fail and the queue is bounded",
+          "[io][async]") {
+  const std::string path = WritePatternFile("navary_async_short.bin", 100);
+
+  AsyncIo io;
+  InitBackend(&io, AsyncIoBackendKind::kAuto, 2);
+  auto file = io.OpenFile(path.c_str());
+  REQUIRE(file.status().ok());
+  REQUIRE(io.OpenFile("/definitely/not/here.bin").status().code() ==
+          NavaryStatus::kNotFound);
+
+  std::uint8_t buffer[64];
+  ReadCheck check;
+  AsyncReadRequest rq{};
+  rq.file      = file.value();
+  rq.offset    = 80;
+  rq.size      = 64;
+  rq.dst       = buffer;
+  rq.callback  = &CheckPattern;
+  rq.user_data = &check;
+  rq.user_tag  = 80;
+  REQUIRE(io.Enqueue(rq).ok());
+  REQUIRE(io.Enqueue(rq).ok());
+  REQUIRE(io.Enqueue(rq).code() == NavaryStatus::kOutOfMemory);
+  REQUIRE(io.pending_count() == 2);
+
+  io.WaitIdle(nullptr);
+  REQUIRE(check.done.load() == 2);
+  REQUIRE(check.bad.load() == 2);  // kIoError: only 20 bytes exist
+  REQUIRE(io.stats().failed == 2);
+  REQUIRE(io.stats().bytes_read == 40);
+
+  io.CloseFile(file.value());
+  io.Shutdown();
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("AsyncIo: Shutdown fails reads that were never submitted",
+          "[io][async]") {
+  const std::string path = WritePatternFile("navary_async_cancel.bin", 4096);
+
+  AsyncIo io;
+  InitBackend(&io, AsyncIoBackendKind::kAuto, 8);
+  auto file = io.OpenFile(path.c_str());
+  REQUIRE(file.status().ok());
+
+  std::uint8_t buffer[3][256];
+  ReadCheck check;
+  for (std::uint32_t i = 0; i < 3; ++i) {
+    AsyncReadRequest rq{};
+    rq.file      = file.value();
+    rq.offset    = i * 256;
+    rq.size      = 256;
+    rq.dst       = buffer[i];
+    rq.callback  = &CheckPattern;
+    rq.user_data = &check;
+    rq.user_tag  = rq.offset;
+    REQUIRE(io.Enqueue(rq).ok());
+    if (i == 0) {
+      REQUIRE(io.Submit() == 1);
+    }
+  }
+  REQUIRE(io.pending_count() == 2);
+
+  io.Shutdown();
+  REQUIRE(check.done.load() == 3);
+  REQUIRE(check.bad.load() == 2);  // the two that never left the queue
+  REQUIRE(io.stats().completed == 3);
+  REQUIRE(io.stats().failed == 2);
+  REQUIRE(io.stats().bytes_read == 256);
+
+  io.CloseFile(file.value());
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("AsyncIo: streams VFS pack entries and textures", "[io][async]") {
+  const std::filesystem::path pack_path =
+      std::filesystem::temp_directory_path() / "navary_async_stream.nvpk";
+  std::vector<std::uint8_t> texels(4096);
+  for (std::size_t i = 0; i < texels.size(); ++i) {
+    texels[i] = static_cast<std::uint8_t>(i * 3);
+  }
+  PackWriter writer;
+  REQUIRE(writer
+              .AddFile("textures/rock.bin",
+                       memory::Span<const std::uint8_t>(texels.data(),
+                                                        texels.size()))
+              .ok());
+  REQUIRE(writer.WriteToFile(pack_path.string().c_str()).ok());
+
+  Vfs vfs;
+  REQUIRE(vfs.Init().ok());
+  REQUIRE(vfs.MountPack(pack_path.string().c_str()).status().ok());
+  VfsLocation where;
+  REQUIRE(vfs.Locate("textures/rock.bin", &where).ok());
+  REQUIRE(where.size == texels.size());
+  REQUIRE(vfs.Locate("textures/none.bin", &where).code() ==
+          NavaryStatus::kNotFound);
+
+  textures::v1::TextureManager textures;
+  REQUIRE(textures.Init(8).ok());
+  auto handle = textures.RegisterTexture(32, 32, 1);
+  REQUIRE(handle.status().ok());
+
+  AsyncIo io;
+  InitBackend(&io, AsyncIoBackendKind::kAuto, 16);
+  auto file = io.OpenFile(where.file_path.c_str());
+  REQUIRE(file.status().ok());
+
+  std::vector<std::uint8_t> staging(1 << 16);
+  render::v1::UploadManagerDesc upload_desc{};
+  upload_desc.staging_buffer       = core::BufferHandle{0};
+  upload_desc.staging_mapped       = staging.data();
+  upload_desc.staging_size         = staging.size();
+  upload_desc.max_requests         = 16;
+  upload_desc.max_frames_in_flight = 2;
+  render::v1::UploadManager uploads;
+  REQUIRE(uploads.Init(upload_desc).ok());
+  uploads.BeginFrame(1);
+
+  textures::v1::TextureStreamingManager streaming(&textures);
+  REQUIRE(streaming.SetAsyncIo(&io, &uploads, nullptr, 4).ok());
+  textures::v1::TextureStreamRequest rq{};
+  rq.file   = file.value();
+  rq.offset = where.offset;
+  rq.size   = static_cast<std::uint32_t>(where.size);
+  rq.width  = 32;
+  rq.height = 32;
+  REQUIRE(streaming.StreamTexture(handle.value(), rq).ok());
+  REQUIRE_FALSE(textures.GetTexture(handle.value())->is_resident);
+
+  streaming.TouchTexture(handle.value(), 0, 0);
+  REQUIRE_FALSE(textures.GetTexture(handle.value())->is_resident);
+
+  // The read lands in staging, but the texture waits for its upload.
+  streaming.UpdateStreaming();
+  REQUIRE(streaming.failed_streams() == 0);
+  REQUIRE(streaming.pending_streams() == 1);
+  REQUIRE_FALSE(textures.GetTexture(handle.value())->is_resident);
+
+  StagingCapture backend(staging.data(), texels.size());
+  REQUIRE(uploads.Flush(&backend).ok());
+  REQUIRE(backend.texels == texels);
+
+  uploads.BeginFrame(2);
+  streaming.UpdateStreaming();
+  REQUIRE_FALSE(textures.GetTexture(handle.value())->is_resident);
+
+  uploads.NotifyFrameComplete(1);
+  streaming.UpdateStreaming();
+  REQUIRE(streaming.pending_streams() == 0);
+  REQUIRE(textures.GetTexture(handle.value())->is_resident);
+
+  io.CloseFile(file.value());
+  io.Shutdown();
+  vfs.UnmountFrom(0);
+  std::filesystem::remove(pack_path);
+}
@@ -0,0 +1,228 @@
+// Navary Engine - IO Subsystem Tests
+// File: tests/io/file_watcher_test.cc
+// Focus: change detection (inotify and polling), debouncing, atomic-save
+//        renames, unwatch, shared and dropped directory watches.
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+#include "navary/core/time/profiler_time.h"
+#include "navary/io/file_watcher.h"
+
+using namespace navary;
+using namespace navary::io;
+
+namespace {
+
+std::filesystem::path TempDir(const char* name) {
+  std::filesystem::path dir = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  return dir;
+}
+
+void WriteText(const std::filesystem::path& path, const char* text) {
+  std::FILE* f = std::fopen(path.string().c_str(), "wb");
+  REQUIRE(f != nullptr);
+  std::fwrite(text, 1, std::strlen(text), f);
+  std::fclose(f);
+}
+
+std::uint64_t Ms(std::uint32_t ms) {
+  return core::time::ProfilerTicksPerSecond() * ms / 1000;
+}
+
+void CheckDebounce(FileWatchBackendKind backend) {
+  const std::filesystem::path dir   = TempDir("navary_watch_debounce");
+  const std::filesystem::path file  = dir / "rock.navgraph";
+  const std::filesystem::path other = dir / "other.navgraph";
+  WriteText(file, "1");
+  WriteText(other, "1");
+
+  FileWatcherDesc desc;
+  desc.backend          = backend;
+  desc.max_watches      = 8;
+  desc.debounce_ms      = 50;
+  desc.poll_interval_ms = 0;
+  FileWatcher watcher;
+  REQUIRE(watcher.Init(desc).ok());
+#if defined(__linux__)
+  if (backend == FileWatchBackendKind::kAuto) {
+    REQUIRE(watcher.backend_kind() == FileWatchBackendKind::kInotify);
+  }
+#endif
+
+  const NavaryResult<std::uint32_t> watch =
+      watcher.Watch(file.string().c_str(), 42);
+  REQUIRE(watch.status().ok());
+  REQUIRE(watcher.watch_count() == 1);
+
+  FileWatchEvent events[4];
+  std::uint64_t t = core::time::ProfilerNowTicks();
+  REQUIRE(watcher.PollAt(t, events, 4) == 0);
+
+  // Several writes inside the window collapse into a single event that
+  // fires only once the file has been quiet for debounce_ms.
+  WriteText(file, "22");
+  REQUIRE(watcher.PollAt(t, events, 4) == 0);
+  REQUIRE(watcher.pending_count() == 1);
+  WriteText(file, "333");
+  REQUIRE(watcher.PollAt(t + Ms(30), events, 4) == 0);
+  REQUIRE(watcher.PollAt(t + Ms(60), events, 4) == 0);  // window restarted
+  REQUIRE(watcher.PollAt(t + Ms(90), events, 4) == 1);
+  REQUIRE(events[0].watch == watch.value());
+  REQUIRE(events[0].user_tag == 42);
+  REQUIRE(std::string(events[0].path) == file.string());
+  REQUIRE(watcher.PollAt(t + Ms(200), events, 4) == 0);
+
+  // Files next to the watched one do not wake it.
+  WriteText(other, "22");
+  REQUIRE(watcher.PollAt(t + Ms(300), events, 4) == 0);
+  REQUIRE(watcher.PollAt(t + Ms(400), events, 4) == 0);
+
+  // Unwatch drops a change still waiting out its window.
+  WriteText(file, "4444");
+  REQUIRE(watcher.PollAt(t + Ms(500), events, 4) == 0);
+  watcher.Unwatch(watch.value());
+  REQUIRE(watcher.pending_count() == 0);
+  REQUIRE(watcher.PollAt(t + Ms(600), events, 4) == 0);
+  REQUIRE(watcher.watch_count() == 0);
+
+  watcher.Shutdown();
+  std::filesystem::remove_all(dir);
+}
+
+void CheckRenameAndCreate(FileWatchBackendKind backend) {
+  const std::filesystem::path dir  = TempDir("navary_watch_rename");
+  const std::filesystem::path file = dir / "water.navgraph";
+  const std::filesystem::path late = dir / "late.navgraph";
+  WriteText(file, "v1");
+
+  FileWatcherDesc desc;
+  desc.backend          = backend;
+  desc.max_watches      = 2;
+  desc.debounce_ms      = 10;
+  desc.poll_interval_ms = 0;
+  FileWatcher watcher;
+  REQUIRE(watcher.Init(desc).ok());
+
+  REQUIRE(watcher.Watch(file.string().c_str(), 1).status().ok());
+  REQUIRE(watcher.Watch(late.string().c_str(), 2).status().ok());
+  REQUIRE(watcher.Watch(late.string().c_str(), 3).status().code() ==
+          NavaryStatus::kOutOfMemory);
+
+  FileWatchEvent events[4];
+  std::uint64_t t = core::time::ProfilerNowTicks();
+  REQUIRE(watcher.PollAt(t, events, 4) == 0);
+
+  // Write-temp-then-rename, the way editors save.
+  const std::filesystem::path temp = dir / "water.navgraph.tmp";
+  WriteText(temp, "v2 longer");
+  std::filesystem::rename(temp, file);
+  WriteText(late, "new");
+
+  REQUIRE(watcher.PollAt(t, events, 4) == 0);
+  REQUIRE(watcher.PollAt(t + Ms(20), events, 1) == 1);  // one per call
+  REQUIRE(watcher.PollAt(t + Ms(20), events + 1, 1) == 1);
+  REQUIRE(events[0].user_tag + events[1].user_tag == 3);
+
+  // The watch survives the rename.
+  WriteText(file, "v3 even longer");
+  REQUIRE(watcher.PollAt(t + Ms(40), events, 4) == 0);
+  REQUIRE(watcher.PollAt(t + Ms(60), events, 4) == 1);
+  REQUIRE(events[0].user_tag == 1);
+
+  watcher.Shutdown();
+  std::filesystem::remove_all(dir);
+}
+
+}  // namespace
+
+TEST_CASE("FileWatcher: debounces bursts into one event", "[io][watch]") {
+  CheckDebounce(FileWatchBackendKind::kPolling);
+  CheckDebounce(FileWatchBackendKind::kAuto);
+}
+
+TEST_CASE("FileWatcher: atomic saves and late-created files",
+          "[io][watch]") {
+  CheckRenameAndCreate(FileWatchBackendKind::kPolling);
+  CheckRenameAndCreate(FileWatchBackendKind::kAuto);
+}
+
+TEST_CASE("FileWatcher: directory watches shared across path spellings",
+          "[io][watch]") {
+  const std::filesystem::path dir = TempDir("navary_watch_spelling");
+  const std::filesystem::path a   = dir / "a.navgraph";
+  const std::filesystem::path b   = dir / "b.navgraph";
+  WriteText(a, "1");
+  WriteText(b, "1");
+
+  FileWatcherDesc desc;
+  desc.max_watches      = 4;
+  desc.debounce_ms      = 10;
+  desc.poll_interval_ms = 0;
+  FileWatcher watcher;
+  REQUIRE(watcher.Init(desc).ok());
+  if (watcher.backend_kind() != FileWatchBackendKind::kInotify) {
+    return;
+  }
+
+  // Two spellings of one directory share the kernel watch; dropping the
+  // first must not silence the second.
+  const std::string dotted = dir.string() + "/./b.navgraph";
+  const NavaryResult<std::uint32_t> wa = watcher.Watch(a.string().c_str(), 1);
+  REQUIRE(wa.status().ok());
+  REQUIRE(watcher.Watch(dotted.c_str(), 2).status().ok());
+  watcher.Unwatch(wa.value());
+
+  FileWatchEvent events[4];
+  const std::uint64_t t = core::time::ProfilerNowTicks();
+  WriteText(b, "22");
+  REQUIRE(watcher.PollAt(t, events, 4) == 0);
+  REQUIRE(watcher.PollAt(t + Ms(20), events, 4) == 1);
+  REQUIRE(events[0].user_tag == 2);
+
+  // Deleting the directory drops the kernel watch; the file still reports
+  // and a fresh watch on the recreated directory works.
+  std::filesystem::remove_all(dir);
+  REQUIRE(watcher.PollAt(t + Ms(40), events, 4) == 0);
+  REQUIRE(watcher.PollAt(t + Ms(60), events, 4) == 1);
+  REQUIRE(events[0].user_tag == 2);
+
+  std::filesystem::create_directories(dir);
+  const NavaryResult<std::uint32_t> wb = watcher.Watch(b.string().c_str(), 3);
+  REQUIRE(wb.status().ok());
+  WriteText(b, "333");
+  REQUIRE(watcher.PollAt(t + Ms(80), events, 4) == 0);
+  REQUIRE(watcher.PollAt(t + Ms(100), events, 4) == 1);
+  REQUIRE(events[0].user_tag == 3);
+
+  watcher.Shutdown();
+  std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("FileWatcher: rejects bad requests", "[io][watch]") {
+  FileWatcher watcher;
+  REQUIRE(watcher.Watch("a.navgraph", 0).status().code() ==
+          NavaryStatus::kInvalidArgument);
+
+  FileWatcherDesc desc;
+  desc.max_watches = 0;
+  REQUIRE(watcher.Init(desc).code() == NavaryStatus::kInvalidArgument);
+  desc.max_watches = 4;
+  REQUIRE(watcher.Init(desc).ok());
+  REQUIRE(watcher.Init(desc).code() == NavaryStatus::kInvalidArgument);
+  REQUIRE(watcher.Watch("", 0).status().code() ==
+          NavaryStatus::kInvalidArgument);
+#if defined(__linux__)
+  if (watcher.backend_kind() == FileWatchBackendKind::kInotify) {
+    REQUIRE(watcher.Watch("/no/such/dir/a.navgraph", 0).status().code() ==
+            NavaryStatus::kNotFound);
+  }
+#endif
+  watcher.Unwatch(99);  // ignored
+}
@@ -0,0 +1,224 @@
+// Navary Engine - IO Subsystem Tests
+// File: tests/io/pack_compression_test.cc
+// Focus: LZ block codec, block-compressed pack entries, random access,
+//        parallel decode.
+
+#include <catch2/catch_all.hpp>
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "navary/core/scheduler/job_system.h"
+#include "navary/io/lz_block.h"
+#include "navary/io/pack_archive.h"
+#include "navary/io/pack_compression.h"
+#include "navary/io/pack_writer.h"
+#include "navary/io/vfs.h"
+
+using namespace navary;
+using namespace navary::io;
+
+namespace {
+
+// Asset-like data: repeated records with a slowly changing payload plus
+// some noise, so it compresses but not trivially.
+std::vector<std::uint8_t> MakeAssetBytes(std::size_t size,
+                                         std::uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::vector<std::uint8_t> out(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    const std::uint32_t record = static_cast<std::uint32_t>(i / 32);
+    out[i] = (i % 32) < 24 ? static_cast<std::uint8_t>(record * 7 + i % 8)
+                           : static_cast<std::uint8_t>(rng());
+  }
+  return out;
+}
+
+std::vector<std::uint8_t> RoundTrip(const std::vector<std::uint8_t>& src) {
+  std::vector<std::uint8_t> enc(LzCompressBound(src.size()));
+  const std::size_t n =
+      LzCompress(src.data(), src.size(), enc.data(), enc.size());
+  REQUIRE(n > 0);
+  std::vector<std::uint8_t> dec(src.size());
+  REQUIRE(LzDecompress(enc.data(), n, dec.data(), dec.size()));
+  return dec;
+}
+
+memory::Span<const std::uint8_t> View(const std::vector<std::uint8_t>& v) {
+  return memory::Span<const std::uint8_t>(v.data(), v.size());
+}
+
+memory::Span<std::uint8_t> Mut(std::vector<std::uint8_t>& v) {
+  return memory::Span<std::uint8_t>(v.data(), v.size());
+}
+
+}  // namespace
+
+TEST_CASE("LzBlock: round trips edge cases", "[io][lz]") {
+  REQUIRE(RoundTrip({}).empty());
+  const std::vector<std::uint8_t> one = {42};
+  REQUIRE(RoundTrip(one) == one);
+
+  std::vector<std::uint8_t> zeros(100000, 0);
+  REQUIRE(RoundTrip(zeros) == zeros);
+
+  std::vector<std::uint8_t> noise(70000);
+  std::mt19937 rng(7);
+  for (auto& b : noise) {
+    b = static_cast<std::uint8_t>(rng());
+  }
+  REQUIRE(RoundTrip(noise) == noise);
+
+  const std::vector<std::uint8_t> asset = MakeAssetBytes(200000, 3);
+  REQUIRE(RoundTrip(asset) == asset);
+
+  // Repetitive data must actually shrink.
+  std::vector<std::uint8_t> enc(LzCompressBound(zeros.size()));
+  REQUIRE(LzCompress(zeros.data(), zeros.size(), enc.data(), enc.size()) <
+          zeros.size() / 100);
+}
+
+TEST_CASE("LzBlock: rejects malformed input", "[io][lz]") {
+  const std::vector<std::uint8_t> asset = MakeAssetBytes(4096, 5);
+  std::vector<std::uint8_t> enc(LzCompressBound(asset.size()));
+  const std::size_t n =
+      LzCompress(asset.data(), asset.size(), enc.data(), enc.size());
+  REQUIRE(n > 0);
+
+  std::vector<std::uint8_t> dec(asset.size());
+  REQUIRE_FALSE(LzDecompress(enc.data(), n - 1, dec.data(), dec.size()));
+  REQUIRE_FALSE(LzDecompress(enc.data(), n, dec.data(), dec.size() - 1));
+
+  // Offset pointing before the start of the output.
+  const std::uint8_t bad[] = {0x10, 'a', 0x05, 0x00, 0x00};
+  std::uint8_t out[16];
+  REQUIRE_FALSE(LzDecompress(bad, sizeof(bad), out, sizeof(out)));
+}
+
+TEST_CASE("PackArchive: block-compressed entries", "[io][pack][lz]") {
+  const std::vector<std::uint8_t> mesh    = MakeAssetBytes(300000, 11);
+  const std::vector<std::uint8_t> small   = MakeAssetBytes(1000, 12);
+  std::vector<std::uint8_t> noise(20000);
+  std::mt19937 rng(13);
+  for (auto& b : noise) {
+    b = static_cast<std::uint8_t>(rng());
+  }
+
+  PackFileOptions lz;
+  lz.codec       = PackCodec::kLz;
+  lz.block_shift = 16;
+
+  PackWriter writer;
+  REQUIRE(writer.AddFile("meshes/rock.mesh", View(mesh), lz).ok());
+  REQUIRE(writer.AddFile("meshes/small.mesh", View(small), lz).ok());
+  REQUIRE(writer.AddFile("noise.bin", View(noise), lz).ok());
+  PackFileOptions bad = lz;
+  bad.block_shift     = 30;
+  REQUIRE(writer.AddFile("bad.bin", View(small), bad).code() ==
+          NavaryStatus::kInvalidArgument);
+
+  std::vector<std::uint8_t> bytes;
+  REQUIRE(writer.Build(&bytes).ok());
+
+  PackArchive pack;
+  REQUIRE(pack.OpenFromMemory(View(bytes)).ok());
+
+  const PackTocEntry* rock = pack.Find("meshes/rock.mesh");
+  REQUIRE(rock != nullptr);
+  REQUIRE(IsPackEntryCompressed(*rock));
+  REQUIRE(rock->raw_size == mesh.size());
+  REQUIRE(rock->size < mesh.size());
+  REQUIRE(rock->block_count == 5);
+
+  // Incompressible data is stored raw and stays zero copy.
+  const PackTocEntry* n = pack.Find("noise.bin");
+  REQUIRE(n != nullptr);
+  REQUIRE_FALSE(IsPackEntryCompressed(*n));
+  REQUIRE(pack.Read("noise.bin").status().ok());
+  REQUIRE(pack.Read("meshes/rock.mesh").status().code() ==
+          NavaryStatus::kInvalidArgument);
+
+  core::scheduler::JobSystem jobs;
+  REQUIRE(jobs.Init(3).ok());
+
+  std::vector<std::uint8_t> out(mesh.size());
+  REQUIRE(pack.ReadInto("meshes/rock.mesh", Mut(out), &jobs).ok());
+  REQUIRE(out == mesh);
+  std::vector<std::uint8_t> serial(mesh.size());
+  REQUIRE(pack.ReadInto("meshes/rock.mesh", Mut(serial), nullptr).ok());
+  REQUIRE(serial == mesh);
+
+  std::vector<std::uint8_t> small_out(small.size());
+  REQUIRE(pack.ReadInto("meshes/small.mesh", Mut(small_out), &jobs).ok());
+  REQUIRE(small_out == small);
+
+  // Random access: decode only blocks 3..4 (the tail is a partial block).
+  std::vector<std::uint8_t> tail(300000 - 3 * 65536);
+  REQUIRE(DecodePackBlocks(*rock, pack.EntryData(*rock), 3, 2, Mut(tail),
+                           &jobs)
+              .ok());
+  REQUIRE(std::memcmp(tail.data(), mesh.data() + 3 * 65536, tail.size()) ==
+          0);
+  REQUIRE(DecodePackBlocks(*rock, pack.EntryData(*rock), 4, 2, Mut(tail),
+                           nullptr)
+              .code() == NavaryStatus::kInvalidArgument);
+
+  // Vfs hands back decoded bytes for compressed entries.
+  Vfs vfs;
+  REQUIRE(vfs.Init().ok());
+  REQUIRE(vfs.MountPackFromMemory(View(bytes)).status().ok());
+  VfsFile file;
+  REQUIRE(vfs.Read("meshes/rock.mesh", &file, &jobs).ok());
+  REQUIRE(file.bytes().size() == mesh.size());
+  REQUIRE(std::memcmp(file.bytes().data(), mesh.data(), mesh.size()) == 0);
+
+  jobs.Shutdown();
+}
+
+TEST_CASE("PackArchive: rejects corrupt block tables", "[io][pack][lz]") {
+  const std::vector<std::uint8_t> mesh = MakeAssetBytes(100000, 21);
+  PackFileOptions lz;
+  lz.codec = PackCodec::kLz;
+  PackWriter writer;
+  REQUIRE(writer.AddFile("a.mesh", View(mesh), lz).ok());
+  std::vector<std::uint8_t> bytes;
+  REQUIRE(writer.Build(&bytes).ok());
+
+  PackHeader header;
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  PackTocEntry entry;
+  std::memcpy(&entry, bytes.data() + header.toc_offset, sizeof(entry));
+  REQUIRE(IsPackEntryCompressed(entry));
+
+  // Block pointing past the entry.
+  std::vector<std::uint8_t> broken = bytes;
+  PackBlock block;
+  std::memcpy(&block, broken.data() + entry.offset, sizeof(block));
+  block.offset = static_cast<std::uint32_t>(entry.size);
+  std::memcpy(broken.data() + entry.offset, &block, sizeof(block));
+  PackArchive pack;
+  REQUIRE(pack.OpenFromMemory(View(broken)).code() ==
+          NavaryStatus::kParseError);
+
+  // Random access checks only the blocks it decodes.
+  const memory::Span<const std::uint8_t> stored(broken.data() + entry.offset,
+                                                entry.size);
+  REQUIRE_FALSE(ValidatePackEntryBlocks(entry, stored));
+  std::vector<std::uint8_t> second(65536);
+  REQUIRE(DecodePackBlocks(entry, stored, 1, 1, Mut(second), nullptr).ok());
+  REQUIRE(std::memcmp(second.data(), mesh.data() + 65536,
+                      mesh.size() - 65536) == 0);
+  REQUIRE(DecodePackBlocks(entry, stored, 0, 1, Mut(second), nullptr).code() ==
+          NavaryStatus::kParseError);
+
+  // Garbage inside a block passes open but fails decode.
+  broken = bytes;
+  std::memcpy(&block, broken.data() + entry.offset, sizeof(block));
+  std::memset(broken.data() + entry.offset + block.offset, 0xEE, 8);
+  REQUIRE(pack.OpenFromMemory(View(broken)).ok());
+  std::vector<std::uint8_t> out(mesh.size());
+  REQUIRE(pack.ReadInto("a.mesh", Mut(out), nullptr).code() ==
+          NavaryStatus::kParseError);
+}
@@ -0,0 +1,207 @@
+// Navary Engine - IO Subsystem Tests
+// File: tests/io/vfs_test.cc
+// Focus: pack build/mount, zero-copy reads, shadowing, loose overlay.
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "navary/io/pack_archive.h"
+#include "navary/io/pack_format.h"
+#include "navary/io/pack_writer.h"
+#include "navary/io/vfs.h"
+#include "navary/io/vfs_path.h"
+
+using namespace navary;
+using namespace navary::io;
+
+namespace {
+
+memory::Span<const std::uint8_t> Bytes(const char* s) {
+  return memory::Span<const std::uint8_t>(
+      reinterpret_cast<const std::uint8_t*>(s), std::strlen(s));
+}
+
+std::string AsString(memory::Span<const std::uint8_t> s) {
+  return std::string(reinterpret_cast<const char*>(s.data()), s.size());
+}
+
+std::string Normalize(const char* path) {
+  char buffer[kVfsMaxPath];
+  const std::size_t n = NormalizeVfsPath(path, buffer, sizeof(buffer));
+  return std::string(buffer, n);
+}
+
+std::filesystem::path TempDir(const char* name) {
+  std::filesystem::path dir = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  return dir;
+}
+
+void WriteText(const std::filesystem::path& path, const char* text) {
+  std::filesystem::create_directories(path.parent_path());
+  std::FILE* f = std::fopen(path.string().c_str(), "wb");
+  REQUIRE(f != nullptr);
+  std::fwrite(text, 1, std::strlen(text), f);
+  std::fclose(f);
+}
+
+}  // namespace
+
+TEST_CASE("VfsPath: normalization", "[io][vfs]") {
+  REQUIRE(Normalize("textures/rock.ktx") == "textures/rock.ktx");
+  REQUIRE(Normalize("/textures//rock.ktx") == "textures/rock.ktx");
+  REQUIRE(Normalize("./textures\\rock.ktx") == "textures/rock.ktx");
+  REQUIRE(Normalize("a/./b/") == "a/b");
+  REQUIRE(Normalize("a/.hidden") == "a/.hidden");
+  REQUIRE(Normalize("").empty());
+  REQUIRE(Normalize("/").empty());
+  REQUIRE(Normalize("a/..b/c..") == "a/..b/c..");
+  REQUIRE(Normalize("..").empty());
+  REQUIRE(Normalize("../etc/passwd").empty());
+  REQUIRE(Normalize("a/b/../../..\\x").empty());
+  REQUIRE(Normalize("a/./../b").empty());
+}
+
+TEST_CASE("PackArchive: build and read from memory", "[io][pack]") {
+  PackWriter writer;
+  REQUIRE(writer.AddFile("shaders/a.spv", Bytes("alpha")).ok());
+  REQUIRE(writer.AddFile("shaders/b.spv", Bytes("bravo!")).ok());
+  REQUIRE(writer.AddFile("empty.bin", Bytes("")).ok());
+  REQUIRE(writer.AddFile("/shaders/a.spv", Bytes("dup")).code() ==
+          NavaryStatus::kInvalidArgument);
+
+  std::vector<std::uint8_t> bytes;
+  REQUIRE(writer.Build(&bytes).ok());
+
+  PackArchive pack;
+  REQUIRE(pack.OpenFromMemory(
+              memory::Span<const std::uint8_t>(bytes.data(), bytes.size()))
+              .ok());
+  REQUIRE(pack.entry_count() == 3);
+
+  auto a = pack.Read("shaders\\a.spv");
+  REQUIRE(a.status().ok());
+  REQUIRE(AsString(a.value()) == "alpha");
+  // Zero copy: the span points into the pack buffer.
+  REQUIRE(a.value().data() >= bytes.data());
+  REQUIRE(a.value().data() < bytes.data() + bytes.size());
+  REQUIRE(reinterpret_cast<std::uintptr_t>(a.value().data()) %
+              kPackDataAlignment ==
+          0);
+
+  auto empty = pack.Read("empty.bin");
+  REQUIRE(empty.status().ok());
+  REQUIRE(empty.value().size() == 0);
+
+  REQUIRE(pack.Read("shaders/c.spv").status().code() ==
+          NavaryStatus::kNotFound);
+}
+
+TEST_CASE("PackArchive: rejects corrupt packs", "[io][pack]") {
+  PackWriter writer;
+  REQUIRE(writer.AddFile("a.txt", Bytes("a")).ok());
+  REQUIRE(writer.AddFile("b.txt", Bytes("b")).ok());
+  std::vector<std::uint8_t> bytes;
+  REQUIRE(writer.Build(&bytes).ok());
+
+  PackArchive pack;
+
+  std::vector<std::uint8_t> bad_magic = bytes;
+  bad_magic[0] ^= 0xFF;
+  REQUIRE(pack.OpenFromMemory(memory::Span<const std::uint8_t>(
+                                  bad_magic.data(), bad_magic.size()))
+              .code() == NavaryStatus::kParseError);
+
+  std::vector<std::uint8_t> truncated(bytes.begin(), bytes.end() - 8);
+  REQUIRE(pack.OpenFromMemory(memory::Span<const std::uint8_t>(
+                                  truncated.data(), truncated.size()))
+              .code() == NavaryStatus::kParseError);
+
+  PackHeader header;
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  std::vector<std::uint8_t> unsorted = bytes;
+  auto* toc =
+      reinterpret_cast<PackTocEntry*>(unsorted.data() + header.toc_offset);
+  std::swap(toc[0], toc[1]);
+  REQUIRE(pack.OpenFromMemory(memory::Span<const std::uint8_t>(
+                                  unsorted.data(), unsorted.size()))
+              .code() == NavaryStatus::kParseError);
+  REQUIRE_FALSE(pack.is_open());
+}
+
+TEST_CASE("Vfs: mounted packs, shadowing and loose overlay", "[io][vfs]") {
+  const std::filesystem::path dir = TempDir("navary_vfs_test");
+
+  PackWriter base;
+  REQUIRE(base.AddFile("data/config.ini", Bytes("base")).ok());
+  REQUIRE(base.AddFile("data/only_base.txt", Bytes("only")).ok());
+  const std::string base_path = (dir / "base.nvpk").string();
+  REQUIRE(base.WriteToFile(base_path.c_str()).ok());
+
+  PackWriter patch;
+  REQUIRE(patch.AddFile("data/config.ini", Bytes("patched")).ok());
+  const std::string patch_path = (dir / "patch.nvpk").string();
+  REQUIRE(patch.WriteToFile(patch_path.c_str()).ok());
+
+  Vfs vfs;
+  REQUIRE(vfs.Init(4).ok());
+  auto base_index = vfs.MountPack(base_path.c_str());
+  REQUIRE(base_index.status().ok());
+  REQUIRE(base_index.value() == 0);
+  REQUIRE(vfs.MountPack((dir / "missing.nvpk").string().c_str())
+              .status().code() == NavaryStatus::kNotFound);
+  auto patch_index = vfs.MountPack(patch_path.c_str());
+  REQUIRE(patch_index.status().ok());
+  REQUIRE(vfs.mount_count() == 2);
+
+  VfsFile file;
+  REQUIRE(vfs.Read("data/config.ini", &file).ok());
+  REQUIRE(file.from_pack());
+  REQUIRE(AsString(file.bytes()) == "patched");
+
+  REQUIRE(vfs.Read("data/only_base.txt", &file).ok());
+  REQUIRE(AsString(file.bytes()) == "only");
+
+  REQUIRE(vfs.Read("data/nope.txt", &file).code() == NavaryStatus::kNotFound);
+  REQUIRE_FALSE(vfs.Exists("data/nope.txt"));
+
+  // Loose files win over every pack.
+  const std::filesystem::path loose = dir / "loose";
+  WriteText(loose / "data" / "config.ini", "loose");
+  vfs.SetLooseRoot(loose.string() + "/");
+  REQUIRE(vfs.Read("/data/config.ini", &file).ok());
+  REQUIRE_FALSE(file.from_pack());
+  REQUIRE(AsString(file.bytes()) == "loose");
+  REQUIRE(vfs.Read("data/only_base.txt", &file).ok());
+  REQUIRE(file.from_pack());
+
+  // Traversal out of the loose root is refused, not resolved.
+  WriteText(dir / "secret.txt", "secret");
+  REQUIRE(vfs.Read("../secret.txt", &file).code() == NavaryStatus::kNotFound);
+  REQUIRE(vfs.Read("data/../../secret.txt", &file).code() ==
+          NavaryStatus::kNotFound);
+  REQUIRE_FALSE(vfs.Exists("..\\secret.txt"));
+  VfsLocation location;
+  REQUIRE(vfs.Locate("../secret.txt", &location).code() ==
+          NavaryStatus::kNotFound);
+
+  vfs.ClearLooseRoot();
+  vfs.UnmountFrom(patch_index.value());
+  REQUIRE(vfs.mount_count() == 1);
+  REQUIRE(vfs.Read("data/config.ini", &file).ok());
+  REQUIRE(AsString(file.bytes()) == "base");
+
+  const VfsStats stats = vfs.stats();
+  REQUIRE(stats.loose_hits == 1);
+  REQUIRE(stats.pack_hits == 4);
+  REQUIRE(stats.misses == 3);
+
+  vfs.UnmountFrom(0);
+  std::filesystem::remove_all(dir);
+}
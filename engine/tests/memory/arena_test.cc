@@ -423,3 +423,115 @@ TEST_CASE("Arena: Many tiny allocations are stable and fast-path bump-pointer is
   // Reset after stress
   REQUIRE(arena.ArenaResetSafely(5ms) == true);
 }
+
+// -----------------------------------------------------------------------------
+// 12) Checkpoint / RewindTo discards later allocations and their dtors
+// -----------------------------------------------------------------------------
+TEST_CASE("Arena: RewindTo restores bump pointer and runs newer dtors",
+          "[checkpoint]") {
+  ArenaOptions opts;
+  opts.initial_block_bytes = 4 * 1024;
+  opts.max_block_bytes     = 64 * 1024;
+  Arena arena(opts);
+
+  NonTrivial::alive.store(0);
+  NonTrivial::destroyed.store(0);
+
+  auto* keep = Arena::New<NonTrivial>(arena, 1);
+  void* a    = arena.Allocate(64, 16);
+  REQUIRE(a != nullptr);
+
+  const ArenaCheckpoint cp = arena.Checkpoint();
+  void* b                  = arena.Allocate(64, 16);
+  (void)Arena::New<NonTrivial>(arena, 2);
+  (void)Arena::New<NonTrivial>(arena, 3);
+  // Force a block refill past the checkpoint.
+  void* big = arena.Allocate(16 * 1024, 16);
+  REQUIRE(big != nullptr);
+  const std::size_t reserved = arena.TotalReserved();
+
+  arena.RewindTo(cp);
+  REQUIRE(NonTrivial::destroyed.load() == 2);
+  REQUIRE(keep->v == 1);
+  REQUIRE(arena.TotalReserved() == reserved);  // blocks kept for reuse
+
+  // Next allocation reuses the same address as the first one after the mark.
+  void* b2 = arena.Allocate(64, 16);
+  REQUIRE(b2 == b);
+
+  arena.Reset();
+  REQUIRE(NonTrivial::destroyed.load() == 3);
+}
+
+// -----------------------------------------------------------------------------
+// 13) Repeated rewinds reuse rewound blocks instead of growing upstream
+// -----------------------------------------------------------------------------
+TEST_CASE("Arena: TotalReserved stays flat across repeated rewinds",
+          "[checkpoint][stats]") {
+  ArenaOptions opts;
+  opts.initial_block_bytes = 4 * 1024;
+  opts.max_block_bytes     = 64 * 1024;
+  Arena arena(opts);
+
+  // Checkpoint taken before the lane owns any block.
+  const ArenaCheckpoint empty = arena.Checkpoint();
+  REQUIRE(arena.Allocate(64) != nullptr);
+  arena.RewindTo(empty);
+  const std::size_t reserved = arena.TotalReserved();
+  REQUIRE(reserved > 0);
+  for (int i = 0; i < 1000; ++i) {
+    REQUIRE(arena.Allocate(64) != nullptr);
+    arena.RewindTo(empty);
+  }
+  REQUIRE(arena.TotalReserved() == reserved);
+
+  // Rollbacks that spill into several fresh blocks each time.
+  REQUIRE(arena.Allocate(64) != nullptr);
+  const ArenaCheckpoint cp = arena.Checkpoint();
+  for (int i = 0; i < 3; ++i) {
+    REQUIRE(arena.Allocate(3 * 1024) != nullptr);
+  }
+  arena.RewindTo(cp);
+  const std::size_t spilled = arena.TotalReserved();
+  for (int i = 0; i < 1000; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      REQUIRE(arena.Allocate(3 * 1024) != nullptr);
+    }
+    arena.RewindTo(cp);
+  }
+  REQUIRE(arena.TotalReserved() == spilled);
+
+  arena.Purge();
+  REQUIRE(arena.TotalReserved() == 0);
+}
+
+// -----------------------------------------------------------------------------
+// 14) RewindTo runs the dtors of every block released by the rollback
+// -----------------------------------------------------------------------------
+TEST_CASE("Arena: RewindTo runs dtors across several released blocks",
+          "[checkpoint]") {
+  ArenaOptions opts;
+  opts.initial_block_bytes = 4 * 1024;
+  opts.max_block_bytes     = 64 * 1024;
+  Arena arena(opts);
+
+  NonTrivial::alive.store(0);
+  NonTrivial::destroyed.store(0);
+
+  auto* keep = Arena::New<NonTrivial>(arena, 1);
+
+  const ArenaCheckpoint cp = arena.Checkpoint();
+  (void)Arena::New<NonTrivial>(arena, 2);  // in the checkpoint's block
+  for (int i = 0; i < 4; ++i) {
+    // Each large allocation forces a fresh block for the next object.
+    REQUIRE(arena.Allocate(3 * 1024, 16) != nullptr);
+    (void)Arena::New<NonTrivial>(arena, 10 + i);
+  }
+
+  arena.RewindTo(cp);
+  REQUIRE(NonTrivial::destroyed.load() == 5);
+  REQUIRE(keep->v == 1);
+
+  arena.Reset();
+  REQUIRE(NonTrivial::destroyed.load() == 6);
+}
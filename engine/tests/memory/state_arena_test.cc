@@ -0,0 +1,148 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#include "navary/memory/state_arena.h"
+
+using namespace navary::memory;
+
+namespace {
+
+struct Body {
+  int32_t pos[3];
+  int32_t vel[3];
+  uint32_t flags;
+  Body* parent;  // in-arena pointer, must survive restore
+};
+
+struct SimWorld {
+  uint32_t tick;
+  uint32_t body_count;
+  Body* bodies;
+};
+
+SimWorld* BuildWorld(StateArena& state, uint32_t n) {
+  auto* world       = state.Create<SimWorld>();
+  world->body_count = n;
+  world->bodies     = state.MakeSpan<Body>(n).data();
+  for (uint32_t i = 0; i < n; ++i) {
+    world->bodies[i].pos[0] = static_cast<int32_t>(i);
+    world->bodies[i].vel[0] = 1;
+    world->bodies[i].parent = i > 0 ? &world->bodies[i - 1] : nullptr;
+  }
+  return world;
+}
+
+void Step(SimWorld* world) {
+  ++world->tick;
+  for (uint32_t i = 0; i < world->body_count; ++i) {
+    Body& b = world->bodies[i];
+    for (int k = 0; k < 3; ++k) {
+      b.pos[k] += b.vel[k];
+    }
+    b.flags ^= world->tick;
+  }
+}
+
+}  // namespace
+
+TEST_CASE("StateArena: bump allocation, zeroed memory, capacity limit",
+          "[state][alloc]") {
+  StateArena state(1024);
+  REQUIRE(state.capacity() == 1024);
+
+  auto* p = static_cast<uint8_t*>(state.Allocate(100, 16));
+  REQUIRE(p != nullptr);
+  for (int i = 0; i < 100; ++i) {
+    REQUIRE(p[i] == 0);
+  }
+  REQUIRE(state.used() == 100);
+
+  auto* q = state.Allocate(8, 64);
+  REQUIRE((reinterpret_cast<std::uintptr_t>(q) & 63u) == 0);
+  REQUIRE(state.Allocate(2048, 16) == nullptr);
+  REQUIRE(state.used() == 136);
+}
+
+TEST_CASE("StateArena: RewindTo re-zeroes discarded bytes", "[state][mark]") {
+  StateArena state(512);
+  (void)state.Allocate(32, 8);
+  const std::size_t mark = state.Checkpoint();
+  const uint64_t before  = state.Hash();
+
+  auto* p = static_cast<uint8_t*>(state.Allocate(64, 8));
+  std::memset(p, 0xAB, 64);
+  state.RewindTo(mark);
+  REQUIRE(state.used() == mark);
+  REQUIRE(state.Hash() == before);
+
+  auto* again = static_cast<uint8_t*>(state.Allocate(64, 8));
+  REQUIRE(again == p);
+  REQUIRE(again[0] == 0);
+  REQUIRE(again[63] == 0);
+}
+
+TEST_CASE("StateSnapshotRing: save, simulate, restore replays identically",
+          "[state][ring]") {
+  StateArena state(64 * 1024);
+  SimWorld* world = BuildWorld(state, 256);
+  StateSnapshotRing ring(8, state.capacity());
+
+  uint64_t hashes[16];
+  for (uint32_t t = 0; t < 16; ++t) {
+    REQUIRE(ring.Save(t, state));
+    hashes[t] = state.Hash();
+    Step(world);
+  }
+
+  // Only the last 8 ticks are retained.
+  REQUIRE_FALSE(ring.Contains(7));
+  REQUIRE(ring.Contains(8));
+  REQUIRE(ring.Contains(15));
+
+  uint64_t recorded = 0;
+  REQUIRE(ring.HashAt(10, &recorded));
+  REQUIRE(recorded == hashes[10]);
+
+  // Roll back to tick 10 and re-simulate: same hashes, pointers intact.
+  REQUIRE(ring.Restore(10, &state));
+  REQUIRE(world->tick == 10);
+  REQUIRE(world->bodies[5].parent == &world->bodies[4]);
+  REQUIRE(state.Hash() == hashes[10]);
+  for (uint32_t t = 10; t < 15; ++t) {
+    Step(world);
+    REQUIRE(state.Hash() == hashes[t + 1]);
+  }
+
+  REQUIRE_FALSE(ring.Restore(3, &state));
+}
+
+TEST_CASE("StateSnapshotRing: restore shrinks used and desync is visible",
+          "[state][ring]") {
+  StateArena state(4096);
+  auto* counter = state.Create<uint32_t>(7u);
+  StateSnapshotRing ring(2, 4096);
+  REQUIRE(ring.Save(1, state));
+
+  auto* extra = static_cast<uint8_t*>(state.Allocate(256, 8));
+  std::memset(extra, 0xFF, 256);
+  *counter = 8;
+  REQUIRE(ring.Restore(1, &state));
+  REQUIRE(*counter == 7);
+  REQUIRE(state.used() == sizeof(uint32_t));
+  REQUIRE(extra[0] == 0);  // tail re-zeroed
+
+  uint64_t saved = 0;
+  REQUIRE(ring.HashAt(1, &saved));
+  *counter = 9;
+  REQUIRE(state.Hash() != saved);
+}
+
+TEST_CASE("StateSnapshotRing: oversize state is rejected", "[state][ring]") {
+  StateArena state(8192);
+  (void)state.Allocate(5000, 8);
+  StateSnapshotRing ring(4, 4096);
+  REQUIRE_FALSE(ring.Save(0, state));
+  REQUIRE_FALSE(ring.Contains(0));
+}
@@ -0,0 +1,206 @@
+// Navary Engine - Messaging Subsystem Tests
+// File: tests/messaging/message_bus_test.cc
+// Focus: typed channels, phase-bound delivery, batching, dedicated lanes,
+//        block exhaustion, and cross-thread delivery.
+
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "navary/messaging/message_bus.h"
+
+using namespace navary;
+using namespace navary::messaging;
+
+namespace {
+
+struct LoadDone {
+  std::uint32_t asset;
+  std::uint32_t bytes;
+};
+
+struct Damage {
+  std::uint32_t target;
+  float amount;
+};
+
+struct Recorder {
+  std::vector<std::uint32_t> ids;
+  float total = 0.0f;
+};
+
+void OnLoad(const LoadDone& m, void* user) {
+  static_cast<Recorder*>(user)->ids.push_back(m.asset);
+}
+
+void OnDamage(const Damage& m, void* user) {
+  auto* r = static_cast<Recorder*>(user);
+  r->ids.push_back(m.target);
+  r->total += m.amount;
+}
+
+void CountMessage(const std::uint64_t&, void* user) {
+  ++*static_cast<std::uint64_t*>(user);
+}
+
+MessageBusDesc SmallDesc() {
+  MessageBusDesc d;
+  d.block_bytes = 1024;
+  d.block_count = 16;
+  d.max_lanes   = 2;
+  return d;
+}
+
+}  // namespace
+
+TEST_CASE("MessageBus: messages wait for their channel's phase",
+          "[messaging][bus]") {
+  MessageBus bus;
+  REQUIRE(bus.Init(SmallDesc()).ok());
+
+  auto loads  = bus.CreateChannel<LoadDone>(MessagePhase::kPreRender);
+  auto damage = bus.CreateChannel<Damage>(MessagePhase::kPostSimulation);
+  REQUIRE(loads.status().ok());
+  REQUIRE(damage.status().ok());
+
+  Recorder load_rec;
+  Recorder dmg_rec;
+  REQUIRE(bus.Subscribe(loads.value(), &OnLoad, &load_rec).ok());
+  REQUIRE(bus.Subscribe(damage.value(), &OnDamage, &dmg_rec).ok());
+
+  {
+    MessageBatch batch(&bus);
+    REQUIRE(batch.Push(damage.value(), Damage{7, 1.5f}));
+    REQUIRE(batch.Push(loads.value(), LoadDone{100, 4096}));
+    REQUIRE(batch.Push(damage.value(), Damage{8, 2.5f}));
+  }
+
+  REQUIRE(bus.Dispatch(MessagePhase::kFrameBegin) == 0);
+  REQUIRE(bus.Dispatch(MessagePhase::kPostSimulation) == 2);
+  REQUIRE(dmg_rec.ids == std::vector<std::uint32_t>{7, 8});
+  REQUIRE(dmg_rec.total == 4.0f);
+  REQUIRE(load_rec.ids.empty());
+
+  REQUIRE(bus.Dispatch(MessagePhase::kPreRender) == 1);
+  REQUIRE(load_rec.ids == std::vector<std::uint32_t>{100});
+
+  const MessageBusStats s = bus.stats();
+  REQUIRE(s.published == 3);
+  REQUIRE(s.delivered == 3);
+  REQUIRE(s.dropped == 0);
+}
+
+TEST_CASE("MessageBus: batches keep push order across blocks",
+          "[messaging][bus]") {
+  MessageBus bus;
+  REQUIRE(bus.Init(SmallDesc()).ok());
+  auto ch = bus.CreateChannel<LoadDone>(MessagePhase::kFrameBegin);
+  REQUIRE(ch.status().ok());
+  Recorder rec;
+  REQUIRE(bus.Subscribe(ch.value(), &OnLoad, &rec).ok());
+
+  // 1 KiB blocks hold ~60 records; 200 messages span several blocks.
+  {
+    MessageBatch batch(&bus);
+    for (std::uint32_t i = 0; i < 200; ++i) {
+      REQUIRE(batch.Push(ch.value(), LoadDone{i, 0}));
+    }
+  }
+  REQUIRE(bus.Dispatch(MessagePhase::kFrameBegin) == 200);
+  REQUIRE(rec.ids.size() == 200);
+  for (std::uint32_t i = 0; i < 200; ++i) {
+    REQUIRE(rec.ids[i] == i);
+  }
+  REQUIRE(bus.stats().blocks > 1);
+}
+
+TEST_CASE("MessageBus: exhausted blocks drop and recover after dispatch",
+          "[messaging][bus]") {
+  MessageBusDesc d = SmallDesc();
+  d.block_count    = 2;
+  MessageBus bus;
+  REQUIRE(bus.Init(d).ok());
+  auto a = bus.CreateChannel<LoadDone>(MessagePhase::kFrameBegin);
+  auto b = bus.CreateChannel<Damage>(MessagePhase::kFrameEnd);
+
+  REQUIRE(bus.Publish(a.value(), LoadDone{1, 0}));
+  REQUIRE(bus.Publish(b.value(), Damage{2, 0.0f}));
+  REQUIRE_FALSE(bus.Publish(a.value(), LoadDone{3, 0}));
+  REQUIRE(bus.stats().dropped == 1);
+
+  REQUIRE(bus.Dispatch(MessagePhase::kFrameBegin) == 1);
+  REQUIRE(bus.Publish(a.value(), LoadDone{4, 0}));
+}
+
+TEST_CASE("MessageBus: invalid channels and setup errors",
+          "[messaging][bus]") {
+  MessageBus bus;
+  MessageBusDesc bad = SmallDesc();
+  bad.block_bytes    = 16;
+  REQUIRE(bus.Init(bad).code() == NavaryStatus::kInvalidArgument);
+  REQUIRE(bus.Init(SmallDesc()).ok());
+  REQUIRE(bus.Init(SmallDesc()).code() == NavaryStatus::kInvalidArgument);
+
+  REQUIRE(bus.CreateChannelRaw(4096, MessagePhase::kFrameBegin)
+              .status()
+              .code() == NavaryStatus::kInvalidArgument);
+
+  auto ch = bus.CreateChannel<LoadDone>(MessagePhase::kFrameBegin);
+  MessageBatch batch(&bus);
+  const std::uint32_t wrong_size = 3;
+  REQUIRE_FALSE(batch.PushRaw(ch.value().id, &wrong_size, 3));
+  REQUIRE_FALSE(batch.PushRaw(999, &wrong_size, 4));
+
+  REQUIRE(bus.OpenLane().status().ok());
+  REQUIRE(bus.OpenLane().status().ok());
+  REQUIRE(bus.OpenLane().status().code() == NavaryStatus::kOutOfMemory);
+}
+
+TEST_CASE("MessageBus: shared queue and SPSC lanes from many threads",
+          "[messaging][bus]") {
+  MessageBusDesc d;
+  d.block_bytes = 4096;
+  d.block_count = 64;
+  d.max_lanes   = 2;
+  MessageBus bus;
+  REQUIRE(bus.Init(d).ok());
+  auto ch = bus.CreateChannel<std::uint64_t>(MessagePhase::kPreRender);
+  std::uint64_t received = 0;
+  REQUIRE(bus.Subscribe(ch.value(), &CountMessage, &received).ok());
+
+  constexpr std::uint32_t kThreads = 4;
+  constexpr std::uint32_t kPerThr  = 20000;
+  std::atomic<std::uint32_t> done{0};
+
+  std::vector<std::thread> producers;
+  for (std::uint32_t t = 0; t < kThreads; ++t) {
+    const std::uint32_t lane =
+        t < 2 ? bus.OpenLane().value() : kSharedMessageLane;
+    producers.emplace_back([&, lane] {
+      MessageBatch batch(&bus, lane);
+      for (std::uint64_t i = 0; i < kPerThr; ++i) {
+        while (!batch.Push(ch.value(), i)) {
+          std::this_thread::yield();  // wait for the frame thread
+        }
+      }
+      batch.Flush();
+      done.fetch_add(1);
+    });
+  }
+
+  // Frame thread: keep dispatching until every producer finished.
+  while (done.load() < kThreads) {
+    bus.Dispatch(MessagePhase::kPreRender);
+    std::this_thread::yield();
+  }
+  for (auto& p : producers) {
+    p.join();
+  }
+  bus.Dispatch(MessagePhase::kPreRender);
+
+  REQUIRE(received == std::uint64_t{kThreads} * kPerThr);
+  REQUIRE(bus.stats().published == received);
+}
@@ -0,0 +1,118 @@
+// Navary Engine - Messaging Subsystem Tests
+// File: tests/messaging/queue_test.cc
+// Focus: MPMC and SPSC queue capacity, FIFO order, and multi-threaded
+//        exactly-once delivery.
+
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "navary/messaging/mpmc_queue.h"
+#include "navary/messaging/spsc_queue.h"
+
+using namespace navary;
+using namespace navary::messaging;
+
+TEST_CASE("MpmcQueue: capacity rounds up and fills exactly",
+          "[messaging][mpmc]") {
+  MpmcQueue<std::uint32_t> q;
+  REQUIRE(q.Init(100).ok());
+  REQUIRE(q.capacity() == 128);
+  REQUIRE(q.Init(8).code() == NavaryStatus::kInvalidArgument);
+
+  for (std::uint32_t i = 0; i < 128; ++i) {
+    REQUIRE(q.TryPush(i));
+  }
+  REQUIRE_FALSE(q.TryPush(999));
+  REQUIRE(q.ApproxSize() == 128);
+
+  std::uint32_t v = 0;
+  for (std::uint32_t i = 0; i < 128; ++i) {
+    REQUIRE(q.TryPop(&v));
+    REQUIRE(v == i);
+  }
+  REQUIRE_FALSE(q.TryPop(&v));
+
+  // Wraps around cleanly.
+  for (std::uint32_t round = 0; round < 3; ++round) {
+    REQUIRE(q.TryPush(round));
+    REQUIRE(q.TryPop(&v));
+    REQUIRE(v == round);
+  }
+}
+
+TEST_CASE("MpmcQueue: concurrent producers and consumers lose nothing",
+          "[messaging][mpmc]") {
+  constexpr std::uint32_t kProducers = 4;
+  constexpr std::uint32_t kConsumers = 3;
+  constexpr std::uint32_t kPerProd   = 50000;
+
+  MpmcQueue<std::uint32_t> q;
+  REQUIRE(q.Init(1024).ok());
+
+  std::vector<std::atomic<std::uint8_t>> seen(kProducers * kPerProd);
+  std::atomic<std::uint32_t> consumed{0};
+
+  std::vector<std::thread> threads;
+  for (std::uint32_t p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&q, p] {
+      for (std::uint32_t i = 0; i < kPerProd; ++i) {
+        while (!q.TryPush(p * kPerProd + i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (std::uint32_t c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&] {
+      std::uint32_t v = 0;
+      while (consumed.load(std::memory_order_relaxed) <
+             kProducers * kPerProd) {
+        if (q.TryPop(&v)) {
+          seen[v].fetch_add(1, std::memory_order_relaxed);
+          consumed.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  for (const auto& s : seen) {
+    REQUIRE(s.load() == 1);
+  }
+}
+
+TEST_CASE("SpscQueue: FIFO across threads", "[messaging][spsc]") {
+  constexpr std::uint32_t kCount = 200000;
+  SpscQueue<std::uint32_t> q;
+  REQUIRE(q.Init(256).ok());
+  REQUIRE(q.capacity() == 256);
+
+  std::thread producer([&q] {
+    for (std::uint32_t i = 0; i < kCount; ++i) {
+      while (!q.TryPush(i)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::uint32_t expected = 0;
+  std::uint32_t v        = 0;
+  bool in_order          = true;
+  while (expected < kCount) {
+    if (q.TryPop(&v)) {
+      in_order = in_order && v == expected;
+      ++expected;
+    }
+  }
+  producer.join();
+  REQUIRE(in_order);
+  REQUIRE_FALSE(q.TryPop(&v));
+}
@@ -0,0 +1,294 @@
+// Navary Engine - Navigation Subsystem Tests
+// File: tests/nav/nav_mesh_test.cc
+// Focus: grid lookup, adjacency, winding normalization, A* corridors,
+//        sliced search and funnel corners.
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "navary/nav/nav_mesh.h"
+#include "navary/nav/nav_query.h"
+
+using namespace navary;
+using namespace navary::nav;
+using navary::math::Vec3;
+
+namespace {
+
+// w x h unit quads on y = 0; cells where blocked(x, z) is true are holes.
+struct GridMesh {
+  std::vector<Vec3> vertices;
+  std::vector<std::uint32_t> polys;
+  std::vector<int> cell_poly;  // -1 for holes
+  NavMesh mesh;
+
+  template <typename Blocked>
+  GridMesh(std::uint32_t w, std::uint32_t h, Blocked blocked,
+           bool clockwise = false) {
+    for (std::uint32_t z = 0; z <= h; ++z) {
+      for (std::uint32_t x = 0; x <= w; ++x) {
+        vertices.emplace_back(static_cast<float>(x), 0.0f,
+                              static_cast<float>(z));
+      }
+    }
+    const auto v = [w](std::uint32_t x, std::uint32_t z) {
+      return z * (w + 1) + x;
+    };
+    int next = 0;
+    for (std::uint32_t z = 0; z < h; ++z) {
+      for (std::uint32_t x = 0; x < w; ++x) {
+        if (blocked(x, z)) {
+          cell_poly.push_back(-1);
+          continue;
+        }
+        cell_poly.push_back(next++);
+        std::uint32_t quad[4] = {v(x, z), v(x + 1, z), v(x + 1, z + 1),
+                                 v(x, z + 1)};
+        if (clockwise) {
+          std::swap(quad[1], quad[3]);
+        }
+        polys.insert(polys.end(), quad, quad + 4);
+        polys.insert(polys.end(), {kInvalidNavPoly, kInvalidNavPoly});
+      }
+    }
+    NavMeshDesc desc;
+    desc.vertices     = vertices.data();
+    desc.vertex_count = static_cast<std::uint32_t>(vertices.size());
+    desc.polys        = polys.data();
+    desc.poly_count   = static_cast<std::uint32_t>(next);
+    desc.cell_size    = 2.0f;
+    REQUIRE(mesh.Init(desc).ok());
+  }
+};
+
+bool NoHoles(std::uint32_t, std::uint32_t) {
+  return false;
+}
+
+std::uint32_t NeighborCount(const NavPoly& poly) {
+  std::uint32_t n = 0;
+  for (std::uint32_t i = 0; i < poly.vert_count; ++i) {
+    n += poly.neighbors[i] != kInvalidNavPoly ? 1 : 0;
+  }
+  return n;
+}
+
+// True when every sample along the polyline lies on the mesh.
+bool PolylineOnMesh(const NavMesh& mesh, const Vec3* points,
+                    std::uint32_t count) {
+  for (std::uint32_t i = 0; i + 1 < count; ++i) {
+    for (int s = 0; s <= 16; ++s) {
+      const Vec3 p = points[i] + (points[i + 1] - points[i]) * (s / 16.0f);
+      if (mesh.FindNearestPoly(p, 1e-3f) == kInvalidNavPoly) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST_CASE("NavMesh: rejects invalid descriptors", "[nav][mesh]") {
+  NavMesh mesh;
+  REQUIRE(mesh.Init(NavMeshDesc{}).code() == NavaryStatus::kInvalidArgument);
+
+  const Vec3 verts[3] = {{0, 0, 0}, {1, 0, 0}, {0, 0, 1}};
+  const std::uint32_t degenerate[kMaxNavPolyVerts] = {
+      0, 1, kInvalidNavPoly, kInvalidNavPoly, kInvalidNavPoly,
+      kInvalidNavPoly};
+  NavMeshDesc desc;
+  desc.vertices     = verts;
+  desc.vertex_count = 3;
+  desc.polys        = degenerate;
+  desc.poly_count   = 1;
+  REQUIRE(mesh.Init(desc).code() == NavaryStatus::kInvalidArgument);
+  REQUIRE_FALSE(mesh.valid());
+}
+
+TEST_CASE("NavMesh: adjacency from shared edges", "[nav][mesh]") {
+  GridMesh g(4, 3, NoHoles);
+  REQUIRE(g.mesh.poly_count() == 12);
+  REQUIRE(NeighborCount(g.mesh.poly(g.cell_poly[0])) == 2);       // corner
+  REQUIRE(NeighborCount(g.mesh.poly(g.cell_poly[1])) == 3);       // border
+  REQUIRE(NeighborCount(g.mesh.poly(g.cell_poly[4 + 1])) == 4);   // inner
+
+  // Symmetric links.
+  for (NavPolyRef p = 0; p < g.mesh.poly_count(); ++p) {
+    const NavPoly& poly = g.mesh.poly(p);
+    for (std::uint32_t e = 0; e < poly.vert_count; ++e) {
+      const NavPolyRef n = poly.neighbors[e];
+      if (n == kInvalidNavPoly) {
+        continue;
+      }
+      Vec3 l;
+      Vec3 r;
+      REQUIRE(g.mesh.PortalPoints(n, p, &l, &r));
+    }
+  }
+}
+
+TEST_CASE("NavMesh: grid lookup inside, near and far", "[nav][mesh]") {
+  GridMesh g(8, 8, [](std::uint32_t x, std::uint32_t z) {
+    return x == 4 && z == 4;
+  });
+
+  Vec3 on;
+  REQUIRE(g.mesh.FindNearestPoly(Vec3(2.5f, 3.0f, 6.5f), 0.5f, &on) ==
+          static_cast<NavPolyRef>(g.cell_poly[6 * 8 + 2]));
+  REQUIRE(on.x == Catch::Approx(2.5f));
+  REQUIRE(on.y == Catch::Approx(0.0f));
+  REQUIRE(on.z == Catch::Approx(6.5f));
+
+  // Inside the hole: snaps to a bordering cell within the radius.
+  const NavPolyRef near =
+      g.mesh.FindNearestPoly(Vec3(4.5f, 0.0f, 4.2f), 0.5f, &on);
+  REQUIRE(near == static_cast<NavPolyRef>(g.cell_poly[3 * 8 + 4]));
+  REQUIRE(on.z == Catch::Approx(4.0f));
+
+  REQUIRE(g.mesh.FindNearestPoly(Vec3(4.5f, 0.0f, 4.5f), 0.1f) ==
+          kInvalidNavPoly);
+  REQUIRE(g.mesh.FindNearestPoly(Vec3(-5.0f, 0.0f, 2.0f), 1.0f) ==
+          kInvalidNavPoly);
+}
+
+TEST_CASE("NavMesh: clockwise input is normalized", "[nav][mesh]") {
+  GridMesh ccw(3, 3, NoHoles, false);
+  GridMesh cw(3, 3, NoHoles, true);
+  const Vec3 p(1.5f, 0.0f, 1.5f);
+  REQUIRE(cw.mesh.FindNearestPoly(p, 0.0f) ==
+          ccw.mesh.FindNearestPoly(p, 0.0f));
+  REQUIRE(cw.mesh.ContainsXZ(cw.cell_poly[4], p));
+  REQUIRE(NeighborCount(cw.mesh.poly(cw.cell_poly[4])) == 4);
+}
+
+TEST_CASE("NavQuery: corridor around a wall", "[nav][query]") {
+  // Wall along z = 4 for x < 6; the only gap is on the right.
+  GridMesh g(8, 8, [](std::uint32_t x, std::uint32_t z) {
+    return z == 4 && x < 6;
+  });
+  NavQuery query;
+  REQUIRE(query.Init(&g.mesh).ok());
+
+  const Vec3 start(0.5f, 0.0f, 1.5f);
+  const Vec3 end(0.5f, 0.0f, 7.5f);
+  const NavPolyRef s = g.mesh.FindNearestPoly(start, 0.1f);
+  const NavPolyRef e = g.mesh.FindNearestPoly(end, 0.1f);
+
+  NavPolyRef corridor[64];
+  std::uint32_t count = 0;
+  REQUIRE(query.FindPath(s, e, start, end, corridor, 64, &count) ==
+          NavQueryStatus::kSuccess);
+  REQUIRE(corridor[0] == s);
+  REQUIRE(corridor[count - 1] == e);
+  for (std::uint32_t i = 0; i + 1 < count; ++i) {
+    Vec3 l;
+    Vec3 r;
+    REQUIRE(g.mesh.PortalPoints(corridor[i], corridor[i + 1], &l, &r));
+  }
+
+  // The funnel turns at the wall's end, (6, 4) then (6, 5), and stays
+  // close to the optimal length whatever staircase the corridor took.
+  Vec3 points[16];
+  const std::uint32_t n =
+      NavQuery::StraightPath(g.mesh, start, end, corridor, count, points, 16);
+  REQUIRE(n >= 4);
+  REQUIRE((points[0] - start).length() < 1e-5f);
+  REQUIRE((points[n - 1] - end).length() < 1e-5f);
+  const Vec3 wall_a(6.0f, 0.0f, 4.0f);
+  const Vec3 wall_b(6.0f, 0.0f, 5.0f);
+  bool corner_a = false;
+  bool corner_b = false;
+  float length  = 0.0f;
+  for (std::uint32_t i = 0; i < n; ++i) {
+    corner_a = corner_a || (points[i] - wall_a).length() < 1e-5f;
+    corner_b = corner_b || (points[i] - wall_b).length() < 1e-5f;
+    length += i > 0 ? (points[i] - points[i - 1]).length() : 0.0f;
+  }
+  REQUIRE(corner_a);
+  REQUIRE(corner_b);
+  const float optimal =
+      (wall_a - start).length() + 1.0f + (end - wall_b).length();
+  REQUIRE(length <= optimal * 1.05f);
+  REQUIRE(PolylineOnMesh(g.mesh, points, n));
+}
+
+TEST_CASE("NavQuery: open row is a straight line", "[nav][query]") {
+  GridMesh g(10, 3, NoHoles);
+  NavQuery query;
+  REQUIRE(query.Init(&g.mesh).ok());
+
+  const Vec3 start(0.2f, 0.0f, 1.3f);
+  const Vec3 end(9.7f, 0.0f, 1.6f);
+  NavPolyRef corridor[64];
+  std::uint32_t count = 0;
+  REQUIRE(query.FindPath(g.mesh.FindNearestPoly(start, 0.1f),
+                         g.mesh.FindNearestPoly(end, 0.1f), start, end,
+                         corridor, 64, &count) == NavQueryStatus::kSuccess);
+  Vec3 points[16];
+  REQUIRE(NavQuery::StraightPath(g.mesh, start, end, corridor, count, points,
+                                 16) == 2);
+}
+
+TEST_CASE("NavQuery: unreachable goal yields closest partial corridor",
+          "[nav][query]") {
+  // Column x = 5 is solid: two disconnected halves.
+  GridMesh g(10, 4, [](std::uint32_t x, std::uint32_t) { return x == 5; });
+  NavQuery query;
+  REQUIRE(query.Init(&g.mesh).ok());
+
+  const Vec3 start(0.5f, 0.0f, 0.5f);
+  const Vec3 end(9.5f, 0.0f, 2.5f);
+  NavPolyRef corridor[64];
+  std::uint32_t count = 0;
+  REQUIRE(query.FindPath(g.mesh.FindNearestPoly(start, 0.1f),
+                         g.mesh.FindNearestPoly(end, 0.1f), start, end,
+                         corridor, 64, &count) == NavQueryStatus::kPartial);
+  // Ends against the solid column, as near the goal as it gets.
+  REQUIRE(g.mesh.poly(corridor[count - 1]).center.x == Catch::Approx(4.5f));
+}
+
+TEST_CASE("NavQuery: sliced search matches one-shot", "[nav][query]") {
+  GridMesh g(16, 16, [](std::uint32_t x, std::uint32_t z) {
+    return (z % 4 == 2 && x > 1 && x < 15) || (x == 8 && z > 3 && z < 12);
+  });
+  NavQuery one_shot;
+  NavQuery sliced;
+  REQUIRE(one_shot.Init(&g.mesh).ok());
+  REQUIRE(sliced.Init(&g.mesh).ok());
+
+  const Vec3 start(0.5f, 0.0f, 0.5f);
+  const Vec3 end(15.5f, 0.0f, 15.5f);
+  const NavPolyRef s = g.mesh.FindNearestPoly(start, 0.1f);
+  const NavPolyRef e = g.mesh.FindNearestPoly(end, 0.1f);
+
+  NavPolyRef a[256];
+  std::uint32_t a_count = 0;
+  REQUIRE(one_shot.FindPath(s, e, start, end, a, 256, &a_count) ==
+          NavQueryStatus::kSuccess);
+
+  REQUIRE(sliced.BeginPath(s, e, start, end) == NavQueryStatus::kInProgress);
+  std::uint32_t steps = 0;
+  while (sliced.Step(3) == NavQueryStatus::kInProgress) {
+    ++steps;
+  }
+  REQUIRE(steps > 5);
+  REQUIRE(sliced.status() == NavQueryStatus::kSuccess);
+
+  NavPolyRef b[256];
+  const std::uint32_t b_count = sliced.FinishPath(b, 256);
+  REQUIRE(b_count == a_count);
+  for (std::uint32_t i = 0; i < a_count; ++i) {
+    REQUIRE(a[i] == b[i]);
+  }
+
+  // Queries are reusable; a truncated corridor keeps the start.
+  NavPolyRef c[4];
+  std::uint32_t c_count = 0;
+  one_shot.FindPath(s, e, start, end, c, 4, &c_count);
+  REQUIRE(c_count == 4);
+  REQUIRE(c[0] == s);
+  REQUIRE(c[3] == a[3]);
+}
@@ -0,0 +1,314 @@
+// Navary Engine - Navigation Subsystem Tests
+// File: tests/nav/nav_service_test.cc
+// Focus: request lifecycle, path cache, time-sliced searches, spline
+//        output and many agents solved on job workers.
+
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "navary/core/scheduler/job_system.h"
+#include "navary/nav/nav_service.h"
+
+using namespace navary;
+using namespace navary::nav;
+using navary::core::scheduler::JobSystem;
+using navary::math::Vec3;
+
+namespace {
+
+// w x h unit quads with a comb of walls: every fourth row is solid except
+// for a gap that alternates sides, so crossing rows forces long detours.
+struct CombMesh {
+  std::vector<Vec3> vertices;
+  std::vector<std::uint32_t> polys;
+  NavMesh mesh;
+
+  CombMesh(std::uint32_t w, std::uint32_t h) {
+    for (std::uint32_t z = 0; z <= h; ++z) {
+      for (std::uint32_t x = 0; x <= w; ++x) {
+        vertices.emplace_back(static_cast<float>(x), 0.0f,
+                              static_cast<float>(z));
+      }
+    }
+    std::uint32_t count = 0;
+    for (std::uint32_t z = 0; z < h; ++z) {
+      const bool wall   = z % 4 == 3;
+      const bool gap_hi = (z / 4) % 2 == 0;
+      for (std::uint32_t x = 0; x < w; ++x) {
+        if (wall && (gap_hi ? x != w - 1 : x != 0)) {
+          continue;
+        }
+        const std::uint32_t v0 = z * (w + 1) + x;
+        polys.insert(polys.end(), {v0, v0 + 1, v0 + w + 2, v0 + w + 1,
+                                   kInvalidNavPoly, kInvalidNavPoly});
+        ++count;
+      }
+    }
+    NavMeshDesc desc;
+    desc.vertices     = vertices.data();
+    desc.vertex_count = static_cast<std::uint32_t>(vertices.size());
+    desc.polys        = polys.data();
+    desc.poly_count   = count;
+    REQUIRE(mesh.Init(desc).ok());
+  }
+};
+
+NavPathRequest Request(Vec3 start, Vec3 end,
+                       NavSplineKind spline = NavSplineKind::kRn) {
+  NavPathRequest r;
+  r.start  = start;
+  r.end    = end;
+  r.spline = spline;
+  return r;
+}
+
+}  // namespace
+
+TEST_CASE("NavService: request lifecycle", "[nav][service]") {
+  CombMesh m(8, 8);
+  NavService service;
+  REQUIRE(service.Init(NavServiceDesc{}, &m.mesh, nullptr).ok());
+
+  const Vec3 start(0.5f, 0.0f, 0.5f);
+  const Vec3 end(0.5f, 0.0f, 7.5f);
+  const NavPathId id = service.RequestPath(Request(start, end)).value();
+  REQUIRE(service.state(id) == NavPathState::kQueued);
+
+  NavPath path;
+  REQUIRE_FALSE(service.GetPath(id, &path));
+  service.Update();
+  REQUIRE(service.state(id) == NavPathState::kReady);
+  REQUIRE(service.GetPath(id, &path));
+  REQUIRE(path.status == NavQueryStatus::kSuccess);
+  REQUIRE_FALSE(path.from_cache);
+  REQUIRE(path.point_count >= 4);  // detours through both gaps
+  REQUIRE(path.rn_spline != nullptr);
+  REQUIRE(path.tn_spline == nullptr);
+
+  const Vec3 a = path.rn_spline->GetPosition(0.0f);
+  const Vec3 b = path.rn_spline->GetPosition(1.0f);
+  REQUIRE((a - start).length() < 1e-4f);
+  REQUIRE((b - end).length() < 1e-4f);
+
+  service.Release(id);
+  REQUIRE(service.state(id) == NavPathState::kInvalid);
+  REQUIRE_FALSE(service.GetPath(id, &path));
+
+  // The slot is reused under a new id; the stale one stays invalid.
+  const NavPathId again = service.RequestPath(Request(start, end)).value();
+  REQUIRE(again != id);
+  REQUIRE((again & 0xFFFF) == (id & 0xFFFF));
+  REQUIRE(service.state(id) == NavPathState::kInvalid);
+}
+
+TEST_CASE("NavService: off-mesh endpoints fail, full table reports OOM",
+          "[nav][service]") {
+  CombMesh m(4, 4);
+  NavServiceDesc desc;
+  desc.max_requests = 2;
+  NavService service;
+  REQUIRE(service.Init(desc, &m.mesh, nullptr).ok());
+
+  const NavPathId bad =
+      service
+          .RequestPath(Request(Vec3(0.5f, 0, 0.5f), Vec3(50.0f, 0, 50.0f)))
+          .value();
+  const NavPathId ok =
+      service.RequestPath(Request(Vec3(0.5f, 0, 0.5f), Vec3(3.5f, 0, 2.5f)))
+          .value();
+  REQUIRE(service.RequestPath(Request(Vec3(), Vec3())).status().code() ==
+          NavaryStatus::kOutOfMemory);
+
+  service.Update();
+  REQUIRE(service.state(bad) == NavPathState::kFailed);
+  REQUIRE(service.state(ok) == NavPathState::kReady);
+  REQUIRE(service.stats().failed == 1);
+}
+
+TEST_CASE("NavService: cache hits reuse corridors by poly pair",
+          "[nav][service]") {
+  CombMesh m(8, 8);
+  NavServiceDesc desc;
+  desc.cache_ttl_updates = 3;
+  NavService service;
+  REQUIRE(service.Init(desc, &m.mesh, nullptr).ok());
+
+  const NavPathId first =
+      service.RequestPath(Request(Vec3(0.5f, 0, 0.5f), Vec3(0.5f, 0, 7.5f)))
+          .value();
+  service.Update();
+
+  // Different points inside the same start and end polygons.
+  const NavPathId second =
+      service
+          .RequestPath(Request(Vec3(0.2f, 0, 0.8f), Vec3(0.7f, 0, 7.3f)))
+          .value();
+  service.Update();
+
+  NavPath a;
+  NavPath b;
+  REQUIRE(service.GetPath(first, &a));
+  REQUIRE(service.GetPath(second, &b));
+  REQUIRE_FALSE(a.from_cache);
+  REQUIRE(b.from_cache);
+  REQUIRE(a.corridor_count == b.corridor_count);
+  for (std::uint32_t i = 0; i < a.corridor_count; ++i) {
+    REQUIRE(a.corridor[i] == b.corridor[i]);
+  }
+  REQUIRE(b.points[0].x == Catch::Approx(0.2f));
+  REQUIRE(b.points[b.point_count - 1].z == Catch::Approx(7.3f));
+  REQUIRE(service.stats().cache_hits == 1);
+  REQUIRE(service.stats().cache_misses == 1);
+
+  // Expired after the TTL.
+  for (int i = 0; i < 4; ++i) {
+    service.Update();
+  }
+  const NavPathId third =
+      service.RequestPath(Request(Vec3(0.5f, 0, 0.5f), Vec3(0.5f, 0, 7.5f)))
+          .value();
+  service.Update();
+  NavPath c;
+  REQUIRE(service.GetPath(third, &c));
+  REQUIRE_FALSE(c.from_cache);
+
+  // Explicit invalidation.
+  service.InvalidateCache();
+  const NavPathId fourth =
+      service.RequestPath(Request(Vec3(0.5f, 0, 0.5f), Vec3(0.5f, 0, 7.5f)))
+          .value();
+  service.Update();
+  REQUIRE(service.GetPath(fourth, &c));
+  REQUIRE_FALSE(c.from_cache);
+}
+
+TEST_CASE("NavService: long searches are sliced across updates",
+          "[nav][service]") {
+  CombMesh m(16, 32);
+  NavServiceDesc desc;
+  desc.iterations_per_request = 8;
+  desc.slice_iterations       = 16;
+  desc.max_sliced             = 1;
+  NavService service;
+  REQUIRE(service.Init(desc, &m.mesh, nullptr).ok());
+
+  const NavPathId far =
+      service
+          .RequestPath(Request(Vec3(0.5f, 0, 0.5f), Vec3(0.5f, 0, 31.5f)))
+          .value();
+  const NavPathId far2 =
+      service
+          .RequestPath(Request(Vec3(1.5f, 0, 0.5f), Vec3(2.5f, 0, 31.5f)))
+          .value();
+  const NavPathId near =
+      service.RequestPath(Request(Vec3(0.5f, 0, 0.5f), Vec3(2.5f, 0, 1.5f)))
+          .value();
+
+  service.Update();
+  REQUIRE(service.state(far) == NavPathState::kSearching);
+  REQUIRE(service.state(far2) == NavPathState::kQueued);  // no free slice
+  REQUIRE(service.state(near) == NavPathState::kReady);
+
+  std::uint32_t updates = 1;
+  while (service.state(far2) != NavPathState::kReady && updates < 200) {
+    service.Update();
+    ++updates;
+  }
+  REQUIRE(updates > 4);
+  REQUIRE(service.state(far) == NavPathState::kReady);
+  REQUIRE(service.stats().sliced == 2);
+
+  NavPath path;
+  REQUIRE(service.GetPath(far, &path));
+  REQUIRE(path.status == NavQueryStatus::kSuccess);
+  REQUIRE(path.points[path.point_count - 1].z == Catch::Approx(31.5f));
+
+  // Releasing mid-search frees the sliced query for the next request.
+  const NavPathId cancelled =
+      service
+          .RequestPath(Request(Vec3(3.5f, 0, 0.5f), Vec3(4.5f, 0, 31.5f)))
+          .value();
+  service.Update();
+  REQUIRE(service.state(cancelled) == NavPathState::kSearching);
+  service.Release(cancelled);
+  const NavPathId next =
+      service
+          .RequestPath(Request(Vec3(5.5f, 0, 0.5f), Vec3(6.5f, 0, 31.5f)))
+          .value();
+  service.Update();
+  REQUIRE(service.state(next) == NavPathState::kSearching);
+}
+
+TEST_CASE("NavService: TnSpline timed by segment length over speed",
+          "[nav][service]") {
+  CombMesh m(8, 8);
+  NavService service;
+  REQUIRE(service.Init(NavServiceDesc{}, &m.mesh, nullptr).ok());
+
+  NavPathRequest r =
+      Request(Vec3(0.5f, 0, 0.5f), Vec3(0.5f, 0, 7.5f), NavSplineKind::kTn);
+  r.speed            = 4.0f;
+  const NavPathId id = service.RequestPath(r).value();
+  service.Update();
+
+  NavPath path;
+  REQUIRE(service.GetPath(id, &path));
+  REQUIRE(path.tn_spline != nullptr);
+  REQUIRE(path.rn_spline == nullptr);
+  float length = 0.0f;
+  for (std::uint32_t i = 1; i < path.point_count; ++i) {
+    length += (path.points[i] - path.points[i - 1]).length();
+  }
+  REQUIRE(path.tn_spline->TotalParam() == Catch::Approx(length / 4.0f));
+  REQUIRE(path.tn_spline->Count() == static_cast<int>(path.point_count));
+}
+
+TEST_CASE("NavService: many agents on job workers", "[nav][service]") {
+  CombMesh m(32, 32);
+  JobSystem jobs;
+  REQUIRE(jobs.Init(3).ok());
+
+  NavServiceDesc desc;
+  desc.max_requests            = 512;
+  desc.max_requests_per_update = 128;
+  desc.max_path_polys          = 512;  // comb corridors zigzag every row
+  desc.iterations_per_request  = 4096;
+  NavService service;
+  REQUIRE(service.Init(desc, &m.mesh, &jobs).ok());
+
+  std::vector<NavPathId> ids;
+  for (std::uint32_t i = 0; i < 400; ++i) {
+    const Vec3 start(0.5f + static_cast<float>(i % 32), 0.0f,
+                     0.5f + static_cast<float>((i * 7) % 3));
+    const Vec3 end(0.5f + static_cast<float>((i * 13) % 32), 0.0f,
+                   28.5f + static_cast<float>(i % 3));
+    ids.push_back(service.RequestPath(Request(start, end)).value());
+  }
+
+  std::uint32_t updates = 0;
+  bool all_ready        = false;
+  while (!all_ready && updates < 100) {
+    service.Update();
+    ++updates;
+    all_ready = true;
+    for (NavPathId id : ids) {
+      all_ready = all_ready && service.state(id) == NavPathState::kReady;
+    }
+  }
+  REQUIRE(all_ready);
+  REQUIRE(updates >= 4);  // 128 per update
+
+  for (NavPathId id : ids) {
+    NavPath path;
+    REQUIRE(service.GetPath(id, &path));
+    REQUIRE(path.status == NavQueryStatus::kSuccess);
+    REQUIRE(path.point_count >= 2);
+  }
+  const NavServiceStats stats = service.stats();
+  REQUIRE(stats.completed == 400);
+  REQUIRE(stats.cache_hits + stats.cache_misses == 400);
+  REQUIRE(stats.cache_hits > 0);  // repeated start/end poly pairs
+  jobs.Shutdown();
+}
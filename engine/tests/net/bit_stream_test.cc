@@ -0,0 +1,153 @@
+// Navary Engine - Net Subsystem Tests
+// File: tests/net/bit_stream_test.cc
+// Focus: bit packing round trips, overflow flags, Fixed range quantization
+//        bounds, smallest-three quaternion accuracy.
+
+#include <catch2/catch_all.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "navary/net/bit_stream.h"
+#include "navary/net/quantize.h"
+
+using namespace navary;
+using namespace navary::net;
+
+namespace {
+
+using F = math::Fixed15p16;
+
+math::FixedQuat MakeQuat(double x, double y, double z, double w) {
+  const double len = std::sqrt(x * x + y * y + z * z + w * w);
+  return math::FixedQuat{F::FromFloat(static_cast<float>(x / len)),
+                         F::FromFloat(static_cast<float>(y / len)),
+                         F::FromFloat(static_cast<float>(z / len)),
+                         F::FromFloat(static_cast<float>(w / len))};
+}
+
+// |dot(q, r)|: q and -q are the same rotation.
+double QuatDot(const math::FixedQuat& q, const math::FixedQuat& r) {
+  const double d = q.x.ToDouble() * r.x.ToDouble() +
+                   q.y.ToDouble() * r.y.ToDouble() +
+                   q.z.ToDouble() * r.z.ToDouble() +
+                   q.w.ToDouble() * r.w.ToDouble();
+  return std::fabs(d);
+}
+
+}  // namespace
+
+TEST_CASE("BitStream: mixed widths round trip", "[net][bitstream]") {
+  std::uint8_t buffer[256] = {};
+  BitWriter w(memory::Span<std::uint8_t>(buffer, sizeof(buffer)));
+
+  std::uint32_t seed = 12345;
+  std::vector<std::uint32_t> values;
+  std::vector<std::uint32_t> widths;
+  for (int i = 0; i < 60; ++i) {
+    seed                     = seed * 1664525u + 1013904223u;
+    const std::uint32_t bits = 1 + (seed >> 27);  // 1..32
+    const std::uint32_t v =
+        bits == 32 ? seed : seed & ((1u << bits) - 1);
+    values.push_back(v);
+    widths.push_back(bits);
+    w.WriteBits(v, bits);
+  }
+  w.WriteBool(true);
+  const std::size_t total_bits = w.bits_written();
+  const std::size_t bytes      = w.Finish();
+  REQUIRE_FALSE(w.overflowed());
+  REQUIRE(bytes == (total_bits + 7) / 8);
+
+  BitReader r(memory::Span<const std::uint8_t>(buffer, bytes));
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    REQUIRE(r.ReadBits(widths[i]) == values[i]);
+  }
+  REQUIRE(r.ReadBool());
+  REQUIRE(r.bits_read() == total_bits);
+  REQUIRE_FALSE(r.overflowed());
+}
+
+TEST_CASE("BitStream: writer overflow is sticky", "[net][bitstream]") {
+  std::uint8_t buffer[6] = {};
+  BitWriter w(memory::Span<std::uint8_t>(buffer, sizeof(buffer)));
+  w.WriteBits(0xDEADBEEF, 32);
+  REQUIRE_FALSE(w.overflowed());
+  w.WriteBits(0x12345678, 32);  // second word does not fit in 2 bytes
+  REQUIRE(w.overflowed());
+  w.WriteBits(1, 1);
+  REQUIRE(w.overflowed());
+}
+
+TEST_CASE("BitStream: reader past end returns zero", "[net][bitstream]") {
+  const std::uint8_t data[3] = {0xAB, 0xCD, 0xEF};
+  BitReader r(memory::Span<const std::uint8_t>(data, sizeof(data)));
+  REQUIRE(r.ReadBits(8) == 0xAB);
+  REQUIRE(r.ReadBits(16) == 0xEFCD);
+  REQUIRE_FALSE(r.overflowed());
+  REQUIRE(r.ReadBits(1) == 0);
+  REQUIRE(r.overflowed());
+}
+
+TEST_CASE("Quantize: Fixed error stays within half a step",
+          "[net][quantize]") {
+  const FixedRange range{F::FromInt(-1024), F::FromInt(1024), 16};
+  const double step = 2048.0 / ((1 << 16) - 1);
+
+  for (int i = -1024; i < 1024; i += 7) {
+    const int frac = ((i + 1024) * 7919) % F::kOneRaw;
+    const F v      = F::FromRaw(i * F::kOneRaw + frac);
+    const std::uint32_t q = QuantizeFixed(v, range);
+    REQUIRE(q < (1u << 16));
+    const F back = DequantizeFixed(q, range);
+    REQUIRE(std::fabs(back.ToDouble() - v.ToDouble()) <=
+            step * 0.5 + 1.0 / F::kOneRaw);
+  }
+
+  // Ends are exact; out-of-range input clamps.
+  REQUIRE(DequantizeFixed(QuantizeFixed(range.min, range), range) ==
+          range.min);
+  REQUIRE(DequantizeFixed(QuantizeFixed(range.max, range), range) ==
+          range.max);
+  REQUIRE(QuantizeFixed(F::FromInt(5000), range) == (1u << 16) - 1);
+  REQUIRE(QuantizeFixed(F::FromInt(-5000), range) == 0);
+}
+
+TEST_CASE("Quantize: vectors use the range per component",
+          "[net][quantize]") {
+  const FixedRange range{F::FromInt(-16), F::FromInt(16), 12};
+  const math::FixedVec3 v(F::FromFloat(1.5f), F::FromFloat(-3.25f),
+                          F::FromFloat(15.0f));
+  const math::FixedVec3 back = DequantizeVec3(QuantizeVec3(v, range), range);
+  const double step          = 32.0 / 4095.0;
+  REQUIRE(std::fabs(back.x.ToDouble() - 1.5) <= step);
+  REQUIRE(std::fabs(back.y.ToDouble() + 3.25) <= step);
+  REQUIRE(std::fabs(back.z.ToDouble() - 15.0) <= step);
+}
+
+TEST_CASE("Quantize: smallest-three quaternion accuracy",
+          "[net][quantize]") {
+  REQUIRE(QuatPackedBits(10) == 32);
+
+  const math::FixedQuat cases[] = {
+      MakeQuat(0, 0, 0, 1),         MakeQuat(1, 0, 0, 0),
+      MakeQuat(0.3, -0.5, 0.1, 0.8), MakeQuat(-0.7, 0.1, 0.6, -0.2),
+      MakeQuat(0.5, 0.5, 0.5, 0.5),  MakeQuat(0.1, -0.9, 0.05, 0.3),
+  };
+  for (const math::FixedQuat& q : cases) {
+    const std::uint32_t packed = QuantizeQuat(q, 10);
+    REQUIRE(packed < (std::uint64_t{1} << QuatPackedBits(10)));
+    const math::FixedQuat back = DequantizeQuat(packed, 10);
+    REQUIRE(QuatDot(q, back) > 0.9999);
+
+    // Deterministic: the same packing always rebuilds the same raw values.
+    const math::FixedQuat again = DequantizeQuat(packed, 10);
+    REQUIRE(again.x.Raw() == back.x.Raw());
+    REQUIRE(again.w.Raw() == back.w.Raw());
+  }
+
+  // Fewer bits trade accuracy for size but still land close.
+  const math::FixedQuat q = MakeQuat(0.3, -0.5, 0.1, 0.8);
+  REQUIRE(QuatDot(q, DequantizeQuat(QuantizeQuat(q, 7), 7)) > 0.999);
+}
@@ -0,0 +1,288 @@
+// Navary Engine - Net Subsystem Tests
+// File: tests/net/snapshot_codec_test.cc
+// Focus: full and delta snapshot round trips, entity add/remove against a
+//        baseline, baseline mismatch, buffer limits, arena-backed storage.
+
+#include <catch2/catch_all.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "navary/memory/arena.h"
+#include "navary/net/snapshot_codec.h"
+
+using namespace navary;
+using namespace navary::net;
+
+namespace {
+
+using F = math::Fixed15p16;
+
+SnapshotSchema MakeSchema() {
+  SnapshotSchema s;
+  s.position = FixedRange{F::FromInt(-4096), F::FromInt(4096), 20};
+  s.velocity = FixedRange{F::FromInt(-64), F::FromInt(64), 14};
+  return s;
+}
+
+NetEntityState MakeEntity(std::uint32_t id, int step) {
+  NetEntityState e;
+  e.id       = id;
+  e.position = math::FixedVec3(F::FromInt(static_cast<int>(id) * 3 + step),
+                               F::FromInt(0),
+                               F::FromInt(-static_cast<int>(id)));
+  e.rotation = math::FixedQuat(F::FromInt(0), F::FromInt(0), F::FromInt(0),
+                               F::FromInt(1));
+  e.velocity = math::FixedVec3(F::FromInt(1), F::FromInt(0), F::FromInt(0));
+  e.flags    = id & 0xF;
+  return e;
+}
+
+struct SnapshotStorage {
+  std::vector<QuantizedEntityState> entities;
+  QuantizedSnapshot snapshot;
+
+  explicit SnapshotStorage(std::uint32_t capacity)
+      : entities(capacity), snapshot{0, entities.data(), 0, capacity} {}
+};
+
+void Fill(const SnapshotCodec& codec, std::uint32_t tick,
+          const std::vector<NetEntityState>& in, SnapshotStorage* out) {
+  out->snapshot.tick  = tick;
+  out->snapshot.count = static_cast<std::uint32_t>(in.size());
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    codec.Quantize(in[i], &out->entities[i]);
+  }
+}
+
+bool SameEntity(const QuantizedEntityState& a, const QuantizedEntityState& b) {
+  return a.id == b.id && a.position.x == b.position.x &&
+         a.position.y == b.position.y && a.position.z == b.position.z &&
+         a.rotation == b.rotation && a.velocity.x == b.velocity.x &&
+         a.velocity.y == b.velocity.y && a.velocity.z == b.velocity.z &&
+         a.flags == b.flags;
+}
+
+void RequireSame(const QuantizedSnapshot& a, const QuantizedSnapshot& b) {
+  REQUIRE(a.tick == b.tick);
+  REQUIRE(a.count == b.count);
+  for (std::uint32_t i = 0; i < a.count; ++i) {
+    REQUIRE(SameEntity(a.entities[i], b.entities[i]));
+  }
+}
+
+// Writes then reads back; returns the encoded size in bytes.
+std::size_t RoundTrip(const SnapshotCodec& codec,
+                      const QuantizedSnapshot& current,
+                      const QuantizedSnapshot* baseline,
+                      QuantizedSnapshot* decoded,
+                      SnapshotWriteStats* stats = nullptr) {
+  std::vector<std::uint8_t> buffer(64 * 1024);
+  BitWriter w(memory::Span<std::uint8_t>(buffer.data(), buffer.size()));
+  REQUIRE(codec.Write(current, baseline, &w, stats).ok());
+  const std::size_t bytes = w.Finish();
+
+  BitReader r(memory::Span<const std::uint8_t>(buffer.data(), bytes));
+  REQUIRE(codec.Read(&r, baseline, decoded).ok());
+  return bytes;
+}
+
+std::vector<NetEntityState> World(std::uint32_t n, int step) {
+  std::vector<NetEntityState> out;
+  for (std::uint32_t i = 0; i < n; ++i) {
+    out.push_back(MakeEntity(i * 2 + 10, step));
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST_CASE("SnapshotCodec: quantize round trip stays close",
+          "[net][snapshot]") {
+  const SnapshotCodec codec(MakeSchema());
+  NetEntityState e = MakeEntity(7, 0);
+  e.position.x     = F::FromFloat(123.456f);
+  e.velocity.y     = F::FromFloat(-2.5f);
+
+  QuantizedEntityState q;
+  codec.Quantize(e, &q);
+  NetEntityState back;
+  codec.Dequantize(q, &back);
+
+  REQUIRE(back.id == 7);
+  REQUIRE(back.flags == e.flags);
+  REQUIRE(std::abs(back.position.x.ToDouble() - 123.456) < 0.01);
+  REQUIRE(std::abs(back.velocity.y.ToDouble() + 2.5) < 0.01);
+  REQUIRE(back.rotation.w.ToDouble() > 0.999);
+}
+
+TEST_CASE("SnapshotCodec: full snapshot round trip", "[net][snapshot]") {
+  const SnapshotCodec codec(MakeSchema());
+  SnapshotStorage current(64);
+  SnapshotStorage decoded(64);
+  Fill(codec, 100, World(50, 0), &current);
+
+  SnapshotWriteStats stats{};
+  RoundTrip(codec, current.snapshot, nullptr, &decoded.snapshot, &stats);
+  RequireSame(current.snapshot, decoded.snapshot);
+  REQUIRE(stats.full == 50);
+  REQUIRE(stats.delta == 0);
+}
+
+TEST_CASE("SnapshotCodec: delta against baseline is smaller and exact",
+          "[net][snapshot]") {
+  const SnapshotCodec codec(MakeSchema());
+  SnapshotStorage base(64);
+  SnapshotStorage current(64);
+  SnapshotStorage decoded(64);
+  Fill(codec, 100, World(50, 0), &base);
+
+  // Every fifth entity moves a little; the rest are idle.
+  std::vector<NetEntityState> next = World(50, 0);
+  for (std::size_t i = 0; i < next.size(); i += 5) {
+    next[i].position.x = next[i].position.x + F::FromFloat(0.01f);
+  }
+  Fill(codec, 101, next, &current);
+
+  SnapshotStorage full_decoded(64);
+  const std::size_t full_bytes =
+      RoundTrip(codec, current.snapshot, nullptr, &full_decoded.snapshot);
+
+  SnapshotWriteStats stats{};
+  const std::size_t delta_bytes = RoundTrip(
+      codec, current.snapshot, &base.snapshot, &decoded.snapshot, &stats);
+
+  RequireSame(current.snapshot, decoded.snapshot);
+  REQUIRE(stats.delta == 10);
+  REQUIRE(stats.unchanged == 40);
+  REQUIRE(stats.full == 0);
+  REQUIRE(delta_bytes * 5 < full_bytes);
+}
+
+TEST_CASE("SnapshotCodec: large moves and field changes",
+          "[net][snapshot]") {
+  const SnapshotCodec codec(MakeSchema());
+  SnapshotStorage base(8);
+  SnapshotStorage current(8);
+  SnapshotStorage decoded(8);
+  Fill(codec, 1, World(4, 0), &base);
+
+  std::vector<NetEntityState> next = World(4, 0);
+  next[0].position.z = F::FromInt(2000);  // beyond the short-delta window
+  next[1].position.y = F::FromInt(-5);     // negative short move
+  next[2].rotation   = math::FixedQuat(F::FromFloat(0.6f), F::FromInt(0),
+                                       F::FromInt(0), F::FromFloat(0.8f));
+  next[3].flags      = 0xA5;
+  next[3].velocity.x = F::FromInt(-30);
+  Fill(codec, 2, next, &current);
+
+  SnapshotWriteStats stats{};
+  RoundTrip(codec, current.snapshot, &base.snapshot, &decoded.snapshot,
+            &stats);
+  RequireSame(current.snapshot, decoded.snapshot);
+  REQUIRE(stats.delta == 4);
+}
+
+TEST_CASE("SnapshotCodec: entities added and removed since baseline",
+          "[net][snapshot]") {
+  const SnapshotCodec codec(MakeSchema());
+  SnapshotStorage base(16);
+  SnapshotStorage current(16);
+  SnapshotStorage decoded(16);
+
+  std::vector<NetEntityState> before = {MakeEntity(1, 0), MakeEntity(2, 0),
+                                        MakeEntity(5, 0), MakeEntity(9, 0)};
+  // 2 and 9 removed, 3 and 100000 spawned (large id gap).
+  std::vector<NetEntityState> after = {MakeEntity(1, 0), MakeEntity(3, 0),
+                                       MakeEntity(5, 1),
+                                       MakeEntity(100000, 0)};
+  Fill(codec, 10, before, &base);
+  Fill(codec, 12, after, &current);
+
+  SnapshotWriteStats stats{};
+  RoundTrip(codec, current.snapshot, &base.snapshot, &decoded.snapshot,
+            &stats);
+  RequireSame(current.snapshot, decoded.snapshot);
+  REQUIRE(stats.unchanged == 1);
+  REQUIRE(stats.delta == 1);
+  REQUIRE(stats.full == 2);
+}
+
+TEST_CASE("SnapshotCodec: rejects bad input", "[net][snapshot]") {
+  const SnapshotCodec codec(MakeSchema());
+  SnapshotStorage base(8);
+  SnapshotStorage current(8);
+  Fill(codec, 1, World(4, 0), &base);
+  Fill(codec, 2, World(4, 1), &current);
+
+  std::uint8_t buffer[512];
+  SECTION("unsorted ids") {
+    std::swap(current.entities[0], current.entities[1]);
+    BitWriter w(memory::Span<std::uint8_t>(buffer, sizeof(buffer)));
+    REQUIRE(codec.Write(current.snapshot, nullptr, &w).code() ==
+            NavaryStatus::kInvalidArgument);
+  }
+  SECTION("output too small") {
+    BitWriter w(memory::Span<std::uint8_t>(buffer, 8));
+    REQUIRE(codec.Write(current.snapshot, nullptr, &w).code() ==
+            NavaryStatus::kOutOfMemory);
+  }
+  SECTION("baseline tick mismatch or missing") {
+    BitWriter w(memory::Span<std::uint8_t>(buffer, sizeof(buffer)));
+    REQUIRE(codec.Write(current.snapshot, &base.snapshot, &w).ok());
+    const std::size_t bytes = w.Finish();
+
+    SnapshotStorage other(8);
+    Fill(codec, 99, World(4, 0), &other);
+    SnapshotStorage decoded(8);
+    BitReader r1(memory::Span<const std::uint8_t>(buffer, bytes));
+    REQUIRE(codec.Read(&r1, &other.snapshot, &decoded.snapshot).code() ==
+            NavaryStatus::kInvalidArgument);
+    BitReader r2(memory::Span<const std::uint8_t>(buffer, bytes));
+    REQUIRE(codec.Read(&r2, nullptr, &decoded.snapshot).code() ==
+            NavaryStatus::kInvalidArgument);
+  }
+  SECTION("truncated stream and small capacity") {
+    BitWriter w(memory::Span<std::uint8_t>(buffer, sizeof(buffer)));
+    REQUIRE(codec.Write(current.snapshot, nullptr, &w).ok());
+    const std::size_t bytes = w.Finish();
+
+    SnapshotStorage decoded(8);
+    BitReader r1(memory::Span<const std::uint8_t>(buffer, bytes / 2));
+    REQUIRE(codec.Read(&r1, nullptr, &decoded.snapshot).code() ==
+            NavaryStatus::kParseError);
+
+    SnapshotStorage tiny(2);
+    BitReader r2(memory::Span<const std::uint8_t>(buffer, bytes));
+    REQUIRE(codec.Read(&r2, nullptr, &tiny.snapshot).code() ==
+            NavaryStatus::kOutOfMemory);
+  }
+}
+
+TEST_CASE("SnapshotCodec: arena-backed buffers", "[net][snapshot]") {
+  const SnapshotCodec codec(MakeSchema());
+  memory::Arena arena;
+
+  const std::uint32_t n = 200;
+  memory::Span<QuantizedEntityState> cur =
+      memory::Arena::MakeSpan<QuantizedEntityState>(arena, n);
+  memory::Span<QuantizedEntityState> dec =
+      memory::Arena::MakeSpan<QuantizedEntityState>(arena, n);
+  memory::Span<std::uint8_t> packet =
+      memory::Arena::MakeSpan<std::uint8_t>(arena, 8 * 1024);
+
+  QuantizedSnapshot current{5, cur.data(), n, n};
+  QuantizedSnapshot decoded{0, dec.data(), 0, n};
+  const std::vector<NetEntityState> world = World(n, 3);
+  for (std::uint32_t i = 0; i < n; ++i) {
+    codec.Quantize(world[i], &cur[i]);
+  }
+
+  BitWriter w(packet);
+  REQUIRE(codec.Write(current, nullptr, &w).ok());
+  const std::size_t bytes = w.Finish();
+  BitReader r(memory::Span<const std::uint8_t>(packet.data(), bytes));
+  REQUIRE(codec.Read(&r, nullptr, &decoded).ok());
+  RequireSame(current, decoded);
+}
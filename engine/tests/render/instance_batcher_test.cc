@@ -0,0 +1,272 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "navary/math/mat4.h"
+#include "navary/math/vec3.h"
+#include "navary/render/v1/gpu_ring_buffer.h"
+#include "navary/render/v1/instance_batcher.h"
+
+using namespace navary;
+using namespace navary::render::v1;
+
+namespace {
+
+// Host-memory stand-in for a persistently mapped GPU buffer.
+struct HostRing {
+  std::vector<std::uint8_t> memory;
+  GpuRingBuffer ring;
+
+  HostRing(std::uint32_t buffer_index, std::size_t bytes) : memory(bytes) {
+    REQUIRE(ring.Init(core::BufferHandle{buffer_index}, bytes, memory.data())
+                .ok());
+  }
+};
+
+VisibleInstance MakeInstance(std::uint32_t pipeline, std::uint32_t material,
+                             std::uint32_t mesh, float tx,
+                             bool instanced = true) {
+  VisibleInstance v{};
+  v.pipeline  = core::PipelineHandle{pipeline};
+  v.material  = core::MaterialHandle{material};
+  v.mesh      = core::MeshHandle{mesh};
+  v.range     = MeshDrawRange{36u * (mesh + 1), 100u * mesh,
+                          static_cast<std::int32_t>(mesh * 24)};
+  v.instanced = instanced;
+  v.world     = math::Mat4::Translation(math::Vec3{tx, 0.f, 0.f});
+  return v;
+}
+
+float InstanceTx(const HostRing& host, const InstanceBatchOutput& out,
+                 std::uint32_t i) {
+  InstanceData d;
+  std::memcpy(&d,
+              host.memory.data() + out.instance_slice.offset +
+                  sizeof(InstanceData) * i,
+              sizeof(InstanceData));
+  return d.world[12];  // column 3, row 0
+}
+
+}  // namespace
+
+TEST_CASE("DrawSortKey: packs and unpacks fields", "[render][sortkey]") {
+  const DrawSortKey key =
+      MakeDrawSortKey(core::PipelineHandle{7}, core::MaterialHandle{12345},
+                      core::MeshHandle{42});
+  REQUIRE(SortKeyPipeline(key) == 7u);
+  REQUIRE(SortKeyMaterial(key) == 12345u);
+  REQUIRE(SortKeyMesh(key) == 42u);
+
+  // Pipeline dominates ordering, then material, then mesh.
+  REQUIRE(MakeDrawSortKey({1}, {0}, {0}) > MakeDrawSortKey({0}, {999}, {999}));
+  REQUIRE(MakeDrawSortKey({0}, {2}, {0}) > MakeDrawSortKey({0}, {1}, {999}));
+}
+
+TEST_CASE("GpuRingBuffer: Reserve aligns and never overwrites the frame",
+          "[render][ring]") {
+  HostRing host(3, 256);
+
+  auto a = host.ring.Reserve(10, 16);
+  REQUIRE(a.ok());
+  REQUIRE(a.value().slice.offset == 0u);
+  REQUIRE(a.value().data == host.memory.data());
+
+  auto b = host.ring.Reserve(32, 16);
+  REQUIRE(b.ok());
+  REQUIRE(b.value().slice.offset == 16u);
+  REQUIRE(b.value().slice.buffer.index == 3u);
+
+  // Does not fit after 48; wrapping to 0 would cover |a| and |b|.
+  auto c = host.ring.Reserve(240, 16);
+  REQUIRE(c.status().code() == NavaryStatus::kOutOfMemory);
+  const std::uint8_t bytes[64] = {};
+  REQUIRE(host.ring.AllocateAndWrite(bytes, 64).ok());
+  REQUIRE(host.ring.AllocateAndWrite(bytes, 200).status().code() ==
+          NavaryStatus::kOutOfMemory);
+  REQUIRE(host.ring.write_head() == 112u);
+
+  host.ring.ResetFrame();
+  c = host.ring.Reserve(240, 16);
+  REQUIRE(c.ok());
+  REQUIRE(c.value().slice.offset == 0u);
+
+  REQUIRE_FALSE(host.ring.Reserve(512, 16).ok());
+  REQUIRE_FALSE(host.ring.Reserve(8, 3).ok());
+}
+
+TEST_CASE("InstanceBatchBuilder: groups instances by sort key",
+          "[render][instancing]") {
+  HostRing instances_ring(0, 1 << 20);
+  HostRing indirect_ring(1, 1 << 16);
+
+  // 1000 instances spread across 2 materials x 2 meshes in shuffled order.
+  std::vector<VisibleInstance> visible;
+  for (std::uint32_t i = 0; i < 1000; ++i) {
+    visible.push_back(MakeInstance(0, i % 2, (i / 2) % 2,
+                                   static_cast<float>(i)));
+  }
+
+  InstanceBatchBuilder builder;
+  REQUIRE(builder.Init(1024).ok());
+
+  InstanceBatchOutput out{};
+  REQUIRE(builder
+              .Build(visible.data(), static_cast<std::uint32_t>(visible.size()),
+                     &instances_ring.ring, &indirect_ring.ring, &out)
+              .ok());
+
+  REQUIRE(out.instance_count == 1000u);
+  REQUIRE(out.command_count == 4u);  // material x mesh
+  REQUIRE(out.batch_count == 2u);    // one multi-draw per material
+  REQUIRE(out.instance_slice.buffer.index == 0u);
+  REQUIRE(out.indirect_slice.buffer.index == 1u);
+  REQUIRE(out.indirect_slice.size ==
+          4u * sizeof(DrawIndexedIndirectCommand));
+
+  // Commands cover every instance exactly once, contiguously.
+  std::uint32_t next_instance = 0;
+  std::uint32_t total         = 0;
+  for (std::uint32_t c = 0; c < out.command_count; ++c) {
+    const DrawIndexedIndirectCommand& cmd = out.commands[c];
+    REQUIRE(cmd.first_instance == next_instance);
+    next_instance += cmd.instance_count;
+    total += cmd.instance_count;
+  }
+  REQUIRE(total == 1000u);
+
+  // Batches reference the mapped command records through byte offsets.
+  for (std::uint32_t b = 0; b < out.batch_count; ++b) {
+    const IndirectBatch& batch = out.batches[b];
+    REQUIRE(batch.command_count == 2u);
+    REQUIRE(batch.material.index == b);
+    REQUIRE(batch.indirect_offset ==
+            out.indirect_slice.offset +
+                batch.first_command * sizeof(DrawIndexedIndirectCommand));
+
+    DrawIndexedIndirectCommand raw;
+    std::memcpy(&raw, indirect_ring.memory.data() + batch.indirect_offset,
+                sizeof(raw));
+    REQUIRE(raw.instance_count ==
+            out.commands[batch.first_command].instance_count);
+  }
+
+  // Mesh ranges are forwarded into the command records.
+  const DrawIndexedIndirectCommand& mesh1 = out.commands[1];
+  REQUIRE(mesh1.index_count == 72u);
+  REQUIRE(mesh1.first_index == 100u);
+  REQUIRE(mesh1.vertex_offset == 24);
+}
+
+TEST_CASE("InstanceBatchBuilder: transforms follow sorted order and ties are "
+          "stable",
+          "[render][instancing]") {
+  HostRing ring(0, 1 << 16);
+
+  std::vector<VisibleInstance> visible = {
+      MakeInstance(1, 0, 0, 10.f), MakeInstance(0, 5, 0, 20.f),
+      MakeInstance(1, 0, 0, 30.f), MakeInstance(0, 5, 0, 40.f),
+      MakeInstance(0, 2, 1, 50.f),
+  };
+
+  InstanceBatchBuilder builder;
+  REQUIRE(builder.Init(8).ok());
+
+  InstanceBatchOutput out{};
+  REQUIRE(builder.Build(visible.data(), 5, &ring.ring, &ring.ring, &out).ok());
+
+  // Expected order: (p0,m2) 50 | (p0,m5) 20,40 | (p1,m0) 10,30
+  REQUIRE(InstanceTx(ring, out, 0) == 50.f);
+  REQUIRE(InstanceTx(ring, out, 1) == 20.f);
+  REQUIRE(InstanceTx(ring, out, 2) == 40.f);
+  REQUIRE(InstanceTx(ring, out, 3) == 10.f);
+  REQUIRE(InstanceTx(ring, out, 4) == 30.f);
+
+  REQUIRE(out.command_count == 3u);
+  REQUIRE(out.batch_count == 3u);
+  REQUIRE(out.batches[2].pipeline.index == 1u);
+  REQUIRE(out.commands[2].instance_count == 2u);
+}
+
+TEST_CASE("InstanceBatchBuilder: non-instanced materials get one command per "
+          "instance",
+          "[render][instancing]") {
+  HostRing ring(0, 1 << 16);
+
+  std::vector<VisibleInstance> visible;
+  for (int i = 0; i < 6; ++i) {
+    visible.push_back(MakeInstance(0, 3, 0, static_cast<float>(i), false));
+  }
+
+  InstanceBatchBuilder builder;
+  REQUIRE(builder.Init(16).ok());
+
+  InstanceBatchOutput out{};
+  REQUIRE(builder.Build(visible.data(), 6, &ring.ring, &ring.ring, &out).ok());
+
+  REQUIRE(out.command_count == 6u);
+  REQUIRE(out.batch_count == 1u);  // still one multi-draw call
+  for (std::uint32_t c = 0; c < 6; ++c) {
+    REQUIRE(out.commands[c].instance_count == 1u);
+    REQUIRE(out.commands[c].first_instance == c);
+  }
+}
+
+TEST_CASE("InstanceBatchBuilder: empty input and capacity errors",
+          "[render][instancing]") {
+  HostRing ring(0, 1 << 12);
+  InstanceBatchBuilder builder;
+  REQUIRE(builder.Init(2).ok());
+
+  InstanceBatchOutput out{};
+  REQUIRE(builder.Build(nullptr, 0, &ring.ring, &ring.ring, &out).ok());
+  REQUIRE(out.command_count == 0u);
+  REQUIRE(out.batch_count == 0u);
+
+  std::vector<VisibleInstance> visible(3, MakeInstance(0, 0, 0, 0.f));
+  NavaryRC st = builder.Build(visible.data(), 3, &ring.ring, &ring.ring, &out);
+  REQUIRE(st.code() == NavaryStatus::kOutOfMemory);
+
+  st = builder.Build(visible.data(), 2, nullptr, &ring.ring, &out);
+  REQUIRE(st.code() == NavaryStatus::kInvalidArgument);
+
+  InstanceBatchBuilder empty;
+  REQUIRE(empty.Init(0).code() == NavaryStatus::kInvalidArgument);
+}
+
+TEST_CASE("InstanceBatchBuilder: first_instance indexes the whole buffer",
+          "[render][instancing]") {
+  HostRing ring(0, 1 << 12);
+  InstanceBatchBuilder builder;
+  REQUIRE(builder.Init(8).ok());
+
+  // Something else already lives at the start of the buffer.
+  REQUIRE(ring.ring.Reserve(100, 16).ok());
+
+  std::vector<VisibleInstance> visible = {
+      MakeInstance(0, 0, 0, 1.f), MakeInstance(0, 0, 0, 2.f),
+      MakeInstance(0, 1, 0, 3.f, false), MakeInstance(0, 1, 0, 4.f, false)};
+  InstanceBatchOutput out{};
+  REQUIRE(builder.Build(visible.data(), 4, &ring.ring, &ring.ring, &out).ok());
+
+  REQUIRE(out.instance_slice.offset == 128u);
+  REQUIRE(out.command_count == 3u);
+  const std::uint32_t base = 128u / sizeof(InstanceData);
+  REQUIRE(out.commands[0].first_instance == base);
+  REQUIRE(out.commands[1].first_instance == base + 2);
+  REQUIRE(out.commands[2].first_instance == base + 3);
+  for (std::uint32_t c = 0; c < out.command_count; ++c) {
+    const std::uint32_t record = out.commands[c].first_instance;
+    float tx = 0.f;
+    std::memcpy(&tx,
+                ring.memory.data() + sizeof(InstanceData) * record +
+                    12 * sizeof(float),
+                sizeof(tx));
+    REQUIRE(tx == InstanceTx(ring, out, record - base));
+  }
+
+  // Both slices share the ring without overlapping.
+  REQUIRE(out.indirect_slice.offset >=
+          out.instance_slice.offset + out.instance_slice.size);
+}
@@ -0,0 +1,209 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "navary/core/scheduler/job_system.h"
+#include "navary/core/time/profiler_time.h"
+#include "navary/graph/shader/navgraph_binary.h"
+#include "navary/materials/v1/material_hot_reload.h"
+#include "navary/materials/v1/material_registry.h"
+
+using namespace navary;
+using namespace navary::materials::v1;
+namespace gs = navary::graph::shader;
+
+namespace {
+
+// Const float4 feeding a MakeSurface node. |color| ends up in the GLSL;
+// |note| only lands in the string table, like editor-side metadata.
+std::vector<std::uint8_t> MakeGraph(float color, const char* note) {
+  // The loader does not resolve links, so the surface inputs share pin
+  // indices with the constant's output.
+  using gs::NodeKind;
+  gs::NavGraphNodeRecord nodes[2] = {};
+  nodes[0].kind            = static_cast<std::uint16_t>(NodeKind::kConstFloat4);
+  nodes[0].output_count    = 1;
+  nodes[0].param_count     = 4;
+  nodes[1].id              = 1;
+  nodes[1].kind            = static_cast<std::uint16_t>(NodeKind::kMakeSurface);
+  nodes[1].input_count     = 4;
+  nodes[1].first_input_pin = 0;
+
+  constexpr gs::ValueTypeBinary kFloat4 = gs::ValueTypeBinary::kFloat4;
+  gs::NavGraphPinRecord pins[4]         = {};
+  for (std::uint32_t i = 0; i < 4; ++i) {
+    pins[i].id          = i;
+    pins[i].node_id     = i == 0 ? 0 : 1;
+    pins[i].type        = static_cast<std::uint16_t>(kFloat4);
+    pins[i].link_pin_id = 0xFFFFFFFFu;
+  }
+  pins[0].direction =
+      static_cast<std::uint8_t>(gs::PinDirectionBinary::kOutput);
+
+  const float params[4]       = {color, 0.5f, 0.25f, 1.0f};
+  const std::size_t note_size = std::strlen(note);
+
+  gs::NavGraphHeader header = {};
+  header.magic              = gs::kNavGraphMagic;
+  header.version            = 1;
+  header.node_count         = 2;
+  header.pin_count          = 4;
+  header.param_value_count  = 4;
+  header.string_table_size  = static_cast<std::uint32_t>(note_size);
+  header.file_size          = static_cast<std::uint32_t>(
+      sizeof(header) + sizeof(nodes) + sizeof(pins) + sizeof(params) +
+      note_size);
+
+  std::vector<std::uint8_t> out;
+  const auto append = [&out](const void* p, std::size_t n) {
+    const auto* b = static_cast<const std::uint8_t*>(p);
+    out.insert(out.end(), b, b + n);
+  };
+  append(&header, sizeof(header));
+  append(nodes, sizeof(nodes));
+  append(pins, sizeof(pins));
+  append(params, sizeof(params));
+  append(note, note_size);
+  return out;
+}
+
+void WriteBytes(const std::filesystem::path& path,
+                const std::vector<std::uint8_t>& bytes) {
+  std::FILE* f = std::fopen(path.string().c_str(), "wb");
+  REQUIRE(f != nullptr);
+  std::fwrite(bytes.data(), 1, bytes.size(), f);
+  std::fclose(f);
+}
+
+MaterialHandle Create(MaterialRegistry* registry, std::uint32_t graph) {
+  MaterialDesc desc = {};
+  desc.graph_id     = GraphId{graph};
+  desc.graph_hash   = ShaderHash{0};
+  NavaryResult<MaterialHandle> h = registry->CreateMaterial(desc);
+  REQUIRE(h.status().ok());
+  return h.value();
+}
+
+struct RebuildLog {
+  std::vector<std::uint32_t> materials;
+  std::string last_glsl;
+};
+
+void OnRebuild(Material* material, const std::string& glsl, void* user) {
+  auto* log = static_cast<RebuildLog*>(user);
+  log->materials.push_back(material->handle.index);
+  log->last_glsl = glsl;
+}
+
+}  // namespace
+
+TEST_CASE("MaterialHotReload: rebuilds only materials whose hash changed",
+          "[render][materials][hotreload]") {
+  const std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "navary_hot_reload";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  const std::filesystem::path graph_path = dir / "rock.navgraph";
+  WriteBytes(graph_path, MakeGraph(0.75f, "v1"));
+
+  core::scheduler::JobSystem jobs;
+  REQUIRE(jobs.Init(2).ok());
+  MaterialRegistry registry;
+  REQUIRE(registry.Init(16).ok());
+
+  const MaterialHandle a     = Create(&registry, 1);
+  const MaterialHandle b     = Create(&registry, 1);
+  const MaterialHandle other = Create(&registry, 2);
+  const MaterialHandle dead  = Create(&registry, 1);
+  registry.DestroyMaterial(dead);
+  REQUIRE_FALSE(registry.IsAlive(dead));
+
+  RebuildLog log;
+  MaterialHotReloadDesc desc;
+  desc.max_graphs               = 4;
+  desc.watcher.debounce_ms      = 20;
+  desc.watcher.poll_interval_ms = 0;
+  desc.rebuild                  = &OnRebuild;
+  desc.user_data                = &log;
+  MaterialHotReload reload;
+  REQUIRE(reload.Init(desc, &registry, &jobs).ok());
+  REQUIRE(reload.WatchGraph(GraphId{1}, graph_path.string().c_str(),
+                            ShaderHash{0})
+              .ok());
+  REQUIRE(reload.WatchGraph(GraphId{1}, graph_path.string().c_str(),
+                            ShaderHash{0})
+              .code() == NavaryStatus::kInvalidArgument);
+  REQUIRE(reload.RequestReload(GraphId{7}).code() == NavaryStatus::kNotFound);
+
+  // Initial compile: both graph-1 materials pick up the real hash.
+  REQUIRE(reload.RequestReload(GraphId{1}).ok());
+  reload.WaitIdle();
+  REQUIRE(reload.ApplyAtFrameBoundary() == 2);
+  const ShaderHash h1 = reload.graph_hash(GraphId{1});
+  REQUIRE(h1.value != 0);
+  REQUIRE(registry.GetMaterial(a)->shader_key.graph_hash.value == h1.value);
+  REQUIRE(registry.GetMaterial(b)->shader_key.graph_hash.value == h1.value);
+  REQUIRE(registry.GetMaterial(other)->shader_key.graph_hash.value == 0);
+  REQUIRE(log.materials.size() == 2);
+  REQUIRE(log.last_glsl.find("0.75") != std::string::npos);
+  REQUIRE_FALSE(reload.busy());
+
+  const std::uint64_t settle =
+      core::time::ProfilerTicksPerSecond() * 30 / 1000;
+  const auto save = [&](const std::vector<std::uint8_t>& bytes,
+                        std::uint64_t* t) {
+    WriteBytes(graph_path, bytes);
+    reload.UpdateAt(*t);
+    *t += settle;
+    reload.UpdateAt(*t);
+    reload.WaitIdle();
+  };
+  std::uint64_t t = core::time::ProfilerNowTicks();
+
+  // Editor-only change: same GLSL, nothing rebuilt.
+  save(MakeGraph(0.75f, "moved a node"), &t);
+  REQUIRE(reload.ApplyAtFrameBoundary() == 0);
+  REQUIRE(reload.stats().unchanged == 1);
+  REQUIRE(log.materials.size() == 2);
+
+  // Real edit: graph-1 materials swap together, graph 2 is untouched.
+  registry.GetMaterial(a)->pipeline = core::PipelineHandle{5};
+  save(MakeGraph(0.125f, "v2"), &t);
+  REQUIRE(registry.GetMaterial(a)->shader_key.graph_hash.value == h1.value);
+  REQUIRE(reload.ApplyAtFrameBoundary() == 2);
+  const ShaderHash h2 = reload.graph_hash(GraphId{1});
+  REQUIRE(h2.value != h1.value);
+  REQUIRE(registry.GetMaterial(a)->shader_key.graph_hash.value == h2.value);
+  REQUIRE(registry.GetMaterial(a)->pipeline.index == 0);
+  REQUIRE(registry.GetMaterial(other)->shader_key.graph_hash.value == 0);
+  REQUIRE(log.last_glsl.find("0.125") != std::string::npos);
+
+  // A broken save keeps the last good shader.
+  std::vector<std::uint8_t> broken = MakeGraph(0.5f, "v3 broken");
+  broken[0] ^= 0xFF;
+  save(broken, &t);
+  REQUIRE(reload.ApplyAtFrameBoundary() == 0);
+  REQUIRE(reload.stats().failed == 1);
+  REQUIRE(reload.graph_hash(GraphId{1}).value == h2.value);
+
+  // A change during a pending compile is compiled again afterwards.
+  WriteBytes(graph_path, MakeGraph(0.5f, "v4"));
+  REQUIRE(reload.RequestReload(GraphId{1}).ok());
+  REQUIRE(reload.RequestReload(GraphId{1}).ok());
+  reload.WaitIdle();
+  REQUIRE(reload.ApplyAtFrameBoundary() == 2);
+  REQUIRE(reload.busy());
+  reload.WaitIdle();
+  REQUIRE(reload.ApplyAtFrameBoundary() == 0);
+  REQUIRE_FALSE(reload.busy());
+  REQUIRE(reload.stats().materials_rebuilt == 6);
+
+  reload.Shutdown();
+  jobs.Shutdown();
+  std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,158 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "navary/materials/v1/material_param_buffer.h"
+#include "navary/render/v1/upload_manager.h"
+
+using namespace navary;
+using namespace navary::materials::v1;
+using navary::render::v1::BufferCopyRegion;
+using navary::render::v1::TextureCopyRegion;
+using navary::render::v1::UploadBackend;
+using navary::render::v1::UploadManager;
+using navary::render::v1::UploadManagerDesc;
+
+namespace {
+
+// Applies copies to a CPU mirror of the GPU parameter buffer.
+class MirrorBackend : public UploadBackend {
+ public:
+  MirrorBackend(const std::uint8_t* staging, std::size_t size)
+      : staging_(staging), gpu(size, 0) {}
+
+  NavaryRC CopyBufferRegions(core::BufferHandle, core::BufferHandle,
+                             const BufferCopyRegion* regions,
+                             std::uint32_t count) override {
+    for (std::uint32_t i = 0; i < count; ++i) {
+      std::memcpy(gpu.data() + regions[i].dst_offset,
+                  staging_ + regions[i].src_offset, regions[i].size);
+      bytes += regions[i].size;
+    }
+    return NavaryRC::OK();
+  }
+
+  NavaryRC CopyTextureRegions(core::BufferHandle, core::TextureHandle,
+                              const TextureCopyRegion*,
+                              std::uint32_t) override {
+    return NavaryRC::OK();
+  }
+
+ private:
+  const std::uint8_t* staging_;
+
+ public:
+  std::vector<std::uint8_t> gpu;
+  std::size_t bytes = 0;
+};
+
+MaterialParams Params(float v) {
+  MaterialParams p{};
+  for (int i = 0; i < 4; ++i) {
+    p.base_color[i] = v;
+    p.params0[i]    = v * 2.0f;
+    p.params1[i]    = v * 3.0f;
+  }
+  return p;
+}
+
+}  // namespace
+
+TEST_CASE("MaterialParamBuffer: flush uploads only changed slots",
+          "[materials][upload]") {
+  constexpr std::uint32_t kMaterials = 1000;
+
+  MaterialParamBuffer params;
+  REQUIRE(params.Init(kMaterials, core::BufferHandle{7}, 256).ok());
+  REQUIRE(params.slot_stride() == 256u);
+
+  std::vector<std::uint8_t> staging(1 << 20);
+  UploadManagerDesc desc{};
+  desc.staging_buffer       = core::BufferHandle{1};
+  desc.staging_mapped       = staging.data();
+  desc.staging_size         = staging.size();
+  desc.max_requests         = 1024;
+  desc.max_frames_in_flight = 2;
+  UploadManager uploads;
+  REQUIRE(uploads.Init(desc).ok());
+
+  MirrorBackend backend(staging.data(), kMaterials * params.slot_stride());
+
+  // Frame 1: every material created once.
+  uploads.BeginFrame(1);
+  for (std::uint32_t i = 0; i < kMaterials; ++i) {
+    REQUIRE(params.Write(MaterialHandle{i}, MakeMaterialUbo(Params(i))).ok());
+  }
+  MaterialParamFlushStats stats{};
+  REQUIRE(params.Flush(&uploads, &stats).ok());
+  REQUIRE(uploads.Flush(&backend).ok());
+  REQUIRE(stats.slots_uploaded == kMaterials);
+  REQUIRE(params.dirty_count() == 0u);
+
+  // Frame 2: nothing changed, nothing uploaded; rewriting equal values is
+  // not an edit.
+  uploads.BeginFrame(2);
+  REQUIRE(params.Write(MaterialHandle{5}, MakeMaterialUbo(Params(5))).ok());
+  REQUIRE(params.Flush(&uploads, &stats).ok());
+  REQUIRE(stats.slots_uploaded == 0u);
+  REQUIRE(stats.bytes == 0u);
+
+  // Frame 3: three edits -> three slots, slot offsets stay stable.
+  uploads.BeginFrame(3);
+  REQUIRE(params.Write(MaterialHandle{3}, MakeMaterialUbo(Params(-1))).ok());
+  REQUIRE(params.Write(MaterialHandle{4}, MakeMaterialUbo(Params(-2))).ok());
+  REQUIRE(params.Write(MaterialHandle{900}, MakeMaterialUbo(Params(-3))).ok());
+  REQUIRE(params.IsDirty(MaterialHandle{4}));
+  const std::size_t before = backend.bytes;
+  REQUIRE(params.Flush(&uploads, &stats).ok());
+  REQUIRE(uploads.Flush(&backend).ok());
+  REQUIRE(stats.slots_uploaded == 3u);
+  REQUIRE(stats.copies == 2u);  // 3 and 4 are adjacent
+  REQUIRE(backend.bytes - before < 3 * params.slot_stride());
+
+  for (std::uint32_t i : {0u, 3u, 4u, 500u, 900u}) {
+    const auto slot = params.Slot(MaterialHandle{i});
+    REQUIRE(slot.offset == i * params.slot_stride());
+    REQUIRE(std::memcmp(backend.gpu.data() + slot.offset,
+                        params.Get(MaterialHandle{i}),
+                        sizeof(MaterialUbo)) == 0);
+  }
+}
+
+TEST_CASE("MaterialParamBuffer: over-budget slots stay dirty",
+          "[materials][upload]") {
+  MaterialParamBuffer params;
+  REQUIRE(params.Init(256, core::BufferHandle{0}, 256).ok());
+
+  std::vector<std::uint8_t> staging(1 << 20);
+  UploadManagerDesc desc{};
+  desc.staging_mapped       = staging.data();
+  desc.staging_size         = staging.size();
+  desc.frame_budget_bytes   = 4096;
+  desc.max_requests         = 64;
+  desc.max_frames_in_flight = 2;
+  UploadManager uploads;
+  REQUIRE(uploads.Init(desc).ok());
+
+  // Every other slot dirty: no merging, 80 bytes per copy.
+  for (std::uint32_t i = 0; i < 256; i += 2) {
+    REQUIRE(params.Write(MaterialHandle{i}, MakeMaterialUbo(Params(1))).ok());
+  }
+
+  std::uint32_t frames = 0;
+  MaterialParamFlushStats stats{};
+  while (params.dirty_count() > 0 && frames < 16) {
+    uploads.BeginFrame(++frames);
+    REQUIRE(params.Flush(&uploads, &stats).ok());
+    REQUIRE(stats.bytes <= 4096u);
+  }
+  REQUIRE(params.dirty_count() == 0u);
+  REQUIRE(frames > 1u);
+
+  // Releasing a slot drops its pending upload.
+  REQUIRE(params.Write(MaterialHandle{1}, MakeMaterialUbo(Params(9))).ok());
+  params.Release(MaterialHandle{1});
+  REQUIRE(params.dirty_count() == 0u);
+}
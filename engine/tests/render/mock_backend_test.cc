@@ -0,0 +1,165 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#include "navary/materials/v1/material_gpu.h"
+#include "navary/render/v1/gpu_ring_buffer.h"
+#include "navary/render/v1/mock/mock_buffers.h"
+#include "navary/render/v1/mock/mock_descriptor_allocator.h"
+#include "navary/render/v1/upload_manager.h"
+
+using namespace navary;
+using namespace navary::render::v1;
+using namespace navary::render::v1::mock;
+using navary::materials::v1::AllocateAndWriteMaterialDescriptor;
+using navary::materials::v1::MakeMaterialUbo;
+using navary::materials::v1::Material;
+using navary::materials::v1::MaterialGpuContext;
+using navary::materials::v1::MaterialParamBuffer;
+using navary::materials::v1::MaterialUbo;
+
+namespace {
+
+MockDescriptorLimits Limits() {
+  MockDescriptorLimits limits{};
+  limits.max_sets      = 512;
+  limits.max_bindings  = 16;
+  limits.layout_count  = 2;
+  limits.texture_count = 64;
+  limits.buffer_count  = 8;
+  return limits;
+}
+
+Material MakeMaterial(std::uint32_t index) {
+  Material m{};
+  m.handle = core::MaterialHandle{index};
+  for (int i = 0; i < 4; ++i) {
+    m.params.base_color[i] = static_cast<float>(index) + 0.25f * i;
+    m.params.params0[i]    = 0.5f;
+  }
+  m.textures.albedo = core::TextureHandle{index % 64};
+  m.textures.normal = core::TextureHandle{(index + 1) % 64};
+  return m;
+}
+
+}  // namespace
+
+TEST_CASE("MockDescriptorAllocator: validates and records bindings",
+          "[render][mock]") {
+  MockDescriptorAllocator alloc;
+  REQUIRE(alloc.Init(Limits()).ok());
+
+  auto set_or = alloc.Allocate(core::DescriptorSetLayoutHandle{1});
+  REQUIRE(set_or.status().ok());
+  const core::DescriptorHandle set = set_or.value();
+
+  REQUIRE(alloc.WriteImageSampler(set, 0, core::TextureHandle{3}).ok());
+  REQUIRE(alloc.WriteUniformBuffer(set, 8, core::BufferHandle{2}, 512, 80)
+              .ok());
+  REQUIRE(alloc.WriteImageSampler(set, 1, core::TextureHandle{64}).code() ==
+          NavaryStatus::kInvalidArgument);
+  REQUIRE(alloc.Allocate(core::DescriptorSetLayoutHandle{2}).status().code() ==
+          NavaryStatus::kInvalidArgument);
+
+  const MockBinding* ubo = alloc.GetBinding(set, 8);
+  REQUIRE(ubo != nullptr);
+  REQUIRE(ubo->kind == MockBindingKind::kUniformBuffer);
+  REQUIRE(ubo->offset == 512u);
+  REQUIRE(alloc.GetBinding(set, 1)->kind == MockBindingKind::kEmpty);
+  REQUIRE(alloc.GetLayout(set).index == 1u);
+
+  REQUIRE(alloc.stats().allocate.calls == 2u);
+  REQUIRE(alloc.stats().allocate.failures == 1u);
+  REQUIRE(alloc.stats().write_image.calls == 2u);
+  REQUIRE(alloc.stats().write_image.failures == 1u);
+
+  alloc.Reset();
+  REQUIRE(alloc.allocated_sets() == 0u);
+  REQUIRE(alloc.GetBinding(set, 8) == nullptr);
+}
+
+TEST_CASE("Mock backend: material descriptors and params run headless",
+          "[render][mock]") {
+  constexpr std::uint32_t kMaterials = 300;
+
+  MockBufferHeap heap;
+  REQUIRE(heap.Init(4).ok());
+  auto staging_or = heap.CreateBuffer(1 << 20);
+  auto params_or  = heap.CreateBuffer(kMaterials * 256);
+  REQUIRE(staging_or.status().ok());
+  REQUIRE(params_or.status().ok());
+  const MockBuffer staging   = staging_or.value();
+  const MockBuffer param_gpu = params_or.value();
+
+  UploadManagerDesc desc{};
+  desc.staging_buffer       = staging.handle;
+  desc.staging_mapped       = staging.mapped;
+  desc.staging_size         = staging.size;
+  desc.max_requests         = 1024;
+  desc.max_frames_in_flight = 2;
+  UploadManager uploads;
+  REQUIRE(uploads.Init(desc).ok());
+
+  MaterialParamBuffer params;
+  REQUIRE(params.Init(kMaterials, param_gpu.handle, 256).ok());
+
+  MockDescriptorAllocator alloc;
+  REQUIRE(alloc.Init(Limits()).ok());
+  alloc.set_timing_enabled(true);
+
+  MaterialGpuContext ctx{};
+  ctx.descriptor_allocator = &alloc;
+  ctx.material_set_layout  = core::DescriptorSetLayoutHandle{1};
+  ctx.material_params      = &params;
+
+  uploads.BeginFrame(1);
+  for (std::uint32_t i = 0; i < kMaterials; ++i) {
+    Material m = MakeMaterial(i);
+    REQUIRE(AllocateAndWriteMaterialDescriptor(m, &ctx, &m.gpu.set1).ok());
+
+    const MockBinding* ubo = alloc.GetBinding(m.gpu.set1, 8);
+    REQUIRE(ubo->buffer.index == param_gpu.handle.index);
+    REQUIRE(ubo->offset == i * params.slot_stride());
+    REQUIRE(ubo->range == sizeof(MaterialUbo));
+  }
+
+  MockUploadBackend backend(&heap);
+  REQUIRE(params.Flush(&uploads).ok());
+  REQUIRE(uploads.Flush(&backend).ok());
+
+  REQUIRE(alloc.stats().allocate.calls == kMaterials);
+  REQUIRE(alloc.stats().write_image.calls == 8u * kMaterials);
+  REQUIRE(alloc.stats().write_buffer.calls == kMaterials);
+  REQUIRE(backend.stats().buffer_copies.failures == 0u);
+  REQUIRE(backend.stats().buffer_copies.calls == 1u);
+
+  // The "GPU" buffer holds every material's UBO at its slot.
+  for (std::uint32_t i = 0; i < kMaterials; i += 37) {
+    const MaterialUbo expected = MakeMaterialUbo(MakeMaterial(i).params);
+    REQUIRE(std::memcmp(param_gpu.mapped + i * params.slot_stride(),
+                        &expected, sizeof(MaterialUbo)) == 0);
+  }
+}
+
+TEST_CASE("Mock backend: GpuRingBuffer writes land in host memory",
+          "[render][mock]") {
+  MockBufferHeap heap;
+  REQUIRE(heap.Init(1).ok());
+  auto buf_or = heap.CreateBuffer(4096);
+  REQUIRE(buf_or.status().ok());
+  REQUIRE(heap.CreateBuffer(16).status().code() == NavaryStatus::kOutOfMemory);
+
+  GpuRingBuffer ring;
+  REQUIRE(ring.Init(buf_or.value().handle, 4096, buf_or.value().mapped).ok());
+
+  const std::uint64_t value = 0x0123456789ABCDEFull;
+  auto slice_or = ring.AllocateAndWrite(&value, sizeof(value));
+  REQUIRE(slice_or.status().ok());
+
+  std::uint64_t read = 0;
+  std::memcpy(&read, heap.Map(slice_or.value().buffer) +
+                         slice_or.value().offset,
+              sizeof(read));
+  REQUIRE(read == value);
+}
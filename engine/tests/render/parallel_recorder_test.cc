@@ -0,0 +1,147 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "navary/core/scheduler/job_system.h"
+#include "navary/render/v1/mock/mock_command_backend.h"
+#include "navary/render/v1/parallel_recorder.h"
+
+using namespace navary;
+using namespace navary::render::v1;
+using navary::core::scheduler::JobSystem;
+using navary::render::v1::mock::MockCommandBackend;
+
+namespace {
+
+// Sorted draw list: |pipelines| x |materials| state runs.
+std::vector<DrawItem> MakeDraws(std::uint32_t count, std::uint32_t pipelines,
+                                std::uint32_t materials) {
+  std::vector<DrawItem> draws(count);
+  for (std::uint32_t i = 0; i < count; ++i) {
+    const std::uint32_t run = i * pipelines * materials / count;
+    DrawItem& d             = draws[i];
+    d.pipeline              = core::PipelineHandle{run / materials};
+    d.material_set          = core::DescriptorHandle{run};
+    d.key = MakeDrawSortKey(d.pipeline, core::MaterialHandle{run},
+                            core::MeshHandle{i % 32});
+    d.vertex_buffer  = core::BufferHandle{0};
+    d.index_buffer   = core::BufferHandle{1};
+    d.index_count    = 36 + (i % 7);
+    d.first_index    = i * 3;
+    d.vertex_offset  = static_cast<std::int32_t>(i % 1000);
+    d.instance_count = 1;
+    d.first_instance = i;
+  }
+  return draws;
+}
+
+}  // namespace
+
+TEST_CASE("ParallelCommandRecorder: output independent of thread count",
+          "[render][recorder]") {
+  const std::vector<DrawItem> draws = MakeDraws(20000, 8, 16);
+
+  // Reference: single-threaded recording.
+  MockCommandBackend single;
+  REQUIRE(single.Init(1, 64).ok());
+  ParallelCommandRecorder recorder;
+  REQUIRE(recorder.Init(256).ok());
+
+  ParallelRecordStats ref_stats{};
+  REQUIRE(recorder
+              .Record(draws.data(), static_cast<std::uint32_t>(draws.size()),
+                      nullptr, &single, &ref_stats)
+              .ok());
+  REQUIRE(single.primary_counts().draws == 20000u);
+  REQUIRE(ref_stats.draw_count == 20000u);
+
+  JobSystem jobs;
+  REQUIRE(jobs.Init(3).ok());
+  MockCommandBackend multi;
+  REQUIRE(multi.Init(jobs.thread_count(), 64).ok());
+
+  ParallelRecordStats stats{};
+  REQUIRE(recorder
+              .Record(draws.data(), static_cast<std::uint32_t>(draws.size()),
+                      &jobs, &multi, &stats)
+              .ok());
+
+  REQUIRE(stats.range_count > 1u);
+  REQUIRE(multi.executed_secondaries() == stats.range_count);
+  REQUIRE(multi.primary_counts().draws == 20000u);
+  REQUIRE(multi.primary_draw_hash() == single.primary_draw_hash());
+
+  // Every pipeline/material run is bound at least once; ranges cut on state
+  // changes so rebinding stays close to the single-threaded count.
+  REQUIRE(multi.primary_counts().pipeline_binds >= 8u);
+  REQUIRE(multi.primary_counts().descriptor_binds >= 128u);
+  REQUIRE(multi.primary_counts().descriptor_binds <=
+          128u + stats.range_count);
+
+  // Repeating the frame gives the same stream.
+  const std::uint64_t first_hash = multi.primary_draw_hash();
+  REQUIRE(multi.BeginFrame(1).ok());
+  REQUIRE(recorder
+              .Record(draws.data(), static_cast<std::uint32_t>(draws.size()),
+                      &jobs, &multi, nullptr)
+              .ok());
+  REQUIRE(multi.primary_draw_hash() == first_hash);
+}
+
+TEST_CASE("ParallelCommandRecorder: ranges snap to state changes",
+          "[render][recorder]") {
+  const std::vector<DrawItem> draws = MakeDraws(4096, 4, 4);  // runs of 256
+
+  ParallelRecordConfig config;
+  config.min_draws_per_range = 64;
+  config.ranges_per_thread   = 3;
+  config.boundary_search     = 256;
+
+  ParallelCommandRecorder recorder;
+  REQUIRE(recorder.Init(64, config).ok());
+
+  MockCommandBackend backend;
+  REQUIRE(backend.Init(4, 64).ok());
+
+  JobSystem jobs;
+  REQUIRE(jobs.Init(3).ok());
+  REQUIRE(recorder.Record(draws.data(), 4096, &jobs, &backend).ok());
+
+  for (std::uint32_t r = 1; r < recorder.range_count(); ++r) {
+    const std::uint32_t b = recorder.RangeBegin(r);
+    REQUIRE(SortKeyStatePrefix(draws[b].key) !=
+            SortKeyStatePrefix(draws[b - 1].key));
+  }
+  REQUIRE(backend.primary_counts().descriptor_binds == 16u);
+}
+
+TEST_CASE("ParallelCommandRecorder: validates backend pools",
+          "[render][recorder]") {
+  const std::vector<DrawItem> draws = MakeDraws(1024, 1, 1);
+
+  ParallelCommandRecorder recorder;
+  REQUIRE(recorder.Init(16).ok());
+
+  JobSystem jobs;
+  REQUIRE(jobs.Init(3).ok());
+
+  MockCommandBackend too_few_workers;
+  REQUIRE(too_few_workers.Init(1, 16).ok());
+  REQUIRE(recorder.Record(draws.data(), 1024, &jobs, &too_few_workers)
+              .code() == NavaryStatus::kInvalidArgument);
+
+  // One list per worker is not enough for 16 ranges.
+  ParallelRecordConfig config;
+  config.min_draws_per_range = 1;
+  REQUIRE(recorder.Init(16, config).ok());
+  MockCommandBackend tiny_pools;
+  REQUIRE(tiny_pools.Init(1, 1).ok());
+  REQUIRE(recorder.Record(draws.data(), 1024, nullptr, &tiny_pools).code() ==
+          NavaryStatus::kOutOfMemory);
+
+  MockCommandBackend ok_backend;
+  REQUIRE(ok_backend.Init(1, 1).ok());
+  REQUIRE(recorder.Record(nullptr, 0, nullptr, &ok_backend).ok());
+  REQUIRE(recorder.range_count() == 0u);
+}
@@ -0,0 +1,496 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "navary/render/v1/render_graph.h"
+
+using namespace navary;
+using namespace navary::render::v1;
+
+namespace {
+
+// CPU backend: sizes images as width*height*4 bytes, records every call.
+class MockGraphBackend : public RenderGraphBackend {
+ public:
+  std::size_t alignment = 256;
+  std::uint32_t buffer_heap_class = 0;
+  bool fail_requirements          = false;
+  std::uint32_t max_barriers      = 64;
+
+  std::vector<std::vector<RgBarrier>> recorded_batches;
+  std::vector<RgTransientPlacement> realized;
+  std::uint32_t realize_calls = 0;
+
+  NavaryResult<RgMemoryRequirements> GetMemoryRequirements(
+      const RgResourceDesc& desc) override {
+    if (fail_requirements) {
+      return NavaryResult<RgMemoryRequirements>(
+          NavaryRC(NavaryStatus::kNotFound, "mock: no memory type"));
+    }
+    RgMemoryRequirements req{};
+    req.alignment = alignment;
+    if (desc.kind == RgResourceKind::kImage) {
+      req.size       = static_cast<std::size_t>(desc.image.width) *
+                 desc.image.height * 4;
+      req.heap_class = 0;
+    } else {
+      req.size       = desc.buffer.size;
+      req.heap_class = buffer_heap_class;
+    }
+    return NavaryResult<RgMemoryRequirements>(req);
+  }
+
+  NavaryRC RealizeTransients(const RgTransientPlacement* placements,
+                             std::uint32_t placement_count,
+                             const RgHeapInfo* /*heaps*/,
+                             std::uint32_t /*heap_count*/) override {
+    ++realize_calls;
+    realized.assign(placements, placements + placement_count);
+    return NavaryRC::OK();
+  }
+
+  NavaryRC RecordBarriers(const RgBarrier* barriers,
+                          std::uint32_t count) override {
+    if (count > max_barriers) {
+      return NavaryRC(NavaryStatus::kOutOfMemory, "mock: batch too large");
+    }
+    recorded_batches.emplace_back(barriers, barriers + count);
+    return NavaryRC::OK();
+  }
+};
+
+RenderGraphLimits Limits() {
+  return RenderGraphLimits{32, 32, 128};
+}
+
+RgImageDesc Image(std::uint32_t w, std::uint32_t h) {
+  return RgImageDesc{w, h, 1, 0};
+}
+
+const RgTransientPlacement* FindPlacement(const RenderGraph& g,
+                                          RgResourceHandle r) {
+  for (std::uint32_t i = 0; i < g.placement_count(); ++i) {
+    if (g.placements()[i].resource.index == r.index) {
+      return &g.placements()[i];
+    }
+  }
+  return nullptr;
+}
+
+const RgBarrier* FindBarrier(const RenderGraph& g, std::uint32_t order_pos,
+                             RgResourceHandle r) {
+  const RgBarrierBatch& b = g.barrier_batches()[order_pos];
+  for (std::uint32_t i = 0; i < b.barrier_count; ++i) {
+    const RgBarrier& bar = g.barriers()[b.first_barrier + i];
+    if (bar.resource.index == r.index) {
+      return &bar;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST_CASE("RenderGraph: culls passes whose outputs are unused",
+          "[render][graph]") {
+  RenderGraph g;
+  REQUIRE(g.Init(Limits()).ok());
+  MockGraphBackend backend;
+
+  auto backbuffer = g.ImportImage("backbuffer", Image(64, 64), 0,
+                                  kRgAccessNone, kRgAccessPresent)
+                        .value();
+  auto debug = g.CreateImage("debug", Image(64, 64)).value();
+  auto color = g.CreateImage("color", Image(64, 64)).value();
+
+  auto p_debug = g.AddPass("debug", RgPassType::kRaster, nullptr, nullptr)
+                     .value();
+  REQUIRE(g.Write(p_debug, debug, kRgAccessColorAttachment).ok());
+
+  auto p_main = g.AddPass("main", RgPassType::kRaster, nullptr, nullptr)
+                    .value();
+  REQUIRE(g.Write(p_main, color, kRgAccessColorAttachment).ok());
+
+  auto p_post = g.AddPass("post", RgPassType::kRaster, nullptr, nullptr)
+                    .value();
+  REQUIRE(g.Read(p_post, color, kRgAccessSampled).ok());
+  REQUIRE(g.Write(p_post, backbuffer, kRgAccessColorAttachment).ok());
+
+  auto p_readback =
+      g.AddPass("readback", RgPassType::kTransfer, nullptr, nullptr).value();
+  REQUIRE(g.Write(p_readback, debug, kRgAccessTransferDst).ok());
+  REQUIRE(g.SetSideEffect(p_readback).ok());
+
+  REQUIRE(g.Compile(&backend).ok());
+
+  REQUIRE(g.IsPassCulled(p_debug));  // fully overwritten by readback
+  REQUIRE_FALSE(g.IsPassCulled(p_main));
+  REQUIRE_FALSE(g.IsPassCulled(p_post));
+  REQUIRE_FALSE(g.IsPassCulled(p_readback));
+
+  REQUIRE(g.compiled_pass_count() == 3u);
+  REQUIRE(g.pass_order()[0] == p_main.index);
+  REQUIRE(g.pass_order()[1] == p_post.index);
+  REQUIRE(g.pass_order()[2] == p_readback.index);
+  REQUIRE(backend.realize_calls == 1u);
+}
+
+TEST_CASE("RenderGraph: one merged barrier batch per pass",
+          "[render][graph]") {
+  RenderGraph g;
+  REQUIRE(g.Init(Limits()).ok());
+  MockGraphBackend backend;
+
+  auto backbuffer = g.ImportImage("backbuffer", Image(32, 32), 7,
+                                  kRgAccessNone, kRgAccessPresent)
+                        .value();
+  auto albedo = g.CreateImage("albedo", Image(32, 32)).value();
+  auto normal = g.CreateImage("normal", Image(32, 32)).value();
+  auto depth  = g.CreateImage("depth", Image(32, 32)).value();
+
+  auto gbuf = g.AddPass("gbuffer", RgPassType::kRaster, nullptr, nullptr)
+                  .value();
+  REQUIRE(g.Write(gbuf, albedo, kRgAccessColorAttachment).ok());
+  REQUIRE(g.Write(gbuf, normal, kRgAccessColorAttachment).ok());
+  REQUIRE(g.Write(gbuf, depth, kRgAccessDepthWrite).ok());
+
+  auto light = g.AddPass("lighting", RgPassType::kCompute, nullptr, nullptr)
+                   .value();
+  REQUIRE(g.Read(light, albedo, kRgAccessSampled).ok());
+  REQUIRE(g.Read(light, normal, kRgAccessSampled).ok());
+  REQUIRE(g.Read(light, depth, kRgAccessSampled).ok());
+  REQUIRE(g.Write(light, backbuffer, kRgAccessStorageWrite).ok());
+
+  // Second sampled read of albedo needs no barrier (read after read).
+  auto tone = g.AddPass("tonemap", RgPassType::kCompute, nullptr, nullptr)
+                  .value();
+  REQUIRE(g.Read(tone, albedo, kRgAccessSampled).ok());
+  REQUIRE(g.Read(tone, backbuffer, kRgAccessStorageRead).ok());
+  REQUIRE(g.Write(tone, backbuffer, kRgAccessStorageWrite).ok());
+
+  REQUIRE(g.Compile(&backend).ok());
+  REQUIRE(g.compiled_pass_count() == 3u);
+
+  const RgBarrierBatch* batches = g.barrier_batches();
+  REQUIRE(batches[0].barrier_count == 3u);  // three discards
+  REQUIRE(batches[1].barrier_count == 4u);  // 3 reads + backbuffer
+  REQUIRE(batches[2].barrier_count == 1u);  // backbuffer RMW only
+  REQUIRE(batches[3].barrier_count == 1u);  // final -> present
+
+  const RgBarrier* first_albedo = FindBarrier(g, 0, albedo);
+  REQUIRE(first_albedo != nullptr);
+  REQUIRE(first_albedo->discard);
+  REQUIRE(first_albedo->src_access == kRgAccessNone);
+
+  const RgBarrier* depth_read = FindBarrier(g, 1, depth);
+  REQUIRE(depth_read->src_access == kRgAccessDepthWrite);
+  REQUIRE(depth_read->dst_access == kRgAccessSampled);
+  REQUIRE(depth_read->src_pass_type == RgPassType::kRaster);
+  REQUIRE(depth_read->dst_pass_type == RgPassType::kCompute);
+
+  // Read + write declared separately collapse into one access.
+  const RgBarrier* rmw = FindBarrier(g, 2, backbuffer);
+  REQUIRE(rmw->dst_access == (kRgAccessStorageRead | kRgAccessStorageWrite));
+  REQUIRE(rmw->external_index == 7u);
+  REQUIRE(FindBarrier(g, 2, albedo) == nullptr);
+
+  const RgBarrier& present = g.barriers()[batches[3].first_barrier];
+  REQUIRE(present.dst_access == kRgAccessPresent);
+
+  // Execute records exactly the non-empty batches.
+  REQUIRE(g.max_batch_barriers() == 4u);
+  REQUIRE(g.Execute(&backend, nullptr).ok());
+  REQUIRE(backend.recorded_batches.size() == 4u);
+
+  // A backend that cannot hold a batch fails Execute instead of dropping
+  // barriers.
+  backend.recorded_batches.clear();
+  backend.max_barriers = 3;
+  REQUIRE(g.Execute(&backend, nullptr).code() == NavaryStatus::kOutOfMemory);
+  REQUIRE(backend.recorded_batches.size() == 1u);
+}
+
+TEST_CASE("RenderGraph: aliases transients with disjoint lifetimes",
+          "[render][graph]") {
+  RenderGraph g;
+  REQUIRE(g.Init(Limits()).ok());
+  MockGraphBackend backend;
+
+  auto out = g.ImportBuffer("out", RgBufferDesc{16}, 0, kRgAccessNone,
+                            kRgAccessNone)
+                 .value();
+  auto a = g.CreateImage("a", Image(64, 64)).value();  // 16 KB
+  auto b = g.CreateImage("b", Image(64, 64)).value();
+  auto c = g.CreateImage("c", Image(32, 32)).value();  // 4 KB
+
+  // a: passes 0-1, b: passes 2-3, c: passes 1-2 (overlaps both).
+  auto p0 = g.AddPass("p0", RgPassType::kRaster, nullptr, nullptr).value();
+  REQUIRE(g.Write(p0, a, kRgAccessColorAttachment).ok());
+
+  auto p1 = g.AddPass("p1", RgPassType::kCompute, nullptr, nullptr).value();
+  REQUIRE(g.Read(p1, a, kRgAccessSampled).ok());
+  REQUIRE(g.Write(p1, c, kRgAccessStorageWrite).ok());
+
+  auto p2 = g.AddPass("p2", RgPassType::kCompute, nullptr, nullptr).value();
+  REQUIRE(g.Read(p2, c, kRgAccessSampled).ok());
+  REQUIRE(g.Write(p2, b, kRgAccessStorageWrite).ok());
+
+  auto p3 = g.AddPass("p3", RgPassType::kCompute, nullptr, nullptr).value();
+  REQUIRE(g.Read(p3, b, kRgAccessSampled).ok());
+  REQUIRE(g.Write(p3, out, kRgAccessStorageWrite).ok());
+
+  REQUIRE(g.Compile(&backend).ok());
+  REQUIRE(g.compiled_pass_count() == 4u);
+  REQUIRE(g.placement_count() == 3u);
+  REQUIRE(g.heap_count() == 1u);
+
+  const RgTransientPlacement* pa = FindPlacement(g, a);
+  const RgTransientPlacement* pb = FindPlacement(g, b);
+  const RgTransientPlacement* pc = FindPlacement(g, c);
+  REQUIRE(pa != nullptr);
+  REQUIRE(pb != nullptr);
+  REQUIRE(pc != nullptr);
+
+  REQUIRE(pa->offset == pb->offset);  // same memory
+  REQUIRE(pc->offset >= pa->offset + pa->size);
+  REQUIRE(pc->offset % backend.alignment == 0);
+  REQUIRE(pb->alias_predecessor == a.index);
+  REQUIRE(pa->alias_predecessor == kRgInvalidIndex);
+
+  REQUIRE(g.heaps()[0].size == 16384u + 4096u);
+  REQUIRE(g.unaliased_transient_bytes() == 16384u * 2 + 4096u);
+
+  // b's first barrier waits on a's last (sampled) use and discards contents.
+  const RgBarrier* first_b = FindBarrier(g, 2, b);
+  REQUIRE(first_b->discard);
+  REQUIRE(first_b->src_access == kRgAccessSampled);
+  REQUIRE(first_b->src_pass_type == RgPassType::kCompute);
+
+  // Usage flags are accumulated for the backend.
+  REQUIRE(pa->desc.usage == (kRgAccessColorAttachment | kRgAccessSampled));
+  REQUIRE(backend.realized.size() == 3u);
+}
+
+TEST_CASE("RenderGraph: heap classes never alias each other",
+          "[render][graph]") {
+  RenderGraph g;
+  REQUIRE(g.Init(Limits()).ok());
+  MockGraphBackend backend;
+  backend.buffer_heap_class = 5;
+
+  auto img = g.CreateImage("img", Image(16, 16)).value();
+  auto buf = g.CreateBuffer("buf", RgBufferDesc{1024}).value();
+
+  auto p0 = g.AddPass("p0", RgPassType::kCompute, nullptr, nullptr).value();
+  REQUIRE(g.Write(p0, img, kRgAccessStorageWrite).ok());
+  auto p1 = g.AddPass("p1", RgPassType::kCompute, nullptr, nullptr).value();
+  REQUIRE(g.Read(p1, img, kRgAccessSampled).ok());
+  REQUIRE(g.Write(p1, buf, kRgAccessStorageWrite).ok());
+  REQUIRE(g.SetSideEffect(p1).ok());
+
+  REQUIRE(g.Compile(&backend).ok());
+  REQUIRE(g.heap_count() == 2u);
+
+  const RgTransientPlacement* pi = FindPlacement(g, img);
+  const RgTransientPlacement* pbuf = FindPlacement(g, buf);
+  REQUIRE(pi->heap != pbuf->heap);
+  REQUIRE(g.heaps()[pbuf->heap].heap_class == 5u);
+  REQUIRE(pbuf->offset == 0u);
+}
+
+TEST_CASE("RenderGraph: images and buffers never share a heap",
+          "[render][graph]") {
+  RenderGraph g;
+  REQUIRE(g.Init(Limits()).ok());
+  MockGraphBackend backend;  // same heap class for both kinds
+
+  auto img = g.CreateImage("img", Image(16, 16)).value();
+  auto buf = g.CreateBuffer("buf", RgBufferDesc{1024}).value();
+
+  // Disjoint lifetimes: they would alias if they shared a heap.
+  auto p0 = g.AddPass("p0", RgPassType::kCompute, nullptr, nullptr).value();
+  REQUIRE(g.Write(p0, img, kRgAccessStorageWrite).ok());
+  REQUIRE(g.SetSideEffect(p0).ok());
+  auto p1 = g.AddPass("p1", RgPassType::kCompute, nullptr, nullptr).value();
+  REQUIRE(g.Write(p1, buf, kRgAccessStorageWrite).ok());
+  REQUIRE(g.SetSideEffect(p1).ok());
+
+  REQUIRE(g.Compile(&backend).ok());
+  REQUIRE(g.heap_count() == 2u);
+
+  const RgTransientPlacement* pi   = FindPlacement(g, img);
+  const RgTransientPlacement* pbuf = FindPlacement(g, buf);
+  REQUIRE(pi->heap != pbuf->heap);
+  REQUIRE(g.heaps()[pi->heap].kind == RgResourceKind::kImage);
+  REQUIRE(g.heaps()[pbuf->heap].kind == RgResourceKind::kBuffer);
+  REQUIRE(g.heaps()[pi->heap].heap_class ==
+          g.heaps()[pbuf->heap].heap_class);
+  REQUIRE(pbuf->alias_predecessor == kRgInvalidIndex);
+}
+
+TEST_CASE("RenderGraph: aliasing barrier waits on every earlier occupant",
+          "[render][graph]") {
+  RenderGraph g;
+  REQUIRE(g.Init(Limits()).ok());
+  MockGraphBackend backend;
+
+  auto out = g.ImportImage("out", Image(8, 8), 0, kRgAccessNone,
+                           kRgAccessNone)
+                 .value();
+  auto a = g.CreateImage("a", Image(64, 64)).value();   // 16 KB
+  auto b = g.CreateImage("b", Image(64, 64)).value();   // 16 KB
+  auto c = g.CreateImage("c", Image(64, 128)).value();  // 32 KB
+
+  // c is placed first (largest) at 0; a reuses [0, 16K) and b, alive at the
+  // same time as a, lands on [16K, 32K). c then covers both.
+  auto p0 = g.AddPass("p0", RgPassType::kRaster, nullptr, nullptr).value();
+  REQUIRE(g.Write(p0, a, kRgAccessColorAttachment).ok());
+  auto p1 = g.AddPass("p1", RgPassType::kCompute, nullptr, nullptr).value();
+  REQUIRE(g.Read(p1, a, kRgAccessStorageRead).ok());
+  REQUIRE(g.Write(p1, b, kRgAccessStorageWrite).ok());
+  auto p2 = g.AddPass("p2", RgPassType::kRaster, nullptr, nullptr).value();
+  REQUIRE(g.Read(p2, b, kRgAccessSampled).ok());
+  REQUIRE(g.Write(p2, out, kRgAccessColorAttachment).ok());
+  auto p3 = g.AddPass("p3", RgPassType::kCompute, nullptr, nullptr).value();
+  REQUIRE(g.Write(p3, c, kRgAccessStorageWrite).ok());
+  REQUIRE(g.SetSideEffect(p3).ok());
+
+  REQUIRE(g.Compile(&backend).ok());
+  const RgTransientPlacement* pa = FindPlacement(g, a);
+  const RgTransientPlacement* pb = FindPlacement(g, b);
+  const RgTransientPlacement* pc = FindPlacement(g, c);
+  REQUIRE(pc->offset == 0u);
+  REQUIRE(pa->offset == 0u);
+  REQUIRE(pb->offset == 16384u);
+  REQUIRE(pc->alias_predecessor == b.index);  // the latest one
+
+  const RgBarrier* first_c = FindBarrier(g, 3, c);
+  REQUIRE(first_c->discard);
+  REQUIRE(first_c->src_access == (kRgAccessStorageRead | kRgAccessSampled));
+  REQUIRE(first_c->src_pass_types == (RgPassTypeBit(RgPassType::kCompute) |
+                                      RgPassTypeBit(RgPassType::kRaster)));
+
+  // Ordinary barriers cover just their source pass type.
+  const RgBarrier* read_b = FindBarrier(g, 2, b);
+  REQUIRE(read_b->src_pass_types == RgPassTypeBit(RgPassType::kCompute));
+}
+
+TEST_CASE("RenderGraph: write waits on every reader since the last barrier",
+          "[render][graph]") {
+  RenderGraph g;
+  REQUIRE(g.Init(Limits()).ok());
+  MockGraphBackend backend;
+
+  auto out = g.ImportImage("out", Image(8, 8), 0, kRgAccessNone,
+                           kRgAccessNone)
+                 .value();
+  auto t = g.CreateImage("t", Image(32, 32)).value();
+
+  // Raster and compute sample t with no barrier between them; the
+  // overwrite in p3 must wait for both.
+  auto p0 = g.AddPass("p0", RgPassType::kCompute, nullptr, nullptr).value();
+  REQUIRE(g.Write(p0, t, kRgAccessStorageWrite).ok());
+  auto p1 = g.AddPass("p1", RgPassType::kRaster, nullptr, nullptr).value();
+  REQUIRE(g.Read(p1, t, kRgAccessSampled).ok());
+  REQUIRE(g.Write(p1, out, kRgAccessColorAttachment).ok());
+  auto p2 = g.AddPass("p2", RgPassType::kCompute, nullptr, nullptr).value();
+  REQUIRE(g.Read(p2, t, kRgAccessSampled).ok());
+  REQUIRE(g.Write(p2, out, kRgAccessStorageWrite).ok());
+  auto p3 = g.AddPass("p3", RgPassType::kCompute, nullptr, nullptr).value();
+  REQUIRE(g.Write(p3, t, kRgAccessStorageWrite).ok());
+  REQUIRE(g.SetSideEffect(p3).ok());
+
+  REQUIRE(g.Compile(&backend).ok());
+  REQUIRE(FindBarrier(g, 2, t) == nullptr);  // read after read
+  const RgBarrier* read_t = FindBarrier(g, 1, t);
+  REQUIRE(read_t->src_pass_types == RgPassTypeBit(RgPassType::kCompute));
+
+  const RgBarrier* war = FindBarrier(g, 3, t);
+  REQUIRE(war != nullptr);
+  REQUIRE(war->src_access == kRgAccessSampled);
+  REQUIRE(war->src_pass_type == RgPassType::kCompute);
+  REQUIRE(war->src_pass_types == (RgPassTypeBit(RgPassType::kRaster) |
+                                  RgPassTypeBit(RgPassType::kCompute)));
+}
+
+TEST_CASE("RenderGraph: backend memory errors fail Compile",
+          "[render][graph]") {
+  RenderGraph g;
+  REQUIRE(g.Init(Limits()).ok());
+  MockGraphBackend backend;
+  backend.fail_requirements = true;
+
+  auto tmp = g.CreateImage("tmp", Image(8, 8)).value();
+  auto p0  = g.AddPass("p0", RgPassType::kRaster, nullptr, nullptr).value();
+  REQUIRE(g.Write(p0, tmp, kRgAccessColorAttachment).ok());
+  REQUIRE(g.SetSideEffect(p0).ok());
+
+  REQUIRE(g.Compile(&backend).code() == NavaryStatus::kNotFound);
+  REQUIRE(backend.realize_calls == 0u);
+  REQUIRE_FALSE(g.Execute(&backend, nullptr).ok());
+}
+
+TEST_CASE("RenderGraph: execute runs callbacks in compiled order",
+          "[render][graph]") {
+  RenderGraph g;
+  REQUIRE(g.Init(Limits()).ok());
+  MockGraphBackend backend;
+
+  std::vector<std::uint32_t> calls;
+  auto record = [](const RgPassContext& ctx, void* user) {
+    static_cast<std::vector<std::uint32_t>*>(user)->push_back(ctx.pass.index);
+  };
+
+  auto out = g.ImportImage("out", Image(8, 8), 0, kRgAccessNone,
+                           kRgAccessNone)
+                 .value();
+  auto tmp = g.CreateImage("tmp", Image(8, 8)).value();
+
+  auto p0 = g.AddPass("p0", RgPassType::kRaster, record, &calls).value();
+  REQUIRE(g.Write(p0, tmp, kRgAccessColorAttachment).ok());
+  auto unused =
+      g.AddPass("unused", RgPassType::kRaster, record, &calls).value();
+  auto p1 = g.AddPass("p1", RgPassType::kRaster, record, &calls).value();
+  REQUIRE(g.Read(p1, tmp, kRgAccessSampled).ok());
+  REQUIRE(g.Write(p1, out, kRgAccessColorAttachment).ok());
+
+  REQUIRE_FALSE(g.Execute(&backend, nullptr).ok());  // not compiled yet
+  REQUIRE(g.Compile(&backend).ok());
+  REQUIRE(g.Execute(&backend, nullptr).ok());
+
+  REQUIRE(calls.size() == 2u);
+  REQUIRE(calls[0] == p0.index);
+  REQUIRE(calls[1] == p1.index);
+  REQUIRE(g.IsPassCulled(unused));
+
+  // Reset keeps storage; the graph can be rebuilt the next frame.
+  g.Reset();
+  REQUIRE(g.pass_count() == 0u);
+  REQUIRE(g.resource_count() == 0u);
+}
+
+TEST_CASE("RenderGraph: rejects invalid declarations", "[render][graph]") {
+  RenderGraph g;
+  REQUIRE(g.Init(RenderGraphLimits{2, 2, 4}).ok());
+  MockGraphBackend backend;
+
+  auto tmp = g.CreateImage("tmp", Image(8, 8)).value();
+  auto p0  = g.AddPass("p0", RgPassType::kRaster, nullptr, nullptr).value();
+
+  REQUIRE(g.Read(p0, tmp, kRgAccessColorAttachment).code() ==
+          NavaryStatus::kInvalidArgument);
+  REQUIRE(g.Write(p0, tmp, kRgAccessSampled).code() ==
+          NavaryStatus::kInvalidArgument);
+  REQUIRE(g.Read(p0, RgResourceHandle{9}, kRgAccessSampled).code() ==
+          NavaryStatus::kInvalidArgument);
+
+  // Reading a transient nobody wrote yet.
+  REQUIRE(g.Read(p0, tmp, kRgAccessSampled).ok());
+  REQUIRE(g.SetSideEffect(p0).ok());
+  REQUIRE(g.Compile(&backend).code() == NavaryStatus::kInvalidArgument);
+
+  REQUIRE(g.CreateImage("b", Image(8, 8)).status().ok());
+  REQUIRE(g.CreateImage("c", Image(8, 8)).status().code() ==
+          NavaryStatus::kOutOfMemory);
+}
@@ -0,0 +1,320 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "navary/render/v1/upload_manager.h"
+
+using namespace navary;
+using namespace navary::render::v1;
+
+namespace {
+
+// Replays copies against CPU-side destinations.
+class RecordingUploadBackend : public UploadBackend {
+ public:
+  explicit RecordingUploadBackend(const std::uint8_t* staging)
+      : staging_(staging) {}
+
+  NavaryRC CopyBufferRegions(core::BufferHandle, core::BufferHandle dst,
+                             const BufferCopyRegion* regions,
+                             std::uint32_t count) override {
+    if (dst.index >= 4) {
+      return NavaryRC(NavaryStatus::kNotFound, "test: unknown buffer");
+    }
+    ++buffer_calls;
+    buffer_regions += count;
+    std::vector<std::uint8_t>& target = buffers[dst.index];
+    for (std::uint32_t i = 0; i < count; ++i) {
+      if (target.size() < regions[i].dst_offset + regions[i].size) {
+        target.resize(regions[i].dst_offset + regions[i].size);
+      }
+      std::memcpy(target.data() + regions[i].dst_offset,
+                  staging_ + regions[i].src_offset, regions[i].size);
+    }
+    return NavaryRC::OK();
+  }
+
+  NavaryRC CopyTextureRegions(core::BufferHandle, core::TextureHandle dst,
+                              const TextureCopyRegion* regions,
+                              std::uint32_t count) override {
+    ++texture_calls;
+    for (std::uint32_t i = 0; i < count; ++i) {
+      texture_log.push_back(
+          (static_cast<std::uint64_t>(dst.index) << 32) | regions[i].mip_level);
+    }
+    return NavaryRC::OK();
+  }
+
+  std::vector<std::uint8_t> buffers[4];
+  std::vector<std::uint64_t> texture_log;
+  std::uint32_t buffer_calls   = 0;
+  std::uint32_t buffer_regions = 0;
+  std::uint32_t texture_calls  = 0;
+
+ private:
+  const std::uint8_t* staging_;
+};
+
+UploadManagerDesc MakeDesc(std::vector<std::uint8_t>* staging,
+                           std::size_t budget) {
+  UploadManagerDesc desc{};
+  desc.staging_buffer       = core::BufferHandle{99};
+  desc.staging_mapped       = staging->data();
+  desc.staging_size         = staging->size();
+  desc.frame_budget_bytes   = budget;
+  desc.max_requests         = 256;
+  desc.max_frames_in_flight = 2;
+  desc.copy_alignment       = 16;
+  return desc;
+}
+
+}  // namespace
+
+TEST_CASE("UploadManager: coalesces contiguous buffer writes",
+          "[render][upload]") {
+  std::vector<std::uint8_t> staging(4096);
+  UploadManager uploads;
+  REQUIRE(uploads.Init(MakeDesc(&staging, 0)).ok());
+  uploads.BeginFrame(1);
+
+  // 64 x 16-byte writes to consecutive offsets of buffer 0, plus two
+  // scattered writes to buffer 1.
+  for (std::uint32_t i = 0; i < 64; ++i) {
+    std::uint8_t block[16];
+    std::memset(block, static_cast<int>(i), sizeof(block));
+    REQUIRE(uploads.UploadBuffer(core::BufferHandle{0}, i * 16, block, 16)
+                .status()
+                .ok());
+  }
+  const std::uint32_t a = 0xAAAAAAAAu;
+  const std::uint32_t b = 0xBBBBBBBBu;
+  REQUIRE(uploads.UploadBuffer(core::BufferHandle{1}, 256, &b, 4).status().ok());
+  REQUIRE(uploads.UploadBuffer(core::BufferHandle{1}, 0, &a, 4).status().ok());
+
+  RecordingUploadBackend backend(staging.data());
+  UploadStats stats{};
+  REQUIRE(uploads.Flush(&backend, &stats).ok());
+
+  REQUIRE(stats.requests == 66u);
+  REQUIRE(stats.destinations == 2u);
+  REQUIRE(stats.regions == 3u);  // one merged run + two scattered
+  REQUIRE(backend.buffer_calls == 2u);
+
+  for (std::uint32_t i = 0; i < 64; ++i) {
+    REQUIRE(backend.buffers[0][i * 16 + 7] == static_cast<std::uint8_t>(i));
+  }
+  std::uint32_t got = 0;
+  std::memcpy(&got, backend.buffers[1].data() + 256, 4);
+  REQUIRE(got == b);
+  std::memcpy(&got, backend.buffers[1].data(), 4);
+  REQUIRE(got == a);
+}
+
+TEST_CASE("UploadManager: overlapping writes resolve to the newest bytes",
+          "[render][upload]") {
+  std::vector<std::uint8_t> staging(1024);
+  UploadManager uploads;
+  REQUIRE(uploads.Init(MakeDesc(&staging, 0)).ok());
+  uploads.BeginFrame(1);
+
+  std::uint8_t wide[64];
+  std::memset(wide, 1, sizeof(wide));
+  std::uint8_t narrow[8];
+  std::memset(narrow, 2, sizeof(narrow));
+
+  REQUIRE(uploads.UploadBuffer(core::BufferHandle{0}, 16, narrow, 8)
+              .status()
+              .ok());
+  REQUIRE(uploads.UploadBuffer(core::BufferHandle{0}, 0, wide, 64)
+              .status()
+              .ok());
+
+  RecordingUploadBackend backend(staging.data());
+  UploadStats stats{};
+  REQUIRE(uploads.Flush(&backend, &stats).ok());
+  REQUIRE(backend.buffer_calls == 1u);
+  REQUIRE(stats.regions == 1u);  // the narrow write is fully shadowed
+  REQUIRE(backend.buffers[0][16] == 1u);  // later wide write wins
+}
+
+TEST_CASE("UploadManager: partial overlaps become disjoint regions",
+          "[render][upload]") {
+  std::vector<std::uint8_t> staging(1024);
+  UploadManager uploads;
+  REQUIRE(uploads.Init(MakeDesc(&staging, 0)).ok());
+  uploads.BeginFrame(1);
+
+  std::uint8_t a[32];
+  std::memset(a, 1, sizeof(a));
+  std::uint8_t b[16];
+  std::memset(b, 2, sizeof(b));
+  std::uint8_t c[32];
+  std::memset(c, 3, sizeof(c));
+
+  // [0, 32) = 1, then [8, 24) = 2 on top, then [28, 60) = 3.
+  REQUIRE(uploads.UploadBuffer(core::BufferHandle{0}, 0, a, 32).status().ok());
+  REQUIRE(uploads.UploadBuffer(core::BufferHandle{0}, 8, b, 16).status().ok());
+  REQUIRE(uploads.UploadBuffer(core::BufferHandle{0}, 28, c, 32).status().ok());
+
+  // Pieces: [0, 8) a, [8, 24) b, [24, 28) a, [28, 60) c.
+  RecordingUploadBackend backend(staging.data());
+  UploadStats stats{};
+  REQUIRE(uploads.Flush(&backend, &stats).ok());
+  REQUIRE(backend.buffer_calls == 1u);
+  REQUIRE(stats.regions == 4u);
+
+  const std::vector<std::uint8_t>& out = backend.buffers[0];
+  REQUIRE(out.size() == 60u);
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    const std::uint8_t want = i >= 28 ? 3 : (i >= 8 && i < 24 ? 2 : 1);
+    REQUIRE(out[i] == want);
+  }
+}
+
+TEST_CASE("UploadManager: repeated texture mips upload once",
+          "[render][upload]") {
+  std::vector<std::uint8_t> staging(4096);
+  UploadManager uploads;
+  REQUIRE(uploads.Init(MakeDesc(&staging, 0)).ok());
+  uploads.BeginFrame(1);
+
+  std::uint8_t texels[64] = {};
+  for (std::uint32_t i = 0; i < 3; ++i) {
+    REQUIRE(uploads
+                .UploadTexture(core::TextureHandle{0}, 0, 0, 4, 4, texels,
+                               sizeof(texels))
+                .status()
+                .ok());
+  }
+  REQUIRE(uploads
+              .UploadTexture(core::TextureHandle{0}, 1, 0, 2, 2, texels, 16)
+              .status()
+              .ok());
+
+  RecordingUploadBackend backend(staging.data());
+  UploadStats stats{};
+  REQUIRE(uploads.Flush(&backend, &stats).ok());
+  REQUIRE(backend.texture_calls == 1u);
+  REQUIRE(stats.regions == 2u);
+}
+
+TEST_CASE("UploadManager: texture mips batch per texture",
+          "[render][upload]") {
+  std::vector<std::uint8_t> staging(1 << 16);
+  UploadManager uploads;
+  REQUIRE(uploads.Init(MakeDesc(&staging, 0)).ok());
+  uploads.BeginFrame(5);
+
+  std::vector<std::uint8_t> texels(64 * 64 * 4, 0x7F);
+  for (std::uint32_t tex = 0; tex < 3; ++tex) {
+    for (std::uint32_t mip = 0; mip < 4; ++mip) {
+      const std::uint32_t dim = 64u >> mip;
+      auto ticket_or = uploads.UploadTexture(core::TextureHandle{2 - tex},
+                                             3 - mip, 0, dim, dim,
+                                             texels.data(), dim * dim * 4);
+      REQUIRE(ticket_or.status().ok());
+      REQUIRE(ticket_or.value().frame == 5u);
+    }
+  }
+
+  RecordingUploadBackend backend(staging.data());
+  UploadStats stats{};
+  REQUIRE(uploads.Flush(&backend, &stats).ok());
+  REQUIRE(backend.texture_calls == 3u);
+  REQUIRE(stats.regions == 12u);
+  REQUIRE(backend.texture_log.size() == 12u);
+  REQUIRE(backend.texture_log.front() == 0u);  // texture 0, mip 0 first
+}
+
+TEST_CASE("UploadManager: frame budget defers the remainder",
+          "[render][upload]") {
+  std::vector<std::uint8_t> staging(1 << 16);
+  UploadManager uploads;
+  REQUIRE(uploads.Init(MakeDesc(&staging, 1024)).ok());
+
+  std::vector<std::uint8_t> chunk(256, 3);
+  uploads.BeginFrame(1);
+  std::uint32_t accepted = 0;
+  for (std::uint32_t i = 0; i < 10; ++i) {
+    auto ticket_or =
+        uploads.UploadBuffer(core::BufferHandle{0}, i * 256, chunk.data(), 256);
+    if (!ticket_or.status().ok()) {
+      REQUIRE(ticket_or.status().code() == NavaryStatus::kOutOfMemory);
+      break;
+    }
+    ++accepted;
+  }
+  REQUIRE(accepted == 4u);
+  REQUIRE(uploads.remaining_budget() == 0u);
+
+  // A single oversized request still goes through at the start of a frame.
+  uploads.BeginFrame(2);
+  std::vector<std::uint8_t> big(4096, 1);
+  REQUIRE(uploads.UploadBuffer(core::BufferHandle{0}, 0, big.data(), 4096)
+              .status()
+              .ok());
+  REQUIRE(!uploads.UploadBuffer(core::BufferHandle{0}, 0, chunk.data(), 16)
+               .status()
+               .ok());
+}
+
+TEST_CASE("UploadManager: staging retires by completed frame",
+          "[render][upload]") {
+  std::vector<std::uint8_t> staging(1024);
+  UploadManager uploads;
+  REQUIRE(uploads.Init(MakeDesc(&staging, 0)).ok());
+  RecordingUploadBackend backend(staging.data());
+  std::vector<std::uint8_t> chunk(400, 9);
+
+  uploads.BeginFrame(1);
+  auto t1 = uploads.UploadBuffer(core::BufferHandle{0}, 0, chunk.data(), 400);
+  REQUIRE(t1.status().ok());
+  REQUIRE(uploads.Flush(&backend).ok());
+
+  uploads.BeginFrame(2);
+  auto t2 = uploads.UploadBuffer(core::BufferHandle{0}, 0, chunk.data(), 400);
+  REQUIRE(t2.status().ok());
+  REQUIRE(uploads.Flush(&backend).ok());
+
+  // Frames 1 and 2 still in flight: no room for a third 400-byte block.
+  uploads.BeginFrame(3);
+  auto t3 = uploads.UploadBuffer(core::BufferHandle{0}, 0, chunk.data(), 400);
+  REQUIRE(t3.status().code() == NavaryStatus::kOutOfMemory);
+  REQUIRE(!uploads.IsComplete(t1.value()));
+
+  // Frame 1 done: its range at the start of the ring is reused (wrap).
+  uploads.NotifyFrameComplete(1);
+  REQUIRE(uploads.IsComplete(t1.value()));
+  REQUIRE(!uploads.IsComplete(t2.value()));
+  t3 = uploads.UploadBuffer(core::BufferHandle{0}, 0, chunk.data(), 400);
+  REQUIRE(t3.status().ok());
+  REQUIRE(t3.value().frame == 3u);
+  REQUIRE(uploads.Flush(&backend).ok());
+
+  uploads.BeginFrame(4);
+  uploads.NotifyFrameComplete(3);
+  REQUIRE(uploads.IsComplete(t3.value()));
+  REQUIRE(uploads.staging_in_use() == 0u);
+}
+
+TEST_CASE("UploadManager: backend errors fail Flush and keep the queue",
+          "[render][upload]") {
+  std::vector<std::uint8_t> staging(1024);
+  UploadManager uploads;
+  REQUIRE(uploads.Init(MakeDesc(&staging, 0)).ok());
+  uploads.BeginFrame(1);
+
+  const std::uint32_t v = 0x12345678u;
+  REQUIRE(uploads.UploadBuffer(core::BufferHandle{0}, 0, &v, 4).status().ok());
+  REQUIRE(uploads.UploadBuffer(core::BufferHandle{9}, 0, &v, 4).status().ok());
+
+  RecordingUploadBackend backend(staging.data());
+  REQUIRE(uploads.Flush(&backend).code() == NavaryStatus::kNotFound);
+  REQUIRE(backend.buffer_calls == 1u);  // buffer 0 sorted first
+
+  // The queue survives, so a retry re-records everything.
+  REQUIRE(uploads.Flush(&backend).code() == NavaryStatus::kNotFound);
+  REQUIRE(backend.buffer_calls == 2u);
+}
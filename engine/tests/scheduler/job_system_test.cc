@@ -0,0 +1,141 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "navary/core/scheduler/job_system.h"
+
+using namespace navary::core::scheduler;
+
+namespace {
+
+struct ForState {
+  std::vector<std::atomic<std::uint32_t>>* hits;
+  std::atomic<std::uint32_t> bad_worker{0};
+  std::uint32_t thread_count;
+};
+
+void MarkRange(std::uint32_t begin, std::uint32_t end, std::uint32_t worker,
+               void* user) {
+  auto* s = static_cast<ForState*>(user);
+  if (worker >= s->thread_count) {
+    s->bad_worker.fetch_add(1);
+  }
+  for (std::uint32_t i = begin; i < end; ++i) {
+    (*s->hits)[i].fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+struct NestedState {
+  JobSystem* jobs;
+  std::atomic<std::uint64_t> sum{0};
+};
+
+void InnerSum(std::uint32_t begin, std::uint32_t end, std::uint32_t, void* u) {
+  auto* s = static_cast<NestedState*>(u);
+  std::uint64_t local = 0;
+  for (std::uint32_t i = begin; i < end; ++i) {
+    local += i;
+  }
+  s->sum.fetch_add(local);
+}
+
+void OuterFor(std::uint32_t begin, std::uint32_t end, std::uint32_t, void* u) {
+  auto* s = static_cast<NestedState*>(u);
+  for (std::uint32_t i = begin; i < end; ++i) {
+    s->jobs->ParallelFor(1000, 64, &InnerSum, s);
+  }
+}
+
+struct CrossState {
+  JobSystem* inner;
+  ForState inner_state;
+};
+
+// Runs on the outer system's workers and calls into the inner one.
+void CrossFor(std::uint32_t begin, std::uint32_t end, std::uint32_t, void* u) {
+  auto* s = static_cast<CrossState*>(u);
+  for (std::uint32_t i = begin; i < end; ++i) {
+    s->inner->ParallelFor(1, 1, &MarkRange, &s->inner_state);
+  }
+}
+
+void Increment(void* user) {
+  static_cast<std::atomic<std::uint32_t>*>(user)->fetch_add(1);
+}
+
+}  // namespace
+
+TEST_CASE("JobSystem: ParallelFor visits every index once", "[scheduler]") {
+  JobSystem jobs;
+  REQUIRE(jobs.Init(3).ok());
+  REQUIRE(jobs.thread_count() == 4u);
+  REQUIRE(jobs.WorkerIndex() == 0u);
+
+  const std::uint32_t n = 100000;
+  std::vector<std::atomic<std::uint32_t>> hits(n);
+  ForState state;
+  state.hits         = &hits;
+  state.thread_count = jobs.thread_count();
+
+  jobs.ParallelFor(n, 1000, &MarkRange, &state);
+
+  std::uint32_t wrong = 0;
+  for (auto& h : hits) {
+    wrong += h.load() != 1u ? 1u : 0u;
+  }
+  REQUIRE(wrong == 0u);
+  REQUIRE(state.bad_worker.load() == 0u);
+  REQUIRE(jobs.stats().executed_jobs >= 100u);
+}
+
+TEST_CASE("JobSystem: nested ParallelFor completes", "[scheduler]") {
+  JobSystem jobs;
+  REQUIRE(jobs.Init(2, 32).ok());  // small queue forces inline fallback
+
+  NestedState state;
+  state.jobs = &jobs;
+  jobs.ParallelFor(16, 1, &OuterFor, &state);
+
+  REQUIRE(state.sum.load() == 16ull * (999ull * 1000ull / 2ull));
+}
+
+TEST_CASE("JobSystem: worker index is local to each system",
+          "[scheduler]") {
+  JobSystem outer;
+  JobSystem inner;
+  REQUIRE(outer.Init(3).ok());
+  REQUIRE(inner.Init(0).ok());
+
+  std::vector<std::atomic<std::uint32_t>> hits(1);
+  CrossState state;
+  state.inner                    = &inner;
+  state.inner_state.hits         = &hits;
+  state.inner_state.thread_count = inner.thread_count();
+
+  // Inline ranges of |inner| run on |outer|'s workers; they must see
+  // index 0, not the outer worker's.
+  outer.ParallelFor(256, 1, &CrossFor, &state);
+  REQUIRE(hits[0].load() == 256u);
+  REQUIRE(state.inner_state.bad_worker.load() == 0u);
+}
+
+TEST_CASE("JobSystem: Submit and Wait on a counter", "[scheduler]") {
+  JobSystem jobs;
+  REQUIRE(jobs.Init(2).ok());
+
+  std::atomic<std::uint32_t> value{0};
+  JobCounter counter;
+  for (int i = 0; i < 500; ++i) {
+    jobs.Submit(&Increment, &value, &counter);
+  }
+  jobs.Wait(&counter);
+
+  REQUIRE(counter.Done());
+  REQUIRE(value.load() == 500u);
+
+  jobs.Shutdown();
+  jobs.Shutdown();  // idempotent
+  REQUIRE(jobs.thread_count() == 1u);
+}
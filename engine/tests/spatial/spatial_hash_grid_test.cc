@@ -0,0 +1,287 @@
+// Navary Engine - Spatial Subsystem Tests
+// File: tests/spatial/spatial_hash_grid_test.cc
+// Focus: radius and k-nearest queries against brute force (float and
+//        fixed), negative coordinates, hash collisions, deterministic
+//        parallel rebuild and neighbor updates.
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "navary/core/scheduler/job_system.h"
+#include "navary/spatial/spatial_hash_grid.h"
+
+using namespace navary;
+using namespace navary::spatial;
+using navary::core::scheduler::JobSystem;
+using navary::math::FixedVec3;
+using navary::math::Fixed15p16;
+using navary::math::Vec3;
+
+namespace {
+
+struct Rng {
+  std::uint32_t state;
+
+  float Next(float lo, float hi) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return lo + (hi - lo) * static_cast<float>(state & 0xFFFFFF) / 16777216.0f;
+  }
+};
+
+std::vector<Vec3> RandomPoints(std::uint32_t n, float extent, bool flat,
+                               std::uint32_t seed) {
+  Rng rng{seed};
+  std::vector<Vec3> points(n);
+  for (Vec3& p : points) {
+    p.x = rng.Next(-extent, extent);
+    p.y = flat ? 0.0f : rng.Next(-extent, extent);
+    p.z = rng.Next(-extent, extent);
+  }
+  return points;
+}
+
+std::vector<std::uint32_t> BruteRadius(const std::vector<Vec3>& points,
+                                       const Vec3& c, float r) {
+  std::vector<std::uint32_t> out;
+  for (std::uint32_t i = 0; i < points.size(); ++i) {
+    if ((points[i] - c).length_sq() <= r * r) {
+      out.push_back(i);
+    }
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST_CASE("SpatialHashGrid: rejects invalid descriptors", "[spatial]") {
+  FloatSpatialHashGrid grid;
+  FloatSpatialHashGrid::Desc desc;
+  desc.cell_size = 0.0f;
+  REQUIRE(grid.Init(desc).code() == NavaryStatus::kInvalidArgument);
+  desc.cell_size    = 1.0f;
+  desc.bucket_count = 100;  // not a power of two
+  REQUIRE(grid.Init(desc).code() == NavaryStatus::kInvalidArgument);
+  desc.bucket_count = 0;
+  desc.max_points   = 4;
+  REQUIRE(grid.Init(desc).ok());
+  REQUIRE(grid.bucket_count() == 4);
+
+  const Vec3 pts[5] = {};
+  REQUIRE(grid.Rebuild(pts, 5, nullptr).code() ==
+          NavaryStatus::kInvalidArgument);
+  REQUIRE(grid.Rebuild(pts, 4, nullptr).ok());
+}
+
+TEST_CASE("SpatialHashGrid: radius query matches brute force", "[spatial]") {
+  const std::vector<Vec3> points = RandomPoints(3000, 50.0f, false, 7);
+
+  // A tiny table forces many cells into each bucket.
+  for (std::uint32_t buckets : {16u, 0u}) {
+    FloatSpatialHashGrid grid;
+    FloatSpatialHashGrid::Desc desc;
+    desc.max_points   = 4096;
+    desc.bucket_count = buckets;
+    desc.cell_size    = 4.0f;
+    REQUIRE(grid.Init(desc).ok());
+    REQUIRE(grid.Rebuild(points.data(), 3000, nullptr).ok());
+
+    Rng rng{99};
+    for (int q = 0; q < 50; ++q) {
+      const Vec3 c(rng.Next(-55, 55), rng.Next(-55, 55), rng.Next(-55, 55));
+      const float r = rng.Next(0.5f, 9.0f);
+      std::vector<std::uint32_t> got(3000);
+      got.resize(grid.QueryRadius(c, r, got.data(), 3000));
+      std::sort(got.begin(), got.end());
+      REQUIRE(got == BruteRadius(points, c, r));
+    }
+  }
+}
+
+TEST_CASE("SpatialHashGrid: k-nearest sorted by distance then id",
+          "[spatial]") {
+  const std::vector<Vec3> points = RandomPoints(2000, 30.0f, true, 3);
+  FloatSpatialHashGrid grid;
+  FloatSpatialHashGrid::Desc desc;
+  desc.max_points = 2000;
+  desc.cell_size  = 3.0f;
+  desc.planar     = true;
+  REQUIRE(grid.Init(desc).ok());
+  REQUIRE(grid.Rebuild(points.data(), 2000, nullptr).ok());
+
+  for (std::uint32_t q = 0; q < 40; ++q) {
+    const Vec3& c = points[q * 37];
+    std::vector<std::uint32_t> brute = BruteRadius(points, c, 6.0f);
+    brute.erase(std::remove(brute.begin(), brute.end(), q * 37), brute.end());
+    std::sort(brute.begin(), brute.end(),
+              [&](std::uint32_t a, std::uint32_t b) {
+                const float da = (points[a] - c).length_sq();
+                const float db = (points[b] - c).length_sq();
+                return da < db || (da == db && a < b);
+              });
+    brute.resize(std::min<std::size_t>(brute.size(), 8));
+
+    std::uint32_t ids[8];
+    float dist[8];
+    const std::uint32_t n = grid.QueryKNearest(c, 6.0f, 8, ids, dist, q * 37);
+    REQUIRE(n == brute.size());
+    for (std::uint32_t i = 0; i < n; ++i) {
+      REQUIRE(ids[i] == brute[i]);
+      REQUIRE(dist[i] == Catch::Approx((points[ids[i]] - c).length_sq()));
+    }
+  }
+}
+
+TEST_CASE("SpatialHashGrid: cell boundaries and negative coordinates",
+          "[spatial]") {
+  const Vec3 pts[4] = {{-0.001f, 0, -0.001f},
+                       {0.0f, 0, 0.0f},
+                       {-2.0f, 0, 0.0f},
+                       {1.999f, 0, 0.0f}};
+  FloatSpatialHashGrid grid;
+  FloatSpatialHashGrid::Desc desc;
+  desc.max_points = 4;
+  desc.cell_size  = 2.0f;
+  desc.planar     = true;
+  REQUIRE(grid.Init(desc).ok());
+  REQUIRE(grid.Rebuild(pts, 4, nullptr).ok());
+
+  std::uint32_t ids[4];
+  REQUIRE(grid.QueryRadius(Vec3(0, 0, 0), 2.0f, ids, 4) == 4);
+  REQUIRE(grid.QueryRadius(Vec3(0, 0, 0), 0.01f, ids, 4) == 2);
+  REQUIRE(grid.QueryRadius(Vec3(0, 0, 0), 2.0f, ids, 4, 1) == 3);
+  REQUIRE(grid.QueryRadius(Vec3(0, 0, 0), 2.0f, ids, 2) == 2);  // truncated
+}
+
+TEST_CASE("SpatialHashGrid: fixed-point variant is exact", "[spatial]") {
+  const std::vector<Vec3> floats = RandomPoints(1500, 40.0f, false, 11);
+  std::vector<FixedVec3> points;
+  for (const Vec3& p : floats) {
+    points.emplace_back(Fixed15p16::FromFloat(p.x), Fixed15p16::FromFloat(p.y),
+                        Fixed15p16::FromFloat(p.z));
+  }
+
+  FixedSpatialHashGrid grid;
+  FixedSpatialHashGrid::Desc desc;
+  desc.max_points = 2048;
+  desc.cell_size  = Fixed15p16::FromInt(5);
+  REQUIRE(grid.Init(desc).ok());
+  REQUIRE(grid.Rebuild(points.data(), 1500, nullptr).ok());
+
+  const Fixed15p16 radius = Fixed15p16::FromFraction(15, 2);
+  const std::int64_t r    = radius.Raw();
+  for (std::uint32_t q = 0; q < 30; ++q) {
+    const FixedVec3& c = points[q * 41];
+    std::vector<std::uint32_t> brute;
+    for (std::uint32_t i = 0; i < points.size(); ++i) {
+      const std::int64_t dx = points[i].x.Raw() - c.x.Raw();
+      const std::int64_t dy = points[i].y.Raw() - c.y.Raw();
+      const std::int64_t dz = points[i].z.Raw() - c.z.Raw();
+      if (dx * dx + dy * dy + dz * dz <= r * r) {
+        brute.push_back(i);
+      }
+    }
+    std::vector<std::uint32_t> got(1500);
+    got.resize(grid.QueryRadius(c, radius, got.data(), 1500));
+    std::sort(got.begin(), got.end());
+    REQUIRE(got == brute);
+
+    std::uint32_t ids[4];
+    std::int64_t dist[4];
+    const std::uint32_t n = grid.QueryKNearest(c, radius, 4, ids, dist);
+    REQUIRE(n >= 1);
+    REQUIRE(ids[0] == q * 41);  // itself, distance zero
+    REQUIRE(dist[0] == 0);
+  }
+}
+
+TEST_CASE("SpatialHashGrid: parallel rebuild is deterministic", "[spatial]") {
+  const std::vector<Vec3> points = RandomPoints(20000, 100.0f, true, 5);
+  JobSystem jobs;
+  REQUIRE(jobs.Init(3).ok());
+
+  FloatSpatialHashGrid::Desc desc;
+  desc.max_points = 20000;
+  desc.cell_size  = 2.0f;
+  desc.planar     = true;
+  FloatSpatialHashGrid serial;
+  FloatSpatialHashGrid parallel;
+  REQUIRE(serial.Init(desc).ok());
+  REQUIRE(parallel.Init(desc).ok());
+  REQUIRE(serial.Rebuild(points.data(), 20000, nullptr).ok());
+  REQUIRE(parallel.Rebuild(points.data(), 20000, &jobs).ok());
+
+  REQUIRE(std::equal(serial.sorted_ids(), serial.sorted_ids() + 20000,
+                     parallel.sorted_ids()));
+  REQUIRE(std::equal(serial.sorted_x(), serial.sorted_x() + 20000,
+                     parallel.sorted_x()));
+
+  // Every id appears exactly once.
+  std::vector<std::uint32_t> ids(parallel.sorted_ids(),
+                                 parallel.sorted_ids() + 20000);
+  std::sort(ids.begin(), ids.end());
+  for (std::uint32_t i = 0; i < 20000; ++i) {
+    REQUIRE(ids[i] == i);
+  }
+  jobs.Shutdown();
+}
+
+TEST_CASE("SpatialHashGrid: batched queries and neighbor lists agree",
+          "[spatial]") {
+  const std::uint32_t n          = 5000;
+  const std::uint32_t k          = 6;
+  const std::vector<Vec3> points = RandomPoints(n, 60.0f, true, 21);
+  JobSystem jobs;
+  REQUIRE(jobs.Init(3).ok());
+
+  FloatSpatialHashGrid grid;
+  FloatSpatialHashGrid::Desc desc;
+  desc.max_points = n;
+  desc.cell_size  = 2.5f;
+  desc.planar     = true;
+  REQUIRE(grid.Init(desc).ok());
+  REQUIRE(grid.Rebuild(points.data(), n, &jobs).ok());
+
+  std::vector<std::uint32_t> neighbor_ids(n * k);
+  std::vector<std::uint32_t> neighbor_counts(n);
+  grid.UpdateNeighbors(2.5f, k, neighbor_ids.data(), neighbor_counts.data(),
+                       &jobs);
+
+  std::vector<std::uint32_t> radius_ids(n * 64);
+  std::vector<std::uint32_t> radius_counts(n);
+  grid.QueryRadiusBatch(points.data(), n, 2.5f, 64, radius_ids.data(),
+                        radius_counts.data(), &jobs);
+
+  std::vector<std::uint32_t> knn_ids(n * (k + 1));
+  std::vector<std::uint32_t> knn_counts(n);
+  grid.QueryKNearestBatch(points.data(), n, 2.5f, k + 1, knn_ids.data(),
+                          knn_counts.data(), &jobs);
+
+  for (std::uint32_t i = 0; i < n; ++i) {
+    // The radius set includes the point itself.
+    REQUIRE(radius_counts[i] >= 1);
+    REQUIRE(neighbor_counts[i] == std::min(radius_counts[i] - 1, k));
+
+    // k + 1 nearest minus self equals the k neighbors (unless a duplicate
+    // position ties with self at distance zero).
+    std::uint32_t self_at = knn_counts[i];
+    for (std::uint32_t j = 0; j < knn_counts[i]; ++j) {
+      if (knn_ids[i * (k + 1) + j] == i) {
+        self_at = j;
+      }
+    }
+    REQUIRE(self_at < knn_counts[i]);
+    std::uint32_t w = 0;
+    for (std::uint32_t j = 0; j < knn_counts[i] && w < k; ++j) {
+      if (j != self_at) {
+        REQUIRE(knn_ids[i * (k + 1) + j] == neighbor_ids[i * k + w]);
+        ++w;
+      }
+    }
+  }
+  jobs.Shutdown();
+}
@@ -0,0 +1,626 @@
+// Navary Engine - Terrain Subsystem Tests
+// File: tests/terrain/heightfield_terrain_test.cc
+// Focus: .nvtr writer tables and decimation, tile cache LRU residency over
+//        AsyncIo, LOD selection and culling, patch list overflow,
+//        crack-free stitching, SIMD height / normal queries and raycasts
+//        against the source grid.
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "navary/io/async_io.h"
+#include "navary/math/frustum.h"
+#include "navary/math/mat4.h"
+#include "navary/terrain/heightfield_terrain.h"
+#include "navary/terrain/terrain_format.h"
+#include "navary/terrain/terrain_tile_cache.h"
+#include "navary/terrain/terrain_writer.h"
+
+using namespace navary;
+using namespace navary::terrain;
+
+namespace {
+
+constexpr float kPi = 3.14159265f;
+
+// Deterministic [0, 1) floats.
+struct Rng {
+  std::mt19937 engine;
+  std::uniform_real_distribution<float> unit{0.0f, 1.0f};
+
+  explicit Rng(std::uint32_t seed) : engine(seed) {}
+  float NextFloat() {
+    return unit(engine);
+  }
+};
+
+float Bumpy(float x, float z) {
+  return 20.0f * std::sin(x * 0.05f) * std::cos(z * 0.04f) +
+         5.0f * std::sin(x * 0.31f + z * 0.17f) + 0.01f * x;
+}
+
+float Tilted(float x, float z) {
+  return 0.5f * x + 0.25f * z + 10.0f;
+}
+
+std::vector<float> MakeHeights(std::uint32_t n, float (*f)(float, float)) {
+  std::vector<float> h(std::size_t{n} * n);
+  for (std::uint32_t z = 0; z < n; ++z) {
+    for (std::uint32_t x = 0; x < n; ++x) {
+      h[z * n + x] = f(static_cast<float>(x), static_cast<float>(z));
+    }
+  }
+  return h;
+}
+
+std::string WriteMap(const char* name, const std::vector<float>& heights,
+                     std::uint32_t n, std::uint32_t tile_quads) {
+  const std::string path =
+      (std::filesystem::temp_directory_path() / name).string();
+  TerrainBuildOptions options;
+  options.tile_quads = tile_quads;
+  REQUIRE(WriteTerrainFile(path.c_str(), heights.data(), n, options).ok());
+  return path;
+}
+
+struct Io {
+  io::AsyncIo io;
+
+  Io() {
+    io::AsyncIoDesc desc;
+    desc.backend = io::AsyncIoBackendKind::kThreadPool;
+    REQUIRE(io.Init(desc).ok());
+  }
+};
+
+HeightfieldTerrain::Desc TerrainDesc(const std::string& path, Io* io,
+                                     std::uint32_t max_resident) {
+  HeightfieldTerrain::Desc desc;
+  desc.path               = path.c_str();
+  desc.async_io           = &io->io;
+  desc.max_resident_tiles = max_resident;
+  return desc;
+}
+
+// Updates until two frames in a row start no loads with none in flight
+// (a tile that lands in one frame is only refined into in the next).
+void Settle(HeightfieldTerrain* t, const TerrainView& view) {
+  int quiet = 0;
+  for (int i = 0; i < 2000 && quiet < 2; ++i) {
+    const std::uint64_t started = t->cache().stats().loads_started;
+    t->Update(view);
+    const bool idle = t->cache().loads_in_flight() == 0 &&
+                      t->cache().stats().loads_started == started;
+    quiet           = idle ? quiet + 1 : 0;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+void PumpLoads(TerrainTileCache* cache) {
+  for (int i = 0; i < 2000 && cache->loads_in_flight() > 0; ++i) {
+    cache->Update();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+void LoadAll(HeightfieldTerrain* t) {
+  for (std::uint32_t node = 0; node < t->cache().header().node_count;
+       ++node) {
+    REQUIRE(t->cache().LoadBlocking(node, false).ok());
+  }
+}
+
+// Height of a patch edge at world coordinate |c| along it.
+float EdgeHeight(const TerrainPatch& p, const std::vector<float>& h,
+                 std::uint32_t tile_quads, int edge, float c) {
+  const std::uint32_t side = tile_quads + 1;
+  const bool along_z = edge == kTerrainEdgeMinX || edge == kTerrainEdgeMaxX;
+  const float o      = along_z ? p.origin_z : p.origin_x;
+  const float u      = (c - o) / p.spacing;
+  const auto k0 = std::min(static_cast<std::uint32_t>(u), tile_quads - 1);
+  const float f = u - static_cast<float>(k0);
+  auto at       = [&](std::uint32_t k) {
+    switch (edge) {
+      case kTerrainEdgeMinX:
+        return h[k * side];
+      case kTerrainEdgeMaxX:
+        return h[k * side + tile_quads];
+      case kTerrainEdgeMinZ:
+        return h[k];
+      default:
+        return h[tile_quads * side + k];
+    }
+  };
+  return at(k0) + (at(k0 + 1) - at(k0)) * f;
+}
+
+// Largest height mismatch over every shared edge; |mixed| counts shared
+// edges between patches of different depth.
+float WorstSeam(const HeightfieldTerrain& t, bool stitched, int* mixed) {
+  const std::uint32_t tq = t.cache().header().tile_quads;
+  const float spacing    = t.cache().header().sample_spacing;
+  std::vector<std::vector<float>> heights(t.patch_count());
+  for (std::uint32_t i = 0; i < t.patch_count(); ++i) {
+    TerrainPatch p = t.patches()[i];
+    if (!stitched) {
+      std::fill(p.stitch, p.stitch + 4, std::uint8_t{0});
+    }
+    heights[i].resize(TerrainTileSamples(tq));
+    t.BuildPatchHeights(p, heights[i].data());
+  }
+  float worst = 0.0f;
+  *mixed      = 0;
+  for (std::uint32_t a = 0; a < t.patch_count(); ++a) {
+    for (std::uint32_t b = 0; b < t.patch_count(); ++b) {
+      const TerrainPatch& pa = t.patches()[a];
+      const TerrainPatch& pb = t.patches()[b];
+      const float sa         = pa.spacing * tq;
+      const float sb         = pb.spacing * tq;
+      int ea                 = -1;
+      int eb                 = -1;
+      float lo               = 0.0f;
+      float hi               = 0.0f;
+      if (pa.origin_x + sa == pb.origin_x) {
+        ea = kTerrainEdgeMaxX;
+        eb = kTerrainEdgeMinX;
+        lo = std::max(pa.origin_z, pb.origin_z);
+        hi = std::min(pa.origin_z + sa, pb.origin_z + sb);
+      } else if (pa.origin_z + sa == pb.origin_z) {
+        ea = kTerrainEdgeMaxZ;
+        eb = kTerrainEdgeMinZ;
+        lo = std::max(pa.origin_x, pb.origin_x);
+        hi = std::min(pa.origin_x + sa, pb.origin_x + sb);
+      }
+      if (ea < 0 || hi <= lo) {
+        continue;
+      }
+      if (pa.depth != pb.depth) {
+        ++*mixed;
+      }
+      for (float c = lo; c <= hi; c += spacing) {
+        const float ha = EdgeHeight(pa, heights[a], tq, ea, c);
+        const float hb = EdgeHeight(pb, heights[b], tq, eb, c);
+        worst          = std::max(worst, std::fabs(ha - hb));
+      }
+    }
+  }
+  return worst;
+}
+
+}  // namespace
+
+TEST_CASE("TerrainWriter: node table, decimated tiles, monotone error",
+          "[terrain]") {
+  constexpr std::uint32_t kTile = 16;
+  constexpr std::uint32_t kN    = (kTile << 3) + 1;
+  const std::vector<float> src  = MakeHeights(kN, Bumpy);
+  const std::string path = WriteMap("navary_writer.nvtr", src, kN, kTile);
+
+  std::FILE* f = std::fopen(path.c_str(), "rb");
+  REQUIRE(f != nullptr);
+  TerrainFileHeader h{};
+  REQUIRE(std::fread(&h, sizeof(h), 1, f) == 1);
+  REQUIRE(h.magic == kTerrainMagic);
+  REQUIRE(h.max_depth == 3);
+  REQUIRE(h.node_count == TerrainNodeCount(3));
+  std::vector<TerrainNodeRecord> records(h.node_count);
+  REQUIRE(std::fread(records.data(), sizeof(TerrainNodeRecord), h.node_count,
+                     f) == h.node_count);
+  std::vector<std::uint16_t> tiles(std::size_t{h.node_count} *
+                                   TerrainTileSamples(kTile));
+  REQUIRE(std::fread(tiles.data(), 2, tiles.size(), f) == tiles.size());
+  std::fclose(f);
+
+  const float quant = h.height_scale * 0.5f + 1e-4f;
+  for (std::uint32_t d = 0; d <= h.max_depth; ++d) {
+    const std::uint32_t stride = 1u << (h.max_depth - d);
+    for (std::uint32_t z = 0; z < (1u << d); ++z) {
+      for (std::uint32_t x = 0; x < (1u << d); ++x) {
+        const std::uint32_t node   = TerrainNodeIndex(d, x, z);
+        const TerrainNodeRecord& r = records[node];
+        const float mn  = h.height_offset + r.min_q * h.height_scale;
+        const float mx  = h.height_offset + r.max_q * h.height_scale;
+        const auto* t   = tiles.data() + node * TerrainTileSamples(kTile);
+        const auto ox   = x * kTile * stride;
+        const auto oz   = z * kTile * stride;
+        bool bounds_ok  = true;
+        bool samples_ok = true;
+        for (std::uint32_t b = 0; b <= kTile * stride; ++b) {
+          for (std::uint32_t a = 0; a <= kTile * stride; ++a) {
+            const float v = src[(oz + b) * kN + ox + a];
+            bounds_ok     = bounds_ok && v >= mn - quant && v <= mx + quant;
+          }
+        }
+        for (std::uint32_t j = 0; j <= kTile; ++j) {
+          for (std::uint32_t i = 0; i <= kTile; ++i) {
+            const float v = h.height_offset +
+                            t[j * (kTile + 1) + i] * h.height_scale;
+            const float s = src[(oz + j * stride) * kN + ox + i * stride];
+            samples_ok    = samples_ok && std::fabs(v - s) <= quant;
+          }
+        }
+        REQUIRE(bounds_ok);
+        REQUIRE(samples_ok);
+        if (d == h.max_depth) {
+          REQUIRE(r.error == 0.0f);
+        } else {
+          REQUIRE(r.error > 0.0f);
+          for (std::uint32_t c = 0; c < 4; ++c) {
+            const auto child = TerrainNodeIndex(d + 1, 2 * x + (c & 1),
+                                                2 * z + (c >> 1));
+            REQUIRE(r.error >= records[child].error);
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<float> bad(100 * 100, 0.0f);
+  REQUIRE(WriteTerrainFile(path.c_str(), bad.data(), 100).code() ==
+          NavaryStatus::kInvalidArgument);
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("TerrainTileCache: LRU eviction spares tiles used this frame",
+          "[terrain]") {
+  constexpr std::uint32_t kTile = 8;
+  constexpr std::uint32_t kN    = (kTile << 2) + 1;
+  const std::vector<float> src  = MakeHeights(kN, Bumpy);
+  const std::string path        = WriteMap("navary_cache.nvtr", src, kN, kTile);
+  Io io;
+
+  TerrainTileCache cache;
+  TerrainTileCache::Desc desc;
+  desc.async_io           = &io.io;
+  desc.max_resident_tiles = 6;
+  REQUIRE(cache.Open(path.c_str(), desc).ok());
+  REQUIRE(cache.LoadBlocking(0, /*pin=*/true).ok());
+  REQUIRE(cache.resident_count() == 1);
+
+  for (std::uint32_t node = 1; node <= 4; ++node) {
+    cache.Request(node, static_cast<float>(node));
+  }
+  cache.Update();
+  PumpLoads(&cache);
+  REQUIRE(cache.resident_count() == 5);
+  REQUIRE(cache.stats().loads_completed == 5);
+
+  // Tiles arrive intact: node 1 is depth 1 (0, 0), stride 2.
+  const std::uint16_t* t1 = cache.Peek(1);
+  REQUIRE(t1 != nullptr);
+  const TerrainFileHeader& h = cache.header();
+  for (std::uint32_t j = 0; j <= kTile; ++j) {
+    for (std::uint32_t i = 0; i <= kTile; ++i) {
+      const float v =
+          h.height_offset + t1[j * (kTile + 1) + i] * h.height_scale;
+      REQUIRE(std::fabs(v - src[(2 * j) * kN + 2 * i]) <=
+              h.height_scale * 0.5f + 1e-4f);
+    }
+  }
+
+  // One free slot left: node 5 takes it, 6 and 7 evict the two tiles not
+  // used this frame (3 and 4), never the acquired 1 and 2 or pinned 0.
+  REQUIRE(cache.Acquire(1) != nullptr);
+  REQUIRE(cache.Acquire(2) != nullptr);
+  cache.Request(5, 3.0f);
+  cache.Request(6, 2.0f);
+  cache.Request(7, 1.0f);
+  cache.Update();
+  PumpLoads(&cache);
+  REQUIRE(cache.stats().evictions == 2);
+  REQUIRE(cache.IsResident(0));
+  REQUIRE(cache.IsResident(1));
+  REQUIRE(cache.IsResident(2));
+  REQUIRE_FALSE(cache.IsResident(3));
+  REQUIRE_FALSE(cache.IsResident(4));
+  REQUIRE(cache.IsResident(5));
+  REQUIRE(cache.IsResident(6));
+  REQUIRE(cache.IsResident(7));
+
+  // Every slot in use this frame: the request waits.
+  for (std::uint32_t node : {1u, 2u, 5u, 6u, 7u}) {
+    REQUIRE(cache.Acquire(node) != nullptr);
+  }
+  cache.Request(8, 1.0f);
+  cache.Update();
+  REQUIRE(cache.loads_in_flight() == 0);
+  REQUIRE_FALSE(cache.IsResident(8));
+  REQUIRE(cache.resident_count() == 6);
+
+  cache.Shutdown();
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("HeightfieldTerrain: LOD follows distance, culling and coverage",
+          "[terrain]") {
+  constexpr std::uint32_t kTile = 16;
+  constexpr std::uint32_t kN    = (kTile << 4) + 1;
+  const std::vector<float> src  = MakeHeights(kN, Bumpy);
+  const std::string path        = WriteMap("navary_lod.nvtr", src, kN, kTile);
+  Io io;
+
+  HeightfieldTerrain terrain;
+  REQUIRE(terrain.Init(TerrainDesc(path, &io, 400)).ok());
+  REQUIRE(terrain.cache().resident_count() == 5);  // depths 0..1 pinned
+
+  TerrainView far_view;
+  far_view.eye = math::Vec3(128.0f, 1e6f, 128.0f);
+  Settle(&terrain, far_view);
+  REQUIRE(terrain.patch_count() == 1);
+  REQUIRE(terrain.patches()[0].depth == 0);
+
+  TerrainView near_view;
+  near_view.eye = math::Vec3(4.0f, Bumpy(4.0f, 4.0f) + 2.0f, 4.0f);
+  Settle(&terrain, near_view);
+  std::uint32_t deepest   = 0;
+  std::uint32_t shallowest = 99;
+  std::vector<int> cover(256 * 256, 0);  // per full-res quad
+  for (std::uint32_t i = 0; i < terrain.patch_count(); ++i) {
+    const TerrainPatch& p = terrain.patches()[i];
+    deepest               = std::max<std::uint32_t>(deepest, p.depth);
+    shallowest            = std::min<std::uint32_t>(shallowest, p.depth);
+    const auto size       = static_cast<std::uint32_t>(p.spacing * kTile);
+    const auto x0         = static_cast<std::uint32_t>(p.origin_x);
+    const auto z0         = static_cast<std::uint32_t>(p.origin_z);
+    for (std::uint32_t z = z0; z < z0 + size; ++z) {
+      for (std::uint32_t x = x0; x < x0 + size; ++x) {
+        ++cover[z * 256 + x];
+      }
+    }
+    if (p.origin_x == 0.0f && p.origin_z == 0.0f) {
+      REQUIRE(p.depth == 4);  // under the eye
+    }
+  }
+  REQUIRE(deepest == 4);
+  REQUIRE(shallowest < deepest);  // coarser with distance
+  REQUIRE(std::all_of(cover.begin(), cover.end(),
+                      [](int c) { return c == 1; }));
+  REQUIRE(terrain.nodes_visited() < 200);
+  REQUIRE(terrain.patches_dropped() == 0);
+
+  // Camera at the origin looking down -Z; the map lies ahead of it and,
+  // rotated half a turn, behind it.
+  const math::Mat4 proj = math::Mat4::PerspectiveRH(1.0f, 1.0f, 0.1f, 2000.0f);
+  HeightfieldTerrain ahead;
+  HeightfieldTerrain::Desc desc = TerrainDesc(path, &io, 400);
+  desc.origin                   = math::Vec3(-128.0f, -30.0f, -300.0f);
+  REQUIRE(ahead.Init(desc).ok());
+  const math::Frustum front =
+      math::Frustum::FromViewProj(proj, math::Mat4::Identity());
+  const math::Frustum back =
+      math::Frustum::FromViewProj(proj, math::Mat4::RotationY(kPi));
+  TerrainView view;
+  view.frustum = &front;
+  Settle(&ahead, view);
+  REQUIRE(ahead.patch_count() > 0);
+  for (std::uint32_t i = 0; i < ahead.patch_count(); ++i) {
+    const TerrainPatch& p = ahead.patches()[i];
+    const math::Aabb b    = ahead.NodeBounds(p.depth, p.x, p.z);
+    REQUIRE(front.IsAabbVisible(b.min(), b.max()));
+  }
+  view.frustum = &back;
+  REQUIRE(ahead.Update(view) == 0);
+
+  ahead.Shutdown();
+  terrain.Shutdown();
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("HeightfieldTerrain: cost follows the view, not the map size",
+          "[terrain]") {
+  constexpr std::uint32_t kTile = 16;
+  Io io;
+  std::uint32_t visited[2];
+  std::uint32_t patches[2];
+  for (int m = 0; m < 2; ++m) {
+    const std::uint32_t n = (kTile << (m == 0 ? 4 : 6)) + 1;  // 16x area
+    const std::vector<float> src = MakeHeights(n, Bumpy);
+    const std::string path = WriteMap("navary_scale.nvtr", src, n, kTile);
+    HeightfieldTerrain terrain;
+    REQUIRE(terrain.Init(TerrainDesc(path, &io, 1024)).ok());
+    TerrainView view;
+    view.eye = math::Vec3(100.0f, Bumpy(100.0f, 100.0f) + 5.0f, 100.0f);
+    Settle(&terrain, view);
+    visited[m] = terrain.nodes_visited();
+    patches[m] = terrain.patch_count();
+    terrain.Shutdown();
+    std::filesystem::remove(path);
+  }
+  // The larger map only adds a ring of coarse nodes per extra level.
+  REQUIRE(visited[1] < 2 * visited[0]);
+  REQUIRE(patches[1] < 2 * patches[0]);
+}
+
+TEST_CASE("HeightfieldTerrain: a full patch list counts what it drops",
+          "[terrain]") {
+  constexpr std::uint32_t kTile = 16;
+  constexpr std::uint32_t kN    = (kTile << 4) + 1;
+  const std::vector<float> src  = MakeHeights(kN, Bumpy);
+  const std::string path = WriteMap("navary_overflow.nvtr", src, kN, kTile);
+  Io io;
+  TerrainView view;
+  view.eye = math::Vec3(4.0f, Bumpy(4.0f, 4.0f) + 2.0f, 4.0f);
+
+  HeightfieldTerrain full;
+  REQUIRE(full.Init(TerrainDesc(path, &io, 400)).ok());
+  Settle(&full, view);
+  REQUIRE(full.patch_count() > 4);
+  REQUIRE(full.patches_dropped() == 0);
+
+  // Same view, room for four: the rest is reported, not silently lost.
+  HeightfieldTerrain capped;
+  HeightfieldTerrain::Desc desc = TerrainDesc(path, &io, 400);
+  desc.max_patches              = 4;
+  REQUIRE(capped.Init(desc).ok());
+  Settle(&capped, view);
+  REQUIRE(capped.patch_count() == 4);
+  REQUIRE(capped.patches_dropped() == full.patch_count() - 4);
+
+  capped.Shutdown();
+  REQUIRE(capped.patches_dropped() == 0);
+  full.Shutdown();
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("HeightfieldTerrain: stitched edges are crack-free", "[terrain]") {
+  constexpr std::uint32_t kTile = 8;
+  constexpr std::uint32_t kN    = (kTile << 5) + 1;
+  const std::vector<float> src  = MakeHeights(kN, Bumpy);
+  const std::string path        = WriteMap("navary_seam.nvtr", src, kN, kTile);
+  Io io;
+
+  HeightfieldTerrain terrain;
+  REQUIRE(terrain.Init(TerrainDesc(path, &io, 1400)).ok());
+  TerrainView view;
+  view.eye             = math::Vec3(60.0f, Bumpy(60.0f, 90.0f) + 3.0f, 90.0f);
+  view.max_pixel_error = 4.0f;
+  Settle(&terrain, view);
+
+  int mixed = 0;
+  REQUIRE(WorstSeam(terrain, /*stitched=*/true, &mixed) < 1e-3f);
+  REQUIRE(mixed > 0);
+  // Without the stitch shifts the same cut has visible cracks.
+  REQUIRE(WorstSeam(terrain, /*stitched=*/false, &mixed) > 1e-2f);
+
+  terrain.Shutdown();
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("HeightfieldTerrain: SIMD height and normal queries", "[terrain]") {
+  constexpr std::uint32_t kTile = 16;
+  constexpr std::uint32_t kN    = (kTile << 3) + 1;
+  const std::vector<float> src  = MakeHeights(kN, Bumpy);
+  const std::string path        = WriteMap("navary_query.nvtr", src, kN, kTile);
+  Io io;
+
+  HeightfieldTerrain terrain;
+  HeightfieldTerrain::Desc desc = TerrainDesc(path, &io, 128);
+  desc.origin                   = math::Vec3(-64.0f, 3.0f, 10.0f);
+  REQUIRE(terrain.Init(desc).ok());
+
+  // Only depths 0..1 are resident: samples on the depth-1 grid are exact.
+  const float quant = terrain.cache().header().height_scale;
+  for (std::uint32_t z = 0; z < kN; z += 4) {
+    for (std::uint32_t x = 0; x < kN; x += 4) {
+      const float h = terrain.HeightAt(x - 64.0f, z + 10.0f);
+      REQUIRE(std::fabs(h - (src[z * kN + x] + 3.0f)) <= quant);
+    }
+  }
+
+  LoadAll(&terrain);
+  for (std::uint32_t z = 0; z < kN; ++z) {
+    for (std::uint32_t x = 0; x < kN; ++x) {
+      const float h = terrain.HeightAt(x - 64.0f, z + 10.0f);
+      REQUIRE(std::fabs(h - (src[z * kN + x] + 3.0f)) <= quant);
+    }
+  }
+
+  // Batched SIMD path agrees with the scalar one, in and out of the map.
+  Rng rng(7);
+  std::vector<float> xs(1003);
+  std::vector<float> zs(1003);
+  for (std::size_t i = 0; i < xs.size(); ++i) {
+    const bool cluster = (i / 4) % 2 == 0;  // groups sharing one tile
+    const float base_x = cluster ? 20.0f : -90.0f;
+    const float span   = cluster ? 3.0f : 200.0f;
+    xs[i]              = base_x + rng.NextFloat() * span;
+    zs[i]              = (cluster ? 30.0f : -20.0f) + rng.NextFloat() * span;
+  }
+  std::vector<float> batch(xs.size());
+  terrain.HeightsAt(xs.data(), zs.data(), std::uint32_t(xs.size()),
+                    batch.data());
+  for (std::size_t i = 0; i < xs.size(); ++i) {
+    REQUIRE_THAT(batch[i],
+                 Catch::Matchers::WithinAbs(terrain.HeightAt(xs[i], zs[i]),
+                                            1e-3));
+  }
+  terrain.Shutdown();
+  std::filesystem::remove(path);
+
+  const std::vector<float> plane = MakeHeights(kN, Tilted);
+  const std::string plane_path =
+      WriteMap("navary_plane.nvtr", plane, kN, kTile);
+  HeightfieldTerrain tilted;
+  REQUIRE(tilted.Init(TerrainDesc(plane_path, &io, 128)).ok());
+  const math::Vec3 n = tilted.NormalAt(50.3f, 70.8f);
+  const math::Vec3 e = math::Vec3(-0.5f, 1.0f, -0.25f).normalized();
+  REQUIRE(std::fabs(n.x - e.x) < 1e-3f);
+  REQUIRE(std::fabs(n.y - e.y) < 1e-3f);
+  REQUIRE(std::fabs(n.z - e.z) < 1e-3f);
+  REQUIRE_THAT(tilted.HeightAt(50.3f, 70.8f),
+               Catch::Matchers::WithinAbs(Tilted(50.3f, 70.8f), 1e-2));
+  tilted.Shutdown();
+  std::filesystem::remove(plane_path);
+}
+
+TEST_CASE("HeightfieldTerrain: raycasts", "[terrain]") {
+  constexpr std::uint32_t kTile = 16;
+  constexpr std::uint32_t kN    = (kTile << 3) + 1;
+  const std::vector<float> src  = MakeHeights(kN, Bumpy);
+  const std::string path        = WriteMap("navary_ray.nvtr", src, kN, kTile);
+  Io io;
+
+  HeightfieldTerrain terrain;
+  REQUIRE(terrain.Init(TerrainDesc(path, &io, 128)).ok());
+  LoadAll(&terrain);
+
+  // Straight down.
+  TerrainRayHit hit{};
+  REQUIRE(terrain.Raycast(math::Vec3(40.5f, 500.0f, 77.25f),
+                          math::Vec3(0.0f, -1.0f, 0.0f), 1000.0f, &hit));
+  const float ground = terrain.HeightAt(40.5f, 77.25f);
+  REQUIRE(std::fabs(hit.position.y - ground) < 1e-2f);
+  REQUIRE(std::fabs(hit.distance - (500.0f - ground)) < 1e-2f);
+  REQUIRE(hit.normal.y > 0.0f);
+
+  // Misses: pointing up, too short, and passing beside the map.
+  REQUIRE_FALSE(terrain.Raycast(math::Vec3(40.0f, 100.0f, 40.0f),
+                                math::Vec3(0.3f, 1.0f, 0.0f), 1000.0f, &hit));
+  REQUIRE_FALSE(terrain.Raycast(math::Vec3(40.0f, 100.0f, 40.0f),
+                                math::Vec3(0.0f, -1.0f, 0.0f), 10.0f, &hit));
+  REQUIRE_FALSE(terrain.Raycast(math::Vec3(-10.0f, 0.0f, -10.0f),
+                                math::Vec3(-1.0f, 0.0f, 0.0f), 1000.0f, &hit));
+
+  // Grazing rays against a fine brute-force march.
+  Rng rng(11);
+  int hits = 0;
+  for (int r = 0; r < 64; ++r) {
+    const math::Vec3 o(rng.NextFloat() * 128.0f, 40.0f,
+                       rng.NextFloat() * 128.0f);
+    const float yaw = rng.NextFloat() * 2.0f * kPi;
+    const math::Vec3 d(std::cos(yaw), -0.2f - 0.4f * rng.NextFloat(),
+                       std::sin(yaw));
+    const math::Vec3 dn = d.normalized();
+    float brute         = -1.0f;
+    for (float t = 0.0f; t < 300.0f; t += 0.01f) {
+      const math::Vec3 p = o + dn * t;
+      if (p.x < 0.0f || p.z < 0.0f || p.x > 128.0f || p.z > 128.0f) {
+        break;
+      }
+      if (p.y <= terrain.HeightAt(p.x, p.z)) {
+        brute = t;
+        break;
+      }
+    }
+    const bool got = terrain.Raycast(o, d, 300.0f, &hit);
+    REQUIRE(got == (brute >= 0.0f));
+    if (got) {
+      ++hits;
+      REQUIRE(std::fabs(hit.distance - brute) < 0.05f);
+    }
+  }
+  REQUIRE(hits > 16);
+
+  terrain.Shutdown();
+  std::filesystem::remove(path);
+}
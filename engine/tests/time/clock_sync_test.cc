@@ -0,0 +1,149 @@
+// Navary Engine - Timing Subsystem Tests
+// File: tests/core/time/clock_sync_test.cc
+// Focus: Offset/RTT estimation under delay, jitter and spikes; SoftResync
+// tracking without speed jumps.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+
+#include "navary/core/time/clock_sync.h"
+#include "navary/core/time/clock_sync_loopback.h"
+#include "navary/core/time/soft_resync.h"
+
+using namespace navary::core::time;
+
+namespace {
+
+std::uint64_t AbsDiff(std::int64_t a, std::int64_t b) {
+  return a > b ? static_cast<std::uint64_t>(a - b)
+               : static_cast<std::uint64_t>(b - a);
+}
+
+}  // namespace
+
+TEST_CASE("ClockSync: exact offset and rtt on a clean symmetric path",
+          "[time][clocksync]") {
+  ClockSyncLoopbackDesc d;
+  d.server_offset_ns = static_cast<std::int64_t>(SecondsToNs(3600.0));
+  d.jitter_ns        = 0;
+  ClockSyncLoopback net(d);
+
+  ClockSync sync;
+  std::uint64_t mono = SecondsToNs(5.0);
+  for (int i = 0; i < 3; ++i) {
+    REQUIRE(sync.AddSample(net.Exchange(mono)));
+    mono += MsToNs(100);
+  }
+  REQUIRE(sync.has_estimate());
+  REQUIRE(sync.offset_ns() == d.server_offset_ns);
+  REQUIRE(sync.rtt_ns() == 2 * d.base_delay_ns);
+  REQUIRE(sync.jitter_ns() == 0);
+  REQUIRE(sync.ServerNowNs(mono) == net.ServerNowNs(mono));
+}
+
+TEST_CASE("ClockSync: min-RTT filtering rejects jitter and spikes",
+          "[time][clocksync]") {
+  ClockSyncLoopbackDesc d;
+  d.server_offset_ns = -static_cast<std::int64_t>(MsToNs(750));
+  d.base_delay_ns    = MsToNs(40);
+  d.jitter_ns        = MsToNs(15);
+  d.spike_every      = 3;
+  d.spike_ns         = MsToNs(200);
+  ClockSyncLoopback net(d);
+
+  ClockSyncConfig cfg;
+  cfg.window = 32;
+  ClockSync sync(cfg);
+
+  std::uint64_t mono = SecondsToNs(1.0);
+  for (int i = 0; i < 64; ++i) {
+    sync.AddSample(net.Exchange(mono));
+    mono += MsToNs(250);
+  }
+
+  // A raw sample can be off by up to ~(jitter + spike) / 2.
+  REQUIRE(AbsDiff(sync.offset_ns(), d.server_offset_ns) < MsToNs(3));
+  REQUIRE(sync.min_rtt_ns() >= 2 * d.base_delay_ns);
+  REQUIRE(sync.rtt_ns() < 2 * d.base_delay_ns + 2 * d.jitter_ns);
+  REQUIRE(sync.jitter_ns() > 0);
+  REQUIRE(sync.RecommendedLeadNs(MsToNs(5)) > d.base_delay_ns);
+}
+
+TEST_CASE("ClockSync: impossible and over-limit exchanges are rejected",
+          "[time][clocksync]") {
+  ClockSyncConfig cfg;
+  cfg.max_rtt_ns = MsToNs(500);
+  ClockSync sync(cfg);
+
+  // Reply "before" the request.
+  REQUIRE_FALSE(sync.AddSample({MsToNs(100), 0, 0, MsToNs(50)}));
+  // Server hold longer than the whole round trip.
+  REQUIRE_FALSE(
+      sync.AddSample({0, MsToNs(10), MsToNs(200), MsToNs(100)}));
+  // Too slow.
+  REQUIRE_FALSE(sync.AddSample({0, MsToNs(300), MsToNs(300), MsToNs(900)}));
+  REQUIRE(sync.rejected_count() == 3);
+  REQUIRE(sync.sample_count() == 0);
+  REQUIRE_FALSE(sync.has_estimate());
+
+  SoftResync resync;
+  REQUIRE(sync.Apply(&resync, MsToNs(1), 0) == 0);
+}
+
+TEST_CASE("ClockSync: SoftResync tracks a drifting server smoothly",
+          "[time][clocksync][resync]") {
+  ClockSyncLoopbackDesc d;
+  d.server_offset_ns = static_cast<std::int64_t>(SecondsToNs(42.0));
+  d.server_drift_ppm = 200.0;  // server clock runs 0.2 ms/s fast
+  d.jitter_ns        = MsToNs(4);
+  ClockSyncLoopback net(d);
+
+  ClockSync sync;
+  SoftResync resync;
+  resync.SetTargetWindowSec(1.0);
+  resync.SetMaxSlewRateNsPerSec(MsToNs(5));
+  const std::int64_t max_step = static_cast<std::int64_t>(
+      MsToNs(5) * 16 / 1000);  // slew cap per 16 ms update
+
+  std::uint64_t mono = SecondsToNs(10.0);
+  std::int64_t prev  = 0;
+  bool seeded        = false;
+  for (int frame = 0; frame < 60 * 60; ++frame) {  // 60 s at 60 Hz
+    if (frame % 30 == 0) {
+      sync.AddSample(net.Exchange(mono));
+    }
+    const std::int64_t bias = sync.Apply(&resync, mono, 0);
+    if (seeded) {
+      REQUIRE(AbsDiff(bias, prev) <= static_cast<std::uint64_t>(max_step));
+    }
+    seeded = sync.has_estimate();
+    prev   = bias;
+    mono += MsToNs(16);
+  }
+
+  // Adjusted client time sits on server time, within path asymmetry.
+  const std::int64_t error =
+      static_cast<std::int64_t>(resync.AdjustedNs(mono)) -
+      static_cast<std::int64_t>(net.ServerNowNs(mono));
+  REQUIRE(AbsDiff(error, 0) < MsToNs(4));
+}
+
+TEST_CASE("ClockSync: lead keeps lockstep clients ahead of the server",
+          "[time][clocksync]") {
+  ClockSyncLoopbackDesc d;
+  d.jitter_ns = 0;
+  ClockSyncLoopback net(d);
+
+  ClockSync sync;
+  for (int i = 0; i < 4; ++i) {
+    sync.AddSample(net.Exchange(MsToNs(100) * (i + 1)));
+  }
+  const std::uint64_t lead = sync.RecommendedLeadNs(MsToNs(10));
+  REQUIRE(lead == d.base_delay_ns + MsToNs(10));
+
+  SoftResync resync;
+  sync.Apply(&resync, SecondsToNs(1.0), static_cast<std::int64_t>(lead));
+  REQUIRE(resync.AdjustedNs(SecondsToNs(1.0)) ==
+          net.ServerNowNs(SecondsToNs(1.0)) + lead);
+}